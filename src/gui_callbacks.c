@@ -235,7 +235,7 @@ on_save_file_ok( GtkWidget *widget, gpointer data )
     /* find the last non-init-voice patch, and set the end position to it, then
      * update the patch names */
     for (i = 127;
-         i > 0 && gui_data_patch_compare(&patches[i], &xsynth_init_voice);
+         i > 0 && xsynth_data_patch_compare(&patches[i], &xsynth_init_voice);
          i--);
     (GTK_ADJUSTMENT(save_file_end_spin_adj))->value = (float)i;
     gtk_signal_emit_by_name (GTK_OBJECT (save_file_start_spin_adj), "value_changed");
@@ -474,7 +474,7 @@ on_edit_action_button_press(GtkWidget *widget, gpointer data)
     /* find the last non-init-voice patch, and set the save position to the
      * following patch */
     for (i = 128;
-         i > 0 && gui_data_patch_compare(&patches[i - 1], &xsynth_init_voice);
+         i > 0 && xsynth_data_patch_compare(&patches[i - 1], &xsynth_init_voice);
          i--);
     if (i < 128)
         (GTK_ADJUSTMENT(edit_save_position_spin_adj))->value = (float)i;
@@ -37,6 +37,11 @@
  * forward-shifted slope discontinuity delta truncated after local minimum
  * at 4513th oversample (yielding a 71 sample pulse)
  *
+ * Both tables are laid out phase-major: for each of the MINBLEP_PHASES
+ * fractional sample phases, the pulse's taps are contiguous, padded with
+ * zeros to MINBLEP_PULSE_STRIDE, followed by the deltas to the next
+ * phase's taps for linear interpolation between phases.
+ *
  * For more information, see:
  *
  *    Stilson and Smith, "Alias Free Digital Synthesis of Classic Analog
@@ -45,1735 +50,3852 @@
  *    Brandt, "Hard Sync Without Aliasing" (2001)
  */
 
-float_value_delta
-xsynth_step_dd_table[MINBLEP_PHASES * STEP_DD_PULSE_LENGTH + 1] =
+const xsynth_minblep_phase_t
+xsynth_step_dd_table[MINBLEP_PHASES] =
 {
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 3.120477e-10},{ 3.120477e-10, 2.206607e-10},
- { 5.327084e-10, 3.324307e-10},{ 8.651391e-10, 5.145081e-10},{ 1.379647e-09, 7.942344e-10},{ 2.173882e-09, 1.204874e-09},
- { 3.378756e-09, 1.786396e-09},{ 5.165152e-09, 2.586318e-09},{ 7.751469e-09, 3.660619e-09},{ 1.141209e-08, 5.074724e-09},
- { 1.648681e-08, 6.904558e-09},{ 2.339137e-08, 9.237679e-09},{ 3.262905e-08, 1.217449e-08},{ 4.480354e-08, 1.582953e-08},
- { 6.063307e-08, 2.033286e-08},{ 8.096593e-08, 2.583152e-08},{ 1.067974e-07, 3.249110e-08},{ 1.392886e-07, 4.049739e-08},
- { 1.797859e-07, 5.005810e-08},{ 2.298440e-07, 6.140477e-08},{ 2.912488e-07, 7.479467e-08},{ 3.660435e-07, 9.051285e-08},
- { 4.565563e-07, 1.088744e-07},{ 5.654307e-07, 1.302265e-07},{ 6.956571e-07, 1.549511e-07},{ 8.506082e-07, 1.834672e-07},
- { 1.034075e-06, 2.162336e-07},{ 1.250309e-06, 2.537515e-07},{ 1.504060e-06, 2.965675e-07},{ 1.800628e-06, 3.452764e-07},
- { 2.145904e-06, 4.005246e-07},{ 2.546429e-06, 4.630129e-07},{ 3.009442e-06, 5.335003e-07},{ 3.542942e-06, 6.128071e-07},
- { 4.155749e-06, 7.018187e-07},{ 4.857568e-06, 8.014893e-07},{ 5.659057e-06, 9.128457e-07},{ 6.571903e-06, 1.036991e-06},
- { 7.608894e-06, 1.175111e-06},{ 8.784005e-06, 1.328473e-06},{ 1.011248e-05, 1.498436e-06},{ 1.161091e-05, 1.686452e-06},
- { 1.329737e-05, 1.894073e-06},{ 1.519144e-05, 2.122953e-06},{ 1.731439e-05, 2.374852e-06},{ 1.968924e-05, 2.651647e-06},
- { 2.234089e-05, 2.955329e-06},{ 2.529622e-05, 3.288016e-06},{ 2.858424e-05, 3.651952e-06},{ 3.223619e-05, 4.049516e-06},
- { 3.628570e-05, 4.483226e-06},{ 4.076893e-05, 4.955745e-06},{ 4.572467e-05, 5.469888e-06},{ 5.119456e-05, 6.028624e-06},
- { 5.722319e-05, 6.635087e-06},{ 6.385827e-05, 7.292577e-06},{ 7.115085e-05, 8.004569e-06},{ 7.915542e-05, 8.774718e-06},
- { 8.793014e-05, 9.606865e-06},{ 9.753700e-05, 1.050504e-05},{ 1.080420e-04, 1.147349e-05},{ 1.195155e-04, 1.251663e-05},
- { 1.320322e-04, 1.363912e-05},{ 1.456713e-04, 1.484582e-05},{ 1.605171e-04, 1.614181e-05},{ 1.766589e-04, 1.753242e-05},
- { 1.941913e-04, 1.902320e-05},{ 2.132145e-04, 2.061994e-05},{ 2.338345e-04, 2.232867e-05},{ 2.561631e-04, 2.415569e-05},
- { 2.803188e-04, 2.610756e-05},{ 3.064264e-04, 2.819108e-05},{ 3.346175e-04, 3.041336e-05},{ 3.650308e-04, 3.278174e-05},
- { 3.978126e-04, 3.530388e-05},{ 4.331164e-04, 3.798771e-05},{ 4.711041e-04, 4.084145e-05},{ 5.119456e-04, 4.387361e-05},
- { 5.558192e-04, 4.709303e-05},{ 6.029122e-04, 5.050883e-05},{ 6.534211e-04, 5.413045e-05},{ 7.075515e-04, 5.796763e-05},
- { 7.655191e-04, 6.203044e-05},{ 8.275496e-04, 6.632928e-05},{ 8.938789e-04, 7.087486e-05},{ 9.647537e-04, 7.567822e-05},
- { 1.040432e-03, 8.075073e-05},{ 1.121183e-03, 8.610410e-05},{ 1.207287e-03, 9.175036e-05},{ 1.299037e-03, 9.770189e-05},
- { 1.396739e-03, 1.039714e-04},{ 1.500710e-03, 1.105719e-04},{ 1.611282e-03, 1.175168e-04},{ 1.728799e-03, 1.248199e-04},
- { 1.853619e-03, 1.324951e-04},{ 1.986114e-03, 1.405569e-04},{ 2.126671e-03, 1.490199e-04},{ 2.275691e-03, 1.578993e-04},
- { 2.433590e-03, 1.672105e-04},{ 2.600801e-03, 1.769690e-04},{ 2.777770e-03, 1.871910e-04},{ 2.964961e-03, 1.978928e-04},
- { 3.162853e-03, 2.090910e-04},{ 3.371944e-03, 2.208026e-04},{ 3.592747e-03, 2.330449e-04},{ 3.825792e-03, 2.458353e-04},
- { 4.071627e-03, 2.591918e-04},{ 4.330819e-03, 2.731324e-04},{ 4.603952e-03, 2.876755e-04},{ 4.891627e-03, 3.028397e-04},
- { 5.194467e-03, 3.186439e-04},{ 5.513111e-03, 3.351072e-04},{ 5.848218e-03, 3.522489e-04},{ 6.200467e-03, 3.700885e-04},
- { 6.570555e-03, 3.886459e-04},{ 6.959201e-03, 4.079408e-04},{ 7.367142e-03, 4.279934e-04},{ 7.795135e-03, 4.488239e-04},
- { 8.243959e-03, 4.704527e-04},{ 8.714412e-03, 4.929002e-04},{ 9.207312e-03, 5.161870e-04},{ 9.723499e-03, 5.403338e-04},
- { 1.026383e-02, 5.653614e-04},{ 1.082919e-02, 5.912904e-04},{ 1.142048e-02, 6.181416e-04},{ 1.203863e-02, 6.459358e-04},
- { 1.268456e-02, 6.746937e-04},{ 1.335926e-02, 7.044362e-04},{ 1.406369e-02, 7.351836e-04},{ 1.479888e-02, 7.669567e-04},
- { 1.556583e-02, 7.997757e-04},{ 1.636561e-02, 8.336609e-04},{ 1.719927e-02, 8.686324e-04},{ 1.806790e-02, 9.047100e-04},
- { 1.897261e-02, 9.419134e-04},{ 1.991452e-02, 9.802618e-04},{ 2.089479e-02, 1.019774e-03},{ 2.191456e-02, 1.060470e-03},
- { 2.297503e-02, 1.102367e-03},{ 2.407740e-02, 1.145483e-03},{ 2.522288e-02, 1.189835e-03},{ 2.641272e-02, 1.235442e-03},
- { 2.764816e-02, 1.282319e-03},{ 2.893048e-02, 1.330483e-03},{ 3.026096e-02, 1.379949e-03},{ 3.164091e-02, 1.430732e-03},
- { 3.307164e-02, 1.482846e-03},{ 3.455449e-02, 1.536306e-03},{ 3.609079e-02, 1.591124e-03},{ 3.768192e-02, 1.647312e-03},
- { 3.932923e-02, 1.704881e-03},{ 4.103411e-02, 1.763844e-03},{ 4.279795e-02, 1.824208e-03},{ 4.462216e-02, 1.885984e-03},
- { 4.650814e-02, 1.949178e-03},{ 4.845732e-02, 2.013799e-03},{ 5.047112e-02, 2.079853e-03},{ 5.255098e-02, 2.147344e-03},
- { 5.469832e-02, 2.216276e-03},{ 5.691460e-02, 2.286653e-03},{ 5.920125e-02, 2.358476e-03},{ 6.155972e-02, 2.431745e-03},
- { 6.399147e-02, 2.506461e-03},{ 6.649793e-02, 2.582621e-03},{ 6.908055e-02, 2.660222e-03},{ 7.174077e-02, 2.739260e-03},
- { 7.448003e-02, 2.819729e-03},{ 7.729976e-02, 2.901622e-03},{ 8.020138e-02, 2.984930e-03},{ 8.318631e-02, 3.069643e-03},
- { 8.625596e-02, 3.155750e-03},{ 8.941171e-02, 3.243239e-03},{ 9.265495e-02, 3.332094e-03},{ 9.598704e-02, 3.422299e-03},
- { 9.940934e-02, 3.513837e-03},{ 1.029232e-01, 3.606690e-03},{ 1.065299e-01, 3.700835e-03},{ 1.102307e-01, 3.796250e-03},
- { 1.140270e-01, 3.892912e-03},{ 1.179199e-01, 3.990795e-03},{ 1.219107e-01, 4.089870e-03},{ 1.260005e-01, 4.190109e-03},
- { 1.301906e-01, 4.291481e-03},{ 1.344821e-01, 4.393953e-03},{ 1.388761e-01, 4.497491e-03},{ 1.433736e-01, 4.602057e-03},
- { 1.479756e-01, 4.707615e-03},{ 1.526832e-01, 4.814124e-03},{ 1.574974e-01, 4.921542e-03},{ 1.624189e-01, 5.029827e-03},
- { 1.674487e-01, 5.138931e-03},{ 1.725877e-01, 5.248810e-03},{ 1.778365e-01, 5.359413e-03},{ 1.831959e-01, 5.470690e-03},
- { 1.886666e-01, 5.582589e-03},{ 1.942492e-01, 5.695054e-03},{ 1.999442e-01, 5.808031e-03},{ 2.057522e-01, 5.921461e-03},
- { 2.116737e-01, 6.035285e-03},{ 2.177090e-01, 6.149442e-03},{ 2.238584e-01, 6.263868e-03},{ 2.301223e-01, 6.378499e-03},
- { 2.365008e-01, 6.493268e-03},{ 2.429941e-01, 6.608108e-03},{ 2.496022e-01, 6.722949e-03},{ 2.563251e-01, 6.837721e-03},
- { 2.631628e-01, 6.952349e-03},{ 2.701152e-01, 7.066762e-03},{ 2.771820e-01, 7.180882e-03},{ 2.843628e-01, 7.294633e-03},
- { 2.916575e-01, 7.407936e-03},{ 2.990654e-01, 7.520713e-03},{ 3.065861e-01, 7.632882e-03},{ 3.142190e-01, 7.744360e-03},
- { 3.219634e-01, 7.855066e-03},{ 3.298184e-01, 7.964914e-03},{ 3.377833e-01, 8.073819e-03},{ 3.458572e-01, 8.181696e-03},
- {-6.459611e-01, 8.288455e-03},{-6.376727e-01, 8.394010e-03},{-6.292787e-01, 8.498272e-03},{-6.207804e-01, 8.601151e-03},
- {-6.121793e-01, 8.702557e-03},{-6.034767e-01, 8.802399e-03},{-5.946743e-01, 8.900586e-03},{-5.857737e-01, 8.997026e-03},
- {-5.767767e-01, 9.091628e-03},{-5.676851e-01, 9.184299e-03},{-5.585008e-01, 9.274948e-03},{-5.492258e-01, 9.363481e-03},
- {-5.398623e-01, 9.449807e-03},{-5.304125e-01, 9.533834e-03},{-5.208787e-01, 9.615469e-03},{-5.112632e-01, 9.694621e-03},
- {-5.015686e-01, 9.771199e-03},{-4.917974e-01, 9.845112e-03},{-4.819523e-01, 9.916270e-03},{-4.720360e-01, 9.984585e-03},
- {-4.620514e-01, 1.004997e-02},{-4.520015e-01, 1.011233e-02},{-4.418891e-01, 1.017158e-02},{-4.317176e-01, 1.022764e-02},
- {-4.214899e-01, 1.028043e-02},{-4.112095e-01, 1.032986e-02},{-4.008796e-01, 1.037584e-02},{-3.905038e-01, 1.041831e-02},
- {-3.800855e-01, 1.045717e-02},{-3.696283e-01, 1.049236e-02},{-3.591359e-01, 1.052380e-02},{-3.486122e-01, 1.055141e-02},
- {-3.380607e-01, 1.057514e-02},{-3.274856e-01, 1.059489e-02},{-3.168907e-01, 1.061062e-02},{-3.062801e-01, 1.062226e-02},
- {-2.956578e-01, 1.062974e-02},{-2.850281e-01, 1.063301e-02},{-2.743951e-01, 1.063201e-02},{-2.637631e-01, 1.062669e-02},
- {-2.531364e-01, 1.061699e-02},{-2.425194e-01, 1.060288e-02},{-2.319165e-01, 1.058429e-02},{-2.213322e-01, 1.056120e-02},
- {-2.107710e-01, 1.053356e-02},{-2.002374e-01, 1.050135e-02},{-1.897361e-01, 1.046452e-02},{-1.792716e-01, 1.042305e-02},
- {-1.688485e-01, 1.037691e-02},{-1.584716e-01, 1.032609e-02},{-1.481455e-01, 1.027056e-02},{-1.378750e-01, 1.021032e-02},
- {-1.276646e-01, 1.014535e-02},{-1.175193e-01, 1.007565e-02},{-1.074436e-01, 1.000122e-02},{-9.744243e-02, 9.922048e-03},
- {-8.752038e-02, 9.838155e-03},{-7.768223e-02, 9.749546e-03},{-6.793268e-02, 9.656236e-03},{-5.827645e-02, 9.558243e-03},
- {-4.871820e-02, 9.455592e-03},{-3.926261e-02, 9.348307e-03},{-2.991430e-02, 9.236422e-03},{-2.067788e-02, 9.119972e-03},
- {-1.155791e-02, 8.998997e-03},{-2.558910e-03, 8.873542e-03},{ 6.314631e-03, 8.743655e-03},{ 1.505829e-02, 8.609389e-03},
- { 2.366767e-02, 8.470802e-03},{ 3.213848e-02, 8.327956e-03},{ 4.046643e-02, 8.180918e-03},{ 4.864735e-02, 8.029757e-03},
- { 5.667711e-02, 7.874549e-03},{ 6.455166e-02, 7.715373e-03},{ 7.226703e-02, 7.552312e-03},{ 7.981934e-02, 7.385455e-03},
- { 8.720480e-02, 7.214892e-03},{ 9.441969e-02, 7.040720e-03},{ 1.014604e-01, 6.863040e-03},{ 1.083234e-01, 6.681954e-03},
- { 1.150054e-01, 6.497572e-03},{ 1.215030e-01, 6.310006e-03},{ 1.278130e-01, 6.119371e-03},{ 1.339324e-01, 5.925786e-03},
- { 1.398581e-01, 5.729376e-03},{ 1.455875e-01, 5.530267e-03},{ 1.511178e-01, 5.328590e-03},{ 1.564464e-01, 5.124478e-03},
- { 1.615708e-01, 4.918069e-03},{ 1.664889e-01, 4.709502e-03},{ 1.711984e-01, 4.498921e-03},{ 1.756973e-01, 4.286474e-03},
- { 1.799838e-01, 4.072307e-03},{ 1.840561e-01, 3.856575e-03},{ 1.879127e-01, 3.639431e-03},{ 1.915521e-01, 3.421032e-03},
- { 1.949732e-01, 3.201538e-03},{ 1.981747e-01, 2.981110e-03},{ 2.011558e-01, 2.759912e-03},{ 2.039157e-01, 2.538109e-03},
- { 2.064538e-01, 2.315867e-03},{ 2.087697e-01, 2.093357e-03},{ 2.108631e-01, 1.870748e-03},{ 2.127338e-01, 1.648212e-03},
- { 2.143820e-01, 1.425920e-03},{ 2.158079e-01, 1.204046e-03},{ 2.170120e-01, 9.827651e-04},{ 2.179947e-01, 7.622510e-04},
- { 2.187570e-01, 5.426790e-04},{ 2.192997e-01, 3.242244e-04},{ 2.196239e-01, 1.070624e-04},{ 2.197310e-01,-1.086318e-04},
- { 2.196223e-01,-3.226835e-04},{ 2.192996e-01,-5.349184e-04},{ 2.187647e-01,-7.451629e-04},{ 2.180196e-01,-9.532445e-04},
- { 2.170663e-01,-1.158992e-03},{ 2.159073e-01,-1.362234e-03},{ 2.145451e-01,-1.562803e-03},{ 2.129823e-01,-1.760531e-03},
- { 2.112218e-01,-1.955253e-03},{ 2.092665e-01,-2.146806e-03},{ 2.071197e-01,-2.335029e-03},{ 2.047847e-01,-2.519764e-03},
- { 2.022649e-01,-2.700854e-03},{ 1.995641e-01,-2.878145e-03},{ 1.966859e-01,-3.051489e-03},{ 1.936344e-01,-3.220738e-03},
- { 1.904137e-01,-3.385747e-03},{ 1.870279e-01,-3.546378e-03},{ 1.834816e-01,-3.702493e-03},{ 1.797791e-01,-3.853959e-03},
- { 1.759251e-01,-4.000648e-03},{ 1.719245e-01,-4.142436e-03},{ 1.677820e-01,-4.279201e-03},{ 1.635028e-01,-4.410829e-03},
- { 1.590920e-01,-4.537209e-03},{ 1.545548e-01,-4.658233e-03},{ 1.498965e-01,-4.773801e-03},{ 1.451227e-01,-4.883817e-03},
- { 1.402389e-01,-4.988189e-03},{ 1.352507e-01,-5.086832e-03},{ 1.301639e-01,-5.179666e-03},{ 1.249842e-01,-5.266615e-03},
- { 1.197176e-01,-5.347611e-03},{ 1.143700e-01,-5.422591e-03},{ 1.089474e-01,-5.491497e-03},{ 1.034559e-01,-5.554279e-03},
- { 9.790165e-02,-5.610890e-03},{ 9.229076e-02,-5.661293e-03},{ 8.662947e-02,-5.705453e-03},{ 8.092401e-02,-5.743345e-03},
- { 7.518067e-02,-5.774949e-03},{ 6.940572e-02,-5.800250e-03},{ 6.360547e-02,-5.819241e-03},{ 5.778623e-02,-5.831922e-03},
- { 5.195431e-02,-5.838298e-03},{ 4.611601e-02,-5.838382e-03},{ 4.027763e-02,-5.832192e-03},{ 3.444543e-02,-5.819753e-03},
- { 2.862568e-02,-5.801098e-03},{ 2.282458e-02,-5.776266e-03},{ 1.704832e-02,-5.745301e-03},{ 1.130302e-02,-5.708254e-03},
- { 5.594762e-03,-5.665184e-03},{-7.042215e-05,-5.616156e-03},{-5.686578e-03,-5.561240e-03},{-1.124782e-02,-5.500513e-03},
- {-1.674833e-02,-5.434059e-03},{-2.218239e-02,-5.361968e-03},{-2.754436e-02,-5.284336e-03},{-3.282869e-02,-5.201263e-03},
- {-3.802996e-02,-5.112859e-03},{-4.314282e-02,-5.019237e-03},{-4.816205e-02,-4.920516e-03},{-5.308257e-02,-4.816820e-03},
- {-5.789939e-02,-4.708282e-03},{-6.260767e-02,-4.595035e-03},{-6.720271e-02,-4.477222e-03},{-7.167993e-02,-4.354988e-03},
- {-7.603492e-02,-4.228484e-03},{-8.026340e-02,-4.097867e-03},{-8.436127e-02,-3.963295e-03},{-8.832456e-02,-3.824934e-03},
- {-9.214950e-02,-3.682952e-03},{-9.583245e-02,-3.537523e-03},{-9.936997e-02,-3.388824e-03},{-1.027588e-01,-3.237033e-03},
- {-1.059958e-01,-3.082336e-03},{-1.090782e-01,-2.924919e-03},{-1.120031e-01,-2.764973e-03},{-1.147681e-01,-2.602689e-03},
- {-1.173707e-01,-2.438264e-03},{-1.198090e-01,-2.271896e-03},{-1.220809e-01,-2.103783e-03},{-1.241847e-01,-1.934128e-03},
- {-1.261188e-01,-1.763134e-03},{-1.278819e-01,-1.591006e-03},{-1.294730e-01,-1.417950e-03},{-1.308909e-01,-1.244173e-03},
- {-1.321351e-01,-1.069882e-03},{-1.332050e-01,-8.952848e-04},{-1.341002e-01,-7.205901e-04},{-1.348208e-01,-5.460056e-04},
- {-1.353668e-01,-3.717392e-04},{-1.357386e-01,-1.979978e-04},{-1.359366e-01,-2.498781e-05},{-1.359616e-01, 1.470857e-04},
- {-1.358145e-01, 3.180188e-04},{-1.354965e-01, 4.876092e-04},{-1.350089e-01, 6.556567e-04},{-1.343532e-01, 8.219628e-04},
- {-1.335312e-01, 9.863316e-04},{-1.325449e-01, 1.148570e-03},{-1.313963e-01, 1.308487e-03},{-1.300878e-01, 1.465895e-03},
- {-1.286219e-01, 1.620610e-03},{-1.270013e-01, 1.772451e-03},{-1.252289e-01, 1.921242e-03},{-1.233076e-01, 2.066810e-03},
- {-1.212408e-01, 2.208985e-03},{-1.190319e-01, 2.347603e-03},{-1.166842e-01, 2.482506e-03},{-1.142017e-01, 2.613537e-03},
- {-1.115882e-01, 2.740546e-03},{-1.088477e-01, 2.863391e-03},{-1.059843e-01, 2.981930e-03},{-1.030023e-01, 3.096031e-03},
- {-9.990631e-02, 3.205565e-03},{-9.670074e-02, 3.310410e-03},{-9.339033e-02, 3.410451e-03},{-8.997988e-02, 3.505578e-03},
- {-8.647430e-02, 3.595688e-03},{-8.287862e-02, 3.680683e-03},{-7.919793e-02, 3.760474e-03},{-7.543746e-02, 3.834977e-03},
- {-7.160248e-02, 3.904115e-03},{-6.769837e-02, 3.967819e-03},{-6.373055e-02, 4.026027e-03},{-5.970452e-02, 4.078682e-03},
- {-5.562584e-02, 4.125737e-03},{-5.150010e-02, 4.167150e-03},{-4.733295e-02, 4.202889e-03},{-4.313006e-02, 4.232925e-03},
- {-3.889714e-02, 4.257242e-03},{-3.463989e-02, 4.275827e-03},{-3.036407e-02, 4.288675e-03},{-2.607539e-02, 4.295792e-03},
- {-2.177960e-02, 4.297187e-03},{-1.748241e-02, 4.292878e-03},{-1.318953e-02, 4.282892e-03},{-8.906643e-03, 4.267261e-03},
- {-4.639382e-03, 4.246026e-03},{-3.933563e-04, 4.219234e-03},{ 3.825878e-03, 4.186940e-03},{ 8.012818e-03, 4.149207e-03},
- { 1.216202e-02, 4.106102e-03},{ 1.626813e-02, 4.057703e-03},{ 2.032583e-02, 4.004091e-03},{ 2.432992e-02, 3.945357e-03},
- { 2.827528e-02, 3.881597e-03},{ 3.215688e-02, 3.812913e-03},{ 3.596979e-02, 3.739414e-03},{ 3.970920e-02, 3.661215e-03},
- { 4.337042e-02, 3.578439e-03},{ 4.694886e-02, 3.491211e-03},{ 5.044007e-02, 3.399664e-03},{ 5.383973e-02, 3.303938e-03},
- { 5.714367e-02, 3.204175e-03},{ 6.034784e-02, 3.100524e-03},{ 6.344837e-02, 2.993140e-03},{ 6.644151e-02, 2.882180e-03},
- { 6.932369e-02, 2.767808e-03},{ 7.209149e-02, 2.650190e-03},{ 7.474169e-02, 2.529499e-03},{ 7.727118e-02, 2.405909e-03},
- { 7.967709e-02, 2.279599e-03},{ 8.195669e-02, 2.150750e-03},{ 8.410744e-02, 2.019549e-03},{ 8.612699e-02, 1.886183e-03},
- { 8.801317e-02, 1.750842e-03},{ 8.976402e-02, 1.613719e-03},{ 9.137773e-02, 1.475009e-03},{ 9.285274e-02, 1.334909e-03},
- { 9.418765e-02, 1.193616e-03},{ 9.538127e-02, 1.051330e-03},{ 9.643260e-02, 9.082513e-04},{ 9.734085e-02, 7.645804e-04},
- { 9.810543e-02, 6.205188e-04},{ 9.872595e-02, 4.762678e-04},{ 9.920222e-02, 3.320286e-04},{ 9.953424e-02, 1.880019e-04},
- { 9.972225e-02, 4.438767e-05},{ 9.976663e-02,-9.861501e-05},{ 9.966802e-02,-2.408085e-04},{ 9.942721e-02,-3.819966e-04},
- { 9.904521e-02,-5.219850e-04},{ 9.852323e-02,-6.605816e-04},{ 9.786265e-02,-7.975965e-04},{ 9.706505e-02,-9.328426e-04},
- { 9.613221e-02,-1.066135e-03},{ 9.506607e-02,-1.197294e-03},{ 9.386878e-02,-1.326141e-03},{ 9.254264e-02,-1.452501e-03},
- { 9.109014e-02,-1.576205e-03},{ 8.951393e-02,-1.697087e-03},{ 8.781684e-02,-1.814986e-03},{ 8.600186e-02,-1.929742e-03},
- { 8.407212e-02,-2.041206e-03},{ 8.203091e-02,-2.149229e-03},{ 7.988168e-02,-2.253670e-03},{ 7.762801e-02,-2.354391e-03},
- { 7.527362e-02,-2.451261e-03},{ 7.282236e-02,-2.544157e-03},{ 7.027820e-02,-2.632957e-03},{ 6.764524e-02,-2.717550e-03},
- { 6.492770e-02,-2.797827e-03},{ 6.212987e-02,-2.873690e-03},{ 5.925618e-02,-2.945043e-03},{ 5.631114e-02,-3.011799e-03},
- { 5.329934e-02,-3.073879e-03},{ 5.022546e-02,-3.131209e-03},{ 4.709425e-02,-3.183721e-03},{ 4.391053e-02,-3.231358e-03},
- { 4.067917e-02,-3.274065e-03},{ 3.740510e-02,-3.311800e-03},{ 3.409330e-02,-3.344523e-03},{ 3.074878e-02,-3.372205e-03},
- { 2.737658e-02,-3.394822e-03},{ 2.398175e-02,-3.412360e-03},{ 2.056939e-02,-3.424809e-03},{ 1.714459e-02,-3.432168e-03},
- { 1.371242e-02,-3.434446e-03},{ 1.027797e-02,-3.431655e-03},{ 6.846316e-03,-3.423817e-03},{ 3.422499e-03,-3.410961e-03},
- { 1.153746e-05,-3.393123e-03},{-3.381585e-03,-3.370345e-03},{-6.751930e-03,-3.342678e-03},{-1.009461e-02,-3.310180e-03},
- {-1.340479e-02,-3.272914e-03},{-1.667770e-02,-3.230952e-03},{-1.990865e-02,-3.184372e-03},{-2.309303e-02,-3.133257e-03},
- {-2.622628e-02,-3.077699e-03},{-2.930398e-02,-3.017795e-03},{-3.232178e-02,-2.953649e-03},{-3.527543e-02,-2.885370e-03},
- {-3.816080e-02,-2.813072e-03},{-4.097387e-02,-2.736878e-03},{-4.371075e-02,-2.656913e-03},{-4.636766e-02,-2.573309e-03},
- {-4.894097e-02,-2.486203e-03},{-5.142717e-02,-2.395736e-03},{-5.382291e-02,-2.302055e-03},{-5.612496e-02,-2.205310e-03},
- {-5.833027e-02,-2.105657e-03},{-6.043593e-02,-2.003253e-03},{-6.243918e-02,-1.898262e-03},{-6.433745e-02,-1.790849e-03},
- {-6.612829e-02,-1.681184e-03},{-6.780948e-02,-1.569439e-03},{-6.937892e-02,-1.455789e-03},{-7.083471e-02,-1.340410e-03},
- {-7.217512e-02,-1.223483e-03},{-7.339860e-02,-1.105188e-03},{-7.450379e-02,-9.857095e-04},{-7.548950e-02,-8.652302e-04},
- {-7.635473e-02,-7.439359e-04},{-7.709866e-02,-6.220127e-04},{-7.772068e-02,-4.996470e-04},{-7.822032e-02,-3.770255e-04},
- {-7.859735e-02,-2.543350e-04},{-7.885168e-02,-1.317616e-04},{-7.898345e-02,-9.491119e-06},{-7.899294e-02, 1.122919e-04},
- {-7.888064e-02, 2.334039e-04},{-7.864724e-02, 3.536628e-04},{-7.829358e-02, 4.728883e-04},{-7.782069e-02, 5.909023e-04},
- {-7.722979e-02, 7.075287e-04},{-7.652226e-02, 8.225940e-04},{-7.569966e-02, 9.359278e-04},{-7.476374e-02, 1.047363e-03},
- {-7.371637e-02, 1.156734e-03},{-7.255964e-02, 1.263881e-03},{-7.129576e-02, 1.368648e-03},{-6.992711e-02, 1.470880e-03},
- {-6.845623e-02, 1.570431e-03},{-6.688580e-02, 1.667155e-03},{-6.521864e-02, 1.760914e-03},{-6.345773e-02, 1.851572e-03},
- {-6.160616e-02, 1.939001e-03},{-5.966716e-02, 2.023077e-03},{-5.764408e-02, 2.103680e-03},{-5.554040e-02, 2.180698e-03},
- {-5.335970e-02, 2.254023e-03},{-5.110568e-02, 2.323555e-03},{-4.878212e-02, 2.389198e-03},{-4.639293e-02, 2.450864e-03},
- {-4.394206e-02, 2.508469e-03},{-4.143359e-02, 2.561939e-03},{-3.887166e-02, 2.611202e-03},{-3.626045e-02, 2.656198e-03},
- {-3.360425e-02, 2.696869e-03},{-3.090739e-02, 2.733167e-03},{-2.817422e-02, 2.765049e-03},{-2.540917e-02, 2.792481e-03},
- {-2.261669e-02, 2.815433e-03},{-1.980126e-02, 2.833885e-03},{-1.696737e-02, 2.847822e-03},{-1.411955e-02, 2.857238e-03},
- {-1.126231e-02, 2.862132e-03},{-8.400179e-03, 2.862511e-03},{-5.537667e-03, 2.858390e-03},{-2.679278e-03, 2.849789e-03},
- { 1.705109e-04, 2.836736e-03},{ 3.007247e-03, 2.819266e-03},{ 5.826512e-03, 2.797421e-03},{ 8.623933e-03, 2.771249e-03},
- { 1.139518e-02, 2.740805e-03},{ 1.413599e-02, 2.706151e-03},{ 1.684214e-02, 2.667355e-03},{ 1.950949e-02, 2.624491e-03},
- { 2.213399e-02, 2.577640e-03},{ 2.471163e-02, 2.526888e-03},{ 2.723851e-02, 2.472328e-03},{ 2.971084e-02, 2.414059e-03},
- { 3.212490e-02, 2.352183e-03},{ 3.447708e-02, 2.286811e-03},{ 3.676390e-02, 2.218057e-03},{ 3.898195e-02, 2.146040e-03},
- { 4.112799e-02, 2.070885e-03},{ 4.319888e-02, 1.992721e-03},{ 4.519160e-02, 1.911682e-03},{ 4.710328e-02, 1.827904e-03},
- { 4.893118e-02, 1.741530e-03},{ 5.067272e-02, 1.652706e-03},{ 5.232542e-02, 1.561579e-03},{ 5.388700e-02, 1.468303e-03},
- { 5.535530e-02, 1.373032e-03},{ 5.672833e-02, 1.275924e-03},{ 5.800426e-02, 1.177140e-03},{ 5.918140e-02, 1.076843e-03},
- { 6.025824e-02, 9.751969e-04},{ 6.123344e-02, 8.723687e-04},{ 6.210581e-02, 7.685260e-04},{ 6.287433e-02, 6.638379e-04},
- { 6.353817e-02, 5.584746e-04},{ 6.409665e-02, 4.526065e-04},{ 6.454925e-02, 3.464046e-04},{ 6.489566e-02, 2.400401e-04},
- { 6.513570e-02, 1.336839e-04},{ 6.526938e-02, 2.750632e-05},{ 6.529689e-02,-7.832283e-05},{ 6.521856e-02,-1.836348e-04},
- { 6.503493e-02,-2.882623e-04},{ 6.474667e-02,-3.920391e-04},{ 6.435463e-02,-4.948013e-04},{ 6.385983e-02,-5.963868e-04},
- { 6.326344e-02,-6.966357e-04},{ 6.256680e-02,-7.953908e-04},{ 6.177141e-02,-8.924977e-04},{ 6.087892e-02,-9.878051e-04},
- { 5.989111e-02,-1.081165e-03},{ 5.880995e-02,-1.172432e-03},{ 5.763751e-02,-1.261467e-03},{ 5.637605e-02,-1.348131e-03},
- { 5.502792e-02,-1.432293e-03},{ 5.359562e-02,-1.513825e-03},{ 5.208180e-02,-1.592601e-03},{ 5.048920e-02,-1.668504e-03},
- { 4.882069e-02,-1.741420e-03},{ 4.707927e-02,-1.811239e-03},{ 4.526803e-02,-1.877858e-03},{ 4.339018e-02,-1.941178e-03},
- { 4.144900e-02,-2.001109e-03},{ 3.944789e-02,-2.057561e-03},{ 3.739033e-02,-2.110455e-03},{ 3.527987e-02,-2.159716e-03},
- { 3.312016e-02,-2.205274e-03},{ 3.091488e-02,-2.247068e-03},{ 2.866782e-02,-2.285039e-03},{ 2.638278e-02,-2.319140e-03},
- { 2.406364e-02,-2.349325e-03},{ 2.171431e-02,-2.375558e-03},{ 1.933875e-02,-2.397809e-03},{ 1.694094e-02,-2.416052e-03},
- { 1.452489e-02,-2.430271e-03},{ 1.209462e-02,-2.440455e-03},{ 9.654167e-03,-2.446599e-03},{ 7.207568e-03,-2.448706e-03},
- { 4.758861e-03,-2.446786e-03},{ 2.312076e-03,-2.440852e-03},{-1.287765e-04,-2.430928e-03},{-2.559705e-03,-2.417042e-03},
- {-4.976747e-03,-2.399229e-03},{-7.375976e-03,-2.377530e-03},{-9.753506e-03,-2.351993e-03},{-1.210550e-02,-2.322671e-03},
- {-1.442817e-02,-2.289623e-03},{-1.671779e-02,-2.252917e-03},{-1.897071e-02,-2.212623e-03},{-2.118333e-02,-2.168818e-03},
- {-2.335215e-02,-2.121586e-03},{-2.547374e-02,-2.071014e-03},{-2.754475e-02,-2.017197e-03},{-2.956195e-02,-1.960231e-03},
- {-3.152218e-02,-1.900222e-03},{-3.342240e-02,-1.837278e-03},{-3.525968e-02,-1.771510e-03},{-3.703119e-02,-1.703037e-03},
- {-3.873423e-02,-1.631979e-03},{-4.036621e-02,-1.558463e-03},{-4.192467e-02,-1.482616e-03},{-4.340728e-02,-1.404572e-03},
- {-4.481186e-02,-1.324466e-03},{-4.613632e-02,-1.242438e-03},{-4.737876e-02,-1.158628e-03},{-4.853739e-02,-1.073181e-03},
- {-4.961057e-02,-9.862443e-04},{-5.059681e-02,-8.979658e-04},{-5.149478e-02,-8.084963e-04},{-5.230328e-02,-7.179878e-04},
- {-5.302126e-02,-6.265940e-04},{-5.364786e-02,-5.344691e-04},{-5.418233e-02,-4.417687e-04},{-5.462410e-02,-3.486486e-04},
- {-5.497274e-02,-2.552649e-04},{-5.522801e-02,-1.617739e-04},{-5.538978e-02,-6.833164e-05},{-5.545811e-02, 2.490647e-05},
- {-5.543321e-02, 1.177856e-04},{-5.531542e-02, 2.101520e-04},{-5.510527e-02, 3.018532e-04},{-5.480342e-02, 3.927380e-04},
- {-5.441068e-02, 4.826573e-04},{-5.392802e-02, 5.714638e-04},{-5.335656e-02, 6.590124e-04},{-5.269755e-02, 7.451606e-04},
- {-5.195239e-02, 8.297685e-04},{-5.112262e-02, 9.126991e-04},{-5.020992e-02, 9.938187e-04},{-4.921610e-02, 1.072997e-03},
- {-4.814310e-02, 1.150107e-03},{-4.699300e-02, 1.225026e-03},{-4.576797e-02, 1.297634e-03},{-4.447034e-02, 1.367817e-03},
- {-4.310252e-02, 1.435464e-03},{-4.166705e-02, 1.500470e-03},{-4.016658e-02, 1.562733e-03},{-3.860385e-02, 1.622156e-03},
- {-3.698169e-02, 1.678649e-03},{-3.530305e-02, 1.732124e-03},{-3.357092e-02, 1.782501e-03},{-3.178842e-02, 1.829705e-03},
- {-2.995872e-02, 1.873665e-03},{-2.808505e-02, 1.914316e-03},{-2.617074e-02, 1.951601e-03},{-2.421913e-02, 1.985467e-03},
- {-2.223367e-02, 2.015865e-03},{-2.021780e-02, 2.042756e-03},{-1.817505e-02, 2.066105e-03},{-1.610894e-02, 2.085881e-03},
- {-1.402306e-02, 2.102064e-03},{-1.192100e-02, 2.114635e-03},{-9.806362e-03, 2.123584e-03},{-7.682778e-03, 2.128907e-03},
- {-5.553871e-03, 2.130605e-03},{-3.423266e-03, 2.128687e-03},{-1.294579e-03, 2.123165e-03},{ 8.285865e-04, 2.114061e-03},
- { 2.942647e-03, 2.101399e-03},{ 5.044047e-03, 2.085212e-03},{ 7.129259e-03, 2.065538e-03},{ 9.194797e-03, 2.042419e-03},
- { 1.123722e-02, 2.015906e-03},{ 1.325312e-02, 1.986054e-03},{ 1.523918e-02, 1.952921e-03},{ 1.719210e-02, 1.916575e-03},
- { 1.910867e-02, 1.877087e-03},{ 2.098576e-02, 1.834533e-03},{ 2.282029e-02, 1.788993e-03},{ 2.460929e-02, 1.740555e-03},
- { 2.634984e-02, 1.689308e-03},{ 2.803915e-02, 1.635349e-03},{ 2.967450e-02, 1.578777e-03},{ 3.125328e-02, 1.519696e-03},
- { 3.277297e-02, 1.458213e-03},{ 3.423118e-02, 1.394441e-03},{ 3.562563e-02, 1.328494e-03},{ 3.695412e-02, 1.260492e-03},
- { 3.821461e-02, 1.190556e-03},{ 3.940517e-02, 1.118812e-03},{ 4.052398e-02, 1.045386e-03},{ 4.156937e-02, 9.704094e-04},
- { 4.253978e-02, 8.940142e-04},{ 4.343379e-02, 8.163350e-04},{ 4.425012e-02, 7.375083e-04},{ 4.498763e-02, 6.576721e-04},
- { 4.564531e-02, 5.769658e-04},{ 4.622227e-02, 4.955299e-04},{ 4.671780e-02, 4.135058e-04},{ 4.713131e-02, 3.310356e-04},
- { 4.746234e-02, 2.482617e-04},{ 4.771060e-02, 1.653266e-04},{ 4.787593e-02, 8.237300e-05},{ 4.795830e-02,-4.570467e-07},
- { 4.795785e-02,-8.302191e-05},{ 4.787482e-02,-1.651808e-04},{ 4.770964e-02,-2.467940e-04},{ 4.746285e-02,-3.277231e-04},
- { 4.713513e-02,-4.078311e-04},{ 4.672730e-02,-4.869830e-04},{ 4.624031e-02,-5.650455e-04},{ 4.567527e-02,-6.418876e-04},
- { 4.503338e-02,-7.173810e-04},{ 4.431600e-02,-7.913997e-04},{ 4.352460e-02,-8.638206e-04},{ 4.266078e-02,-9.345238e-04},
- { 4.172625e-02,-1.003393e-03},{ 4.072286e-02,-1.070314e-03},{ 3.965255e-02,-1.135177e-03},{ 3.851737e-02,-1.197878e-03},
- { 3.731949e-02,-1.258314e-03},{ 3.606118e-02,-1.316387e-03},{ 3.474479e-02,-1.372005e-03},{ 3.337279e-02,-1.425077e-03},
- { 3.194771e-02,-1.475521e-03},{ 3.047219e-02,-1.523256e-03},{ 2.894893e-02,-1.568208e-03},{ 2.738073e-02,-1.610307e-03},
- { 2.577042e-02,-1.649489e-03},{ 2.412093e-02,-1.685693e-03},{ 2.243524e-02,-1.718868e-03},{ 2.071637e-02,-1.748962e-03},
- { 1.896741e-02,-1.775934e-03},{ 1.719147e-02,-1.799746e-03},{ 1.539173e-02,-1.820364e-03},{ 1.357136e-02,-1.837764e-03},
- { 1.173360e-02,-1.851923e-03},{ 9.881676e-03,-1.862826e-03},{ 8.018850e-03,-1.870465e-03},{ 6.148385e-03,-1.874834e-03},
- { 4.273552e-03,-1.875935e-03},{ 2.397616e-03,-1.873777e-03},{ 5.238393e-04,-1.868371e-03},{-1.344532e-03,-1.859737e-03},
- {-3.204269e-03,-1.847898e-03},{-5.052167e-03,-1.832885e-03},{-6.885053e-03,-1.814732e-03},{-8.699784e-03,-1.793479e-03},
- {-1.049326e-02,-1.769173e-03},{-1.226244e-02,-1.741864e-03},{-1.400430e-02,-1.711608e-03},{-1.571591e-02,-1.678466e-03},
- {-1.739437e-02,-1.642503e-03},{-1.903688e-02,-1.603791e-03},{-2.064067e-02,-1.562404e-03},{-2.220307e-02,-1.518422e-03},
- {-2.372149e-02,-1.471929e-03},{-2.519342e-02,-1.423013e-03},{-2.661644e-02,-1.371765e-03},{-2.798820e-02,-1.318282e-03},
- {-2.930648e-02,-1.262664e-03},{-3.056915e-02,-1.205012e-03},{-3.177416e-02,-1.145433e-03},{-3.291959e-02,-1.084037e-03},
- {-3.400363e-02,-1.020936e-03},{-3.502457e-02,-9.562438e-04},{-3.598081e-02,-8.900790e-04},{-3.687089e-02,-8.225608e-04},
- {-3.769345e-02,-7.538109e-04},{-3.844726e-02,-6.839528e-04},{-3.913121e-02,-6.131116e-04},{-3.974432e-02,-5.414139e-04},
- {-4.028574e-02,-4.689874e-04},{-4.075473e-02,-3.959608e-04},{-4.115069e-02,-3.224633e-04},{-4.147315e-02,-2.486250e-04},
- {-4.172178e-02,-1.745760e-04},{-4.189635e-02,-1.004463e-04},{-4.199680e-02,-2.636613e-05},{-4.202316e-02, 4.753510e-05},
- {-4.197563e-02, 1.211284e-04},{-4.185450e-02, 1.942857e-04},{-4.166021e-02, 2.668801e-04},{-4.139333e-02, 3.387859e-04},
- {-4.105455e-02, 4.098789e-04},{-4.064467e-02, 4.800368e-04},{-4.016463e-02, 5.491391e-04},{-3.961549e-02, 6.170675e-04},
- {-3.899843e-02, 6.837061e-04},{-3.831472e-02, 7.489415e-04},{-3.756578e-02, 8.126631e-04},{-3.675312e-02, 8.747631e-04},
- {-3.587835e-02, 9.351371e-04},{-3.494321e-02, 9.936837e-04},{-3.394953e-02, 1.050305e-03},{-3.289923e-02, 1.104907e-03},
- {-3.179432e-02, 1.157400e-03},{-3.063692e-02, 1.207696e-03},{-2.942922e-02, 1.255714e-03},{-2.817351e-02, 1.301374e-03},
- {-2.687214e-02, 1.344605e-03},{-2.552753e-02, 1.385335e-03},{-2.414220e-02, 1.423501e-03},{-2.271869e-02, 1.459042e-03},
- {-2.125965e-02, 1.491903e-03},{-1.976775e-02, 1.522033e-03},{-1.824572e-02, 1.549388e-03},{-1.669633e-02, 1.573925e-03},
- {-1.512240e-02, 1.595611e-03},{-1.352679e-02, 1.614414e-03},{-1.191238e-02, 1.630309e-03},{-1.028207e-02, 1.643277e-03},
- {-8.638793e-03, 1.653302e-03},{-6.985491e-03, 1.660375e-03},{-5.325116e-03, 1.664492e-03},{-3.660624e-03, 1.665654e-03},
- {-1.994970e-03, 1.663866e-03},{-3.311041e-04, 1.659140e-03},{ 1.328036e-03, 1.651493e-03},{ 2.979529e-03, 1.640946e-03},
- { 4.620474e-03, 1.627525e-03},{ 6.247999e-03, 1.611263e-03},{ 7.859262e-03, 1.592196e-03},{ 9.451458e-03, 1.570365e-03},
- { 1.102182e-02, 1.545817e-03},{ 1.256764e-02, 1.518602e-03},{ 1.408624e-02, 1.488777e-03},{ 1.557502e-02, 1.456401e-03},
- { 1.703142e-02, 1.421538e-03},{ 1.845296e-02, 1.384258e-03},{ 1.983722e-02, 1.344632e-03},{ 2.118185e-02, 1.302739e-03},
- { 2.248459e-02, 1.258657e-03},{ 2.374324e-02, 1.212471e-03},{ 2.495571e-02, 1.164269e-03},{ 2.611998e-02, 1.114143e-03},
- { 2.723413e-02, 1.062185e-03},{ 2.829631e-02, 1.008494e-03},{ 2.930481e-02, 9.531697e-04},{ 3.025798e-02, 8.963145e-04},
- { 3.115429e-02, 8.380337e-04},{ 3.199232e-02, 7.784347e-04},{ 3.277076e-02, 7.176271e-04},{ 3.348839e-02, 6.557221e-04},
- { 3.414411e-02, 5.928329e-04},{ 3.473694e-02, 5.290739e-04},{ 3.526601e-02, 4.645609e-04},{ 3.573058e-02, 3.994106e-04},
- { 3.612999e-02, 3.337408e-04},{ 3.646373e-02, 2.676696e-04},{ 3.673140e-02, 2.013158e-04},{ 3.693271e-02, 1.347982e-04},
- { 3.706751e-02, 6.823562e-05},{ 3.713575e-02, 1.746779e-06},{ 3.713749e-02,-6.455013e-05},{ 3.707294e-02,-1.305375e-04},
- { 3.694240e-02,-1.960987e-04},{ 3.674631e-02,-2.611180e-04},{ 3.648519e-02,-3.254811e-04},{ 3.615971e-02,-3.890749e-04},
- { 3.577063e-02,-4.517881e-04},{ 3.531884e-02,-5.135114e-04},{ 3.480533e-02,-5.741373e-04},{ 3.423120e-02,-6.335607e-04},
- { 3.359763e-02,-6.916788e-04},{ 3.290596e-02,-7.483914e-04},{ 3.215756e-02,-8.036012e-04},{ 3.135396e-02,-8.572136e-04},
- { 3.049675e-02,-9.091373e-04},{ 2.958761e-02,-9.592842e-04},{ 2.862833e-02,-1.007569e-03},{ 2.762076e-02,-1.053912e-03},
- { 2.656685e-02,-1.098234e-03},{ 2.546861e-02,-1.140462e-03},{ 2.432815e-02,-1.180526e-03},{ 2.314763e-02,-1.218360e-03},
- { 2.192927e-02,-1.253903e-03},{ 2.067536e-02,-1.287098e-03},{ 1.938826e-02,-1.317891e-03},{ 1.807037e-02,-1.346234e-03},
- { 1.672414e-02,-1.372083e-03},{ 1.535206e-02,-1.395398e-03},{ 1.395666e-02,-1.416145e-03},{ 1.254051e-02,-1.434292e-03},
- { 1.110622e-02,-1.449816e-03},{ 9.656405e-03,-1.462695e-03},{ 8.193710e-03,-1.472913e-03},{ 6.720797e-03,-1.480459e-03},
- { 5.240338e-03,-1.485328e-03},{ 3.755010e-03,-1.487516e-03},{ 2.267494e-03,-1.487029e-03},{ 7.804651e-04,-1.483873e-03},
- {-7.034084e-04,-1.478063e-03},{-2.181471e-03,-1.469615e-03},{-3.651086e-03,-1.458552e-03},{-5.109638e-03,-1.444901e-03},
- {-6.554539e-03,-1.428693e-03},{-7.983232e-03,-1.409964e-03},{-9.393196e-03,-1.388756e-03},{-1.078195e-02,-1.365112e-03},
- {-1.214706e-02,-1.339082e-03},{-1.348615e-02,-1.310719e-03},{-1.479686e-02,-1.280080e-03},{-1.607694e-02,-1.247227e-03},
- {-1.732417e-02,-1.212225e-03},{-1.853640e-02,-1.175142e-03},{-1.971154e-02,-1.136051e-03},{-2.084759e-02,-1.095027e-03},
- {-2.194262e-02,-1.052150e-03},{-2.299477e-02,-1.007502e-03},{-2.400227e-02,-9.611672e-04},{-2.496343e-02,-9.132347e-04},
- {-2.587667e-02,-8.637948e-04},{-2.674046e-02,-8.129404e-04},{-2.755340e-02,-7.607671e-04},{-2.831417e-02,-7.073724e-04},
- {-2.902154e-02,-6.528558e-04},{-2.967440e-02,-5.973186e-04},{-3.027172e-02,-5.408637e-04},{-3.081258e-02,-4.835952e-04},
- {-3.129618e-02,-4.256186e-04},{-3.172180e-02,-3.670404e-04},{-3.208884e-02,-3.079679e-04},{-3.239680e-02,-2.485089e-04},
- {-3.264531e-02,-1.887718e-04},{-3.283409e-02,-1.288651e-04},{-3.296295e-02,-6.889741e-05},{-3.303185e-02,-8.977068e-06},
- {-3.304082e-02, 5.078785e-05},{-3.299004e-02, 1.102899e-04},{-3.287975e-02, 1.694222e-04},{-3.271032e-02, 2.280791e-04},
- {-3.248225e-02, 2.861558e-04},{-3.219609e-02, 3.435491e-04},{-3.185254e-02, 4.001569e-04},{-3.145238e-02, 4.558792e-04},
- {-3.099650e-02, 5.106176e-04},{-3.048589e-02, 5.642758e-04},{-2.992161e-02, 6.167597e-04},{-2.930485e-02, 6.679776e-04},
- {-2.863687e-02, 7.178401e-04},{-2.791903e-02, 7.662609e-04},{-2.715277e-02, 8.131561e-04},{-2.633962e-02, 8.584449e-04},
- {-2.548117e-02, 9.020499e-04},{-2.457912e-02, 9.438965e-04},{-2.363523e-02, 9.839138e-04},{-2.265131e-02, 1.022034e-03},
- {-2.162928e-02, 1.058194e-03},{-2.057108e-02, 1.092332e-03},{-1.947875e-02, 1.124394e-03},{-1.835436e-02, 1.154325e-03},
- {-1.720003e-02, 1.182078e-03},{-1.601795e-02, 1.207608e-03},{-1.481035e-02, 1.230875e-03},{-1.357947e-02, 1.251843e-03},
- {-1.232763e-02, 1.270480e-03},{-1.105715e-02, 1.286758e-03},{-9.770391e-03, 1.300655e-03},{-8.469737e-03, 1.312151e-03},
- {-7.157586e-03, 1.321232e-03},{-5.836354e-03, 1.327888e-03},{-4.508465e-03, 1.332115e-03},{-3.176351e-03, 1.333909e-03},
- {-1.842442e-03, 1.333275e-03},{-5.091663e-04, 1.330221e-03},{ 8.210550e-04, 1.324759e-03},{ 2.145814e-03, 1.316904e-03},
- { 3.462718e-03, 1.306678e-03},{ 4.769396e-03, 1.294106e-03},{ 6.063502e-03, 1.279216e-03},{ 7.342718e-03, 1.262043e-03},
- { 8.604762e-03, 1.242623e-03},{ 9.847385e-03, 1.220998e-03},{ 1.106838e-02, 1.197214e-03},{ 1.226560e-02, 1.171318e-03},
- { 1.343691e-02, 1.143364e-03},{ 1.458028e-02, 1.113409e-03},{ 1.569369e-02, 1.081512e-03},{ 1.677520e-02, 1.047737e-03},
- { 1.782294e-02, 1.012149e-03},{ 1.883509e-02, 9.748197e-04},{ 1.980991e-02, 9.358204e-04},{ 2.074573e-02, 8.952270e-04},
- { 2.164095e-02, 8.531177e-04},{ 2.249407e-02, 8.095732e-04},{ 2.330364e-02, 7.646768e-04},{ 2.406832e-02, 7.185139e-04},
- { 2.478684e-02, 6.711719e-04},{ 2.545801e-02, 6.227404e-04},{ 2.608075e-02, 5.733105e-04},{ 2.665406e-02, 5.229750e-04},
- { 2.717703e-02, 4.718281e-04},{ 2.764886e-02, 4.199653e-04},{ 2.806883e-02, 3.674831e-04},{ 2.843631e-02, 3.144788e-04},
- { 2.875079e-02, 2.610505e-04},{ 2.901184e-02, 2.072969e-04},{ 2.921914e-02, 1.533169e-04},{ 2.937245e-02, 9.920960e-05},
- { 2.947166e-02, 4.507410e-05},{ 2.951674e-02,-8.990709e-06},{ 2.950775e-02,-6.288632e-05},{ 2.944486e-02,-1.165148e-04},
- { 2.932834e-02,-1.697789e-04},{ 2.915857e-02,-2.225823e-04},{ 2.893598e-02,-2.748299e-04},{ 2.866115e-02,-3.264277e-04},
- { 2.833473e-02,-3.772831e-04},{ 2.795744e-02,-4.273053e-04},{ 2.753014e-02,-4.764050e-04},{ 2.705373e-02,-5.244951e-04},
- { 2.652924e-02,-5.714902e-04},{ 2.595775e-02,-6.173075e-04},{ 2.534044e-02,-6.618663e-04},{ 2.467857e-02,-7.050885e-04},
- { 2.397348e-02,-7.468987e-04},{ 2.322659e-02,-7.872242e-04},{ 2.243936e-02,-8.259952e-04},{ 2.161337e-02,-8.631449e-04},
- { 2.075022e-02,-8.986098e-04},{ 1.985161e-02,-9.323295e-04},{ 1.891928e-02,-9.642469e-04},{ 1.795504e-02,-9.943085e-04},
- { 1.696073e-02,-1.022464e-03},{ 1.593826e-02,-1.048668e-03},{ 1.488960e-02,-1.072876e-03},{ 1.381672e-02,-1.095050e-03},
- { 1.272167e-02,-1.115156e-03},{ 1.160651e-02,-1.133160e-03},{ 1.047335e-02,-1.149037e-03},{ 9.324316e-03,-1.162763e-03},
- { 8.161553e-03,-1.174319e-03},{ 6.987234e-03,-1.183688e-03},{ 5.803545e-03,-1.190861e-03},{ 4.612685e-03,-1.195829e-03},
- { 3.416855e-03,-1.198590e-03},{ 2.218266e-03,-1.199144e-03},{ 1.019122e-03,-1.197496e-03},{-1.783748e-04,-1.193656e-03},
- {-1.372031e-03,-1.187636e-03},{-2.559667e-03,-1.179453e-03},{-3.739119e-03,-1.169128e-03},{-4.908247e-03,-1.156686e-03},
- {-6.064933e-03,-1.142154e-03},{-7.207087e-03,-1.125567e-03},{-8.332654e-03,-1.106959e-03},{-9.439613e-03,-1.086370e-03},
- {-1.052598e-02,-1.063844e-03},{-1.158983e-02,-1.039426e-03},{-1.262925e-02,-1.013167e-03},{-1.364242e-02,-9.851206e-04},
- {-1.462754e-02,-9.553424e-04},{-1.558288e-02,-9.238919e-04},{-1.650677e-02,-8.908316e-04},{-1.739761e-02,-8.562266e-04},
- {-1.825383e-02,-8.201445e-04},{-1.907398e-02,-7.826558e-04},{-1.985663e-02,-7.438331e-04},{-2.060047e-02,-7.037515e-04},
- {-2.130422e-02,-6.624880e-04},{-2.196671e-02,-6.201218e-04},{-2.258683e-02,-5.767338e-04},{-2.316356e-02,-5.324065e-04},
- {-2.369597e-02,-4.872240e-04},{-2.418319e-02,-4.412719e-04},{-2.462446e-02,-3.946367e-04},{-2.501910e-02,-3.474061e-04},
- {-2.536651e-02,-2.996688e-04},{-2.566618e-02,-2.515139e-04},{-2.591769e-02,-2.030312e-04},{-2.612072e-02,-1.543110e-04},
- {-2.627503e-02,-1.054436e-04},{-2.638048e-02,-5.651936e-05},{-2.643699e-02,-7.628626e-06},{-2.644462e-02, 4.113862e-05},
- {-2.640348e-02, 8.969287e-05},{-2.631379e-02, 1.379452e-04},{-2.617585e-02, 1.858075e-04},{-2.599004e-02, 2.331926e-04},
- {-2.575685e-02, 2.800145e-04},{-2.547683e-02, 3.261883e-04},{-2.515064e-02, 3.716306e-04},{-2.477901e-02, 4.162597e-04},
- {-2.436275e-02, 4.599953e-04},{-2.390276e-02, 5.027593e-04},{-2.340000e-02, 5.444754e-04},{-2.285552e-02, 5.850695e-04},
- {-2.227045e-02, 6.244696e-04},{-2.164598e-02, 6.626064e-04},{-2.098338e-02, 6.994128e-04},{-2.028396e-02, 7.348245e-04},
- {-1.954914e-02, 7.687799e-04},{-1.878036e-02, 8.012203e-04},{-1.797914e-02, 8.320898e-04},{-1.714705e-02, 8.613357e-04},
- {-1.628571e-02, 8.889084e-04},{-1.539681e-02, 9.147615e-04},{-1.448204e-02, 9.388519e-04},{-1.354319e-02, 9.611398e-04},
- {-1.258205e-02, 9.815890e-04},{-1.160046e-02, 1.000167e-03},{-1.060030e-02, 1.016843e-03},{-9.583454e-03, 1.031594e-03},
- {-8.551860e-03, 1.044396e-03},{-7.507465e-03, 1.055230e-03},{-6.452234e-03, 1.064084e-03},{-5.388151e-03, 1.070944e-03},
- {-4.317206e-03, 1.075805e-03},{-3.241401e-03, 1.078662e-03},{-2.162739e-03, 1.079516e-03},{-1.083223e-03, 1.078370e-03},
- {-4.852918e-06, 1.075233e-03},{ 1.070380e-03, 1.070114e-03},{ 2.140494e-03, 1.063030e-03},{ 3.203525e-03, 1.053999e-03},
- { 4.257523e-03, 1.043041e-03},{ 5.300565e-03, 1.030184e-03},{ 6.330749e-03, 1.015456e-03},{ 7.346205e-03, 9.988896e-04},
- { 8.345095e-03, 9.805199e-04},{ 9.325615e-03, 9.603861e-04},{ 1.028600e-02, 9.385303e-04},{ 1.122453e-02, 9.149977e-04},
- { 1.213953e-02, 8.898364e-04},{ 1.302937e-02, 8.630974e-04},{ 1.389246e-02, 8.348346e-04},{ 1.472730e-02, 8.051044e-04},
- { 1.553240e-02, 7.739660e-04},{ 1.630637e-02, 7.414809e-04},{ 1.704785e-02, 7.077130e-04},{ 1.775556e-02, 6.727283e-04},
- { 1.842829e-02, 6.365950e-04},{ 1.906488e-02, 5.993832e-04},{ 1.966427e-02, 5.611649e-04},{ 2.022543e-02, 5.220137e-04},
- { 2.074745e-02, 4.820046e-04},{ 2.122945e-02, 4.412144e-04},{ 2.167067e-02, 3.997206e-04},{ 2.207039e-02, 3.576024e-04},
- { 2.242799e-02, 3.149394e-04},{ 2.274293e-02, 2.718123e-04},{ 2.301474e-02, 2.283025e-04},{ 2.324304e-02, 1.844917e-04},
- { 2.342753e-02, 1.404620e-04},{ 2.356800e-02, 9.629587e-05},{ 2.366429e-02, 5.207557e-05},{ 2.371637e-02, 7.883362e-06},
- { 2.372425e-02,-3.619876e-05},{ 2.368805e-02,-8.008924e-05},{ 2.360796e-02,-1.237071e-04},{ 2.348426e-02,-1.669720e-04},
- { 2.331728e-02,-2.098047e-04},{ 2.310748e-02,-2.521266e-04},{ 2.285535e-02,-2.938606e-04},{ 2.256149e-02,-3.349307e-04},
- { 2.222656e-02,-3.752625e-04},{ 2.185130e-02,-4.147829e-04},{ 2.143652e-02,-4.534207e-04},{ 2.098310e-02,-4.911066e-04},
- { 2.049199e-02,-5.277730e-04},{ 1.996422e-02,-5.633547e-04},{ 1.940086e-02,-5.977883e-04},{ 1.880307e-02,-6.310130e-04},
- { 1.817206e-02,-6.629703e-04},{ 1.750909e-02,-6.936043e-04},{ 1.681549e-02,-7.228616e-04},{ 1.609262e-02,-7.506915e-04},
- { 1.534193e-02,-7.770461e-04},{ 1.456489e-02,-8.018805e-04},{ 1.376301e-02,-8.251526e-04},{ 1.293785e-02,-8.468234e-04},
- { 1.209103e-02,-8.668569e-04},{ 1.122417e-02,-8.852204e-04},{ 1.033895e-02,-9.018841e-04},{ 9.437068e-03,-9.168218e-04},
- { 8.520246e-03,-9.300104e-04},{ 7.590236e-03,-9.414301e-04},{ 6.648806e-03,-9.510644e-04},{ 5.697741e-03,-9.589004e-04},
- { 4.738841e-03,-9.649284e-04},{ 3.773912e-03,-9.691421e-04},{ 2.804770e-03,-9.715387e-04},{ 1.833232e-03,-9.721186e-04},
- { 8.611131e-04,-9.708857e-04},{-1.097726e-04,-9.678474e-04},{-1.077620e-03,-9.630143e-04},{-2.040634e-03,-9.564003e-04},
- {-2.997035e-03,-9.480226e-04},{-3.945057e-03,-9.379016e-04},{-4.882959e-03,-9.260611e-04},{-5.809020e-03,-9.125278e-04},
- {-6.721548e-03,-8.973317e-04},{-7.618879e-03,-8.805056e-04},{-8.499385e-03,-8.620853e-04},{-9.361470e-03,-8.421097e-04},
- {-1.020358e-02,-8.206203e-04},{-1.102420e-02,-7.976613e-04},{-1.182186e-02,-7.732796e-04},{-1.259514e-02,-7.475246e-04},
- {-1.334267e-02,-7.204481e-04},{-1.406311e-02,-6.921044e-04},{-1.475522e-02,-6.625497e-04},{-1.541777e-02,-6.318426e-04},
- {-1.604961e-02,-6.000436e-04},{-1.664965e-02,-5.672151e-04},{-1.721687e-02,-5.334211e-04},{-1.775029e-02,-4.987274e-04},
- {-1.824902e-02,-4.632013e-04},{-1.871222e-02,-4.269115e-04},{-1.913913e-02,-3.899277e-04},{-1.952906e-02,-3.523211e-04},
- {-1.988138e-02,-3.141635e-04},{-2.019554e-02,-2.755277e-04},{-2.047107e-02,-2.364873e-04},{-2.070756e-02,-1.971163e-04},
- {-2.090467e-02,-1.574891e-04},{-2.106216e-02,-1.176806e-04},{-2.117984e-02,-7.776567e-05},{-2.125761e-02,-3.781911e-05},
- {-2.129543e-02, 2.084269e-06},{-2.129334e-02, 4.187001e-05},{-2.125147e-02, 8.146407e-05},{-2.117001e-02, 1.207929e-04},
- {-2.104922e-02, 1.597838e-04},{-2.088943e-02, 1.983648e-04},{-2.069107e-02, 2.364648e-04},{-2.045460e-02, 2.740139e-04},
- {-2.018059e-02, 3.109434e-04},{-1.986965e-02, 3.471859e-04},{-1.952246e-02, 3.826757e-04},{-1.913979e-02, 4.173483e-04},
- {-1.872244e-02, 4.511411e-04},{-1.827130e-02, 4.839935e-04},{-1.778730e-02, 5.158464e-04},{-1.727146e-02, 5.466431e-04},
- {-1.672481e-02, 5.763289e-04},{-1.614848e-02, 6.048512e-04},{-1.554363e-02, 6.321600e-04},{-1.491147e-02, 6.582075e-04},
- {-1.425327e-02, 6.829484e-04},{-1.357032e-02, 7.063401e-04},{-1.286398e-02, 7.283424e-04},{-1.213563e-02, 7.489181e-04},
- {-1.138672e-02, 7.680326e-04},{-1.061868e-02, 7.856541e-04},{-9.833029e-03, 8.017539e-04},{-9.031276e-03, 8.163059e-04},
- {-8.214970e-03, 8.292873e-04},{-7.385682e-03, 8.406781e-04},{-6.545004e-03, 8.504614e-04},{-5.694543e-03, 8.586233e-04},
- {-4.835920e-03, 8.651531e-04},{-3.970766e-03, 8.700431e-04},{-3.100723e-03, 8.732886e-04},{-2.227435e-03, 8.748883e-04},
- {-1.352546e-03, 8.748437e-04},{-4.777028e-04, 8.731595e-04},{ 3.954567e-04, 8.698433e-04},{ 1.265300e-03, 8.649061e-04},
- { 2.130206e-03, 8.583616e-04},{ 2.988568e-03, 8.502265e-04},{ 3.838794e-03, 8.405206e-04},{ 4.679315e-03, 8.292664e-04},
- { 5.508581e-03, 8.164895e-04},{ 6.325071e-03, 8.022179e-04},{ 7.127289e-03, 7.864828e-04},{ 7.913771e-03, 7.693177e-04},
- { 8.683089e-03, 7.507588e-04},{ 9.433848e-03, 7.308449e-04},{ 1.016469e-02, 7.096171e-04},{ 1.087431e-02, 6.871190e-04},
- { 1.156143e-02, 6.633963e-04},{ 1.222483e-02, 6.384971e-04},{ 1.286332e-02, 6.124713e-04},{ 1.347579e-02, 5.853709e-04},
- { 1.406116e-02, 5.572500e-04},{ 1.461841e-02, 5.281640e-04},{ 1.514658e-02, 4.981705e-04},{ 1.564475e-02, 4.673282e-04},
- { 1.611208e-02, 4.356975e-04},{ 1.654777e-02, 4.033399e-04},{ 1.695111e-02, 3.703184e-04},{ 1.732143e-02, 3.366968e-04},
- { 1.765813e-02, 3.025399e-04},{ 1.796067e-02, 2.679135e-04},{ 1.822858e-02, 2.328838e-04},{ 1.846147e-02, 1.975180e-04},
- { 1.865899e-02, 1.618834e-04},{ 1.882087e-02, 1.260476e-04},{ 1.894692e-02, 9.007872e-05},{ 1.903699e-02, 5.404464e-05},
- { 1.909104e-02, 1.801328e-05},{ 1.910905e-02,-1.794761e-05},{ 1.909111e-02,-5.377063e-05},{ 1.903733e-02,-8.938882e-05},
- { 1.894795e-02,-1.247358e-04},{ 1.882321e-02,-1.597458e-04},{ 1.866346e-02,-1.943540e-04},{ 1.846911e-02,-2.284965e-04},
- { 1.824061e-02,-2.621103e-04},{ 1.797850e-02,-2.951337e-04},{ 1.768337e-02,-3.275062e-04},{ 1.735586e-02,-3.591689e-04},
- { 1.699669e-02,-3.900641e-04},{ 1.660663e-02,-4.201358e-04},{ 1.618649e-02,-4.493299e-04},{ 1.573716e-02,-4.775939e-04},
- { 1.525957e-02,-5.048772e-04},{ 1.475469e-02,-5.311312e-04},{ 1.422356e-02,-5.563095e-04},{ 1.366725e-02,-5.803678e-04},
- { 1.308689e-02,-6.032638e-04},{ 1.248362e-02,-6.249579e-04},{ 1.185866e-02,-6.454125e-04},{ 1.121325e-02,-6.645928e-04},
- { 1.054866e-02,-6.824661e-04},{ 9.866192e-03,-6.990026e-04},{ 9.167189e-03,-7.141749e-04},{ 8.453014e-03,-7.279583e-04},
- { 7.725056e-03,-7.403309e-04},{ 6.984725e-03,-7.512733e-04},{ 6.233452e-03,-7.607689e-04},{ 5.472683e-03,-7.688041e-04},
- { 4.703879e-03,-7.753678e-04},{ 3.928511e-03,-7.804519e-04},{ 3.148059e-03,-7.840510e-04},{ 2.364008e-03,-7.861626e-04},
- { 1.577846e-03,-7.867869e-04},{ 7.910587e-04,-7.859270e-04},{ 5.131754e-06,-7.835887e-04},{-7.784570e-04,-7.797808e-04},
- {-1.558238e-03,-7.745145e-04},{-2.332752e-03,-7.678040e-04},{-3.100556e-03,-7.596660e-04},{-3.860222e-03,-7.501201e-04},
- {-4.610342e-03,-7.391881e-04},{-5.349530e-03,-7.268947e-04},{-6.076425e-03,-7.132670e-04},{-6.789692e-03,-6.983344e-04},
- {-7.488027e-03,-6.821290e-04},{-8.170156e-03,-6.646849e-04},{-8.834840e-03,-6.460386e-04},{-9.480879e-03,-6.262286e-04},
- {-1.010711e-02,-6.052958e-04},{-1.071240e-02,-5.832828e-04},{-1.129569e-02,-5.602343e-04},{-1.185592e-02,-5.361967e-04},
- {-1.239212e-02,-5.112182e-04},{-1.290334e-02,-4.853488e-04},{-1.338868e-02,-4.586397e-04},{-1.384732e-02,-4.311438e-04},
- {-1.427847e-02,-4.029153e-04},{-1.468138e-02,-3.740095e-04},{-1.505539e-02,-3.444830e-04},{-1.539988e-02,-3.143934e-04},
- {-1.571427e-02,-2.837990e-04},{-1.599807e-02,-2.527591e-04},{-1.625083e-02,-2.213335e-04},{-1.647216e-02,-1.895829e-04},
- {-1.666174e-02,-1.575679e-04},{-1.681931e-02,-1.253500e-04},{-1.694466e-02,-9.299045e-05},{-1.703765e-02,-6.055088e-05},
- {-1.709820e-02,-2.809278e-05},{-1.712630e-02, 4.322468e-06},{-1.712197e-02, 3.663375e-05},{-1.708534e-02, 6.878031e-05},
- {-1.701656e-02, 1.007019e-04},{-1.691586e-02, 1.323388e-04},{-1.678352e-02, 1.636321e-04},{-1.661989e-02, 1.945236e-04},
- {-1.642536e-02, 2.249561e-04},{-1.620041e-02, 2.548734e-04},{-1.594553e-02, 2.842205e-04},{-1.566131e-02, 3.129434e-04},
- {-1.534837e-02, 3.409898e-04},{-1.500738e-02, 3.683086e-04},{-1.463907e-02, 3.948502e-04},{-1.424422e-02, 4.205667e-04},
- {-1.382365e-02, 4.454118e-04},{-1.337824e-02, 4.693411e-04},{-1.290890e-02, 4.923121e-04},{-1.241659e-02, 5.142840e-04},
- {-1.190230e-02, 5.352182e-04},{-1.136709e-02, 5.550781e-04},{-1.081201e-02, 5.738292e-04},{-1.023818e-02, 5.914394e-04},
- {-9.646740e-03, 6.078787e-04},{-9.038861e-03, 6.231193e-04},{-8.415742e-03, 6.371358e-04},{-7.778606e-03, 6.499055e-04},
- {-7.128701e-03, 6.614076e-04},{-6.467293e-03, 6.716242e-04},{-5.795669e-03, 6.805397e-04},{-5.115129e-03, 6.881410e-04},
- {-4.426988e-03, 6.944175e-04},{-3.732571e-03, 6.993613e-04},{-3.033210e-03, 7.029668e-04},{-2.330243e-03, 7.052312e-04},
- {-1.625011e-03, 7.061542e-04},{-9.188573e-04, 7.057378e-04},{-2.131196e-04, 7.039868e-04},{ 4.908672e-04, 7.009085e-04},
- { 1.191776e-03, 6.965125e-04},{ 1.888288e-03, 6.908111e-04},{ 2.579099e-03, 6.838188e-04},{ 3.262918e-03, 6.755528e-04},
- { 3.938471e-03, 6.660323e-04},{ 4.604503e-03, 6.552793e-04},{ 5.259782e-03, 6.433175e-04},{ 5.903100e-03, 6.301733e-04},
- { 6.533273e-03, 6.158750e-04},{ 7.149148e-03, 6.004531e-04},{ 7.749601e-03, 5.839402e-04},{ 8.333541e-03, 5.663707e-04},
- { 8.899912e-03, 5.477811e-04},{ 9.447693e-03, 5.282097e-04},{ 9.975903e-03, 5.076963e-04},{ 1.048360e-02, 4.862827e-04},
- { 1.096988e-02, 4.640121e-04},{ 1.143389e-02, 4.409293e-04},{ 1.187482e-02, 4.170804e-04},{ 1.229190e-02, 3.925129e-04},
- { 1.268442e-02, 3.672755e-04},{ 1.305169e-02, 3.414181e-04},{ 1.339311e-02, 3.149916e-04},{ 1.370810e-02, 2.880476e-04},
- { 1.399615e-02, 2.606389e-04},{ 1.425679e-02, 2.328189e-04},{ 1.448961e-02, 2.046414e-04},{ 1.469425e-02, 1.761611e-04},
- { 1.487041e-02, 1.474328e-04},{ 1.501784e-02, 1.185118e-04},{ 1.513635e-02, 8.945353e-05},{ 1.522581e-02, 6.031354e-05},
- { 1.528612e-02, 3.114735e-05},{ 1.531727e-02, 2.010396e-06},{ 1.531928e-02,-2.704212e-05},{ 1.529224e-02,-5.595532e-05},
- { 1.523628e-02,-8.467473e-05},{ 1.515161e-02,-1.131464e-04},{ 1.503846e-02,-1.413171e-04},{ 1.489714e-02,-1.691342e-04},
- { 1.472801e-02,-1.965459e-04},{ 1.453146e-02,-2.235014e-04},{ 1.430796e-02,-2.499509e-04},{ 1.405801e-02,-2.758457e-04},
- { 1.378217e-02,-3.011382e-04},{ 1.348103e-02,-3.257823e-04},{ 1.315524e-02,-3.497331e-04},{ 1.280551e-02,-3.729471e-04},
- { 1.243256e-02,-3.953826e-04},{ 1.203718e-02,-4.169990e-04},{ 1.162018e-02,-4.377580e-04},{ 1.118243e-02,-4.576226e-04},
- { 1.072480e-02,-4.765577e-04},{ 1.024824e-02,-4.945302e-04},{ 9.753715e-03,-5.115088e-04},{ 9.242206e-03,-5.274642e-04},
- { 8.714741e-03,-5.423692e-04},{ 8.172372e-03,-5.561986e-04},{ 7.616174e-03,-5.689294e-04},{ 7.047244e-03,-5.805405e-04},
- { 6.466704e-03,-5.910135e-04},{ 5.875690e-03,-6.003317e-04},{ 5.275359e-03,-6.084809e-04},{ 4.666878e-03,-6.154492e-04},
- { 4.051429e-03,-6.212268e-04},{ 3.430202e-03,-6.258064e-04},{ 2.804395e-03,-6.291828e-04},{ 2.175213e-03,-6.313533e-04},
- { 1.543859e-03,-6.323173e-04},{ 9.115420e-04,-6.320767e-04},{ 2.794653e-04,-6.306356e-04},{-3.511703e-04,-6.280003e-04},
- {-9.791705e-04,-6.241794e-04},{-1.603350e-03,-6.191838e-04},{-2.222534e-03,-6.130266e-04},{-2.835560e-03,-6.057228e-04},
- {-3.441283e-03,-5.972901e-04},{-4.038573e-03,-5.877476e-04},{-4.626321e-03,-5.771171e-04},{-5.203438e-03,-5.654220e-04},
- {-5.768860e-03,-5.526877e-04},{-6.321548e-03,-5.389417e-04},{-6.860489e-03,-5.242132e-04},{-7.384702e-03,-5.085331e-04},
- {-7.893236e-03,-4.919343e-04},{-8.385170e-03,-4.744510e-04},{-8.859621e-03,-4.561193e-04},{-9.315740e-03,-4.369766e-04},
- {-9.752717e-03,-4.170618e-04},{-1.016978e-02,-3.964151e-04},{-1.056619e-02,-3.750782e-04},{-1.094127e-02,-3.530937e-04},
- {-1.129437e-02,-3.305054e-04},{-1.162487e-02,-3.073582e-04},{-1.193223e-02,-2.836979e-04},{-1.221593e-02,-2.595711e-04},
- {-1.247550e-02,-2.350251e-04},{-1.271052e-02,-2.101079e-04},{-1.292063e-02,-1.848682e-04},{-1.310550e-02,-1.593550e-04},
- {-1.326485e-02,-1.336178e-04},{-1.339847e-02,-1.077062e-04},{-1.350618e-02,-8.167008e-05},{-1.358785e-02,-5.555950e-05},
- {-1.364341e-02,-2.942440e-05},{-1.367283e-02,-3.314627e-06},{-1.367615e-02, 2.272013e-05},{-1.365343e-02, 4.863051e-05},
- {-1.360480e-02, 7.436752e-05},{-1.353043e-02, 9.988265e-05},{-1.343055e-02, 1.251280e-04},{-1.330542e-02, 1.500562e-04},
- {-1.315536e-02, 1.746207e-04},{-1.298074e-02, 1.987760e-04},{-1.278197e-02, 2.224771e-04},{-1.255949e-02, 2.456803e-04},
- {-1.231381e-02, 2.683429e-04},{-1.204547e-02, 2.904234e-04},{-1.175504e-02, 3.118814e-04},{-1.144316e-02, 3.326780e-04},
- {-1.111048e-02, 3.527756e-04},{-1.075771e-02, 3.721380e-04},{-1.038557e-02, 3.907305e-04},{-9.994838e-03, 4.085200e-04},
- {-9.586318e-03, 4.254752e-04},{-9.160843e-03, 4.415662e-04},{-8.719277e-03, 4.567651e-04},{-8.262512e-03, 4.710456e-04},
- {-7.791466e-03, 4.843833e-04},{-7.307083e-03, 4.967557e-04},{-6.810327e-03, 5.081422e-04},{-6.302185e-03, 5.185240e-04},
- {-5.783661e-03, 5.278846e-04},{-5.255776e-03, 5.362092e-04},{-4.719567e-03, 5.434852e-04},{-4.176082e-03, 5.497019e-04},
- {-3.626380e-03, 5.548507e-04},{-3.071529e-03, 5.589251e-04},{-2.512604e-03, 5.619208e-04},{-1.950683e-03, 5.638353e-04},
- {-1.386848e-03, 5.646683e-04},{-8.221797e-04, 5.644217e-04},{-2.577580e-04, 5.630992e-04},{ 3.053412e-04, 5.607067e-04},
- { 8.660478e-04, 5.572521e-04},{ 1.423300e-03, 5.527454e-04},{ 1.976045e-03, 5.471983e-04},{ 2.523244e-03, 5.406248e-04},
- { 3.063868e-03, 5.330406e-04},{ 3.596909e-03, 5.244634e-04},{ 4.121372e-03, 5.149125e-04},{ 4.636285e-03, 5.044094e-04},
- { 5.140694e-03, 4.929769e-04},{ 5.633671e-03, 4.806400e-04},{ 6.114311e-03, 4.674249e-04},{ 6.581736e-03, 4.533596e-04},
- { 7.035096e-03, 4.384737e-04},{ 7.473569e-03, 4.227982e-04},{ 7.896368e-03, 4.063655e-04},{ 8.302733e-03, 3.892093e-04},
- { 8.691942e-03, 3.713648e-04},{ 9.063307e-03, 3.528681e-04},{ 9.416175e-03, 3.337567e-04},{ 9.749932e-03, 3.140689e-04},
- { 1.006400e-02, 2.938443e-04},{ 1.035785e-02, 2.731231e-04},{ 1.063097e-02, 2.519466e-04},{ 1.088291e-02, 2.303566e-04},
- { 1.111327e-02, 2.083956e-04},{ 1.132167e-02, 1.861069e-04},{ 1.150777e-02, 1.635341e-04},{ 1.167131e-02, 1.407211e-04},
- { 1.181203e-02, 1.177124e-04},{ 1.192974e-02, 9.455257e-05},{ 1.202429e-02, 7.128636e-05},{ 1.209558e-02, 4.795857e-05},
- { 1.214354e-02, 2.461400e-05},{ 1.216815e-02, 1.297348e-06},{ 1.216945e-02,-2.194690e-05},{ 1.214750e-02,-4.507453e-05},
- { 1.210243e-02,-6.804168e-05},{ 1.203439e-02,-9.080495e-05},{ 1.194358e-02,-1.133214e-04},{ 1.183026e-02,-1.355489e-04},
- { 1.169471e-02,-1.574457e-04},{ 1.153727e-02,-1.789710e-04},{ 1.135830e-02,-2.000848e-04},{ 1.115821e-02,-2.207481e-04},
- { 1.093746e-02,-2.409227e-04},{ 1.069654e-02,-2.605717e-04},{ 1.043597e-02,-2.796590e-04},{ 1.015631e-02,-2.981500e-04},
- { 9.858159e-03,-3.160112e-04},{ 9.542148e-03,-3.332104e-04},{ 9.208937e-03,-3.497168e-04},{ 8.859221e-03,-3.655011e-04},
- { 8.493719e-03,-3.805353e-04},{ 8.113184e-03,-3.947931e-04},{ 7.718391e-03,-4.082496e-04},{ 7.310142e-03,-4.208817e-04},
- { 6.889260e-03,-4.326678e-04},{ 6.456592e-03,-4.435880e-04},{ 6.013004e-03,-4.536243e-04},{ 5.559380e-03,-4.627603e-04},
- { 5.096619e-03,-4.709812e-04},{ 4.625638e-03,-4.782745e-04},{ 4.147364e-03,-4.846289e-04},{ 3.662735e-03,-4.900355e-04},
- { 3.172699e-03,-4.944868e-04},{ 2.678213e-03,-4.979775e-04},{ 2.180235e-03,-5.005039e-04},{ 1.679731e-03,-5.020643e-04},
- { 1.177667e-03,-5.026588e-04},{ 6.750079e-04,-5.022894e-04},{ 1.727185e-04,-5.009599e-04},{-3.282413e-04,-4.986758e-04},
- {-8.269172e-04,-4.954448e-04},{-1.322362e-03,-4.912760e-04},{-1.813638e-03,-4.861804e-04},{-2.299818e-03,-4.801707e-04},
- {-2.779989e-03,-4.732616e-04},{-3.253251e-03,-4.654689e-04},{-3.718720e-03,-4.568107e-04},{-4.175530e-03,-4.473062e-04},
- {-4.622836e-03,-4.369764e-04},{-5.059813e-03,-4.258438e-04},{-5.485657e-03,-4.139322e-04},{-5.899589e-03,-4.012672e-04},
- {-6.300856e-03,-3.878752e-04},{-6.688731e-03,-3.737845e-04},{-7.062516e-03,-3.590242e-04},{-7.421540e-03,-3.436248e-04},
- {-7.765165e-03,-3.276179e-04},{-8.092783e-03,-3.110362e-04},{-8.403819e-03,-2.939134e-04},{-8.697732e-03,-2.762839e-04},
- {-8.974016e-03,-2.581832e-04},{-9.232199e-03,-2.396477e-04},{-9.471847e-03,-2.207142e-04},{-9.692561e-03,-2.014203e-04},
- {-9.893982e-03,-1.818043e-04},{-1.007579e-02,-1.619047e-04},{-1.023769e-02,-1.417607e-04},{-1.037945e-02,-1.214117e-04},
- {-1.050086e-02,-1.008973e-04},{-1.060176e-02,-8.025755e-05},{-1.068202e-02,-5.953234e-05},{-1.074155e-02,-3.876172e-05},
- {-1.078031e-02,-1.798569e-05},{-1.079830e-02, 2.755890e-06},{-1.079554e-02, 2.342334e-05},{-1.077212e-02, 4.397724e-05},
- {-1.072814e-02, 6.437855e-05},{-1.066376e-02, 8.458862e-05},{-1.057917e-02, 1.045693e-04},{-1.047460e-02, 1.242830e-04},
- {-1.035032e-02, 1.436928e-04},{-1.020663e-02, 1.627624e-04},{-1.004387e-02, 1.814564e-04},{-9.862410e-03, 1.997401e-04},
- {-9.662670e-03, 2.175798e-04},{-9.445090e-03, 2.349427e-04},{-9.210147e-03, 2.517970e-04},{-8.958350e-03, 2.681121e-04},
- {-8.690238e-03, 2.838585e-04},{-8.406380e-03, 2.990077e-04},{-8.107372e-03, 3.135327e-04},{-7.793839e-03, 3.274077e-04},
- {-7.466432e-03, 3.406081e-04},{-7.125823e-03, 3.531109e-04},{-6.772713e-03, 3.648943e-04},{-6.407818e-03, 3.759382e-04},
- {-6.031880e-03, 3.862237e-04},{-5.645656e-03, 3.957336e-04},{-5.249923e-03, 4.044522e-04},{-4.845471e-03, 4.123655e-04},
- {-4.433105e-03, 4.194608e-04},{-4.013644e-03, 4.257273e-04},{-3.587917e-03, 4.311557e-04},{-3.156761e-03, 4.357383e-04},
- {-2.721023e-03, 4.394692e-04},{-2.281554e-03, 4.423440e-04},{-1.839210e-03, 4.443600e-04},{-1.394850e-03, 4.455163e-04},
- {-9.493336e-04, 4.458134e-04},{-5.035201e-04, 4.452537e-04},{-5.826644e-05, 4.438411e-04},{ 3.855747e-04, 4.415812e-04},
- { 8.271558e-04, 4.384811e-04},{ 1.265637e-03, 4.345495e-04},{ 1.700186e-03, 4.297969e-04},{ 2.129983e-03, 4.242351e-04},
- { 2.554218e-03, 4.178775e-04},{ 2.972096e-03, 4.107390e-04},{ 3.382835e-03, 4.028359e-04},{ 3.785671e-03, 3.941859e-04},
- { 4.179857e-03, 3.848082e-04},{ 4.564665e-03, 3.747233e-04},{ 4.939388e-03, 3.639529e-04},{ 5.303341e-03, 3.525200e-04},
- { 5.655861e-03, 3.404489e-04},{ 5.996310e-03, 3.277648e-04},{ 6.324075e-03, 3.144942e-04},{ 6.638569e-03, 3.006647e-04},
- { 6.939234e-03, 2.863046e-04},{ 7.225538e-03, 2.714434e-04},{ 7.496982e-03, 2.561113e-04},{ 7.753093e-03, 2.403394e-04},
- { 7.993433e-03, 2.241596e-04},{ 8.217592e-03, 2.076043e-04},{ 8.425196e-03, 1.907066e-04},{ 8.615903e-03, 1.735001e-04},
- { 8.789403e-03, 1.560191e-04},{ 8.945422e-03, 1.382981e-04},{ 9.083720e-03, 1.203719e-04},{ 9.204092e-03, 1.022758e-04},
- { 9.306368e-03, 8.404505e-05},{ 9.390413e-03, 6.571529e-05},{ 9.456128e-03, 4.732209e-05},{ 9.503450e-03, 2.890105e-05},
- { 9.532351e-03, 1.048771e-05},{ 9.542839e-03,-7.882545e-06},{ 9.534957e-03,-2.617450e-05},{ 9.508782e-03,-4.435322e-05},
- { 9.464429e-03,-6.238411e-05},{ 9.402045e-03,-8.023298e-05},{ 9.321812e-03,-9.786610e-05},{ 9.223946e-03,-1.152503e-04},
- { 9.108695e-03,-1.323529e-04},{ 8.976343e-03,-1.491419e-04},{ 8.827201e-03,-1.655862e-04},{ 8.661614e-03,-1.816553e-04},
- { 8.479959e-03,-1.973194e-04},{ 8.282640e-03,-2.125499e-04},{ 8.070090e-03,-2.273189e-04},{ 7.842771e-03,-2.415995e-04},
- { 7.601171e-03,-2.553660e-04},{ 7.345805e-03,-2.685934e-04},{ 7.077212e-03,-2.812584e-04},{ 6.795954e-03,-2.933383e-04},
- { 6.502615e-03,-3.048120e-04},{ 6.197803e-03,-3.156593e-04},{ 5.882144e-03,-3.258617e-04},{ 5.556282e-03,-3.354015e-04},
- { 5.220881e-03,-3.442628e-04},{ 4.876618e-03,-3.524309e-04},{ 4.524187e-03,-3.598922e-04},{ 4.164295e-03,-3.666350e-04},
- { 3.797660e-03,-3.726487e-04},{ 3.425011e-03,-3.779243e-04},{ 3.047087e-03,-3.824540e-04},{ 2.664633e-03,-3.862318e-04},
- { 2.278401e-03,-3.892529e-04},{ 1.889148e-03,-3.915142e-04},{ 1.497634e-03,-3.930140e-04},{ 1.104620e-03,-3.937519e-04},
- { 7.108681e-04,-3.937291e-04},{ 3.171389e-04,-3.929485e-04},{-7.580956e-05,-3.914140e-04},{-4.672235e-04,-3.891312e-04},
- {-8.563547e-04,-3.861072e-04},{-1.242462e-03,-3.823503e-04},{-1.624812e-03,-3.778703e-04},{-2.002682e-03,-3.726784e-04},
- {-2.375361e-03,-3.667869e-04},{-2.742148e-03,-3.602098e-04},{-3.102358e-03,-3.529621e-04},{-3.455320e-03,-3.450601e-04},
- {-3.800380e-03,-3.365212e-04},{-4.136901e-03,-3.273642e-04},{-4.464265e-03,-3.176089e-04},{-4.781874e-03,-3.072761e-04},
- {-5.089150e-03,-2.963878e-04},{-5.385538e-03,-2.849669e-04},{-5.670505e-03,-2.730373e-04},{-5.943542e-03,-2.606238e-04},
- {-6.204166e-03,-2.477521e-04},{-6.451918e-03,-2.344484e-04},{-6.686367e-03,-2.207400e-04},{-6.907107e-03,-2.066548e-04},
- {-7.113761e-03,-1.922213e-04},{-7.305983e-03,-1.774684e-04},{-7.483451e-03,-1.624257e-04},{-7.645877e-03,-1.471234e-04},
- {-7.793000e-03,-1.315918e-04},{-7.924592e-03,-1.158617e-04},{-8.040454e-03,-9.996410e-05},{-8.140418e-03,-8.393030e-05},
- {-8.224348e-03,-6.779170e-05},{-8.292140e-03,-5.157980e-05},{-8.343720e-03,-3.532614e-05},{-8.379046e-03,-1.906223e-05},
- {-8.398108e-03,-2.819486e-06},{-8.400928e-03, 1.337082e-05},{-8.387557e-03, 2.947764e-05},{-8.358079e-03, 4.547018e-05},
- {-8.312609e-03, 6.131797e-05},{-8.251291e-03, 7.699096e-05},{-8.174300e-03, 9.245950e-05},{-8.081840e-03, 1.076945e-04},
- {-7.974146e-03, 1.226673e-04},{-7.851479e-03, 1.373499e-04},{-7.714129e-03, 1.517152e-04},{-7.562414e-03, 1.657363e-04},
- {-7.396677e-03, 1.793876e-04},{-7.217290e-03, 1.926439e-04},{-7.024646e-03, 2.054811e-04},{-6.819165e-03, 2.178759e-04},
- {-6.601289e-03, 2.298059e-04},{-6.371483e-03, 2.412497e-04},{-6.130233e-03, 2.521870e-04},{-5.878046e-03, 2.625984e-04},
- {-5.615448e-03, 2.724657e-04},{-5.342982e-03, 2.817718e-04},{-5.061210e-03, 2.905007e-04},{-4.770710e-03, 2.986376e-04},
- {-4.472072e-03, 3.061690e-04},{-4.165903e-03, 3.130823e-04},{-3.852821e-03, 3.193666e-04},{-3.533454e-03, 3.250118e-04},
- {-3.208442e-03, 3.300094e-04},{-2.878433e-03, 3.343521e-04},{-2.544081e-03, 3.380337e-04},{-2.206047e-03, 3.410496e-04},
- {-1.864998e-03, 3.433962e-04},{-1.521601e-03, 3.450715e-04},{-1.176530e-03, 3.460747e-04},{-8.304551e-04, 3.464061e-04},
- {-4.840490e-04, 3.460677e-04},{-1.379813e-04, 3.450623e-04},{ 2.070810e-04, 3.433945e-04},{ 5.504755e-04, 3.410697e-04},
- { 8.915451e-04, 3.380948e-04},{ 1.229640e-03, 3.344780e-04},{ 1.564118e-03, 3.302284e-04},{ 1.894346e-03, 3.253567e-04},
- { 2.219703e-03, 3.198745e-04},{ 2.539578e-03, 3.137945e-04},{ 2.853372e-03, 3.071308e-04},{ 3.160503e-03, 2.998982e-04},
- { 3.460401e-03, 2.921128e-04},{ 3.752514e-03, 2.837916e-04},{ 4.036305e-03, 2.749527e-04},{ 4.311258e-03, 2.656151e-04},
- { 4.576873e-03, 2.557986e-04},{ 4.832672e-03, 2.455238e-04},{ 5.078196e-03, 2.348125e-04},{ 5.313008e-03, 2.236867e-04},
- { 5.536695e-03, 2.121696e-04},{ 5.748864e-03, 2.002849e-04},{ 5.949149e-03, 1.880568e-04},{ 6.137206e-03, 1.755102e-04},
- { 6.312716e-03, 1.626707e-04},{ 6.475387e-03, 1.495640e-04},{ 6.624951e-03, 1.362165e-04},{ 6.761168e-03, 1.226549e-04},
- { 6.883823e-03, 1.089063e-04},{ 6.992729e-03, 9.499776e-05},{ 7.087727e-03, 8.095693e-05},{ 7.168684e-03, 6.681141e-05},
- { 7.235495e-03, 5.258895e-05},{ 7.288084e-03, 3.831735e-05},{ 7.326401e-03, 2.402439e-05},{ 7.350426e-03, 9.737819e-06},
- { 7.360163e-03,-4.514759e-06},{ 7.355649e-03,-1.870588e-05},{ 7.336943e-03,-3.280832e-05},{ 7.304134e-03,-4.679511e-05},
- { 7.257339e-03,-6.063961e-05},{ 7.196700e-03,-7.431555e-05},{ 7.122384e-03,-8.779707e-05},{ 7.034587e-03,-1.010588e-04},
- { 6.933528e-03,-1.140759e-04},{ 6.819452e-03,-1.268240e-04},{ 6.692628e-03,-1.392796e-04},{ 6.553349e-03,-1.514194e-04},
- { 6.401929e-03,-1.632213e-04},{ 6.238708e-03,-1.746636e-04},{ 6.064045e-03,-1.857254e-04},{ 5.878319e-03,-1.963868e-04},
- { 5.681932e-03,-2.066286e-04},{ 5.475304e-03,-2.164326e-04},{ 5.258871e-03,-2.257813e-04},{ 5.033090e-03,-2.346583e-04},
- { 4.798431e-03,-2.430483e-04},{ 4.555383e-03,-2.509367e-04},{ 4.304447e-03,-2.583101e-04},{ 4.046136e-03,-2.651562e-04},
- { 3.780980e-03,-2.714637e-04},{ 3.509517e-03,-2.772223e-04},{ 3.232294e-03,-2.824229e-04},{ 2.949871e-03,-2.870576e-04},
- { 2.662814e-03,-2.911194e-04},{ 2.371694e-03,-2.946026e-04},{ 2.077092e-03,-2.975027e-04},{ 1.779589e-03,-2.998161e-04},
- { 1.479773e-03,-3.015406e-04},{ 1.178232e-03,-3.026751e-04},{ 8.755573e-04,-3.032194e-04},{ 5.723378e-04,-3.031749e-04},
- { 2.691630e-04,-3.025436e-04},{-3.338066e-05,-3.013292e-04},{-3.347099e-04,-2.995361e-04},{-6.342460e-04,-2.971699e-04},
- {-9.314158e-04,-2.942374e-04},{-1.225653e-03,-2.907463e-04},{-1.516400e-03,-2.867056e-04},{-1.803105e-03,-2.821251e-04},
- {-2.085230e-03,-2.770157e-04},{-2.362246e-03,-2.713893e-04},{-2.633635e-03,-2.652587e-04},{-2.898894e-03,-2.586378e-04},
- {-3.157532e-03,-2.515411e-04},{-3.409073e-03,-2.439843e-04},{-3.653057e-03,-2.359837e-04},{-3.889041e-03,-2.275565e-04},
- {-4.116597e-03,-2.187206e-04},{-4.335318e-03,-2.094948e-04},{-4.544813e-03,-1.998983e-04},{-4.744711e-03,-1.899511e-04},
- {-4.934662e-03,-1.796739e-04},{-5.114336e-03,-1.690879e-04},{-5.283424e-03,-1.582147e-04},{-5.441639e-03,-1.470765e-04},
- {-5.588715e-03,-1.356959e-04},{-5.724411e-03,-1.240959e-04},{-5.848507e-03,-1.122998e-04},{-5.960807e-03,-1.003313e-04},
- {-6.061138e-03,-8.821415e-05},{-6.149352e-03,-7.597246e-05},{-6.225325e-03,-6.363046e-05},{-6.288955e-03,-5.121246e-05},
- {-6.340168e-03,-3.874283e-05},{-6.378910e-03,-2.624596e-05},{-6.405156e-03,-1.374620e-05},{-6.418903e-03,-1.267801e-06},
- {-6.420170e-03, 1.116510e-05},{-6.409005e-03, 2.352857e-05},{-6.385477e-03, 3.579888e-05},{-6.349678e-03, 4.795257e-05},
- {-6.301725e-03, 5.996652e-05},{-6.241759e-03, 7.181793e-05},{-6.169941e-03, 8.348445e-05},{-6.086456e-03, 9.494413e-05},
- {-5.991512e-03, 1.061755e-04},{-5.885337e-03, 1.171577e-04},{-5.768179e-03, 1.278703e-04},{-5.640309e-03, 1.382936e-04},
- {-5.502015e-03, 1.484085e-04},{-5.353606e-03, 1.581965e-04},{-5.195410e-03, 1.676398e-04},{-5.027770e-03, 1.767214e-04},
- {-4.851049e-03, 1.854252e-04},{-4.665624e-03, 1.937357e-04},{-4.471888e-03, 2.016382e-04},{-4.270250e-03, 2.091190e-04},
- {-4.061131e-03, 2.161651e-04},{-3.844966e-03, 2.227646e-04},{-3.622201e-03, 2.289064e-04},{-3.393295e-03, 2.345803e-04},
- {-3.158714e-03, 2.397771e-04},{-2.918937e-03, 2.444885e-04},{-2.674449e-03, 2.487074e-04},{-2.425741e-03, 2.524273e-04},
- {-2.173314e-03, 2.556430e-04},{-1.917671e-03, 2.583501e-04},{-1.659321e-03, 2.605455e-04},{-1.398775e-03, 2.622268e-04},
- {-1.136549e-03, 2.633928e-04},{-8.731558e-04, 2.640431e-04},{-6.091126e-04, 2.641786e-04},{-3.449341e-04, 2.638008e-04},
- {-8.113323e-05, 2.629127e-04},{ 1.817795e-04, 2.615178e-04},{ 4.432973e-04, 2.596209e-04},{ 7.029182e-04, 2.572276e-04},
- { 9.601459e-04, 2.543445e-04},{ 1.214490e-03, 2.509790e-04},{ 1.465469e-03, 2.471397e-04},{ 1.712609e-03, 2.428357e-04},
- { 1.955445e-03, 2.380774e-04},{ 2.193522e-03, 2.328756e-04},{ 2.426398e-03, 2.272423e-04},{ 2.653640e-03, 2.211900e-04},
- { 2.874830e-03, 2.147323e-04},{ 3.089562e-03, 2.078831e-04},{ 3.297446e-03, 2.006573e-04},{ 3.498103e-03, 1.930706e-04},
- { 3.691173e-03, 1.851389e-04},{ 3.876312e-03, 1.768792e-04},{ 4.053191e-03, 1.683086e-04},{ 4.221500e-03, 1.594452e-04},
- { 4.380945e-03, 1.503073e-04},{ 4.531253e-03, 1.409137e-04},{ 4.672166e-03, 1.312837e-04},{ 4.803450e-03, 1.214370e-04},
- { 4.924887e-03, 1.113935e-04},{ 5.036281e-03, 1.011735e-04},{ 5.137454e-03, 9.079769e-05},{ 5.228252e-03, 8.028675e-05},
- { 5.308538e-03, 6.966168e-05},{ 5.378200e-03, 5.894360e-05},{ 5.437144e-03, 4.815371e-05},{ 5.485297e-03, 3.731328e-05},
- { 5.522611e-03, 2.644360e-05},{ 5.549054e-03, 1.556590e-05},{ 5.564620e-03, 4.701394e-06},{ 5.569322e-03,-6.128853e-06},
- { 5.563193e-03,-1.690391e-05},{ 5.546289e-03,-2.760303e-05},{ 5.518686e-03,-3.820572e-05},{ 5.480480e-03,-4.869171e-05},
- { 5.431788e-03,-5.904109e-05},{ 5.372747e-03,-6.923426e-05},{ 5.303513e-03,-7.925201e-05},{ 5.224261e-03,-8.907554e-05},
- { 5.135186e-03,-9.868652e-05},{ 5.036499e-03,-1.080671e-04},{ 4.928432e-03,-1.171999e-04},{ 4.811232e-03,-1.260682e-04},
- { 4.685164e-03,-1.346558e-04},{ 4.550508e-03,-1.429471e-04},{ 4.407561e-03,-1.509271e-04},{ 4.256634e-03,-1.585815e-04},
- { 4.098052e-03,-1.658968e-04},{ 3.932155e-03,-1.728601e-04},{ 3.759295e-03,-1.794591e-04},{ 3.579836e-03,-1.856826e-04},
- { 3.394154e-03,-1.915200e-04},{ 3.202634e-03,-1.969613e-04},{ 3.005672e-03,-2.019976e-04},{ 2.803675e-03,-2.066208e-04},
- { 2.597054e-03,-2.108235e-04},{ 2.386230e-03,-2.145991e-04},{ 2.171631e-03,-2.179421e-04},{ 1.953689e-03,-2.208477e-04},
- { 1.732841e-03,-2.233119e-04},{ 1.509530e-03,-2.253319e-04},{ 1.284198e-03,-2.269053e-04},{ 1.057292e-03,-2.280310e-04},
- { 8.292613e-04,-2.287086e-04},{ 6.005527e-04,-2.289386e-04},{ 3.716141e-04,-2.287222e-04},{ 1.428919e-04,-2.280618e-04},
- {-8.516987e-05,-2.269604e-04},{-3.121303e-04,-2.254219e-04},{-5.375522e-04,-2.234512e-04},{-7.610034e-04,-2.210538e-04},
- {-9.820572e-04,-2.182360e-04},{-1.200293e-03,-2.150052e-04},{-1.415298e-03,-2.113691e-04},{-1.626667e-03,-2.073367e-04},
- {-1.834004e-03,-2.029173e-04},{-2.036922e-03,-1.981212e-04},{-2.235043e-03,-1.929591e-04},{-2.428002e-03,-1.874427e-04},
- {-2.615445e-03,-1.815841e-04},{-2.797029e-03,-1.753962e-04},{-2.972425e-03,-1.688923e-04},{-3.141317e-03,-1.620864e-04},
- {-3.303404e-03,-1.549930e-04},{-3.458397e-03,-1.476271e-04},{-3.606024e-03,-1.400041e-04},{-3.746028e-03,-1.321400e-04},
- {-3.878168e-03,-1.240511e-04},{-4.002219e-03,-1.157540e-04},{-4.117973e-03,-1.072659e-04},{-4.225239e-03,-9.860387e-05},
- {-4.323843e-03,-8.978569e-05},{-4.413629e-03,-8.082914e-05},{-4.494458e-03,-7.175225e-05},{-4.566210e-03,-6.257320e-05},
- {-4.628783e-03,-5.331031e-05},{-4.682093e-03,-4.398198e-05},{-4.726075e-03,-3.460667e-05},{-4.760682e-03,-2.520285e-05},
- {-4.785885e-03,-1.578898e-05},{-4.801674e-03,-6.383435e-06},{-4.808057e-03, 2.995461e-06},{-4.805062e-03, 1.232953e-05},
- {-4.792732e-03, 2.160077e-05},{-4.771132e-03, 3.079134e-05},{-4.740340e-03, 3.988366e-05},{-4.700457e-03, 4.886041e-05},
- {-4.651596e-03, 5.770454e-05},{-4.593892e-03, 6.639937e-05},{-4.527492e-03, 7.492855e-05},{-4.452564e-03, 8.327612e-05},
- {-4.369288e-03, 9.142657e-05},{-4.277861e-03, 9.936480e-05},{-4.178496e-03, 1.070762e-04},{-4.071420e-03, 1.145467e-04},
- {-3.956873e-03, 1.217627e-04},{-3.835111e-03, 1.287112e-04},{-3.706399e-03, 1.353797e-04},{-3.571020e-03, 1.417564e-04},
- {-3.429263e-03, 1.478301e-04},{-3.281433e-03, 1.535901e-04},{-3.127843e-03, 1.590266e-04},{-2.968817e-03, 1.641302e-04},
- {-2.804686e-03, 1.688925e-04},{-2.635794e-03, 1.733055e-04},{-2.462488e-03, 1.773621e-04},{-2.285126e-03, 1.810558e-04},
- {-2.104070e-03, 1.843810e-04},{-1.919689e-03, 1.873327e-04},{-1.732357e-03, 1.899068e-04},{-1.542450e-03, 1.920997e-04},
- {-1.350350e-03, 1.939087e-04},{-1.156442e-03, 1.953321e-04},{-9.611094e-04, 1.963685e-04},{-7.647409e-04, 1.970177e-04},
- {-5.677233e-04, 1.972799e-04},{-3.704434e-04, 1.971562e-04},{-1.732872e-04, 1.966486e-04},{ 2.336147e-05, 1.957597e-04},
- { 2.191212e-04, 1.944927e-04},{ 4.136139e-04, 1.928518e-04},{ 6.064656e-04, 1.908417e-04},{ 7.973073e-04, 1.884679e-04},
- { 9.857752e-04, 1.857365e-04},{ 1.171512e-03, 1.826545e-04},{ 1.354166e-03, 1.792293e-04},{ 1.533396e-03, 1.754691e-04},
- { 1.708865e-03, 1.713826e-04},{ 1.880247e-03, 1.669791e-04},{ 2.047226e-03, 1.622687e-04},{ 2.209495e-03, 1.572617e-04},
- { 2.366757e-03, 1.519694e-04},{ 2.518726e-03, 1.464031e-04},{ 2.665129e-03, 1.405750e-04},{ 2.805704e-03, 1.344975e-04},
- { 2.940202e-03, 1.281836e-04},{ 3.068385e-03, 1.216466e-04},{ 3.190032e-03, 1.149002e-04},{ 3.304932e-03, 1.079585e-04},
- { 3.412891e-03, 1.008359e-04},{ 3.513726e-03, 9.354709e-05},{ 3.607274e-03, 8.610701e-05},{ 3.693381e-03, 7.853085e-05},
- { 3.771911e-03, 7.083398e-05},{ 3.842745e-03, 6.303198e-05},{ 3.905777e-03, 5.514053e-05},{ 3.960918e-03, 4.717545e-05},
- { 4.008093e-03, 3.915261e-05},{ 4.047246e-03, 3.108794e-05},{ 4.078334e-03, 2.299738e-05},{ 4.101331e-03, 1.489687e-05},
- { 4.116228e-03, 6.802277e-06},{ 4.123030e-03,-1.270599e-06},{ 4.121760e-03,-9.306070e-06},{ 4.112454e-03,-1.728859e-05},
- { 4.095165e-03,-2.520277e-05},{ 4.069962e-03,-3.303344e-05},{ 4.036929e-03,-4.076564e-05},{ 3.996163e-03,-4.838468e-05},
- { 3.947779e-03,-5.587615e-05},{ 3.891903e-03,-6.322595e-05},{ 3.828677e-03,-7.042031e-05},{ 3.758256e-03,-7.744584e-05},
- { 3.680810e-03,-8.428953e-05},{ 3.596521e-03,-9.093877e-05},{ 3.505582e-03,-9.738140e-05},{ 3.408201e-03,-1.036057e-04},
- { 3.304595e-03,-1.096005e-04},{ 3.194995e-03,-1.153550e-04},{ 3.079640e-03,-1.208590e-04},{ 2.958781e-03,-1.261028e-04},
- { 2.832678e-03,-1.310773e-04},{ 2.701601e-03,-1.357739e-04},{ 2.565827e-03,-1.401847e-04},{ 2.425642e-03,-1.443022e-04},
- { 2.281340e-03,-1.481197e-04},{ 2.133220e-03,-1.516310e-04},{ 1.981589e-03,-1.548306e-04},{ 1.826759e-03,-1.577135e-04},
- { 1.669045e-03,-1.602755e-04},{ 1.508770e-03,-1.625130e-04},{ 1.346257e-03,-1.644231e-04},{ 1.181833e-03,-1.660033e-04},
- { 1.015830e-03,-1.672521e-04},{ 8.485780e-04,-1.681685e-04},{ 6.804095e-04,-1.687520e-04},{ 5.116575e-04,-1.690031e-04},
- { 3.426543e-04,-1.689227e-04},{ 1.737316e-04,-1.685124e-04},{ 5.219164e-06,-1.677745e-04},{-1.625553e-04,-1.667117e-04},
- {-3.292670e-04,-1.653277e-04},{-4.945947e-04,-1.636265e-04},{-6.582212e-04,-1.616129e-04},{-8.198341e-04,-1.592922e-04},
- {-9.791264e-04,-1.566703e-04},{-1.135797e-03,-1.537536e-04},{-1.289550e-03,-1.505491e-04},{-1.440099e-03,-1.470644e-04},
- {-1.587164e-03,-1.433076e-04},{-1.730471e-03,-1.392871e-04},{-1.869758e-03,-1.350121e-04},{-2.004770e-03,-1.304920e-04},
- {-2.135262e-03,-1.257367e-04},{-2.260999e-03,-1.207567e-04},{-2.381756e-03,-1.155626e-04},{-2.497318e-03,-1.101656e-04},
- {-2.607484e-03,-1.045772e-04},{-2.712061e-03,-9.880908e-05},{-2.810870e-03,-9.287341e-05},{-2.903744e-03,-8.678254e-05},
- {-2.990526e-03,-8.054910e-05},{-3.071075e-03,-7.418593e-05},{-3.145261e-03,-6.770608e-05},{-3.212967e-03,-6.112275e-05},
- {-3.274090e-03,-5.444931e-05},{-3.328539e-03,-4.769923e-05},{-3.376239e-03,-4.088608e-05},{-3.417125e-03,-3.402350e-05},
- {-3.451148e-03,-2.712514e-05},{-3.478273e-03,-2.020470e-05},{-3.498478e-03,-1.327582e-05},{-3.511754e-03,-6.352139e-06},
- {-3.518106e-03, 5.528118e-07},{-3.517553e-03, 7.425577e-06},{-3.510128e-03, 1.425283e-05},{-3.495875e-03, 2.102139e-05},
- {-3.474853e-03, 2.771826e-05},{-3.447135e-03, 3.433062e-05},{-3.412805e-03, 4.084589e-05},{-3.371959e-03, 4.725173e-05},
- {-3.324707e-03, 5.353609e-05},{-3.271171e-03, 5.968717e-05},{-3.211484e-03, 6.569351e-05},{-3.145790e-03, 7.154400e-05},
- {-3.074246e-03, 7.722786e-05},{-2.997018e-03, 8.273469e-05},{-2.914284e-03, 8.805449e-05},{-2.826229e-03, 9.317767e-05},
- {-2.733052e-03, 9.809508e-05},{-2.634956e-03, 1.027980e-04},{-2.532158e-03, 1.072781e-04},{-2.424880e-03, 1.115277e-04},
- {-2.313353e-03, 1.155395e-04},{-2.197813e-03, 1.193067e-04},{-2.078506e-03, 1.228229e-04},{-1.955683e-03, 1.260825e-04},
- {-1.829601e-03, 1.290802e-04},{-1.700521e-03, 1.318113e-04},{-1.568709e-03, 1.342716e-04},{-1.434438e-03, 1.364576e-04},
- {-1.297980e-03, 1.383661e-04},{-1.159614e-03, 1.399948e-04},{-1.019619e-03, 1.413417e-04},{-8.782776e-04, 1.424055e-04},
- {-7.358722e-04, 1.431852e-04},{-5.926869e-04, 1.436808e-04},{-4.490062e-04, 1.438925e-04},{-3.051137e-04, 1.438211e-04},
- {-1.612926e-04, 1.434682e-04},{-1.782438e-05, 1.428357e-04},{ 1.250113e-04, 1.419261e-04},{ 2.669374e-04, 1.407425e-04},
- { 4.076799e-04, 1.392884e-04},{ 5.469682e-04, 1.375679e-04},{ 6.845361e-04, 1.355857e-04},{ 8.201218e-04, 1.333467e-04},
- { 9.534685e-04, 1.308567e-04},{ 1.084325e-03, 1.281216e-04},{ 1.212447e-03, 1.251479e-04},{ 1.337595e-03, 1.219425e-04},
- { 1.459537e-03, 1.185129e-04},{ 1.578050e-03, 1.148667e-04},{ 1.692917e-03, 1.110122e-04},{ 1.803929e-03, 1.069578e-04},
- { 1.910887e-03, 1.027124e-04},{ 2.013599e-03, 9.828528e-05},{ 2.111884e-03, 9.368593e-05},{ 2.205570e-03, 8.892420e-05},
- { 2.294495e-03, 8.401017e-05},{ 2.378505e-03, 7.895420e-05},{ 2.457459e-03, 7.376688e-05},{ 2.531226e-03, 6.845900e-05},
- { 2.599685e-03, 6.304154e-05},{ 2.662726e-03, 5.752566e-05},{ 2.720252e-03, 5.192265e-05},{ 2.772175e-03, 4.624391e-05},
- { 2.818419e-03, 4.050096e-05},{ 2.858920e-03, 3.470538e-05},{ 2.893625e-03, 2.886879e-05},{ 2.922494e-03, 2.300285e-05},
- { 2.945497e-03, 1.711924e-05},{ 2.962616e-03, 1.122958e-05},{ 2.973845e-03, 5.345492e-06},{ 2.979191e-03,-5.214977e-07},
- { 2.978669e-03,-6.359936e-06},{ 2.972309e-03,-1.215848e-05},{ 2.960151e-03,-1.790592e-05},{ 2.942245e-03,-2.359120e-05},
- { 2.918654e-03,-2.920343e-05},{ 2.889450e-03,-3.473192e-05},{ 2.854718e-03,-4.016620e-05},{ 2.814552e-03,-4.549602e-05},
- { 2.769056e-03,-5.071139e-05},{ 2.718345e-03,-5.580260e-05},{ 2.662542e-03,-6.076021e-05},{ 2.601782e-03,-6.557511e-05},
- { 2.536207e-03,-7.023850e-05},{ 2.465968e-03,-7.474191e-05},{ 2.391227e-03,-7.907724e-05},{ 2.312149e-03,-8.323676e-05},
- { 2.228913e-03,-8.721311e-05},{ 2.141699e-03,-9.099934e-05},{ 2.050700e-03,-9.458888e-05},{ 1.956111e-03,-9.797561e-05},
- { 1.858136e-03,-1.011538e-04},{ 1.756982e-03,-1.041182e-04},{ 1.652864e-03,-1.068640e-04},{ 1.545999e-03,-1.093869e-04},
- { 1.436613e-03,-1.116828e-04},{ 1.324930e-03,-1.137484e-04},{ 1.211181e-03,-1.155807e-04},{ 1.095601e-03,-1.171771e-04},
- { 9.784237e-04,-1.185357e-04},{ 8.598880e-04,-1.196549e-04},{ 7.402330e-04,-1.205337e-04},{ 6.196993e-04,-1.211714e-04},
- { 4.985279e-04,-1.215679e-04},{ 3.769600e-04,-1.217237e-04},{ 2.552363e-04,-1.216395e-04},{ 1.335968e-04,-1.213166e-04},
- { 1.228022e-05,-1.207568e-04},{-1.084766e-04,-1.199624e-04},{-2.284390e-04,-1.189360e-04},{-3.473750e-04,-1.176807e-04},
- {-4.650558e-04,-1.162002e-04},{-5.812560e-04,-1.144983e-04},{-6.957543e-04,-1.125795e-04},{-8.083338e-04,-1.104487e-04},
- {-9.187825e-04,-1.081109e-04},{-1.026893e-03,-1.055719e-04},{-1.132465e-03,-1.028375e-04},{-1.235303e-03,-9.991409e-05},
- {-1.335217e-03,-9.680834e-05},{-1.432025e-03,-9.352722e-05},{-1.525552e-03,-9.007803e-05},{-1.615630e-03,-8.646837e-05},
- {-1.702099e-03,-8.270612e-05},{-1.784805e-03,-7.879943e-05},{-1.863604e-03,-7.475666e-05},{-1.938361e-03,-7.058646e-05},
- {-2.008947e-03,-6.629763e-05},{-2.075245e-03,-6.189919e-05},{-2.137144e-03,-5.740035e-05},{-2.194545e-03,-5.281044e-05},
- {-2.247355e-03,-4.813894e-05},{-2.295494e-03,-4.339546e-05},{-2.338889e-03,-3.858967e-05},{-2.377479e-03,-3.373136e-05},
- {-2.411210e-03,-2.883034e-05},{-2.440041e-03,-2.389648e-05},{-2.463937e-03,-1.893966e-05},{-2.482877e-03,-1.396976e-05},
- {-2.496847e-03,-8.996632e-06},{-2.505843e-03,-4.030093e-06},{-2.509873e-03, 9.200998e-07},{-2.508953e-03, 5.844272e-06},
- {-2.503109e-03, 1.073284e-05},{-2.492376e-03, 1.557635e-05},{-2.476800e-03, 2.036548e-05},{-2.456434e-03, 2.509103e-05},
- {-2.431343e-03, 2.974402e-05},{-2.401599e-03, 3.431562e-05},{-2.367284e-03, 3.879721e-05},{-2.328487e-03, 4.318040e-05},
- {-2.285306e-03, 4.745703e-05},{-2.237849e-03, 5.161918e-05},{-2.186230e-03, 5.565922e-05},{-2.130571e-03, 5.956976e-05},
- {-2.071001e-03, 6.334374e-05},{-2.007657e-03, 6.697437e-05},{-1.940683e-03, 7.045520e-05},{-1.870228e-03, 7.378011e-05},
- {-1.796448e-03, 7.694329e-05},{-1.719504e-03, 7.993930e-05},{-1.639565e-03, 8.276305e-05},{-1.556802e-03, 8.540982e-05},
- {-1.471392e-03, 8.787525e-05},{-1.383517e-03, 9.015539e-05},{-1.293361e-03, 9.224663e-05},{-1.201115e-03, 9.414578e-05},
- {-1.106969e-03, 9.585005e-05},{-1.011119e-03, 9.735703e-05},{-9.137619e-04, 9.866471e-05},{-8.150972e-04, 9.977151e-05},
- {-7.153257e-04, 1.006762e-04},{-6.146495e-04, 1.013781e-04},{-5.132714e-04, 1.018767e-04},{-4.113947e-04, 1.021721e-04},
- {-3.092226e-04, 1.022647e-04},{-2.069580e-04, 1.021552e-04},{-1.048027e-04, 1.018451e-04},{-2.957636e-06, 1.013357e-04},
- { 9.837811e-05, 1.006293e-04},{ 1.990074e-04, 9.972797e-05},{ 2.987353e-04, 9.863464e-05},{ 3.973700e-04, 9.735238e-05},
- { 4.947223e-04, 9.588466e-05},{ 5.906070e-04, 9.423530e-05},{ 6.848423e-04, 9.240846e-05},{ 7.772508e-04, 9.040863e-05},
- { 8.676594e-04, 8.824063e-05},{ 9.559000e-04, 8.590957e-05},{ 1.041810e-03, 8.342087e-05},{ 1.125230e-03, 8.078024e-05},
- { 1.206011e-03, 7.799365e-05},{ 1.284004e-03, 7.506733e-05},{ 1.359072e-03, 7.200776e-05},{ 1.431079e-03, 6.882165e-05},
- { 1.499901e-03, 6.551593e-05},{ 1.565417e-03, 6.209773e-05},{ 1.627515e-03, 5.857437e-05},{ 1.686089e-03, 5.495333e-05},
- { 1.741042e-03, 5.124226e-05},{ 1.792285e-03, 4.744895e-05},{ 1.839734e-03, 4.358130e-05},{ 1.883315e-03, 3.964733e-05},
- { 1.922962e-03, 3.565515e-05},{ 1.958617e-03, 3.161294e-05},{ 1.990230e-03, 2.752894e-05},{ 2.017759e-03, 2.341143e-05},
- { 2.041171e-03, 1.926872e-05},{ 2.060439e-03, 1.510913e-05},{ 2.075549e-03, 1.094097e-05},{ 2.086490e-03, 6.772510e-06},
- { 2.093262e-03, 2.612001e-06},{ 2.095874e-03,-1.532374e-06},{ 2.094342e-03,-5.652503e-06},{ 2.088689e-03,-9.740363e-06},
- { 2.078949e-03,-1.378803e-05},{ 2.065161e-03,-1.778772e-05},{ 2.047373e-03,-2.173175e-05},{ 2.025641e-03,-2.561260e-05},
- { 2.000029e-03,-2.942294e-05},{ 1.970606e-03,-3.315557e-05},{ 1.937450e-03,-3.680351e-05},{ 1.900647e-03,-4.035997e-05},
- { 1.860287e-03,-4.381840e-05},{ 1.816468e-03,-4.717244e-05},{ 1.769296e-03,-5.041599e-05},{ 1.718880e-03,-5.354321e-05},
- { 1.665337e-03,-5.654849e-05},{ 1.608788e-03,-5.942651e-05},{ 1.549362e-03,-6.217224e-05},{ 1.487190e-03,-6.478090e-05},
- { 1.422409e-03,-6.724806e-05},{ 1.355161e-03,-6.956953e-05},{ 1.285591e-03,-7.174149e-05},{ 1.213850e-03,-7.376039e-05},
- { 1.140089e-03,-7.562303e-05},{ 1.064466e-03,-7.732651e-05},{ 9.871396e-04,-7.886830e-05},{ 9.082713e-04,-8.024615e-05},
- { 8.280252e-04,-8.145820e-05},{ 7.465669e-04,-8.250290e-05},{ 6.640641e-04,-8.337903e-05},{ 5.806850e-04,-8.408573e-05},
- { 4.965993e-04,-8.462248e-05},{ 4.119768e-04,-8.498908e-05},{ 3.269877e-04,-8.518570e-05},{ 2.418020e-04,-8.521282e-05},
- { 1.565892e-04,-8.507126e-05},{ 7.151794e-05,-8.476218e-05},{-1.324424e-05,-8.428705e-05},{-9.753128e-05,-8.364767e-05},
- {-1.811790e-04,-8.284617e-05},{-2.640251e-04,-8.188496e-05},{-3.459101e-04,-8.076679e-05},{-4.266769e-04,-7.949467e-05},
- {-5.061715e-04,-7.807194e-05},{-5.842435e-04,-7.650219e-05},{-6.607457e-04,-7.478930e-05},{-7.355350e-04,-7.293741e-05},
- {-8.084724e-04,-7.095090e-05},{-8.794233e-04,-6.883443e-05},{-9.482577e-04,-6.659285e-05},{-1.014851e-03,-6.423127e-05},
- {-1.079082e-03,-6.175499e-05},{-1.140837e-03,-5.916952e-05},{-1.200006e-03,-5.648056e-05},{-1.256487e-03,-5.369397e-05},
- {-1.310181e-03,-5.081579e-05},{-1.360997e-03,-4.785222e-05},{-1.408849e-03,-4.480956e-05},{-1.453658e-03,-4.169427e-05},
- {-1.495353e-03,-3.851292e-05},{-1.533866e-03,-3.527214e-05},{-1.569138e-03,-3.197869e-05},{-1.601116e-03,-2.863937e-05},
- {-1.629756e-03,-2.526105e-05},{-1.655017e-03,-2.185063e-05},{-1.676868e-03,-1.841505e-05},{-1.695283e-03,-1.496125e-05},
- {-1.710244e-03,-1.149619e-05},{-1.721740e-03,-8.026801e-06},{-1.729767e-03,-4.559986e-06},{-1.734327e-03,-1.102613e-06},
- {-1.735429e-03, 2.338506e-06},{-1.733091e-03, 5.756628e-06},{-1.727334e-03, 9.145090e-06},{-1.718189e-03, 1.249732e-05},
- {-1.705692e-03, 1.580686e-05},{-1.689885e-03, 1.906737e-05},{-1.670818e-03, 2.227263e-05},{-1.648545e-03, 2.541656e-05},
- {-1.623128e-03, 2.849326e-05},{-1.594635e-03, 3.149697e-05},{-1.563138e-03, 3.442211e-05},{-1.528716e-03, 3.726329e-05},
- {-1.491453e-03, 4.001531e-05},{-1.451438e-03, 4.267319e-05},{-1.408764e-03, 4.523213e-05},{-1.363532e-03, 4.768760e-05},
- {-1.315845e-03, 5.003525e-05},{-1.265809e-03, 5.227100e-05},{-1.213538e-03, 5.439100e-05},{-1.159147e-03, 5.639166e-05},
- {-1.102756e-03, 5.826963e-05},{-1.044486e-03, 6.002185e-05},{-9.844642e-04, 6.164550e-05},{-9.228187e-04, 6.313804e-05},
- {-8.596807e-04, 6.449720e-05},{-7.951835e-04, 6.572099e-05},{-7.294625e-04, 6.680771e-05},{-6.626548e-04, 6.775593e-05},
- {-5.948989e-04, 6.856450e-05},{-5.263344e-04, 6.923257e-05},{-4.571018e-04, 6.975956e-05},{-3.873422e-04, 7.014517e-05},
- {-3.171970e-04, 7.038941e-05},{-2.468076e-04, 7.049253e-05},{-1.763151e-04, 7.045510e-05},{-1.058600e-04, 7.027794e-05},
- {-3.558206e-05, 6.996216e-05},{ 3.438010e-05, 6.950912e-05},{ 1.038892e-04, 6.892048e-05},{ 1.728097e-04, 6.819812e-05},
- { 2.410078e-04, 6.734420e-05},{ 3.083520e-04, 6.636113e-05},{ 3.747131e-04, 6.525157e-05},{ 4.399647e-04, 6.401840e-05},
- { 5.039831e-04, 6.266473e-05},{ 5.666478e-04, 6.119393e-05},{ 6.278418e-04, 5.960954e-05},{ 6.874513e-04, 5.791532e-05},
- { 7.453666e-04, 5.611525e-05},{ 8.014819e-04, 5.421349e-05},{ 8.556954e-04, 5.221435e-05},{ 9.079097e-04, 5.012236e-05},
- { 9.580321e-04, 4.794217e-05},{ 1.005974e-03, 4.567860e-05},{ 1.051653e-03, 4.333662e-05},{ 1.094989e-03, 4.092131e-05},
- { 1.135911e-03, 3.843787e-05},{ 1.174349e-03, 3.589163e-05},{ 1.210240e-03, 3.328798e-05},{ 1.243528e-03, 3.063244e-05},
- { 1.274161e-03, 2.793056e-05},{ 1.302091e-03, 2.518798e-05},{ 1.327279e-03, 2.241038e-05},{ 1.349690e-03, 1.960349e-05},
- { 1.369293e-03, 1.677306e-05},{ 1.386066e-03, 1.392485e-05},{ 1.399991e-03, 1.106464e-05},{ 1.411056e-03, 8.198176e-06},
- { 1.419254e-03, 5.331220e-06},{ 1.424585e-03, 2.469480e-06},{ 1.427055e-03,-3.813698e-07},{ 1.426673e-03,-3.215708e-06},
- { 1.423457e-03,-6.027977e-06},{ 1.417429e-03,-8.812693e-06},{ 1.408617e-03,-1.156446e-05},{ 1.397052e-03,-1.427797e-05},
- { 1.382774e-03,-1.694802e-05},{ 1.365826e-03,-1.956953e-05},{ 1.346257e-03,-2.213755e-05},{ 1.324119e-03,-2.464724e-05},
- { 1.299472e-03,-2.709392e-05},{ 1.272378e-03,-2.947306e-05},{ 1.242905e-03,-3.178029e-05},{ 1.211125e-03,-3.401140e-05},
- { 1.177113e-03,-3.616236e-05},{ 1.140951e-03,-3.822932e-05},{ 1.102722e-03,-4.020863e-05},{ 1.062513e-03,-4.209681e-05},
- { 1.020416e-03,-4.389060e-05},{ 9.765257e-04,-4.558695e-05},{ 9.309387e-04,-4.718301e-05},{ 8.837557e-04,-4.867614e-05},
- { 8.350796e-04,-5.006394e-05},{ 7.850156e-04,-5.134422e-05},{ 7.336714e-04,-5.251501e-05},{ 6.811564e-04,-5.357460e-05},
- { 6.275818e-04,-5.452147e-05},{ 5.730603e-04,-5.535436e-05},{ 5.177060e-04,-5.607224e-05},{ 4.616337e-04,-5.667432e-05},
- { 4.049594e-04,-5.716003e-05},{ 3.477994e-04,-5.752904e-05},{ 2.902703e-04,-5.778128e-05},{ 2.324891e-04,-5.791687e-05},
- { 1.745722e-04,-5.793621e-05},{ 1.166360e-04,-5.783989e-05},{ 5.879609e-05,-5.762875e-05},{ 1.167336e-06,-5.730385e-05},
- {-5.613652e-05,-5.686647e-05},{-1.130030e-04,-5.631811e-05},{-1.693211e-04,-5.566049e-05},{-2.249816e-04,-5.489551e-05},
- {-2.798771e-04,-5.402532e-05},{-3.339024e-04,-5.305222e-05},{-3.869546e-04,-5.197875e-05},{-4.389334e-04,-5.080761e-05},
- {-4.897410e-04,-4.954167e-05},{-5.392827e-04,-4.818400e-05},{-5.874667e-04,-4.673782e-05},{-6.342045e-04,-4.520652e-05},
- {-6.794110e-04,-4.359363e-05},{-7.230046e-04,-4.190283e-05},{-7.649075e-04,-4.013793e-05},{-8.050454e-04,-3.830289e-05},
- {-8.433483e-04,-3.640175e-05},{-8.797500e-04,-3.443869e-05},{-9.141887e-04,-3.241797e-05},{-9.466067e-04,-3.034397e-05},
- {-9.769507e-04,-2.822113e-05},{-1.005172e-03,-2.605396e-05},{-1.031226e-03,-2.384705e-05},{-1.055073e-03,-2.160502e-05},
- {-1.076678e-03,-1.933257e-05},{-1.096010e-03,-1.703441e-05},{-1.113045e-03,-1.471528e-05},{-1.127760e-03,-1.237993e-05},
- {-1.140140e-03,-1.003313e-05},{-1.150173e-03,-7.679632e-06},{-1.157853e-03,-5.324185e-06},{-1.163177e-03,-2.971510e-06},
- {-1.166148e-03,-6.263003e-07},{-1.166775e-03, 1.706796e-06},{-1.165068e-03, 4.023179e-06},{-1.161045e-03, 6.318309e-06},
- {-1.154726e-03, 8.587712e-06},{-1.146139e-03, 1.082699e-05},{-1.135312e-03, 1.303184e-05},{-1.122280e-03, 1.519804e-05},
- {-1.107082e-03, 1.732147e-05},{-1.089760e-03, 1.939812e-05},{-1.070362e-03, 2.142411e-05},{-1.048938e-03, 2.339565e-05},
- {-1.025543e-03, 2.530913e-05},{-1.000233e-03, 2.716103e-05},{-9.730724e-04, 2.894799e-05},{-9.441244e-04, 3.066681e-05},
- {-9.134576e-04, 3.231443e-05},{-8.811432e-04, 3.388796e-05},{-8.472552e-04, 3.538466e-05},{-8.118706e-04, 3.680197e-05},
- {-7.750686e-04, 3.813752e-05},{-7.369311e-04, 3.938908e-05},{-6.975420e-04, 4.055463e-05},{-6.569874e-04, 4.163233e-05},
- {-6.153550e-04, 4.262051e-05},{-5.727345e-04, 4.351770e-05},{-5.292168e-04, 4.432263e-05},{-4.848942e-04, 4.503422e-05},
- {-4.398600e-04, 4.565156e-05},{-3.942084e-04, 4.617395e-05},{-3.480345e-04, 4.660090e-05},{-3.014336e-04, 4.693210e-05},
- {-2.545015e-04, 4.716742e-05},{-2.073340e-04, 4.730694e-05},{-1.600271e-04, 4.735093e-05},{-1.126762e-04, 4.729985e-05},
- {-6.537633e-05, 4.715435e-05},{-1.822198e-05, 4.691525e-05},{ 2.869327e-05, 4.658358e-05},{ 7.527685e-05, 4.616053e-05},
- { 1.214374e-04, 4.564747e-05},{ 1.670848e-04, 4.504594e-05},{ 2.121308e-04, 4.435767e-05},{ 2.564885e-04, 4.358452e-05},
- { 3.000730e-04, 4.272854e-05},{ 3.428015e-04, 4.179192e-05},{ 3.845934e-04, 4.077700e-05},{ 4.253704e-04, 3.968626e-05},
- { 4.650567e-04, 3.852234e-05},{ 5.035790e-04, 3.728799e-05},{ 5.408670e-04, 3.598608e-05},{ 5.768531e-04, 3.461962e-05},
- { 6.114727e-04, 3.319173e-05},{ 6.446645e-04, 3.170562e-05},{ 6.763701e-04, 3.016461e-05},{ 7.065347e-04, 2.857211e-05},
- { 7.351068e-04, 2.693162e-05},{ 7.620384e-04, 2.524669e-05},{ 7.872851e-04, 2.352098e-05},{ 8.108061e-04, 2.175817e-05},
- { 8.325643e-04, 1.996203e-05},{ 8.525263e-04, 1.813635e-05},{ 8.706626e-04, 1.628496e-05},{ 8.869476e-04, 1.441174e-05},
- { 9.013593e-04, 1.252057e-05},{ 9.138799e-04, 1.061535e-05},{ 9.244953e-04, 8.699987e-06},{ 9.331953e-04, 6.778388e-06},
- { 9.399736e-04, 4.854446e-06},{ 9.448281e-04, 2.932040e-06},{ 9.477601e-04, 1.015022e-06},{ 9.487751e-04,-8.927907e-07},
- { 9.478824e-04,-2.787618e-06},{ 9.450947e-04,-4.665730e-06},{ 9.404290e-04,-6.523451e-06},{ 9.339056e-04,-8.357167e-06},
- { 9.255484e-04,-1.016333e-05},{ 9.153851e-04,-1.193848e-05},{ 9.034466e-04,-1.367923e-05},{ 8.897673e-04,-1.538228e-05},
- { 8.743851e-04,-1.704442e-05},{ 8.573407e-04,-1.866255e-05},{ 8.386781e-04,-2.023369e-05},{ 8.184444e-04,-2.175494e-05},
- { 7.966895e-04,-2.322355e-05},{ 7.734659e-04,-2.463685e-05},{ 7.488291e-04,-2.599235e-05},{ 7.228367e-04,-2.728765e-05},
- { 6.955491e-04,-2.852049e-05},{ 6.670286e-04,-2.968877e-05},{ 6.373398e-04,-3.079051e-05},{ 6.065493e-04,-3.182390e-05},
- { 5.747254e-04,-3.278724e-05},{ 5.419382e-04,-3.367902e-05},{ 5.082591e-04,-3.449785e-05},{ 4.737613e-04,-3.524253e-05},
- { 4.385188e-04,-3.591199e-05},{ 4.026068e-04,-3.650532e-05},{ 3.661014e-04,-3.702178e-05},{ 3.290797e-04,-3.746077e-05},
- { 2.916189e-04,-3.782188e-05},{ 2.537970e-04,-3.810483e-05},{ 2.156922e-04,-3.830951e-05},{ 1.773827e-04,-3.843598e-05},
- { 1.389467e-04,-3.848443e-05},{ 1.004623e-04,-3.845523e-05},{ 6.200703e-05,-3.834890e-05},{ 2.365813e-05,-3.816610e-05},
- {-1.450798e-05,-3.790766e-05},{-5.241563e-05,-3.757453e-05},{-8.999017e-05,-3.716783e-05},{-1.271580e-04,-3.668882e-05},
- {-1.638468e-04,-3.613888e-05},{-1.999857e-04,-3.551954e-05},{-2.355052e-04,-3.483246e-05},{-2.703377e-04,-3.407942e-05},
- {-3.044171e-04,-3.326232e-05},{-3.376794e-04,-3.238320e-05},{-3.700626e-04,-3.144418e-05},{-4.015068e-04,-3.044752e-05},
- {-4.319543e-04,-2.939556e-05},{-4.613499e-04,-2.829075e-05},{-4.896406e-04,-2.713563e-05},{-5.167763e-04,-2.593282e-05},
- {-5.427091e-04,-2.468503e-05},{-5.673941e-04,-2.339504e-05},{-5.907892e-04,-2.206569e-05},{-6.128548e-04,-2.069991e-05},
- {-6.335548e-04,-1.930065e-05},{-6.528554e-04,-1.787094e-05},{-6.707264e-04,-1.641384e-05},{-6.871402e-04,-1.493245e-05},
- {-7.020726e-04,-1.342989e-05},{-7.155025e-04,-1.190933e-05},{-7.274119e-04,-1.037393e-05},{-7.377858e-04,-8.826873e-06},
- {-7.466127e-04,-7.271354e-06},{-7.538840e-04,-5.710554e-06},{-7.595946e-04,-4.147652e-06},{-7.637422e-04,-2.585812e-06},
- {-7.663280e-04,-1.028176e-06},{-7.673562e-04, 5.221408e-07},{-7.668341e-04, 2.062056e-06},{-7.647720e-04, 3.588528e-06},
- {-7.611835e-04, 5.098557e-06},{-7.560849e-04, 6.589197e-06},{-7.494957e-04, 8.057558e-06},{-7.414382e-04, 9.500812e-06},
- {-7.319374e-04, 1.091620e-05},{-7.210212e-04, 1.230103e-05},{-7.087201e-04, 1.365269e-05},{-6.950674e-04, 1.496866e-05},
- {-6.800988e-04, 1.624650e-05},{-6.638523e-04, 1.748385e-05},{-6.463684e-04, 1.867847e-05},{-6.276900e-04, 1.982819e-05},
- {-6.078618e-04, 2.093098e-05},{-5.869308e-04, 2.198488e-05},{-5.649459e-04, 2.298806e-05},{-5.419578e-04, 2.393880e-05},
- {-5.180190e-04, 2.483551e-05},{-4.931835e-04, 2.567669e-05},{-4.675068e-04, 2.646098e-05},{-4.410459e-04, 2.718714e-05},
- {-4.138587e-04, 2.785406e-05},{-3.860047e-04, 2.846075e-05},{-3.575439e-04, 2.900634e-05},{-3.285376e-04, 2.949011e-05},
- {-2.990475e-04, 2.991144e-05},{-2.691360e-04, 3.026986e-05},{-2.388662e-04, 3.056504e-05},{-2.083011e-04, 3.079676e-05},
- {-1.775044e-04, 3.096492e-05},{-1.465394e-04, 3.106959e-05},{-1.154698e-04, 3.111093e-05},{-8.435892e-05, 3.108923e-05},
- {-5.326969e-05, 3.100493e-05},{-2.226476e-05, 3.085858e-05},{ 8.593822e-06, 3.065084e-05},{ 3.924466e-05, 3.038251e-05},
- { 6.962718e-05, 3.005450e-05},{ 9.968168e-05, 2.966784e-05},{ 1.293495e-04, 2.922365e-05},{ 1.585732e-04, 2.872319e-05},
- { 1.872964e-04, 2.816781e-05},{ 2.154642e-04, 2.755897e-05},{ 2.430231e-04, 2.689822e-05},{ 2.699214e-04, 2.618721e-05},
- { 2.961086e-04, 2.542769e-05},{ 3.215363e-04, 2.462149e-05},{ 3.461578e-04, 2.377051e-05},{ 3.699283e-04, 2.287676e-05},
- { 3.928050e-04, 2.194230e-05},{ 4.147473e-04, 2.096927e-05},{ 4.357166e-04, 1.995987e-05},{ 4.556765e-04, 1.891636e-05},
- { 4.745928e-04, 1.784107e-05},{ 4.924339e-04, 1.673635e-05},{ 5.091702e-04, 1.560463e-05},{ 5.247749e-04, 1.444836e-05},
- { 5.392232e-04, 1.327003e-05},{ 5.524933e-04, 1.207215e-05},{ 5.645654e-04, 1.085727e-05},{ 5.754227e-04, 9.627952e-06},
- { 5.850506e-04, 8.386768e-06},{ 5.934374e-04, 7.136302e-06},{ 6.005737e-04, 5.879141e-06},{ 6.064528e-04, 4.617872e-06},
- { 6.110707e-04, 3.355070e-06},{ 6.144258e-04, 2.093300e-06},{ 6.165191e-04, 8.351101e-07},{ 6.173542e-04,-4.169759e-07},
- { 6.169372e-04,-1.660461e-06},{ 6.152768e-04,-2.892882e-06},{ 6.123839e-04,-4.111812e-06},{ 6.082721e-04,-5.314866e-06},
- { 6.029572e-04,-6.499707e-06},{ 5.964575e-04,-7.664048e-06},{ 5.887934e-04,-8.805658e-06},{ 5.799878e-04,-9.922366e-06},
- { 5.700654e-04,-1.101206e-05},{ 5.590534e-04,-1.207271e-05},{ 5.469806e-04,-1.310234e-05},{ 5.338783e-04,-1.409905e-05},
- { 5.197793e-04,-1.506104e-05},{ 5.047182e-04,-1.598657e-05},{ 4.887316e-04,-1.687398e-05},{ 4.718577e-04,-1.772172e-05},
- { 4.541359e-04,-1.852831e-05},{ 4.356076e-04,-1.929238e-05},{ 4.163152e-04,-2.001264e-05},{ 3.963026e-04,-2.068790e-05},
- { 3.756147e-04,-2.131707e-05},{ 3.542976e-04,-2.189916e-05},{ 3.323985e-04,-2.243329e-05},{ 3.099652e-04,-2.291866e-05},
- { 2.870465e-04,-2.335460e-05},{ 2.636919e-04,-2.374054e-05},{ 2.399514e-04,-2.407599e-05},{ 2.158754e-04,-2.436059e-05},
- { 1.915148e-04,-2.459408e-05},{ 1.669207e-04,-2.477631e-05},{ 1.421444e-04,-2.490722e-05},{ 1.172372e-04,-2.498686e-05},
- { 9.225035e-05,-2.501541e-05},{ 6.723494e-05,-2.499310e-05},{ 4.224184e-05,-2.492031e-05},{ 1.732153e-05,-2.479750e-05},
- {-7.475969e-06,-2.462523e-05},{-3.210119e-05,-2.440415e-05},{-5.650534e-05,-2.413501e-05},{-8.064036e-05,-2.381868e-05},
- {-1.044590e-04,-2.345607e-05},{-1.279151e-04,-2.304821e-05},{-1.509633e-04,-2.259622e-05},{-1.735595e-04,-2.210128e-05},
- {-1.956608e-04,-2.156467e-05},{-2.172255e-04,-2.098773e-05},{-2.382132e-04,-2.037190e-05},{-2.585851e-04,-1.971865e-05},
- {-2.783038e-04,-1.902956e-05},{-2.973333e-04,-1.830624e-05},{-3.156396e-04,-1.755038e-05},{-3.331899e-04,-1.676371e-05},
- {-3.499536e-04,-1.594802e-05},{-3.659017e-04,-1.510516e-05},{-3.810068e-04,-1.423700e-05},{-3.952438e-04,-1.334546e-05},
- {-4.085893e-04,-1.243250e-05},{-4.210218e-04,-1.150010e-05},{-4.325219e-04,-1.055029e-05},{-4.430722e-04,-9.585101e-06},
- {-4.526573e-04,-8.606586e-06},{-4.612639e-04,-7.616818e-06},{-4.688807e-04,-6.617878e-06},{-4.754986e-04,-5.611852e-06},
- {-4.811104e-04,-4.600828e-06},{-4.857112e-04,-3.586890e-06},{-4.892981e-04,-2.572117e-06},{-4.918702e-04,-1.558575e-06},
- {-4.934288e-04,-5.483142e-07},{-4.939771e-04, 4.566327e-07},{-4.935205e-04, 1.454258e-06},{-4.920662e-04, 2.442581e-06},
- {-4.896237e-04, 3.419652e-06},{-4.862040e-04, 4.383558e-06},{-4.818205e-04, 5.332422e-06},{-4.764880e-04, 6.264412e-06},
- {-4.702236e-04, 7.177740e-06},{-4.630459e-04, 8.070669e-06},{-4.549752e-04, 8.941511e-06},{-4.460337e-04, 9.788638e-06},
- {-4.362451e-04, 1.061048e-05},{-4.256346e-04, 1.140552e-05},{-4.142291e-04, 1.217231e-05},{-4.020567e-04, 1.290949e-05},
- {-3.891473e-04, 1.361572e-05},{-3.755315e-04, 1.428978e-05},{-3.612418e-04, 1.493050e-05},{-3.463113e-04, 1.553679e-05},
- {-3.307745e-04, 1.610763e-05},{-3.146668e-04, 1.664209e-05},{-2.980247e-04, 1.713931e-05},{-2.808854e-04, 1.759852e-05},
- {-2.632869e-04, 1.801902e-05},{-2.452679e-04, 1.840021e-05},{-2.268677e-04, 1.874156e-05},{-2.081261e-04, 1.904263e-05},
- {-1.890835e-04, 1.930306e-05},{-1.697804e-04, 1.952258e-05},{-1.502578e-04, 1.970102e-05},{-1.305568e-04, 1.983826e-05},
- {-1.107186e-04, 1.993428e-05},{-9.078428e-05, 1.998917e-05},{-7.079511e-05, 2.000306e-05},{-5.079205e-05, 1.997620e-05},
- {-3.081585e-05, 1.990889e-05},{-1.090696e-05, 1.980154e-05},{ 8.894581e-06, 1.965461e-05},{ 2.854919e-05, 1.946866e-05},
- { 4.801785e-05, 1.924432e-05},{ 6.726217e-05, 1.898229e-05},{ 8.624446e-05, 1.868334e-05},{ 1.049278e-04, 1.834832e-05},
- { 1.232761e-04, 1.797815e-05},{ 1.412543e-04, 1.757380e-05},{ 1.588281e-04, 1.713631e-05},{ 1.759644e-04, 1.666679e-05},
- { 1.926312e-04, 1.616640e-05},{ 2.087976e-04, 1.563636e-05},{ 2.244339e-04, 1.507794e-05},{ 2.395119e-04, 1.449246e-05},
- { 2.540043e-04, 1.388128e-05},{ 2.678856e-04, 1.324581e-05},{ 2.811314e-04, 1.258751e-05},{ 2.937189e-04, 1.190787e-05},
- { 3.056268e-04, 1.120840e-05},{ 3.168352e-04, 1.049066e-05},{ 3.273259e-04, 9.756231e-06},{ 3.370821e-04, 9.006714e-06},
- { 3.460888e-04, 8.243737e-06},{ 3.543325e-04, 7.468939e-06},{ 3.618015e-04, 6.683978e-06},{ 3.684855e-04, 5.890519e-06},
- { 3.743760e-04, 5.090234e-06},{ 3.794662e-04, 4.284798e-06},{ 3.837510e-04, 3.475888e-06},{ 3.872269e-04, 2.665174e-06},
- { 3.898921e-04, 1.854321e-06},{ 3.917464e-04, 1.044984e-06},{ 3.927914e-04, 2.388040e-07},{ 3.930302e-04,-5.625965e-07},
- { 3.924676e-04,-1.357614e-06},{ 3.911100e-04,-2.144667e-06},{ 3.889653e-04,-2.922204e-06},{ 3.860431e-04,-3.688698e-06},
- { 3.823544e-04,-4.442660e-06},{ 3.779117e-04,-5.182631e-06},{ 3.727291e-04,-5.907193e-06},{ 3.668219e-04,-6.614968e-06},
- { 3.602070e-04,-7.304621e-06},{ 3.529023e-04,-7.974861e-06},{ 3.449275e-04,-8.624449e-06},{ 3.363030e-04,-9.252192e-06},
- { 3.270508e-04,-9.856951e-06},{ 3.171939e-04,-1.043764e-05},{ 3.067562e-04,-1.099324e-05},{ 2.957630e-04,-1.152276e-05},
- { 2.842402e-04,-1.202531e-05},{ 2.722149e-04,-1.250003e-05},{ 2.597149e-04,-1.294613e-05},{ 2.467688e-04,-1.336290e-05},
- { 2.334059e-04,-1.374966e-05},{ 2.196562e-04,-1.410583e-05},{ 2.055504e-04,-1.443088e-05},{ 1.911195e-04,-1.472435e-05},
- { 1.763951e-04,-1.498584e-05},{ 1.614093e-04,-1.521503e-05},{ 1.461943e-04,-1.541167e-05},{ 1.307826e-04,-1.557556e-05},
- { 1.152071e-04,-1.570658e-05},{ 9.950047e-05,-1.580469e-05},{ 8.369578e-05,-1.586990e-05},{ 6.782588e-05,-1.590228e-05},
- { 5.192360e-05,-1.590199e-05},{ 3.602161e-05,-1.586925e-05},{ 2.015236e-05,-1.580433e-05},{ 4.348031e-06,-1.570757e-05},
- {-1.135954e-05,-1.557939e-05},{-2.693894e-05,-1.542026e-05},{-4.235919e-05,-1.523069e-05},{-5.758988e-05,-1.501128e-05},
- {-7.260116e-05,-1.476267e-05},{-8.736384e-05,-1.448557e-05},{-1.018494e-04,-1.418072e-05},{-1.160301e-04,-1.384894e-05},
- {-1.298791e-04,-1.349108e-05},{-1.433701e-04,-1.310804e-05},{-1.564782e-04,-1.270076e-05},{-1.691789e-04,-1.227026e-05},
- {-1.814492e-04,-1.181755e-05},{-1.932668e-04,-1.134371e-05},{-2.046105e-04,-1.084985e-05},{-2.154603e-04,-1.033711e-05},
- {-2.257974e-04,-9.806668e-06},{-2.356041e-04,-9.259720e-06},{-2.448638e-04,-8.697497e-06},{-2.535613e-04,-8.121251e-06},
- {-2.616826e-04,-7.532251e-06},{-2.692148e-04,-6.931790e-06},{-2.761466e-04,-6.321170e-06},{-2.824678e-04,-5.701709e-06},
- {-2.881695e-04,-5.074733e-06},{-2.932442e-04,-4.441575e-06},{-2.976858e-04,-3.803573e-06},{-3.014894e-04,-3.162064e-06},
- {-3.046514e-04,-2.518384e-06},{-3.071698e-04,-1.873866e-06},{-3.090437e-04,-1.229835e-06},{-3.102735e-04,-5.876058e-07},
- {-3.108611e-04, 5.151785e-08},{-3.108096e-04, 6.862483e-07},{-3.101234e-04, 1.315315e-06},{-3.088080e-04, 1.937467e-06},
- {-3.068706e-04, 2.551476e-06},{-3.043191e-04, 3.156140e-06},{-3.011630e-04, 3.750281e-06},{-2.974127e-04, 4.332753e-06},
- {-2.930799e-04, 4.902440e-06},{-2.881775e-04, 5.458260e-06},{-2.827192e-04, 5.999168e-06},{-2.767201e-04, 6.524154e-06},
- {-2.701959e-04, 7.032249e-06},{-2.631637e-04, 7.522525e-06},{-2.556411e-04, 7.994095e-06},{-2.476470e-04, 8.446119e-06},
- {-2.392009e-04, 8.877800e-06},{-2.303231e-04, 9.288390e-06},{-2.210347e-04, 9.677189e-06},{-2.113575e-04, 1.004354e-05},
- {-2.013140e-04, 1.038686e-05},{-1.909271e-04, 1.070657e-05},{-1.802206e-04, 1.100220e-05},{-1.692184e-04, 1.127329e-05},
- {-1.579451e-04, 1.151946e-05},{-1.464256e-04, 1.174036e-05},{-1.346852e-04, 1.193571e-05},{-1.227495e-04, 1.210529e-05},
- {-1.106442e-04, 1.224892e-05},{-9.839532e-05, 1.236647e-05},{-8.602885e-05, 1.245788e-05},{-7.357097e-05, 1.252315e-05},
- {-6.104782e-05, 1.256230e-05},{-4.848552e-05, 1.257544e-05},{-3.591008e-05, 1.256272e-05},{-2.334736e-05, 1.252434e-05},
- {-1.082302e-05, 1.246054e-05},{ 1.637521e-06, 1.237163e-05},{ 1.400915e-05, 1.225796e-05},{ 2.626711e-05, 1.211994e-05},
- { 3.838705e-05, 1.195800e-05},{ 5.034505e-05, 1.177264e-05},{ 6.211769e-05, 1.156441e-05},{ 7.368209e-05, 1.133388e-05},
- { 8.501597e-05, 1.108167e-05},{ 9.609764e-05, 1.080846e-05},{ 1.069061e-04, 1.051494e-05},{ 1.174210e-04, 1.020186e-05},
- { 1.276229e-04, 9.869986e-06},{ 1.374929e-04, 9.520131e-06},{ 1.470130e-04, 9.153135e-06},{ 1.561662e-04, 8.769867e-06},
- { 1.649360e-04, 8.371226e-06},{ 1.733073e-04, 7.958134e-06},{ 1.812654e-04, 7.531539e-06},{ 1.887969e-04, 7.092408e-06},
- { 1.958893e-04, 6.641728e-06},{ 2.025311e-04, 6.180504e-06},{ 2.087116e-04, 5.709756e-06},{ 2.144213e-04, 5.230515e-06},
- { 2.196518e-04, 4.743824e-06},{ 2.243957e-04, 4.250735e-06},{ 2.286464e-04, 3.752303e-06},{ 2.323987e-04, 3.249591e-06},
- { 2.356483e-04, 2.743661e-06},{ 2.383920e-04, 2.235575e-06},{ 2.406275e-04, 1.726392e-06},{ 2.423539e-04, 1.217166e-06},
- { 2.435711e-04, 7.089454e-07},{ 2.442800e-04, 2.027681e-07},{ 2.444828e-04,-3.003388e-07},{ 2.441825e-04,-7.993615e-07},
- { 2.433831e-04,-1.293302e-06},{ 2.420898e-04,-1.781178e-06},{ 2.403086e-04,-2.262027e-06},{ 2.380466e-04,-2.734910e-06},
- { 2.353117e-04,-3.198906e-06},{ 2.321128e-04,-3.653123e-06},{ 2.284597e-04,-4.096692e-06},{ 2.243630e-04,-4.528773e-06},
- { 2.198342e-04,-4.948557e-06},{ 2.148856e-04,-5.355263e-06},{ 2.095304e-04,-5.748144e-06},{ 2.037822e-04,-6.126485e-06},
- { 1.976557e-04,-6.489608e-06},{ 1.911661e-04,-6.836870e-06},{ 1.843293e-04,-7.167665e-06},{ 1.771616e-04,-7.481424e-06},
- { 1.696802e-04,-7.777618e-06},{ 1.619026e-04,-8.055758e-06},{ 1.538468e-04,-8.315396e-06},{ 1.455314e-04,-8.556124e-06},
- { 1.369753e-04,-8.777575e-06},{ 1.281977e-04,-8.979428e-06},{ 1.192183e-04,-9.161400e-06},{ 1.100569e-04,-9.323254e-06},
- { 1.007336e-04,-9.464794e-06},{ 9.126883e-05,-9.585870e-06},{ 8.168296e-05,-9.686373e-06},{ 7.199658e-05,-9.766237e-06},
- { 6.223035e-05,-9.825440e-06},{ 5.240491e-05,-9.864004e-06},{ 4.254090e-05,-9.881990e-06},{ 3.265891e-05,-9.879504e-06},
- { 2.277941e-05,-9.856692e-06},{ 1.292272e-05,-9.813743e-06},{ 3.108973e-06,-9.750883e-06},{-6.641911e-06,-9.668380e-06},
- {-1.631029e-05,-9.566540e-06},{-2.587683e-05,-9.445707e-06},{-3.532254e-05,-9.306262e-06},{-4.462880e-05,-9.148620e-06},
- {-5.377742e-05,-8.973234e-06},{-6.275066e-05,-8.780588e-06},{-7.153124e-05,-8.571199e-06},{-8.010244e-05,-8.345614e-06},
- {-8.844806e-05,-8.104413e-06},{-9.655247e-05,-7.848201e-06},{-1.044007e-04,-7.577610e-06},{-1.119783e-04,-7.293299e-06},
- {-1.192716e-04,-6.995951e-06},{-1.262675e-04,-6.686269e-06},{-1.329538e-04,-6.364978e-06},{-1.393188e-04,-6.032822e-06},
- {-1.453516e-04,-5.690563e-06},{-1.510422e-04,-5.338978e-06},{-1.563811e-04,-4.978856e-06},{-1.613600e-04,-4.611002e-06},
- {-1.659710e-04,-4.236229e-06},{-1.702072e-04,-3.855358e-06},{-1.740626e-04,-3.469219e-06},{-1.775318e-04,-3.078647e-06},
- {-1.806105e-04,-2.684478e-06},{-1.832949e-04,-2.287552e-06},{-1.855825e-04,-1.888708e-06},{-1.874712e-04,-1.488784e-06},
- {-1.889600e-04,-1.088613e-06},{-1.900486e-04,-6.890246e-07},{-1.907376e-04,-2.908395e-07},{-1.910284e-04, 1.051292e-07},
- {-1.909233e-04, 4.980785e-07},{-1.904252e-04, 8.872174e-07},{-1.895380e-04, 1.271768e-06},{-1.882663e-04, 1.650969e-06},
- {-1.866153e-04, 2.024072e-06},{-1.845912e-04, 2.390349e-06},{-1.822009e-04, 2.749092e-06},{-1.794518e-04, 3.099611e-06},
- {-1.763522e-04, 3.441238e-06},{-1.729109e-04, 3.773331e-06},{-1.691376e-04, 4.095269e-06},{-1.650423e-04, 4.406457e-06},
- {-1.606359e-04, 4.706329e-06},{-1.559295e-04, 4.994342e-06},{-1.509352e-04, 5.269984e-06},{-1.456652e-04, 5.532773e-06},
- {-1.401324e-04, 5.782256e-06},{-1.343502e-04, 6.018009e-06},{-1.283322e-04, 6.239641e-06},{-1.220925e-04, 6.446794e-06},
- {-1.156457e-04, 6.639141e-06},{-1.090066e-04, 6.816388e-06},{-1.021902e-04, 6.978275e-06},{-9.521194e-05, 7.124575e-06},
- {-8.808736e-05, 7.255095e-06},{-8.083227e-05, 7.369677e-06},{-7.346259e-05, 7.468196e-06},{-6.599440e-05, 7.550562e-06},
- {-5.844383e-05, 7.616719e-06},{-5.082711e-05, 7.666643e-06},{-4.316047e-05, 7.700347e-06},{-3.546012e-05, 7.717876e-06},
- {-2.774225e-05, 7.719307e-06},{-2.002294e-05, 7.704753e-06},{-1.231819e-05, 7.674356e-06},{-4.643831e-06, 7.628293e-06},
- { 2.984462e-06, 7.566768e-06},{ 1.055123e-05, 7.490021e-06},{ 1.804125e-05, 7.398318e-06},{ 2.543957e-05, 7.291955e-06},
- { 3.273152e-05, 7.171257e-06},{ 3.990278e-05, 7.036576e-06},{ 4.693936e-05, 6.888290e-06},{ 5.382765e-05, 6.726805e-06},
- { 6.055445e-05, 6.552549e-06},{ 6.710700e-05, 6.365974e-06},{ 7.347297e-05, 6.167554e-06},{ 7.964053e-05, 5.957786e-06},
- { 8.559831e-05, 5.737186e-06},{ 9.133550e-05, 5.506288e-06},{ 9.684179e-05, 5.265646e-06},{ 1.021074e-04, 5.015827e-06},
- { 1.071233e-04, 4.757416e-06},{ 1.118807e-04, 4.491010e-06},{ 1.163717e-04, 4.217219e-06},{ 1.205889e-04, 3.936664e-06},
- { 1.245256e-04, 3.649977e-06},{ 1.281755e-04, 3.357795e-06},{ 1.315333e-04, 3.060765e-06},{ 1.345941e-04, 2.759537e-06},
- { 1.373536e-04, 2.454769e-06},{ 1.398084e-04, 2.147117e-06},{ 1.419555e-04, 1.837241e-06},{ 1.437928e-04, 1.525801e-06},
- { 1.453186e-04, 1.213455e-06},{ 1.465320e-04, 9.008578e-07},{ 1.474329e-04, 5.886610e-07},{ 1.480215e-04, 2.775101e-07},
- { 1.482991e-04,-3.195590e-08},{ 1.482671e-04,-3.391060e-07},{ 1.479280e-04,-6.433187e-07},{ 1.472847e-04,-9.439829e-07},
- { 1.463407e-04,-1.240499e-06},{ 1.451002e-04,-1.532281e-06},{ 1.435679e-04,-1.818756e-06},{ 1.417492e-04,-2.099367e-06},
- { 1.396498e-04,-2.373572e-06},{ 1.372762e-04,-2.640848e-06},{ 1.346354e-04,-2.900689e-06},{ 1.317347e-04,-3.152607e-06},
- { 1.285821e-04,-3.396137e-06},{ 1.251859e-04,-3.630832e-06},{ 1.215551e-04,-3.856268e-06},{ 1.176988e-04,-4.072043e-06},
- { 1.136268e-04,-4.277777e-06},{ 1.093490e-04,-4.473114e-06},{ 1.048759e-04,-4.657725e-06},{ 1.002182e-04,-4.831301e-06},
- { 9.538688e-05,-4.993562e-06},{ 9.039331e-05,-5.144252e-06},{ 8.524906e-05,-5.283141e-06},{ 7.996592e-05,-5.410024e-06},
- { 7.455590e-05,-5.524725e-06},{ 6.903117e-05,-5.627094e-06},{ 6.340408e-05,-5.717006e-06},{ 5.768707e-05,-5.794365e-06},
- { 5.189271e-05,-5.859100e-06},{ 4.603360e-05,-5.911169e-06},{ 4.012244e-05,-5.950554e-06},{ 3.417188e-05,-5.977267e-06},
- { 2.819461e-05,-5.991342e-06},{ 2.220327e-05,-5.992843e-06},{ 1.621043e-05,-5.981859e-06},{ 1.022857e-05,-5.958502e-06},
- { 4.270069e-06,-5.922911e-06},{-1.652843e-06,-5.875250e-06},{-7.528093e-06,-5.815706e-06},{-1.334380e-05,-5.744490e-06},
- {-1.908829e-05,-5.661835e-06},{-2.475012e-05,-5.567996e-06},{-3.031812e-05,-5.463251e-06},{-3.578137e-05,-5.347899e-06},
- {-4.112927e-05,-5.222257e-06},{-4.635153e-05,-5.086661e-06},{-5.143819e-05,-4.941469e-06},{-5.637966e-05,-4.787052e-06},
- {-6.116671e-05,-4.623801e-06},{-6.579051e-05,-4.452120e-06},{-7.024263e-05,-4.272430e-06},{-7.451506e-05,-4.085164e-06},
- {-7.860023e-05,-3.890769e-06},{-8.249099e-05,-3.689702e-06},{-8.618070e-05,-3.482432e-06},{-8.966313e-05,-3.269438e-06},
- {-9.293257e-05,-3.051206e-06},{-9.598377e-05,-2.828230e-06},{-9.881200e-05,-2.601010e-06},{-1.014130e-04,-2.370053e-06},
- {-1.037831e-04,-2.135869e-06},{-1.059189e-04,-1.898969e-06},{-1.078179e-04,-1.659870e-06},{-1.094778e-04,-1.419086e-06},
- {-1.108969e-04,-1.177134e-06},{-1.120740e-04,-9.345280e-07},{-1.130085e-04,-6.917794e-07},{-1.137003e-04,-4.493969e-07},
- {-1.141497e-04,-2.078845e-07},{-1.143576e-04, 3.225919e-08},{-1.143253e-04, 2.705422e-07},{-1.140548e-04, 5.064798e-07},
- {-1.135483e-04, 7.395960e-07},{-1.128087e-04, 9.694240e-07},{-1.118393e-04, 1.195507e-06},{-1.106438e-04, 1.417400e-06},
- {-1.092264e-04, 1.634670e-06},{-1.075917e-04, 1.846896e-06},{-1.057448e-04, 2.053671e-06},{-1.036911e-04, 2.254603e-06},
- {-1.014365e-04, 2.449314e-06},{-9.898722e-05, 2.637443e-06},{-9.634978e-05, 2.818645e-06},{-9.353113e-05, 2.992591e-06},
- {-9.053854e-05, 3.158972e-06},{-8.737957e-05, 3.317494e-06},{-8.406207e-05, 3.467884e-06},{-8.059419e-05, 3.609887e-06},
- {-7.698430e-05, 3.743268e-06},{-7.324103e-05, 3.867812e-06},{-6.937322e-05, 3.983322e-06},{-6.538990e-05, 4.089625e-06},
- {-6.130028e-05, 4.186565e-06},{-5.711371e-05, 4.274009e-06},{-5.283970e-05, 4.351845e-06},{-4.848786e-05, 4.419980e-06},
- {-4.406788e-05, 4.478344e-06},{-3.958953e-05, 4.526887e-06},{-3.506264e-05, 4.565581e-06},{-3.049706e-05, 4.594417e-06},
- {-2.590265e-05, 4.613409e-06},{-2.128924e-05, 4.622590e-06},{-1.666665e-05, 4.622014e-06},{-1.204463e-05, 4.611755e-06},
- {-7.432879e-06, 4.591906e-06},{-2.840972e-06, 4.562582e-06},{ 1.721609e-06, 4.523913e-06},{ 6.245522e-06, 4.476052e-06},
- { 1.072157e-05, 4.419166e-06},{ 1.514074e-05, 4.353444e-06},{ 1.949418e-05, 4.279089e-06},{ 2.377327e-05, 4.196322e-06},
- { 2.796960e-05, 4.105379e-06},{ 3.207497e-05, 4.006513e-06},{ 3.608149e-05, 3.899991e-06},{ 3.998148e-05, 3.786094e-06},
- { 4.376757e-05, 3.665117e-06},{ 4.743269e-05, 3.537366e-06},{ 5.097006e-05, 3.403161e-06},{ 5.437322e-05, 3.262833e-06},
- { 5.763605e-05, 3.116722e-06},{ 6.075277e-05, 2.965179e-06},{ 6.371795e-05, 2.808564e-06},{ 6.652652e-05, 2.647244e-06},
- { 6.917376e-05, 2.481593e-06},{ 7.165535e-05, 2.311993e-06},{ 7.396735e-05, 2.138829e-06},{ 7.610617e-05, 1.962494e-06},
- { 7.806867e-05, 1.783382e-06},{ 7.985205e-05, 1.601890e-06},{ 8.145394e-05, 1.418419e-06},{ 8.287236e-05, 1.233370e-06},
- { 8.410573e-05, 1.047144e-06},{ 8.515287e-05, 8.601415e-07},{ 8.601301e-05, 6.727631e-07},{ 8.668578e-05, 4.854057e-07},
- { 8.717118e-05, 2.984638e-07},{ 8.746965e-05, 1.123281e-07},{ 8.758197e-05,-7.261558e-08},{ 8.750936e-05,-2.559865e-07},
- { 8.725337e-05,-4.374101e-07},{ 8.681596e-05,-6.165189e-07},{ 8.619944e-05,-7.929530e-07},{ 8.540649e-05,-9.663605e-07},
- { 8.444013e-05,-1.136399e-06},{ 8.330373e-05,-1.302735e-06},{ 8.200100e-05,-1.465047e-06},{ 8.053595e-05,-1.623022e-06},
- { 7.891293e-05,-1.776360e-06},{ 7.713657e-05,-1.924773e-06},{ 7.521179e-05,-2.067985e-06},{ 7.314381e-05,-2.205734e-06},
- { 7.093807e-05,-2.337769e-06},{ 6.860031e-05,-2.463857e-06},{ 6.613645e-05,-2.583776e-06},{ 6.355267e-05,-2.697319e-06},
- { 6.085535e-05,-2.804296e-06},{ 5.805106e-05,-2.904530e-06},{ 5.514653e-05,-2.997862e-06},{ 5.214867e-05,-3.084147e-06},
- { 4.906452e-05,-3.163255e-06},{ 4.590126e-05,-3.235075e-06},{ 4.266619e-05,-3.299511e-06},{ 3.936668e-05,-3.356482e-06},
- { 3.601020e-05,-3.405925e-06},{ 3.260427e-05,-3.447794e-06},{ 2.915648e-05,-3.482056e-06},{ 2.567442e-05,-3.508699e-06},
- { 2.216572e-05,-3.527724e-06},{ 1.863800e-05,-3.539148e-06},{ 1.509885e-05,-3.543006e-06},{ 1.155584e-05,-3.539348e-06},
- { 8.016496e-06,-3.528239e-06},{ 4.488257e-06,-3.509758e-06},{ 9.784991e-07,-3.484003e-06},{-2.505504e-06,-3.451083e-06},
- {-5.956587e-06,-3.411122e-06},{-9.367709e-06,-3.364260e-06},{-1.273197e-05,-3.310648e-06},{-1.604262e-05,-3.250451e-06},
- {-1.929307e-05,-3.183849e-06},{-2.247692e-05,-3.111030e-06},{-2.558795e-05,-3.032198e-06},{-2.862014e-05,-2.947564e-06},
- {-3.156771e-05,-2.857354e-06},{-3.442506e-05,-2.761801e-06},{-3.718686e-05,-2.661149e-06},{-3.984801e-05,-2.555650e-06},
- {-4.240366e-05,-2.445565e-06},{-4.484923e-05,-2.331164e-06},{-4.718039e-05,-2.212722e-06},{-4.939311e-05,-2.090522e-06},
- {-5.148363e-05,-1.964851e-06},{-5.344849e-05,-1.836003e-06},{-5.528449e-05,-1.704277e-06},{-5.698877e-05,-1.569973e-06},
- {-5.855874e-05,-1.433396e-06},{-5.999213e-05,-1.294856e-06},{-6.128699e-05,-1.154659e-06},{-6.244165e-05,-1.013118e-06},
- {-6.345477e-05,-8.705432e-07},{-6.432531e-05,-7.272451e-07},{-6.505256e-05,-5.835340e-07},{-6.563609e-05,-4.397185e-07},
- {-6.607581e-05,-2.961048e-07},{-6.637191e-05,-1.529968e-07},{-6.652491e-05,-1.069455e-08},{-6.653560e-05, 1.305055e-07},
- {-6.640510e-05, 2.703118e-07},{-6.613479e-05, 4.084378e-07},{-6.572635e-05, 5.446028e-07},{-6.518175e-05, 6.785324e-07},
- {-6.450321e-05, 8.099591e-07},{-6.369326e-05, 9.386226e-07},{-6.275463e-05, 1.064271e-06},{-6.169036e-05, 1.186659e-06},
- {-6.050370e-05, 1.305553e-06},{-5.919815e-05, 1.420727e-06},{-5.777742e-05, 1.531963e-06},{-5.624546e-05, 1.639057e-06},
- {-5.460640e-05, 1.741812e-06},{-5.286459e-05, 1.840043e-06},{-5.102455e-05, 1.933576e-06},{-4.909097e-05, 2.022249e-06},
- {-4.706872e-05, 2.105911e-06},{-4.496281e-05, 2.184421e-06},{-4.277839e-05, 2.257654e-06},{-4.052074e-05, 2.325494e-06},
- {-3.819524e-05, 2.387839e-06},{-3.580740e-05, 2.444599e-06},{-3.336280e-05, 2.495696e-06},{-3.086711e-05, 2.541066e-06},
- {-2.832604e-05, 2.580657e-06},{-2.574539e-05, 2.614430e-06},{-2.313096e-05, 2.642358e-06},{-2.048860e-05, 2.664427e-06},
- {-1.782417e-05, 2.680637e-06},{-1.514353e-05, 2.690999e-06},{-1.245253e-05, 2.695536e-06},{-9.756999e-06, 2.694284e-06},
- {-7.062715e-06, 2.687293e-06},{-4.375422e-06, 2.674621e-06},{-1.700801e-06, 2.656342e-06},{ 9.555409e-07, 2.632537e-06},
- { 3.588078e-06, 2.603301e-06},{ 6.191379e-06, 2.568740e-06},{ 8.760119e-06, 2.528970e-06},{ 1.128909e-05, 2.484116e-06},
- { 1.377320e-05, 2.434315e-06},{ 1.620752e-05, 2.379713e-06},{ 1.858723e-05, 2.320464e-06},{ 2.090770e-05, 2.256731e-06},
- { 2.316443e-05, 2.188687e-06},{ 2.535312e-05, 2.116511e-06},{ 2.746963e-05, 2.040391e-06},{ 2.951002e-05, 1.960521e-06},
- { 3.147054e-05, 1.877102e-06},{ 3.334764e-05, 1.790340e-06},{ 3.513798e-05, 1.700447e-06},{ 3.683843e-05, 1.607643e-06},
- { 3.844607e-05, 1.512148e-06},{ 3.995822e-05, 1.414188e-06},{ 4.137241e-05, 1.313994e-06},{ 4.268640e-05, 1.211797e-06},
- { 4.389820e-05, 1.107834e-06},{ 4.500603e-05, 1.002340e-06},{ 4.600837e-05, 8.955557e-07},{ 4.690393e-05, 7.877193e-07},
- { 4.769165e-05, 6.790709e-07},{ 4.837072e-05, 5.698503e-07},{ 4.894057e-05, 4.602966e-07},{ 4.940086e-05, 3.506478e-07},
- { 4.975151e-05, 2.411403e-07},{ 4.999265e-05, 1.320081e-07},{ 5.012466e-05, 2.348276e-08},{ 5.014814e-05,-8.420721e-08},
- { 5.006394e-05,-1.908370e-07},{ 4.987310e-05,-2.961858e-07},{ 4.957691e-05,-4.000373e-07},{ 4.917688e-05,-5.021801e-07},
- { 4.867470e-05,-6.024080e-07},{ 4.807229e-05,-7.005209e-07},{ 4.737177e-05,-7.963244e-07},{ 4.657544e-05,-8.896308e-07},
- { 4.568581e-05,-9.802593e-07},{ 4.470555e-05,-1.068036e-06},{ 4.363752e-05,-1.152795e-06},{ 4.248472e-05,-1.234378e-06},
- { 4.125034e-05,-1.312635e-06},{ 3.993771e-05,-1.387423e-06},{ 3.855028e-05,-1.458610e-06},{ 3.709167e-05,-1.526070e-06},
- { 3.556560e-05,-1.589689e-06},{ 3.397591e-05,-1.649360e-06},{ 3.232655e-05,-1.704987e-06},{ 3.062157e-05,-1.756481e-06},
- { 2.886509e-05,-1.803765e-06},{ 2.706132e-05,-1.846771e-06},{ 2.521455e-05,-1.885441e-06},{ 2.332911e-05,-1.919725e-06},
- { 2.140938e-05,-1.949586e-06},{ 1.945980e-05,-1.974995e-06},{ 1.748480e-05,-1.995933e-06},{ 1.548887e-05,-2.012390e-06},
- { 1.347648e-05,-2.024368e-06},{ 1.145211e-05,-2.031877e-06},{ 9.420235e-06,-2.034936e-06},{ 7.385299e-06,-2.033576e-06},
- { 5.351723e-06,-2.027834e-06},{ 3.323889e-06,-2.017760e-06},{ 1.306130e-06,-2.003409e-06},{-6.972791e-07,-1.984848e-06},
- {-2.682127e-06,-1.962151e-06},{-4.644278e-06,-1.935400e-06},{-6.579678e-06,-1.904688e-06},{-8.484366e-06,-1.870112e-06},
- {-1.035448e-05,-1.831778e-06},{-1.218626e-05,-1.789801e-06},{-1.397606e-05,-1.744301e-06},{-1.572036e-05,-1.695405e-06},
- {-1.741576e-05,-1.643247e-06},{-1.905901e-05,-1.587967e-06},{-2.064698e-05,-1.529710e-06},{-2.217668e-05,-1.468626e-06},
- {-2.364531e-05,-1.404872e-06},{-2.505018e-05,-1.338608e-06},{-2.638879e-05,-1.269997e-06},{-2.765879e-05,-1.199209e-06},
- {-2.885800e-05,-1.126414e-06},{-2.998441e-05,-1.051787e-06},{-3.103620e-05,-9.755056e-07},{-3.201170e-05,-8.977486e-07},
- {-3.290945e-05,-8.186971e-07},{-3.372815e-05,-7.385336e-07},{-3.446668e-05,-6.574416e-07},{-3.512413e-05,-5.756050e-07},
- {-3.569973e-05,-4.932079e-07},{-3.619294e-05,-4.104342e-07},{-3.660337e-05,-3.274671e-07},{-3.693084e-05,-2.444887e-07},
- {-3.717533e-05,-1.616798e-07},{-3.733701e-05,-7.921923e-08},{-3.741623e-05, 2.716247e-09},{-3.741351e-05, 8.395250e-08},
- {-3.732956e-05, 1.643183e-07},{-3.716524e-05, 2.436457e-07},{-3.692159e-05, 3.217704e-07},{-3.659982e-05, 3.985319e-07},
- {-3.620129e-05, 4.737743e-07},{-3.572752e-05, 5.473458e-07},{-3.518017e-05, 6.190999e-07},{-3.456107e-05, 6.888951e-07},
- {-3.387218e-05, 7.565951e-07},{-3.311558e-05, 8.220697e-07},{-3.229351e-05, 8.851942e-07},{-3.140832e-05, 9.458504e-07},
- {-3.046247e-05, 1.003926e-06},{-2.945854e-05, 1.059316e-06},{-2.839923e-05, 1.111922e-06},{-2.728730e-05, 1.161651e-06},
- {-2.612565e-05, 1.208418e-06},{-2.491724e-05, 1.252147e-06},{-2.366509e-05, 1.292767e-06},{-2.237232e-05, 1.330214e-06},
- {-2.104211e-05, 1.364434e-06},{-1.967767e-05, 1.395378e-06},{-1.828229e-05, 1.423006e-06},{-1.685929e-05, 1.447285e-06},
- {-1.541200e-05, 1.468190e-06},{-1.394381e-05, 1.485704e-06},{-1.245811e-05, 1.499815e-06},{-1.095829e-05, 1.510522e-06},
- {-9.447772e-06, 1.517830e-06},{-7.929942e-06, 1.521751e-06},{-6.408191e-06, 1.522305e-06},{-4.885886e-06, 1.519519e-06},
- {-3.366366e-06, 1.513427e-06},{-1.852939e-06, 1.504071e-06},{-3.488684e-07, 1.491497e-06},{ 1.142629e-06, 1.475762e-06},
- { 2.618390e-06, 1.456925e-06},{ 4.075315e-06, 1.435055e-06},{ 5.510370e-06, 1.410224e-06},{ 6.920594e-06, 1.382514e-06},
- { 8.303108e-06, 1.352007e-06},{ 9.655115e-06, 1.318797e-06},{ 1.097391e-05, 1.282977e-06},{ 1.225689e-05, 1.244650e-06},
- { 1.350154e-05, 1.203920e-06},{ 1.470546e-05, 1.160898e-06},{ 1.586636e-05, 1.115697e-06},{ 1.698205e-05, 1.068436e-06},
- { 1.805049e-05, 1.019236e-06},{ 1.906973e-05, 9.682226e-07},{ 2.003795e-05, 9.155227e-07},{ 2.095347e-05, 8.612672e-07},
- { 2.181474e-05, 8.055889e-07},{ 2.262033e-05, 7.486226e-07},{ 2.336895e-05, 6.905050e-07},{ 2.405946e-05, 6.313742e-07},
- { 2.469083e-05, 5.713693e-07},{ 2.526220e-05, 5.106302e-07},{ 2.577283e-05, 4.492974e-07},{ 2.622213e-05, 3.875113e-07},
- { 2.660964e-05, 3.254124e-07},{ 2.693505e-05, 2.631407e-07},{ 2.719819e-05, 2.008352e-07},{ 2.739903e-05, 1.386340e-07},
- { 2.753766e-05, 7.667392e-08},{ 2.761433e-05, 1.508993e-08},{ 2.762942e-05,-4.598487e-08},{ 2.758344e-05,-1.064196e-07},
- { 2.747702e-05,-1.660859e-07},{ 2.731093e-05,-2.248583e-07},{ 2.708608e-05,-2.826141e-07},{ 2.680346e-05,-3.392340e-07},
- { 2.646423e-05,-3.946023e-07},{ 2.606962e-05,-4.486069e-07},{ 2.562102e-05,-5.011398e-07},{ 2.511988e-05,-5.520971e-07},
- { 2.456778e-05,-6.013792e-07},{ 2.396640e-05,-6.488911e-07},{ 2.331751e-05,-6.945426e-07},{ 2.262297e-05,-7.382483e-07},
- { 2.188472e-05,-7.799279e-07},{ 2.110479e-05,-8.195062e-07},{ 2.028529e-05,-8.569133e-07},{ 1.942837e-05,-8.920849e-07},
- { 1.853629e-05,-9.249621e-07},{ 1.761133e-05,-9.554914e-07},{ 1.665583e-05,-9.836253e-07},{ 1.567221e-05,-1.009322e-06},
- { 1.466289e-05,-1.032545e-06},{ 1.363034e-05,-1.053265e-06},{ 1.257708e-05,-1.071456e-06},{ 1.150562e-05,-1.087100e-06},
- { 1.041852e-05,-1.100185e-06},{ 9.318336e-06,-1.110704e-06},{ 8.207632e-06,-1.118654e-06},{ 7.088978e-06,-1.124042e-06},
- { 5.964936e-06,-1.126877e-06},{ 4.838059e-06,-1.127175e-06},{ 3.710884e-06,-1.124958e-06},{ 2.585926e-06,-1.120251e-06},
- { 1.465674e-06,-1.113089e-06},{ 3.525855e-07,-1.103508e-06},{-7.509220e-07,-1.091550e-06},{-1.842472e-06,-1.077263e-06},
- {-2.919734e-06,-1.060699e-06},{-3.980434e-06,-1.041916e-06},{-5.022350e-06,-1.020975e-06},{-6.043325e-06,-9.979412e-07},
- {-7.041266e-06,-9.728849e-07},{-8.014151e-06,-9.458800e-07},{-8.960031e-06,-9.170040e-07},{-9.877035e-06,-8.863381e-07},
- {-1.076337e-05,-8.539667e-07},{-1.161734e-05,-8.199775e-07},{-1.243732e-05,-7.844609e-07},{-1.322178e-05,-7.475101e-07},
- {-1.396929e-05,-7.092207e-07},{-1.467851e-05,-6.696903e-07},{-1.534820e-05,-6.290188e-07},{-1.597722e-05,-5.873076e-07},
- {-1.656453e-05,-5.446596e-07},{-1.710919e-05,-5.011791e-07},{-1.761036e-05,-4.569710e-07},{-1.806734e-05,-4.121413e-07},
- {-1.847948e-05,-3.667965e-07},{-1.884627e-05,-3.210431e-07},{-1.916732e-05,-2.749877e-07},{-1.944230e-05,-2.287369e-07},
- {-1.967104e-05,-1.823964e-07},{-1.985344e-05,-1.360717e-07},{-1.998951e-05,-8.986699e-08},{-2.007938e-05,-4.388541e-08},
- {-2.012326e-05, 1.771259e-09},{-2.012149e-05, 4.700288e-08},{-2.007449e-05, 9.171111e-08},{-1.998278e-05, 1.357996e-07},
- {-1.984698e-05, 1.791744e-07},{-1.966780e-05, 2.217438e-07},{-1.944606e-05, 2.634187e-07},{-1.918264e-05, 3.041128e-07},
- {-1.887853e-05, 3.437430e-07},{-1.853478e-05, 3.822290e-07},{-1.815255e-05, 4.194940e-07},{-1.773306e-05, 4.554644e-07},
- {-1.727760e-05, 4.900705e-07},{-1.678753e-05, 5.232460e-07},{-1.626428e-05, 5.549285e-07},{-1.570935e-05, 5.850597e-07},
- {-1.512429e-05, 6.135851e-07},{-1.451071e-05, 6.404544e-07},{-1.387025e-05, 6.656215e-07},{-1.320463e-05, 6.890447e-07},
- {-1.251559e-05, 7.106863e-07},{-1.180490e-05, 7.305133e-07},{-1.107439e-05, 7.484969e-07},{-1.032589e-05, 7.646130e-07},
- {-9.561277e-06, 7.788417e-07},{-8.782435e-06, 7.911677e-07},{-7.991267e-06, 8.015801e-07},{-7.189687e-06, 8.100726e-07},
- {-6.379615e-06, 8.166433e-07},{-5.562971e-06, 8.212944e-07},{-4.741677e-06, 8.240330e-07},{-3.917644e-06, 8.248700e-07},
- {-3.092774e-06, 8.238208e-07},{-2.268953e-06, 8.209051e-07},{-1.448048e-06, 8.161463e-07},{-6.319017e-07, 8.095722e-07},
- { 1.776705e-07, 8.012143e-07},{ 9.788848e-07, 7.911079e-07},{ 1.769993e-06, 7.792922e-07},{ 2.549285e-06, 7.658097e-07},
- { 3.315095e-06, 7.507064e-07},{ 4.065801e-06, 7.340319e-07},{ 4.799833e-06, 7.158385e-07},{ 5.515671e-06, 6.961820e-07},
- { 6.211853e-06, 6.751207e-07},{ 6.886974e-06, 6.527157e-07},{ 7.539690e-06, 6.290309e-07},{ 8.168721e-06, 6.041322e-07},
- { 8.772853e-06, 5.780879e-07},{ 9.350941e-06, 5.509685e-07},{ 9.901909e-06, 5.228459e-07},{ 1.042476e-05, 4.937941e-07},
- { 1.091855e-05, 4.638884e-07},{ 1.138244e-05, 4.332055e-07},{ 1.181564e-05, 4.018230e-07},{ 1.221747e-05, 3.698197e-07},
- { 1.258729e-05, 3.372749e-07},{ 1.292456e-05, 3.042686e-07},{ 1.322883e-05, 2.708811e-07},{ 1.349971e-05, 2.371929e-07},
- { 1.373690e-05, 2.032844e-07},{ 1.394019e-05, 1.692360e-07},{ 1.410942e-05, 1.351273e-07},{ 1.424455e-05, 1.010378e-07},
- { 1.434559e-05, 6.704603e-08},{ 1.441264e-05, 3.322953e-08},{ 1.444586e-05,-3.351466e-10},{ 1.444553e-05,-3.357273e-08},
- { 1.441196e-05,-6.640941e-08},{ 1.434555e-05,-9.877293e-08},{ 1.424677e-05,-1.305928e-07},{ 1.411618e-05,-1.618004e-07},
- { 1.395438e-05,-1.923292e-07},{ 1.376205e-05,-2.221148e-07},{ 1.353994e-05,-2.510950e-07},{ 1.328884e-05,-2.792102e-07},
- { 1.300963e-05,-3.064033e-07},{ 1.270323e-05,-3.326198e-07},{ 1.237061e-05,-3.578080e-07},{ 1.201280e-05,-3.819190e-07},
- { 1.163088e-05,-4.049070e-07},{ 1.122598e-05,-4.267290e-07},{ 1.079925e-05,-4.473453e-07},{ 1.035190e-05,-4.667192e-07},
- { 9.885181e-06,-4.848174e-07},{ 9.400364e-06,-5.016098e-07},{ 8.898754e-06,-5.170695e-07},{ 8.381685e-06,-5.311731e-07},
- { 7.850512e-06,-5.439006e-07},{ 7.306611e-06,-5.552353e-07},{ 6.751376e-06,-5.651639e-07},{ 6.186212e-06,-5.736766e-07},
- { 5.612535e-06,-5.807669e-07},{ 5.031768e-06,-5.864318e-07},{ 4.445337e-06,-5.906717e-07},{ 3.854665e-06,-5.934900e-07},
- { 3.261175e-06,-5.948938e-07},{ 2.666281e-06,-5.948933e-07},{ 2.071388e-06,-5.935019e-07},{ 1.477886e-06,-5.907361e-07},
- { 8.871497e-07,-5.866155e-07},{ 3.005343e-07,-5.811627e-07},{-2.806285e-07,-5.744034e-07},{-8.550318e-07,-5.663658e-07},
- {-1.421398e-06,-5.570812e-07},{-1.978479e-06,-5.465833e-07},{-2.525062e-06,-5.349084e-07},{-3.059971e-06,-5.220954e-07},
- {-3.582066e-06,-5.081854e-07},{-4.090251e-06,-4.932216e-07},{-4.583473e-06,-4.772495e-07},{-5.060722e-06,-4.603164e-07},
- {-5.521039e-06,-4.424716e-07},{-5.963510e-06,-4.237659e-07},{-6.387276e-06,-4.042520e-07},{-6.791528e-06,-3.839835e-07},
- {-7.175512e-06,-3.630159e-07},{-7.538528e-06,-3.414053e-07},{-7.879933e-06,-3.192092e-07},{-8.199142e-06,-2.964858e-07},
- {-8.495628e-06,-2.732939e-07},{-8.768922e-06,-2.496932e-07},{-9.018615e-06,-2.257434e-07},{-9.244359e-06,-2.015047e-07},
- {-9.445863e-06,-1.770376e-07},{-9.622901e-06,-1.524022e-07},{-9.775303e-06,-1.276588e-07},{-9.902962e-06,-1.028672e-07},
- {-1.000583e-05,-7.808677e-08},{-1.008392e-05,-5.337636e-08},{-1.013729e-05,-2.879409e-08},{-1.016609e-05,-4.397233e-09},
- {-1.017048e-05, 1.975790e-08},{-1.015073e-05, 4.361611e-08},{-1.010711e-05, 6.712342e-08},{-1.003999e-05, 9.022719e-08},
- {-9.949759e-06, 1.128762e-07},{-9.836883e-06, 1.350210e-07},{-9.701862e-06, 1.566134e-07},{-9.545248e-06, 1.776074e-07},
- {-9.367641e-06, 1.979586e-07},{-9.169682e-06, 2.176247e-07},{-8.952058e-06, 2.365654e-07},{-8.715492e-06, 2.547424e-07},
- {-8.460750e-06, 2.721199e-07},{-8.188630e-06, 2.886640e-07},{-7.899966e-06, 3.043433e-07},{-7.595623e-06, 3.191288e-07},
- {-7.276494e-06, 3.329938e-07},{-6.943500e-06, 3.459143e-07},{-6.597586e-06, 3.578685e-07},{-6.239717e-06, 3.688373e-07},
- {-5.870880e-06, 3.788043e-07},{-5.492076e-06, 3.877554e-07},{-5.104320e-06, 3.956792e-07},{-4.708641e-06, 4.025669e-07},
- {-4.306074e-06, 4.084123e-07},{-3.897662e-06, 4.132118e-07},{-3.484450e-06, 4.169643e-07},{-3.067486e-06, 4.196712e-07},
- {-2.647815e-06, 4.213367e-07},{-2.226478e-06, 4.219671e-07},{-1.804511e-06, 4.215715e-07},{-1.382940e-06, 4.201611e-07},
- {-9.627785e-07, 4.177497e-07},{-5.450288e-07, 4.143532e-07},{-1.306757e-07, 4.099899e-07},{ 2.793142e-07, 4.046802e-07},
- { 6.839943e-07, 3.984466e-07},{ 1.082441e-06, 3.913138e-07},{ 1.473755e-06, 3.833082e-07},{ 1.857063e-06, 3.744582e-07},
- { 2.231521e-06, 3.647940e-07},{ 2.596315e-06, 3.543475e-07},{ 2.950663e-06, 3.431523e-07},{ 3.293815e-06, 3.312432e-07},
- { 3.625058e-06, 3.186567e-07},{ 3.943715e-06, 3.054305e-07},{ 4.249145e-06, 2.916036e-07},{ 4.540749e-06, 2.772159e-07},
- { 4.817965e-06, 2.623085e-07},{ 5.080273e-06, 2.469233e-07},{ 5.327197e-06, 2.311028e-07},{ 5.558299e-06, 2.148905e-07},
- { 5.773190e-06, 1.983302e-07},{ 5.971520e-06, 1.814661e-07},{ 6.152986e-06, 1.643428e-07},{ 6.317329e-06, 1.470052e-07},
- { 6.464334e-06, 1.294981e-07},{ 6.593832e-06, 1.118664e-07},{ 6.705699e-06, 9.415479e-08},{ 6.799853e-06, 7.640783e-08},
- { 6.876261e-06, 5.866963e-08},{ 6.934931e-06, 4.098390e-08},{ 6.975915e-06, 2.339377e-08},{ 6.999309e-06, 5.941721e-09},
- { 7.005250e-06,-1.133054e-08},{ 6.993920e-06,-2.838215e-08},{ 6.965538e-06,-4.517320e-08},{ 6.920364e-06,-6.166484e-08},
- { 6.858700e-06,-7.781931e-08},{ 6.780880e-06,-9.360010e-08},{ 6.687280e-06,-1.089720e-07},{ 6.578308e-06,-1.239010e-07},
- { 6.454407e-06,-1.383549e-07},{ 6.316052e-06,-1.523026e-07},{ 6.163750e-06,-1.657147e-07},{ 5.998035e-06,-1.785637e-07},
- { 5.819471e-06,-1.908233e-07},{ 5.628648e-06,-2.024694e-07},{ 5.426179e-06,-2.134793e-07},{ 5.212699e-06,-2.238323e-07},
- { 4.988867e-06,-2.335096e-07},{ 4.755358e-06,-2.424942e-07},{ 4.512863e-06,-2.507709e-07},{ 4.262092e-06,-2.583267e-07},
- { 4.003766e-06,-2.651503e-07},{ 3.738615e-06,-2.712325e-07},{ 3.467383e-06,-2.765660e-07},{ 3.190817e-06,-2.811454e-07},
- { 2.909671e-06,-2.849673e-07},{ 2.624704e-06,-2.880304e-07},{ 2.336674e-06,-2.903350e-07},{ 2.046339e-06,-2.918836e-07},
- { 1.754455e-06,-2.926805e-07},{ 1.461775e-06,-2.927319e-07},{ 1.169043e-06,-2.920456e-07},{ 8.769972e-07,-2.906314e-07},
- { 5.863657e-07,-2.885009e-07},{ 2.978648e-07,-2.856673e-07},{ 1.219747e-08,-2.821454e-07},{-2.699479e-07,-2.779516e-07},
- {-5.478996e-07,-2.731040e-07},{-8.210036e-07,-2.676220e-07},{-1.088626e-06,-2.615265e-07},{-1.350152e-06,-2.548397e-07},
- {-1.604992e-06,-2.475852e-07},{-1.852577e-06,-2.397876e-07},{-2.092365e-06,-2.314728e-07},{-2.323837e-06,-2.226678e-07},
- {-2.546505e-06,-2.134004e-07},{-2.759906e-06,-2.036994e-07},{-2.963605e-06,-1.935944e-07},{-3.157200e-06,-1.831158e-07},
- {-3.340315e-06,-1.722946e-07},{-3.512610e-06,-1.611622e-07},{-3.673772e-06,-1.497508e-07},{-3.823523e-06,-1.380926e-07},
- {-3.961616e-06,-1.262205e-07},{-4.087836e-06,-1.141673e-07},{-4.202003e-06,-1.019661e-07},{-4.303969e-06,-8.964999e-08},
- {-4.393619e-06,-7.725199e-08},{-4.470871e-06,-6.480501e-08},{-4.535676e-06,-5.234176e-08},{-4.588018e-06,-3.989462e-08},
- {-4.627913e-06,-2.749562e-08},{-4.655408e-06,-1.517632e-08},{-4.670585e-06,-2.967728e-09},{-4.673552e-06, 9.099735e-09},
- {-4.664453e-06, 2.099635e-08},{-4.643456e-06, 3.269314e-08},{-4.610763e-06, 4.416197e-08},{-4.566601e-06, 5.537559e-08},
- {-4.511226e-06, 6.630771e-08},{-4.444918e-06, 7.693302e-08},{-4.367985e-06, 8.722734e-08},{-4.280758e-06, 9.716756e-08},
- {-4.183590e-06, 1.067318e-07},{-4.076858e-06, 1.158993e-07},{-3.960959e-06, 1.246506e-07},{-3.836308e-06, 1.329677e-07},
- {-3.703341e-06, 1.408338e-07},{-3.562507e-06, 1.482333e-07},{-3.414274e-06, 1.551523e-07},{-3.259121e-06, 1.615781e-07},
- {-3.097543e-06, 1.674996e-07},{-2.930044e-06, 1.729070e-07},{-2.757136e-06, 1.777921e-07},{-2.579344e-06, 1.821481e-07},
- {-2.397196e-06, 1.859696e-07},{-2.211227e-06, 1.892528e-07},{-2.021974e-06, 1.919953e-07},{-1.829979e-06, 1.941962e-07},
- {-1.635782e-06, 1.958560e-07},{-1.439926e-06, 1.969768e-07},{-1.242950e-06, 1.975618e-07},{-1.045388e-06, 1.976158e-07},
- {-8.477720e-07, 1.971451e-07},{-6.506269e-07, 1.961570e-07},{-4.544699e-07, 1.946604e-07},{-2.598095e-07, 1.926654e-07},
- {-6.714413e-08, 1.901831e-07},{ 1.230390e-07, 1.872261e-07},{ 3.102651e-07, 1.838080e-07},{ 4.940731e-07, 1.799434e-07},
- { 6.740165e-07, 1.756481e-07},{ 8.496646e-07, 1.709388e-07},{ 1.020603e-06, 1.658331e-07},{ 1.186436e-06, 1.603496e-07},
- { 1.346786e-06, 1.545076e-07},{ 1.501294e-06, 1.483272e-07},{ 1.649621e-06, 1.418293e-07},{ 1.791450e-06, 1.350351e-07},
- { 1.926485e-06, 1.279668e-07},{ 2.054452e-06, 1.206467e-07},{ 2.175099e-06, 1.130979e-07},{ 2.288197e-06, 1.053435e-07},
- { 2.393540e-06, 9.740725e-08},{ 2.490947e-06, 8.931288e-08},{ 2.580260e-06, 8.108437e-08},{ 2.661345e-06, 7.274581e-08},
- { 2.734090e-06, 6.432130e-08},{ 2.798412e-06, 5.583489e-08},{ 2.854247e-06, 4.731056e-08},{ 2.901557e-06, 3.877209e-08},
- { 2.940329e-06, 3.024305e-08},{ 2.970572e-06, 2.174669e-08},{ 2.992319e-06, 1.330594e-08},{ 3.005625e-06, 4.943291e-09},
- { 3.010568e-06,-3.319235e-09},{ 3.007249e-06,-1.146014e-08},{ 2.995789e-06,-1.945850e-08},{ 2.976330e-06,-2.729404e-08},
- { 2.949036e-06,-3.494716e-08},{ 2.914089e-06,-4.239899e-08},{ 2.871690e-06,-4.963142e-08},{ 2.822059e-06,-5.662718e-08},
- { 2.765432e-06,-6.336985e-08},{ 2.702062e-06,-6.984389e-08},{ 2.632218e-06,-7.603471e-08},{ 2.556183e-06,-8.192865e-08},
- { 2.474254e-06,-8.751306e-08},{ 2.386741e-06,-9.277632e-08},{ 2.293965e-06,-9.770780e-08},{ 2.196257e-06,-1.022980e-07},
- { 2.093959e-06,-1.065383e-07},{ 1.987421e-06,-1.104215e-07},{ 1.876999e-06,-1.139413e-07},{ 1.763058e-06,-1.170923e-07},
- { 1.645966e-06,-1.198706e-07},{ 1.526095e-06,-1.222730e-07},{ 1.403822e-06,-1.242978e-07},{ 1.279524e-06,-1.259441e-07},
- { 1.153580e-06,-1.272122e-07},{ 1.026368e-06,-1.281033e-07},{ 8.982648e-07,-1.286200e-07},{ 7.696448e-07,-1.287656e-07},
- { 6.408792e-07,-1.285447e-07},{ 5.123345e-07,-1.279626e-07},{ 3.843719e-07,-1.270257e-07},{ 2.573462e-07,-1.257415e-07},
- { 1.316048e-07,-1.241181e-07},{ 7.486614e-09,-1.221648e-07},{-1.146782e-07,-1.198915e-07},{-2.345696e-07,-1.173089e-07},
- {-3.518785e-07,-1.144286e-07},{-4.663071e-07,-1.112628e-07},{-5.775699e-07,-1.078245e-07},{-6.853944e-07,-1.041272e-07},
- {-7.895216e-07,-1.001852e-07},{-8.897068e-07,-9.601294e-08},{-9.857197e-07,-9.162575e-08},{-1.077345e-06,-8.703921e-08},
- {-1.164385e-06,-8.226933e-08},{-1.246654e-06,-7.733244e-08},{-1.323986e-06,-7.224519e-08},{-1.396232e-06,-6.702445e-08},
- {-1.463256e-06,-6.168728e-08},{-1.524943e-06,-5.625088e-08},{-1.581194e-06,-5.073251e-08},{-1.631927e-06,-4.514949e-08},
- {-1.677076e-06,-3.951910e-08},{-1.716595e-06,-3.385858e-08},{-1.750454e-06,-2.818500e-08},{-1.778639e-06,-2.251530e-08},
- {-1.801154e-06,-1.686619e-08},{-1.818020e-06,-1.125411e-08},{-1.829275e-06,-5.695183e-09},{-1.834970e-06,-2.051878e-10},
- {-1.835175e-06, 5.200511e-09},{-1.829974e-06, 1.050699e-08},{-1.819467e-06, 1.569981e-08},{-1.803768e-06, 2.076505e-08},
- {-1.783003e-06, 2.568936e-08},{-1.757313e-06, 3.045998e-08},{-1.726853e-06, 3.506475e-08},{-1.691788e-06, 3.949219e-08},
- {-1.652296e-06, 4.373149e-08},{-1.608565e-06, 4.777252e-08},{-1.560792e-06, 5.160590e-08},{-1.509186e-06, 5.522299e-08},
- {-1.453963e-06, 5.861594e-08},{-1.395347e-06, 6.177767e-08},{-1.333570e-06, 6.470187e-08},{-1.268868e-06, 6.738307e-08},
- {-1.201485e-06, 6.981659e-08},{-1.131668e-06, 7.199860e-08},{-1.059670e-06, 7.392605e-08},{-9.857436e-07, 7.559674e-08},
- {-9.101468e-07, 7.700927e-08},{-8.331376e-07, 7.816308e-08},{-7.549745e-07, 7.905840e-08},{-6.759161e-07, 7.969624e-08},
- {-5.962199e-07, 8.007843e-08},{-5.161414e-07, 8.020755e-08},{-4.359339e-07, 8.008694e-08},{-3.558469e-07, 7.972067e-08},
- {-2.761263e-07, 7.911351e-08},{-1.970128e-07, 7.827096e-08},{-1.187418e-07, 7.719914e-08},{-4.154265e-08, 7.590486e-08},
- { 3.436220e-08, 7.439549e-08},{ 1.087577e-07, 7.267901e-08},{ 1.814367e-07, 7.076395e-08},{ 2.522006e-07, 6.865934e-08},
- { 3.208600e-07, 6.637472e-08},{ 3.872347e-07, 6.392005e-08},{ 4.511548e-07, 6.130571e-08},{ 5.124605e-07, 5.854246e-08},
- { 5.710029e-07, 5.564137e-08},{ 6.266443e-07, 5.261383e-08},{ 6.792581e-07, 4.947146e-08},{ 7.287296e-07, 4.622613e-08},
- { 7.749557e-07, 4.288983e-08},{ 8.178456e-07, 3.947473e-08},{ 8.573203e-07, 3.599304e-08},{ 8.933133e-07, 3.245707e-08},
- { 9.257704e-07, 2.887909e-08},{ 9.546495e-07, 2.527136e-08},{ 9.799208e-07, 2.164606e-08},{ 1.001567e-06, 1.801526e-08},
- { 1.019582e-06, 1.439087e-08},{ 1.033973e-06, 1.078463e-08},{ 1.044758e-06, 7.208032e-09},{ 1.051966e-06, 3.672342e-09},
- { 1.055638e-06, 1.885272e-10},{ 1.055827e-06,-3.232765e-09},{ 1.052594e-06,-6.581243e-09},{ 1.046013e-06,-9.847006e-09},
- { 1.036166e-06,-1.302057e-08},{ 1.023145e-06,-1.609289e-08},{ 1.007052e-06,-1.905538e-08},{ 9.879967e-07,-2.189995e-08},
- { 9.660968e-07,-2.461900e-08},{ 9.414778e-07,-2.720549e-08},{ 9.142723e-07,-2.965291e-08},{ 8.846194e-07,-3.195530e-08},
- { 8.526641e-07,-3.410728e-08},{ 8.185568e-07,-3.610408e-08},{ 7.824527e-07,-3.794149e-08},{ 7.445112e-07,-3.961591e-08},
- { 7.048953e-07,-4.112437e-08},{ 6.637709e-07,-4.246448e-08},{ 6.213065e-07,-4.363447e-08},{ 5.776720e-07,-4.463320e-08},
- { 5.330388e-07,-4.546010e-08},{ 4.875787e-07,-4.611522e-08},{ 4.414635e-07,-4.659921e-08},{ 3.948643e-07,-4.691329e-08},
- { 3.479510e-07,-4.705926e-08},{ 3.008917e-07,-4.703948e-08},{ 2.538522e-07,-4.685685e-08},{ 2.069954e-07,-4.651481e-08},
- { 1.604806e-07,-4.601728e-08},{ 1.144633e-07,-4.536872e-08},{ 6.909458e-08,-4.457401e-08},{ 2.452057e-08,-4.363850e-08},
- {-1.911792e-08,-4.256795e-08},{-6.168587e-08,-4.136853e-08},{-1.030544e-07,-4.004676e-08},{-1.431012e-07,-3.860951e-08},
- {-1.817107e-07,-3.706394e-08},{-2.187746e-07,-3.541753e-08},{-2.541921e-07,-3.367796e-08},{-2.878701e-07,-3.185317e-08},
- {-3.197233e-07,-2.995126e-08},{-3.496745e-07,-2.798048e-08},{-3.776550e-07,-2.594923e-08},{-4.036042e-07,-2.386597e-08},
- {-4.274702e-07,-2.173924e-08},{-4.492095e-07,-1.957761e-08},{-4.687871e-07,-1.738964e-08},{-4.861767e-07,-1.518387e-08},
- {-5.013606e-07,-1.296879e-08},{-5.143294e-07,-1.075279e-08},{-5.250822e-07,-8.544140e-09},{-5.336263e-07,-6.350940e-09},
- {-5.399772e-07,-4.181117e-09},{-5.441584e-07,-2.042392e-09},{-5.462007e-07, 5.774758e-11},{-5.461430e-07, 2.112073e-09},
- {-5.440309e-07, 4.113644e-09},{-5.399173e-07, 6.055821e-09},{-5.338615e-07, 7.932292e-09},{-5.259292e-07, 9.737094e-09},
- {-5.161921e-07, 1.146463e-08},{-5.047275e-07, 1.310968e-08},{-4.916178e-07, 1.466742e-08},{-4.769503e-07, 1.613346e-08},
- {-4.608169e-07, 1.750381e-08},{-4.433131e-07, 1.877492e-08},{-4.245382e-07, 1.994368e-08},{-4.045945e-07, 2.100744e-08},
- {-3.835870e-07, 2.196399e-08},{-3.616231e-07, 2.281160e-08},{-3.388115e-07, 2.354898e-08},{-3.152625e-07, 2.417532e-08},
- {-2.910872e-07, 2.469024e-08},{-2.663969e-07, 2.509383e-08},{-2.413031e-07, 2.538663e-08},{-2.159165e-07, 2.556962e-08},
- {-1.903468e-07, 2.564420e-08},{-1.647026e-07, 2.561221e-08},{-1.390904e-07, 2.547589e-08},{-1.136145e-07, 2.523785e-08},
- {-8.837669e-08, 2.490112e-08},{-6.347557e-08, 2.446906e-08},{-3.900651e-08, 2.394537e-08},{-1.506113e-08, 2.333410e-08},
- { 8.272965e-09, 2.263956e-08},{ 3.091253e-08, 2.186638e-08},{ 5.277891e-08, 2.101942e-08},{ 7.379833e-08, 2.010377e-08},
- { 9.390210e-08, 1.912474e-08},{ 1.130268e-07, 1.808782e-08},{ 1.311147e-07, 1.699865e-08},{ 1.481133e-07, 1.586300e-08},
- { 1.639763e-07, 1.468678e-08},{ 1.786631e-07, 1.347594e-08},{ 1.921390e-07, 1.223652e-08},{ 2.043755e-07, 1.097460e-08},
- { 2.153501e-07, 9.696250e-09},{ 2.250464e-07, 8.407549e-09},{ 2.334539e-07, 7.114496e-09},{ 2.405684e-07, 5.823009e-09},
- { 2.463914e-07, 4.538907e-09},{ 2.509304e-07, 3.267885e-09},{ 2.541982e-07, 2.015490e-09},{ 2.562137e-07, 7.870906e-10},
- { 2.570008e-07,-4.121423e-10},{ 2.565887e-07,-1.577253e-09},{ 2.550114e-07,-2.703522e-09},{ 2.523079e-07,-3.786493e-09},
- { 2.485214e-07,-4.821983e-09},{ 2.436994e-07,-5.806099e-09},{ 2.378933e-07,-6.735257e-09},{ 2.311581e-07,-7.606193e-09},
- { 2.235519e-07,-8.415978e-09},{ 2.151359e-07,-9.162022e-09},{ 2.059739e-07,-9.842093e-09},{ 1.961318e-07,-1.045431e-08},
- { 1.856775e-07,-1.099717e-08},{ 1.746803e-07,-1.146951e-08},{ 1.632108e-07,-1.187058e-08},{ 1.513402e-07,-1.219996e-08},
- { 1.391403e-07,-1.245761e-08},{ 1.266826e-07,-1.264386e-08},{ 1.140388e-07,-1.275940e-08},{ 1.012794e-07,-1.280525e-08},
- { 8.847413e-08,-1.278279e-08},{ 7.569135e-08,-1.269372e-08},{ 6.299763e-08,-1.254006e-08},{ 5.045757e-08,-1.232413e-08},
- { 3.813344e-08,-1.204855e-08},{ 2.608489e-08,-1.171619e-08},{ 1.436870e-08,-1.133017e-08},{ 3.038534e-09,-1.089385e-08},
- {-7.855319e-09,-1.041081e-08},{-1.826613e-08,-9.884798e-09},{-2.815093e-08,-9.319734e-09},{-3.747066e-08,-8.719685e-09},
- {-4.619035e-08,-8.088832e-09},{-5.427918e-08,-7.431457e-09},{-6.171064e-08,-6.751909e-09},{-6.846255e-08,-6.054592e-09},
- {-7.451714e-08,-5.343934e-09},{-7.986107e-08,-4.624372e-09},{-8.448544e-08,-3.900328e-09},{-8.838577e-08,-3.176192e-09},
- {-9.156196e-08,-2.456292e-09},{-9.401826e-08,-1.744855e-09},{-9.576311e-08,-1.045972e-09},{-9.680908e-08,-3.635716e-10},
- {-9.717265e-08, 2.985809e-10},{-9.687407e-08, 9.369009e-10},{-9.593717e-08, 1.548013e-09},{-9.438916e-08, 2.128778e-09},
- {-9.226038e-08, 2.676295e-09},{-8.958409e-08, 3.187921e-09},{-8.639616e-08, 3.661290e-09},{-8.273487e-08, 4.094324e-09},
- {-7.864055e-08, 4.485240e-09},{-7.415531e-08, 4.832558e-09},{-6.932275e-08, 5.135118e-09},{-6.418763e-08, 5.392070e-09},
- {-5.879556e-08, 5.602887e-09},{-5.319268e-08, 5.767363e-09},{-4.742531e-08, 5.885610e-09},{-4.153970e-08, 5.958055e-09},
- {-3.558165e-08, 5.985436e-09},{-2.959621e-08, 5.968793e-09},{-2.362742e-08, 5.909454e-09},{-1.771797e-08, 5.809031e-09},
- {-1.190894e-08, 5.669399e-09},{-6.239536e-09, 5.492681e-09},{-7.468554e-10, 5.281235e-09},{ 4.534380e-09, 5.037627e-09},
- { 9.572007e-09, 4.764617e-09},{ 1.433662e-08, 4.465129e-09},{ 1.880175e-08, 4.142234e-09},{ 2.294399e-08, 3.799119e-09},
- { 2.674311e-08, 3.439066e-09},{ 3.018217e-08, 3.065421e-09},{ 3.324759e-08, 2.681569e-09},{ 3.592916e-08, 2.290905e-09},
- { 3.822007e-08, 1.896810e-09},{ 4.011688e-08, 1.502618e-09},{ 4.161949e-08, 1.111597e-09},{ 4.273109e-08, 7.269150e-10},
- { 4.345801e-08, 3.516227e-10},{ 4.380963e-08,-1.137312e-11},{ 4.379826e-08,-3.593301e-10},{ 4.343893e-08,-6.896892e-10},
- { 4.274924e-08,-1.000090e-09},{ 4.174915e-08,-1.288386e-09},{ 4.046076e-08,-1.552651e-09},{ 3.890811e-08,-1.791187e-09},
- { 3.711692e-08,-2.002554e-09},{ 3.511437e-08,-2.185617e-09},{ 3.292875e-08,-2.339586e-09},{ 3.058917e-08,-2.464004e-09},
- { 2.812516e-08,-2.558707e-09},{ 2.556646e-08,-2.623839e-09},{ 2.294262e-08,-2.659871e-09},{ 2.028275e-08,-2.667575e-09},
- { 1.761517e-08,-2.648010e-09},{ 1.496716e-08,-2.602530e-09},{ 1.236463e-08,-2.532758e-09},{ 9.831872e-09,-2.440559e-09},
- { 7.391313e-09,-2.328035e-09},{ 5.063278e-09,-2.197484e-09},{ 2.865794e-09,-2.051380e-09},{ 8.144143e-10,-1.892342e-09},
- {-1.077927e-09,-1.723093e-09},{-2.801021e-09,-1.546434e-09},{-4.347455e-09,-1.365196e-09},{-5.712650e-09,-1.182202e-09},
- {-6.894853e-09,-1.000233e-09},{-7.895085e-09,-8.219714e-10},{-8.717057e-09,-6.499729e-10},{-9.367029e-09,-4.866129e-10},
- {-9.853642e-09,-3.340489e-10},{-1.018769e-08,-1.941823e-10},{-1.038187e-08,-6.861378e-11},{-1.045049e-08, 4.138179e-11},
- {-1.040911e-08, 1.348983e-10},{-1.027421e-08, 2.114116e-10},{-1.006280e-08, 2.708092e-10},{-9.791986e-09, 3.133954e-10},
- {-9.478591e-09, 3.399024e-10},{-9.138689e-09, 3.514765e-10},{-8.787212e-09, 3.496685e-10},{-8.437544e-09, 3.364000e-10},
- {-8.101144e-09, 3.139222e-10},{-7.787221e-09, 2.847563e-10},{-7.502465e-09, 2.516179e-10},{-7.250847e-09, 2.173213e-10},
- {-7.033526e-09, 1.846658e-10},{-6.848860e-09, 1.562942e-10},{-6.692566e-09, 1.345328e-10},{-6.558033e-09, 1.211999e-10},
- {-6.436833e-09, 1.173885e-10},{-6.319444e-09, 1.232145e-10},{-6.196230e-09, 1.375440e-10},{-6.058686e-09, 1.575662e-10},
- {-5.901120e-09, 1.790834e-10},{-5.722036e-09, 2.002664e-10},{-5.521770e-09, 2.209262e-10},{-5.300844e-09, 2.410449e-10},
- {-5.059799e-09, 2.605764e-10},{-4.799222e-09, 2.794782e-10},{-4.519744e-09, 2.977075e-10},{-4.222037e-09, 3.152236e-10},
- {-3.906813e-09, 3.319882e-10},{-3.574825e-09, 3.479630e-10},{-3.226862e-09, 3.631132e-10},{-2.863749e-09, 3.774054e-10},
- {-2.486343e-09, 3.908078e-10},{-2.095535e-09, 4.032923e-10},{-1.692243e-09, 4.148307e-10},{-1.277412e-09, 4.254000e-10},
- {-8.520123e-10, 4.349774e-10},{-4.170350e-10, 4.170337e-10},{ 0.000000e+00, 0.000000e+00},{ 0.000000e+00, 0.000000e+00},
- { 0.000000e+00, 0.000000e+00}
+ { /* phase 0 */
+  {
+     0.00000000e+00, 1.03407501e-06, 1.39673904e-03, 4.65081409e-02,-6.45961106e-01,-1.15579097e-02,
+     1.90413699e-01,-1.17370702e-01, 1.21620204e-02, 5.32993414e-02,-7.37163723e-02, 6.35381714e-02,
+    -3.87342311e-02, 1.12372199e-02, 1.17335999e-02,-2.68721394e-02, 3.35976295e-02,-3.30408216e-02,
+     2.71770302e-02,-1.82538293e-02, 8.34509544e-03, 8.61113076e-04,-8.21497012e-03, 1.30868899e-02,
+    -1.53483702e-02, 1.52362799e-02,-1.32648498e-02, 1.00640003e-02,-6.30085589e-03, 2.55421805e-03,
+     7.10868102e-04,-3.20844189e-03, 4.79843095e-03,-5.50201489e-03, 5.43178804e-03,-4.78588510e-03,
+     3.77191091e-03,-2.60748412e-03, 1.45953696e-03,-4.65055811e-04,-3.09222611e-04, 8.28025222e-04,
+    -1.10275601e-03, 1.17711304e-03,-1.10708200e-03, 9.47882421e-04,-7.46612728e-04, 5.39223198e-04,
+    -3.49953596e-04, 1.92631196e-04,-7.26011567e-05,-1.08230197e-05, 6.22303487e-05,-8.80873631e-05,
+     9.53868803e-05,-9.05385386e-05, 7.89129335e-05,-6.45032123e-05, 5.00639399e-05,-3.71753304e-05,
+     2.66096395e-05,-1.84794808e-05, 1.25872903e-05,-8.49562821e-06, 5.77318997e-06,-3.96161613e-06,
+     2.73409000e-06,-1.80115399e-06, 1.03616605e-06,-3.83587007e-07,-7.85531906e-09, 2.81251609e-08
+  },
+  {
+     0.00000000e+00, 2.16233602e-07, 1.03971397e-04, 1.94917805e-03, 8.28845520e-03, 8.99899658e-03,
+    -3.38574708e-03,-2.43826397e-03, 4.10610205e-03,-3.07387905e-03, 1.15673395e-03, 5.58474625e-04,
+    -1.63197902e-03, 2.01590592e-03,-1.85192295e-03, 1.34460500e-03,-6.91678782e-04, 5.07878503e-05,
+     4.71828098e-04,-8.20144487e-04, 9.80519922e-04,-9.70885681e-04, 8.29287281e-04,-6.03263790e-04,
+     3.40989791e-04,-8.46747280e-05,-1.33617796e-04, 2.93844292e-04,-3.87875189e-04, 4.17877513e-04,
+    -3.93729104e-04, 3.30009410e-04,-2.43048300e-04, 1.48408493e-04,-5.90410891e-05,-1.57889808e-05,
+     7.08339794e-05,-1.04577201e-04, 1.18512900e-04,-1.16200201e-04, 1.02264697e-04,-8.14582017e-05,
+     5.82696302e-05,-3.61623606e-05, 1.73214703e-05,-2.78761809e-06,-7.27135421e-06, 1.32700297e-05,
+    -1.59480205e-05, 1.61663993e-05,-1.47626697e-05, 1.24605403e-05,-9.82544043e-06, 7.25509517e-06,
+    -4.99356202e-06, 3.15897205e-06,-1.77636002e-06, 8.09959090e-07,-1.90837000e-07,-1.61679793e-07,
+     3.25412401e-07,-3.66796513e-07, 3.37274912e-07,-2.73293892e-07, 1.98330198e-07,-1.26220499e-07,
+     6.43212985e-08,-1.68661902e-08,-1.30205704e-08, 2.19639897e-08,-1.04108100e-08,-2.55870702e-09
+  }
+ },
+ { /* phase 1 */
+  {
+     0.00000000e+00, 1.25030897e-06, 1.50071003e-03, 4.84573208e-02,-6.37672722e-01,-2.55891006e-03,
+     1.87027901e-01,-1.19809002e-01, 1.62681304e-02, 5.02254590e-02,-7.25596398e-02, 6.40966520e-02,
+    -4.03662100e-02, 1.32531198e-02, 9.88167617e-03,-2.55275294e-02, 3.29059586e-02,-3.29900384e-02,
+     2.76488606e-02,-1.90739799e-02, 9.32561513e-03,-1.09772598e-04,-7.38568185e-03, 1.24836201e-02,
+    -1.50073804e-02, 1.51516097e-02,-1.33984704e-02, 1.03578502e-02,-6.68873079e-03, 2.97209597e-03,
+     3.17138911e-04,-2.87843309e-03, 4.55538323e-03,-5.35360584e-03, 5.37274685e-03,-4.80167381e-03,
+     3.84274498e-03,-2.71206093e-03, 1.57804997e-03,-5.81255998e-04,-2.06957993e-04, 7.46566919e-04,
+    -1.04448595e-03, 1.14095095e-03,-1.08975999e-03, 9.45094682e-04,-7.53883971e-04, 5.52493322e-04,
+    -3.65901709e-04, 2.08797603e-04,-8.73638419e-05, 1.63752100e-06, 5.24049101e-05,-8.08322729e-05,
+     9.03933105e-05,-8.73795725e-05, 7.71365667e-05,-6.36932600e-05, 4.98730988e-05,-3.73370094e-05,
+     2.69350494e-05,-1.88462709e-05, 1.29245600e-05,-8.76892227e-06, 5.97151984e-06,-4.08783580e-06,
+     2.79841197e-06,-1.81802000e-06, 1.02314505e-06,-3.61623108e-07,-1.82661299e-08, 2.55664592e-08
+  },
+  {
+     0.00000000e+00, 2.53751494e-07, 1.10571898e-04, 2.01379904e-03, 8.39401037e-03, 8.87354184e-03,
+    -3.54637811e-03,-2.27189600e-03, 4.05770307e-03,-3.13120894e-03, 1.26388099e-03, 4.52606502e-04,
+    -1.55846297e-03, 1.98605401e-03,-1.86282594e-03, 1.38533500e-03,-7.48391380e-04, 1.10289897e-04,
+     4.19965305e-04,-7.82655785e-04, 9.60386125e-04,-9.67847416e-04, 8.40678113e-04,-6.24957902e-04,
+     3.68308596e-04,-1.13146401e-04,-1.07706197e-04, 2.73123092e-04,-3.73784511e-04, 4.10739012e-04,
+    -3.92948510e-04, 3.34352109e-04,-2.50936690e-04, 1.58196504e-04,-6.92342583e-05,-6.38343499e-06,
+     6.30319773e-05,-9.88090833e-05, 1.14866700e-04,-1.14498303e-04, 1.02155202e-04,-8.25028983e-05,
+     6.00218482e-05,-3.82293183e-05, 1.93981195e-05,-4.66573010e-06,-5.71055398e-06, 1.20721497e-05,
+    -1.51051599e-05, 1.56363603e-05,-1.44855703e-05, 1.23716300e-05,-9.86400391e-06, 7.36967695e-06,
+    -5.14425210e-06, 3.31749402e-06,-1.92477296e-06, 9.38622577e-07,-2.96185789e-07,-7.92192267e-08,
+     2.63140691e-07,-3.21043103e-07, 3.04268610e-07,-2.49693187e-07, 1.81466106e-07,-1.14167300e-07,
+     5.58348887e-08,-1.12541096e-08,-1.60928906e-08, 2.28115997e-08,-9.88479787e-09,-2.62383892e-09
+  }
+ },
+ { /* phase 2 */
+  {
+     0.00000000e+00, 1.50406004e-06, 1.61128200e-03, 5.04711196e-02,-6.29278719e-01, 6.31463109e-03,
+     1.83481604e-01,-1.22080900e-01, 2.03258302e-02, 4.70942482e-02,-7.12957606e-02, 6.45492524e-02,
+    -4.19246703e-02, 1.52391801e-02, 8.01885035e-03,-2.41422001e-02, 3.21575589e-02,-3.28797512e-02,
+     2.80688293e-02,-1.98566299e-02, 1.02859996e-02,-1.07761996e-03,-6.54500397e-03, 1.18586598e-02,
+    -1.46390703e-02, 1.50384596e-02,-1.35061797e-02, 1.06309699e-02,-7.06251618e-03, 3.38283507e-03,
+    -7.58095630e-05,-2.54408107e-03, 4.30444721e-03,-5.19540999e-03, 5.30351279e-03,-4.80805710e-03,
+     3.90577689e-03,-2.81087006e-03, 1.69291697e-03,-6.95754308e-04,-1.04802697e-04, 6.64064079e-04,
+    -9.84464190e-04, 1.10272202e-03,-1.07036205e-03, 9.40428989e-04,-7.59594608e-04, 5.64565416e-04,
+    -3.81006801e-04, 2.24433898e-04,-1.01849400e-04, 1.40091497e-05, 4.25409016e-05,-7.34625864e-05,
+     8.52490630e-05,-8.40620705e-05, 7.52117921e-05,-6.27546324e-05, 4.95769091e-05,-3.74162300e-05,
+     2.71981899e-05,-1.91673207e-05, 1.32288296e-05,-9.01861495e-06, 6.15298586e-06,-4.20200286e-06,
+     2.85424699e-06,-1.82927499e-06, 1.00705199e-06,-3.38811503e-07,-2.81509305e-08, 2.29426202e-08
+  },
+  {
+     0.00000000e+00, 2.96567492e-07, 1.17516800e-04, 2.07985309e-03, 8.49827193e-03, 8.74365494e-03,
+    -3.70249292e-03,-2.10378296e-03, 4.00409102e-03,-3.18372110e-03, 1.36864802e-03, 3.46404588e-04,
+    -1.48261595e-03, 1.95292104e-03,-1.87046500e-03, 1.42350094e-03,-8.03601171e-04, 1.69422201e-04,
+     3.67483095e-04,-7.43833079e-04, 9.38530313e-04,-9.63014318e-04, 8.50461423e-04,-6.45412481e-04,
+     3.94850213e-04,-1.41317098e-04,-8.16700776e-05, 2.51946592e-04,-3.59024212e-04, 4.02835896e-04,
+    -3.91414011e-04, 3.38033686e-04,-2.58310087e-04, 1.67639795e-04,-7.92520077e-05, 2.99546105e-06,
+     5.51405283e-05,-9.28734080e-05, 1.11012203e-04,-1.12579502e-04, 1.01845100e-04,-8.33790327e-05,
+     6.16455000e-05,-4.02086298e-05, 2.14241099e-05,-6.52345079e-06,-4.14765191e-06, 1.08572704e-05,
+    -1.42370000e-05, 1.50779397e-05,-1.41807204e-05, 1.22579604e-05,-9.88199008e-06, 7.46819615e-06,
+    -5.28314104e-06, 3.46788397e-06,-2.06798495e-06, 1.06427103e-06,-4.00037294e-07, 2.71624701e-09,
+     2.00835203e-07,-2.74987713e-07, 2.70881088e-07,-2.25743406e-07, 1.64342794e-07,-1.01966101e-07,
+     4.73105608e-08,-5.69518299e-09,-1.90553795e-08, 2.35489797e-08,-9.31973432e-09,-2.65987099e-09
+  }
+ },
+ { /* phase 3 */
+  {
+     0.00000000e+00, 1.80062796e-06, 1.72879896e-03, 5.25509790e-02,-6.20780408e-01, 1.50582902e-02,
+     1.79779097e-01,-1.24184698e-01, 2.43299194e-02, 4.39105295e-02,-6.99271113e-02, 6.48956597e-02,
+    -4.34072800e-02, 1.71920992e-02, 6.14838488e-03,-2.27186903e-02, 3.13539617e-02,-3.27103212e-02,
+     2.84363106e-02,-2.06004698e-02, 1.12245297e-02,-2.04063393e-03,-5.69454301e-03, 1.12132505e-02,
+    -1.42442202e-02, 1.48971397e-02,-1.35878501e-02, 1.08829103e-02,-7.42154010e-03, 3.78567097e-03,
+    -4.67223494e-04,-2.20604707e-03, 4.04613605e-03,-5.02777006e-03, 5.22426097e-03,-4.80506197e-03,
+     3.96091817e-03,-2.90374411e-03, 1.80392899e-03,-8.08333803e-04,-2.95763607e-06, 5.80684980e-04,
+    -9.22818726e-04, 1.06251298e-03,-1.04893802e-03, 9.33905598e-04,-7.63742195e-04, 5.75422717e-04,
+    -3.95243813e-04, 2.39511894e-04,-1.16030104e-04, 2.62671092e-05, 3.26589106e-05,-6.59943980e-05,
+     7.99659174e-05,-8.05941891e-05, 7.31438122e-05,-6.16903635e-05, 4.91768806e-05,-3.74135088e-05,
+     2.73990299e-05,-1.94422992e-05, 1.34997099e-05,-9.24435881e-06, 6.31732883e-06,-4.30396904e-06,
+     2.90155708e-06,-1.83497002e-06, 9.87996714e-07,-3.15262497e-07,-3.74706595e-08, 2.02827497e-08
+  },
+  {
+     0.00000000e+00, 3.45276391e-07, 1.24819897e-04, 2.14734394e-03, 8.60115141e-03, 8.60938895e-03,
+    -3.85395903e-03,-1.93412800e-03, 3.94535717e-03,-3.23135802e-03, 1.47088000e-03, 2.40040099e-04,
+    -1.40457205e-03, 1.91657501e-03,-1.87483395e-03, 1.45904196e-03,-8.57213628e-04, 2.28079094e-04,
+     3.14478792e-04,-7.03751517e-04, 9.14997712e-04,-9.56400298e-04, 8.58623302e-04,-6.64592779e-04,
+     4.20566706e-04,-1.69134204e-04,-5.55594997e-05, 2.30356600e-04,-3.43624793e-04, 3.94185889e-04,
+    -3.89131194e-04, 3.41049599e-04,-2.65156210e-04, 1.76721398e-04,-8.90755400e-05, 1.23295304e-05,
+     4.71754502e-05,-8.67825365e-05, 1.06957799e-04,-1.10448702e-04, 1.01335703e-04,-8.40857319e-05,
+     6.31380390e-05,-4.20968099e-05, 2.33956507e-05,-8.35716673e-06,-2.58581190e-06, 9.62795184e-06,
+    -1.33454596e-05, 1.44924597e-05,-1.38489404e-05, 1.21199400e-05,-9.87950443e-06, 7.55056180e-06,
+    -5.41002419e-06, 3.60988702e-06,-2.20573406e-06, 1.18665901e-06,-5.02180114e-07, 8.39525001e-08,
+     1.38633993e-07,-2.28736894e-07, 2.37192907e-07,-2.01504704e-07, 1.47005196e-07,-8.96499870e-08,
+     3.87720895e-08,-2.05187797e-10,-2.18999503e-08, 2.41753195e-08,-8.71968542e-09,-2.66757505e-09
+  }
+ },
+ { /* phase 4 */
+  {
+     0.00000000e+00, 2.14590409e-06, 1.85361900e-03, 5.46983182e-02,-6.12179279e-01, 2.36676708e-02,
+     1.75925106e-01,-1.26118794e-01, 2.82752793e-02, 4.06791717e-02,-6.84562325e-02, 6.51357025e-02,
+    -4.48118597e-02, 1.91086698e-02, 4.27355198e-03,-2.12596506e-02, 3.04967500e-02,-3.24822515e-02,
+     2.87507903e-02,-2.13042200e-02, 1.21395299e-02,-2.99703493e-03,-4.83591994e-03, 1.05486596e-02,
+    -1.38236498e-02, 1.47280097e-02,-1.36434101e-02, 1.11132702e-02,-7.76516506e-03, 4.17985721e-03,
+    -8.56354716e-04,-1.86499802e-03, 3.78097990e-03,-4.85104881e-03, 5.13518602e-03,-4.79273219e-03,
+     4.00809292e-03,-2.99052591e-03, 1.91088696e-03,-9.18782491e-04, 9.83781065e-05, 4.96599299e-04,
+    -8.59680702e-04, 1.02041604e-03,-1.02554297e-03, 9.25548375e-04,-7.66328012e-04, 5.85050613e-04,
+    -4.08589287e-04, 2.54004291e-04,-1.29879103e-04, 3.83870502e-05, 2.27794098e-05,-5.84438312e-05,
+     7.45559009e-05,-7.69843027e-05, 7.09380693e-05,-6.05036985e-05, 4.86747012e-05,-3.73295588e-05,
+     2.75376606e-05,-1.96710407e-05, 1.37368997e-05,-9.44586282e-06, 6.46433409e-06,-4.39361884e-06,
+     2.94032907e-06,-1.83517500e-06, 9.66096763e-07,-2.91087190e-07,-4.61903511e-08, 1.76151698e-08
+  },
+  {
+     0.00000000e+00, 4.00524613e-07, 1.32495101e-04, 2.21627601e-03, 8.70255660e-03, 8.47080164e-03,
+    -4.00064792e-03,-1.76313403e-03, 3.88159696e-03,-3.27406498e-03, 1.57043105e-03, 1.33683905e-04,
+    -1.32446596e-03, 1.87708705e-03,-1.87593501e-03, 1.49190298e-03,-9.09137307e-04, 2.86155788e-04,
+     2.61050503e-04,-6.62487990e-04, 8.89836403e-04,-9.48022585e-04, 8.65153095e-04,-6.82466081e-04,
+     4.45411803e-04,-1.96545894e-04,-2.94244001e-05, 2.08395606e-04,-3.27617890e-04, 3.84808198e-04,
+    -3.86107189e-04, 3.43396212e-04,-2.71463708e-04, 1.85425204e-04,-9.86865198e-05, 2.16007702e-05,
+     3.91526082e-05,-8.05490999e-05, 1.02712402e-04,-1.08110900e-04, 1.00629302e-04,-8.46224793e-05,
+     6.44972024e-05,-4.38905990e-05, 2.53091293e-05,-1.01633304e-05,-1.02817603e-06, 8.38676806e-06,
+    -1.24324997e-05, 1.38812802e-05,-1.34910797e-05, 1.19580000e-05,-9.85669158e-06, 7.61671890e-06,
+    -5.52472511e-06, 3.74326805e-06,-2.33776905e-06, 1.30555304e-06,-6.02408022e-07, 1.64318294e-07,
+     7.66739205e-08,-1.82396406e-07, 2.03284401e-07,-1.77037606e-07, 1.29498105e-07,-7.72519897e-08,
+     3.02430507e-08, 5.20051113e-09,-2.46190002e-08, 2.46902392e-08,-8.08883183e-09,-2.64801003e-09
+  }
+ },
+ { /* phase 5 */
+  {
+     0.00000000e+00, 2.54642896e-06, 1.98611408e-03, 5.69146015e-02,-6.03476703e-01, 3.21384817e-02,
+     1.71924502e-01,-1.27881899e-01, 3.21568809e-02, 3.74050997e-02,-6.68857992e-02, 6.52693808e-02,
+    -4.61363196e-02, 2.09857598e-02, 2.39761593e-03,-1.97677501e-02, 2.95876097e-02,-3.21960896e-02,
+     2.90118400e-02,-2.19667107e-02, 1.30293705e-02,-3.94505681e-03,-3.97076597e-03, 9.86619201e-03,
+    -1.33782402e-02, 1.45314597e-02,-1.36728296e-02, 1.13216704e-02,-8.09278339e-03, 4.56466479e-03,
+    -1.24246196e-03,-1.52160099e-03, 3.50951706e-03,-4.66562388e-03, 5.03649889e-03,-4.77113202e-03,
+     4.04724618e-03,-3.07107507e-03, 2.01359903e-03,-1.02689303e-03, 1.99007394e-04, 4.11976798e-04,
+    -7.95183529e-04, 9.76525713e-04,-1.00023299e-03, 9.15385084e-04,-7.67356192e-04, 5.93437406e-04,
+    -4.21021803e-04, 2.67885596e-04,-1.43370096e-04, 5.03450501e-05, 1.29227201e-05,-5.08271114e-05,
+     6.90311717e-05,-7.32410335e-05, 6.86003114e-05,-5.91981516e-05, 4.80722883e-05,-3.71652386e-05,
+     2.76143292e-05,-1.98534399e-05, 1.39401900e-05,-9.62290142e-06, 6.59383204e-06,-4.47087086e-06,
+     2.97057204e-06,-1.82997405e-06, 9.41477822e-07,-2.66396910e-07,-5.42791803e-08, 1.49671600e-08
+  },
+  {
+     0.00000000e+00, 4.63012896e-07, 1.40556906e-04, 2.28665303e-03, 8.80239904e-03, 8.32795631e-03,
+    -4.14243620e-03,-1.59100594e-03, 3.81291308e-03,-3.31180007e-03, 1.66715495e-03, 2.75063194e-05,
+    -1.24243798e-03, 1.83453294e-03,-1.87377702e-03, 1.52203301e-03,-9.59284196e-04, 3.43549094e-04,
+     2.07296893e-04,-6.20121777e-04, 8.63097375e-04,-9.37901612e-04, 8.70043121e-04,-6.99002587e-04,
+     4.69341088e-04,-2.23501396e-04,-3.31462707e-06, 1.86106903e-04,-3.11036187e-04, 3.74723313e-04,
+    -3.82350292e-04, 3.45071487e-04,-2.77222309e-04, 1.93735701e-04,-1.08067099e-04, 3.07913397e-05,
+     3.10879404e-05,-7.41859330e-05, 9.82852798e-05,-1.05571897e-04, 9.97279712e-05,-8.49890785e-05,
+     6.57209894e-05,-4.55869485e-05, 2.71610297e-05,-1.19384804e-05, 5.22140795e-07, 7.13630197e-06,
+    -1.15001003e-05, 1.32458099e-05,-1.31080396e-05, 1.17726404e-05,-9.81374342e-06, 7.66664289e-06,
+    -5.62709420e-06, 3.86781221e-06,-2.46385707e-06, 1.42072702e-06,-7.00520900e-07, 2.43645701e-07,
+     1.50899293e-08,-1.36071705e-07, 1.69236003e-07,-1.52402194e-07, 1.11866399e-07,-6.48050076e-08,
+     2.17466898e-08, 1.05069899e-08,-2.72054894e-08, 2.50938292e-08,-7.43145678e-09,-2.60252997e-09
+  }
+ },
+ { /* phase 6 */
+  {
+     0.00000000e+00, 3.00944203e-06, 2.12667091e-03, 5.92012517e-02,-5.94674289e-01, 4.04664315e-02,
+     1.67781994e-01,-1.29473001e-01, 3.59697901e-02, 3.40933017e-02,-6.52186424e-02, 6.52968884e-02,
+    -4.73787598e-02, 2.28202902e-02, 5.23839321e-04,-1.82457194e-02, 2.86283307e-02,-3.18525396e-02,
+     2.92191394e-02,-2.25868300e-02, 1.38924597e-02,-4.88295918e-03,-3.10072303e-03, 9.16718878e-03,
+    -1.29089002e-02, 1.43079599e-02,-1.36761498e-02, 1.15077700e-02,-8.40381905e-03, 4.93938802e-03,
+    -1.62481202e-03,-1.17653003e-03, 3.23229400e-03,-4.47188783e-03, 4.92843194e-03,-4.74034017e-03,
+     4.07833420e-03,-3.14526097e-03, 2.11188407e-03,-1.13246497e-03, 2.98735307e-04, 3.26987705e-04,
+    -7.29462481e-04, 9.30938695e-04,-9.73072427e-04, 9.03446577e-04,-7.66834128e-04, 6.00573723e-04,
+    -4.32521891e-04, 2.81131390e-04,-1.56478200e-04, 6.21176878e-05, 3.10897303e-06,-4.31604713e-05,
+     6.34040771e-05,-6.93732218e-05, 6.61364465e-05,-5.77774190e-05, 4.73717701e-05,-3.69215886e-05,
+     2.76294195e-05,-1.99895094e-05, 1.41094197e-05,-9.77530271e-06, 6.70569898e-06,-4.53567600e-06,
+     2.99231897e-06,-1.81946700e-06, 9.14272277e-07,-2.41303098e-07,-6.17106366e-08, 1.23646302e-08
+  },
+  {
+     0.00000000e+00, 5.33500327e-07, 1.49019907e-04, 2.35847593e-03, 8.90058558e-03, 8.18091817e-03,
+    -4.27920092e-03,-1.41795003e-03, 3.73941404e-03,-3.34452302e-03, 1.76091399e-03,-7.83228315e-05,
+    -1.15862803e-03, 1.78899302e-03,-1.86837104e-03, 1.54938805e-03,-1.00756902e-03, 4.00156889e-04,
+     1.53316898e-04,-5.76733786e-04, 8.34834587e-04,-9.26061126e-04, 8.73288605e-04,-7.14174879e-04,
+     4.92312072e-04,-2.49950914e-04, 2.27201308e-05, 1.63534103e-04,-2.93913414e-04, 3.63952888e-04,
+    -3.77870310e-04, 3.46074696e-04,-2.82422901e-04, 2.01638206e-04,-1.17199903e-04, 3.98836601e-05,
+     2.29973793e-05,-6.77060816e-05, 9.36859287e-05,-1.02837497e-04, 9.86346422e-05,-8.51856967e-05,
+     6.68077118e-05,-4.71830099e-05, 2.89479904e-05,-1.36792296e-05, 2.06205596e-06, 5.87914110e-06,
+    -1.05502904e-05, 1.25875104e-05,-1.27007597e-05, 1.15644098e-05,-9.75088278e-06, 7.70034694e-06,
+    -5.71700593e-06, 3.98332213e-06,-2.58377599e-06, 1.53196299e-06,-7.96324400e-07, 3.21770386e-07,
+    -4.59848692e-08,-8.98669867e-08, 1.35127294e-07,-1.27658794e-07, 9.41547924e-08,-5.23417611e-08,
+     1.33059403e-08, 1.56998095e-08,-2.96529095e-08, 2.53866297e-08,-6.75190881e-09,-2.53275800e-09
+  }
+ },
+ { /* phase 7 */
+  {
+     0.00000000e+00, 3.54294207e-06, 2.27569090e-03, 6.15597218e-02,-5.85773706e-01, 4.86473516e-02,
+     1.63502797e-01,-1.30890906e-01, 3.97091992e-02, 3.07487808e-02,-6.34577274e-02, 6.52185604e-02,
+    -4.85373884e-02, 2.46092901e-02,-1.34453201e-03,-1.66963302e-02, 2.76207607e-02,-3.14523801e-02,
+     2.93724500e-02,-2.31635608e-02, 1.47273000e-02,-5.80901979e-03,-2.22743489e-03, 8.45301431e-03,
+    -1.24165900e-02, 1.40580097e-02,-1.36534302e-02, 1.16713103e-02,-8.69773235e-03, 5.30334096e-03,
+    -2.00268207e-03,-8.30455101e-04, 2.94987089e-03,-4.27024998e-03, 4.81123198e-03,-4.70045721e-03,
+     4.10133088e-03,-3.21296696e-03, 2.20557000e-03,-1.23530300e-03, 3.97369993e-04, 2.41802001e-04,
+    -6.62654813e-04, 8.83755682e-04,-9.44124418e-04, 8.89767311e-04,-7.64772005e-04, 6.06452813e-04,
+    -4.43072204e-04, 2.93718913e-04,-1.69178893e-04, 7.36820875e-05,-6.64191111e-06,-3.54601216e-05,
+     5.76870698e-05,-6.53898969e-05, 6.35526667e-05,-5.62454588e-05, 4.65754383e-05,-3.65998203e-05,
+     2.75834409e-05,-2.00793802e-05, 1.42445497e-05,-9.90296212e-06, 6.79985305e-06,-4.58801787e-06,
+     3.00562510e-06,-1.80376799e-06, 8.84619396e-07,-2.15916501e-07,-6.84625476e-08, 9.83187221e-09
+  },
+  {
+     0.00000000e+00, 6.12807128e-07, 1.57899296e-04, 2.43174494e-03, 8.99702590e-03, 8.02975707e-03,
+    -4.41082893e-03,-1.24417304e-03, 3.66121507e-03,-3.37220496e-03, 1.85157196e-03,-1.83634795e-04,
+    -1.07318105e-03, 1.74055505e-03,-1.85973698e-03, 1.57392502e-03,-1.05391198e-03, 4.55879199e-04,
+     9.92096029e-05,-5.32406499e-04, 8.05104384e-04,-9.12527787e-04, 8.74888327e-04,-7.27958279e-04,
+     5.14284009e-04,-2.75845698e-04, 4.86305107e-05, 1.40721095e-04,-2.76283914e-04, 3.52520001e-04,
+    -3.72678391e-04, 3.46406101e-04,-2.87057599e-04, 2.09118996e-04,-1.26068204e-04, 4.88604092e-05,
+     1.48968702e-05,-6.11227515e-05, 8.89242001e-05,-9.99140902e-05, 9.73523784e-05,-8.52128214e-05,
+     6.77559292e-05,-4.86761382e-05, 3.06668117e-05,-1.53822803e-05, 3.58852799e-06, 4.61787204e-06,
+    -9.58510100e-06, 1.19078704e-05,-1.22702604e-05, 1.13338801e-05,-9.66837979e-06, 7.71787563e-06,
+    -5.79436482e-06, 4.08962478e-06,-2.69731891e-06, 1.63905702e-06,-8.89630826e-07, 3.98531910e-07,
+    -1.06419598e-07,-4.38854109e-08, 1.01037799e-07,-1.02867197e-07, 7.64078294e-08,-3.98946192e-08,
+     4.94329111e-09, 2.07650501e-08,-3.19552989e-08, 2.55696193e-08,-6.05459194e-09,-2.44055909e-09
+  }
+ },
+ { /* phase 8 */
+  {
+     0.00000000e+00, 4.15574914e-06, 2.43358989e-03, 6.39914721e-02,-5.76776683e-01, 5.66771105e-02,
+     1.59091994e-01,-1.32135093e-01, 4.33704183e-02, 2.73765791e-02,-6.16061613e-02, 6.50349334e-02,
+    -4.96105701e-02, 2.63498407e-02,-3.20426910e-03,-1.51223997e-02, 2.65668500e-02,-3.09964996e-02,
+     2.94716600e-02,-2.36959700e-02, 1.55324005e-02,-6.72154780e-03,-1.35254604e-03, 7.72505580e-03,
+    -1.19022997e-02, 1.37821697e-02,-1.36048002e-02, 1.18120303e-02,-8.97401571e-03, 5.65586099e-03,
+    -2.37536104e-03,-4.84049000e-04, 2.66281399e-03,-4.06113081e-03, 4.68516396e-03,-4.65159584e-03,
+     4.11622785e-03,-3.27408989e-03, 2.29449500e-03,-1.33521704e-03, 4.94722277e-04, 1.56589202e-04,
+    -5.94898884e-04, 8.35079583e-04,-9.13457596e-04, 8.74385121e-04,-7.61183503e-04, 6.11070718e-04,
+    -4.52657288e-04, 3.05626803e-04,-1.81449199e-04, 8.50159704e-05,-1.63102904e-05,-2.77422496e-05,
+     5.18927118e-05,-6.13002776e-05, 6.08553491e-05,-5.46064002e-05, 4.56858106e-05,-3.62012906e-05,
+     2.74770191e-05,-2.01232597e-05, 1.43455900e-05,-1.00058296e-05, 6.87626107e-06,-4.62791286e-06,
+     3.01056798e-06,-1.78300297e-06, 8.52664073e-07,-1.90346796e-07,-7.45171391e-08, 7.39131290e-09
+  },
+  {
+     0.00000000e+00, 7.01818692e-07, 1.67210499e-04, 2.50646099e-03, 9.09162778e-03, 7.87454937e-03,
+    -4.53720894e-03,-1.06988195e-03, 3.57843889e-03,-3.39482189e-03, 1.93900103e-03,-2.88262294e-04,
+    -9.86244297e-04, 1.68930797e-03,-1.84789801e-03, 1.59561099e-03,-1.09823397e-03, 5.10617625e-04,
+     4.50740990e-05,-4.87223995e-04, 7.73966021e-04,-8.97331687e-04, 8.74843681e-04,-7.40330899e-04,
+     5.35218220e-04,-3.01138207e-04, 7.43675191e-05, 1.17712400e-04,-2.58183194e-04, 3.40448896e-04,
+    -3.66786902e-04, 3.46067711e-04,-2.91119388e-04, 2.16165106e-04,-1.34655798e-04, 5.77045394e-05,
+     6.80227686e-06,-5.44493087e-05, 8.40101711e-05,-9.68083405e-05, 9.58846576e-05,-8.50712604e-05,
+     6.85644991e-05,-5.00639399e-05, 3.23144304e-05,-1.70444200e-05, 5.09855681e-06, 3.35507002e-06,
+    -8.60658565e-06, 1.12083999e-05,-1.18175503e-05, 1.10816700e-05,-9.56654003e-06, 7.71930718e-06,
+    -5.85909993e-06, 4.18656509e-06,-2.80429595e-06, 1.74181196e-06,-9.80259301e-07, 4.73774293e-07,
+    -1.66085897e-07, 1.77125903e-09, 6.70460309e-08,-7.80867708e-08, 5.86696309e-08,-2.74956200e-08,
+    -3.31923511e-09, 2.56893600e-08,-3.41072806e-08, 2.56441997e-08,-5.34393418e-09,-2.32803510e-09
+  }
+ },
+ { /* phase 9 */
+  {
+     0.00000000e+00, 4.85756800e-06, 2.60080094e-03, 6.64979294e-02,-5.67685127e-01, 6.45516589e-02,
+     1.54554799e-01,-1.33204997e-01, 4.69488613e-02, 2.39817500e-02,-5.96671589e-02, 6.47466704e-02,
+    -5.05968109e-02, 2.80391499e-02,-5.05216699e-03,-1.35267898e-02, 2.54686102e-02,-3.04858908e-02,
+     2.95167398e-02,-2.41831895e-02, 1.63063705e-02,-7.61887897e-03,-4.77702793e-04, 6.98472513e-03,
+    -1.13670900e-02, 1.34810302e-02,-1.35304304e-02, 1.19297402e-02,-9.23219882e-03, 5.99631015e-03,
+    -2.74214800e-03,-1.37981304e-04, 2.37169396e-03,-3.84496595e-03, 4.55050822e-03,-4.59389202e-03,
+     4.12303023e-03,-3.32853897e-03, 2.37850496e-03,-1.43202499e-03, 5.90607000e-04, 7.15179413e-05,
+    -5.26334392e-04, 7.85015582e-04,-8.81143205e-04, 8.57340696e-04,-7.56084919e-04, 6.14425808e-04,
+    -4.61263902e-04, 3.16835212e-04,-1.93266795e-04, 9.60976395e-05,-2.58768305e-05,-2.00229406e-05,
+     4.60336014e-05,-5.71137098e-05, 5.80510605e-05,-5.28645905e-05, 4.47055500e-05,-3.57275203e-05,
+     2.73109308e-05,-2.01214898e-05, 1.44126398e-05,-1.00839197e-05, 6.93493121e-06,-4.65540779e-06,
+     3.00724901e-06,-1.75731304e-06, 8.18556828e-07,-1.64702598e-07,-7.98610671e-08, 5.06327780e-09
+  },
+  {
+     0.00000000e+00, 8.01489307e-07, 1.76968999e-04, 2.58262106e-03, 9.18429904e-03, 7.71537283e-03,
+    -4.65823291e-03,-8.95284815e-04, 3.49121098e-03,-3.41236009e-03, 2.02307710e-03,-3.92039103e-04,
+    -8.97965801e-04, 1.63534901e-03,-1.83288497e-03, 1.61441404e-03,-1.14046200e-03, 5.64275775e-04,
+    -8.99070892e-06,-4.41271899e-04, 7.41480908e-04,-8.80505599e-04, 8.73159501e-04,-7.51273299e-04,
+     5.55078092e-04,-3.25782312e-04, 9.98826508e-05, 9.45525680e-05,-2.39647707e-04, 3.27764807e-04,
+    -3.60209786e-04, 3.45062290e-04,-2.94602592e-04, 2.22764604e-04,-1.42947101e-04, 6.63993706e-05,
+    -1.27059900e-06,-4.76992318e-05, 7.89542028e-05,-9.35272183e-05, 9.42352999e-05,-8.47621777e-05,
+     6.92325702e-05,-5.13442210e-05, 3.38879618e-05,-1.86625493e-05, 6.58919680e-06, 2.09330005e-06,
+    -7.61681804e-06, 1.04906603e-05,-1.13437100e-05, 1.08084596e-05,-9.44570729e-06, 7.70475344e-06,
+    -5.91116896e-06, 4.27400892e-06,-2.90452999e-06, 1.84004296e-06,-1.06803600e-06, 5.47345792e-07,
+    -2.24858297e-07, 4.70028816e-08, 3.32295294e-08,-5.33763611e-08, 4.09838989e-08,-1.51763206e-08,
+    -1.14601404e-08, 3.04599794e-08,-3.61040797e-08, 2.56122092e-08,-4.62437200e-09,-2.19748397e-09
+  }
+ },
+ { /* phase 10 */
+  {
+     0.00000000e+00, 5.65905702e-06, 2.77776993e-03, 6.90805465e-02,-5.58500826e-01, 7.22670332e-02,
+     1.49896502e-01,-1.34100199e-01, 5.04400693e-02, 2.05693897e-02,-5.76440804e-02, 6.43546283e-02,
+    -5.14947809e-02, 2.96745002e-02,-6.88505312e-03,-1.19123803e-02, 2.43281499e-02,-2.99216099e-02,
+     2.95077506e-02,-2.46244594e-02, 1.70478504e-02,-8.49938486e-03, 3.95456707e-04, 6.23345189e-03,
+    -1.08120097e-02, 1.31552396e-02,-1.34305498e-02, 1.20242899e-02,-9.47184674e-03, 6.32407516e-03,
+    -3.10235796e-03, 2.07081001e-04, 2.07709195e-03,-3.62220104e-03, 4.40756092e-03,-4.52749198e-03,
+     4.12175991e-03,-3.37623898e-03, 2.45745899e-03,-1.52555201e-03, 6.84842293e-04,-1.32442401e-05,
+    -4.57101793e-04, 7.33671419e-04,-8.47255229e-04, 8.38678097e-04,-7.49495695e-04, 6.16519072e-04,
+    -4.68880695e-04, 3.27325892e-04,-2.04610493e-04, 1.06906104e-04,-3.53225405e-05,-1.23181899e-05,
+     4.01224388e-05,-5.28396995e-05, 5.51465309e-05,-5.10245518e-05, 4.36375194e-05,-3.51801682e-05,
+     2.70860801e-05,-2.00744907e-05, 1.44458600e-05,-1.01372898e-05, 6.97591486e-06,-4.67058499e-06,
+     2.99578892e-06,-1.72685304e-06, 7.82452673e-07,-1.39090403e-07,-8.44854426e-08, 2.86579405e-09
+  },
+  {
+     0.00000000e+00, 9.12845678e-07, 1.87191006e-04, 2.66022189e-03, 9.27494839e-03, 7.55231222e-03,
+    -4.77380119e-03,-7.20590120e-04, 3.39966407e-03,-3.42480908e-03, 2.10368005e-03,-4.94801323e-04,
+    -8.08496319e-04, 1.57877698e-03,-1.81473198e-03, 1.63030904e-03,-1.18052599e-03, 6.16759702e-04,
+    -6.28863199e-05,-3.94636707e-04, 7.07713014e-04,-8.62085319e-04, 8.69843294e-04,-7.60768889e-04,
+     5.73829224e-04,-3.49733105e-04, 1.25128005e-04, 7.12863621e-05,-2.20714195e-04, 3.14494187e-04,
+    -3.52962088e-04, 3.43394495e-04,-2.97502702e-04, 2.28906400e-04,-1.50927095e-04, 7.49285464e-05,
+    -9.30606984e-06,-4.08860797e-05, 7.37668815e-05,-9.00780287e-05, 9.24084598e-05,-8.42870504e-05,
+     6.97595606e-05,-5.25150099e-05, 3.53846590e-05,-2.02336905e-05, 8.05755826e-06, 8.35110086e-07,
+    -6.61787817e-06, 9.75623061e-06,-1.08498498e-05, 1.05149402e-05,-9.30626175e-06, 7.67435631e-06,
+    -5.95055417e-06, 4.35184484e-06,-2.99786211e-06, 1.93357596e-06,-1.15279499e-06, 6.19099922e-07,
+    -2.82614110e-07, 9.17111080e-08,-3.35146605e-10,-2.87940907e-08, 2.33937705e-08,-2.96772806e-09,
+    -1.94585006e-08, 3.50647511e-08,-3.79414899e-08, 2.54758898e-08,-3.90032806e-09,-2.05137995e-09
+  }
+ },
+ { /* phase 11 */
+  {
+     0.00000000e+00, 6.57190321e-06, 2.96496111e-03, 7.17407688e-02,-5.49225807e-01, 7.98193365e-02,
+     1.45122707e-01,-1.34820804e-01, 5.38397282e-02, 1.71445906e-02,-5.55404015e-02, 6.38598278e-02,
+    -5.23032807e-02, 3.12532783e-02,-8.69978406e-03,-1.02820704e-02, 2.31476296e-02,-2.93048508e-02,
+     2.94448603e-02,-2.50190999e-02, 1.77555606e-02,-9.36147012e-03, 1.26529997e-03, 5.47268288e-03,
+    -1.02381799e-02, 1.28055103e-02,-1.33054201e-02, 1.20955799e-02,-9.69256088e-03, 6.63856883e-03,
+    -3.45531991e-03, 5.50475495e-04, 1.77958899e-03,-3.39329499e-03, 4.25663404e-03,-4.45256382e-03,
+     4.11245413e-03,-3.41712497e-03, 2.53122603e-03,-1.61563000e-03, 7.77250796e-04,-9.75312796e-05,
+    -3.87342210e-04, 6.81156409e-04,-8.11870617e-04, 8.18444416e-04,-7.41438183e-04, 6.17354177e-04,
+    -4.75498586e-04, 3.37082107e-04,-2.15460299e-04, 1.17420997e-04,-4.46287995e-05,-4.64383083e-06,
+     3.41718805e-05,-4.84878583e-05, 5.21486691e-05,-4.90909697e-05, 4.24847203e-05,-3.45610715e-05,
+     2.68034601e-05,-1.99827791e-05, 1.44455298e-05,-1.01660899e-05, 6.99930888e-06,-4.67355221e-06,
+     2.97633005e-06,-1.69178804e-06, 7.44511226e-07,-1.13614497e-07,-8.83857680e-08, 8.14414314e-10
+  },
+  {
+     0.00000000e+00, 1.03699097e-06, 1.97892805e-04, 2.73925997e-03, 9.36348084e-03, 7.38545507e-03,
+    -4.88381693e-03,-5.46005613e-04, 3.30393808e-03,-3.43216793e-03, 2.18069809e-03,-5.96386788e-04,
+    -7.17987772e-04, 1.51969597e-03,-1.79347896e-03, 1.64327701e-03,-1.21836003e-03, 6.67977612e-04,
+    -1.16514799e-04,-3.47406109e-04, 6.72728289e-04,-8.42109672e-04, 8.64906120e-04,-7.68804108e-04,
+     5.91439428e-04,-3.72947106e-04, 1.50056207e-04, 4.79585688e-05,-2.01420306e-04, 3.00664688e-04,
+    -3.45060107e-04, 3.41069710e-04,-2.99816107e-04, 2.34580293e-04,-1.58581504e-04, 8.32761216e-05,
+    -1.72885902e-05,-3.40234983e-05, 6.84589977e-05,-8.64683680e-05, 9.04086264e-05,-8.36476684e-05,
+     7.01451718e-05,-5.35746003e-05, 3.68019682e-05,-2.17549405e-05, 9.50081176e-06,-4.16975894e-07,
+    -5.61185198e-06, 9.00671421e-06,-1.03371103e-05, 1.02018603e-05,-9.14861994e-06, 7.62829313e-06,
+    -5.97726694e-06, 4.41998009e-06,-3.08414701e-06, 2.02224896e-06,-1.23437803e-06, 6.88895113e-07,
+    -3.39233992e-07, 1.35799596e-07,-3.35727286e-08,-4.39723280e-09, 5.94172089e-09, 9.09973519e-09,
+    -2.72940408e-08, 3.94921891e-08,-3.96159088e-08, 2.52378491e-08,-3.17619198e-09,-1.89234206e-09
+  }
+ },
+ { /* phase 12 */
+  {
+     0.00000000e+00, 7.60889407e-06, 3.16285295e-03, 7.44800270e-02,-5.39862275e-01, 8.72047991e-02,
+     1.40238896e-01,-1.35366797e-01, 5.71436696e-02, 1.37124201e-02,-5.33596985e-02, 6.32634386e-02,
+    -5.30212596e-02, 3.27729695e-02,-1.04932599e-02,-8.63879267e-03, 2.19292697e-02,-2.86368709e-02,
+     2.93283407e-02,-2.53665093e-02, 1.84282903e-02,-1.02035804e-02, 2.13020598e-03, 4.70387889e-03,
+    -9.64673981e-03, 1.24325603e-02,-1.31553598e-02, 1.21435402e-02,-9.89398174e-03, 6.93923421e-03,
+    -3.80038004e-03, 8.91545089e-04, 1.47977297e-03,-3.15871392e-03, 4.09805216e-03,-4.36928822e-03,
+     4.09516506e-03,-3.45114805e-03, 2.59968499e-03,-1.70209899e-03, 8.67659401e-04,-1.81178999e-04,
+    -3.17197002e-04, 6.27581787e-04,-7.75068591e-04, 7.96689477e-04,-7.31937413e-04, 6.16937177e-04,
+    -4.81110386e-04, 3.46088811e-04,-2.25797397e-04, 1.27622901e-04,-5.37774213e-05, 2.98446207e-06,
+     2.81946104e-05,-4.40678814e-05, 4.90645216e-05,-4.70687191e-05, 4.12503396e-05,-3.38721802e-05,
+     2.64642294e-05,-1.98469806e-05, 1.44119604e-05,-1.01704800e-05, 7.00525015e-06,-4.66445317e-06,
+     2.94903589e-06,-1.65229596e-06, 7.04895285e-07,-8.83766873e-08,-9.15619580e-08,-1.07792697e-09
+  },
+  {
+     0.00000000e+00, 1.17511104e-06, 2.09090998e-04, 2.81972904e-03, 9.44980700e-03, 7.21489219e-03,
+    -4.98818886e-03,-3.71739210e-04, 3.20417504e-03,-3.43444594e-03, 2.25402298e-03,-6.96635689e-04,
+    -6.26594003e-04, 1.45821297e-03,-1.76917296e-03, 1.65330200e-03,-1.25390303e-03, 7.17840099e-04,
+    -1.69778898e-04,-2.99668813e-04, 6.36595010e-04,-8.20620276e-04, 8.58361600e-04,-7.75367778e-04,
+     6.07878726e-04,-3.95382609e-04, 1.74620698e-04, 2.46140007e-05,-1.81804295e-04, 2.86304596e-04,
+    -3.36521189e-04, 3.38094804e-04,-3.01540596e-04, 2.39777102e-04,-1.65896796e-04, 9.14265693e-05,
+    -2.52027694e-05,-2.71251392e-05, 6.30415379e-05,-8.27061231e-05, 8.82406312e-05,-8.28461707e-05,
+     7.03894111e-05,-5.45214716e-05, 3.81375212e-05,-2.32235507e-05, 1.09162002e-05,-1.66046095e-06,
+    -4.60082811e-06, 8.24373728e-06,-9.80666755e-06, 9.86998566e-06,-8.97323389e-06, 7.56676809e-06,
+    -5.99134182e-06, 4.47834418e-06,-3.16325509e-06, 2.10591111e-06,-1.31263505e-06, 7.56595114e-07,
+    -3.94602296e-07, 1.79174407e-07,-6.64094131e-08, 1.97579002e-08,-1.13305401e-08, 2.09963495e-08,
+    -3.49471598e-08, 4.37314895e-08,-4.11243697e-08, 2.49011194e-08,-2.45629206e-09,-1.72309300e-09
+  }
+ },
+ { /* phase 13 */
+  {
+     0.00000000e+00, 8.78400533e-06, 3.37194395e-03, 7.72997588e-02,-5.30412495e-01, 9.44196880e-02,
+     1.35250703e-01,-1.35738596e-01, 6.03478402e-02, 1.02779698e-02,-5.11056818e-02, 6.25668019e-02,
+    -5.36478609e-02, 3.42311785e-02,-1.22624403e-02,-6.98549114e-03, 2.06753593e-02,-2.79190298e-02,
+     2.91585699e-02,-2.56661791e-02, 1.90648809e-02,-1.10242004e-02, 2.98856804e-03, 3.92851094e-03,
+    -9.03886091e-03, 1.20371804e-02,-1.29807396e-02, 1.21681504e-02,-1.00757899e-02, 7.22553814e-03,
+    -4.13690088e-03, 1.22963998e-03, 1.17823202e-03,-2.91893701e-03, 3.93215520e-03,-4.27786121e-03,
+     4.06996207e-03,-3.47827305e-03, 2.66272598e-03,-1.78480498e-03, 9.55900003e-04,-2.64025090e-04,
+    -2.46807613e-04, 5.73060301e-04,-7.36931106e-04, 7.73465901e-04,-7.21021206e-04, 6.15276804e-04,
+    -4.85711207e-04, 3.54332500e-04,-2.35604093e-04, 1.37492898e-04,-6.27506597e-05, 1.05512299e-05,
+     2.22032704e-05,-3.95895295e-05, 4.59012590e-05,-4.49628096e-05, 3.99377095e-05,-3.31155788e-05,
+     2.60696197e-05,-1.96677993e-05, 1.43455500e-05,-1.01507303e-05, 6.99392012e-06,-4.64345612e-06,
+     2.91408901e-06,-1.60856496e-06, 6.63770891e-07,-6.34755679e-08,-9.40182616e-08,-2.80102097e-09
+  },
+  {
+     0.00000000e+00, 1.32847299e-06, 2.20802598e-04, 2.90162209e-03, 9.53383371e-03, 7.04071997e-03,
+    -5.08683221e-03,-1.97997797e-04, 3.10052396e-03,-3.43165500e-03, 2.32355506e-03,-7.95390806e-04,
+    -5.34469087e-04, 1.39444100e-03,-1.74186402e-03, 1.66037504e-03,-1.28709804e-03, 7.66260899e-04,
+    -2.22582297e-04,-2.51513906e-04, 5.99383202e-04,-7.97661312e-04, 8.50226497e-04,-7.80451926e-04,
+     6.23119297e-04,-4.16999013e-04, 1.98776004e-04, 1.29734804e-06,-1.61904696e-04, 2.71443394e-04,
+    -3.27364192e-04, 3.34478013e-04,-3.02675093e-04, 2.44488503e-04,-1.72860106e-04, 9.93647991e-05,
+    -3.30334406e-05,-2.02046995e-05, 5.75256599e-05,-7.87994286e-05, 8.59095671e-05,-8.18849585e-05,
+     7.04925333e-05,-5.53543614e-05, 3.93890805e-05,-2.46368509e-05, 1.23010304e-05,-2.89288209e-06,
+    -3.58688999e-06, 7.46893920e-06,-9.25972017e-06, 9.52013124e-06,-8.78058836e-06, 7.49002083e-06,
+    -5.99284294e-06, 4.52688710e-06,-3.23507493e-06, 2.18442096e-06,-1.38742303e-06, 8.22069694e-07,
+    -4.48606897e-07, 2.21743804e-07,-9.87729294e-08, 4.36161116e-08,-2.83821500e-08, 3.26931406e-08,
+    -4.23989910e-08, 4.77725202e-08,-4.24644817e-08, 2.44690597e-08,-1.74485504e-09,-1.54643398e-09
+  }
+ },
+ { /* phase 14 */
+  {
+     0.00000000e+00, 1.01124797e-05, 3.59274703e-03, 8.02013800e-02,-5.20878673e-01, 1.01460397e-01,
+     1.30163893e-01,-1.35936603e-01, 6.34483695e-02, 6.84631616e-03,-4.87821214e-02, 6.17714114e-02,
+    -5.41823283e-02, 3.56256291e-02,-1.40043003e-02,-5.32511622e-03, 1.93882603e-02,-2.71527693e-02,
+     2.89359801e-02,-2.59176902e-02, 1.96642708e-02,-1.18218604e-02, 3.83879407e-03, 3.14805890e-03,
+    -8.41574185e-03, 1.16201798e-02,-1.27819702e-02, 1.21694496e-02,-1.02376901e-02, 7.49698188e-03,
+    -4.46426496e-03, 1.56411796e-03, 8.75557307e-04,-2.67444900e-03, 3.75929498e-03,-4.17849608e-03,
+     4.03692899e-03,-3.49847809e-03, 2.72025191e-03,-1.86360395e-03, 1.04181003e-03,-3.45910114e-04,
+    -1.76315094e-04, 5.17705979e-04,-6.97541982e-04, 7.48829101e-04,-7.08720123e-04, 6.12383883e-04,
+    -4.89298080e-04, 3.61801503e-04,-2.44863797e-04, 1.47012994e-04,-7.15312417e-05, 1.80412499e-05,
+     1.62104297e-05,-3.50626397e-05, 4.26661900e-05,-4.27783889e-05, 3.85502790e-05,-3.22935084e-05,
+     2.56210205e-05,-1.94460608e-05, 1.42467698e-05,-1.01071100e-05, 6.96553798e-06,-4.61076297e-06,
+     2.87168996e-06,-1.56079204e-06, 6.21306526e-07,-3.90065082e-08,-9.57631130e-08,-4.34745484e-09
+  },
+  {
+     0.00000000e+00, 1.49843595e-06, 2.33044906e-04, 2.98493006e-03, 9.61546879e-03, 6.86303992e-03,
+    -5.17966598e-03,-2.49878103e-05, 2.99313990e-03,-3.42381699e-03, 2.38919794e-03,-8.92497716e-04,
+    -4.41768701e-04, 1.32849405e-03,-1.71160803e-03, 1.66449195e-03,-1.31789094e-03, 8.13156075e-04,
+    -2.74829887e-04,-2.03031203e-04, 5.61164925e-04,-7.73279578e-04, 8.40520603e-04,-7.84051022e-04,
+     6.37135818e-04,-4.37757990e-04, 2.22477101e-04,-2.19469002e-05,-1.41760698e-04, 2.56111292e-04,
+    -3.17608909e-04, 3.30228388e-04,-3.03219393e-04, 2.48707394e-04,-1.79459093e-04, 1.07076201e-04,
+    -4.07656407e-05,-1.32758196e-05, 5.19226487e-05,-7.47566592e-05, 8.34208695e-05,-8.07667893e-05,
+     7.04550985e-05,-5.60722401e-05, 4.05546307e-05,-2.59923509e-05, 1.36526896e-05,-4.11181190e-06,
+    -2.57211695e-06, 6.68397797e-06,-8.69749692e-06, 9.15313467e-06,-8.57119903e-06, 7.39831785e-06,
+    -5.98185898e-06, 4.56558109e-06,-3.29951104e-06, 2.25765393e-06,-1.45860997e-06, 8.85194197e-07,
+    -5.01139823e-07, 2.63418713e-07,-1.30592795e-07, 6.71234233e-08,-4.51731985e-08, 4.41619683e-08,
+    -4.96314208e-08, 5.16059018e-08,-4.36344685e-08, 2.39453701e-08,-1.04597198e-09,-1.36519596e-09
+  }
+ },
+ { /* phase 15 */
+  {
+     0.00000000e+00, 1.16109104e-05, 3.82579211e-03, 8.31863135e-02,-5.11263192e-01, 1.08323403e-01,
+     1.24984197e-01,-1.35961607e-01, 6.64415136e-02, 3.42249894e-03,-4.63929288e-02, 6.08789213e-02,
+    -5.46240993e-02, 3.69541198e-02,-1.57159101e-02,-3.66062392e-03, 1.80703700e-02,-2.63396204e-02,
+     2.86611505e-02,-2.61207204e-02, 2.02254299e-02,-1.25951404e-02, 4.67931479e-03, 2.36400799e-03,
+    -7.77860591e-03, 1.11824302e-02,-1.25594903e-02, 1.21475002e-02,-1.03794504e-02, 7.75309280e-03,
+    -4.78187390e-03, 1.89434597e-03, 5.72337827e-04,-2.42574094e-03, 3.57983611e-03,-4.07142006e-03,
+     3.99616314e-03,-3.51175410e-03, 2.77217501e-03,-1.93836098e-03, 1.12522999e-03,-4.26676910e-04,
+    -1.05860003e-04, 4.61633696e-04,-6.56987424e-04, 7.22836703e-04,-6.95067400e-04, 6.08272094e-04,
+    -4.91870218e-04, 3.68485489e-04,-2.53561302e-04, 1.56166207e-04,-8.01024435e-05, 2.54395709e-05,
+     1.02285703e-05,-3.04970599e-05, 3.93666814e-05,-4.05207393e-05, 3.70916714e-05,-3.14083190e-05,
+     2.51198799e-05,-1.91826402e-05, 1.41161800e-05,-1.00399902e-05, 6.92036383e-06,-4.56660109e-06,
+     2.82205906e-06,-1.50918595e-06, 5.77671983e-07,-1.50611292e-08,-9.68090816e-08,-5.71264991e-09
+  },
+  {
+     0.00000000e+00, 1.68645204e-06, 2.45835312e-04, 3.06964293e-03, 9.69462097e-03, 6.68195402e-03,
+    -5.26661519e-03, 1.47085695e-04, 2.88218004e-03,-3.41096101e-03, 2.45086406e-03,-9.87805077e-04,
+    -3.48648609e-04, 1.26049202e-03,-1.67846598e-03, 1.66565401e-03,-1.34623400e-03, 8.58444895e-04,
+    -3.26427689e-04,-1.54310997e-04, 5.22013695e-04,-7.47524609e-04, 8.29266384e-04,-7.86162622e-04,
+     6.49905473e-04,-4.57622606e-04, 2.45680305e-04,-4.50745283e-05,-1.21411700e-04, 2.40339403e-04,
+    -3.07276088e-04, 3.25356697e-04,-3.03174893e-04, 2.52427300e-04,-1.85682598e-04, 1.14546703e-04,
+    -4.83846816e-05,-6.35213883e-06, 4.62439093e-05,-7.05864586e-05, 8.07802426e-05,-7.94946682e-05,
+     7.02779435e-05,-5.66743183e-05, 4.16323310e-05,-2.72876496e-05, 1.49686603e-05,-5.31486603e-06,
+    -1.55857504e-06, 5.89051888e-06,-8.12125108e-06, 8.76986724e-06,-8.34561433e-06, 7.29195517e-06,
+    -5.95850179e-06, 4.59441708e-06,-3.35648201e-06, 2.32549405e-06,-1.52607004e-06, 9.45850388e-07,
+    -5.52097106e-07, 3.04112802e-07,-1.61800401e-07, 9.02271893e-08,-6.16648421e-08, 5.53755903e-08,
+    -5.66271794e-08, 5.52229906e-08,-4.46332002e-08, 2.33341009e-08,-3.63571590e-10,-1.18220200e-09
+  }
+ },
+ { /* phase 16 */
+  {
+     0.00000000e+00, 1.32973701e-05, 4.07162681e-03, 8.62559602e-02,-5.01568615e-01, 1.15005396e-01,
+     1.19717598e-01,-1.35814503e-01, 6.93236887e-02, 1.15374596e-05,-4.39420603e-02, 5.98911084e-02,
+    -5.49727418e-02, 3.82146090e-02,-1.73943695e-02,-1.99497002e-03, 1.67241395e-02,-2.54811700e-02,
+     2.83347294e-02,-2.62750294e-02, 2.07474492e-02,-1.33426702e-02, 5.50858118e-03, 1.57784601e-03,
+    -7.12870108e-03, 1.07247997e-02,-1.23138102e-02, 1.21024298e-02,-1.05008604e-02, 7.99343269e-03,
+    -5.08914981e-03, 2.21970305e-03, 2.69162992e-04,-2.17331410e-03, 3.39415390e-03,-3.95687297e-03,
+     3.94777907e-03,-3.51810595e-03, 2.81841890e-03,-2.00894708e-03, 1.20601105e-03,-5.06171491e-04,
+    -3.55820594e-05, 4.04959399e-04,-6.15354977e-04, 6.95549126e-04,-6.80098776e-04, 6.02957211e-04,
+    -4.93428786e-04, 3.74375988e-04,-2.61682610e-04, 1.64936006e-04,-8.84480614e-05, 3.27315211e-05,
+     4.27006898e-06,-2.59026492e-05, 3.60101985e-05,-3.81952414e-05, 3.55656011e-05,-3.04624700e-05,
+     2.45677802e-05,-1.88785307e-05, 1.39543799e-05,-9.94975926e-06, 6.85870009e-06,-4.51122605e-06,
+     2.76543210e-06,-1.45396302e-06, 5.33038815e-07, 8.27296542e-09,-9.71726521e-08,-6.89485313e-09
+  },
+  {
+     0.00000000e+00, 1.89407297e-06, 2.59191787e-04, 3.15574999e-03, 9.77119897e-03, 6.49757218e-03,
+    -5.34761092e-03, 3.18018807e-04, 2.76780804e-03,-3.39312293e-03, 2.50846893e-03,-1.08116504e-03,
+    -2.55264895e-04, 1.19055598e-03,-1.64250296e-03, 1.66386599e-03,-1.37208297e-03, 9.02049884e-04,
+    -3.77283111e-04,-1.05443600e-04, 4.82004602e-04,-7.20448093e-04, 8.16489512e-04,-7.86786899e-04,
+     6.61407597e-04,-4.76557703e-04, 2.68342905e-04,-6.80416779e-05,-1.00897298e-04, 2.24159594e-04,
+    -2.96387792e-04, 3.19874496e-04,-3.02543602e-04, 2.55643012e-04,-1.91519997e-04, 1.21762700e-04,
+    -5.58761494e-05, 5.52811798e-07, 4.05009596e-05,-6.62976308e-05, 7.79936527e-05,-7.80719420e-05,
+     6.99621596e-05,-5.71600285e-05, 4.26205115e-05,-2.85204896e-05, 1.62465003e-05,-6.49970707e-06,
+    -5.48314176e-07, 5.09023403e-06,-7.53225095e-06, 8.37122570e-06,-8.10441270e-06, 7.17125704e-06,
+    -5.92291099e-06, 4.61340915e-06,-3.40592510e-06, 2.38783900e-06,-1.58968896e-06, 1.00392595e-06,
+    -6.01379213e-07, 3.43743011e-07,-1.92329196e-07, 1.12876201e-07,-7.78193083e-08, 6.63077131e-08,
+    -6.33698534e-08, 5.86159388e-08,-4.54601015e-08, 2.26395596e-08, 2.98580910e-10,-1.00023301e-09
+  }
+ },
+ { /* phase 17 */
+  {
+     0.00000000e+00, 1.51914401e-05, 4.33081901e-03, 8.94117132e-02,-4.91797388e-01, 1.21503003e-01,
+     1.14370003e-01,-1.35496497e-01, 7.20914900e-02,-3.38158500e-03,-4.14335914e-02, 5.88099509e-02,
+    -5.52280098e-02, 3.94051708e-02,-1.90368798e-02,-3.31104093e-04, 1.53520601e-02,-2.45791208e-02,
+     2.79574394e-02,-2.63804793e-02, 2.12294497e-02,-1.40631096e-02, 6.32507121e-03, 7.91058701e-04,
+    -6.46729302e-03, 1.02482401e-02,-1.20454701e-02, 1.20343901e-02,-1.06017599e-02, 8.21759179e-03,
+    -5.38553810e-03, 2.53957789e-03,-3.33806602e-05,-1.91767095e-03, 3.20263393e-03,-3.83511093e-03,
+     3.89190298e-03,-3.51755298e-03, 2.85892002e-03,-2.07524491e-03, 1.28400396e-03,-5.84243506e-04,
+     3.43801003e-05, 3.47799389e-04,-5.72734512e-04, 6.67028595e-04,-6.63852319e-04, 5.96457510e-04,
+    -4.93977102e-04, 3.79466190e-04,-2.69214797e-04, 1.73307300e-04,-9.65524669e-05, 3.99027813e-05,
+    -1.65284303e-06,-2.12892392e-05, 3.26042682e-05,-3.58073994e-05, 3.39759099e-05,-2.94585407e-05,
+     2.39664005e-05,-1.85347799e-05, 1.37620500e-05,-9.83688278e-06, 6.78088008e-06,-4.44491798e-06,
+     2.70206192e-06,-1.39534700e-06, 4.87578689e-07, 3.09125312e-08,-9.68740679e-08,-7.89508459e-09
+  },
+  {
+     0.00000000e+00, 2.12295299e-06, 2.73132406e-04, 3.24323890e-03, 9.84511245e-03, 6.31000614e-03,
+    -5.42259123e-03, 4.87609213e-04, 2.65018991e-03,-3.37034510e-03, 2.56193895e-03,-1.17243198e-03,
+    -1.61773904e-04, 1.11881201e-03,-1.60379102e-03, 1.65913999e-03,-1.39539805e-03, 9.43896477e-04,
+    -4.27305291e-04,-5.65193586e-05, 4.41214390e-04,-6.92104397e-04, 8.02217925e-04,-7.85926997e-04,
+     6.71624206e-04,-4.94530192e-04, 2.90423399e-04,-9.08049478e-05,-8.02575523e-05, 2.07604302e-04,
+    -2.84966896e-04, 3.13794502e-04,-3.01329186e-04, 2.58350105e-04,-1.96961293e-04, 1.28711195e-04,
+    -6.32259471e-05, 7.42557722e-06, 3.47053792e-05,-6.18991908e-05, 7.50673280e-05,-7.65021905e-05,
+     6.95091221e-05,-5.75290396e-05, 4.35176989e-05,-2.96887702e-05, 1.74838497e-05,-7.66404810e-06,
+     4.56632705e-07, 4.28479780e-06,-6.93178981e-06, 7.95813412e-06,-7.84820077e-06, 7.03657588e-06,
+    -5.87524983e-06, 4.62259004e-06,-3.44779392e-06, 2.44459898e-06,-1.64936000e-06, 1.05931599e-06,
+    -6.48891103e-07, 3.82228990e-07,-2.22114807e-07, 1.35020997e-07,-9.36001001e-08, 7.69330200e-08,
+    -6.98438924e-08, 6.17776692e-08,-4.61152183e-08, 2.18663807e-08, 9.36900890e-10,-8.21971380e-10
+  }
+ },
+ { /* phase 18 */
+  {
+     0.00000000e+00, 1.73143908e-05, 4.60395217e-03, 9.26549509e-02,-4.81952310e-01, 1.27812997e-01,
+     1.08947396e-01,-1.35008901e-01, 7.47416914e-02,-6.75192988e-03,-3.88716608e-02, 5.76375090e-02,
+    -5.53897806e-02, 4.05239798e-02,-2.06406694e-02, 1.32803596e-03, 1.39566604e-02,-2.36352291e-02,
+     2.75301393e-02,-2.64369901e-02, 2.16706693e-02,-1.47552202e-02, 7.12728919e-03, 5.13175382e-06,
+    -5.79566881e-03, 9.75371525e-03,-1.17550399e-02, 1.19435797e-02,-1.06820203e-02, 8.42519570e-03,
+    -5.67050511e-03, 2.85337190e-03,-3.34709912e-04,-1.65932102e-03, 3.00567201e-03,-3.70639889e-03,
+     3.82867712e-03,-3.51012801e-03, 2.89362506e-03,-2.13714410e-03, 1.35907205e-03,-6.60745718e-04,
+     1.03889201e-04, 2.90270313e-04,-5.29216777e-04, 6.37339777e-04,-6.46368426e-04, 5.88793424e-04,
+    -4.93520522e-04, 3.83751001e-04,-2.76146602e-04, 1.81265394e-04,-1.04400700e-04, 4.69393599e-05,
+    -7.52809319e-06,-1.66666505e-05, 2.91564793e-05,-3.33628013e-05, 3.23265485e-05,-2.83992304e-05,
+     2.33175106e-05,-1.81525502e-05, 1.35399396e-05,-9.70186193e-06, 6.68727989e-06,-4.36798518e-06,
+     2.63221796e-06,-1.33357003e-06, 4.41463499e-07, 5.27789084e-08,-9.59371675e-08,-8.71705730e-09
+  },
+  {
+     0.00000000e+00, 2.37485210e-06, 2.87675502e-04, 3.33209406e-03, 9.91627015e-03, 6.11937093e-03,
+    -5.49149700e-03, 6.55656680e-04, 2.52949889e-03,-3.34267807e-03, 2.61120196e-03,-1.26146700e-03,
+    -6.83316393e-05, 1.04538596e-03,-1.56240398e-03, 1.65149302e-03,-1.41614501e-03, 9.83913778e-04,
+    -4.76404995e-04,-7.62862601e-06, 3.99720593e-04,-6.62549690e-04, 7.86482822e-04,-7.83588679e-04,
+     6.80539699e-04,-5.11508784e-04, 3.11881391e-04,-1.13321403e-04,-5.95323399e-05, 1.90706603e-04,
+    -2.73037294e-04, 3.07130802e-04,-2.99536099e-04, 2.60545494e-04,-2.01997595e-04, 1.35379698e-04,
+    -7.04203121e-05, 1.42528297e-05, 2.88687897e-05,-5.74003498e-05, 7.20077587e-05,-7.47892991e-05,
+     6.89204826e-05,-5.77812789e-05, 4.43226309e-05,-3.07905102e-05, 1.86784691e-05,-8.80565767e-06,
+     1.45425804e-06, 3.47588798e-06,-6.32117008e-06, 7.53153881e-06,-7.57761018e-06, 6.88829005e-06,
+    -5.81570612e-06, 4.62201388e-06,-3.48205594e-06, 2.49569598e-06,-1.70498697e-06, 1.11192196e-06,
+    -6.94542621e-07, 4.19494000e-07,-2.51095003e-07, 1.56613396e-07,-1.08972003e-07, 8.72273418e-08,
+    -7.60347092e-08, 6.47018723e-08,-4.65992116e-08, 2.10194209e-08, 1.54801305e-09,-6.49972909e-10
+  }
+ },
+ { /* phase 19 */
+  {
+     0.00000000e+00, 1.96892397e-05, 4.89162700e-03, 9.59870368e-02,-4.72036004e-01, 1.33932397e-01,
+     1.03455901e-01,-1.34353206e-01, 7.72711784e-02,-1.00946100e-02,-3.62604484e-02, 5.63760512e-02,
+    -5.54581098e-02, 4.15693708e-02,-2.22030692e-02, 2.97952909e-03, 1.25405099e-02,-2.26513091e-02,
+     2.70537306e-02,-2.64446195e-02, 2.20703892e-02,-1.54177696e-02, 7.91377109e-03,-7.78456975e-04,
+    -5.11512905e-03, 9.24220588e-03,-1.14431595e-02, 1.18302600e-02,-1.07415495e-02, 8.61590263e-03,
+    -5.94354188e-03, 3.16050299e-03,-6.34245982e-04,-1.39877503e-03, 2.80367490e-03,-3.57101997e-03,
+     3.75825609e-03,-3.49587505e-03, 2.92249396e-03,-2.19454500e-03, 1.43107900e-03,-7.35534995e-04,
+     1.72809698e-04, 2.32489096e-04,-4.84894204e-04, 6.06549322e-04,-6.27689995e-04, 5.79987827e-04,
+    -4.92066203e-04, 3.87226901e-04,-2.82467809e-04, 1.88796897e-04,-1.11978297e-04, 5.38276508e-05,
+    -1.33437998e-05,-1.20446302e-05, 2.56744206e-05,-3.08671115e-05, 3.06215697e-05,-2.72873003e-05,
+     2.26229695e-05,-1.77330603e-05, 1.32888399e-05,-9.54524785e-06, 6.57830788e-06,-4.28075782e-06,
+     2.55618306e-06,-1.26886800e-06, 3.94864287e-07, 7.37983328e-08,-9.43891578e-08,-9.36702893e-09
+  },
+  {
+     0.00000000e+00, 2.65164704e-06, 3.02839704e-04, 3.42229893e-03, 9.98458546e-03, 5.92578622e-03,
+    -5.55427885e-03, 8.21962778e-04, 2.40590889e-03,-3.31018004e-03, 2.65619811e-03,-1.34813099e-03,
+     2.49064706e-05, 9.70409426e-04,-1.51842204e-03, 1.64094602e-03,-1.43429195e-03, 1.02203398e-03,
+    -5.24495088e-04, 4.11386209e-05, 3.57602403e-04,-6.31842588e-04, 7.69317674e-04,-7.79780792e-04,
+     6.88140979e-04,-5.27464203e-04, 3.32677999e-04,-1.35548893e-04,-3.87617183e-05, 1.73500099e-04,
+    -2.60623812e-04, 2.99898209e-04,-2.97169900e-04, 2.62226793e-04,-2.06620796e-04, 1.41756405e-04,
+    -7.74458385e-05, 2.10213893e-05, 2.30028509e-05,-5.28104392e-05, 6.88216533e-05,-7.29374078e-05,
+     6.81981182e-05,-5.79168700e-05, 4.50342195e-05,-3.18238999e-05, 1.98281905e-05,-9.92236619e-06,
+     2.44258104e-06, 2.66517395e-06,-5.70170914e-06, 7.09240794e-06,-7.29329895e-06, 6.72680517e-06,
+    -5.74448995e-06, 4.61175478e-06,-3.50869891e-06, 2.54106590e-06,-1.75648097e-06, 1.16165097e-06,
+    -7.38248275e-07, 4.55464402e-07,-2.79210212e-07, 1.77607404e-07,-1.23901003e-07, 9.71675576e-08,
+    -8.19286470e-08, 6.73830698e-08,-4.69132893e-08, 2.01037693e-08, 2.12877804e-09,-4.86612917e-10
+  }
+ },
+ { /* phase 20 */
+  {
+     0.00000000e+00, 2.23408897e-05, 5.19446703e-03, 9.94093418e-02,-4.62051392e-01, 1.39858097e-01,
+     9.79016498e-02,-1.33531198e-01, 7.96770900e-02,-1.34047903e-02,-3.36042494e-02, 5.50279208e-02,
+    -5.54332100e-02, 4.25397791e-02,-2.37214901e-02, 4.62047383e-03, 1.11062201e-02,-2.16292795e-02,
+     2.65292395e-02,-2.64034793e-02, 2.24279892e-02,-1.60496105e-02, 8.68308917e-03,-1.55823794e-03,
+    -4.42698784e-03, 8.71474110e-03,-1.11104799e-02, 1.16947098e-02,-1.07803103e-02, 8.78940336e-03,
+    -6.20416598e-03, 3.46040097e-03,-9.31415823e-04,-1.13654905e-03, 2.59705400e-03,-3.42926290e-03,
+     3.68081010e-03,-3.47485300e-03, 2.94549693e-03,-2.24735495e-03, 1.49990094e-03,-8.08472396e-04,
+     2.41007801e-04, 1.74572197e-04,-4.39860014e-04, 5.74725389e-04,-6.07861788e-04, 5.70065400e-04,
+    -4.89623693e-04, 3.89892113e-04,-2.88169511e-04, 1.95889297e-04,-1.19271601e-04, 6.05544483e-05,
+    -1.90882893e-05,-7.43287910e-06, 2.21657192e-05,-2.83260397e-05, 2.88650899e-05,-2.61256500e-05,
+     2.18847199e-05,-1.72775999e-05, 1.30096296e-05,-9.36764081e-06, 6.45440696e-06,-4.18359014e-06,
+     2.47425396e-06,-1.20148502e-06, 3.47950987e-07, 9.39021021e-08,-9.22603789e-08,-9.85364235e-09
+  },
+  {
+     0.00000000e+00, 2.95532891e-06, 3.18643899e-04, 3.51383700e-03, 1.00499699e-02, 5.72937587e-03,
+    -5.61089022e-03, 9.86331608e-04, 2.27959896e-03,-3.27291409e-03, 2.69686896e-03,-1.43229298e-03,
+     1.17785603e-04, 8.94014200e-04,-1.47192902e-03, 1.62752497e-03,-1.44981605e-03, 1.05819397e-03,
+    -5.71490207e-04, 8.96928686e-05, 3.14939389e-04,-6.00043626e-04, 7.50758802e-04,-7.74514512e-04,
+     6.94417511e-04,-5.42369206e-04, 3.52775591e-04,-1.57445698e-04,-1.79856906e-05, 1.56019101e-04,
+    -2.47752090e-04, 2.92112789e-04,-2.94237398e-04, 2.63392809e-04,-2.10823506e-04, 1.47830098e-04,
+    -8.42895315e-05, 2.77182608e-05, 1.71192405e-05,-4.81389397e-05, 6.55159311e-05,-7.09508968e-05,
+     6.73441973e-05,-5.79362095e-05, 4.56515590e-05,-3.27872403e-05, 2.09309801e-05,-1.10120600e-05,
+     3.41965210e-06, 1.85432100e-06,-5.07473305e-06, 6.64172785e-06,-6.99595103e-06, 6.55254917e-06,
+    -5.66183508e-06, 4.59190596e-06,-3.52772395e-06, 2.58065711e-06,-1.80376503e-06, 1.20841798e-06,
+    -7.79927916e-07, 4.90070477e-07,-3.06403308e-07, 1.97958599e-07,-1.38354906e-07, 1.06731797e-07,
+    -8.75130581e-08, 6.98165934e-08,-4.70592596e-08, 1.91247391e-08, 2.67629496e-09,-3.34048900e-10
+  }
+ },
+ { /* phase 21 */
+  {
+     0.00000000e+00, 2.52962200e-05, 5.51311113e-03, 1.02923200e-01,-4.52001512e-01, 1.45587504e-01,
+     9.22907591e-02,-1.32544905e-01, 8.19566920e-02,-1.66777000e-02,-3.09073906e-02, 5.35956211e-02,
+    -5.53154200e-02, 4.34337892e-02,-2.51934193e-02, 6.24799915e-03, 9.65640508e-03,-2.05710791e-02,
+     2.59577502e-02,-2.63137892e-02, 2.27429308e-02,-1.66496504e-02, 9.43384785e-03,-2.33275210e-03,
+    -3.73257091e-03, 8.17237236e-03,-1.07577099e-02, 1.15372697e-02,-1.07982997e-02, 8.94542225e-03,
+    -6.45191781e-03, 3.75251402e-03,-1.22565299e-03,-8.73155775e-04, 2.38623004e-03,-3.28143290e-03,
+     3.59652098e-03,-3.44713498e-03, 2.96261604e-03,-2.29549408e-03, 1.56541704e-03,-8.79423285e-04,
+     3.08351999e-04, 1.16636002e-04,-3.94208386e-04, 5.41938178e-04,-5.86930779e-04, 5.59053384e-04,
+    -4.86203993e-04, 3.91746406e-04,-2.93244200e-04, 2.02531097e-04,-1.26267507e-04, 6.71070011e-05,
+    -2.47501193e-05,-2.84097200e-06, 1.86380003e-05,-2.57453903e-05, 2.70613200e-05,-2.49172408e-05,
+     2.11047900e-05,-1.67875296e-05, 1.27032299e-05,-9.16968202e-06, 6.31605189e-06,-4.07685820e-06,
+     2.38674102e-06,-1.13166800e-06, 3.00891713e-07, 1.13026800e-07,-8.95840913e-08,-1.01876898e-08
+  },
+  {
+     0.00000000e+00, 3.28801593e-06, 3.35107208e-04, 3.60669009e-03, 1.01123303e-02, 5.53026702e-03,
+    -5.66129293e-03, 1.14856998e-03, 2.15075002e-03,-3.23095196e-03, 2.73316703e-03,-1.51382503e-03,
+     2.10151993e-04, 8.16335029e-04,-1.42301305e-03, 1.61126303e-03,-1.46269496e-03, 1.09233195e-03,
+    -6.17307494e-04, 1.37945201e-04, 2.71812314e-04,-5.67215087e-04, 7.30844913e-04,-7.67803984e-04,
+     6.99361321e-04,-5.56198589e-04, 3.72137991e-04,-1.78970993e-04, 2.75588991e-06, 1.38298099e-04,
+    -2.34448395e-04, 2.83791596e-04,-2.90746306e-04, 2.64043105e-04,-2.14599102e-04, 1.53590096e-04,
+    -9.09387672e-05, 3.43306201e-05, 1.12295802e-05,-4.33954592e-05, 6.20977298e-05,-6.88344298e-05,
+     6.63611281e-05,-5.78398904e-05, 4.61739510e-05,-3.36790217e-05, 2.19848807e-05,-1.20727100e-05,
+     4.38355801e-06, 1.04498395e-06,-4.44157513e-06, 6.18050399e-06,-6.68626899e-06, 6.36597406e-06,
+    -5.56799614e-06, 4.56258203e-06,-3.53914811e-06, 2.61443006e-06,-1.84677106e-06, 1.25214694e-06,
+    -8.19506226e-07, 5.23246001e-07,-3.32619805e-07, 2.17624702e-07,-1.52302604e-07, 1.15899297e-07,
+    -9.27763182e-08, 7.19985991e-08,-4.70394816e-08, 1.80878192e-08, 3.18792104e-09,-1.94182295e-10
+  }
+ },
+ { /* phase 22 */
+  {
+     0.00000000e+00, 2.85842398e-05, 5.84821822e-03, 1.06529899e-01,-4.41889107e-01, 1.51117802e-01,
+     8.66294727e-02,-1.31396294e-01, 8.41074437e-02,-1.99086498e-02,-2.81742197e-02, 5.20818010e-02,
+    -5.51052690e-02, 4.42501195e-02,-2.66164392e-02, 7.85926171e-03, 8.19370989e-03,-1.94787495e-02,
+     2.53404398e-02,-2.61758491e-02, 2.30147392e-02,-1.72168706e-02, 1.01646902e-02,-3.10055609e-03,
+    -3.03321006e-03, 7.61617394e-03,-1.03855701e-02, 1.13583002e-02,-1.07955402e-02, 9.08371992e-03,
+    -6.68636709e-03, 4.03630501e-03,-1.51640002e-03,-6.09112612e-04, 2.17163097e-03,-3.12784291e-03,
+     3.50558199e-03,-3.41280503e-03, 2.97384500e-03,-2.33888905e-03, 1.62751495e-03,-9.48257686e-04,
+     3.74713098e-04, 5.87960894e-05,-3.48034489e-04, 5.08259109e-04,-5.64945920e-04, 5.46980591e-04,
+    -4.81820491e-04, 3.92791408e-04,-2.97685794e-04, 2.08711601e-04,-1.32953806e-04, 7.34729692e-05,
+    -3.03181205e-05, 1.72160901e-06, 1.50988499e-05,-2.31309605e-05, 2.52145492e-05,-2.36650903e-05,
+     2.02852898e-05,-1.62642791e-05, 1.23706104e-05,-8.95205812e-06, 6.16375019e-06,-3.96095902e-06,
+     2.29396505e-06,-1.05967001e-06, 2.53852193e-07, 1.31114703e-07,-8.63961631e-08,-1.03818696e-08
+  },
+  {
+     0.00000000e+00, 3.65195206e-06, 3.52248899e-04, 3.70083493e-03, 1.01715801e-02, 5.32859005e-03,
+    -5.70545299e-03, 1.30848703e-03, 2.01954902e-03,-3.18437209e-03, 2.76504899e-03,-1.59260095e-03,
+     3.01853201e-04, 7.37508293e-04,-1.37176504e-03, 1.59219594e-03,-1.47291296e-03, 1.12439401e-03,
+    -6.61866274e-04, 1.85807497e-04, 2.28302495e-04,-5.33421116e-04, 7.09617103e-04,-7.59666029e-04,
+     7.02966820e-04,-5.68929419e-04, 3.90730507e-04,-2.00084804e-04, 2.34233394e-05, 1.20371900e-04,
+    -2.20739996e-04, 2.74952705e-04,-2.86705588e-04, 2.64178612e-04,-2.17942099e-04, 1.59026604e-04,
+    -9.73814022e-05, 4.08458909e-05, 5.34549190e-06,-3.85896710e-05, 5.85743692e-05,-6.65928528e-05,
+     6.52515664e-05,-5.76287493e-05, 4.66009005e-05,-3.44978507e-05, 2.29880607e-05,-1.31023398e-05,
+     5.33242201e-06, 2.38804006e-07,-3.80357301e-06, 5.70975590e-06,-6.36497816e-06, 6.16755415e-06,
+    -5.46325100e-06, 4.52391305e-06,-3.54300596e-06, 2.64235791e-06,-1.88544095e-06, 1.29276702e-06,
+    -8.56913289e-07, 5.54928477e-07,-3.57808005e-07, 2.36565398e-07,-1.65714695e-07, 1.24650597e-07,
+    -9.77077974e-08, 7.39260528e-08,-4.68568508e-08, 1.69986496e-08, 3.66128994e-09,-6.86137813e-11
+  }
+ },
+ { /* phase 23 */
+  {
+     0.00000000e+00, 3.22361884e-05, 6.20046677e-03, 1.10230699e-01,-4.31717604e-01, 1.56446397e-01,
+     8.09240118e-02,-1.30087793e-01, 8.61269906e-02,-2.30930299e-02,-2.54091695e-02, 5.04891984e-02,
+    -5.48034199e-02, 4.49876301e-02,-2.79881991e-02, 9.45145823e-03, 6.72079716e-03,-1.83543600e-02,
+     2.46785693e-02,-2.59900391e-02, 2.32430398e-02,-1.77502893e-02, 1.08743096e-02,-3.86022194e-03,
+    -2.33024289e-03, 7.04724388e-03,-9.99483839e-03, 1.11582102e-02,-1.07721202e-02, 9.20409244e-03,
+    -6.90710684e-03, 4.31125797e-03,-1.80310500e-03,-3.44934087e-04, 1.95368892e-03,-2.96881702e-03,
+     3.40820104e-03,-3.37195909e-03, 2.97919102e-03,-2.37747910e-03, 1.68608897e-03,-1.01485103e-03,
+     4.39964700e-04, 1.16733599e-06,-3.01433611e-04, 4.73761291e-04,-5.41957794e-04, 5.33878279e-04,
+    -4.76488000e-04, 3.93030205e-04,-3.01489403e-04, 2.14421307e-04,-1.39318799e-04, 7.96405293e-05,
+    -3.57813697e-05, 6.24552194e-06, 1.15558396e-05,-2.04886001e-05, 2.33291103e-05,-2.23723200e-05,
+     1.94283693e-05,-1.57093491e-05, 1.20127997e-05,-8.71549219e-06, 5.99803479e-06,-3.83630822e-06,
+     2.19625690e-06,-9.85743554e-07, 2.06995395e-07, 1.48113301e-07,-8.27348714e-08,-1.04504903e-08
+  },
+  {
+     0.00000000e+00, 4.04951606e-06, 3.70088499e-04, 3.79625009e-03, 1.02276402e-02, 5.12447814e-03,
+    -5.74334478e-03, 1.46589498e-03, 1.88618305e-03,-3.13325692e-03, 2.79248110e-03,-1.66850397e-03,
+     3.92738002e-04, 6.57672121e-04,-1.31828198e-03, 1.57036504e-03,-1.48045900e-03, 1.15432497e-03,
+    -7.05088489e-04, 2.33192593e-04, 1.84491699e-04,-4.98727371e-04, 6.87119027e-04,-7.50120089e-04,
+     7.05231214e-04,-5.80540509e-04, 4.08519991e-04,-2.20748101e-04, 4.39772411e-05, 1.02275801e-04,
+    -2.06654804e-04, 2.65615090e-04,-2.82125111e-04, 2.63800786e-04,-2.20847694e-04, 1.64130193e-04,
+    -1.03605700e-04, 4.72517313e-05,-5.21497725e-07,-3.37313613e-05, 5.49533288e-05,-6.42312734e-05,
+     6.40184007e-05,-5.73038487e-05, 4.69320985e-05,-3.52425304e-05, 2.39387991e-05,-1.40990496e-05,
+     6.26441215e-06,-5.62596483e-07,-3.16206410e-06, 5.23051494e-06,-6.03282206e-06, 5.95778602e-06,
+    -5.34789888e-06, 4.47605180e-06,-3.53934797e-06, 2.66442703e-06,-1.91972504e-06, 1.33021399e-06,
+    -8.92084927e-07, 5.85059695e-07,-3.81918994e-07, 2.54742389e-07,-1.78563695e-07, 1.32967699e-07,
+    -1.02298003e-07, 7.55967378e-08,-4.65148098e-08, 1.58629998e-08, 4.09432399e-09, 4.13817904e-11
+  }
+ },
+ { /* phase 24 */
+  {
+     0.00000000e+00, 3.62856990e-05, 6.57055480e-03, 1.14027001e-01,-4.21489894e-01, 1.61570802e-01,
+     7.51806721e-02,-1.28621906e-01, 8.80131721e-02,-2.62262803e-02,-2.26166900e-02, 4.88206893e-02,
+    -5.44106811e-02, 4.56453115e-02,-2.93064807e-02, 1.10218199e-02, 5.24033792e-03,-1.72000304e-02,
+     2.39734799e-02,-2.57568508e-02, 2.34275293e-02,-1.82490200e-02, 1.15614301e-02,-4.61034197e-03,
+    -1.62501098e-03, 6.46670396e-03,-9.58631840e-03, 1.09374598e-02,-1.07281404e-02, 9.30636842e-03,
+    -7.11376080e-03, 4.57687303e-03,-2.08523008e-03,-8.11332284e-05, 1.73284102e-03,-2.80468608e-03,
+     3.30459489e-03,-3.32470704e-03, 2.97866901e-03,-2.41120998e-03, 1.74104201e-03,-1.07908202e-03,
+     5.03983116e-04,-5.61365196e-05,-2.54501501e-04, 4.38518793e-04,-5.18019020e-04, 5.19779278e-04,
+    -4.70223604e-04, 3.92467598e-04,-3.04651388e-04, 2.19651803e-04,-1.45351602e-04, 8.55983089e-05,
+    -4.11292713e-05, 1.07215701e-05, 8.01649639e-06,-1.78241698e-05, 2.14093798e-05,-2.10421094e-05,
+     1.85362896e-05,-1.51242903e-05, 1.16308802e-05,-8.46075000e-06, 5.81947097e-06,-3.70334101e-06,
+     2.09395898e-06,-9.10146809e-07, 1.60480596e-07, 1.63976296e-07,-7.86405465e-08,-1.04091100e-08
+  },
+  {
+     0.00000000e+00, 4.48322589e-06, 3.88645887e-04, 3.89291206e-03, 1.02804303e-02, 4.91806911e-03,
+    -5.77494921e-03, 1.62061001e-03, 1.75084197e-03,-3.07769910e-03, 2.81543308e-03,-1.74142001e-03,
+     4.82657313e-04, 5.76965802e-04,-1.26266398e-03, 1.54581701e-03,-1.48532796e-03, 1.18207803e-03,
+    -7.46898702e-04, 2.80014501e-04, 1.40461998e-04,-4.63201286e-04, 6.63396320e-04,-7.39188108e-04,
+     7.06154213e-04,-5.91013522e-04, 4.25475213e-04,-2.40922702e-04, 6.43785534e-05, 8.40450521e-05,
+    -1.92221298e-04, 2.55798601e-04,-2.77015701e-04, 2.62912712e-04,-2.23311901e-04, 1.68892497e-04,
+    -1.09600500e-04, 5.35360887e-05,-6.35993592e-06,-2.88303399e-05, 5.12422594e-05,-6.17549886e-05,
+     6.26647306e-05,-5.68664691e-05, 4.71674211e-05,-3.59119913e-05, 2.48355100e-05,-1.50610404e-05,
+     7.17773992e-06,-1.35761400e-06,-2.51838401e-06, 4.74382387e-06,-5.69056283e-06, 5.73718580e-06,
+    -5.22225719e-06, 4.41916609e-06,-3.52823895e-06, 2.68063695e-06,-1.94958602e-06, 1.36443396e-06,
+    -9.24962080e-07, 6.13585087e-07,-4.04907013e-07, 2.72119905e-07,-1.90823300e-07, 1.40833805e-07,
+    -1.06538302e-07, 7.70092683e-08,-4.60172807e-08, 1.46867798e-08, 4.48524018e-09, 1.34898301e-10
+  }
+ },
+ { /* phase 25 */
+  {
+     0.00000000e+00, 4.07689295e-05, 6.95920084e-03, 1.17919900e-01,-4.11209494e-01, 1.66488901e-01,
+     6.94057196e-02,-1.27001300e-01, 8.97640213e-02,-2.93039791e-02,-1.98012609e-02, 4.70792688e-02,
+    -5.39280213e-02, 4.62222695e-02,-3.05691492e-02, 1.25676403e-02, 3.75500997e-03,-1.60179492e-02,
+     2.32265908e-02,-2.54768301e-02, 2.35680006e-02,-1.87122207e-02, 1.22248298e-02,-5.34952991e-03,
+    -9.18857288e-04, 5.87568991e-03,-9.16084275e-03, 1.06965397e-02,-1.06637599e-02, 9.39041283e-03,
+    -7.30598299e-03, 4.83267196e-03,-2.36224593e-03, 1.81779498e-04, 1.50953000e-03,-2.63579399e-03,
+     3.19499499e-03,-3.27117089e-03, 2.97230901e-03,-2.44004093e-03, 1.79228501e-03,-1.14083698e-03,
+     5.66647795e-04,-1.13003000e-04,-2.07334000e-04, 4.02606791e-04,-4.93183499e-04, 5.04718220e-04,
+    -4.63045901e-04, 3.91109992e-04,-3.07169801e-04, 2.24395699e-04,-1.51042201e-04, 9.13355034e-05,
+    -4.63515316e-05, 1.51407403e-05, 4.48825722e-06,-1.51435297e-05, 1.94597997e-05,-1.96776691e-05,
+     1.76113299e-05,-1.45107097e-05, 1.12259804e-05,-8.18863009e-06, 5.62864807e-06,-3.56250689e-06,
+     1.98742100e-06,-8.33137619e-07, 1.14463298e-07, 1.78663100e-07,-7.41553094e-08,-1.02742099e-08
+  },
+  {
+     0.00000000e+00, 4.95574523e-06, 4.07940795e-04, 3.99079500e-03, 1.03298603e-02, 4.70950222e-03,
+    -5.80024999e-03, 1.77245098e-03, 1.61371904e-03,-3.01779504e-03, 2.83388491e-03,-1.81123905e-03,
+     5.71463781e-04, 4.95529908e-04,-1.20501197e-03, 1.51860202e-03,-1.48751598e-03, 1.20760803e-03,
+    -7.87224213e-04, 3.26188310e-04, 9.62958729e-05,-4.26911487e-04, 6.38497120e-04,-7.26894708e-04,
+     7.05737795e-04,-6.00331696e-04, 4.41566197e-04,-2.60571687e-04, 8.45886170e-05, 6.57152923e-05,
+    -1.77468406e-04, 2.45523814e-04,-2.71389290e-04, 2.61517795e-04,-2.25331896e-04, 1.73305496e-04,
+    -1.15354997e-04, 5.96871687e-05,-1.21584799e-05,-2.38964803e-05, 4.74489498e-05,-5.91695207e-05,
+     6.11939322e-05,-5.63181093e-05, 4.73069413e-05,-3.65053202e-05, 2.56766907e-05,-1.59865704e-05,
+     8.07066863e-06,-2.14466695e-06,-1.87386604e-06, 4.25073495e-06,-5.33897810e-06, 5.50628783e-06,
+    -5.08666108e-06, 4.35344418e-06,-3.50975802e-06, 2.69099905e-06,-1.97499503e-06, 1.39537804e-06,
+    -9.55491373e-07, 6.40454402e-07,-4.26729002e-07, 2.88664012e-07,-2.02469394e-07, 1.48233298e-07,
+    -1.10421503e-07, 7.81630831e-08,-4.53687186e-08, 1.34759404e-08, 4.83255791e-09, 2.11411597e-10
+  }
+ },
+ { /* phase 26 */
+  {
+     0.00000000e+00, 4.57246715e-05, 7.36714201e-03, 1.21910699e-01,-4.00879592e-01, 1.71198398e-01,
+     6.36054724e-02,-1.25228897e-01, 9.13777277e-02,-3.23217809e-02,-1.69673692e-02, 4.52680290e-02,
+    -5.33565618e-02, 4.67178002e-02,-3.17741595e-02, 1.40862400e-02, 2.26749410e-03,-1.48103498e-02,
+     2.24393606e-02,-2.51506399e-02, 2.36642901e-02,-1.91391297e-02, 1.28633203e-02,-6.07642485e-03,
+    -2.13119594e-04, 5.27535891e-03,-8.71927664e-03, 1.04359696e-02,-1.05791697e-02, 9.45612788e-03,
+    -7.48345116e-03, 5.07819606e-03,-2.63363495e-03, 4.43297293e-04, 1.28419802e-03,-2.46248790e-03,
+     3.07963998e-03,-3.21148406e-03, 2.96015106e-03,-2.46393704e-03, 1.83973403e-03,-1.20000599e-03,
+     6.27841800e-04,-1.69321094e-04,-1.60027106e-04, 3.66101391e-04,-4.67506790e-04, 4.88731603e-04,
+    -4.54975205e-04, 3.88965302e-04,-3.09043709e-04, 2.28646401e-04,-1.56381095e-04, 9.68417880e-05,
+    -5.14381900e-05, 1.94941804e-05, 9.78499088e-07,-1.24525304e-05, 1.74847992e-05,-1.82822896e-05,
+     1.66558293e-05,-1.38702499e-05, 1.07992500e-05,-7.89996557e-06, 5.42617909e-06,-3.41427403e-06,
+     1.87699902e-06,-7.54974508e-07, 6.90945825e-08, 1.92138998e-07,-6.93227520e-08,-1.00628004e-08
+  },
+  {
+     0.00000000e+00, 5.46988804e-06, 4.27993393e-04, 4.08987002e-03, 1.03758397e-02, 4.49892087e-03,
+    -5.81924105e-03, 1.92124199e-03, 1.47500902e-03,-2.95364903e-03, 2.84782192e-03,-1.87785795e-03,
+     6.59012410e-04, 4.13505797e-04,-1.14543305e-03, 1.48877699e-03,-1.48702902e-03, 1.23087503e-03,
+    -8.25995172e-04, 3.71630595e-04, 5.20755711e-05,-3.89927707e-04, 6.12471311e-04,-7.13267014e-04,
+     7.03986792e-04,-6.08480885e-04, 4.56765090e-04,-2.79658998e-04, 1.04569299e-04, 4.73220898e-05,
+    -1.62425698e-04, 2.34812498e-04,-2.65258714e-04, 2.59620894e-04,-2.26905293e-04, 1.77362104e-04,
+    -1.20858997e-04, 6.56935081e-05,-1.79059207e-05,-1.89396596e-05, 4.35813017e-05,-5.64805596e-05,
+     5.96095415e-05,-5.56604900e-05, 4.73509317e-05,-3.70217786e-05, 2.64609807e-05,-1.68739807e-05,
+     8.94151071e-06,-2.92220398e-06,-1.22983499e-06, 3.75230297e-06,-4.97885594e-06, 5.26564600e-06,
+    -4.94146889e-06, 4.27908890e-06,-3.48400295e-06, 2.69553607e-06,-1.99593296e-06, 1.42300598e-06,
+    -9.83625341e-07, 6.65621485e-07,-4.47345286e-07, 3.04343303e-07,-2.13479296e-07, 1.55152307e-07,
+    -1.13941297e-07, 7.90584025e-08,-4.45740085e-08, 1.22365202e-08, 5.13511811e-09, 2.70809208e-10
+  }
+ },
+ { /* phase 27 */
+  {
+     0.00000000e+00, 5.11945582e-05, 7.79513502e-03, 1.26000494e-01,-3.90503794e-01, 1.75697297e-01,
+     5.77862300e-02,-1.23307601e-01, 9.28527415e-02,-3.52754295e-02,-1.41195497e-02, 4.33901809e-02,
+    -5.26975505e-02, 4.71313111e-02,-3.29195894e-02, 1.55750196e-02, 7.80465081e-04,-1.35794701e-02,
+     2.16133706e-02,-2.47790106e-02, 2.37163696e-02,-1.95290595e-02, 1.34757897e-02,-6.78969221e-03,
+     4.90867184e-04, 4.66687791e-03,-8.26251227e-03, 1.01563102e-02,-1.04745999e-02, 9.50345024e-03,
+    -7.64587708e-03, 5.31300809e-03,-2.89889402e-03, 7.02918216e-04, 1.05729199e-03,-2.28512590e-03,
+     2.95878109e-03,-3.14578996e-03, 2.94224499e-03,-2.48287711e-03, 1.88331504e-03,-1.25648698e-03,
+     6.87451276e-04,-2.24981603e-04,-1.12676200e-04, 3.29079689e-04,-4.41045908e-04, 4.71857697e-04,
+    -4.46033693e-04, 3.86043102e-04,-3.10273492e-04, 2.32398699e-04,-1.61360003e-04, 1.02107399e-04,
+    -5.63796602e-05, 2.37732693e-05,-2.50550397e-06,-9.75699913e-06, 1.54888694e-05,-1.68592906e-05,
+     1.56722108e-05,-1.32046298e-05, 1.03518996e-05,-7.59562317e-06, 5.21269885e-06,-3.25912106e-06,
+     1.76305798e-06,-6.75916112e-07, 2.45205705e-08, 2.04375496e-07,-6.41876312e-08,-9.79198589e-09
+  },
+  {
+     0.00000000e+00, 6.02862383e-06, 4.48823906e-04, 4.19010920e-03, 1.04183098e-02, 4.28647408e-03,
+    -5.83192194e-03, 2.06680992e-03, 1.33490900e-03,-2.88537005e-03, 2.85723805e-03,-1.94117799e-03,
+     7.45160622e-04, 3.31035611e-04,-1.08403701e-03, 1.45640096e-03,-1.48387300e-03, 1.25184294e-03,
+    -8.63144873e-04, 4.16259689e-04, 7.88336183e-06,-3.52321105e-04, 5.85370872e-04,-6.98334421e-04,
+     7.00908480e-04,-6.15449215e-04, 4.71045612e-04,-2.98150000e-04, 1.24283004e-04, 2.89010495e-05,
+    -1.47123399e-04, 2.23686700e-04,-2.58637796e-04, 2.57227599e-04,-2.28031000e-04, 1.81055802e-04,
+    -1.26102794e-04, 7.15439965e-05,-2.35911994e-05,-1.39697604e-05, 3.96473297e-05,-5.36939697e-05,
+     5.79153202e-05,-5.48955104e-05, 4.72998508e-05,-3.74607698e-05, 2.71871395e-05,-1.77217207e-05,
+     9.78863773e-06,-3.68869792e-06,-5.87605825e-07, 3.24959092e-06,-4.61100217e-06, 5.01582690e-06,
+    -4.78705215e-06, 4.19632215e-06,-3.45108310e-06, 2.69428392e-06,-2.01239004e-06, 1.44728494e-06,
+    -1.00932198e-06, 6.89044725e-07,-4.66719200e-07, 3.19128787e-07,-2.23832302e-07, 1.61578100e-07,
+    -1.17092299e-07, 7.96962425e-08,-4.36385008e-08, 1.09745999e-08, 5.39206990e-09, 3.13395393e-10
+  }
+ },
+ { /* phase 28 */
+  {
+     0.00000000e+00, 5.72231911e-05, 8.24395940e-03, 1.30190596e-01,-3.80085498e-01, 1.79983795e-01,
+     5.19543104e-02,-1.21240802e-01, 9.41876471e-02,-3.81608009e-02,-1.12623097e-02, 4.14489992e-02,
+    -5.19523881e-02, 4.74623404e-02,-3.40036303e-02, 1.70314200e-02,-7.03408383e-04,-1.23276301e-02,
+     2.07502209e-02,-2.43627504e-02, 2.37242505e-02,-1.98813807e-02, 1.40611604e-02,-7.48802722e-03,
+     1.19177601e-03, 4.05142922e-03,-7.79146608e-03, 9.85815935e-03,-1.03503196e-02, 9.53235105e-03,
+    -7.79299997e-03, 5.53669501e-03,-3.15753208e-03, 9.60145902e-04, 8.29261320e-04,-2.10407004e-03,
+     2.83267791e-03,-3.07424599e-03, 2.91865389e-03,-2.49684695e-03, 1.92296202e-03,-1.31018099e-03,
+     7.45366619e-04,-2.79877102e-04,-6.53763273e-05, 2.91618897e-04,-4.13858710e-04, 4.54135909e-04,
+    -4.36245115e-04, 3.82354396e-04,-3.10861098e-04, 2.35648302e-04,-1.65970996e-04, 1.07123298e-04,
+    -6.11667128e-05, 2.79695996e-05,-5.95658685e-06,-7.06271521e-06, 1.34764796e-05,-1.54120007e-05,
+     1.46628900e-05,-1.25155902e-05, 9.88518059e-06,-7.27649422e-06, 4.98886720e-06,-3.09754296e-06,
+     1.64596599e-06,-5.96219877e-07,-1.91179197e-08, 2.15350099e-07,-5.87955604e-08,-9.47859125e-09
+  },
+  {
+     0.00000000e+00, 6.63508717e-06, 4.70452709e-04, 4.29148087e-03, 1.04571702e-02, 4.07230714e-03,
+    -5.83829777e-03, 2.20898492e-03, 1.19361596e-03,-2.81307194e-03, 2.86213192e-03,-2.00110907e-03,
+     8.29768484e-04, 2.48261698e-04,-1.02093595e-03, 1.42153795e-03,-1.47806294e-03, 1.27047999e-03,
+    -8.98609811e-04, 4.59995295e-04,-3.61987586e-05,-3.14163510e-04, 5.57249994e-04,-6.82129001e-04,
+     6.96512521e-04,-6.21226791e-04, 4.84383287e-04,-3.16011196e-04, 1.43692800e-04, 1.04877099e-05,
+    -1.31591805e-04, 2.12169602e-04,-2.51541089e-04, 2.54344486e-04,-2.28708595e-04, 1.84381002e-04,
+    -1.31077293e-04, 7.72278581e-05,-2.92034292e-05,-8.99663155e-06, 3.56551500e-05,-5.08157900e-05,
+     5.61152483e-05,-5.40253204e-05, 4.71543499e-05,-3.78218792e-05, 2.78540592e-05,-1.85283097e-05,
+     1.06104799e-05,-4.44266016e-06, 5.15178513e-08, 2.74366107e-06,-4.23622896e-06, 4.75741581e-06,
+    -4.62380103e-06, 4.10537905e-06,-3.41112195e-06, 2.68729309e-06,-2.02436809e-06, 1.46819002e-06,
+    -1.03254501e-06, 7.10686322e-07,-4.84817406e-07, 3.32993807e-07,-2.33509596e-07, 1.67499607e-07,
+    -1.19870606e-07, 8.00784292e-08,-4.25679509e-08, 9.69625003e-09, 5.60288704e-09, 3.39902412e-10
+  }
+ },
+ { /* phase 29 */
+  {
+     0.00000000e+00, 6.38582715e-05, 8.71441234e-03, 1.34482101e-01,-3.69628310e-01, 1.84056103e-01,
+     4.61160094e-02,-1.19031899e-01, 9.53812674e-02,-4.09738682e-02,-8.40017945e-03, 3.94478887e-02,
+    -5.11226207e-02, 4.77106012e-02,-3.50245684e-02, 1.84529591e-02,-2.18147109e-03,-1.10571496e-02,
+     1.98516101e-02,-2.39027608e-02, 2.36880500e-02,-2.01955400e-02, 1.46184098e-02,-8.17015581e-03,
+     1.88828795e-03, 3.43020190e-03,-7.30708288e-03, 9.54214763e-03,-1.02066305e-02, 9.54283867e-03,
+    -7.92459212e-03, 5.74886380e-03,-3.40907299e-03, 1.21449004e-03, 6.00552710e-04,-1.91968901e-03,
+     2.70160101e-03,-2.99701793e-03, 2.88944994e-03,-2.50584306e-03, 1.95861701e-03,-1.36099698e-03,
+     8.01481889e-04,-3.33902397e-04,-1.82219792e-05, 2.53797014e-04,-3.86004715e-04, 4.35607595e-04,
+    -4.25634586e-04, 3.77911696e-04,-3.10809613e-04, 2.38391993e-04,-1.70207204e-04, 1.11880698e-04,
+    -6.57905111e-05, 3.20749714e-05,-9.36770903e-06,-4.37542212e-06, 1.14521099e-05,-1.39438098e-05,
+     1.36303397e-05,-1.18049002e-05, 9.40036443e-06,-6.94350001e-06, 4.75535808e-06,-2.93004405e-06,
+     1.52609505e-06,-5.16141426e-07,-6.16858671e-08, 2.25046406e-07,-5.31926787e-08,-9.13868892e-09
+  },
+  {
+     0.00000000e+00, 7.29257681e-06, 4.92900203e-04, 4.39395290e-03, 1.04923602e-02, 3.85657488e-03,
+    -5.83838206e-03, 2.34760297e-03, 1.05133001e-03,-2.73687812e-03, 2.86251097e-03,-2.05756095e-03,
+     9.12699092e-04, 1.65326594e-04,-9.56243777e-04, 1.38425804e-03,-1.46961503e-03, 1.28675799e-03,
+    -9.32329509e-04, 5.02759300e-04,-8.00892376e-05,-2.75527709e-04, 5.28163975e-04,-6.64684922e-04,
+     6.90811081e-04,-6.25806395e-04, 4.96755703e-04,-3.33210395e-04, 1.62762401e-04,-7.88254511e-06,
+    -1.15861701e-04, 2.00284907e-04,-2.43984294e-04, 2.50979007e-04,-2.28938603e-04, 1.87332698e-04,
+    -1.35773895e-04, 8.27346885e-05,-3.47319183e-05,-4.03009290e-06, 3.16129408e-05,-4.78522197e-05,
+     5.42134912e-05,-5.30522193e-05, 4.69152510e-05,-3.81048303e-05, 2.84607504e-05,-1.92923799e-05,
+     1.14055201e-05,-5.18263096e-06, 6.86248313e-07, 2.23557504e-06,-3.85535805e-06, 4.49100980e-06,
+    -4.45211981e-06, 4.00651288e-06,-3.36426001e-06, 2.67462110e-06,-2.03187710e-06, 1.48570405e-06,
+    -1.05326501e-06, 7.30513307e-07,-5.01609804e-07, 3.45914287e-07,-2.42494195e-07, 1.72906994e-07,
+    -1.22272994e-07, 8.02075490e-08,-4.13685299e-08, 8.40754932e-09, 5.76736303e-09, 3.51476487e-10
+  }
+ },
+ { /* phase 30 */
+  {
+     0.00000000e+00, 7.11508474e-05, 9.20731202e-03, 1.38876095e-01,-3.59135896e-01, 1.87912703e-01,
+     4.02776301e-02,-1.16684198e-01, 9.64325964e-02,-4.37107496e-02,-5.53766685e-03, 3.73903289e-02,
+    -5.02099209e-02, 4.78759296e-02,-3.59808095e-02, 1.98372193e-02,-3.65108601e-03,-9.77039058e-03,
+     1.89192798e-02,-2.33999994e-02, 2.36079600e-02,-2.04710700e-02, 1.51465796e-02,-8.83483980e-03,
+     2.57909903e-03, 2.80439504e-03,-6.81032706e-03, 9.20893718e-03,-1.00438697e-02, 9.53495689e-03,
+    -8.04045424e-03, 5.94914891e-03,-3.65305692e-03, 1.46546902e-03, 3.71614093e-04,-1.73235696e-03,
+     2.56582699e-03,-2.91428389e-03, 2.85471790e-03,-2.50987289e-03, 1.99023006e-03,-1.40884903e-03,
+     8.55695398e-04,-3.86954605e-04, 2.86932700e-05, 2.15692198e-04,-3.57543904e-04, 4.16315190e-04,
+    -4.14229115e-04, 3.72729090e-04,-3.10123403e-04, 2.40627502e-04,-1.74062603e-04, 1.16371702e-04,
+    -7.02426332e-05, 3.60814884e-05,-1.27319699e-05,-1.70080102e-06, 9.42023507e-06,-1.24581102e-05,
+     1.25770803e-05,-1.10743904e-05, 8.89875355e-06,-6.59758598e-06, 4.51286314e-06,-2.75713592e-06,
+     1.40382201e-06,-4.35933913e-07,-1.03054397e-07, 2.33453903e-07,-4.74253099e-08,-8.78721185e-09
+  },
+  {
+     0.00000000e+00, 8.00456928e-06, 5.16186992e-04, 4.49749082e-03, 1.05237998e-02, 3.63943097e-03,
+    -5.83219202e-03, 2.48250598e-03, 9.08251328e-04,-2.65691290e-03, 2.85839010e-03,-2.11045495e-03,
+     9.93818743e-04, 8.23730006e-05,-8.90079013e-04, 1.34463201e-03,-1.45855197e-03, 1.30065496e-03,
+    -9.64246923e-04, 5.44475392e-04,-1.23707097e-04,-2.36487307e-04, 4.98170499e-04,-6.46038621e-04,
+     6.83818827e-04,-6.29182789e-04, 5.08142228e-04,-3.49716807e-04, 1.81456402e-04,-2.61745008e-05,
+    -9.99640979e-05, 1.88056802e-04,-2.35983694e-04, 2.47139687e-04,-2.28722201e-04, 1.89906801e-04,
+    -1.40184697e-04, 8.80544903e-05,-4.01662001e-05, 9.20099808e-07, 2.75289403e-05,-4.48095598e-05,
+     5.22143491e-05,-5.19787500e-05, 4.65835801e-05,-3.83095103e-05, 2.90063399e-05,-2.00126397e-05,
+     1.21723097e-05,-5.90719310e-06, 1.31531499e-06, 1.72639204e-06,-3.46921911e-06, 4.21721916e-06,
+    -4.27243003e-06, 3.89999104e-06,-3.31064803e-06, 2.65634208e-06,-2.03493596e-06, 1.49981497e-06,
+    -1.07145604e-06, 7.48496916e-07,-5.17069509e-07, 3.57868487e-07,-2.50770910e-07, 1.77792103e-07,
+    -1.24297799e-07, 8.00869415e-08,-4.00467606e-08, 7.11449610e-09, 5.88561022e-09, 3.49668489e-10
+  }
+ },
+ { /* phase 31 */
+  {
+     0.00000000e+00, 7.91554194e-05, 9.72349942e-03, 1.43373594e-01,-3.48612189e-01, 1.91552103e-01,
+     3.44454311e-02,-1.14201702e-01, 9.73408520e-02,-4.63676602e-02,-2.67927791e-03, 3.52798700e-02,
+    -4.92160991e-02, 4.79582995e-02,-3.68708894e-02, 2.11818498e-02,-5.10963798e-03,-8.46973713e-03,
+     1.79550406e-02,-2.28555202e-02, 2.34842598e-02,-2.07075607e-02, 1.56447496e-02,-9.48087871e-03,
+     3.26291798e-03, 2.17521307e-03,-6.30218489e-03, 8.85922089e-03,-9.86240990e-03, 9.50878207e-03,
+    -8.14041775e-03, 6.13720622e-03,-3.88904102e-03, 1.71260897e-03, 1.42891906e-04,-1.54245005e-03,
+     2.42564199e-03,-2.82622897e-03, 2.81455205e-03,-2.50895298e-03, 2.01775902e-03,-1.45365798e-03,
+     9.07909707e-04,-4.38933406e-04, 7.52768465e-05, 1.77382695e-04,-3.28537601e-04, 3.96302610e-04,
+    -4.02056699e-04, 3.66821914e-04,-3.08807997e-04, 2.42353897e-04,-1.77531794e-04, 1.20588898e-04,
+    -7.45150610e-05, 3.99814817e-05,-1.60426207e-05, 9.55540941e-07, 7.38529889e-06,-1.09582897e-05,
+     1.15056200e-05,-1.03258899e-05, 8.38168489e-06,-6.23971710e-06, 4.26209181e-06,-2.57934403e-06,
+     1.27952399e-06,-3.55846907e-07,-1.43101204e-07, 2.40568397e-07,-4.15396997e-08,-8.43754400e-09
+  },
+  {
+     0.00000000e+00, 8.77471757e-06, 5.40333800e-04, 4.60205693e-03, 1.05514098e-02, 3.42103210e-03,
+    -5.81975281e-03, 2.61353701e-03, 7.64580385e-04,-2.57330900e-03, 2.84978910e-03,-2.15971610e-03,
+     1.07299699e-03,-4.57046696e-07,-8.22560803e-04, 1.30273902e-03,-1.44490099e-03, 1.31215097e-03,
+    -9.94308502e-04, 5.85069472e-04,-1.66971993e-04,-1.97116300e-04, 4.67328209e-04,-6.26228575e-04,
+     6.75552816e-04,-6.31353294e-04, 5.18523972e-04,-3.65501095e-04, 1.99740098e-04,-4.43532190e-05,
+    -8.39303029e-05, 1.75510198e-04,-2.27556506e-04, 2.42835697e-04,-2.28061806e-04, 1.92099702e-04,
+    -1.44302205e-04, 9.31776667e-05,-4.54960209e-05, 5.84427198e-06, 2.34114304e-05,-4.16942712e-05,
+     5.01223585e-05,-5.08076082e-05, 4.61605305e-05,-3.84359810e-05, 2.94901092e-05,-2.06878995e-05,
+     1.29094897e-05,-6.61496779e-06, 1.93746700e-06, 1.21716596e-06,-3.07864707e-06, 3.93666414e-06,
+    -4.08516416e-06, 3.78609411e-06,-3.25045107e-06, 2.63253696e-06,-2.03357604e-06, 1.51052200e-06,
+    -1.08710003e-06, 7.64612992e-07,-5.31173100e-07, 3.68837306e-07,-2.58326708e-07, 1.82148099e-07,
+    -1.25944098e-07, 7.97206710e-08,-3.86095103e-08, 5.82300919e-09, 5.95805494e-09, 3.36399991e-10
+  }
+ },
+ { /* phase 32 */
+  {
+     0.00000000e+00, 8.79301369e-05, 1.02638304e-02, 1.47975594e-01,-3.38060707e-01, 1.94973201e-01,
+     2.86256801e-02,-1.11588202e-01, 9.81054306e-02,-4.89409715e-02, 1.70510903e-04, 3.31201591e-02,
+    -4.81431000e-02, 4.79578488e-02,-3.76934484e-02, 2.24845894e-02,-6.55453885e-03,-7.15758605e-03,
+     1.69607308e-02,-2.22704504e-02, 2.33172793e-02,-2.09046695e-02, 1.61120798e-02,-1.01071103e-02,
+     3.93847097e-03, 1.54385902e-03,-5.78366080e-03, 8.49371869e-03,-9.66267008e-03, 9.46442876e-03,
+    -8.22434761e-03, 6.31271582e-03,-4.11659712e-03, 1.95544492e-03,-8.51698715e-05,-1.35034998e-03,
+     2.28134007e-03,-2.73305201e-03, 2.76905601e-03,-2.50310893e-03, 2.04117107e-03,-1.49535295e-03,
+     9.58032091e-04,-4.89740982e-04, 1.21437399e-04, 1.38946707e-04,-2.99047504e-04, 3.75614705e-04,
+    -3.89147288e-04, 3.60206992e-04,-3.06870614e-04, 2.43571107e-04,-1.80610499e-04, 1.24525599e-04,
+    -7.86002274e-05, 4.37675699e-05,-1.92930693e-05, 3.58807802e-06, 5.35172285e-06,-9.44777184e-06,
+     1.04185201e-05,-9.56127678e-06, 7.85051179e-06,-5.87088016e-06, 4.00376621e-06,-2.39719611e-06,
+     1.15358000e-06,-2.76126286e-07,-1.81710703e-07, 2.46391409e-07,-3.55816496e-08,-8.10114376e-09
+  },
+  {
+     0.00000000e+00, 9.60686521e-06, 5.65361406e-04, 4.70761489e-03, 1.05751399e-02, 3.20153800e-03,
+    -5.80109796e-03, 2.74054590e-03, 6.20518811e-04,-2.48620310e-03, 2.83673592e-03,-2.20527407e-03,
+     1.15010701e-03,-8.30219069e-05,-7.53810920e-04, 1.25865696e-03,-1.42869295e-03, 1.32123195e-03,
+    -1.02246401e-03, 6.24469598e-04,-2.09804697e-04,-1.57489107e-04, 4.35697497e-04,-6.05295820e-04,
+     6.66032312e-04,-6.32317271e-04, 5.27884578e-04,-3.80535290e-04, 2.17579800e-04,-6.23841115e-05,
+    -6.77916978e-05, 1.62670694e-04,-2.18720597e-04, 2.38077395e-04,-2.26960401e-04, 1.93908694e-04,
+    -1.48119696e-04, 9.80950790e-05,-5.07113909e-05, 1.07328397e-05, 1.92687203e-05,-3.85129206e-05,
+     4.79421687e-05,-4.95416716e-05, 4.56474700e-05,-3.84844316e-05, 2.99114399e-05,-2.13170697e-05,
+     1.36157196e-05,-7.30462079e-06, 2.55147597e-06, 7.08945379e-07,-2.68447798e-06, 3.64997709e-06,
+    -3.89076922e-06, 3.66511699e-06,-3.18384900e-06, 2.60330103e-06,-2.02783394e-06, 1.51783001e-06,
+    -1.10018505e-06, 7.78841695e-07,-5.43900626e-07, 3.78804287e-07,-2.65150305e-07, 1.85969597e-07,
+    -1.27212203e-07, 7.91135122e-08,-3.70639412e-08, 4.53890703e-09, 5.98543615e-09, 3.13922194e-10
+  }
+ },
+ { /* phase 33 */
+  {
+     0.00000000e+00, 9.75369985e-05, 1.08291898e-02, 1.52683198e-01,-3.27485591e-01, 1.98174700e-01,
+     2.28245798e-02,-1.08847700e-01, 9.87259522e-02,-5.14271706e-02, 3.00724711e-03, 3.09148803e-02,
+    -4.69929986e-02, 4.78748195e-02,-3.84472609e-02, 2.37432402e-02,-7.98323192e-03,-5.83635410e-03,
+     1.59382597e-02,-2.16459800e-02, 2.31074803e-02,-2.10621599e-02, 1.65477693e-02,-1.07124001e-02,
+     4.60450305e-03, 9.11541982e-04,-5.25577599e-03, 8.11318401e-03,-9.44508985e-03, 9.40204505e-03,
+    -8.29214044e-03, 6.47538714e-03,-4.33531823e-03, 2.19352194e-03,-3.12130287e-04,-1.15644198e-03,
+     2.13321997e-03,-2.63495604e-03, 2.71834503e-03,-2.49237590e-03, 2.06043897e-03,-1.53386605e-03,
+     1.00597402e-03,-5.39282686e-04, 1.67084800e-04, 1.00462297e-04,-2.69136013e-04, 3.54297605e-04,
+    -3.75531497e-04, 3.52902309e-04,-3.04319110e-04, 2.44280003e-04,-1.83294906e-04, 1.28175496e-04,
+    -8.24909876e-05, 4.74326916e-05,-2.24769192e-05, 6.19137882e-06, 3.32388890e-06,-7.92994160e-06,
+     9.31833620e-06,-8.78243463e-06, 7.30661122e-06,-5.49207607e-06, 3.73861508e-06,-2.21122696e-06,
+     1.02636795e-06,-1.97012795e-07,-2.18774602e-07, 2.50930412e-07,-2.95962099e-08,-7.78722065e-09
+  },
+  {
+     0.00000000e+00, 1.05050403e-05, 5.91290416e-04, 4.81412420e-03, 1.05948905e-02, 2.98111001e-03,
+    -5.77626610e-03, 2.86339107e-03, 4.76267800e-04,-2.39573605e-03, 2.81926594e-03,-2.24706810e-03,
+     1.22502598e-03,-1.65180798e-04,-6.83952821e-04, 1.21247105e-03,-1.40996405e-03, 1.32788799e-03,
+    -1.04866805e-03, 6.62606384e-04,-2.52126600e-04,-1.17680604e-04, 4.03339887e-04,-5.83282788e-04,
+     6.55279320e-04,-6.32076699e-04, 5.36209205e-04,-3.94793111e-04, 2.34942694e-04,-8.02329814e-05,
+    -5.15797983e-05, 1.49564003e-04,-2.09494799e-04, 2.32875595e-04,-2.25421900e-04, 1.95332104e-04,
+    -1.51631000e-04, 1.02798003e-04,-5.58026004e-05, 1.55763501e-05, 1.51091299e-05,-3.52721399e-05,
+     4.56786001e-05,-4.81839998e-05, 4.50459411e-05,-3.84552295e-05, 3.02698609e-05,-2.18991609e-05,
+     1.42897798e-05,-7.97486064e-06, 3.15614011e-06, 2.02768106e-07,-2.28755198e-06, 3.35779509e-06,
+    -3.68970200e-06, 3.53736596e-06,-3.11103008e-06, 2.56874000e-06,-2.01775993e-06, 1.52175096e-06,
+    -1.11070403e-06, 7.91167679e-07,-5.55235317e-07, 3.87755392e-07,-2.71232494e-07, 1.89252802e-07,
+    -1.28103295e-07, 7.82709577e-08,-3.54175285e-08, 3.26788507e-09, 5.96879302e-09, 2.84756302e-10
+  }
+ },
+ { /* phase 34 */
+  {
+     0.00000000e+00, 1.08041997e-04, 1.14204800e-02, 1.57497406e-01,-3.16890687e-01, 2.01155797e-01,
+     1.70483198e-02,-1.05984300e-01, 9.92022231e-02,-5.38229086e-02, 5.82651189e-03, 2.86678206e-02,
+    -4.57679704e-02, 4.77096401e-02,-3.91312093e-02, 2.49557104e-02,-9.39319562e-03,-4.50846506e-03,
+     1.48895998e-02,-2.09833793e-02, 2.28553507e-02,-2.11798400e-02, 1.69511102e-02,-1.12956902e-02,
+     5.25978208e-03, 2.79465312e-04,-4.71956702e-03, 7.71839079e-03,-9.21014696e-03, 9.32181161e-03,
+    -8.34371988e-03, 6.62495103e-03,-4.54481319e-03, 2.42639799e-03,-5.37552172e-04,-9.61109414e-04,
+     1.98158901e-03,-2.53215805e-03, 2.66254204e-03,-2.47680000e-03, 2.07554898e-03,-1.56913802e-03,
+     1.05165294e-03,-5.87466697e-04, 2.12130806e-04, 6.20070277e-05,-2.38866196e-04, 3.32398486e-04,
+    -3.61241808e-04, 3.44927510e-04,-3.01163003e-04, 2.44482799e-04,-1.85582496e-04, 1.31533307e-04,
+    -8.61806984e-05, 5.09700585e-05,-2.55879495e-05, 8.76011927e-06, 1.30613000e-06,-6.40819098e-06,
+     8.20763216e-06,-7.99126701e-06, 6.75137608e-06,-5.10431983e-06, 3.46738307e-06,-2.02197407e-06,
+     8.98264773e-07,-1.18741802e-07,-2.54192088e-07, 2.54198198e-07,-2.36274200e-08,-7.50246532e-09
+  },
+  {
+     0.00000000e+00, 1.14734903e-05, 6.18141610e-04, 4.92154201e-03, 1.06106196e-02, 2.75991205e-03,
+    -5.74530102e-03, 2.98193004e-03, 3.32028605e-04,-2.30205501e-03, 2.79742107e-03,-2.28503905e-03,
+     1.29763398e-03,-2.46793992e-04,-6.13111595e-04, 1.16426905e-03,-1.38875598e-03, 1.33211503e-03,
+    -1.07287604e-03, 6.99412776e-04,-2.93860590e-04,-7.77656678e-05, 3.70318390e-04,-5.60234301e-04,
+     6.43317471e-04,-6.30635594e-04, 5.43485221e-04,-4.08249587e-04, 2.51796999e-04,-9.78660973e-05,
+    -3.53261385e-05, 1.36216506e-04,-1.99898306e-04, 2.27242301e-04,-2.23451207e-04, 1.96368506e-04,
+    -1.54830603e-04, 1.07278101e-04,-6.07602087e-05, 2.03654799e-05, 1.09409702e-05,-3.19786886e-05,
+     4.33366185e-05,-4.67378195e-05, 4.43576682e-05,-3.83488987e-05, 3.05650392e-05,-2.24332907e-05,
+     1.49304997e-05,-8.62444904e-06, 3.75028094e-06,-3.00338797e-07,-1.88870797e-06, 3.06076504e-06,
+    -3.48243202e-06, 3.40316092e-06,-3.03219804e-06, 2.52897007e-06,-2.00340901e-06, 1.52230496e-06,
+    -1.11865404e-06, 8.01580086e-07,-5.65163873e-07, 3.95679194e-07,-2.76565999e-07, 1.91995298e-07,
+    -1.28620002e-07, 7.71991395e-08,-3.36779600e-08, 2.01549000e-09, 5.90945382e-09, 2.51617893e-10
+  }
+ },
+ { /* phase 35 */
+  {
+     0.00000000e+00, 1.19515498e-04, 1.20386304e-02, 1.62418902e-01,-3.06280106e-01, 2.03915700e-01,
+     1.13030197e-02,-1.03002302e-01, 9.95342433e-02,-5.61249591e-02, 8.62393342e-03, 2.63827797e-02,
+    -4.44703400e-02, 4.74628508e-02,-3.97443213e-02, 2.61199791e-02,-1.07819503e-02,-3.17635108e-03,
+     1.38167199e-02,-2.02839598e-02, 2.25614905e-02,-2.12576091e-02, 1.73214301e-02,-1.18559198e-02,
+     5.90310013e-03,-3.51170311e-04,-4.17608209e-03, 7.31014181e-03,-8.95834994e-03, 9.22394637e-03,
+    -8.37904587e-03, 6.76116813e-03,-4.74471087e-03, 2.65364000e-03,-7.61003408e-04,-7.64740922e-04,
+     1.82675896e-03,-2.42487993e-03, 2.60178209e-03,-2.45643407e-03, 2.08648993e-03,-1.60111603e-03,
+     1.09498901e-03,-6.34204480e-04, 2.56488507e-04, 2.36581309e-05,-2.08301106e-04, 3.09965195e-04,
+    -3.46311310e-04, 3.36302997e-04,-2.97412713e-04, 2.44182505e-04,-1.87471203e-04, 1.34594098e-04,
+    -8.96631318e-05, 5.43732203e-05,-2.86201393e-05, 1.12890903e-05,-6.97279120e-07,-4.88588603e-06,
+     7.08897778e-06,-7.18968704e-06, 6.18621198e-06,-4.70864097e-06, 3.19081710e-06,-1.82997906e-06,
+     7.69644828e-07,-4.15426484e-08,-2.87870108e-07, 2.56213696e-07,-1.77179693e-08,-7.25084703e-09
+  },
+  {
+     0.00000000e+00, 1.25166298e-05, 6.45935826e-04, 5.02982689e-03, 1.06222602e-02, 2.53810897e-03,
+    -5.70825394e-03, 3.09603103e-03, 1.88001897e-04,-2.20530992e-03, 2.77124904e-03,-2.31913989e-03,
+     1.36781705e-03,-3.27723101e-04,-5.41413901e-04, 1.11414294e-03,-1.36511202e-03, 1.33390899e-03,
+    -1.09505001e-03, 7.34824513e-04,-3.34930693e-04,-3.78191107e-05, 3.36696801e-04,-5.36196691e-04,
+     6.30173308e-04,-6.28000300e-04, 5.49701916e-04,-4.20881697e-04, 2.68112111e-04,-1.15250303e-04,
+    -1.90622304e-05, 1.22654907e-04,-1.89951097e-04, 2.21189999e-04,-2.21053793e-04, 1.97017696e-04,
+    -1.57713497e-04, 1.11527697e-04,-6.55751064e-05, 2.50910307e-05, 6.77251001e-06,-2.86393697e-05,
+     4.09213098e-05,-4.52065215e-05, 4.35845213e-05,-3.81661011e-05, 3.07967603e-05,-2.29186608e-05,
+     1.55367907e-05,-9.25219229e-06, 4.33275318e-06,-7.99361487e-07,-1.48878405e-06, 2.75953698e-06,
+    -3.26943791e-06, 3.26283293e-06,-2.94756410e-06, 2.48411607e-06,-1.98484804e-06, 1.51951895e-06,
+    -1.12404200e-06, 8.10072606e-07,-5.73676573e-07, 4.02566911e-07,-2.81145390e-07, 1.94196204e-07,
+    -1.28765606e-07, 7.59048575e-08,-3.18531690e-08, 7.87090615e-10, 5.80903103e-09, 2.17321300e-10
+  }
+ },
+ { /* phase 36 */
+  {
+     0.00000000e+00, 1.32032204e-04, 1.26845604e-02, 1.67448699e-01,-2.95657814e-01, 2.06453800e-01,
+     5.59476204e-03,-9.99063104e-02, 9.97222513e-02,-5.83302714e-02, 1.13951797e-02, 2.40636393e-02,
+    -4.31025214e-02, 4.71351296e-02,-4.02857400e-02, 2.72341296e-02,-1.21470597e-02,-1.84244197e-03,
+     1.27216699e-02,-1.95491407e-02, 2.22265609e-02,-2.12954301e-02, 1.76581293e-02,-1.23921204e-02,
+     6.53327303e-03,-9.79170552e-04,-3.62638012e-03, 6.88925991e-03,-8.69023800e-03, 9.10869520e-03,
+    -8.39810818e-03, 6.88382285e-03,-4.93466202e-03, 2.87483004e-03,-9.82057187e-04,-5.67723298e-04,
+     1.66904496e-03,-2.31335289e-03, 2.53620697e-03,-2.43134308e-03, 2.09326204e-03,-1.62975595e-03,
+     1.13591098e-03,-6.79410994e-04, 3.00073007e-04,-1.45079803e-05,-1.77504393e-04, 2.87046510e-04,
+    -3.30774492e-04, 3.27050802e-04,-2.93079909e-04, 2.43383096e-04,-1.88959995e-04, 1.37353607e-04,
+    -9.29325688e-05, 5.76360508e-05,-3.15677098e-05, 1.37732004e-05,-2.68212693e-06,-3.36636595e-06,
+     5.96493601e-06,-6.37961512e-06, 5.61253501e-06,-4.30607406e-06, 2.90967091e-06,-1.63578204e-06,
+     6.40879193e-07, 3.43621984e-08,-3.19723313e-07, 2.57000806e-07,-1.19089396e-08,-7.03352621e-09
+  },
+  {
+     0.00000000e+00, 1.36391200e-05, 6.74693729e-04, 5.13893086e-03, 1.06297396e-02, 2.31586699e-03,
+    -5.66518400e-03, 3.20556504e-03, 4.43876706e-05,-2.10565701e-03, 2.74080504e-03,-2.34932499e-03,
+     1.43546402e-03,-4.07831103e-04,-4.68987389e-04, 1.06218504e-03,-1.33908202e-03, 1.33327499e-03,
+    -1.11515599e-03, 7.68779893e-04,-3.75262491e-04, 2.08426900e-06, 3.02539906e-04,-5.11218212e-04,
+     6.15875004e-04,-6.24179374e-04, 5.54850674e-04,-4.32667788e-04, 2.83858506e-04,-1.32352900e-04,
+    -2.81948610e-06, 1.08906301e-04,-1.79673894e-04, 2.14732296e-04,-2.18236004e-04, 1.97279893e-04,
+    -1.60275493e-04, 1.15539500e-04,-7.02385005e-05, 2.97440201e-05, 2.61200103e-06,-2.52610498e-05,
+     3.84378691e-05,-4.35936308e-05, 4.27285413e-05,-3.79076591e-05, 3.09649186e-05,-2.33545998e-05,
+     1.61076296e-05,-9.85695078e-06, 4.90244020e-06,-1.29330203e-06,-1.08861298e-06, 2.45476895e-06,
+    -3.05120602e-06, 3.11672193e-06,-2.85735405e-06, 2.43431509e-06,-1.96215092e-06, 1.51342704e-06,
+    -1.12687701e-06, 8.16643308e-07,-5.80766880e-07, 4.08412291e-07,-2.84967314e-07, 1.95856003e-07,
+    -1.28544698e-07, 7.43954871e-08,-2.99512593e-08,-4.12142293e-10, 5.66939917e-09, 1.84665797e-10
+  }
+ },
+ { /* phase 37 */
+  {
+     0.00000000e+00, 1.45671307e-04, 1.33592598e-02, 1.72587693e-01,-2.85028100e-01, 2.08769694e-01,
+    -7.04221529e-05,-9.67007428e-02, 9.97666270e-02,-6.04359284e-02, 1.41359903e-02, 2.17143092e-02,
+    -4.16670516e-02, 4.67272997e-02,-4.07547317e-02, 2.82963105e-02,-1.34861497e-02,-5.09166275e-04,
+     1.16065098e-02,-1.87803600e-02, 2.18512993e-02,-2.12933403e-02, 1.79606695e-02,-1.29033402e-02,
+     7.14914780e-03,-1.60335004e-03,-3.07152909e-03, 6.45659212e-03,-8.40638019e-03, 8.97634309e-03,
+    -8.40092823e-03, 6.99272892e-03,-5.11433603e-03, 3.08956206e-03,-1.20029296e-03,-3.70443391e-04,
+     1.50877004e-03,-2.19781301e-03, 2.46596802e-03,-2.40159896e-03, 2.09587393e-03,-1.65501703e-03,
+     1.17434899e-03,-7.23004574e-04, 3.42801504e-04,-5.24156312e-05,-1.46539402e-04, 2.63691909e-04,
+    -3.14666802e-04, 3.17193888e-04,-2.88177514e-04, 2.42089794e-04,-1.90048595e-04, 1.39808399e-04,
+    -9.59837707e-05, 6.07527691e-05,-3.44250584e-05, 1.62075194e-05,-4.64427785e-06,-1.85293902e-06,
+     4.83805889e-06,-5.56297118e-06, 5.03176807e-06,-3.89766183e-06, 2.62470394e-06,-1.43992600e-06,
+     5.12334509e-07, 1.08757703e-07,-3.49674508e-07, 2.56588692e-07,-6.23953600e-09,-6.84886015e-09
+  },
+  {
+     0.00000000e+00, 1.48458203e-05, 7.04436214e-04, 5.24881016e-03, 1.06330104e-02, 2.09335703e-03,
+    -5.61615592e-03, 3.31041007e-03,-9.86150117e-05,-2.00325297e-03, 2.70615099e-03,-2.37555802e-03,
+     1.50046998e-03,-4.86982986e-04,-3.95960786e-04, 1.00849394e-03,-1.31071894e-03, 1.33022096e-03,
+    -1.13315997e-03, 8.01220303e-04,-4.14782902e-04, 4.18700110e-05, 2.67913507e-04,-4.85348806e-04,
+     6.00453117e-04,-6.19183818e-04, 5.58925094e-04,-4.43588011e-04, 2.99007690e-04,-1.49141895e-04,
+     1.33708199e-05, 9.49977621e-05,-1.69087900e-04, 2.07883102e-04,-2.15005202e-04, 1.97156201e-04,
+    -1.62512995e-04, 1.19306700e-04,-7.47419108e-05, 3.43156207e-05,-1.53237397e-06,-2.18506302e-05,
+     3.58916295e-05,-4.19028293e-05, 4.17919182e-05,-3.75745294e-05, 3.10695905e-05,-2.37405402e-05,
+     1.66420905e-05,-1.04376404e-05, 5.45826015e-06,-1.78117796e-06,-6.89024603e-07, 2.14711690e-06,
+    -2.82822998e-06, 2.96517896e-06,-2.76180094e-06, 2.37971290e-06,-1.93539995e-06, 1.50407095e-06,
+    -1.12717498e-06, 8.21294407e-07,-5.86431781e-07, 4.13211808e-07,-2.88030407e-07, 1.96976799e-07,
+    -1.27962593e-07, 7.26790077e-08,-2.79804802e-08,-1.57725299e-09, 5.49268098e-09, 1.56294200e-10
+  }
+ },
+ { /* phase 38 */
+  {
+     0.00000000e+00, 1.60517098e-04, 1.40636899e-02, 1.77836493e-01,-2.74395108e-01, 2.10863099e-01,
+    -5.68657788e-03,-9.33903307e-02, 9.96680185e-02,-6.24391809e-02, 1.68421399e-02, 1.93387493e-02,
+    -4.01665792e-02, 4.62403111e-02,-4.11506891e-02, 2.93048099e-02,-1.47968596e-02, 8.21054971e-04,
+     1.04733501e-02,-1.79791395e-02, 2.14365199e-02,-2.12514699e-02, 1.82285793e-02,-1.33886803e-02,
+     7.74960080e-03,-2.22253404e-03,-2.51260400e-03, 6.01300411e-03,-8.10737163e-03, 8.82720109e-03,
+    -8.38755723e-03, 7.08772708e-03,-5.28342417e-03, 3.29744606e-03,-1.41529797e-03,-1.73287204e-04,
+     1.34625705e-03,-2.07850593e-03, 2.39122706e-03,-2.36728392e-03, 2.09434191e-03,-1.67686795e-03,
+     1.21023995e-03,-7.64907512e-04, 3.84593412e-04,-8.99901715e-05,-1.15469797e-04, 2.39951405e-04,
+    -2.98024708e-04, 3.06756207e-04,-2.82719207e-04, 2.40308596e-04,-1.90737599e-04, 1.41955505e-04,
+    -9.88120009e-05, 6.37179473e-05,-3.71868591e-05, 1.85872304e-05,-6.57967803e-06,-3.48868411e-07,
+     3.71088390e-06,-4.74167700e-06, 4.44533680e-06,-3.48444996e-06, 2.33667402e-06,-1.24295002e-06,
+     3.84371901e-07, 1.81436704e-07,-3.77654999e-07, 2.55011400e-07,-7.46855411e-10,-6.69256606e-09
+  },
+  {
+     3.12047693e-10, 1.61418102e-05, 7.35183596e-04, 5.35941310e-03, 1.06320102e-02, 1.87074800e-03,
+    -5.56124002e-03, 3.41045111e-03,-2.40808498e-04,-1.89826195e-03, 2.66735489e-03,-2.39780894e-03,
+     1.56273297e-03,-5.65045513e-04,-3.22463311e-04, 9.53169714e-04,-1.28007994e-03, 1.32475898e-03,
+    -1.14903704e-03, 8.32089805e-04,-4.53420711e-04, 8.14640734e-05, 2.32883802e-04,-4.58639697e-04,
+     5.83940186e-04,-6.13026612e-04, 5.61920810e-04,-4.53624292e-04, 3.13532713e-04,-1.65586200e-04,
+     2.94776401e-05, 8.09569319e-05,-1.58214694e-04, 2.00657305e-04,-2.11369101e-04, 1.96648602e-04,
+    -1.64423094e-04, 1.22822894e-04,-7.90772392e-05, 3.87972104e-05,-5.65250321e-06,-1.84150504e-05,
+     3.32879790e-05,-4.01379293e-05, 4.07769985e-05,-3.71678289e-05, 3.11109288e-05,-2.40759891e-05,
+     1.71393094e-05,-1.09932398e-05, 5.99916802e-06,-2.26202701e-06,-2.90839495e-07, 1.83724103e-06,
+    -2.60101001e-06, 2.80856398e-06,-2.66114898e-06, 2.32046409e-06,-1.90468802e-06, 1.49149696e-06,
+    -1.12495798e-06, 8.24033009e-07,-5.90671675e-07, 4.16964298e-07,-2.90335009e-07, 1.97561803e-07,
+    -1.27025700e-07, 7.07639529e-08,-2.59492303e-08,-2.70352207e-09, 5.28123500e-09, 1.34532802e-10
+  }
+ },
+ { /* phase 39 */
+  {
+     3.12047693e-10, 1.76658898e-04, 1.47988796e-02, 1.83195904e-01,-2.63763100e-01, 2.12733805e-01,
+    -1.12478202e-02,-8.99798796e-02, 9.94272083e-02,-6.43374473e-02, 1.95094906e-02, 1.69409402e-02,
+    -3.86038497e-02, 4.56752703e-02,-4.14731503e-02, 3.02579794e-02,-1.60769392e-02, 2.14581401e-03,
+     9.32431594e-03,-1.71470493e-02, 2.09830999e-02,-2.11700108e-02, 1.84614696e-02,-1.38473203e-02,
+     8.33354145e-03,-2.83555989e-03,-1.95068296e-03, 5.55938017e-03,-7.79383909e-03, 8.66161380e-03,
+    -8.35807901e-03, 7.16868415e-03,-5.44163911e-03, 3.49810300e-03,-1.62666698e-03, 2.33614701e-05,
+     1.18183298e-03,-1.95568311e-03, 2.31214892e-03,-2.32848711e-03, 2.08868901e-03,-1.69528299e-03,
+     1.24352798e-03,-8.05045420e-04, 4.25370410e-04,-1.27157997e-04,-8.43589223e-05, 2.15875407e-04,
+    -2.80885404e-04, 2.95762991e-04,-2.76720093e-04, 2.38046603e-04,-1.91028405e-04, 1.43792800e-04,
+    -1.01413003e-04, 6.65265179e-05,-3.98480115e-05, 2.09077007e-05,-8.48436594e-06, 1.14262900e-06,
+     2.58592604e-06,-3.91764388e-06, 3.85466501e-06,-3.06748598e-06, 2.04633898e-06,-1.04538799e-06,
+     2.57346187e-07, 2.52200607e-07,-4.03604190e-07, 2.52307899e-07, 4.53437998e-09,-6.55803278e-09
+  },
+  {
+     2.20660698e-10, 1.75324203e-05, 7.66956713e-04, 5.47068985e-03, 1.06266905e-02, 1.64821197e-03,
+    -5.50051313e-03, 3.50557803e-03,-3.81996593e-04,-1.79084903e-03, 2.62449100e-03,-2.41605192e-03,
+     1.62215601e-03,-6.41887600e-04,-2.48625001e-04, 8.96314508e-04,-1.24722696e-03, 1.31690397e-03,
+    -1.16276299e-03, 8.61335720e-04,-4.91106592e-04, 1.20792902e-04, 1.97518006e-04,-4.31143795e-04,
+     5.66370727e-04,-6.05722773e-04, 5.63835318e-04,-4.62760305e-04, 3.27407703e-04,-1.81655298e-04,
+     4.54701803e-05, 6.68114080e-05,-1.47076498e-04, 1.93070606e-04,-2.07336707e-04, 1.95759698e-04,
+    -1.66003301e-04, 1.26082494e-04,-8.32367587e-05, 4.31804001e-05,-9.74036266e-06,-1.49612497e-05,
+     3.06324400e-05,-3.83028892e-05, 3.96862597e-05,-3.66888198e-05, 3.10892283e-05,-2.43605900e-05,
+     1.75985206e-05,-1.15227604e-05, 6.52415383e-06,-2.73490991e-06, 1.05129203e-07, 1.52580105e-06,
+    -2.37005293e-06, 2.64724395e-06,-2.55565010e-06, 2.25673102e-06,-1.87011199e-06, 1.47576202e-06,
+    -1.12025100e-06, 8.24870028e-07,-5.93489972e-07, 4.19671210e-07,-2.91883595e-07, 1.97615805e-07,
+    -1.25741494e-07, 6.86593395e-08,-2.38659705e-08,-3.78649290e-09, 5.03762720e-09, 1.21199897e-10
+  }
+ },
+ { /* phase 40 */
+  {
+     5.32708377e-10, 1.94191307e-04, 1.55658303e-02, 1.88666597e-01,-2.53136396e-01, 2.14381993e-01,
+    -1.67483296e-02,-8.64742994e-02, 9.90452096e-02,-6.61282912e-02, 2.21339893e-02, 1.45248901e-02,
+    -3.69816907e-02, 4.50333804e-02,-4.17217799e-02, 3.11542898e-02,-1.73241701e-02, 3.46271810e-03,
+     8.16155318e-03,-1.62857100e-02, 2.04919893e-02,-2.10492201e-02, 1.86589900e-02,-1.42784696e-02,
+     8.89991224e-03,-3.44128301e-03,-1.38684805e-03, 5.09661902e-03,-7.46643217e-03, 8.47995933e-03,
+    -8.31260905e-03, 7.23549491e-03,-5.58871496e-03, 3.69117293e-03,-1.83400395e-03, 2.19121197e-04,
+     1.01582997e-03,-1.82960101e-03, 2.22891290e-03,-2.28530611e-03, 2.07894901e-03,-1.71024399e-03,
+     1.27416104e-03,-8.43348273e-04, 4.65056713e-04,-1.63846795e-04,-5.32696904e-05, 1.91514802e-04,
+    -2.63286900e-04, 2.84240203e-04,-2.70195887e-04, 2.35311702e-04,-1.90923296e-04, 1.45318598e-04,
+    -1.03783103e-04, 6.91737587e-05,-4.24036589e-05, 2.31644299e-05,-1.03544799e-05, 2.61839000e-06,
+     1.46567402e-06,-3.09277402e-06, 3.26117492e-06,-2.64781511e-06, 1.75445496e-06,-8.47772014e-07,
+     1.31604807e-07, 3.20860011e-07,-4.27470212e-07, 2.48521388e-07, 9.57200719e-09,-6.43683284e-09
+  },
+  {
+     3.32430694e-10, 1.90232004e-05, 7.99775706e-04, 5.58258919e-03, 1.06169898e-02, 1.42592005e-03,
+    -5.43405907e-03, 3.59568791e-03,-5.21984999e-04,-1.68118405e-03, 2.57764012e-03,-2.43027089e-03,
+     1.67864899e-03,-7.17381015e-04,-1.74575995e-04, 8.38033680e-04,-1.21222495e-03, 1.30667805e-03,
+    -1.17431895e-03, 8.88908398e-04,-5.27772994e-04, 1.59783798e-04, 1.61883407e-04,-4.02915291e-04,
+     5.47781121e-04,-5.97290113e-04, 5.64668328e-04,-4.70981206e-04, 3.40608094e-04,-1.97319401e-04,
+     6.13179727e-05, 5.25889518e-05,-1.35695896e-04, 1.85138895e-04,-2.02917305e-04, 1.94492706e-04,
+    -1.67252103e-04, 1.29080203e-04,-8.72131131e-05, 4.74570297e-05,-1.37880297e-05,-1.14961904e-05,
+     2.79305605e-05,-3.64017505e-05, 3.85223393e-05,-3.61388811e-05, 3.10049290e-05,-2.45940792e-05,
+     1.80190200e-05,-1.20253098e-05, 7.03224896e-06,-3.19890592e-06, 4.98078521e-07, 1.21345499e-06,
+    -2.13586895e-06, 2.48159290e-06,-2.44556509e-06, 2.18868695e-06,-1.83177804e-06, 1.45692502e-06,
+    -1.11308896e-06, 8.23820812e-07,-5.94893777e-07, 4.21336694e-07,-2.92680511e-07, 1.97145098e-07,
+    -1.24118102e-07, 6.63747173e-08,-2.17392397e-08,-4.82198281e-09, 4.76461715e-09, 1.17388502e-10
+  }
+ },
+ { /* phase 41 */
+  {
+     8.65139127e-10, 2.13214502e-04, 1.63656101e-02, 1.94249198e-01,-2.42519394e-01, 2.15807900e-01,
+    -2.21823901e-02,-8.28786194e-02, 9.85232294e-02,-6.78094774e-02, 2.47116294e-02, 1.20946197e-02,
+    -3.53030488e-02, 4.43160012e-02,-4.18963507e-02, 3.19923200e-02,-1.85364000e-02, 4.76939604e-03,
+     6.98723411e-03,-1.53968101e-02, 1.99642200e-02,-2.08894294e-02, 1.88208707e-02,-1.46813802e-02,
+     9.44769289e-03,-4.03857278e-03,-8.22179718e-04, 4.62563802e-03,-7.12582283e-03, 8.28264002e-03,
+    -8.25129077e-03, 7.28808390e-03,-5.72441099e-03, 3.87631194e-03,-2.03692191e-03, 4.13613889e-04,
+     8.48577998e-04,-1.70052098e-03, 2.14169896e-03,-2.23784894e-03, 2.06516101e-03,-1.72174000e-03,
+     1.30209106e-03,-8.79750005e-04, 5.03578980e-04,-1.99985705e-04,-2.22647595e-05, 1.66920698e-04,
+    -2.45267904e-04, 2.72214907e-04,-2.63163703e-04, 2.32112798e-04,-1.90425199e-04, 1.46531995e-04,
+    -1.05918902e-04, 7.16553477e-05,-4.48492283e-05, 2.53531198e-05,-1.21862604e-05, 4.07531479e-06,
+     3.52585488e-07,-2.26895304e-06, 2.66628103e-06,-2.22647805e-06, 1.46177501e-06,-6.50626873e-07,
+     7.48661400e-09, 3.87234707e-07,-4.49209494e-07, 2.43699390e-07, 1.43366199e-08,-6.31944408e-09
+  },
+  {
+     5.14508103e-10, 2.06199402e-05, 8.33660888e-04, 5.69505384e-03, 1.06028803e-02, 1.20404596e-03,
+    -5.36196819e-03, 3.68068297e-03,-6.60581572e-04,-1.56943896e-03, 2.52688793e-03,-2.44045490e-03,
+     1.73212402e-03,-7.91399681e-04,-1.00446297e-04, 7.78434682e-04,-1.17514201e-03, 1.29410601e-03,
+    -1.18368794e-03, 9.14761506e-04,-5.63354697e-04, 1.98364796e-04, 1.26047598e-04,-3.74009513e-04,
+     5.28209726e-04,-5.87747607e-04, 5.64421702e-04,-4.78274509e-04, 3.53110896e-04,-2.12549901e-04,
+     7.69909602e-05, 3.83173501e-05,-1.24095895e-04, 1.76879199e-04,-1.98121197e-04, 1.92851803e-04,
+    -1.68168495e-04, 1.31811306e-04,-9.09993396e-05, 5.16191794e-05,-1.77877191e-05,-8.02680097e-06,
+     2.51879792e-05,-3.44386899e-05, 3.72879913e-05,-3.55195407e-05, 3.08585804e-05,-2.47763091e-05,
+     1.84002092e-05,-1.25000297e-05, 7.52252481e-06,-3.65312303e-06, 8.87217425e-07, 9.00857799e-07,
+    -1.89896900e-06, 2.31199306e-06,-2.33116407e-06, 2.11651104e-06,-1.78980099e-06, 1.43505497e-06,
+    -1.10350800e-06, 8.20905086e-07,-5.94893322e-07, 4.21967087e-07,-2.92731897e-07, 1.96157004e-07,
+    -1.22164806e-07, 6.39200479e-08,-1.95776106e-08,-5.80609916e-09, 4.46512916e-09, 1.23214494e-10
+  }
+ },
+ { /* phase 42 */
+  {
+     1.37964695e-09, 2.33834493e-04, 1.71992704e-02, 1.99944198e-01,-2.31916502e-01, 2.17012003e-01,
+    -2.75443606e-02,-7.91979283e-02, 9.78626534e-02,-6.93789199e-02, 2.72385105e-02, 9.65416711e-03,
+    -3.35709192e-02, 4.35246006e-02,-4.19967994e-02, 3.27707604e-02,-1.97115391e-02, 6.06350182e-03,
+     5.80354501e-03,-1.44820400e-02, 1.94008593e-02,-2.06910707e-02, 1.89469196e-02,-1.50553901e-02,
+     9.97590274e-03,-4.62632114e-03,-2.57757987e-04, 4.14736383e-03,-6.77271280e-03, 8.07008985e-03,
+    -8.17430019e-03, 7.32640084e-03,-5.84850693e-03, 4.05319082e-03,-2.23504310e-03, 6.06465619e-04,
+     6.80409488e-04,-1.56870903e-03, 2.05069990e-03,-2.18622992e-03, 2.04737298e-03,-1.72976695e-03,
+     1.32727902e-03,-9.14188684e-04, 5.40866982e-04,-2.35505198e-04, 8.59382180e-06, 1.42144403e-04,
+    -2.26867705e-04, 2.59714900e-04,-2.55641091e-04, 2.28459699e-04,-1.89537997e-04, 1.47432904e-04,
+    -1.07817898e-04, 7.39673487e-05,-4.71803905e-05, 2.74696304e-05,-1.39760596e-05, 5.51037010e-06,
+    -7.50922027e-07,-1.44804801e-06, 2.07138805e-06,-1.80451104e-06, 1.16904300e-06,-4.54469898e-07,
+    -1.14678201e-07, 4.51154790e-07,-4.68787107e-07, 2.37893303e-07, 1.88017495e-08,-6.19623020e-09
+  },
+  {
+     7.94234400e-10, 2.23286697e-05, 8.68632400e-04, 5.80803119e-03, 1.05842901e-02, 9.82765108e-04,
+    -5.28433593e-03, 3.76047404e-03,-7.97596527e-04,-1.45578897e-03, 2.47232802e-03,-2.44659907e-03,
+     1.78250100e-03,-8.63820605e-04,-2.63661295e-05, 7.17627117e-04,-1.13605103e-03, 1.27921603e-03,
+    -1.19086099e-03, 9.38851910e-04,-5.97788312e-04, 2.36464795e-04, 9.00787199e-05,-3.44483007e-04,
+     5.07696299e-04,-5.77117084e-04, 5.63099224e-04,-4.84628894e-04, 3.64894309e-04,-2.27318902e-04,
+     9.24595006e-05, 2.40243899e-05,-1.12299800e-04, 1.68308601e-04,-1.92959094e-04, 1.90841703e-04,
+    -1.68751998e-04, 1.34271599e-04,-9.45888823e-05, 5.56592204e-05,-2.17317502e-05,-4.55998588e-06,
+     2.24103806e-05,-3.24179709e-05, 3.59860787e-05,-3.48324611e-05, 3.06508409e-05,-2.49072200e-05,
+     1.87415608e-05,-1.29461296e-05, 7.99409463e-06,-4.09669201e-06, 1.27176804e-06, 5.88661010e-07,
+    -1.65987001e-06, 2.13882890e-06,-2.21272194e-06, 2.04039111e-06,-1.74430102e-06, 1.41022394e-06,
+    -1.09154996e-06, 8.16146326e-07,-5.93501909e-07, 4.21571514e-07,-2.92045598e-07, 1.94660402e-07,
+    -1.19891496e-07, 6.13057125e-08,-1.73896400e-08,-6.73525680e-09, 4.14223411e-09, 1.37544004e-10
+  }
+ },
+ { /* phase 43 */
+  {
+     2.17388196e-09, 2.56163097e-04, 1.80679001e-02, 2.05752194e-01,-2.21332207e-01, 2.17994705e-01,
+    -3.28286886e-02,-7.54374564e-02, 9.70650464e-02,-7.08347112e-02, 2.97108404e-02, 7.20756780e-03,
+    -3.17884199e-02, 4.26607803e-02,-4.20231596e-02, 3.34883891e-02,-2.08475906e-02, 7.34271808e-03,
+     4.61268518e-03,-1.35431904e-02, 1.88030694e-02,-2.04546005e-02, 1.90369897e-02,-1.53998798e-02,
+     1.04836002e-02,-5.20343799e-03, 3.05341207e-04, 3.66273499e-03,-6.40781783e-03, 7.84277078e-03,
+    -8.08184035e-03, 7.35042617e-03,-5.96080720e-03, 4.22149990e-03,-2.42800196e-03, 7.97307293e-04,
+     5.11657505e-04,-1.43443805e-03, 1.95611105e-03,-2.13057105e-03, 2.02564104e-03,-1.73432694e-03,
+     1.34969002e-03,-9.46606684e-04, 5.76853112e-04,-2.70337710e-04, 3.92446600e-05, 1.17237199e-04,
+    -2.08126105e-04, 2.46768788e-04,-2.47646996e-04, 2.24363001e-04,-1.88266305e-04, 1.48021500e-04,
+    -1.09477798e-04, 7.61061674e-05,-4.93931111e-05, 2.95100199e-05,-1.57203594e-05, 6.92059393e-06,
+    -1.84247199e-06,-6.31901685e-07, 1.47788603e-06,-1.38294001e-06, 8.76997206e-07,-2.59809497e-07,
+    -2.34569598e-07, 5.12460474e-07,-4.86176702e-07, 2.31158097e-07, 2.29439898e-08,-6.05868600e-09
+  },
+  {
+     1.20487398e-09, 2.41556900e-05, 9.04709974e-04, 5.92146115e-03, 1.05611999e-02, 7.62250973e-04,
+    -5.20126289e-03, 3.83497705e-03,-9.32842609e-04,-1.34040997e-03, 2.41405889e-03,-2.44870596e-03,
+     1.82970497e-03,-9.34523821e-04, 4.75351007e-05, 6.55722106e-04,-1.09502696e-03, 1.26204302e-03,
+    -1.19582901e-03, 9.61139798e-04,-6.31013012e-04, 2.74013903e-04, 5.40446417e-05,-3.14393401e-04,
+     4.86282690e-04,-5.65422000e-04, 5.60706714e-04,-4.90035512e-04, 3.75938194e-04,-2.41599497e-04,
+     1.07694497e-04, 9.73781880e-06,-1.00331301e-04, 1.59445204e-04,-1.87442696e-04, 1.88467893e-04,
+    -1.69003106e-04, 1.36457602e-04,-9.79756078e-05, 5.95697602e-05,-2.56126004e-05,-1.10261306e-06,
+     1.96034907e-05,-3.03439701e-05, 3.46196211e-05,-3.40794213e-05, 3.03825109e-05,-2.49868608e-05,
+     1.90426308e-05,-1.33629001e-05, 8.44611895e-06,-4.52877293e-06, 1.65096901e-06, 2.77510111e-07,
+    -1.41908595e-06, 1.96249403e-06,-2.09052200e-06, 1.96052110e-06,-1.69540499e-06, 1.38251403e-06,
+    -1.07726305e-06, 8.09572214e-07,-5.90736079e-07, 4.20161086e-07,-2.90631391e-07, 1.92665397e-07,
+    -1.17308900e-07, 5.85424615e-08,-1.51838702e-08,-7.60619301e-09, 3.79911880e-09, 1.57566196e-10
+  }
+ },
+ { /* phase 44 */
+  {
+     3.37875594e-09, 2.80318811e-04, 1.89726092e-02, 2.11673707e-01,-2.10770994e-01, 2.18757004e-01,
+    -3.80299613e-02,-7.16024786e-02, 9.61322114e-02,-7.21751228e-02, 3.21248993e-02, 4.75886092e-03,
+    -2.99587194e-02, 4.17262502e-02,-4.19756286e-02, 3.41441110e-02,-2.19426192e-02, 8.60476214e-03,
+     3.41685489e-03,-1.25820497e-02, 1.81720592e-02,-2.01805905e-02, 1.90910399e-02,-1.57142691e-02,
+     1.09698800e-02,-5.76886022e-03, 8.66047805e-04, 3.17269890e-03,-6.03188016e-03, 7.60117080e-03,
+    -7.97414593e-03, 7.36016314e-03,-6.06113812e-03, 4.38094512e-03,-2.61544506e-03, 9.85775143e-04,
+     3.42654297e-04,-1.29797996e-03, 1.85813603e-03,-2.07100110e-03, 2.00002897e-03,-1.73542905e-03,
+     1.36929296e-03,-9.76950745e-04, 6.11472700e-04,-3.04417103e-04, 6.96271818e-05, 9.22503532e-05,
+    -1.89083497e-04, 2.33405895e-04,-2.39200905e-04, 2.19834197e-04,-1.86615303e-04, 1.48299107e-04,
+    -1.10896901e-04, 7.80686678e-05,-5.14836283e-05, 3.14705394e-05,-1.74157594e-05, 8.30310819e-06,
+    -2.91973402e-06, 1.77670501e-07, 8.87149724e-07,-9.62778472e-07, 5.86365672e-07,-6.71441285e-08,
+    -3.51878498e-07, 5.71002886e-07,-5.01360603e-07, 2.23551893e-07, 2.67431108e-08,-5.90112004e-09
+  },
+  {
+     1.78639603e-09, 2.61075602e-05, 9.41913400e-04, 6.03528507e-03, 1.05335601e-02, 5.42678987e-04,
+    -5.11285895e-03, 3.90411494e-03,-1.06613501e-03,-1.22348301e-03, 2.35218299e-03,-2.44678603e-03,
+     1.87366502e-03,-1.00339297e-03, 1.21128403e-04, 5.92832919e-04,-1.05215004e-03, 1.24262297e-03,
+    -1.19859003e-03, 9.81588964e-04,-6.62970298e-04, 3.10943404e-04, 1.80132793e-05,-2.83798989e-04,
+     4.64012090e-04,-5.52687678e-04, 5.57252089e-04,-4.94486827e-04, 3.86223692e-04,-2.55366002e-04,
+     1.22667305e-04,-4.51475898e-06,-8.82141467e-05, 1.50307300e-04,-1.81584095e-04, 1.85736499e-04,
+    -1.68922707e-04, 1.38366100e-04,-1.01153797e-04, 6.33437376e-05,-2.94229394e-05, 2.33850596e-06,
+     1.67730595e-05,-2.82211295e-05, 3.31917290e-05,-3.32623204e-05, 3.00544998e-05,-2.50154098e-05,
+     1.93030592e-05,-1.37496600e-05, 8.87779970e-06,-4.94855703e-06, 2.02407205e-06,-3.19558993e-08,
+    -1.17713398e-06, 1.78338200e-06,-1.96485098e-06, 1.87710202e-06,-1.64324695e-06, 1.35200696e-06,
+    -1.06069899e-06, 8.01214298e-07,-5.86615499e-07, 4.17749703e-07,-2.88500900e-07, 1.90183101e-07,
+    -1.14428602e-07, 5.56413688e-08,-1.29687896e-08,-8.41597814e-09, 3.43906592e-09, 1.79083401e-10
+  }
+ },
+ { /* phase 45 */
+  {
+     5.16515186e-09, 3.06426402e-04, 1.99145209e-02, 2.17709005e-01,-2.00237393e-01, 2.19299704e-01,
+    -4.31428216e-02,-6.76983669e-02, 9.50660706e-02,-7.33985975e-02, 3.44770811e-02, 2.31207605e-03,
+    -2.80850492e-02, 4.07228582e-02,-4.18545008e-02, 3.47369388e-02,-2.29947697e-02, 9.84738488e-03,
+     2.21826602e-03,-1.16004599e-02, 1.75090898e-02,-1.98696498e-02, 1.91090498e-02,-1.59980692e-02,
+     1.14338901e-02,-6.32154802e-03, 1.42330001e-03, 2.67821294e-03,-5.64565603e-03, 7.34580494e-03,
+    -7.85147864e-03, 7.35564902e-03,-6.14935206e-03, 4.53125313e-03,-2.79702898e-03, 1.17151195e-03,
+     1.73731605e-04,-1.15961395e-03, 1.75698195e-03,-2.00765696e-03, 1.97060592e-03,-1.73309096e-03,
+     1.38606597e-03,-1.00517203e-03, 6.44664513e-04,-3.37679405e-04, 9.96816816e-05, 6.72349415e-05,
+    -1.69780396e-04, 2.19656198e-04,-2.30323101e-04, 2.14885600e-04,-1.84591205e-04, 1.48267107e-04,
+    -1.12073998e-04, 7.98520487e-05,-5.34484898e-05, 3.33476382e-05,-1.90590108e-05, 9.65511481e-06,
+    -3.98043403e-06, 9.78884827e-07, 3.00534310e-07,-5.45028797e-07, 2.97864801e-07, 1.23039001e-07,
+    -4.66307114e-07, 6.26644294e-07,-5.14329372e-07, 2.15135898e-07, 3.01821714e-08,-5.72203618e-09
+  },
+  {
+     2.58631805e-09, 2.81910798e-05, 9.80261830e-04, 6.14944194e-03, 1.05013503e-02, 3.24224413e-04,
+    -5.01923682e-03, 3.96781880e-03,-1.19729398e-03,-1.10518804e-03, 2.28681089e-03,-2.44085211e-03,
+     1.91431597e-03,-1.07031397e-03, 1.94285705e-04, 5.29073877e-04,-1.00750197e-03, 1.22099801e-03,
+    -1.19914406e-03, 1.00016699e-03,-6.93604292e-04, 3.47185909e-04,-1.79476101e-05,-2.52759113e-04,
+     4.40929289e-04,-5.38941706e-04, 5.52745420e-04,-4.97977482e-04, 3.95733601e-04,-2.68593401e-04,
+     1.37349896e-04,-1.87058795e-05,-7.59724571e-05, 1.40913704e-04,-1.75396199e-04, 1.82654505e-04,
+    -1.68512401e-04, 1.39994794e-04,-1.04118197e-04, 6.69743677e-05,-3.31555711e-05, 5.75662807e-06,
+     1.39248496e-05,-2.60539600e-05, 3.17056183e-05,-3.23831991e-05, 2.96678409e-05,-2.49930999e-05,
+     1.95225803e-05,-1.41058299e-05, 9.28839017e-06,-5.35526306e-06, 2.39034898e-06,-3.39106009e-07,
+    -9.34527975e-07, 1.60188995e-06,-1.83600298e-06, 1.79033998e-06,-1.58796695e-06, 1.31879699e-06,
+    -1.04191599e-06, 7.91107880e-07,-5.81162681e-07, 4.14353195e-07,-2.85667312e-07, 1.87226107e-07,
+    -1.11262800e-07, 5.26138315e-08,-1.07527898e-08,-9.16202225e-09, 3.06542103e-09, 2.00266401e-10
+  }
+ },
+ { /* phase 46 */
+  {
+     7.75146880e-09, 3.34617507e-04, 2.08947901e-02, 2.23858401e-01,-1.89736098e-01, 2.19623893e-01,
+    -4.81620505e-02,-6.37305528e-02, 9.38687772e-02,-7.45037869e-02, 3.67638990e-02,-1.28776504e-04,
+    -2.61707399e-02, 3.96525487e-02,-4.16602083e-02, 3.52660082e-02,-2.40022708e-02, 1.10683804e-02,
+     1.01912196e-03,-1.06002996e-02, 1.68154892e-02,-1.95224602e-02, 1.90911107e-02,-1.62508301e-02,
+     1.18748201e-02,-6.86048903e-03, 1.97604508e-03, 2.18023499e-03,-5.24992310e-03, 7.07721198e-03,
+    -7.71412905e-03, 7.33694294e-03,-6.22532517e-03, 4.67216596e-03,-2.97242496e-03, 1.35416596e-03,
+     5.21916400e-06,-1.01961906e-03, 1.65286404e-03,-1.94068300e-03, 1.93745003e-03,-1.72733399e-03,
+     1.39999099e-03,-1.03122601e-03, 6.76370109e-04,-3.70062597e-04, 1.29349501e-04, 4.22418416e-05,
+    -1.50257794e-04, 2.05550401e-04,-2.21034701e-04, 2.09530393e-04,-1.82200907e-04, 1.47928004e-04,
+    -1.13008500e-04, 8.14539380e-05,-5.52844904e-05, 3.51379786e-05,-2.06469795e-05, 1.09739103e-05,
+    -5.02234980e-06, 1.76999299e-06,-2.80628512e-07,-1.30675701e-07, 1.21974697e-08, 3.10265108e-07,
+    -5.77569892e-07, 6.79258108e-07,-5.25082214e-07, 2.05973905e-07, 3.32475913e-08,-5.52177015e-09
+  },
+  {
+     3.66061892e-09, 3.04133591e-05, 1.01977400e-03, 6.26386795e-03, 1.04645202e-02, 1.07062398e-04,
+    -4.92051616e-03, 4.02602693e-03,-1.32614095e-03,-9.85709485e-04, 2.21805694e-03,-2.43092794e-03,
+     1.95160101e-03,-1.13517698e-03, 2.66880088e-04, 4.64560901e-04,-9.61167214e-04, 1.19721401e-03,
+    -1.19749596e-03, 1.01684302e-03,-7.22861616e-04, 3.82675702e-04,-5.37706292e-05,-2.21333496e-04,
+     4.17080388e-04,-5.24213188e-04, 5.47198288e-04,-5.00503927e-04, 4.04452207e-04,-2.81258399e-04,
+     1.51715198e-04,-3.28083188e-05,-6.36304612e-05, 1.31283698e-04,-1.68892293e-04, 1.79229304e-04,
+    -1.67774502e-04, 1.41341705e-04,-1.06863998e-04, 7.04552003e-05,-3.68035107e-05, 9.14509019e-06,
+     1.10646397e-05,-2.38470493e-05, 3.01646105e-05,-3.14441786e-05, 2.92236491e-05,-2.49203094e-05,
+     1.97010195e-05,-1.44308797e-05, 9.67718915e-06,-5.74814385e-06, 2.74909189e-06,-6.43318685e-07,
+    -6.91779405e-07, 1.41841895e-06,-1.70427700e-06, 1.70044700e-06,-1.52970995e-06, 1.28297700e-06,
+    -1.02097499e-06, 7.79292179e-07,-5.74403373e-07, 4.09989894e-07,-2.82145407e-07, 1.83807998e-07,
+    -1.07824498e-07, 4.94714598e-08,-8.54413962e-09,-9.84209336e-09, 2.68156897e-09, 2.20926194e-10
+  }
+ },
+ { /* phase 47 */
+  {
+     1.14120899e-08, 3.65030806e-04, 2.19145603e-02, 2.30122298e-01,-1.79271594e-01, 2.19731003e-01,
+    -5.30825704e-02,-5.97045198e-02, 9.25426409e-02,-7.54894987e-02, 3.89819518e-02,-2.55970494e-03,
+    -2.42191292e-02, 3.85173708e-02,-4.13933285e-02, 3.57305817e-02,-2.49634292e-02, 1.22656003e-02,
+    -1.78374801e-04,-9.58345365e-03, 1.60926208e-02,-1.91397909e-02, 1.90373305e-02,-1.64721608e-02,
+     1.22918999e-02,-7.38470210e-03, 2.52324389e-03, 1.67973095e-03,-4.84547112e-03, 6.79595396e-03,
+    -7.56241381e-03, 7.30413385e-03,-6.28895499e-03, 4.80344985e-03,-3.14131705e-03, 1.53339596e-03,
+    -1.62555298e-04,-8.78277584e-04, 1.54599897e-03,-1.87022798e-03, 1.90064695e-03,-1.71818899e-03,
+     1.41105603e-03,-1.05507299e-03, 7.06534716e-04,-4.01506812e-04, 1.58573195e-04, 1.73215303e-05,
+    -1.30556800e-04, 1.91119500e-04,-2.11357503e-04, 2.03782198e-04,-1.79451803e-04, 1.47284707e-04,
+    -1.13700298e-04, 8.28723569e-05,-5.69887707e-05, 3.68384317e-05,-2.21766804e-05, 1.22568899e-05,
+    -6.04332490e-06, 2.54928500e-06,-8.55031772e-07, 2.79314207e-07,-2.69947890e-07, 4.94073106e-07,
+    -6.85394411e-07, 7.28729617e-07,-5.33626292e-07, 1.96131793e-07, 3.59291583e-08,-5.30084421e-09
+  },
+  {
+     5.07472420e-09, 3.27817397e-05, 1.06047001e-03, 6.37849886e-03, 1.04230503e-02,-1.08631801e-04,
+    -4.81681991e-03, 4.07868205e-03,-1.45250105e-03,-8.65230220e-04, 2.14604009e-03,-2.41704192e-03,
+     1.98546704e-03,-1.19787804e-03, 3.38785903e-04, 3.99410608e-04,-9.13234719e-04, 1.17131800e-03,
+    -1.19365600e-03, 1.03159400e-03,-7.50691514e-04, 4.17348288e-04,-8.93888209e-05,-1.89582905e-04,
+     3.92512913e-04,-5.08533092e-04, 5.40624780e-04,-5.02064300e-04, 4.12365509e-04,-2.93338293e-04,
+     1.65736303e-04,-4.67951104e-05,-5.12124607e-05, 1.21436999e-04,-1.62086406e-04, 1.75469104e-04,
+    -1.66711703e-04, 1.42405494e-04,-1.09386900e-04, 7.37801092e-05,-4.03599697e-05, 1.24973203e-05,
+     8.19817615e-06,-2.16050194e-05, 2.85721108e-05,-3.04475197e-05, 2.87231906e-05,-2.47975004e-05,
+     1.98382604e-05,-1.47243500e-05, 1.00435400e-05,-6.12648500e-06, 3.09961092e-06,-9.43982911e-07,
+    -4.49396907e-07, 1.23336997e-06,-1.56997305e-06, 1.60764296e-06,-1.46862601e-06, 1.24464998e-06,
+    -9.97941243e-07, 7.65809716e-07,-5.66365827e-07, 4.04680208e-07,-2.77951614e-07, 1.79943399e-07,
+    -1.04127203e-07, 4.62261305e-08,-6.35094022e-09,-1.04543103e-08, 2.29090502e-09, 2.41044906e-10
+  }
+ },
+ { /* phase 48 */
+  {
+     1.64868101e-08, 3.97812604e-04, 2.29750294e-02, 2.36500800e-01,-1.68848500e-01, 2.19622299e-01,
+    -5.78993894e-02,-5.56258410e-02, 9.10901427e-02,-7.63547271e-02, 4.11279909e-02,-4.97674709e-03,
+    -2.22336706e-02, 3.73194888e-02,-4.10545506e-02, 3.61299887e-02,-2.58766692e-02, 1.34369098e-02,
+    -1.37203105e-03,-8.55186023e-03, 1.53419301e-02,-1.87224392e-02, 1.89479496e-02,-1.66617408e-02,
+     1.26844198e-02,-7.89323635e-03, 3.06386803e-03, 1.17766706e-03,-4.43310477e-03, 6.50261482e-03,
+    -7.39667704e-03, 7.25733908e-03,-6.34016795e-03, 4.92488686e-03,-3.30340397e-03, 1.70886505e-03,
+    -3.29267001e-04,-7.35872192e-04, 1.43661303e-03,-1.79644802e-03, 1.86028704e-03,-1.70569203e-03,
+     1.41925400e-03,-1.07667805e-03, 7.35106820e-04,-4.31954308e-04, 1.87296406e-04,-7.47596914e-06,
+    -1.10718604e-04, 1.76395100e-04,-2.01314004e-04, 1.97655696e-04,-1.76352201e-04, 1.46340695e-04,
+    -1.14149698e-04, 8.41057335e-05,-5.85587404e-05, 3.84460691e-05,-2.36453106e-05, 1.35015398e-05,
+    -7.04126614e-06, 3.31509500e-06,-1.42139800e-06, 6.83994301e-07,-5.47899617e-07, 6.74016519e-07,
+    -7.89521607e-07, 7.74955708e-07,-5.39977179e-07, 1.85677493e-07, 3.82200689e-08,-5.05979880e-09
+  },
+  {
+     6.90455781e-09, 3.53038813e-05, 1.10236695e-03, 6.49326807e-03, 1.03769097e-02,-3.22683511e-04,
+    -4.70828218e-03, 4.12573712e-03,-1.57620502e-03,-7.43935874e-04, 2.07088492e-03,-2.39922898e-03,
+     2.01586494e-03,-1.25831401e-03, 4.09878907e-04, 3.33740812e-04,-8.63794819e-04, 1.14336400e-03,
+    -1.18763605e-03, 1.04439596e-03,-7.77046080e-04, 4.51141095e-04,-1.24735801e-04,-1.57567905e-04,
+     3.67275497e-04,-4.91934305e-04, 5.33040613e-04,-5.02658775e-04, 4.19460790e-04,-3.04812012e-04,
+     1.79387600e-04,-6.06396097e-05,-3.87428299e-05, 1.11393500e-04,-1.54993002e-04, 1.71382606e-04,
+    -1.65327700e-04, 1.43185200e-04,-1.11682799e-04, 7.69432881e-05,-4.38183997e-05, 1.58068597e-05,
+     5.33122011e-06,-1.93325704e-05, 2.69316206e-05,-2.93955600e-05, 2.81678094e-05,-2.46252293e-05,
+     1.99342794e-05,-1.49858397e-05, 1.03868597e-05,-6.48960804e-06, 3.44123805e-06,-1.24049905e-06,
+    -2.07884497e-07, 1.04714400e-06,-1.43339605e-06, 1.51214795e-06,-1.40487202e-06, 1.20391996e-06,
+    -9.72884891e-07, 7.50706420e-07,-5.57081194e-07, 3.98446588e-07,-2.73104007e-07, 1.75648097e-07,
+    -1.00185197e-07, 4.28898304e-08,-4.18111679e-09,-1.09971703e-08, 1.89681004e-09, 2.60576394e-10
+  }
+ },
+ { /* phase 49 */
+  {
+     2.33913706e-08, 4.33116395e-04, 2.40774006e-02, 2.42994100e-01,-1.58471599e-01, 2.19299600e-01,
+    -6.26076683e-02,-5.15001006e-02, 8.95139277e-02,-7.70986602e-02, 4.31988798e-02,-7.37597607e-03,
+    -2.02178005e-02, 3.60611789e-02,-4.06446718e-02, 3.64637300e-02,-2.67404597e-02, 1.45802796e-02,
+    -2.55966699e-03,-7.50746485e-03, 1.45648904e-02,-1.82712991e-02, 1.88232102e-02,-1.68193094e-02,
+     1.30516896e-02,-8.38517025e-03, 3.59690911e-03, 6.75007876e-04,-4.01364407e-03, 6.19780319e-03,
+    -7.21728988e-03, 7.19670020e-03,-6.37891004e-03, 5.03628096e-03,-3.45839700e-03, 1.88024703e-03,
+    -4.94594686e-04,-5.92686876e-04, 1.32493000e-03,-1.71950401e-03, 1.81646796e-03,-1.68988504e-03,
+     1.42458500e-03,-1.09600998e-03, 7.62038399e-04,-4.61349904e-04, 2.15464199e-04,-3.21011903e-05,
+    -9.07842768e-05, 1.61409305e-04,-1.90927094e-04, 1.91166095e-04,-1.72910906e-04, 1.45100203e-04,
+    -1.14357601e-04, 8.51528675e-05,-5.99921295e-05, 3.99582204e-05,-2.50501798e-05, 1.47054598e-05,
+    -8.01415081e-06, 4.06580102e-06,-1.97847908e-06, 1.08244103e-06,-8.21003596e-07, 8.49664616e-07,
+    -8.89706826e-07, 8.17845603e-07,-5.44158411e-07, 1.74680295e-07, 4.01168805e-08,-4.79922191e-09
+  },
+  {
+     9.23767907e-09, 3.79877092e-05, 1.14548299e-03, 6.60810806e-03, 1.03260903e-02,-5.34918392e-04,
+    -4.59503522e-03, 4.16714977e-03,-1.69708696e-03,-6.22012711e-04, 1.99272111e-03,-2.37753009e-03,
+     2.04275595e-03,-1.31638697e-03, 4.80036804e-04, 2.67669588e-04,-8.12940416e-04, 1.11340894e-03,
+    -1.17945299e-03, 1.05523004e-03,-8.01880495e-04, 4.83993499e-04,-1.59745803e-04,-1.25349994e-04,
+     3.41418112e-04,-4.74450993e-04, 5.24463423e-04,-5.02289389e-04, 4.25727310e-04,-3.15659301e-04,
+     1.92643900e-04,-7.43155470e-05,-2.62459598e-05, 1.01173500e-04,-1.47627099e-04, 1.66979095e-04,
+    -1.63626493e-04, 1.43680794e-04,-1.13748400e-04, 7.99393019e-05,-4.71724416e-05, 1.90673709e-05,
+     2.46948002e-06,-1.70344101e-05, 2.52466907e-05,-2.82907495e-05, 2.75589700e-05,-2.44041494e-05,
+     1.99891692e-05,-1.52150296e-05, 1.07065698e-05,-6.83686994e-06, 3.77333095e-06,-1.53228098e-06,
+     3.22591909e-08, 8.60141483e-07,-1.29485602e-06, 1.41418798e-06,-1.33860794e-06, 1.16089802e-06,
+    -9.45880004e-07, 7.34031914e-07,-5.46583294e-07, 3.91313790e-07,-2.67621999e-07, 1.70938804e-07,
+    -9.60129398e-08, 3.94747310e-08,-2.04239203e-09,-1.14695098e-08, 1.50261803e-09, 2.79478191e-10
+  }
+ },
+ { /* phase 50 */
+  {
+     3.26290497e-08, 4.71104111e-04, 2.52228808e-02, 2.49602199e-01,-1.48145497e-01, 2.18764707e-01,
+    -6.72027096e-02,-4.73329499e-02, 8.78168419e-02,-7.77206793e-02, 4.51916009e-02,-9.75350570e-03,
+    -1.81750506e-02, 3.47447917e-02,-4.01646309e-02, 3.67313996e-02,-2.75534000e-02, 1.56936906e-02,
+    -3.73911904e-03,-6.45223400e-03, 1.37630096e-02,-1.77873001e-02, 1.86634604e-02,-1.69446599e-02,
+     1.33931097e-02,-8.85962136e-03, 4.12137201e-03, 1.72718501e-04,-3.58791696e-03, 5.88214397e-03,
+    -7.02464581e-03, 7.12238392e-03,-6.40515611e-03, 5.13745379e-03,-3.60602397e-03, 2.04722607e-03,
+    -6.58221194e-04,-4.49006213e-04, 1.21118105e-03,-1.63956499e-03, 1.76929601e-03,-1.67081796e-03,
+     1.42705499e-03,-1.11304503e-03, 7.87285098e-04,-4.89640574e-04, 2.43023096e-04,-5.65053415e-05,
+    -7.07951112e-05, 1.46194303e-04,-1.80220595e-04, 1.84329299e-04,-1.69137595e-04, 1.43567901e-04,
+    -1.14325303e-04, 8.60130094e-05,-6.12869917e-05, 4.13724083e-05,-2.63887905e-05, 1.58663606e-05,
+    -8.96003075e-06, 4.79983282e-06,-2.52506197e-06, 1.47375499e-06,-1.08862605e-06, 1.02060301e-06,
+    -9.85719680e-07, 8.57320288e-07,-5.46200681e-07, 1.63210800e-07, 4.16194901e-08,-4.51974413e-09
+  },
+  {
+     1.21744899e-08, 4.08414489e-05, 1.18983502e-03, 6.72294898e-03, 1.02705602e-02,-7.45162892e-04,
+    -4.47722198e-03, 4.20288881e-03,-1.81498600e-03,-4.99646994e-04, 1.91168196e-03,-2.35199300e-03,
+     2.06610491e-03,-1.37200498e-03, 5.49139106e-04, 2.01315794e-04,-7.60767085e-04, 1.08151196e-03,
+    -1.16912799e-03, 1.06408400e-03,-8.25152616e-04, 5.15846419e-04,-1.94353997e-04,-9.29904490e-05,
+     3.14991601e-04,-4.56119305e-04, 5.14912477e-04,-5.00959926e-04, 4.31155699e-04,-3.25861707e-04,
+     2.05481105e-04,-8.77970670e-05,-1.37462002e-05, 9.07976864e-05,-1.40004093e-04, 1.62268698e-04,
+    -1.61612901e-04, 1.43892496e-04,-1.15580697e-04, 8.27630502e-05,-5.04159907e-05, 2.22726303e-05,
+    -3.81369802e-07,-1.47152796e-05, 2.35209809e-05,-2.71356294e-05, 2.68982203e-05,-2.41350099e-05,
+     2.00030609e-05,-1.54116697e-05, 1.10022002e-05,-7.16766499e-06, 4.09526911e-06,-1.81875600e-06,
+     2.70542188e-07, 6.72763122e-07,-1.15465900e-06, 1.31399395e-06,-1.26999703e-06, 1.11569705e-06,
+    -9.17004002e-07, 7.15838496e-07,-5.34908395e-07, 3.83308191e-07,-2.61526509e-07, 1.65833100e-07,
+    -9.16257505e-08, 3.59930397e-08, 5.77475810e-11,-1.18705801e-08, 1.11159704e-09, 2.97707498e-10
+  }
+ },
+ { /* phase 51 */
+  {
+     4.48035387e-08, 5.11945575e-04, 2.64127199e-02, 2.56325096e-01,-1.37875006e-01, 2.18019605e-01,
+    -7.16799274e-02,-4.31300588e-02, 8.60018581e-02,-7.82203227e-02, 4.71032783e-02,-1.21055003e-02,
+    -1.61089394e-02, 3.33727896e-02,-3.96154895e-02, 3.69327106e-02,-2.83141695e-02, 1.67752001e-02,
+    -4.90824692e-03,-5.38815092e-03, 1.29378503e-02,-1.72714591e-02, 1.84691101e-02,-1.70376506e-02,
+     1.37080997e-02,-9.31574032e-03, 4.63628490e-03,-3.28241294e-04,-3.15676094e-03, 5.55628212e-03,
+    -6.81916485e-03, 7.03458721e-03,-6.41890289e-03, 5.22825215e-03,-3.74602806e-03, 2.20949505e-03,
+    -8.19834124e-04,-3.05113703e-04, 1.09560101e-03,-1.55680196e-03, 1.71888003e-03,-1.64854503e-03,
+     1.42667303e-03,-1.12776004e-03, 8.10806116e-04,-5.16776287e-04, 2.69921409e-04,-8.06403623e-05,
+    -5.07920486e-05, 1.30782602e-04,-1.69218401e-04, 1.77161593e-04,-1.65042293e-04, 1.41749202e-04,
+    -1.14054797e-04, 8.66857808e-05,-6.24416498e-05, 4.26863990e-05,-2.76587907e-05, 1.69820505e-05,
+    -9.87703515e-06, 5.51567109e-06,-3.05997105e-06, 1.85706301e-06,-1.35015205e-06, 1.18643595e-06,
+    -1.07734502e-06, 8.93313313e-07,-5.46142985e-07, 1.51340203e-07, 4.27310916e-08,-4.22203694e-09
+  },
+  {
+     1.58295297e-08, 4.38736097e-05, 1.23544200e-03, 6.83772098e-03, 1.02103204e-02,-9.53244511e-04,
+    -4.35498822e-03, 4.23292490e-03,-1.92974205e-03,-3.77025513e-04, 1.82790402e-03,-2.32267100e-03,
+     2.08588107e-03,-1.42507697e-03, 6.17067504e-04, 1.34798203e-04,-7.07372383e-04, 1.04773697e-03,
+    -1.15668599e-03, 1.07094401e-03,-8.46823386e-04, 5.46643103e-04,-2.28496501e-04,-6.05508794e-05,
+     2.88047595e-04,-4.36976610e-04, 5.04409429e-04,-4.98675799e-04, 4.35738300e-04,-3.35401506e-04,
+     2.17875902e-04,-1.01058802e-04,-1.26780105e-06, 8.02867507e-05,-1.32140005e-04, 1.57261704e-04,
+    -1.59292205e-04, 1.43821104e-04,-1.17177100e-04, 8.54098180e-05,-5.35432082e-05, 2.54165607e-05,
+    -3.21570792e-06,-1.23799300e-05, 2.17581692e-05,-2.59328208e-05, 2.61872101e-05,-2.38186803e-05,
+     1.99761998e-05,-1.55755606e-05, 1.12732896e-05,-7.48142384e-06, 4.40645681e-06,-2.09936707e-06,
+     5.06479807e-07, 4.85405678e-07,-1.01311798e-06, 1.21179698e-06,-1.19920901e-06, 1.06843595e-06,
+    -8.86338114e-07, 6.96181985e-07,-5.22095377e-07, 3.74458210e-07,-2.54839705e-07, 1.60349600e-07,
+    -8.70392114e-08, 3.24570699e-08, 2.11207296e-09,-1.21999602e-08, 7.26914973e-10, 3.15223597e-10
+  }
+ },
+ { /* phase 52 */
+  {
+     6.06330701e-08, 5.55819192e-04, 2.76481602e-02, 2.63162792e-01,-1.27664596e-01, 2.17066303e-01,
+    -7.60349184e-02,-3.88971418e-02, 8.40721205e-02,-7.85973519e-02, 4.89311814e-02,-1.44281704e-02,
+    -1.40230600e-02, 3.19477096e-02,-3.89984287e-02, 3.70675102e-02,-2.90215407e-02, 1.78229399e-02,
+    -6.06493279e-03,-4.31720586e-03, 1.20910304e-02,-1.67248100e-02, 1.82406101e-02,-1.70981996e-02,
+     1.39961503e-02,-9.75271687e-03, 5.14069386e-03,-8.26917181e-04,-2.72102305e-03, 5.22088120e-03,
+    -6.60128891e-03, 6.93352800e-03,-6.42016996e-03, 5.30853821e-03,-3.87816806e-03, 2.36675702e-03,
+    -9.79126431e-04,-1.61292599e-04, 9.78423748e-04,-1.47139200e-03, 1.66533701e-03,-1.62312796e-03,
+     1.42345706e-03,-1.14014000e-03, 8.32564314e-04,-5.42709080e-04, 2.96108599e-04,-1.04459003e-04,
+    -3.08158487e-05, 1.15207098e-04,-1.57945105e-04, 1.69680206e-04,-1.60635900e-04, 1.39649797e-04,
+    -1.13548303e-04, 8.71711818e-05,-6.34547687e-05, 4.38981988e-05,-2.88579995e-05, 1.80504903e-05,
+    -1.07633696e-05, 6.21185291e-06,-3.58206603e-06, 2.23152097e-06,-1.60499201e-06, 1.34678601e-06,
+    -1.16438503e-06, 9.25770394e-07,-5.44030911e-07, 1.39140298e-07, 4.34580087e-08,-3.90681310e-09
+  },
+  {
+     2.03328607e-08, 4.70930318e-05, 1.28231896e-03, 6.95234910e-03, 1.01453504e-02,-1.15899194e-03,
+    -4.22848389e-03, 4.25724220e-03,-2.04120600e-03,-2.54334998e-04, 1.74153002e-03,-2.28962302e-03,
+     2.10206397e-03,-1.47552101e-03, 6.83706079e-04, 6.82356185e-05,-6.52855786e-04, 1.01214903e-03,
+    -1.14215398e-03, 1.07580505e-03,-8.66856892e-04, 5.76328894e-04,-2.62110290e-04,-2.80927798e-05,
+     2.60638888e-04,-4.17061790e-04, 4.92976920e-04,-4.95444809e-04, 4.39469208e-04,-3.44262808e-04,
+     2.29805897e-04,-1.14075898e-04, 1.11650997e-05, 6.96616771e-05,-1.24051105e-04, 1.51969405e-04,
+    -1.56670299e-04, 1.43468205e-04,-1.18535703e-04, 8.78752471e-05,-5.65484916e-05, 2.84932594e-05,
+    -6.02797718e-06,-1.00331299e-05, 1.99620299e-05,-2.46850304e-05, 2.54276893e-05,-2.34560703e-05,
+     1.99088900e-05,-1.57065806e-05, 1.15194598e-05,-7.77761761e-06, 4.70632904e-06,-2.37357199e-06,
+     7.39595976e-07, 2.98463789e-07,-8.70543204e-07, 1.10783401e-06,-1.12641396e-06, 1.01923604e-06,
+    -8.53966696e-07, 6.75120702e-07,-5.08185394e-07, 3.64794005e-07,-2.47585206e-07, 1.54507603e-07,
+    -8.22693309e-08, 2.88790893e-08, 4.11364409e-09,-1.24576101e-08, 3.51622703e-10, 3.31988187e-10
+  }
+ },
+ { /* phase 53 */
+  {
+     8.09659326e-08, 6.02912216e-04, 2.89304797e-02, 2.70115197e-01,-1.17519297e-01, 2.15907305e-01,
+    -8.02633986e-02,-3.46398912e-02, 8.20309073e-02,-7.88516775e-02, 5.06727211e-02,-1.67177897e-02,
+    -1.19209997e-02, 3.04721892e-02,-3.83147188e-02, 3.71357501e-02,-2.96743996e-02, 1.88350901e-02,
+    -7.20708678e-03,-3.24140093e-03, 1.12241702e-02,-1.61484797e-02, 1.79785006e-02,-1.71262994e-02,
+     1.42567903e-02,-1.01697799e-02, 5.63367084e-03,-1.32236199e-03,-2.28155404e-03, 4.87661781e-03,
+    -6.37148321e-03, 6.81945216e-03,-6.40900480e-03, 5.37820021e-03,-4.00221907e-03, 2.51872605e-03,
+    -1.13579701e-03,-1.78243808e-05, 8.59887979e-04,-1.38351705e-03, 1.60878804e-03,-1.59463496e-03,
+     1.41742895e-03,-1.15017302e-03, 8.52526282e-04,-5.67394076e-04, 3.21536296e-04,-1.27915104e-04,
+    -1.09069597e-05, 9.95004666e-05,-1.46425606e-04, 1.61902601e-04,-1.55929505e-04, 1.37276205e-04,
+    -1.12808702e-04, 8.74696489e-05,-6.43253079e-05, 4.50060288e-05,-2.99844105e-05, 1.90697301e-05,
+    -1.16173396e-05, 6.88697401e-06,-4.09025097e-06, 2.59631497e-06,-1.85257704e-06, 1.50129404e-06,
+    -1.24665405e-06, 9.54649522e-07,-5.39917323e-07, 1.26682593e-07, 4.38096315e-08,-3.57482510e-09
+  },
+  {
+     2.58315200e-08, 5.05088283e-05, 1.33048301e-03, 7.06676207e-03, 1.00756502e-02,-1.36223400e-03,
+    -4.09786683e-03, 4.27582720e-03,-2.14922894e-03,-1.31761597e-04, 1.65270595e-03,-2.25291704e-03,
+     2.11463496e-03,-1.52325595e-03, 7.48941500e-04, 1.74677905e-06,-5.97318576e-04, 9.74819704e-04,
+    -1.12556701e-03, 1.07866200e-03,-8.85220419e-04, 6.04851171e-04,-2.95133708e-04, 4.32246816e-06,
+     2.32818900e-04,-3.96415096e-04, 4.80640010e-04,-4.91275976e-04, 4.42343997e-04,-3.52430914e-04,
+     2.41249698e-04,-1.26824001e-04, 2.35285697e-05, 5.89435986e-05,-1.15754003e-04, 1.46403094e-04,
+    -1.53753601e-04, 1.42835706e-04,-1.19654898e-04, 9.01553867e-05,-5.94265111e-05, 3.14969693e-05,
+    -8.81269261e-06,-7.67963229e-06, 1.81363503e-05,-2.33950395e-05, 2.46214895e-05,-2.30482092e-05,
+     1.98015405e-05,-1.58046896e-05, 1.17403597e-05,-8.05575837e-06, 4.99434191e-06,-2.64084792e-06,
+     9.69424036e-07, 1.12328102e-07,-7.27245094e-07, 1.00234001e-06,-1.05178697e-06, 9.68222594e-07,
+    -8.19977515e-07, 6.52715698e-07,-4.93221592e-07, 3.54347492e-07,-2.39787596e-07, 1.48327203e-07,
+    -7.73324373e-08, 2.52713601e-08, 6.05582118e-09,-1.26438602e-08,-1.13731203e-11, 3.47962992e-10
+  }
+ },
+ { /* phase 54 */
+  {
+     1.06797401e-07, 6.53421099e-04, 3.02609596e-02, 2.77182013e-01,-1.07443601e-01, 2.14545101e-01,
+    -8.43612701e-02,-3.03640701e-02, 7.98816830e-02,-7.89834484e-02, 5.23254201e-02,-1.89707093e-02,
+    -9.80636198e-03, 2.89489292e-02,-3.75657789e-02, 3.71374898e-02,-3.02717201e-02, 1.98099092e-02,
+    -8.33265390e-03,-2.16273894e-03, 1.03389500e-02,-1.55436303e-02, 1.76833700e-02,-1.71219707e-02,
+     1.44896097e-02,-1.05661899e-02, 6.11431105e-03,-1.81363802e-03,-1.83921005e-03, 4.52418718e-03,
+    -6.13023294e-03, 6.69262791e-03,-6.38547679e-03, 5.43714408e-03,-4.11797315e-03, 2.66512902e-03,
+    -1.28954998e-03, 1.25011298e-04, 7.40232994e-04,-1.29336095e-03, 1.54936197e-03,-1.56313798e-03,
+     1.40861701e-03,-1.15785305e-03, 8.70662625e-04,-5.90789190e-04, 3.46157787e-04,-1.50963300e-04,
+     8.89458079e-06, 8.36957770e-05,-1.34685193e-04, 1.53846806e-04,-1.50935201e-04, 1.34635397e-04,
+    -1.11839297e-04, 8.75819678e-05,-6.50525617e-05, 4.60083684e-05,-3.10362011e-05, 2.00379509e-05,
+    -1.24373200e-05, 7.53969016e-06,-4.58347313e-06, 2.95066297e-06,-2.09236509e-06, 1.64962103e-06,
+    -1.32398600e-06, 9.79920856e-07,-5.33861510e-07, 1.14038798e-07, 4.37982592e-08,-3.22686211e-09
+  },
+  {
+     3.24911014e-08, 5.41304507e-05, 1.37994904e-03, 7.18088215e-03, 1.00012198e-02,-1.56280305e-03,
+    -3.96329490e-03, 4.28867480e-03,-2.25367001e-03,-9.49111927e-06, 1.56157895e-03,-2.21262290e-03,
+     2.12358404e-03,-1.56820798e-03, 8.12663115e-04,-6.45501277e-05,-5.40863723e-04, 9.35820397e-04,
+    -1.10695895e-03, 1.07951602e-03,-9.01884108e-04, 6.32159994e-04,-3.27506190e-04, 3.66337517e-05,
+     2.04641401e-04,-3.75078205e-04, 4.67424892e-04,-4.86180390e-04, 4.44359990e-04,-3.59892205e-04,
+     2.52186990e-04,-1.39279597e-04, 3.57988793e-05, 4.81537099e-05,-1.07265900e-04, 1.40574994e-04,
+    -1.50549095e-04, 1.41926095e-04,-1.20533703e-04, 9.22466279e-05,-6.21722429e-05, 3.44221116e-05,
+    -1.15644598e-05,-5.32418517e-06, 1.62849592e-05,-2.20656893e-05, 2.37705099e-05,-2.25962194e-05,
+     1.96546098e-05,-1.58699004e-05, 1.19357101e-05,-8.31539637e-06, 5.26998383e-06,-2.90068897e-06,
+     1.19550702e-06,-7.26155776e-08,-5.83534018e-07, 8.95555672e-07,-9.75505600e-07, 9.15522719e-07,
+    -7.84460894e-07, 6.29030922e-07,-4.77249500e-07, 3.43152294e-07,-2.31472796e-07, 1.41829304e-07,
+    -7.22451929e-08, 2.16460592e-08, 7.93229216e-09,-1.27593998e-08,-3.59330093e-10, 3.63113206e-10
+  }
+ },
+ { /* phase 55 */
+  {
+     1.39288602e-07, 7.07551488e-04, 3.16409096e-02, 2.84362793e-01,-9.74424332e-02, 2.12982297e-01,
+    -8.83245617e-02,-2.60753892e-02, 7.76280090e-02,-7.89929405e-02, 5.38869984e-02,-2.11833306e-02,
+    -7.68277794e-03, 2.73807291e-02,-3.67531218e-02, 3.70729417e-02,-3.08125801e-02, 2.07457300e-02,
+    -9.43961274e-03,-1.08322303e-03, 9.43706837e-03,-1.49114700e-02, 1.73558593e-02,-1.70853399e-02,
+     1.46942502e-02,-1.09412698e-02, 6.58173580e-03,-2.29981798e-03,-1.39484997e-03, 4.16429481e-03,
+    -5.87804615e-03, 6.55334909e-03,-6.34967815e-03, 5.48529718e-03,-4.22523916e-03, 2.80570402e-03,
+    -1.44009897e-03, 2.66937393e-04, 6.19699305e-04,-1.20111497e-03, 1.48719002e-03,-1.52871595e-03,
+     1.39705196e-03,-1.16317696e-03, 8.86947615e-04,-6.12854783e-04, 3.69928312e-04,-1.73559500e-04,
+     2.85491897e-05, 6.78258803e-05,-1.22749494e-04, 1.45531405e-04,-1.45665195e-04, 1.31734705e-04,
+    -1.10643799e-04, 8.75093610e-05,-6.56360935e-05, 4.69039296e-05,-3.20116997e-05, 2.09534701e-05,
+    -1.32217801e-05, 8.16872125e-06,-5.06072183e-06, 3.29381510e-06,-2.32383695e-06, 1.79145002e-06,
+    -1.39623205e-06, 1.00156694e-06,-5.25929181e-07, 1.01279397e-07, 4.34389307e-08,-2.86374902e-09
+  },
+  {
+     4.04973903e-08, 5.79676307e-05, 1.43073197e-03, 7.29463296e-03, 9.92204808e-03,-1.76053098e-03,
+    -3.82493390e-03, 4.29579196e-03,-2.35439092e-03, 1.12291898e-04, 1.46830303e-03,-2.16881791e-03,
+     2.12890701e-03,-1.61030702e-03, 8.74763122e-04,-1.30537504e-04,-4.83595213e-04, 8.95227015e-04,
+    -1.08636997e-03, 1.07837003e-03,-9.16821824e-04, 6.58207515e-04,-3.59168887e-04, 6.87803113e-05,
+     1.76161106e-04,-3.53093696e-04, 4.53359593e-04,-4.80170711e-04, 4.45516314e-04,-3.66635009e-04,
+     2.62598391e-04,-1.51419401e-04, 4.79525697e-05, 3.73132789e-05,-9.86038722e-05, 1.34497503e-04,
+    -1.47064406e-04, 1.40742501e-04,-1.21171397e-04, 9.41457765e-05,-6.47808993e-05, 3.72632894e-05,
+    -1.42779700e-05,-2.97150996e-06, 1.44117403e-05,-2.06999102e-05, 2.28767603e-05,-2.21012797e-05,
+     1.94686600e-05,-1.59022802e-05, 1.21052899e-05,-8.55612416e-06, 5.53277278e-06,-3.15260695e-06,
+     1.41739997e-06,-2.55986492e-07,-4.39718491e-07, 7.87719273e-07,-8.97748578e-07, 8.61267210e-07,
+    -7.47510114e-07, 6.04132197e-07,-4.60316386e-07, 3.31243200e-07,-2.22667794e-07, 1.35035094e-07,
+    -6.70244518e-08, 1.80152604e-08, 9.73709380e-09,-1.28052502e-08,-6.89689195e-10, 3.77405412e-10
+  }
+ },
+ { /* phase 56 */
+  {
+     1.79785900e-07, 7.65519100e-04, 3.30716409e-02, 2.91657507e-01,-8.75203833e-02, 2.11221799e-01,
+    -9.21495035e-02,-2.17796005e-02, 7.52736181e-02,-7.88806379e-02, 5.53552993e-02,-2.33521499e-02,
+    -5.55387093e-03, 2.57704202e-02,-3.58783491e-02, 3.69424000e-02,-3.12961787e-02, 2.16409508e-02,
+    -1.05259800e-02,-4.85291821e-06, 8.52024555e-03,-1.42532699e-02, 1.69966891e-02,-1.70165598e-02,
+     1.48704099e-02,-1.12943696e-02, 7.03509618e-03,-2.77998904e-03,-9.49333597e-04, 3.79766012e-03,
+    -5.61544811e-03, 6.40192907e-03,-6.30172482e-03, 5.52261109e-03,-4.32384294e-03, 2.94020190e-03,
+    -1.58716401e-03, 4.07679909e-04, 4.98527894e-04,-1.10696896e-03, 1.42240897e-03,-1.49145303e-03,
+     1.38277397e-03,-1.16614799e-03, 9.01359308e-04,-6.33554824e-04, 3.92804999e-04,-1.95660803e-04,
+     4.80178496e-05, 5.19235982e-05,-1.10644200e-04, 1.36975301e-04,-1.40132397e-04, 1.28582105e-04,
+    -1.09226399e-04, 8.72533710e-05,-6.60758087e-05, 4.76916503e-05,-3.29094510e-05, 2.18147397e-05,
+    -1.39692902e-05, 8.77285311e-06,-5.52103893e-06, 3.62505807e-06,-2.54650490e-06, 1.92648508e-06,
+    -1.46325601e-06, 1.01958199e-06,-5.16192074e-07, 8.84741311e-08, 4.27492388e-08,-2.48634291e-09
+  },
+  {
+     5.00581017e-08, 6.20304418e-05, 1.48284598e-03, 7.40793580e-03, 9.83815454e-03,-1.95525307e-03,
+    -3.68295191e-03, 4.29718709e-03,-2.45126104e-03, 2.33403902e-04, 1.37303199e-03,-2.12158589e-03,
+     2.13060505e-03,-1.64948904e-03, 9.35137097e-04,-1.96098699e-04,-4.25618608e-04, 8.53117672e-04,
+    -1.06384396e-03, 1.07523298e-03,-9.30010399e-04, 6.82948390e-04,-3.90064088e-04, 1.00701902e-04,
+     1.47432802e-04,-3.30505398e-04, 4.38473711e-04,-4.73261607e-04, 4.45813406e-04,-3.72648705e-04,
+     2.72465695e-04,-1.63221295e-04, 5.99665218e-05, 2.64436003e-05,-8.97856880e-05, 1.28183601e-04,
+    -1.43307596e-04, 1.39288401e-04,-1.21567900e-04, 9.58500532e-05,-6.72480601e-05, 4.00153112e-05,
+    -1.69480209e-05,-6.26300277e-07, 1.25205697e-05,-1.93006508e-05, 2.19423000e-05,-2.15646705e-05,
+     1.92443204e-05,-1.59019892e-05, 1.22489200e-05,-8.77757520e-06, 5.78225581e-06,-3.39613689e-06,
+     1.63466996e-06,-4.37410108e-07,-2.96104787e-07, 6.79070922e-07,-8.18697117e-07, 8.05588911e-07,
+    -7.09220728e-07, 5.78087906e-07,-4.42471588e-07, 3.18656703e-07,-2.13400398e-07, 1.27966800e-07,
+    -6.16872811e-08, 1.43908698e-08, 1.14646301e-08,-1.27827899e-08,-1.00009001e-09, 3.90807803e-10
+  }
+ },
+ { /* phase 57 */
+  {
+     2.29844005e-07, 8.27549607e-04, 3.45544890e-02, 2.99065411e-01,-7.76822269e-02, 2.09266499e-01,
+    -9.58324522e-02,-1.74824093e-02, 7.28223622e-02,-7.86472410e-02, 5.67283295e-02,-2.54737400e-02,
+    -3.42326611e-03, 2.41209306e-02,-3.49432118e-02, 3.67463082e-02,-3.17218006e-02, 2.24940702e-02,
+    -1.15898298e-02, 1.07037998e-03, 7.59023614e-03,-1.35703199e-02, 1.66066308e-02,-1.69158597e-02,
+     1.50178401e-02,-1.16248699e-02, 7.47356890e-03,-3.25325108e-03,-5.03520074e-04, 3.42501095e-03,
+    -5.34298178e-03, 6.23870781e-03,-6.24175882e-03, 5.54905413e-03,-4.41362895e-03, 3.06838495e-03,
+    -1.73047103e-03, 5.46968193e-04, 3.76960001e-04,-1.01111899e-03, 1.35516096e-03,-1.45143794e-03,
+     1.36582600e-03,-1.16677501e-03, 9.13879892e-04,-6.52855379e-04, 4.14747308e-04,-2.17225504e-04,
+     6.72621682e-05, 3.60216109e-05,-9.83953214e-05, 1.28197702e-04,-1.34350194e-04, 1.25185907e-04,
+    -1.07591703e-04, 8.68159623e-05,-6.63719111e-05, 4.83707190e-05,-3.37281490e-05, 2.26203301e-05,
+    -1.46785096e-05, 9.35094067e-06,-5.96350992e-06, 3.94371500e-06,-2.75990601e-06, 2.05445190e-06,
+    -1.52494295e-06, 1.03397304e-06,-5.04727495e-07, 7.56913465e-08, 4.17491499e-08,-2.09553508e-09
+  },
+  {
+     6.14047693e-08, 6.63292813e-05, 1.53630599e-03, 7.52071291e-03, 9.74954572e-03,-2.14680610e-03,
+    -3.53752309e-03, 4.29287786e-03,-2.54415697e-03, 3.53662792e-04, 1.27592403e-03,-2.07101391e-03,
+     2.12868699e-03,-1.68569305e-03, 9.93683701e-04,-2.61117995e-04,-3.67040397e-04, 8.09573219e-04,
+    -1.03942596e-03, 1.07011397e-03,-9.41430102e-04, 7.06340128e-04,-4.20135795e-04, 1.32338799e-04,
+     1.18511802e-04,-3.07358190e-04, 4.22798214e-04,-4.65468911e-04, 4.45253710e-04,-3.77924298e-04,
+     2.81771790e-04,-1.74663597e-04, 7.18179290e-05, 1.55659000e-05,-8.08291370e-05, 1.21646597e-04,
+    -1.39287105e-04, 1.37567898e-04,-1.21723700e-04, 9.73570277e-05,-6.95695271e-05, 4.26731895e-05,
+    -1.95695302e-05, 1.70679596e-06, 1.06153502e-05,-1.78709397e-05, 2.09692698e-05,-2.09877307e-05,
+     1.89822895e-05,-1.58692492e-05, 1.23664704e-05,-8.97942755e-06, 6.01800912e-06,-3.63083200e-06,
+     1.84689600e-06,-6.16518889e-07,-1.52996805e-07, 5.69850272e-07,-7.38533572e-07, 7.48622597e-07,
+    -6.69690280e-07, 5.50968480e-07,-4.23765897e-07, 3.05430490e-07,-2.03699400e-07, 1.20646703e-07,
+    -5.62508795e-08, 1.07846301e-08, 1.31096796e-08,-1.26937199e-08,-1.28838595e-09, 4.03292288e-10
+  }
+ },
+ { /* phase 58 */
+  {
+     2.91248796e-07, 8.93878925e-04, 3.60907912e-02, 3.06586087e-01,-6.79326802e-02, 2.07119703e-01,
+    -9.93699729e-02,-1.31895300e-02, 7.02781975e-02,-7.82935768e-02, 5.80042601e-02,-2.75447499e-02,
+    -1.29457901e-03, 2.24352404e-02,-3.39495316e-02, 3.64851914e-02,-3.20888385e-02, 2.33036391e-02,
+    -1.26292501e-02, 2.14049406e-03, 6.64880592e-03,-1.28639797e-02, 1.61864907e-02,-1.67835206e-02,
+     1.51363499e-02,-1.19322296e-02, 7.89636839e-03,-3.71872005e-03,-5.82664397e-05, 3.04708700e-03,
+    -5.06121013e-03, 6.06404478e-03,-6.16994081e-03, 5.56461979e-03,-4.49445797e-03, 3.19003197e-03,
+    -1.86975801e-03, 6.84536120e-04, 2.55236286e-04,-9.13761905e-04, 1.28559105e-03,-1.40876404e-03,
+     1.34625705e-03,-1.16506801e-03, 9.24495282e-04,-6.70726411e-04, 4.35716589e-04,-2.38213193e-04,
+     8.62444576e-05, 2.01523599e-05,-8.60288492e-05, 1.19218297e-04,-1.28332205e-04, 1.21555102e-04,
+    -1.05744803e-04, 8.61994413e-05,-6.65249099e-05, 4.89405684e-05,-3.44666805e-05, 2.33689498e-05,
+    -1.53481997e-05, 9.90190892e-06,-6.38727579e-06, 4.24914515e-06,-2.96360508e-06, 2.17509910e-06,
+    -1.58119406e-06, 1.04475805e-06,-4.91617811e-07, 6.29976284e-08, 4.04607583e-08,-1.69224301e-09
+  },
+  {
+     7.47946700e-08, 7.08748630e-05, 1.59112399e-03, 7.63288187e-03, 9.65623558e-03,-2.33502896e-03,
+    -3.38882394e-03, 4.28289222e-03,-2.63295695e-03, 4.72888292e-04, 1.17714005e-03,-2.01719697e-03,
+     2.12316494e-03,-1.71886804e-03, 1.05030497e-03,-3.25481087e-04,-3.07967886e-04, 7.64676777e-04,
+    -1.01316697e-03, 1.06302998e-03,-9.51064401e-04, 7.28342391e-04,-4.49329906e-04, 1.63632096e-04,
+     8.94535333e-05,-2.83697911e-04, 4.06365492e-04,-4.56810696e-04, 4.43841098e-04,-3.82453989e-04,
+     2.90500699e-04,-1.85725396e-04, 8.34844468e-05, 4.70139412e-06,-7.17522489e-05, 1.14900198e-04,
+    -1.35012102e-04, 1.35585695e-04,-1.21639503e-04, 9.86647065e-05,-7.17414878e-05, 4.52321292e-05,
+    -2.21375503e-05, 4.02317892e-06, 8.69998712e-06,-1.64138401e-05, 1.99598708e-05,-2.03718992e-05,
+     1.86833404e-05,-1.58043295e-05, 1.24578801e-05,-9.16140016e-06, 6.23964115e-06,-3.85626799e-06,
+     2.05367110e-06,-7.92953017e-07,-1.06945501e-08, 4.60296604e-07,-6.57441603e-07, 6.90504976e-07,
+    -6.29018814e-07, 5.22845880e-07,-4.04252006e-07, 2.91603612e-07,-1.93594403e-07, 1.13097897e-07,
+    -5.07325097e-08, 7.20803195e-09, 1.46674202e-08,-1.25400597e-08,-1.55265101e-09, 4.14830698e-10
+  }
+ },
+ { /* phase 59 */
+  {
+     3.66043508e-07, 9.64753679e-04, 3.76819186e-02, 3.14218998e-01,-5.82764484e-02, 2.04784706e-01,
+    -1.02758802e-01,-8.90664291e-03, 6.76452368e-02,-7.78206885e-02, 5.91813996e-02,-2.95619499e-02,
+     8.28586519e-04, 2.07163692e-02,-3.28992307e-02, 3.61597091e-02,-3.23968008e-02, 2.40683202e-02,
+    -1.36424201e-02, 3.20352498e-03, 5.69774117e-03,-1.21356295e-02, 1.57371592e-02,-1.66198909e-02,
+     1.52258100e-02,-1.22159300e-02, 8.30273330e-03,-4.17552982e-03, 3.85574705e-04, 2.66463310e-03,
+    -4.77071013e-03, 5.87831903e-03,-6.08645612e-03, 5.56932203e-03,-4.56620986e-03, 3.30493203e-03,
+    -2.00477010e-03, 8.20121786e-04, 1.33596797e-04,-8.15097184e-04, 1.21384999e-03,-1.36353204e-03,
+     1.32411905e-03,-1.16104505e-03, 9.33195290e-04,-6.87140215e-04, 4.55676491e-04,-2.58585089e-04,
+     1.04927800e-04, 4.34803087e-06,-7.35709691e-05, 1.10056899e-04,-1.22092504e-04, 1.17698801e-04,
+    -1.03691098e-04, 8.54064929e-05,-6.65355983e-05, 4.94008600e-05,-3.51241288e-05, 2.40594600e-05,
+    -1.59772208e-05, 1.04247601e-05,-6.79152799e-06, 4.54074916e-06,-3.15719990e-06, 2.28819704e-06,
+    -1.63192703e-06, 1.05196602e-06,-4.76950277e-07, 5.04575688e-08, 3.89081087e-08,-1.27741195e-09
+  },
+  {
+     9.05128488e-08, 7.56782174e-05, 1.64731196e-03, 7.74435978e-03, 9.55824275e-03,-2.51976401e-03,
+    -3.23703303e-03, 4.26726090e-03,-2.71754991e-03, 5.90902288e-04, 1.07684301e-03,-1.96023099e-03,
+     2.11406103e-03,-1.74896198e-03, 1.10490702e-03,-3.89074907e-04,-2.48508906e-04, 7.18513911e-04,
+    -9.85120656e-04, 1.05399895e-03,-9.58900375e-04, 7.48918101e-04,-4.77593887e-04, 1.94523600e-04,
+     6.03135413e-05,-2.59571098e-04, 3.89209308e-04,-4.47306200e-04, 4.41581215e-04,-3.86231812e-04,
+     2.98637606e-04,-1.96386798e-04, 9.49441310e-05,-6.12885287e-06,-6.25731991e-05, 1.07958498e-04,
+    -1.30492001e-04, 1.33346693e-04,-1.21316603e-04, 9.97715106e-05,-7.37603914e-05, 4.76876012e-05,
+    -2.46472391e-05, 6.31830881e-06, 6.77838807e-06,-1.49324496e-05, 1.89163602e-05,-1.97186491e-05,
+     1.83483207e-05,-1.57075701e-05, 1.25231500e-05,-9.32325383e-06, 6.44679403e-06,-4.07204288e-06,
+     2.25460303e-06,-9.66360517e-07, 1.30505498e-07, 3.50647809e-07,-5.75604986e-07, 6.31374178e-07,
+    -5.87307625e-07, 4.93794118e-07,-3.83983490e-07, 2.77215889e-07,-1.83115802e-07, 1.05343503e-07,
+    -4.51494913e-08, 3.67234199e-09, 1.61334608e-08,-1.23241302e-08,-1.79118698e-09, 4.25399993e-10
+  }
+ },
+ { /* phase 60 */
+  {
+     4.56556307e-07, 1.04043202e-03, 3.93292308e-02, 3.21963400e-01,-4.87181991e-02, 2.02264905e-01,
+    -1.05995797e-01,-4.63938201e-03, 6.49276972e-02,-7.72297904e-02, 6.02582395e-02,-3.15221809e-02,
+     2.94264709e-03, 1.89674105e-02,-3.17943208e-02, 3.57706286e-02,-3.26453112e-02, 2.47868393e-02,
+    -1.46275396e-02, 4.25752299e-03, 4.73884121e-03,-1.13867205e-02, 1.52595704e-02,-1.64253600e-02,
+     1.52861197e-02,-1.24754999e-02, 8.69194232e-03,-4.62283613e-03, 8.27155774e-04, 2.27840105e-03,
+    -4.47207177e-03, 5.68193197e-03,-5.99151198e-03, 5.56319300e-03,-4.62878309e-03, 3.41289095e-03,
+    -2.13526189e-03, 9.53468494e-04, 1.22802203e-05,-7.15325703e-04, 1.14008901e-03,-1.31584494e-03,
+     1.29947194e-03,-1.15472602e-03, 9.39973572e-04,-7.02072575e-04, 4.74592787e-04,-2.78303807e-04,
+     1.23276099e-04,-1.13595397e-05,-6.10478164e-05, 1.00733603e-04,-1.15645700e-04, 1.13626797e-04,
+    -1.01436497e-04, 8.44401293e-05,-6.64050967e-05, 4.97515102e-05,-3.56997298e-05, 2.46908294e-05,
+    -1.65645306e-05, 1.09185503e-05,-7.17551211e-06, 4.81796496e-06,-3.34031506e-06, 2.39353994e-06,
+    -1.67707606e-06, 1.05563799e-06,-4.60816892e-07, 3.81334395e-08, 3.71169193e-08,-8.52012294e-10
+  },
+  {
+     1.08874403e-07, 8.07507313e-05, 1.70488097e-03, 7.85506610e-03, 9.45559237e-03,-2.70085409e-03,
+    -3.08233593e-03, 4.24602581e-03,-2.79782689e-03, 7.07528729e-04, 9.75196890e-04,-1.90022204e-03,
+     2.10139900e-03,-1.77593401e-03, 1.15739997e-03,-4.51788103e-04,-1.88771795e-04, 6.71171874e-04,
+    -9.55342373e-04, 1.04304100e-03,-9.64928418e-04, 7.68032623e-04,-5.04877185e-04, 2.24956093e-04,
+     3.11473486e-05,-2.35025102e-04, 3.71364789e-04,-4.36976406e-04, 4.38481104e-04,-3.89252906e-04,
+     3.06169008e-04,-2.06628596e-04, 1.06175503e-04,-1.69039104e-05,-5.33103084e-05, 1.00835903e-04,
+    -1.25736697e-04, 1.30856701e-04,-1.20756798e-04, 1.00676203e-04,-7.56230293e-05, 5.00352508e-05,
+    -2.70939199e-05, 8.58771182e-06, 4.85444616e-06,-1.34298898e-05, 1.78410701e-05,-1.90295596e-05,
+     1.79781491e-05,-1.55793896e-05, 1.25623001e-05,-9.46479395e-06, 6.63914079e-06,-4.27777695e-06,
+     2.44931402e-06,-1.13639896e-06, 2.70311801e-07, 2.41140299e-07,-4.93207892e-07, 5.71369299e-07,
+    -5.44659599e-07, 4.63888398e-07,-3.63015886e-07, 2.62308504e-07,-1.72294605e-07, 9.74072520e-08,
+    -3.95191009e-08, 1.88527194e-10, 1.75038100e-08,-1.20485497e-08,-2.00255390e-09, 4.34977387e-10
+  }
+ },
+ { /* phase 61 */
+  {
+     5.65430696e-07, 1.12118304e-03, 4.10341099e-02, 3.29818398e-01,-3.92626114e-02, 1.99564099e-01,
+    -1.09078199e-01,-3.93356313e-04, 6.21298701e-02,-7.65222609e-02, 6.12334386e-02,-3.34223993e-02,
+     5.04404679e-03, 1.71914697e-02,-3.06369197e-02, 3.53188403e-02,-3.28340903e-02, 2.54580099e-02,
+    -1.55828800e-02, 5.30056516e-03, 3.77391209e-03,-1.06186802e-02, 1.47546902e-02,-1.62004102e-02,
+     1.53172696e-02,-1.27105201e-02, 9.06330720e-03,-5.05981315e-03, 1.26563699e-03, 1.88914803e-03,
+    -4.16590320e-03, 5.47530409e-03,-5.88533701e-03, 5.54628903e-03,-4.68209293e-03, 3.51372594e-03,
+    -2.26099906e-03, 1.08432502e-03,-1.08476597e-04,-6.14649500e-04, 1.06446596e-03,-1.26580906e-03,
+     1.27237802e-03,-1.14613899e-03, 9.44828091e-04,-7.15502480e-04, 4.92433901e-04,-2.97333288e-04,
+     1.41254306e-04,-2.69389402e-05,-4.84855191e-05, 9.12688265e-05,-1.09006600e-04, 1.09348999e-04,
+    -9.89872206e-05, 8.33037266e-05,-6.61347876e-05, 4.99926500e-05,-3.61929415e-05, 2.52621994e-05,
+    -1.71091906e-05, 1.13824399e-05,-7.53852783e-06, 5.08027279e-06,-3.51260996e-06, 2.49094705e-06,
+    -1.71659497e-06, 1.05582706e-06,-4.43313098e-07, 2.60848907e-08, 3.51143683e-08,-4.17034990e-10
+  },
+  {
+     1.30226496e-07, 8.61040971e-05, 1.76384405e-03, 7.96491373e-03, 9.34830680e-03,-2.87814508e-03,
+    -2.92491890e-03, 4.21923399e-03,-2.87369010e-03, 8.22593982e-04, 8.72368691e-04,-1.83727802e-03,
+     2.08521192e-03,-1.79974595e-03, 1.20769604e-03,-5.13511419e-04,-1.28865096e-04, 6.22740423e-04,
+    -9.23891901e-04, 1.03018398e-03,-9.69142071e-04, 7.85654120e-04,-5.31131227e-04, 2.54873390e-04,
+     2.01039597e-06,-2.10107901e-04, 3.52868112e-04,-4.25843813e-04, 4.34549496e-04,-3.91514186e-04,
+     3.13082302e-04,-2.16432600e-04, 1.17157702e-04,-2.76030296e-05,-4.39819814e-05, 9.35470889e-05,
+    -1.20756697e-04, 1.28121595e-04,-1.19962402e-04, 1.01378100e-04,-7.73265128e-05, 5.22709997e-05,
+    -2.94730598e-05, 1.08269896e-05, 2.93203993e-06,-1.19093302e-05, 1.67363505e-05,-1.83062402e-05,
+     1.75738005e-05,-1.54202608e-05, 1.25754405e-05,-9.58587043e-06, 6.81638812e-06,-4.47311413e-06,
+     2.63744300e-06,-1.30273497e-06, 4.08437813e-07, 1.32008097e-07,-4.10434211e-07, 5.10630173e-07,
+    -5.01179102e-07, 4.33205514e-07,-3.41405297e-07, 2.46923292e-07,-1.61162205e-07, 8.93128771e-08,
+    -3.38585799e-08,-3.23276494e-09, 1.87749194e-08,-1.17161898e-08,-2.18561702e-09, 4.17033713e-10
+  }
+ },
+ { /* phase 62 */
+  {
+     6.95657093e-07, 1.20728696e-03, 4.27979492e-02, 3.37783307e-01,-2.99143009e-02, 1.96685895e-01,
+    -1.12003103e-01, 3.82587803e-03, 5.92561811e-02,-7.56996572e-02, 6.21058084e-02,-3.52596790e-02,
+     7.12925894e-03, 1.53917298e-02,-2.94292197e-02, 3.48053314e-02,-3.29629518e-02, 2.60807499e-02,
+    -1.65067706e-02, 6.33074902e-03, 2.80476990e-03,-9.83302854e-03, 1.42235598e-02,-1.59455296e-02,
+     1.53192803e-02,-1.29206302e-02, 9.41617507e-03,-5.48565714e-03, 1.70018605e-03, 1.49763399e-03,
+    -3.85282096e-03, 5.25887078e-03,-5.76817896e-03, 5.51868603e-03,-4.72607510e-03, 3.60727403e-03,
+    -2.38175597e-03, 1.21244695e-03,-2.28439007e-04,-5.13271429e-04, 9.87139647e-04,-1.21353799e-03,
+     1.24290504e-03,-1.13531202e-03, 9.47760127e-04,-7.27411883e-04, 5.09170175e-04,-3.15639598e-04,
+     1.58828101e-04,-4.23591882e-05,-3.59100814e-05, 8.16829634e-05,-1.02190199e-04, 1.04875900e-04,
+    -9.63497805e-05, 8.20010027e-05,-6.57263517e-05, 5.01246614e-05,-3.66033710e-05, 2.57728298e-05,
+    -1.76103604e-05, 1.18156404e-05,-7.87993304e-06, 5.32719696e-06,-3.67377197e-06, 2.58025989e-06,
+    -1.75045398e-06, 1.05259403e-06,-4.24538200e-07, 1.43687000e-08, 3.29287495e-08, 0.00000000e+00
+  },
+  {
+     1.54951096e-07, 9.17503567e-05, 1.82420795e-03, 8.07381887e-03, 9.23642237e-03,-3.05148889e-03,
+    -2.76497309e-03, 4.18693991e-03,-2.94504291e-03, 9.35927790e-04, 7.68525992e-04,-1.77151000e-03,
+     2.06553796e-03,-1.82036404e-03, 1.25571399e-03,-5.74137317e-04,-6.88974105e-05, 5.73310477e-04,
+    -8.90831579e-04, 1.01545604e-03,-9.71538713e-04, 8.01753893e-04,-5.56309475e-04, 2.84220499e-04,
+    -2.70421206e-05,-1.84868200e-04, 3.33756703e-04,-4.13932197e-04, 4.29796899e-04,-3.93013994e-04,
+     3.19366605e-04,-2.25781303e-04, 1.27870298e-04,-3.82057187e-05,-3.46066699e-05, 8.61070075e-05,
+    -1.15562601e-04, 1.25147897e-04,-1.18935997e-04, 1.01876700e-04,-7.88683028e-05, 5.43909991e-05,
+    -3.17802915e-05, 1.30318404e-05, 1.01502201e-06,-1.03739303e-05, 1.56046299e-05,-1.75503792e-05,
+     1.71363099e-05,-1.52306902e-05, 1.25627203e-05,-9.68637323e-06, 6.97827500e-06,-4.65772519e-06,
+     2.81864504e-06,-1.46504703e-06, 5.44602813e-07, 2.34827606e-08,-3.27467092e-07, 4.49297403e-07,
+    -4.56971009e-07, 4.01823002e-07,-3.19209192e-07, 2.31102803e-07,-1.49750804e-07, 8.10843730e-08,
+    -2.81849992e-08,-6.58124311e-09, 1.99436805e-08,-1.13301697e-08,-2.33958608e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 63 */
+  {
+     8.50608217e-07, 1.29903702e-03, 4.46221605e-02, 3.45857203e-01,-2.06778795e-02, 1.93634406e-01,
+    -1.14768103e-01, 8.01281817e-03, 5.63111417e-02,-7.47637376e-02, 6.28743321e-02,-3.70311886e-02,
+     9.19479690e-03, 1.35713601e-02,-2.81735100e-02, 3.42312008e-02,-3.30318511e-02, 2.66540609e-02,
+    -1.73976105e-02, 7.34620495e-03, 1.83323200e-03,-9.03127622e-03, 1.36672501e-02,-1.56613104e-02,
+     1.52922403e-02,-1.31054996e-02, 9.74993221e-03,-5.89958904e-03, 2.12998292e-03, 1.10462005e-03,
+    -3.53345391e-03, 5.03308978e-03,-5.64030884e-03, 5.48047991e-03,-4.76068212e-03, 3.69338109e-03,
+    -2.49731797e-03, 1.33759505e-03,-3.47374997e-04,-4.11394692e-04, 9.08271293e-04,-1.15914701e-03,
+     1.21112505e-03,-1.12228002e-03, 9.48775094e-04,-7.37785827e-04, 5.24774892e-04,-3.33189906e-04,
+     1.75964393e-04,-5.75898812e-05,-2.33473602e-05, 7.19965828e-05,-9.52119372e-05, 1.00218203e-04,
+    -9.35311327e-05, 8.05359523e-05,-6.51817536e-05, 5.01481409e-05,-3.69308400e-05, 2.62221292e-05,
+    -1.80673396e-05, 1.22174697e-05,-8.19914203e-06, 5.55829911e-06,-3.82352300e-06, 2.66134498e-06,
+    -1.77863899e-06, 1.04601304e-06,-4.04594488e-07, 3.03853409e-09, 3.05891703e-08, 0.00000000e+00
+  },
+  {
+     1.83467193e-07, 9.77018935e-05, 1.88598398e-03, 8.18169583e-03, 9.11997166e-03,-3.22073791e-03,
+    -2.60268897e-03, 4.14920691e-03,-3.01179895e-03, 1.04736304e-03, 6.63837884e-04,-1.70303695e-03,
+     2.04241904e-03,-1.83776405e-03, 1.30137405e-03,-6.33560703e-04,-8.97706832e-06, 5.22974995e-04,
+    -8.56226601e-04, 9.98889562e-04,-9.72118578e-04, 8.16305925e-04,-5.80367807e-04, 3.12943390e-04,
+    -5.59553191e-05,-1.59354997e-04, 3.14068893e-04,-4.01267200e-04, 4.24235099e-04,-3.93751892e-04,
+     3.25011788e-04,-2.34658306e-04, 1.38293603e-04,-4.86917088e-05,-2.52028494e-05, 7.85308512e-05,
+    -1.10165602e-04, 1.21942503e-04,-1.17680698e-04, 1.02172096e-04,-8.02461509e-05, 5.63916583e-05,
+    -3.40113984e-05, 1.51980403e-05,-8.92790695e-07,-8.82687345e-06, 1.44483602e-05,-1.67637099e-05,
+     1.66667905e-05,-1.50112801e-05, 1.25243396e-05,-9.76623687e-06, 7.12457495e-06,-4.83130088e-06,
+     2.99259091e-06,-1.62302194e-06, 6.78532388e-07,-8.42072083e-08,-2.44488689e-07, 3.87511307e-07,
+    -4.12141304e-07, 3.69819702e-07,-2.96485808e-07, 2.14890505e-07,-1.38092602e-07, 7.27458129e-08,
+    -2.25152998e-08,-9.84700588e-09, 2.10074393e-08,-1.08938503e-08,-2.46400389e-09, 0.00000000e+00
+  }
+ }
 };
 
-float
-xsynth_slope_dd_table [MINBLEP_PHASES * SLOPE_DD_PULSE_LENGTH + 1] =
+const xsynth_minblep_phase_t
+xsynth_slope_dd_table[MINBLEP_PHASES] =
 {
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 4.875745e-12,
-  1.319931e-11, 2.671711e-11, 4.827410e-11, 8.224100e-11, 1.350341e-10, 2.157396e-10, 3.368563e-10, 5.151702e-10,
-  7.727766e-10, 1.138267e-09, 1.648096e-09, 2.348151e-09, 3.295543e-09, 4.560635e-09, 6.229346e-09, 8.405729e-09,
-  1.121488e-08, 1.480620e-08, 1.935696e-08, 2.507639e-08, 3.221008e-08, 4.104494e-08, 5.191458e-08, 6.520533e-08,
-  8.136276e-08, 1.008988e-07, 1.243998e-07, 1.525346e-07, 1.860643e-07, 2.258523e-07, 2.728748e-07, 3.282333e-07,
-  3.931669e-07, 4.690664e-07, 5.574891e-07, 6.601751e-07, 7.790641e-07, 9.163142e-07, 1.074322e-06, 1.255742e-06,
-  1.463514e-06, 1.700880e-06, 1.971417e-06, 2.279062e-06, 2.628138e-06, 3.023391e-06, 3.470020e-06, 3.973711e-06,
-  4.540675e-06, 5.177689e-06, 5.892137e-06, 6.692052e-06, 7.586165e-06, 8.583950e-06, 9.695682e-06, 1.093249e-05,
-  1.230639e-05, 1.383041e-05, 1.551857e-05, 1.738600e-05, 1.944900e-05, 2.172511e-05, 2.423319e-05, 2.699349e-05,
-  3.002773e-05, 3.335920e-05, 3.701287e-05, 4.101542e-05, 4.539540e-05, 5.018331e-05, 5.541171e-05, 6.111531e-05,
-  6.733114e-05, 7.409858e-05, 8.145958e-05, 8.945873e-05, 9.814341e-05, 1.075639e-04, 1.177736e-04, 1.288291e-04,
-  1.407903e-04, 1.537208e-04, 1.676877e-04, 1.827619e-04, 1.990187e-04, 2.165372e-04, 2.354010e-04, 2.556985e-04,
-  2.775225e-04, 3.009711e-04, 3.261474e-04, 3.531599e-04, 3.821227e-04, 4.131557e-04, 4.463850e-04, 4.819426e-04,
-  5.199675e-04, 5.606050e-04, 6.040076e-04, 6.503351e-04, 6.997547e-04, 7.524414e-04, 8.085780e-04, 8.683560e-04,
-  9.319752e-04, 9.996443e-04, 1.071581e-03, 1.148013e-03, 1.229176e-03, 1.315319e-03, 1.406697e-03, 1.503579e-03,
-  1.606244e-03, 1.714982e-03, 1.830093e-03, 1.951892e-03, 2.080704e-03, 2.216867e-03, 2.360731e-03, 2.512661e-03,
-  2.673033e-03, 2.842239e-03, 3.020684e-03, 3.208788e-03, 3.406984e-03, 3.615723e-03, 3.835468e-03, 4.066700e-03,
-  4.309916e-03, 4.565629e-03, 4.834368e-03, 5.116679e-03, 5.413126e-03, 5.724290e-03, 6.050771e-03, 6.393186e-03,
-  6.752171e-03, 7.128380e-03, 7.522488e-03, 7.935186e-03, 8.367189e-03, 8.819228e-03, 9.292055e-03, 9.786444e-03,
-  1.030319e-02, 1.084310e-02, 1.140702e-02, 1.199580e-02, 1.261032e-02, 1.325148e-02, 1.392020e-02, 1.461742e-02,
-  1.534411e-02, 1.610125e-02, 1.688986e-02, 1.771097e-02, 1.856563e-02, 1.945492e-02, 2.037994e-02, 2.134182e-02,
-  2.234168e-02, 2.338071e-02, 2.446010e-02, 2.558105e-02, 2.674480e-02, 2.795260e-02, 2.920575e-02, 3.050554e-02,
-  3.185329e-02, 3.325034e-02, 3.469808e-02, 3.619788e-02, 3.775115e-02, 3.935932e-02, 4.102385e-02, 4.274620e-02,
-  4.452788e-02, 4.637037e-02, 4.827523e-02, 5.024399e-02, 5.227821e-02, 5.437950e-02, 5.654944e-02, 5.878965e-02,
-  6.110177e-02, 6.348744e-02, 6.594834e-02, 6.848614e-02, 7.110252e-02, 7.379920e-02, 7.657790e-02, 7.944033e-02,
-  8.238825e-02, 8.542339e-02, 8.854752e-02, 9.176240e-02, 9.506980e-02, 9.847150e-02, 1.019693e-01, 1.055650e-01,
-  1.092603e-01, 1.130571e-01, 1.169571e-01, 1.209622e-01, 1.250741e-01, 1.292946e-01, 1.336256e-01, 1.380688e-01,
-  1.426259e-01, 1.472988e-01, 1.520892e-01, 1.569989e-01, 1.620296e-01, 1.671830e-01, 1.724609e-01, 1.778649e-01,
-  1.833967e-01, 1.734331e-01, 1.636006e-01, 1.539009e-01, 1.443356e-01, 1.349063e-01, 1.256145e-01, 1.164618e-01,
-  1.074497e-01, 9.857959e-02, 8.985302e-02, 8.127137e-02, 7.283602e-02, 6.454832e-02, 5.640959e-02, 4.842110e-02,
-  4.058409e-02, 3.289976e-02, 2.536926e-02, 1.799369e-02, 1.077414e-02, 3.711615e-03,-3.192902e-03,-9.938489e-03,
- -1.652427e-02,-2.294942e-02,-2.921316e-02,-3.531478e-02,-4.125362e-02,-4.702906e-02,-5.264056e-02,-5.808762e-02,
- -6.336982e-02,-6.848678e-02,-7.343820e-02,-7.822383e-02,-8.284348e-02,-8.729705e-02,-9.158447e-02,-9.570577e-02,
- -9.966102e-02,-1.034504e-01,-1.070741e-01,-1.105324e-01,-1.138257e-01,-1.169544e-01,-1.199190e-01,-1.227201e-01,
- -1.253584e-01,-1.278345e-01,-1.301493e-01,-1.323036e-01,-1.342984e-01,-1.361346e-01,-1.378134e-01,-1.393359e-01,
- -1.407034e-01,-1.419172e-01,-1.429787e-01,-1.438892e-01,-1.446505e-01,-1.452639e-01,-1.457314e-01,-1.460545e-01,
- -1.462350e-01,-1.462750e-01,-1.461764e-01,-1.459411e-01,-1.455713e-01,-1.450691e-01,-1.444368e-01,-1.436767e-01,
- -1.427911e-01,-1.417825e-01,-1.406533e-01,-1.394062e-01,-1.380436e-01,-1.365683e-01,-1.349830e-01,-1.332904e-01,
- -1.314934e-01,-1.295950e-01,-1.275979e-01,-1.255052e-01,-1.233199e-01,-1.210451e-01,-1.186839e-01,-1.162394e-01,
- -1.137149e-01,-1.111135e-01,-1.084385e-01,-1.056932e-01,-1.028810e-01,-1.000051e-01,-9.706896e-02,-9.407596e-02,
- -9.102951e-02,-8.793303e-02,-8.478997e-02,-8.160378e-02,-7.837794e-02,-7.511591e-02,-7.182118e-02,-6.849721e-02,
- -6.514749e-02,-6.177549e-02,-5.838468e-02,-5.497852e-02,-5.156044e-02,-4.813388e-02,-4.470226e-02,-4.126896e-02,
- -3.783736e-02,-3.441081e-02,-3.099261e-02,-2.758605e-02,-2.419439e-02,-2.082084e-02,-1.746857e-02,-1.414072e-02,
- -1.084038e-02,-7.570592e-03,-4.334348e-03,-1.134587e-03, 2.025803e-03, 5.143991e-03, 8.217208e-03, 1.124275e-02,
-  1.421796e-02, 1.714027e-02, 2.000717e-02, 2.281622e-02, 2.556505e-02, 2.825137e-02, 3.087296e-02, 3.342769e-02,
-  3.591351e-02, 3.832843e-02, 4.067056e-02, 4.293810e-02, 4.512934e-02, 4.724263e-02, 4.927644e-02, 5.122932e-02,
-  5.309990e-02, 5.488694e-02, 5.658924e-02, 5.820574e-02, 5.973545e-02, 6.117750e-02, 6.253108e-02, 6.379552e-02,
-  6.497022e-02, 6.605468e-02, 6.704851e-02, 6.795142e-02, 6.876321e-02, 6.948377e-02, 7.011311e-02, 7.065132e-02,
-  7.109860e-02, 7.145523e-02, 7.172161e-02, 7.189822e-02, 7.198564e-02, 7.198454e-02, 7.189569e-02, 7.171994e-02,
-  7.145825e-02, 7.111165e-02, 7.068127e-02, 7.016832e-02, 6.957410e-02, 6.890000e-02, 6.814746e-02, 6.731805e-02,
-  6.641337e-02, 6.543513e-02, 6.438508e-02, 6.326508e-02, 6.207704e-02, 6.082293e-02, 5.950478e-02, 5.812471e-02,
-  5.668487e-02, 5.518749e-02, 5.363483e-02, 5.202923e-02, 5.037304e-02, 4.866870e-02, 4.691865e-02, 4.512540e-02,
-  4.329148e-02, 4.141946e-02, 3.951195e-02, 3.757156e-02, 3.560096e-02, 3.360280e-02, 3.157979e-02, 2.953462e-02,
-  2.747001e-02, 2.538868e-02, 2.329336e-02, 2.118679e-02, 1.907168e-02, 1.695076e-02, 1.482676e-02, 1.270236e-02,
-  1.058025e-02, 8.463123e-03, 6.353609e-03, 4.254340e-03, 2.167914e-03, 9.690017e-05,-1.956168e-03,-3.988791e-03,
- -5.998509e-03,-7.982905e-03,-9.939607e-03,-1.186629e-02,-1.376068e-02,-1.562055e-02,-1.744374e-02,-1.922814e-02,
- -2.097171e-02,-2.267245e-02,-2.432846e-02,-2.593787e-02,-2.749891e-02,-2.900985e-02,-3.046908e-02,-3.187501e-02,
- -3.322618e-02,-3.452116e-02,-3.575862e-02,-3.693733e-02,-3.805612e-02,-3.911391e-02,-4.010970e-02,-4.104258e-02,
- -4.191174e-02,-4.271642e-02,-4.345600e-02,-4.412991e-02,-4.473768e-02,-4.527893e-02,-4.575336e-02,-4.616079e-02,
- -4.650110e-02,-4.677426e-02,-4.698035e-02,-4.711951e-02,-4.719200e-02,-4.719815e-02,-4.713837e-02,-4.701317e-02,
- -4.682314e-02,-4.656895e-02,-4.625136e-02,-4.587120e-02,-4.542940e-02,-4.492695e-02,-4.436493e-02,-4.374447e-02,
- -4.306681e-02,-4.233323e-02,-4.154510e-02,-4.070386e-02,-3.981099e-02,-3.886805e-02,-3.787667e-02,-3.683852e-02,
- -3.575534e-02,-3.462891e-02,-3.346107e-02,-3.225371e-02,-3.100875e-02,-2.972818e-02,-2.841400e-02,-2.706827e-02,
- -2.569306e-02,-2.429050e-02,-2.286272e-02,-2.141190e-02,-1.994022e-02,-1.844988e-02,-1.694312e-02,-1.542217e-02,
- -1.388928e-02,-1.234668e-02,-1.079665e-02,-9.241427e-03,-7.683267e-03,-6.124412e-03,-4.567099e-03,-3.013550e-03,
- -1.465969e-03, 7.345568e-05, 1.602561e-03, 3.119201e-03, 4.621267e-03, 6.106673e-03, 7.573373e-03, 9.019352e-03,
-  1.044264e-02, 1.184129e-02, 1.321343e-02, 1.455721e-02, 1.587083e-02, 1.715257e-02, 1.840072e-02, 1.961366e-02,
-  2.078981e-02, 2.192765e-02, 2.302575e-02, 2.408271e-02, 2.509720e-02, 2.606798e-02, 2.699386e-02, 2.787372e-02,
-  2.870652e-02, 2.949129e-02, 3.022714e-02, 3.091325e-02, 3.154886e-02, 3.213331e-02, 3.266602e-02, 3.314647e-02,
-  3.357423e-02, 3.394894e-02, 3.427034e-02, 3.453823e-02, 3.475248e-02, 3.491308e-02, 3.502005e-02, 3.507353e-02,
-  3.507371e-02, 3.502087e-02, 3.491537e-02, 3.475764e-02, 3.454819e-02, 3.428760e-02, 3.397653e-02, 3.361570e-02,
-  3.320592e-02, 3.274804e-02, 3.224301e-02, 3.169184e-02, 3.109558e-02, 3.045536e-02, 2.977238e-02, 2.904788e-02,
-  2.828318e-02, 2.747963e-02, 2.663865e-02, 2.576170e-02, 2.485029e-02, 2.390597e-02, 2.293036e-02, 2.192509e-02,
-  2.089183e-02, 1.983231e-02, 1.874827e-02, 1.764147e-02, 1.651374e-02, 1.536688e-02, 1.420276e-02, 1.302324e-02,
-  1.183019e-02, 1.062553e-02, 9.411141e-03, 8.188949e-03, 6.960866e-03, 5.728809e-03, 4.494692e-03, 3.260427e-03,
-  2.027916e-03, 7.990528e-04,-4.242846e-04,-1.640233e-03,-2.846948e-03,-4.042609e-03,-5.225416e-03,-6.393600e-03,
- -7.545418e-03,-8.679163e-03,-9.793158e-03,-1.088577e-02,-1.195540e-02,-1.300049e-02,-1.401953e-02,-1.501106e-02,
- -1.597365e-02,-1.690595e-02,-1.780664e-02,-1.867446e-02,-1.950821e-02,-2.030673e-02,-2.106895e-02,-2.179384e-02,
- -2.248044e-02,-2.312784e-02,-2.373521e-02,-2.430177e-02,-2.482684e-02,-2.530977e-02,-2.574999e-02,-2.614701e-02,
- -2.650040e-02,-2.680979e-02,-2.707491e-02,-2.729552e-02,-2.747150e-02,-2.760275e-02,-2.768928e-02,-2.773114e-02,
- -2.772848e-02,-2.768149e-02,-2.759045e-02,-2.745570e-02,-2.727765e-02,-2.705677e-02,-2.679361e-02,-2.648878e-02,
- -2.614293e-02,-2.575681e-02,-2.533121e-02,-2.486698e-02,-2.436503e-02,-2.382633e-02,-2.325189e-02,-2.264280e-02,
- -2.200017e-02,-2.132519e-02,-2.061907e-02,-1.988308e-02,-1.911853e-02,-1.832677e-02,-1.750919e-02,-1.666720e-02,
- -1.580228e-02,-1.491590e-02,-1.400958e-02,-1.308487e-02,-1.214334e-02,-1.118656e-02,-1.021616e-02,-9.233750e-03,
- -8.240966e-03,-7.239457e-03,-6.230874e-03,-5.216879e-03,-4.199134e-03,-3.179299e-03,-2.159034e-03,-1.139993e-03,
- -1.238228e-04, 8.878428e-04, 1.893383e-03, 2.891193e-03, 3.879685e-03, 4.857291e-03, 5.822470e-03, 6.773704e-03,
-  7.709503e-03, 8.628409e-03, 9.528995e-03, 1.040987e-02, 1.126968e-02, 1.210711e-02, 1.292089e-02, 1.370978e-02,
-  1.447261e-02, 1.520822e-02, 1.591554e-02, 1.659351e-02, 1.724115e-02, 1.785752e-02, 1.844174e-02, 1.899299e-02,
-  1.951049e-02, 1.999354e-02, 2.044147e-02, 2.085371e-02, 2.122970e-02, 2.156899e-02, 2.187115e-02, 2.213586e-02,
-  2.236281e-02, 2.255179e-02, 2.270263e-02, 2.281525e-02, 2.288961e-02, 2.292574e-02, 2.292372e-02, 2.288373e-02,
-  2.280597e-02, 2.269072e-02, 2.253832e-02, 2.234917e-02, 2.212373e-02, 2.186252e-02, 2.156610e-02, 2.123511e-02,
-  2.087023e-02, 2.047221e-02, 2.004182e-02, 1.957991e-02, 1.908738e-02, 1.856516e-02, 1.801422e-02, 1.743561e-02,
-  1.683039e-02, 1.619967e-02, 1.554459e-02, 1.486636e-02, 1.416617e-02, 1.344529e-02, 1.270500e-02, 1.194660e-02,
-  1.117143e-02, 1.038086e-02, 9.576254e-03, 8.759015e-03, 7.930558e-03, 7.092310e-03, 6.245711e-03, 5.392209e-03,
-  4.533261e-03, 3.670323e-03, 2.804857e-03, 1.938324e-03, 1.072181e-03, 2.078775e-04,-6.531433e-04,-1.509447e-03,
- -2.359614e-03,-3.202239e-03,-4.035936e-03,-4.859336e-03,-5.671093e-03,-6.469884e-03,-7.254414e-03,-8.023416e-03,
- -8.775652e-03,-9.509917e-03,-1.022504e-02,-1.091989e-02,-1.159337e-02,-1.224442e-02,-1.287202e-02,-1.347521e-02,
- -1.405304e-02,-1.460465e-02,-1.512920e-02,-1.562590e-02,-1.609400e-02,-1.653283e-02,-1.694175e-02,-1.732017e-02,
- -1.766757e-02,-1.798348e-02,-1.826746e-02,-1.851916e-02,-1.873827e-02,-1.892454e-02,-1.907776e-02,-1.919781e-02,
- -1.928459e-02,-1.933808e-02,-1.935830e-02,-1.934536e-02,-1.929938e-02,-1.922057e-02,-1.910917e-02,-1.896550e-02,
- -1.878992e-02,-1.858284e-02,-1.834473e-02,-1.807610e-02,-1.777753e-02,-1.744963e-02,-1.709306e-02,-1.670854e-02,
- -1.629683e-02,-1.585871e-02,-1.539505e-02,-1.490672e-02,-1.439464e-02,-1.385978e-02,-1.330313e-02,-1.272572e-02,
- -1.212862e-02,-1.151291e-02,-1.087972e-02,-1.023020e-02,-9.565518e-03,-8.886866e-03,-8.195458e-03,-7.492526e-03,
- -6.779319e-03,-6.057096e-03,-5.327132e-03,-4.590705e-03,-3.849107e-03,-3.103628e-03,-2.355567e-03,-1.606219e-03,
- -8.568775e-04,-1.088340e-04, 6.366295e-04, 1.378237e-03, 2.114723e-03, 2.844836e-03, 3.567342e-03, 4.281018e-03,
-  4.984664e-03, 5.677101e-03, 6.357172e-03, 7.023748e-03, 7.675722e-03, 8.312017e-03, 8.931587e-03, 9.533421e-03,
-  1.011654e-02, 1.067999e-02, 1.122288e-02, 1.174433e-02, 1.224351e-02, 1.271964e-02, 1.317197e-02, 1.359979e-02,
-  1.400246e-02, 1.437934e-02, 1.472990e-02, 1.505359e-02, 1.534995e-02, 1.561857e-02, 1.585907e-02, 1.607112e-02,
-  1.625446e-02, 1.640886e-02, 1.653415e-02, 1.663022e-02, 1.669699e-02, 1.673446e-02, 1.674264e-02, 1.672163e-02,
-  1.667157e-02, 1.659263e-02, 1.648505e-02, 1.634911e-02, 1.618516e-02, 1.599356e-02, 1.577474e-02, 1.552918e-02,
-  1.525739e-02, 1.495994e-02, 1.463743e-02, 1.429051e-02, 1.391986e-02, 1.352621e-02, 1.311033e-02, 1.267301e-02,
-  1.221510e-02, 1.173746e-02, 1.124099e-02, 1.072662e-02, 1.019531e-02, 9.648053e-03, 9.085852e-03, 8.509746e-03,
-  7.920786e-03, 7.320048e-03, 6.708623e-03, 6.087618e-03, 5.458154e-03, 4.821361e-03, 4.178381e-03, 3.530363e-03,
-  2.878459e-03, 2.223828e-03, 1.567628e-03, 9.110154e-04, 2.551463e-04,-3.988301e-04,-1.049771e-03,-1.696542e-03,
- -2.338019e-03,-2.973092e-03,-3.600664e-03,-4.219656e-03,-4.829006e-03,-5.427674e-03,-6.014640e-03,-6.588908e-03,
- -7.149508e-03,-7.695495e-03,-8.225956e-03,-8.740007e-03,-9.236793e-03,-9.715494e-03,-1.017533e-02,-1.061554e-02,
- -1.103541e-02,-1.143428e-02,-1.181150e-02,-1.216648e-02,-1.249866e-02,-1.280753e-02,-1.309262e-02,-1.335350e-02,
- -1.358979e-02,-1.380115e-02,-1.398728e-02,-1.414794e-02,-1.428292e-02,-1.439207e-02,-1.447527e-02,-1.453247e-02,
- -1.456364e-02,-1.456881e-02,-1.454806e-02,-1.450151e-02,-1.442931e-02,-1.433169e-02,-1.420889e-02,-1.406121e-02,
- -1.388899e-02,-1.369262e-02,-1.347252e-02,-1.322916e-02,-1.296305e-02,-1.267472e-02,-1.236477e-02,-1.203380e-02,
- -1.168248e-02,-1.131149e-02,-1.092156e-02,-1.051343e-02,-1.008790e-02,-9.645771e-03,-9.187884e-03,-8.715103e-03,
- -8.228318e-03,-7.728438e-03,-7.216395e-03,-6.693139e-03,-6.159637e-03,-5.616873e-03,-5.065842e-03,-4.507551e-03,
- -3.943020e-03,-3.373275e-03,-2.799348e-03,-2.222273e-03,-1.643092e-03,-1.062846e-03,-4.825734e-04, 9.669087e-05,
-  6.739160e-04, 1.248076e-03, 1.818158e-03, 2.383154e-03, 2.942070e-03, 3.493928e-03, 4.037761e-03, 4.572624e-03,
-  5.097587e-03, 5.611743e-03, 6.114205e-03, 6.604111e-03, 7.080622e-03, 7.542927e-03, 7.990244e-03, 8.421819e-03,
-  8.836926e-03, 9.234874e-03, 9.615001e-03, 9.976682e-03, 1.031933e-02, 1.064238e-02, 1.094532e-02, 1.122767e-02,
-  1.148899e-02, 1.172886e-02, 1.194693e-02, 1.214288e-02, 1.231641e-02, 1.246729e-02, 1.259532e-02, 1.270033e-02,
-  1.278221e-02, 1.284089e-02, 1.287632e-02, 1.288851e-02, 1.287752e-02, 1.284343e-02, 1.278639e-02, 1.270655e-02,
-  1.260413e-02, 1.247940e-02, 1.233263e-02, 1.216416e-02, 1.197436e-02, 1.176364e-02, 1.153244e-02, 1.128123e-02,
-  1.101054e-02, 1.072091e-02, 1.041292e-02, 1.008718e-02, 9.744325e-03, 9.385032e-03, 9.009996e-03, 8.619943e-03,
-  8.215620e-03, 7.797800e-03, 7.367278e-03, 6.924870e-03, 6.471409e-03, 6.007745e-03, 5.534750e-03, 5.053304e-03,
-  4.564301e-03, 4.068647e-03, 3.567259e-03, 3.061059e-03, 2.550975e-03, 2.037943e-03, 1.522896e-03, 1.006773e-03,
-  4.905100e-04,-2.495910e-05,-5.387052e-04,-1.049804e-03,-1.557339e-03,-2.060402e-03,-2.558098e-03,-3.049541e-03,
- -3.533862e-03,-4.010203e-03,-4.477728e-03,-4.935617e-03,-5.383068e-03,-5.819303e-03,-6.243564e-03,-6.655120e-03,
- -7.053263e-03,-7.437312e-03,-7.806612e-03,-8.160539e-03,-8.498496e-03,-8.819919e-03,-9.124275e-03,-9.411062e-03,
- -9.679812e-03,-9.930093e-03,-1.016151e-02,-1.037368e-02,-1.056630e-02,-1.073907e-02,-1.089174e-02,-1.102407e-02,
- -1.113591e-02,-1.122710e-02,-1.129755e-02,-1.134718e-02,-1.137597e-02,-1.138392e-02,-1.137109e-02,-1.133756e-02,
- -1.128346e-02,-1.120894e-02,-1.111420e-02,-1.099947e-02,-1.086502e-02,-1.071115e-02,-1.053821e-02,-1.034656e-02,
- -1.013660e-02,-9.908787e-03,-9.663573e-03,-9.401460e-03,-9.122978e-03,-8.828680e-03,-8.519151e-03,-8.194997e-03,
- -7.856856e-03,-7.505385e-03,-7.141266e-03,-6.765200e-03,-6.377906e-03,-5.980124e-03,-5.572612e-03,-5.156142e-03,
- -4.731500e-03,-4.299487e-03,-3.860912e-03,-3.416594e-03,-2.967364e-03,-2.514054e-03,-2.057505e-03,-1.598560e-03,
- -1.138065e-03,-6.768666e-04,-2.158081e-04, 2.442678e-04, 7.025234e-04, 1.158125e-03, 1.610249e-03, 2.058079e-03,
-  2.500809e-03, 2.937644e-03, 3.367802e-03, 3.790518e-03, 4.205037e-03, 4.610626e-03, 5.006571e-03, 5.392174e-03,
-  5.766759e-03, 6.129674e-03, 6.480289e-03, 6.818000e-03, 7.142223e-03, 7.452404e-03, 7.748019e-03, 8.028567e-03,
-  8.293579e-03, 8.542614e-03, 8.775265e-03, 8.991152e-03, 9.189929e-03, 9.371281e-03, 9.534927e-03, 9.680619e-03,
-  9.808143e-03, 9.917317e-03, 1.000800e-02, 1.008007e-02, 1.013346e-02, 1.016812e-02, 1.018404e-02, 1.018126e-02,
-  1.015982e-02, 1.011982e-02, 1.006140e-02, 9.984706e-03, 9.889941e-03, 9.777330e-03, 9.647132e-03, 9.499638e-03,
-  9.335170e-03, 9.154079e-03, 8.956746e-03, 8.743584e-03, 8.515028e-03, 8.271545e-03, 8.013626e-03, 7.741790e-03,
-  7.456574e-03, 7.158543e-03, 6.848282e-03, 6.526400e-03, 6.193520e-03, 5.850289e-03, 5.497369e-03, 5.135438e-03,
-  4.765189e-03, 4.387327e-03, 4.002570e-03, 3.611647e-03, 3.215296e-03, 2.814262e-03, 2.409298e-03, 2.001162e-03,
-  1.590614e-03, 1.178420e-03, 7.653417e-04, 3.521442e-04,-6.041013e-05,-4.715633e-04,-8.805615e-04,-1.286657e-03,
- -1.689108e-03,-2.087184e-03,-2.480163e-03,-2.867335e-03,-3.248003e-03,-3.621484e-03,-3.987110e-03,-4.344227e-03,
- -4.692203e-03,-5.030422e-03,-5.358287e-03,-5.675224e-03,-5.980678e-03,-6.274122e-03,-6.555046e-03,-6.822968e-03,
- -7.077433e-03,-7.318009e-03,-7.544290e-03,-7.755903e-03,-7.952497e-03,-8.133754e-03,-8.299384e-03,-8.449124e-03,
- -8.582746e-03,-8.700051e-03,-8.800868e-03,-8.885058e-03,-8.952514e-03,-9.003161e-03,-9.036954e-03,-9.053879e-03,
- -9.053955e-03,-9.037230e-03,-9.003785e-03,-8.953730e-03,-8.887207e-03,-8.804386e-03,-8.705469e-03,-8.590685e-03,
- -8.460293e-03,-8.314580e-03,-8.153861e-03,-7.978478e-03,-7.788800e-03,-7.585217e-03,-7.368147e-03,-7.138033e-03,
- -6.895338e-03,-6.640551e-03,-6.374178e-03,-6.096747e-03,-5.808805e-03,-5.510916e-03,-5.203662e-03,-4.887640e-03,
- -4.563460e-03,-4.231750e-03,-3.893146e-03,-3.548296e-03,-3.197858e-03,-2.842500e-03,-2.482895e-03,-2.119723e-03,
- -1.753668e-03,-1.385418e-03,-1.015663e-03,-6.450942e-04,-2.744028e-04, 9.572368e-05, 4.645977e-04, 8.315391e-04,
-  1.195872e-03, 1.556926e-03, 1.914041e-03, 2.266565e-03, 2.613855e-03, 2.955282e-03, 3.290227e-03, 3.618088e-03,
-  3.938275e-03, 4.250216e-03, 4.553355e-03, 4.847153e-03, 5.131091e-03, 5.404671e-03, 5.667412e-03, 5.918859e-03,
-  6.158576e-03, 6.386152e-03, 6.601198e-03, 6.803353e-03, 6.992275e-03, 7.167652e-03, 7.329198e-03, 7.476652e-03,
-  7.609780e-03, 7.728377e-03, 7.832265e-03, 7.921293e-03, 7.995338e-03, 8.054307e-03, 8.098131e-03, 8.126775e-03,
-  8.140230e-03, 8.138516e-03, 8.121678e-03, 8.089793e-03, 8.042964e-03, 7.981323e-03, 7.905026e-03, 7.814261e-03,
-  7.709237e-03, 7.590191e-03, 7.457388e-03, 7.311116e-03, 7.151686e-03, 6.979432e-03, 6.794716e-03, 6.597918e-03,
-  6.389439e-03, 6.169704e-03, 5.939154e-03, 5.698251e-03, 5.447477e-03, 5.187326e-03, 4.918312e-03, 4.640963e-03,
-  4.355822e-03, 4.063444e-03, 3.764396e-03, 3.459255e-03, 3.148608e-03, 2.833051e-03, 2.513190e-03, 2.189634e-03,
-  1.862999e-03, 1.533903e-03, 1.202968e-03, 8.708170e-04, 5.380759e-04, 2.053678e-04,-1.266865e-04,-4.574685e-04,
- -7.863627e-04,-1.112759e-03,-1.436056e-03,-1.755659e-03,-2.070981e-03,-2.381444e-03,-2.686483e-03,-2.985542e-03,
- -3.278080e-03,-3.563569e-03,-3.841495e-03,-4.111362e-03,-4.372687e-03,-4.625008e-03,-4.867876e-03,-5.100867e-03,
- -5.323575e-03,-5.535611e-03,-5.736610e-03,-5.926229e-03,-6.104146e-03,-6.270063e-03,-6.423705e-03,-6.564818e-03,
- -6.693177e-03,-6.808578e-03,-6.910845e-03,-6.999823e-03,-7.075384e-03,-7.137427e-03,-7.185876e-03,-7.220679e-03,
- -7.241812e-03,-7.249277e-03,-7.243098e-03,-7.223328e-03,-7.190043e-03,-7.143346e-03,-7.083365e-03,-7.010251e-03,
- -6.924179e-03,-6.825349e-03,-6.713986e-03,-6.590332e-03,-6.454659e-03,-6.307254e-03,-6.148431e-03,-5.978519e-03,
- -5.797872e-03,-5.606859e-03,-5.405871e-03,-5.195311e-03,-4.975605e-03,-4.747192e-03,-4.510527e-03,-4.266078e-03,
- -4.014326e-03,-3.755768e-03,-3.490907e-03,-3.220261e-03,-2.944352e-03,-2.663717e-03,-2.378895e-03,-2.090435e-03,
- -1.798888e-03,-1.504812e-03,-1.208767e-03,-9.113150e-04,-6.130177e-04,-3.144382e-04,-1.613856e-05, 2.813210e-04,
-  5.773830e-04, 8.714958e-04, 1.163113e-03, 1.451692e-03, 1.736702e-03, 2.017617e-03, 2.293919e-03, 2.565105e-03,
-  2.830678e-03, 3.090155e-03, 3.343069e-03, 3.588962e-03, 3.827393e-03, 4.057934e-03, 4.280178e-03, 4.493730e-03,
-  4.698212e-03, 4.893268e-03, 5.078560e-03, 5.253768e-03, 5.418590e-03, 5.572749e-03, 5.715985e-03, 5.848063e-03,
-  5.968767e-03, 6.077904e-03, 6.175302e-03, 6.260813e-03, 6.334310e-03, 6.395692e-03, 6.444882e-03, 6.481820e-03,
-  6.506474e-03, 6.518833e-03, 6.518913e-03, 6.506750e-03, 6.482402e-03, 6.445953e-03, 6.397506e-03, 6.337191e-03,
-  6.265154e-03, 6.181567e-03, 6.086622e-03, 5.980534e-03, 5.863533e-03, 5.735874e-03, 5.597830e-03, 5.449692e-03,
-  5.291769e-03, 5.124388e-03, 4.947893e-03, 4.762645e-03, 4.569018e-03, 4.367404e-03, 4.158206e-03, 3.941842e-03,
-  3.718742e-03, 3.489346e-03, 3.254106e-03, 3.013482e-03, 2.767946e-03, 2.517978e-03, 2.264059e-03, 2.006681e-03,
-  1.746341e-03, 1.483540e-03, 1.218779e-03, 9.525655e-04, 6.854069e-04, 4.178084e-04, 1.502777e-04,-1.166814e-04,
- -3.825650e-04,-6.468747e-04,-9.091177e-04,-1.168804e-03,-1.425449e-03,-1.678580e-03,-1.927729e-03,-2.172437e-03,
- -2.412255e-03,-2.646746e-03,-2.875481e-03,-3.098048e-03,-3.314042e-03,-3.523078e-03,-3.724780e-03,-3.918789e-03,
- -4.104761e-03,-4.282372e-03,-4.451309e-03,-4.611281e-03,-4.762012e-03,-4.903244e-03,-5.034740e-03,-5.156280e-03,
- -5.267667e-03,-5.368718e-03,-5.459274e-03,-5.539198e-03,-5.608369e-03,-5.666691e-03,-5.714086e-03,-5.750496e-03,
- -5.775886e-03,-5.790243e-03,-5.793572e-03,-5.785903e-03,-5.767282e-03,-5.737778e-03,-5.697479e-03,-5.646496e-03,
- -5.584957e-03,-5.513011e-03,-5.430827e-03,-5.338591e-03,-5.236508e-03,-5.124803e-03,-5.003715e-03,-4.873505e-03,
- -4.734443e-03,-4.586823e-03,-4.430950e-03,-4.267144e-03,-4.095740e-03,-3.917087e-03,-3.731543e-03,-3.539482e-03,
- -3.341289e-03,-3.137356e-03,-2.928090e-03,-2.713900e-03,-2.495212e-03,-2.272449e-03,-2.046049e-03,-1.816451e-03,
- -1.584101e-03,-1.349446e-03,-1.112940e-03,-8.750357e-04,-6.361900e-04,-3.968576e-04,-1.574939e-04, 8.144811e-05,
-  3.195150e-04, 5.562586e-04, 7.912335e-04, 1.024001e-03, 1.254126e-03, 1.481180e-03, 1.704742e-03, 1.924398e-03,
-  2.139745e-03, 2.350387e-03, 2.555937e-03, 2.756023e-03, 2.950282e-03, 3.138363e-03, 3.319929e-03, 3.494654e-03,
-  3.662228e-03, 3.822357e-03, 3.974758e-03, 4.119168e-03, 4.255335e-03, 4.383028e-03, 4.502031e-03, 4.612145e-03,
-  4.713188e-03, 4.804995e-03, 4.887423e-03, 4.960344e-03, 5.023647e-03, 5.077244e-03, 5.121062e-03, 5.155048e-03,
-  5.179170e-03, 5.193414e-03, 5.197781e-03, 5.192294e-03, 5.176995e-03, 5.151943e-03, 5.117217e-03, 5.072911e-03,
-  5.019140e-03, 4.956038e-03, 4.883752e-03, 4.802448e-03, 4.712310e-03, 4.613536e-03, 4.506341e-03, 4.390954e-03,
-  4.267622e-03, 4.136604e-03, 3.998173e-03, 3.852614e-03, 3.700228e-03, 3.541324e-03, 3.376226e-03, 3.205269e-03,
-  3.028795e-03, 2.847155e-03, 2.660715e-03, 2.469841e-03, 2.274911e-03, 2.076309e-03, 1.874424e-03, 1.669650e-03,
-  1.462388e-03, 1.253037e-03, 1.042003e-03, 8.296931e-04, 6.165153e-04, 4.028769e-04, 1.891872e-04,-2.414728e-05,
- -2.367220e-04,-4.481347e-04,-6.579873e-04,-8.658836e-04,-1.071435e-03,-1.274260e-03,-1.473978e-03,-1.670221e-03,
- -1.862624e-03,-2.050835e-03,-2.234508e-03,-2.413308e-03,-2.586909e-03,-2.754998e-03,-2.917272e-03,-3.073442e-03,
- -3.223229e-03,-3.366367e-03,-3.502605e-03,-3.631707e-03,-3.753448e-03,-3.867621e-03,-3.974033e-03,-4.072505e-03,
- -4.162875e-03,-4.244997e-03,-4.318740e-03,-4.383991e-03,-4.440655e-03,-4.488647e-03,-4.527906e-03,-4.558385e-03,
- -4.580055e-03,-4.592901e-03,-4.596930e-03,-4.592159e-03,-4.578626e-03,-4.556387e-03,-4.525512e-03,-4.486086e-03,
- -4.438213e-03,-4.382012e-03,-4.317616e-03,-4.245175e-03,-4.164851e-03,-4.076825e-03,-3.981288e-03,-3.878450e-03,
- -3.768527e-03,-3.651753e-03,-3.528373e-03,-3.398643e-03,-3.262832e-03,-3.121219e-03,-2.974090e-03,-2.821747e-03,
- -2.664497e-03,-2.502655e-03,-2.336546e-03,-2.166500e-03,-1.992854e-03,-1.815953e-03,-1.636143e-03,-1.453778e-03,
- -1.269214e-03,-1.082811e-03,-8.949310e-04,-7.059384e-04,-5.161950e-04,-3.260668e-04,-1.359196e-04, 5.388517e-05,
-  2.429854e-04, 4.310233e-04, 6.176413e-04, 8.024897e-04, 9.852200e-04, 1.165490e-03, 1.342962e-03, 1.517310e-03,
-  1.688208e-03, 1.855342e-03, 2.018404e-03, 2.177096e-03, 2.331130e-03, 2.480226e-03, 2.624115e-03, 2.762540e-03,
-  2.895254e-03, 3.022023e-03, 3.142623e-03, 3.256843e-03, 3.364487e-03, 3.465372e-03, 3.559325e-03, 3.646191e-03,
-  3.725826e-03, 3.798102e-03, 3.862906e-03, 3.920136e-03, 3.969710e-03, 4.011556e-03, 4.045622e-03, 4.071866e-03,
-  4.090268e-03, 4.100815e-03, 4.103514e-03, 4.098385e-03, 4.085464e-03, 4.064802e-03, 4.036464e-03, 4.000529e-03,
-  3.957092e-03, 3.906259e-03, 3.848154e-03, 3.782911e-03, 3.710680e-03, 3.631621e-03, 3.545907e-03, 3.453726e-03,
-  3.355275e-03, 3.250764e-03, 3.140412e-03, 3.024450e-03, 2.903120e-03, 2.776670e-03, 2.645360e-03, 2.509457e-03,
-  2.369237e-03, 2.224984e-03, 2.076986e-03, 1.925540e-03, 1.770946e-03, 1.613511e-03, 1.453547e-03, 1.291368e-03,
-  1.127292e-03, 9.616396e-04, 7.947324e-04, 6.268949e-04, 4.584516e-04, 2.897283e-04, 1.210485e-04,-4.726559e-05,
- -2.148923e-04,-3.815133e-04,-5.468131e-04,-7.104784e-04,-8.722021e-04,-1.031681e-03,-1.188615e-03,-1.342716e-03,
- -1.493696e-03,-1.641275e-03,-1.785183e-03,-1.925158e-03,-2.060943e-03,-2.192292e-03,-2.318970e-03,-2.440749e-03,
- -2.557412e-03,-2.668752e-03,-2.774576e-03,-2.874698e-03,-2.968947e-03,-3.057161e-03,-3.139191e-03,-3.214901e-03,
- -3.284168e-03,-3.346881e-03,-3.402942e-03,-3.452266e-03,-3.494782e-03,-3.530431e-03,-3.559169e-03,-3.580964e-03,
- -3.595798e-03,-3.603666e-03,-3.604576e-03,-3.598551e-03,-3.585627e-03,-3.565851e-03,-3.539287e-03,-3.506006e-03,
- -3.466095e-03,-3.419655e-03,-3.366799e-03,-3.307648e-03,-3.242337e-03,-3.171014e-03,-3.093835e-03,-3.010970e-03,
- -2.922597e-03,-2.828904e-03,-2.730090e-03,-2.626362e-03,-2.517936e-03,-2.405036e-03,-2.287896e-03,-2.166755e-03,
- -2.041858e-03,-1.913457e-03,-1.781813e-03,-1.647190e-03,-1.509854e-03,-1.370082e-03,-1.228150e-03,-1.084335e-03,
- -9.389229e-04,-7.921979e-04,-6.444455e-04,-4.959532e-04,-3.470099e-04,-1.979033e-04,-4.891873e-05, 9.965677e-05,
-  2.475381e-04, 3.944457e-04, 5.400996e-04, 6.842248e-04, 8.265486e-04, 9.668045e-04, 1.104730e-03, 1.240068e-03,
-  1.372567e-03, 1.501984e-03, 1.628079e-03, 1.750623e-03, 1.869392e-03, 1.984170e-03, 2.094751e-03, 2.200938e-03,
-  2.302543e-03, 2.399384e-03, 2.491292e-03, 2.578108e-03, 2.659685e-03, 2.735881e-03, 2.806572e-03, 2.871639e-03,
-  2.930976e-03, 2.984491e-03, 3.032102e-03, 3.073736e-03, 3.109336e-03, 3.138853e-03, 3.162253e-03, 3.179511e-03,
-  3.190618e-03, 3.195573e-03, 3.194390e-03, 3.187090e-03, 3.173709e-03, 3.154296e-03, 3.128908e-03, 3.097617e-03,
-  3.060501e-03, 3.017654e-03, 2.969179e-03, 2.915189e-03, 2.855807e-03, 2.791168e-03, 2.721415e-03, 2.646699e-03,
-  2.567182e-03, 2.483032e-03, 2.394430e-03, 2.301562e-03, 2.204622e-03, 2.103811e-03, 1.999336e-03, 1.891412e-03,
-  1.780260e-03, 1.666104e-03, 1.549175e-03, 1.429709e-03, 1.307943e-03, 1.184120e-03, 1.058488e-03, 9.312945e-04,
-  8.027889e-04, 6.732242e-04, 5.428532e-04, 4.119306e-04, 2.807108e-04, 1.494467e-04, 1.839175e-05,-1.122033e-04,
- -2.420871e-04,-3.710135e-04,-4.987371e-04,-6.250159e-04,-7.496117e-04,-8.722909e-04,-9.928239e-04,-1.110987e-03,
- -1.226560e-03,-1.339330e-03,-1.449090e-03,-1.555640e-03,-1.658785e-03,-1.758339e-03,-1.854124e-03,-1.945969e-03,
- -2.033710e-03,-2.117194e-03,-2.196276e-03,-2.270818e-03,-2.340694e-03,-2.405787e-03,-2.465987e-03,-2.521197e-03,
- -2.571330e-03,-2.616305e-03,-2.656056e-03,-2.690526e-03,-2.719667e-03,-2.743442e-03,-2.761826e-03,-2.774801e-03,
- -2.782364e-03,-2.784520e-03,-2.781284e-03,-2.772683e-03,-2.758752e-03,-2.739538e-03,-2.715099e-03,-2.685500e-03,
- -2.650818e-03,-2.611136e-03,-2.566551e-03,-2.517168e-03,-2.463099e-03,-2.404465e-03,-2.341397e-03,-2.274032e-03,
- -2.202518e-03,-2.127006e-03,-2.047659e-03,-1.964644e-03,-1.878134e-03,-1.788308e-03,-1.695353e-03,-1.599460e-03,
- -1.500824e-03,-1.399647e-03,-1.296133e-03,-1.190489e-03,-1.082930e-03,-9.736690e-04,-8.629227e-04,-7.509113e-04,
- -6.378566e-04,-5.239800e-04,-4.095043e-04,-2.946542e-04,-1.796516e-04,-6.471955e-05, 4.992016e-05, 1.640468e-04,
-  2.774426e-04, 3.898903e-04, 5.011770e-04, 6.110922e-04, 7.194270e-04, 8.259797e-04, 9.305521e-04, 1.032949e-03,
-  1.132979e-03, 1.230459e-03, 1.325210e-03, 1.417058e-03, 1.505840e-03, 1.591393e-03, 1.673563e-03, 1.752204e-03,
-  1.827180e-03, 1.898357e-03, 1.965614e-03, 2.028836e-03, 2.087914e-03, 2.142750e-03, 2.193254e-03, 2.239345e-03,
-  2.280951e-03, 2.318009e-03, 2.350464e-03, 2.378271e-03, 2.401391e-03, 2.419801e-03, 2.433482e-03, 2.442425e-03,
-  2.446631e-03, 2.446109e-03, 2.440878e-03, 2.430968e-03, 2.416415e-03, 2.397263e-03, 2.373570e-03, 2.345397e-03,
-  2.312816e-03, 2.275905e-03, 2.234755e-03, 2.189460e-03, 2.140124e-03, 2.086858e-03, 2.029779e-03, 1.969013e-03,
-  1.904691e-03, 1.836951e-03, 1.765939e-03, 1.691802e-03, 1.614698e-03, 1.534788e-03, 1.452234e-03, 1.367208e-03,
-  1.279884e-03, 1.190440e-03, 1.099057e-03, 1.005920e-03, 9.112147e-04, 8.151309e-04, 7.178604e-04, 6.195953e-04,
-  5.205294e-04, 4.208586e-04, 3.207772e-04, 2.204815e-04, 1.201660e-04, 2.002514e-05,-7.974774e-05,-1.789611e-04,
- -2.774249e-04,-3.749523e-04,-4.713577e-04,-5.664587e-04,-6.600762e-04,-7.520345e-04,-8.421624e-04,-9.302923e-04,
- -1.016261e-03,-1.099911e-03,-1.181089e-03,-1.259648e-03,-1.335445e-03,-1.408345e-03,-1.478218e-03,-1.544940e-03,
- -1.608396e-03,-1.668475e-03,-1.725073e-03,-1.778093e-03,-1.827448e-03,-1.873055e-03,-1.914844e-03,-1.952747e-03,
- -1.986705e-03,-2.016669e-03,-2.042595e-03,-2.064451e-03,-2.082210e-03,-2.095852e-03,-2.105369e-03,-2.110759e-03,
- -2.112027e-03,-2.109186e-03,-2.102260e-03,-2.091277e-03,-2.076276e-03,-2.057300e-03,-2.034404e-03,-2.007645e-03,
- -1.977091e-03,-1.942817e-03,-1.904905e-03,-1.863441e-03,-1.818522e-03,-1.770248e-03,-1.718726e-03,-1.664067e-03,
- -1.606393e-03,-1.545825e-03,-1.482494e-03,-1.416533e-03,-1.348081e-03,-1.277281e-03,-1.204278e-03,-1.129224e-03,
- -1.052273e-03,-9.735802e-04,-8.933066e-04,-8.116156e-04,-7.286699e-04,-6.446361e-04,-5.596813e-04,-4.739730e-04,
- -3.876832e-04,-3.009789e-04,-2.140324e-04,-1.270122e-04,-4.008827e-05, 4.657291e-05, 1.328024e-04, 2.184352e-04,
-  3.033073e-04, 3.872560e-04, 4.701234e-04, 5.517525e-04, 6.319901e-04, 7.106842e-04, 7.876916e-04, 8.628676e-04,
-  9.360725e-04, 1.007173e-03, 1.076041e-03, 1.142551e-03, 1.206583e-03, 1.268024e-03, 1.326762e-03, 1.382697e-03,
-  1.435730e-03, 1.485771e-03, 1.532734e-03, 1.576540e-03, 1.617120e-03, 1.654405e-03, 1.688336e-03, 1.718862e-03,
-  1.745938e-03, 1.769524e-03, 1.789590e-03, 1.806110e-03, 1.819066e-03, 1.828450e-03, 1.834257e-03, 1.836490e-03,
-  1.835159e-03, 1.830282e-03, 1.821883e-03, 1.809992e-03, 1.794648e-03, 1.775893e-03, 1.753779e-03, 1.728363e-03,
-  1.699705e-03, 1.667878e-03, 1.632956e-03, 1.595018e-03, 1.554151e-03, 1.510446e-03, 1.464001e-03, 1.414918e-03,
-  1.363303e-03, 1.309265e-03, 1.252920e-03, 1.194388e-03, 1.133791e-03, 1.071256e-03, 1.006914e-03, 9.408943e-04,
-  8.733342e-04, 8.043715e-04, 7.341457e-04, 6.627990e-04, 5.904748e-04, 5.173172e-04, 4.434723e-04, 3.690861e-04,
-  2.943067e-04, 2.192808e-04, 1.441549e-04, 6.907601e-05,-5.810406e-06,-8.036008e-05,-1.544274e-04,-2.278724e-04,
- -3.005536e-04,-3.723331e-04,-4.430746e-04,-5.126460e-04,-5.809160e-04,-6.477582e-04,-7.130477e-04,-7.766630e-04,
- -8.384899e-04,-8.984139e-04,-9.563265e-04,-1.012124e-03,-1.065706e-03,-1.116978e-03,-1.165851e-03,-1.212239e-03,
- -1.256063e-03,-1.297248e-03,-1.335723e-03,-1.371428e-03,-1.404305e-03,-1.434300e-03,-1.461368e-03,-1.485469e-03,
- -1.506569e-03,-1.524639e-03,-1.539656e-03,-1.551604e-03,-1.560475e-03,-1.566264e-03,-1.568970e-03,-1.568606e-03,
- -1.565182e-03,-1.558719e-03,-1.549243e-03,-1.536785e-03,-1.521382e-03,-1.503076e-03,-1.481916e-03,-1.457956e-03,
- -1.431255e-03,-1.401877e-03,-1.369889e-03,-1.335366e-03,-1.298385e-03,-1.259030e-03,-1.217388e-03,-1.173547e-03,
- -1.127606e-03,-1.079663e-03,-1.029820e-03,-9.781791e-04,-9.248534e-04,-8.699528e-04,-8.135899e-04,-7.558808e-04,
- -6.969438e-04,-6.369008e-04,-5.758738e-04,-5.139835e-04,-4.513566e-04,-3.881182e-04,-3.243947e-04,-2.603112e-04,
- -1.959949e-04,-1.315736e-04,-6.717191e-05,-2.914518e-06, 6.107318e-05, 1.246657e-04, 1.877423e-04, 2.501819e-04,
-  3.118645e-04, 3.726753e-04, 4.324984e-04, 4.912200e-04, 5.487328e-04, 6.049288e-04, 6.597034e-04, 7.129566e-04,
-  7.645906e-04, 8.145114e-04, 8.626298e-04, 9.088617e-04, 9.531232e-04, 9.953366e-04, 1.035427e-03, 1.073328e-03,
-  1.108974e-03, 1.142306e-03, 1.173268e-03, 1.201811e-03, 1.227891e-03, 1.251464e-03, 1.272498e-03, 1.290964e-03,
-  1.306836e-03, 1.320096e-03, 1.330728e-03, 1.338723e-03, 1.344077e-03, 1.346793e-03, 1.346875e-03, 1.344335e-03,
-  1.339190e-03, 1.331462e-03, 1.321176e-03, 1.308366e-03, 1.293066e-03, 1.275319e-03, 1.255170e-03, 1.232669e-03,
-  1.207870e-03, 1.180832e-03, 1.151617e-03, 1.120291e-03, 1.086927e-03, 1.051599e-03, 1.014383e-03, 9.753634e-04,
-  9.346213e-04, 8.922445e-04, 8.483251e-04, 8.029537e-04, 7.562269e-04, 7.082416e-04, 6.590967e-04, 6.088938e-04,
-  5.577356e-04, 5.057275e-04, 4.529732e-04, 3.995805e-04, 3.456559e-04, 2.913075e-04, 2.366437e-04, 1.817731e-04,
-  1.268027e-04, 7.184106e-05, 1.699629e-05,-3.762670e-05,-9.192186e-05,-1.457825e-04,-1.991072e-04,-2.517941e-04,
- -3.037426e-04,-3.548542e-04,-4.050344e-04,-4.541883e-04,-5.022236e-04,-5.490514e-04,-5.945871e-04,-6.387472e-04,
- -6.814519e-04,-7.226231e-04,-7.621876e-04,-8.000763e-04,-8.362222e-04,-8.705632e-04,-9.030404e-04,-9.335984e-04,
- -9.621868e-04,-9.887573e-04,-1.013268e-03,-1.035681e-03,-1.055962e-03,-1.074081e-03,-1.090012e-03,-1.103735e-03,
- -1.115233e-03,-1.124495e-03,-1.131510e-03,-1.136276e-03,-1.138796e-03,-1.139075e-03,-1.137122e-03,-1.132950e-03,
- -1.126580e-03,-1.118033e-03,-1.107338e-03,-1.094524e-03,-1.079625e-03,-1.062682e-03,-1.043737e-03,-1.022837e-03,
- -1.000032e-03,-9.753749e-04,-9.489233e-04,-9.207365e-04,-8.908795e-04,-8.594169e-04,-8.264184e-04,-7.919555e-04,
- -7.561035e-04,-7.189393e-04,-6.805416e-04,-6.409910e-04,-6.003705e-04,-5.587654e-04,-5.162607e-04,-4.729459e-04,
- -4.289087e-04,-3.842386e-04,-3.390254e-04,-2.933611e-04,-2.473380e-04,-2.010460e-04,-1.545786e-04,-1.080285e-04,
- -6.148689e-05,-1.504507e-05, 3.120662e-05, 7.717996e-05, 1.227843e-04, 1.679321e-04, 2.125370e-04, 2.565146e-04,
-  2.997806e-04, 3.422551e-04, 3.838581e-04, 4.245105e-04, 4.641383e-04, 5.026682e-04, 5.400311e-04, 5.761579e-04,
-  6.109851e-04, 6.444487e-04, 6.764902e-04, 7.070545e-04, 7.360878e-04, 7.635395e-04, 7.893640e-04, 8.135197e-04,
-  8.359675e-04, 8.566700e-04, 8.755960e-04, 8.927149e-04, 9.080024e-04, 9.214381e-04, 9.330033e-04, 9.426857e-04,
-  9.504751e-04, 9.563651e-04, 9.603528e-04, 9.624400e-04, 9.626323e-04, 9.609371e-04, 9.573680e-04, 9.519402e-04,
-  9.446741e-04, 9.355922e-04, 9.247214e-04, 9.120914e-04, 8.977352e-04, 8.816905e-04, 8.639957e-04, 8.446941e-04,
-  8.238309e-04, 8.014557e-04, 7.776190e-04, 7.523748e-04, 7.257788e-04, 6.978914e-04, 6.687725e-04, 6.384865e-04,
-  6.070971e-04, 5.746711e-04, 5.412774e-04, 5.069879e-04, 4.718733e-04, 4.360060e-04, 3.994609e-04, 3.623126e-04,
-  3.246379e-04, 2.865127e-04, 2.480134e-04, 2.092187e-04, 1.702052e-04, 1.310513e-04, 9.183494e-05, 5.263326e-05,
-  1.352252e-05,-2.542086e-05,-6.412093e-05,-1.025033e-04,-1.404939e-04,-1.780196e-04,-2.150074e-04,-2.513897e-04,
- -2.870979e-04,-3.220637e-04,-3.562235e-04,-3.895132e-04,-4.218725e-04,-4.532416e-04,-4.835643e-04,-5.127863e-04,
- -5.408553e-04,-5.677223e-04,-5.933401e-04,-6.176653e-04,-6.406560e-04,-6.622736e-04,-6.824823e-04,-7.012505e-04,
- -7.185469e-04,-7.343461e-04,-7.486234e-04,-7.613583e-04,-7.725353e-04,-7.821396e-04,-7.901601e-04,-7.965874e-04,
- -8.014183e-04,-8.046516e-04,-8.062896e-04,-8.063351e-04,-8.047981e-04,-8.016884e-04,-7.970203e-04,-7.908111e-04,
- -7.830808e-04,-7.738535e-04,-7.631531e-04,-7.510094e-04,-7.374518e-04,-7.225163e-04,-7.062385e-04,-6.886568e-04,
- -6.698125e-04,-6.497497e-04,-6.285150e-04,-6.061555e-04,-5.827199e-04,-5.582596e-04,-5.328293e-04,-5.064844e-04,
- -4.792802e-04,-4.512762e-04,-4.225304e-04,-3.931029e-04,-3.630557e-04,-3.324519e-04,-3.013536e-04,-2.698259e-04,
- -2.379323e-04,-2.057383e-04,-1.733085e-04,-1.407070e-04,-1.080003e-04,-7.525231e-05,-4.252954e-05,-9.895047e-06,
-  2.258785e-05, 5.485576e-05, 8.684579e-05, 1.184966e-04, 1.497470e-04, 1.805376e-04, 2.108096e-04, 2.405069e-04,
-  2.695729e-04, 2.979553e-04, 3.256008e-04, 3.524594e-04, 3.784811e-04, 4.036184e-04, 4.278273e-04, 4.510650e-04,
-  4.732894e-04, 4.944630e-04, 5.145513e-04, 5.335168e-04, 5.513303e-04, 5.679624e-04, 5.833861e-04, 5.975778e-04,
-  6.105156e-04, 6.221805e-04, 6.325573e-04, 6.416310e-04, 6.493917e-04, 6.558281e-04, 6.609373e-04, 6.647158e-04,
-  6.671627e-04, 6.682805e-04, 6.680736e-04, 6.665495e-04, 6.637187e-04, 6.595929e-04, 6.541888e-04, 6.475219e-04,
-  6.396122e-04, 6.304835e-04, 6.201599e-04, 6.086667e-04, 5.960337e-04, 5.822930e-04, 5.674771e-04, 5.516196e-04,
-  5.347586e-04, 5.169333e-04, 4.981830e-04, 4.785498e-04, 4.580787e-04, 4.368141e-04, 4.148006e-04, 3.920874e-04,
-  3.687230e-04, 3.447554e-04, 3.202377e-04, 2.952208e-04, 2.697556e-04, 2.438961e-04, 2.176949e-04, 1.912067e-04,
-  1.644845e-04, 1.375820e-04, 1.105546e-04, 8.345546e-05, 5.633888e-05, 2.925946e-05, 2.269935e-06,-2.457738e-05,
- -5.122955e-05,-7.763439e-05,-1.037407e-04,-1.294995e-04,-1.548603e-04,-1.797757e-04,-2.041991e-04,-2.280854e-04,
- -2.513896e-04,-2.740682e-04,-2.960800e-04,-3.173853e-04,-3.379460e-04,-3.577239e-04,-3.766858e-04,-3.947981e-04,
- -4.120295e-04,-4.283489e-04,-4.437310e-04,-4.581504e-04,-4.715830e-04,-4.840076e-04,-4.954046e-04,-5.057581e-04,
- -5.150533e-04,-5.232769e-04,-5.304185e-04,-5.364701e-04,-5.414254e-04,-5.452818e-04,-5.480369e-04,-5.496905e-04,
- -5.502454e-04,-5.497077e-04,-5.480841e-04,-5.453834e-04,-5.416186e-04,-5.368009e-04,-5.309449e-04,-5.240695e-04,
- -5.161943e-04,-5.073408e-04,-4.975296e-04,-4.867883e-04,-4.751417e-04,-4.626184e-04,-4.492483e-04,-4.350621e-04,
- -4.200931e-04,-4.043739e-04,-3.879420e-04,-3.708328e-04,-3.530842e-04,-3.347355e-04,-3.158261e-04,-2.963967e-04,
- -2.764876e-04,-2.561429e-04,-2.354039e-04,-2.143138e-04,-1.929181e-04,-1.712620e-04,-1.493875e-04,-1.273406e-04,
- -1.051647e-04,-8.290645e-05,-6.060974e-05,-3.831826e-05,-1.607801e-05, 6.068459e-06, 2.807835e-05, 4.990834e-05,
-  7.151386e-05, 9.285366e-05, 1.138895e-04, 1.345790e-04, 1.548832e-04, 1.747639e-04, 1.941851e-04, 2.131086e-04,
-  2.315009e-04, 2.493271e-04, 2.665564e-04, 2.831587e-04, 2.991028e-04, 3.143616e-04, 3.289087e-04, 3.427171e-04,
-  3.557649e-04, 3.680301e-04, 3.794933e-04, 3.901370e-04, 3.999420e-04, 4.088955e-04, 4.169836e-04, 4.241970e-04,
-  4.305246e-04, 4.359586e-04, 4.404953e-04, 4.441292e-04, 4.468575e-04, 4.486805e-04, 4.495990e-04, 4.496171e-04,
-  4.487402e-04, 4.469755e-04, 4.443294e-04, 4.408133e-04, 4.364408e-04, 4.312237e-04, 4.251773e-04, 4.183183e-04,
-  4.106664e-04, 4.022404e-04, 3.930616e-04, 3.831530e-04, 3.725371e-04, 3.612410e-04, 3.492900e-04, 3.367114e-04,
-  3.235339e-04, 3.097882e-04, 2.955041e-04, 2.807130e-04, 2.654479e-04, 2.497428e-04, 2.336298e-04, 2.171439e-04,
-  2.003212e-04, 1.831961e-04, 1.658044e-04, 1.481829e-04, 1.303691e-04, 1.123974e-04, 9.430516e-05, 7.613070e-05,
-  5.790937e-05, 3.967778e-05, 2.147331e-05, 3.332532e-06,-1.470983e-05,-3.261773e-05,-5.035687e-05,-6.789274e-05,
- -8.519112e-05,-1.022184e-04,-1.189421e-04,-1.353320e-04,-1.513567e-04,-1.669856e-04,-1.821896e-04,-1.969419e-04,
- -2.112154e-04,-2.249837e-04,-2.382229e-04,-2.509088e-04,-2.630188e-04,-2.745329e-04,-2.854317e-04,-2.956972e-04,
- -3.053124e-04,-3.142617e-04,-3.225315e-04,-3.301072e-04,-3.369795e-04,-3.431379e-04,-3.485755e-04,-3.532855e-04,
- -3.572614e-04,-3.605010e-04,-3.630019e-04,-3.647619e-04,-3.657836e-04,-3.660685e-04,-3.656205e-04,-3.644442e-04,
- -3.625471e-04,-3.599368e-04,-3.566219e-04,-3.526150e-04,-3.479258e-04,-3.425687e-04,-3.365597e-04,-3.299129e-04,
- -3.226463e-04,-3.147764e-04,-3.063250e-04,-2.973116e-04,-2.877575e-04,-2.776831e-04,-2.671145e-04,-2.560753e-04,
- -2.445885e-04,-2.326804e-04,-2.203781e-04,-2.077098e-04,-1.946994e-04,-1.813786e-04,-1.677749e-04,-1.539161e-04,
- -1.398316e-04,-1.255536e-04,-1.111090e-04,-9.652886e-05,-8.184123e-05,-6.707707e-05,-5.226882e-05,-3.744446e-05,
- -2.263391e-05,-7.867037e-06, 6.826844e-06, 2.141945e-05, 3.588126e-05, 5.018448e-05, 6.430113e-05, 7.820368e-05,
-  9.186620e-05, 1.052626e-04, 1.183671e-04, 1.311558e-04, 1.436042e-04, 1.556892e-04, 1.673899e-04, 1.786844e-04,
-  1.895526e-04, 1.999756e-04, 2.099341e-04, 2.194126e-04, 2.283931e-04, 2.368614e-04, 2.448041e-04, 2.522070e-04,
-  2.590592e-04, 2.653498e-04, 2.710701e-04, 2.762127e-04, 2.807702e-04, 2.847360e-04, 2.881065e-04, 2.908784e-04,
-  2.930500e-04, 2.946197e-04, 2.955882e-04, 2.959578e-04, 2.957320e-04, 2.949130e-04, 2.935063e-04, 2.915196e-04,
-  2.889601e-04, 2.858352e-04, 2.821558e-04, 2.779310e-04, 2.731734e-04, 2.678969e-04, 2.621151e-04, 2.558424e-04,
-  2.490924e-04, 2.418830e-04, 2.342330e-04, 2.261586e-04, 2.176789e-04, 2.088133e-04, 1.995819e-04, 1.900062e-04,
-  1.801075e-04, 1.699067e-04, 1.594270e-04, 1.486902e-04, 1.377203e-04, 1.265400e-04, 1.151736e-04, 1.036454e-04,
-  9.197915e-05, 8.019898e-05, 6.833016e-05, 5.639568e-05, 4.442145e-05, 3.243159e-05, 2.045008e-05, 8.500077e-06,
- -3.394396e-06,-1.520792e-05,-2.691844e-05,-3.850333e-05,-4.993971e-05,-6.120604e-05,-7.228010e-05,-8.314073e-05,
- -9.376773e-05,-1.041414e-04,-1.142415e-04,-1.240496e-04,-1.335477e-04,-1.427192e-04,-1.515458e-04,-1.600143e-04,
- -1.681089e-04,-1.758149e-04,-1.831192e-04,-1.900109e-04,-1.964770e-04,-2.025081e-04,-2.080942e-04,-2.132267e-04,
- -2.178999e-04,-2.221055e-04,-2.258386e-04,-2.290942e-04,-2.318678e-04,-2.341581e-04,-2.359618e-04,-2.372797e-04,
- -2.381121e-04,-2.384591e-04,-2.383247e-04,-2.377121e-04,-2.366240e-04,-2.350661e-04,-2.330445e-04,-2.305668e-04,
- -2.276403e-04,-2.242728e-04,-2.204748e-04,-2.162581e-04,-2.116312e-04,-2.066069e-04,-2.011977e-04,-1.954189e-04,
- -1.892811e-04,-1.828010e-04,-1.759935e-04,-1.688733e-04,-1.614564e-04,-1.537610e-04,-1.458043e-04,-1.376046e-04,
- -1.291790e-04,-1.205461e-04,-1.117247e-04,-1.027337e-04,-9.359297e-05,-8.432022e-05,-7.493745e-05,-6.546239e-05,
- -5.591359e-05,-4.631397e-05,-3.668063e-05,-2.703437e-05,-1.739525e-05,-7.781717e-06, 1.787076e-06, 1.129152e-05,
-  2.071362e-05, 3.003250e-05, 3.923234e-05, 4.829366e-05, 5.720105e-05, 6.593598e-05, 7.448230e-05, 8.282478e-05,
-  9.094699e-05, 9.883359e-05, 1.064691e-04, 1.138417e-04, 1.209368e-04, 1.277422e-04, 1.342481e-04, 1.404416e-04,
-  1.463115e-04, 1.518476e-04, 1.570417e-04, 1.618843e-04, 1.663702e-04, 1.704895e-04, 1.742386e-04, 1.776117e-04,
-  1.806036e-04, 1.832113e-04, 1.854323e-04, 1.872639e-04, 1.887057e-04, 1.897562e-04, 1.904159e-04, 1.906866e-04,
-  1.905696e-04, 1.900679e-04, 1.891852e-04, 1.879248e-04, 1.862927e-04, 1.842950e-04, 1.819366e-04, 1.792250e-04,
-  1.761685e-04, 1.727739e-04, 1.690524e-04, 1.650127e-04, 1.606642e-04, 1.560185e-04, 1.510858e-04, 1.458795e-04,
-  1.404107e-04, 1.346940e-04, 1.287414e-04, 1.225661e-04, 1.161817e-04, 1.096036e-04, 1.028451e-04, 9.592165e-05,
-  8.884948e-05, 8.164257e-05, 7.431610e-05, 6.688594e-05, 5.936817e-05, 5.177946e-05, 4.413506e-05, 3.644947e-05,
-  2.873943e-05, 2.102099e-05, 1.331029e-05, 5.621514e-06,-2.029358e-06,-9.626420e-06,-1.715456e-05,-2.460028e-05,
- -3.194772e-05,-3.918222e-05,-4.629039e-05,-5.325952e-05,-6.007517e-05,-6.672542e-05,-7.319819e-05,-7.948109e-05,
- -8.556165e-05,-9.142989e-05,-9.707500e-05,-1.024859e-04,-1.076548e-04,-1.125716e-04,-1.172282e-04,-1.216175e-04,
- -1.257317e-04,-1.295636e-04,-1.331078e-04,-1.363605e-04,-1.393151e-04,-1.419685e-04,-1.443165e-04,-1.463564e-04,
- -1.480859e-04,-1.495047e-04,-1.506106e-04,-1.514045e-04,-1.518864e-04,-1.520567e-04,-1.519170e-04,-1.514695e-04,
- -1.507195e-04,-1.496698e-04,-1.483218e-04,-1.466826e-04,-1.447560e-04,-1.425483e-04,-1.400666e-04,-1.373167e-04,
- -1.343062e-04,-1.310429e-04,-1.275360e-04,-1.237931e-04,-1.198235e-04,-1.156373e-04,-1.112446e-04,-1.066540e-04,
- -1.018781e-04,-9.692669e-05,-9.181281e-05,-8.654693e-05,-8.113915e-05,-7.560223e-05,-6.994825e-05,-6.419092e-05,
- -5.834054e-05,-5.241151e-05,-4.641517e-05,-4.036469e-05,-3.427315e-05,-2.815312e-05,-2.201607e-05,-1.587522e-05,
- -9.743131e-06,-3.631270e-06, 2.447137e-06, 8.479532e-06, 1.445439e-05, 2.035893e-05, 2.618262e-05, 3.191540e-05,
-  3.754431e-05, 4.305886e-05, 4.844880e-05, 5.370276e-05, 5.881380e-05, 6.376969e-05, 6.856296e-05, 7.318406e-05,
-  7.762462e-05, 8.187838e-05, 8.593672e-05, 8.979330e-05, 9.343993e-05, 9.687232e-05, 1.000837e-04, 1.030701e-04,
-  1.058262e-04, 1.083484e-04, 1.106330e-04, 1.126768e-04, 1.144774e-04, 1.160319e-04, 1.173401e-04, 1.184005e-04,
-  1.192127e-04, 1.197755e-04, 1.200908e-04, 1.201584e-04, 1.199802e-04, 1.195594e-04, 1.188980e-04, 1.179983e-04,
-  1.168645e-04, 1.154995e-04, 1.139091e-04, 1.120965e-04, 1.100676e-04, 1.078278e-04, 1.053828e-04, 1.027387e-04,
-  9.990359e-05, 9.688367e-05, 9.368737e-05, 9.032007e-05, 8.679148e-05, 8.311046e-05, 7.928451e-05, 7.532233e-05,
-  7.123300e-05, 6.702553e-05, 6.271090e-05, 5.829804e-05, 5.379543e-05, 4.921294e-05, 4.456140e-05, 3.985045e-05,
-  3.509100e-05, 3.029220e-05, 2.546331e-05, 2.061435e-05, 1.575696e-05, 1.090047e-05, 6.055274e-06, 1.230858e-06,
- -3.564611e-06,-8.320173e-06,-1.302606e-05,-1.767244e-05,-2.225246e-05,-2.675495e-05,-3.117281e-05,-3.549648e-05,
- -3.971901e-05,-4.383134e-05,-4.782586e-05,-5.169482e-05,-5.543235e-05,-5.903138e-05,-6.248567e-05,-6.578780e-05,
- -6.893368e-05,-7.191702e-05,-7.473330e-05,-7.737784e-05,-7.984619e-05,-8.213470e-05,-8.423958e-05,-8.615758e-05,
- -8.788673e-05,-8.942437e-05,-9.076868e-05,-9.191803e-05,-9.287151e-05,-9.362839e-05,-9.418901e-05,-9.455384e-05,
- -9.472251e-05,-9.469683e-05,-9.447788e-05,-9.406759e-05,-9.346778e-05,-9.268073e-05,-9.171036e-05,-9.055986e-05,
- -8.923193e-05,-8.773144e-05,-8.606087e-05,-8.422612e-05,-8.223229e-05,-8.008336e-05,-7.778558e-05,-7.534557e-05,
- -7.276766e-05,-7.005965e-05,-6.722799e-05,-6.427753e-05,-6.121707e-05,-5.805237e-05,-5.479100e-05,-5.144042e-05,
- -4.800808e-05,-4.450138e-05,-4.092825e-05,-3.729776e-05,-3.361663e-05,-2.989183e-05,-2.613295e-05,-2.234559e-05,
- -1.854116e-05,-1.472398e-05,-1.090390e-05,-7.089251e-06,-3.286321e-06, 4.962730e-07, 4.252298e-06, 7.972603e-06,
-  1.164987e-05, 1.527660e-05, 1.884583e-05, 2.235161e-05, 2.578690e-05, 2.914523e-05, 3.241841e-05, 3.560215e-05,
-  3.868965e-05, 4.167707e-05, 4.455816e-05, 4.732625e-05, 4.997734e-05, 5.250672e-05, 5.491137e-05, 5.718476e-05,
-  5.932501e-05, 6.132826e-05, 6.319067e-05, 6.490950e-05, 6.648410e-05, 6.791089e-05, 6.918816e-05, 7.031399e-05,
-  7.128700e-05, 7.210684e-05, 7.277194e-05, 7.328240e-05, 7.363874e-05, 7.384199e-05, 7.389089e-05, 7.378761e-05,
-  7.353353e-05, 7.312913e-05, 7.257748e-05, 7.188086e-05, 7.104073e-05, 7.006084e-05, 6.894360e-05, 6.769173e-05,
-  6.631042e-05, 6.480251e-05, 6.317145e-05, 6.142116e-05, 5.955828e-05, 5.758600e-05, 5.550934e-05, 5.333180e-05,
-  5.105991e-05, 4.869950e-05, 4.625645e-05, 4.373466e-05, 4.114034e-05, 3.848064e-05, 3.576102e-05, 3.298701e-05,
-  3.016469e-05, 2.730120e-05, 2.440197e-05, 2.147282e-05, 1.852034e-05, 1.555080e-05, 1.257019e-05, 9.585678e-06,
-  6.602654e-06, 3.627244e-06, 6.660416e-07,-2.276316e-06,-5.191997e-06,-8.076426e-06,-1.092371e-05,-1.372741e-05,
- -1.648254e-05,-1.918482e-05,-2.182769e-05,-2.440609e-05,-2.691625e-05,-2.935317e-05,-3.171162e-05,-3.398810e-05,
- -3.617808e-05,-3.827622e-05,-4.028107e-05,-4.218845e-05,-4.399571e-05,-4.569809e-05,-4.729484e-05,-4.878359e-05,
- -5.016035e-05,-5.142256e-05,-5.257089e-05,-5.360269e-05,-5.451554e-05,-5.531029e-05,-5.598389e-05,-5.653768e-05,
- -5.697187e-05,-5.728510e-05,-5.747796e-05,-5.755036e-05,-5.750441e-05,-5.733957e-05,-5.705794e-05,-5.666087e-05,
- -5.614912e-05,-5.552631e-05,-5.479358e-05,-5.395226e-05,-5.300687e-05,-5.195847e-05,-5.081165e-05,-4.956682e-05,
- -4.822851e-05,-4.680147e-05,-4.528831e-05,-4.369340e-05,-4.201815e-05,-4.026970e-05,-3.845149e-05,-3.656720e-05,
- -3.462100e-05,-3.261869e-05,-3.056492e-05,-2.846212e-05,-2.631622e-05,-2.413237e-05,-2.191405e-05,-1.966596e-05,
- -1.739490e-05,-1.510476e-05,-1.280137e-05,-1.048929e-05,-8.171515e-06,-5.855041e-06,-3.543218e-06,-1.240789e-06,
-  1.045975e-06, 3.314168e-06, 5.557381e-06, 7.772659e-06, 9.954075e-06, 1.210034e-05, 1.420433e-05, 1.626254e-05,
-  1.827182e-05, 2.022901e-05, 2.212753e-05, 2.396604e-05, 2.574170e-05, 2.744952e-05, 2.908797e-05, 3.065473e-05,
-  3.214592e-05, 3.355822e-05, 3.488991e-05, 3.613913e-05, 3.730402e-05, 3.838272e-05, 3.937330e-05, 4.027439e-05,
-  4.108570e-05, 4.180512e-05, 4.243180e-05, 4.296644e-05, 4.340624e-05, 4.375305e-05, 4.400672e-05, 4.416727e-05,
-  4.423465e-05, 4.420912e-05, 4.409135e-05, 4.388227e-05, 4.358469e-05, 4.319830e-05, 4.272519e-05, 4.216528e-05,
-  4.152220e-05, 4.079765e-05, 3.999373e-05, 3.911310e-05, 3.815752e-05, 3.712904e-05, 3.603075e-05, 3.486650e-05,
-  3.363931e-05, 3.235055e-05, 3.100416e-05, 2.960365e-05, 2.815196e-05, 2.665266e-05, 2.510869e-05, 2.352381e-05,
-  2.190202e-05, 2.024758e-05, 1.856336e-05, 1.685317e-05, 1.512073e-05, 1.336973e-05, 1.160416e-05, 9.828330e-06,
-  8.044810e-06, 6.257095e-06, 4.470570e-06, 2.688582e-06, 9.140503e-07,-8.489413e-07,-2.596418e-06,-4.325780e-06,
- -6.031765e-06,-7.712367e-06,-9.365341e-06,-1.098516e-05,-1.257036e-05,-1.411671e-05,-1.562206e-05,-1.708302e-05,
- -1.849767e-05,-1.986285e-05,-2.117547e-05,-2.243431e-05,-2.363696e-05,-2.478189e-05,-2.586588e-05,-2.688772e-05,
- -2.784488e-05,-2.873688e-05,-2.956282e-05,-3.031955e-05,-3.100766e-05,-3.162722e-05,-3.217562e-05,-3.265199e-05,
- -3.305590e-05,-3.338791e-05,-3.364744e-05,-3.383534e-05,-3.395127e-05,-3.399491e-05,-3.396786e-05,-3.387051e-05,
- -3.370385e-05,-3.346718e-05,-3.316319e-05,-3.279096e-05,-3.235429e-05,-3.185389e-05,-3.128893e-05,-3.066368e-05,
- -2.998042e-05,-2.923818e-05,-2.844120e-05,-2.759222e-05,-2.669196e-05,-2.574343e-05,-2.474724e-05,-2.370747e-05,
- -2.262689e-05,-2.150609e-05,-2.034912e-05,-1.915922e-05,-1.793860e-05,-1.669064e-05,-1.541755e-05,-1.412270e-05,
- -1.280831e-05,-1.147775e-05,-1.013319e-05,-8.778584e-06,-7.416641e-06,-6.048489e-06,-4.679207e-06,-3.310820e-06,
- -1.947289e-06,-5.913241e-07, 7.558967e-07, 2.089829e-06, 3.409430e-06, 4.710102e-06, 5.991338e-06, 7.249572e-06,
-  8.483129e-06, 9.689715e-06, 1.086537e-05, 1.200727e-05, 1.311527e-05, 1.418742e-05, 1.522131e-05, 1.621406e-05,
-  1.716497e-05, 1.807091e-05, 1.893225e-05, 1.974802e-05, 2.051514e-05, 2.123346e-05, 2.190092e-05, 2.251609e-05,
-  2.307915e-05, 2.358969e-05, 2.404553e-05, 2.444633e-05, 2.479438e-05, 2.508629e-05, 2.532226e-05, 2.550284e-05,
-  2.562910e-05, 2.569932e-05, 2.571383e-05, 2.567391e-05, 2.558078e-05, 2.543399e-05, 2.523516e-05, 2.498434e-05,
-  2.468282e-05, 2.433175e-05, 2.393119e-05, 2.348431e-05, 2.299102e-05, 2.245255e-05, 2.187082e-05, 2.124769e-05,
-  2.058506e-05, 1.988454e-05, 1.914722e-05, 1.837497e-05, 1.757021e-05, 1.673558e-05, 1.587120e-05, 1.498127e-05,
-  1.406634e-05, 1.312832e-05, 1.217125e-05, 1.119599e-05, 1.020447e-05, 9.198765e-06, 8.181488e-06, 7.154911e-06,
-  6.122491e-06, 5.085661e-06, 4.046035e-06, 3.006525e-06, 1.968334e-06, 9.358164e-07,-9.130093e-08,-1.109361e-06,
- -2.116904e-06,-3.112634e-06,-4.093597e-06,-5.057189e-06,-6.001880e-06,-6.926326e-06,-7.828054e-06,-8.706052e-06,
- -9.558312e-06,-1.038377e-05,-1.118217e-05,-1.194929e-05,-1.268472e-05,-1.338811e-05,-1.405745e-05,-1.469082e-05,
- -1.528709e-05,-1.584643e-05,-1.636667e-05,-1.684887e-05,-1.729226e-05,-1.769421e-05,-1.805467e-05,-1.837478e-05,
- -1.865284e-05,-1.888900e-05,-1.908325e-05,-1.923558e-05,-1.934601e-05,-1.941453e-05,-1.944112e-05,-1.942600e-05,
- -1.936998e-05,-1.927293e-05,-1.913533e-05,-1.895876e-05,-1.874296e-05,-1.848896e-05,-1.819936e-05,-1.787280e-05,
- -1.751093e-05,-1.711406e-05,-1.668417e-05,-1.622323e-05,-1.573209e-05,-1.520996e-05,-1.466060e-05,-1.408524e-05,
- -1.348418e-05,-1.285942e-05,-1.221288e-05,-1.154588e-05,-1.085925e-05,-1.015607e-05,-9.436465e-06,-8.702952e-06,
- -7.958533e-06,-7.202783e-06,-6.437202e-06,-5.665904e-06,-4.887831e-06,-4.106682e-06,-3.324236e-06,-2.541874e-06,
- -1.759891e-06,-9.802343e-07,-2.053510e-07, 5.623462e-07, 1.323779e-06, 2.075199e-06, 2.815410e-06, 3.543584e-06,
-  4.256638e-06, 4.954360e-06, 5.635235e-06, 6.298915e-06, 6.943936e-06, 7.569521e-06, 8.172001e-06, 8.750615e-06,
-  9.306632e-06, 9.837869e-06, 1.034295e-05, 1.082151e-05, 1.127201e-05, 1.169461e-05, 1.208885e-05, 1.245315e-05,
-  1.278769e-05, 1.309201e-05, 1.336447e-05, 1.360575e-05, 1.381693e-05, 1.399631e-05, 1.414403e-05, 1.426008e-05,
-  1.434452e-05, 1.439676e-05, 1.441625e-05, 1.440572e-05, 1.436386e-05, 1.429208e-05, 1.418972e-05, 1.405759e-05,
-  1.389588e-05, 1.370529e-05, 1.348651e-05, 1.324163e-05, 1.296962e-05, 1.267098e-05, 1.234777e-05, 1.200138e-05,
-  1.163190e-05, 1.124032e-05, 1.082756e-05, 1.039477e-05, 9.943690e-06, 9.475168e-06, 8.990140e-06, 8.489459e-06,
-  7.974884e-06, 7.448653e-06, 6.909060e-06, 6.359924e-06, 5.802490e-06, 5.237104e-06, 4.665257e-06, 4.087512e-06,
-  3.506433e-06, 2.922792e-06, 2.337735e-06, 1.753244e-06, 1.170725e-06, 5.902067e-07, 1.322228e-08,-5.582904e-07,
- -1.124300e-06,-1.682193e-06,-2.232838e-06,-2.772996e-06,-3.302770e-06,-3.820629e-06,-4.324557e-06,-4.815375e-06,
- -5.291458e-06,-5.751109e-06,-6.195081e-06,-6.620613e-06,-7.029377e-06,-7.419732e-06,-7.789371e-06,-8.138813e-06,
- -8.468092e-06,-8.775033e-06,-9.060646e-06,-9.324649e-06,-9.566018e-06,-9.784036e-06,-9.978797e-06,-1.015003e-05,
- -1.029720e-05,-1.042116e-05,-1.052188e-05,-1.059884e-05,-1.065097e-05,-1.067969e-05,-1.068456e-05,-1.066726e-05,
- -1.062713e-05,-1.056308e-05,-1.047681e-05,-1.036814e-05,-1.023755e-05,-1.008660e-05,-9.915171e-06,-9.723196e-06,
- -9.511163e-06,-9.280587e-06,-9.031816e-06,-8.766415e-06,-8.484200e-06,-8.185651e-06,-7.872285e-06,-7.544449e-06,
- -7.203709e-06,-6.849828e-06,-6.483770e-06,-6.108721e-06,-5.723824e-06,-5.328478e-06,-4.925900e-06,-4.516303e-06,
- -4.101252e-06,-3.680562e-06,-3.254664e-06,-2.825555e-06,-2.395149e-06,-1.964878e-06,-1.534607e-06,-1.104285e-06,
- -6.743421e-07,-2.467764e-07, 1.764981e-07, 5.939985e-07, 1.006445e-06, 1.414439e-06, 1.814764e-06, 2.207155e-06,
-  2.590633e-06, 2.965882e-06, 3.330167e-06, 3.684895e-06, 4.027880e-06, 4.357693e-06, 4.674466e-06, 4.978253e-06,
-  5.268570e-06, 5.543851e-06, 5.804283e-06, 6.049331e-06, 6.277962e-06, 6.491397e-06, 6.687932e-06, 6.867704e-06,
-  7.030764e-06, 7.176577e-06, 7.304111e-06, 7.414534e-06, 7.506678e-06, 7.581711e-06, 7.638413e-06, 7.678487e-06,
-  7.701822e-06, 7.708204e-06, 7.696556e-06, 7.666646e-06, 7.620055e-06, 7.557182e-06, 7.479061e-06, 7.384473e-06,
-  7.275143e-06, 7.150671e-06, 7.010464e-06, 6.855880e-06, 6.688150e-06, 6.506573e-06, 6.312215e-06, 6.106058e-06,
-  5.888526e-06, 5.659225e-06, 5.420055e-06, 5.171373e-06, 4.912809e-06, 4.645947e-06, 4.371160e-06, 4.089747e-06,
-  3.800980e-06, 3.506218e-06, 3.206642e-06, 2.902083e-06, 2.594665e-06, 2.283860e-06, 1.971568e-06, 1.658145e-06,
-  1.343171e-06, 1.028816e-06, 7.160002e-07, 4.031885e-07, 9.202223e-08,-2.151909e-07,-5.189715e-07,-8.193531e-07,
- -1.114212e-06,-1.404024e-06,-1.687475e-06,-1.964708e-06,-2.233839e-06,-2.496154e-06,-2.749953e-06,-2.995421e-06,
- -3.232050e-06,-3.458542e-06,-3.675572e-06,-3.882341e-06,-4.078410e-06,-4.262477e-06,-4.435195e-06,-4.595979e-06,
- -4.745440e-06,-4.882751e-06,-5.007714e-06,-5.119813e-06,-5.219656e-06,-5.306367e-06,-5.380281e-06,-5.441966e-06,
- -5.490252e-06,-5.525224e-06,-5.548499e-06,-5.558300e-06,-5.556697e-06,-5.541920e-06,-5.514053e-06,-5.473630e-06,
- -5.421683e-06,-5.356943e-06,-5.281696e-06,-5.196305e-06,-5.098468e-06,-4.991639e-06,-4.875015e-06,-4.747562e-06,
- -4.610397e-06,-4.462834e-06,-4.307557e-06,-4.143797e-06,-3.973753e-06,-3.795041e-06,-3.610527e-06,-3.418859e-06,
- -3.221687e-06,-3.019409e-06,-2.813006e-06,-2.601795e-06,-2.388559e-06,-2.171412e-06,-1.950971e-06,-1.728802e-06,
- -1.504718e-06,-1.279255e-06,-1.053392e-06,-8.264459e-07,-6.011492e-07,-3.761488e-07,-1.530944e-07, 6.761480e-08,
-  2.849465e-07, 5.001192e-07, 7.114319e-07, 9.190706e-07, 1.122502e-06, 1.320692e-06, 1.514913e-06, 1.702877e-06,
-  1.884221e-06, 2.061246e-06, 2.230552e-06, 2.392407e-06, 2.546811e-06, 2.693816e-06, 2.832889e-06, 2.962995e-06,
-  3.085304e-06, 3.198646e-06, 3.304191e-06, 3.400821e-06, 3.489171e-06, 3.567040e-06, 3.636763e-06, 3.695955e-06,
-  3.747534e-06, 3.789665e-06, 3.822483e-06, 3.845988e-06, 3.860180e-06, 3.865058e-06, 3.860598e-06, 3.847039e-06,
-  3.825166e-06, 3.794912e-06, 3.756275e-06, 3.709257e-06, 3.653856e-06, 3.590048e-06, 3.518048e-06, 3.438932e-06,
-  3.352881e-06, 3.258694e-06, 3.158630e-06, 3.053320e-06, 2.941056e-06, 2.823880e-06, 2.700241e-06, 2.571270e-06,
-  2.437952e-06, 2.300734e-06, 2.158983e-06, 2.013763e-06, 1.866083e-06, 1.716101e-06, 1.562930e-06, 1.408815e-06,
-  1.252718e-06, 1.095241e-06, 9.374165e-07, 7.780256e-07, 6.187180e-07, 4.598929e-07, 3.025828e-07, 1.455689e-07,
- -9.421775e-09,-1.627911e-07,-3.151324e-07,-4.650868e-07,-6.114224e-07,-7.548159e-07,-8.943910e-07,-1.030534e-06,
- -1.163226e-06,-1.290851e-06,-1.415213e-06,-1.534000e-06,-1.648224e-06,-1.757601e-06,-1.861056e-06,-1.958432e-06,
- -2.050563e-06,-2.135739e-06,-2.216030e-06,-2.289641e-06,-2.356973e-06,-2.418570e-06,-2.473580e-06,-2.522097e-06,
- -2.563853e-06,-2.598307e-06,-2.626308e-06,-2.647791e-06,-2.662780e-06,-2.670957e-06,-2.672340e-06,-2.668570e-06,
- -2.657630e-06,-2.640754e-06,-2.616725e-06,-2.587242e-06,-2.552171e-06,-2.511512e-06,-2.465265e-06,-2.413430e-06,
- -2.355956e-06,-2.293325e-06,-2.227155e-06,-2.156777e-06,-2.081108e-06,-2.001848e-06,-1.918862e-06,-1.832152e-06,
- -1.741665e-06,-1.647883e-06,-1.552425e-06,-1.454622e-06,-1.353390e-06,-1.250430e-06,-1.145607e-06,-1.038871e-06,
- -9.307541e-07,-8.222896e-07,-7.122587e-07,-6.023627e-07,-4.924666e-07,-3.825705e-07,-2.726231e-07,-1.631067e-07,
- -5.558771e-08, 5.006862e-08, 1.538623e-07, 2.557933e-07, 3.558617e-07, 4.540675e-07, 5.504106e-07, 6.449425e-07,
-  7.371806e-07, 8.255587e-07, 9.102114e-07, 9.910875e-07, 1.068721e-06, 1.144247e-06, 1.215430e-06, 1.281321e-06,
-  1.343622e-06, 1.402249e-06, 1.456669e-06, 1.505797e-06, 1.551385e-06, 1.592766e-06, 1.628907e-06, 1.660974e-06,
-  1.687750e-06, 1.710987e-06, 1.730016e-06, 1.743805e-06, 1.753521e-06, 1.757971e-06, 1.758641e-06, 1.754294e-06,
-  1.745015e-06, 1.732421e-06, 1.714709e-06, 1.694215e-06, 1.669688e-06, 1.640652e-06, 1.607932e-06, 1.571729e-06,
-  1.532557e-06, 1.489835e-06, 1.444170e-06, 1.394635e-06, 1.342098e-06, 1.288135e-06, 1.230701e-06, 1.171297e-06,
-  1.109248e-06, 1.045404e-06, 9.796969e-07, 9.121015e-07, 8.428333e-07, 7.729682e-07, 7.026879e-07, 6.308413e-07,
-  5.591808e-07, 4.870379e-07, 4.133286e-07, 3.397027e-07, 2.665594e-07, 1.949823e-07, 1.232190e-07, 5.193830e-08,
- -1.780185e-08,-8.748690e-08,-1.559577e-07,-2.224985e-07,-2.871766e-07,-3.499664e-07,-4.111348e-07,-4.712237e-07,
- -5.294340e-07,-5.852734e-07,-6.379766e-07,-6.892525e-07,-7.370577e-07,-7.828939e-07,-8.261356e-07,-8.671253e-07,
- -9.044962e-07,-9.388735e-07,-9.699150e-07,-9.990387e-07,-1.025086e-06,-1.047314e-06,-1.066007e-06,-1.082240e-06,
- -1.096222e-06,-1.106584e-06,-1.113979e-06,-1.117822e-06,-1.118672e-06,-1.116212e-06,-1.111592e-06,-1.103010e-06,
- -1.091667e-06,-1.079732e-06,-1.063750e-06,-1.044475e-06,-1.023523e-06,-1.000225e-06,-9.734477e-07,-9.454762e-07,
- -9.167257e-07,-8.844115e-07,-8.503694e-07,-8.144647e-07,-7.766974e-07,-7.370160e-07,-6.959544e-07,-6.545966e-07,
- -6.111898e-07,-5.663516e-07,-5.216481e-07,-4.769446e-07,-4.322926e-07,-3.871580e-07,-3.404571e-07,-2.938910e-07,
- -2.473248e-07,-2.007587e-07,-1.541412e-07,-1.080061e-07,-6.343741e-08,-1.873393e-08, 2.596956e-08, 7.072446e-08,
-  1.149968e-07, 1.577543e-07, 2.002155e-07, 2.406792e-07, 2.792289e-07, 3.163985e-07, 3.532717e-07, 3.881475e-07,
-  4.211607e-07, 4.523112e-07, 4.815476e-07, 5.094554e-07, 5.365843e-07, 5.601495e-07, 5.819868e-07, 6.019614e-07,
-  6.200734e-07, 6.363742e-07, 6.502784e-07, 6.612362e-07, 6.720323e-07, 6.808311e-07, 6.878187e-07, 6.924611e-07,
-  6.936745e-07, 6.931343e-07, 6.909728e-07, 6.877318e-07, 6.825607e-07, 6.755270e-07, 6.666049e-07, 6.560615e-07,
-  6.444386e-07, 6.308856e-07, 6.154700e-07, 5.981660e-07, 5.791893e-07, 5.596155e-07, 5.396781e-07, 5.176918e-07,
-  4.943254e-07, 4.706112e-07, 4.453822e-07, 4.198053e-07, 3.926622e-07, 3.656796e-07, 3.384557e-07, 3.104486e-07,
-  2.825089e-07, 2.545693e-07, 2.266296e-07, 1.986899e-07, 1.707502e-07, 1.428105e-07, 1.148709e-07, 8.693119e-08,
-  5.896581e-08, 3.124169e-08, 4.300716e-09,-2.275906e-08,-4.933631e-08,-7.439868e-08,-9.911328e-08,-1.223130e-07,
- -1.451650e-07,-1.665020e-07,-1.875171e-07,-2.067245e-07,-2.253350e-07,-2.435304e-07,-2.602108e-07,-2.765949e-07,
- -2.909817e-07,-3.034543e-07,-3.145211e-07,-3.255329e-07,-3.353303e-07,-3.431464e-07,-3.495823e-07,-3.557219e-07,
- -3.598383e-07,-3.622820e-07,-3.641287e-07,-3.656116e-07,-3.650458e-07,-3.630998e-07,-3.608574e-07,-3.565663e-07,
- -3.508950e-07,-3.448760e-07,-3.373421e-07,-3.295118e-07,-3.196327e-07,-3.083221e-07,-2.971462e-07,-2.859703e-07,
- -2.748459e-07,-2.632389e-07,-2.500656e-07,-2.370785e-07,-2.236089e-07,-2.085730e-07,-1.936718e-07,-1.787706e-07,
- -1.639209e-07,-1.485886e-07,-1.316901e-07,-1.149263e-07,-9.816246e-08,-8.139865e-08,-6.463485e-08,-4.781962e-08,
- -3.148692e-08,-1.672052e-08,-1.819359e-09, 1.308180e-08, 2.803438e-08, 4.250442e-08, 5.540818e-08, 6.844670e-08,
-  8.153663e-08, 9.414403e-08, 1.051851e-07, 1.163610e-07, 1.275369e-07, 1.387642e-07, 1.495089e-07, 1.586874e-07,
-  1.680520e-07, 1.769341e-07, 1.843014e-07, 1.913209e-07, 1.968255e-07, 2.019823e-07, 2.056242e-07, 2.089184e-07,
-  2.106463e-07, 2.125604e-07, 2.139919e-07, 2.139085e-07, 2.134774e-07, 2.114800e-07, 2.096431e-07, 2.075649e-07,
-  2.047036e-07, 2.019610e-07, 1.987359e-07, 1.939445e-07, 1.893393e-07, 1.842516e-07, 1.775976e-07, 1.710783e-07,
-  1.645591e-07, 1.580912e-07, 1.511409e-07, 1.426242e-07, 1.342423e-07, 1.258604e-07, 1.174785e-07, 1.090966e-07,
-  1.007147e-07, 9.233278e-08, 8.395088e-08, 7.556898e-08, 6.718707e-08, 5.880517e-08, 5.042327e-08, 4.204136e-08,
-  3.365946e-08, 2.527756e-08, 1.684424e-08, 8.893451e-09, 2.508955e-09,-4.010303e-09,-1.052956e-08,-1.704882e-08,
- -2.361949e-08,-2.970764e-08,-3.422949e-08,-3.888610e-08,-4.359413e-08,-4.781963e-08,-5.047883e-08,-5.327280e-08,
- -5.609247e-08,-5.867089e-08,-6.046616e-08,-6.232881e-08,-6.419145e-08,-6.610551e-08,-6.753704e-08,-6.740228e-08,
- -6.740228e-08,-6.745370e-08,-6.702258e-08,-6.502518e-08,-6.316253e-08,-6.129989e-08,-5.943724e-08,-5.762601e-08,
- -5.533225e-08,-5.147220e-08,-4.774691e-08,-4.402162e-08,-4.029633e-08,-3.657104e-08,-3.284575e-08,-2.912046e-08,
- -2.539517e-08,-2.166988e-08,-1.794459e-08,-1.421930e-08,-1.049401e-08,-6.768715e-09,-3.043425e-09, 6.818652e-10,
-  4.407156e-09, 8.132446e-09, 1.185774e-08, 1.558303e-08, 1.930832e-08, 2.303361e-08, 2.675890e-08, 3.048419e-08,
-  3.426089e-08, 3.755507e-08, 3.928295e-08, 4.114560e-08, 4.300824e-08, 4.487089e-08, 4.673353e-08, 4.859618e-08,
-  5.051024e-08, 5.194177e-08, 5.180701e-08, 5.180701e-08, 5.180701e-08, 5.180701e-08, 5.180701e-08, 5.180701e-08,
-  5.180701e-08, 5.180701e-08, 5.185842e-08, 5.142731e-08, 4.942990e-08, 4.756726e-08, 4.570461e-08, 4.384196e-08,
-  4.197932e-08, 4.011667e-08, 3.825403e-08, 3.639138e-08, 3.452874e-08, 3.266609e-08, 3.080345e-08, 2.894080e-08,
-  2.707816e-08, 2.521551e-08, 2.335287e-08, 2.149022e-08, 1.962758e-08, 1.776493e-08, 1.590229e-08, 1.403964e-08,
-  1.217700e-08, 1.031435e-08, 8.451707e-09, 6.589062e-09, 4.726417e-09, 2.863771e-09, 9.497114e-10,-4.818190e-10,
- -3.470575e-10, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00, 0.000000e+00,
-  0.000000e+00
+ { /* phase 0 */
+  {
+     0.00000000e+00, 8.13627565e-08, 2.77522486e-04, 1.53441103e-02, 1.83396697e-01,-1.46235004e-01,
+     1.42179597e-02, 4.32914793e-02,-4.68231402e-02, 2.87065208e-02,-7.54541811e-03,-8.24096613e-03,
+     1.68303903e-02,-1.87899191e-02, 1.62544604e-02,-1.10354098e-02, 5.09758713e-03, 4.90510021e-04,
+    -4.73150006e-03, 7.45657412e-03,-8.46029259e-03, 8.14022962e-03,-6.69317693e-03, 4.69821179e-03,
+    -2.41225492e-03, 3.19515006e-04, 1.46238797e-03,-2.66449689e-03, 3.35527491e-03,-3.46609508e-03,
+     3.19061801e-03,-2.57132994e-03, 1.82718004e-03,-1.01626106e-03, 3.03307286e-04, 2.94306694e-04,
+    -6.96943782e-04, 9.34621319e-04,-1.00003195e-03, 9.44674073e-04,-8.01418326e-04, 6.10515592e-04,
+    -4.12029505e-04, 2.31500904e-04,-8.51911173e-05,-2.26339107e-05, 9.19791491e-05,-1.29178996e-04,
+     1.40410702e-04,-1.34306203e-04, 1.16864503e-04,-9.47225126e-05, 7.12870024e-05,-5.01603499e-05,
+     3.21459192e-05,-1.84976707e-05, 8.48312902e-06,-2.11690394e-06,-1.75989101e-06, 3.50643290e-06,
+    -4.10125222e-06, 3.80098004e-06,-3.22168694e-06, 2.43795193e-06,-1.74166496e-06, 1.10924805e-06,
+    -6.11189819e-07, 2.82508893e-07,-3.14869197e-08,-2.36194904e-08, 5.18070102e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.95360457e-08, 2.34486070e-05, 7.57140107e-04,-9.96360183e-03,-3.99947166e-05,
+     2.92230956e-03,-1.87201798e-03, 2.54191458e-04, 7.84769654e-04,-1.13374460e-03, 1.00150891e-03,
+    -6.30719587e-04, 2.07079574e-04, 1.54400244e-04,-3.98870558e-04, 5.14155719e-04,-5.15469117e-04,
+     4.32013068e-04,-2.98031140e-04, 1.45712867e-04,-1.71363354e-06,-1.15401112e-04, 1.95056200e-04,
+    -2.34491192e-04, 2.36743595e-04,-2.09350954e-04, 1.61841977e-04,-1.04510924e-04, 4.64401674e-05,
+     4.95510176e-06,-4.49749641e-05, 7.11769098e-05,-8.36499967e-05, 8.39487184e-05,-7.50258914e-05,
+     6.00430067e-05,-4.23768070e-05, 2.46570562e-05,-9.08185029e-06,-3.23326094e-06, 1.16649317e-05,
+    -1.63193909e-05, 1.78261980e-05,-1.70272833e-05, 1.47668734e-05,-1.17801683e-05, 8.63289461e-06,
+    -5.71670535e-06, 3.26329609e-06,-1.36500603e-06, 2.56841304e-08, 8.19840352e-07,-1.26221130e-06,
+     1.41229975e-06,-1.36517883e-06, 1.20658569e-06,-9.95730034e-07, 7.79656716e-07,-5.83640940e-07,
+     4.20690185e-07,-2.94762003e-07, 2.02277988e-07,-1.37217967e-07, 9.37819777e-08,-6.38440270e-08,
+     4.48382025e-08,-2.79395920e-08, 1.47663997e-08,-6.08815043e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 1 */
+  {
+     0.00000000e+00, 1.00898802e-07, 3.00971093e-04, 1.61012504e-02, 1.73433095e-01,-1.46274999e-01,
+     1.71402693e-02, 4.14194614e-02,-4.65689488e-02, 2.94912905e-02,-8.67916271e-03,-7.23945722e-03,
+     1.61996707e-02,-1.85828395e-02, 1.64088607e-02,-1.14342803e-02, 5.61174285e-03,-2.49590994e-05,
+    -4.29948699e-03, 7.15854298e-03,-8.31457973e-03, 8.13851599e-03,-6.80857804e-03, 4.89326799e-03,
+    -2.64674611e-03, 5.56258601e-04, 1.25303701e-03,-2.50265491e-03, 3.25076398e-03,-3.41965491e-03,
+     3.19557311e-03,-2.61630490e-03, 1.89835695e-03,-1.09991105e-03, 3.87256005e-04, 2.19280802e-04,
+    -6.36900775e-04, 8.92244512e-04,-9.75374889e-04, 9.35592223e-04,-8.04651587e-04, 6.22180523e-04,
+    -4.28348896e-04, 2.49327102e-04,-1.02218401e-04,-7.86703731e-06, 8.01989809e-05,-1.20546101e-04,
+     1.34693997e-04,-1.31042907e-04, 1.15499497e-04,-9.46968285e-05, 7.21068427e-05,-5.14225612e-05,
+     3.35582190e-05,-1.98628495e-05, 9.68971472e-06,-3.11263398e-06,-9.80234290e-07, 2.92279196e-06,
+    -3.68056203e-06, 3.50621804e-06,-3.01940895e-06, 2.30073397e-06,-1.64788298e-06, 1.04540402e-06,
+    -5.66351616e-07, 2.54569301e-07,-1.67205201e-08,-2.97076408e-08, 5.18070102e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.35010020e-08, 2.51762976e-05, 7.88610429e-04,-9.83250141e-03, 9.86009836e-05,
+     2.86690146e-03,-1.90751255e-03, 3.17588449e-04, 7.35849142e-04,-1.11399498e-03, 1.00858323e-03,
+    -6.55081123e-04, 2.38109380e-04, 1.25288963e-04,-3.77220102e-04, 5.02462033e-04,-5.13746112e-04,
+     4.38574934e-04,-3.10260803e-04, 1.60718337e-04,-1.68383121e-05,-1.02267135e-04, 1.85292214e-04,
+    -2.28734920e-04, 2.34974897e-04,-2.11033970e-04, 1.66108832e-04,-1.10351946e-04, 5.28558157e-05,
+    -1.18301250e-06,-3.97511758e-05, 6.72570895e-05,-8.11779173e-05, 8.28673947e-05,-7.51259067e-05,
+     6.10269490e-05,-4.39194264e-05, 2.64515984e-05,-1.08708045e-05,-1.63802179e-06, 1.03767961e-05,
+    -1.53821020e-05, 1.72292930e-05,-1.67237013e-05, 1.46938819e-05,-1.18688185e-05, 8.82140012e-06,
+    -5.95259189e-06, 3.50690971e-06,-1.59040064e-06, 2.18948117e-07, 6.65095286e-07,-1.14832801e-06,
+     1.33168942e-06,-1.31262095e-06, 1.17565560e-06,-9.80963023e-07, 7.74883290e-07,-5.85057023e-07,
+     4.25897952e-07,-2.99575959e-07, 2.06403001e-07,-1.41750888e-07, 9.54579491e-08,-6.57071269e-08,
+     4.47035404e-08,-2.79397057e-08, 1.49011612e-08,-4.52184956e-09, 5.14113196e-11, 0.00000000e+00
+  }
+ },
+ { /* phase 2 */
+  {
+     0.00000000e+00, 1.24399804e-07, 3.26147390e-04, 1.68898609e-02, 1.63600594e-01,-1.46176398e-01,
+     2.00071707e-02, 3.95119488e-02,-4.62513603e-02, 3.02271396e-02,-9.79315769e-03,-6.23087399e-03,
+     1.55445896e-02,-1.83447301e-02, 1.65341496e-02,-1.18115004e-02, 6.11420488e-03,-5.38705208e-04,
+    -3.86091205e-03, 6.84828218e-03,-8.15386139e-03, 8.12167767e-03,-6.91084517e-03, 5.07856021e-03,
+    -2.87548103e-03, 7.91233499e-04, 1.04200304e-03,-2.33654608e-03, 3.14041204e-03,-3.36679909e-03,
+     3.19439010e-03,-2.65605608e-03, 1.96561404e-03,-1.18108897e-03, 4.70123399e-04, 1.44154896e-04,
+    -5.75873826e-04, 8.48325086e-04,-9.48923291e-04, 9.24721418e-04,-8.06289609e-04, 6.32557319e-04,
+    -4.43730998e-04, 2.66556395e-04,-1.18942102e-04, 6.82684413e-06, 6.83301623e-05,-1.11724701e-04,
+     1.28741405e-04,-1.27535997e-04, 1.13909096e-04,-9.44778803e-05, 7.27719380e-05,-5.25708892e-05,
+     3.48899084e-05,-2.11754705e-05, 1.08653703e-05,-4.09359700e-06,-2.05351000e-07, 2.33773494e-06,
+    -3.25466408e-06, 3.20664208e-06,-2.81300595e-06, 2.15898308e-06,-1.55242503e-06, 9.79696893e-07,
+    -5.21648076e-07, 2.26629595e-07,-1.81935900e-09,-3.42294904e-08, 5.18584216e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.81347923e-08, 2.70125165e-05, 8.21109861e-04,-9.69968736e-03, 2.35304236e-04,
+     2.80904956e-03,-1.94038823e-03, 3.80162150e-04, 6.86110929e-04,-1.09261274e-03, 1.01399515e-03,
+    -6.78229146e-04, 2.68630683e-04, 9.60696489e-05,-3.54979187e-04, 4.89905942e-04,-5.11098828e-04,
+     4.44318168e-04,-3.21882311e-04, 1.75382942e-04,-3.18847597e-05,-8.89776275e-05, 1.75207853e-04,
+    -2.22567003e-04, 2.32767547e-04,-2.12309940e-04, 1.70045998e-04,-1.15962001e-04, 5.91510907e-05,
+    -7.30017200e-06,-3.44698783e-05, 6.32219017e-05,-7.85590382e-05, 8.16291140e-05,-7.50788822e-05,
+     6.18903432e-05,-4.53713583e-05, 2.81867688e-05,-1.26300147e-05,-4.55183908e-08, 9.07370122e-06,
+    -1.44194055e-05, 1.66023092e-05,-1.63898949e-05, 1.45926060e-05,-1.19344841e-05, 8.99100269e-06,
+    -6.17530895e-06, 3.74289812e-06,-1.81259384e-06, 4.10291250e-07, 5.10459358e-07,-1.03179991e-06,
+     1.24922008e-06,-1.25883889e-06, 1.14189970e-06,-9.63591901e-07, 7.67697202e-07,-5.84490977e-07,
+     4.29109150e-07,-3.04559080e-07, 2.11211045e-07,-1.45220156e-07, 9.78030812e-08,-6.75954084e-08,
+     4.47034836e-08,-2.79396914e-08, 1.49011585e-08,-4.65660932e-09,-4.31111147e-10, 0.00000000e+00
+  }
+ },
+ { /* phase 3 */
+  {
+     0.00000000e+00, 1.52534597e-07, 3.53159907e-04, 1.77109707e-02, 1.53900906e-01,-1.45941094e-01,
+     2.28162203e-02, 3.75715606e-02,-4.58711982e-02, 3.09132505e-02,-1.08857704e-02,-5.21687884e-03,
+     1.48663605e-02,-1.80760995e-02, 1.66302193e-02,-1.21664796e-02, 6.60411082e-03,-1.04980404e-03,
+    -3.41659389e-03, 6.52639987e-03,-7.97847845e-03, 8.08979291e-03,-6.99982280e-03, 5.25376806e-03,
+    -3.09804804e-03, 1.02400105e-03, 8.29693105e-04,-2.16650008e-03, 3.02445004e-03,-3.30764800e-03,
+     3.18708993e-03,-2.69052596e-03, 2.02883594e-03,-1.25964801e-03, 5.51752513e-04, 6.90760135e-05,
+    -5.13983483e-04, 8.02953728e-04,-9.20736522e-04, 9.12091404e-04,-8.06335127e-04, 6.41631021e-04,
+    -4.58150404e-04, 2.83158704e-04,-1.35331997e-04, 2.14194497e-05, 5.63956783e-05,-1.02733698e-04,
+     1.22566096e-04,-1.23793099e-04, 1.12096503e-04,-9.40675891e-05, 7.32823974e-05,-5.36026891e-05,
+     3.61391285e-05,-2.24343094e-05, 1.20072700e-05,-5.05718890e-06, 5.62346202e-07, 1.75324396e-06,
+    -2.82555493e-06, 2.90208300e-06,-2.60179490e-06, 2.01376292e-06,-1.45462195e-06, 9.12101484e-07,
+    -4.76944592e-07, 1.98689904e-07, 1.30817996e-08,-3.88860997e-08, 5.14273104e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 3.35297017e-08, 2.89627933e-05, 8.54659826e-04,-9.56530869e-03, 3.69787216e-04,
+     2.74883024e-03,-1.97060034e-03, 4.41797078e-04, 6.35610893e-04,-1.06962956e-03, 1.01774465e-03,
+    -7.00190663e-04, 2.98568979e-04, 6.67702407e-05,-3.32180411e-04, 4.76511195e-04,-5.07534947e-04,
+     4.49229963e-04,-3.32879834e-04, 1.89678278e-04,-4.68287617e-05,-7.55609944e-05, 1.64821744e-04,
+    -2.15993961e-04, 2.30124919e-04,-2.13177816e-04, 1.73646025e-04,-1.21330144e-04, 6.53110910e-05,
+    -1.33810099e-05,-2.91410834e-05, 5.90779819e-05,-7.57969683e-05, 8.02375725e-05,-7.48864186e-05,
+     6.26268738e-05,-4.67268401e-05, 2.98570376e-05,-1.43562211e-05, 1.53703149e-06, 7.76065281e-06,
+    -1.34325819e-05, 1.59440970e-05,-1.60247000e-05, 1.44618116e-05,-1.19742290e-05, 9.14072734e-06,
+    -6.38439815e-06, 3.96960240e-06,-2.02890078e-06, 5.99808118e-07, 3.56340024e-07,-9.12852556e-07,
+     1.16489173e-06,-1.20265031e-06, 1.10800011e-06,-9.44691237e-07, 7.61432773e-07,-5.82518965e-07,
+     4.30405862e-07,-3.07418077e-07, 2.13235808e-07,-1.47679884e-07, 1.01231990e-07,-6.92681965e-08,
+     4.46519834e-08,-2.79397057e-08, 1.49525796e-08,-4.70803130e-09,-1.99741024e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 4 */
+  {
+     0.00000000e+00, 1.86064298e-07, 3.82122700e-04, 1.85656305e-02, 1.44335598e-01,-1.45571306e-01,
+     2.55650505e-02, 3.56009603e-02,-4.54294011e-02, 3.15488614e-02,-1.19554000e-02,-4.19913419e-03,
+     1.41661698e-02,-1.77775305e-02, 1.66969895e-02,-1.24986600e-02, 7.08062202e-03,-1.55733898e-03,
+    -2.96736392e-03, 6.19352004e-03,-7.78880017e-03, 8.04296415e-03,-7.07538379e-03, 5.41858980e-03,
+    -3.31404200e-03, 1.25412596e-03, 6.16515288e-04,-1.99285406e-03, 2.90311989e-03,-3.24233691e-03,
+     3.17370892e-03,-2.71966704e-03, 2.08791392e-03,-1.33544498e-03, 6.31990086e-04,-5.81040604e-06,
+    -4.51356609e-04, 7.56226887e-04,-8.90879484e-04, 8.97735183e-04,-8.04798095e-04, 6.49391674e-04,
+    -4.71582985e-04, 2.99102801e-04,-1.51356697e-04, 3.58812613e-05, 4.44214493e-05,-9.35929711e-05,
+     1.16181698e-04,-1.19823497e-04, 1.10067602e-04,-9.34677810e-05, 7.36387374e-05,-5.45155417e-05,
+     3.73040202e-05,-2.36369597e-05, 1.31152701e-05,-6.00188014e-06, 1.32377897e-06, 1.17072500e-06,
+    -2.39514907e-06, 2.59466492e-06,-2.38855910e-06, 1.86608304e-06,-1.35338996e-06, 8.42833288e-07,
+    -4.32292609e-07, 1.70750198e-07, 2.80343802e-08,-4.35941310e-08, 4.94299002e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 3.97880058e-08, 3.10330070e-05, 8.89290124e-04,-9.42929089e-03, 5.02198935e-04,
+     2.68631987e-03,-1.99816003e-03, 5.02452254e-04, 5.84449619e-04,-1.04509015e-03, 1.01983524e-03,
+    -7.20879994e-04, 3.27900052e-04, 3.74708325e-05,-3.08870338e-04, 4.62304801e-04,-5.03062969e-04,
+     4.53309854e-04,-3.43231019e-04, 2.03583390e-04,-6.16414472e-05,-6.20433129e-05, 1.54159032e-04,
+    -2.09036050e-04, 2.27053999e-04,-2.13638385e-04, 1.76901114e-04,-1.26449857e-04, 7.13230111e-05,
+    -1.94129534e-05,-2.37750355e-05, 5.48360404e-05,-7.28999730e-05, 7.86941382e-05,-7.45496727e-05,
+     6.32384035e-05,-4.79852897e-05, 3.14625795e-05,-1.60447089e-05, 3.10968608e-06, 6.43642852e-06,
+    -1.24246289e-05, 1.52587891e-05,-1.56289025e-05, 1.43032194e-05,-1.19898577e-05, 9.27274959e-06,
+    -6.57809869e-06, 4.18620039e-06,-2.23980169e-06, 7.87047611e-07, 2.03253876e-07,-7.94749212e-07,
+     1.07870073e-06,-1.14493014e-06, 1.07214964e-06,-9.24445885e-07, 7.51420089e-07,-5.80518304e-07,
+     4.30271029e-07,-3.10804808e-07, 2.17147090e-07,-1.49982043e-07, 1.02959916e-07,-6.98651093e-08,
+     4.51346125e-08,-2.79396914e-08, 1.44700412e-08,-4.22549817e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 5 */
+  {
+     0.00000000e+00, 2.25852304e-07, 4.13155707e-04, 1.94549207e-02, 1.34906307e-01,-1.45069107e-01,
+     2.82513704e-02, 3.36028002e-02,-4.49269488e-02, 3.21333110e-02,-1.30004901e-02,-3.17929895e-03,
+     1.34452898e-02,-1.74496304e-02, 1.67344604e-02,-1.28075304e-02, 7.54292682e-03,-2.06040195e-03,
+    -2.51405407e-03, 5.85028902e-03,-7.58521678e-03, 7.98132271e-03,-7.13742711e-03, 5.57274884e-03,
+    -3.52307805e-03, 1.48117996e-03, 4.02876904e-04,-1.81595294e-03, 2.77667004e-03,-3.17101390e-03,
+     3.15429596e-03,-2.74344208e-03, 2.14274996e-03,-1.40834495e-03, 7.10684224e-04,-8.03600778e-05,
+    -3.88118206e-04, 7.08241598e-04,-8.59416905e-04, 8.81690474e-04,-8.01688409e-04, 6.55828102e-04,
+    -4.84007614e-04, 3.14361590e-04,-1.66985599e-04, 5.01844806e-05, 3.24315915e-05,-8.43202215e-05,
+     1.09603599e-04,-1.15637296e-04, 1.07827800e-04,-9.26807334e-05, 7.38419913e-05,-5.53102909e-05,
+     3.83827210e-05,-2.47818898e-05, 1.41874198e-05,-6.92632602e-06, 2.07519906e-06, 5.90206696e-07,
+    -1.96487804e-06, 2.28386011e-06,-2.17141201e-06, 1.71610100e-06,-1.25043005e-06, 7.72968178e-07,
+    -3.87157996e-07, 1.42810507e-07, 4.25044213e-08,-4.78196291e-08, 4.75672586e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 4.70224819e-08, 3.32292984e-05, 9.25019383e-04,-9.29181278e-03, 6.32300973e-04,
+     2.62158923e-03,-2.02301145e-03, 5.62019646e-04, 5.32709062e-04,-1.01904012e-03, 1.02026504e-03,
+    -7.40289688e-04, 3.56569886e-04, 8.17887485e-06,-2.85089947e-04, 4.47317027e-04,-4.97695990e-04,
+     4.56548994e-04,-3.52920033e-04, 2.17069872e-04,-7.62967393e-05,-4.84487973e-05, 1.43236015e-04,
+    -2.01701885e-04, 2.23562005e-04,-2.13689709e-04, 1.79809984e-04,-1.31309964e-04, 7.71789346e-05,
+    -2.53878534e-05,-1.83838420e-05, 5.05039934e-05,-6.98730582e-05, 7.70073966e-05,-7.40673204e-05,
+     6.37235062e-05,-4.91449027e-05, 3.29985050e-05,-1.76947797e-05, 4.66813799e-06, 5.10917744e-06,
+    -1.13969727e-05, 1.45471131e-05,-1.52040011e-05, 1.41166493e-05,-1.19815122e-05, 9.38276935e-06,
+    -6.75849878e-06, 4.39269934e-06,-2.44499824e-06, 9.70372639e-07, 4.89017111e-08,-6.73600880e-07,
+     9.90577973e-07,-1.08399036e-06, 1.03388993e-06,-9.01727617e-07, 7.40210908e-07,-5.76984405e-07,
+     4.30271029e-07,-3.12292059e-07, 2.20441052e-07,-1.53170959e-07, 1.04823016e-07,-7.02802936e-08,
+     4.67009045e-08,-2.79396062e-08, 1.29037581e-08,-2.65919908e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 6 */
+  {
+     0.00000000e+00, 2.72874786e-07, 4.46385005e-04, 2.03799400e-02, 1.25614494e-01,-1.44436806e-01,
+     3.08729596e-02, 3.15797888e-02,-4.43649292e-02, 3.26660201e-02,-1.40195303e-02,-2.15903390e-03,
+     1.27050001e-02,-1.70930605e-02, 1.67426392e-02,-1.30926203e-02, 7.99024384e-03,-2.55809794e-03,
+    -2.05750507e-03, 5.49736898e-03,-7.36814691e-03, 7.90502597e-03,-7.18587590e-03, 5.71598485e-03,
+    -3.72477993e-03, 1.70474197e-03, 1.89187194e-04,-1.63614296e-03, 2.64536007e-03,-3.09383497e-03,
+     3.12890811e-03,-2.76182592e-03, 2.19325395e-03,-1.47821801e-03, 7.87691621e-04,-1.54427398e-04,
+    -3.24394699e-04, 6.59096695e-04,-8.26418400e-04, 8.63995694e-04,-7.97020271e-04, 6.60937279e-04,
+    -4.95404587e-04, 3.28908704e-04,-1.82189600e-04, 6.43011299e-05, 2.04500793e-05,-7.49374522e-05,
+     1.02845101e-04,-1.11244597e-04, 1.05382802e-04,-9.17103607e-05, 7.38908930e-05,-5.59838918e-05,
+     3.93732989e-05,-2.58658802e-05, 1.52213097e-05,-7.82805364e-06, 2.81540997e-06, 1.32222802e-08,
+    -1.53460701e-06, 1.97156805e-06,-1.95097095e-06, 1.56293004e-06,-1.14560703e-06, 7.02687885e-07,
+    -3.40457092e-07, 1.14870900e-07, 5.54081794e-08,-5.04788282e-08, 4.57046099e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 5.53585267e-08, 3.55576049e-05, 9.61879268e-04,-9.15269554e-03, 7.60108232e-04,
+     2.55472958e-03,-2.04516947e-03, 6.20458275e-04, 4.80450690e-04,-9.91529785e-04, 1.01904094e-03,
+    -7.58400187e-04, 3.84520739e-04,-2.10087746e-05,-2.60879286e-04, 4.31574881e-04,-4.91443090e-04,
+     4.58945055e-04,-3.61931045e-04, 2.30113976e-04,-9.07648355e-05,-3.48030590e-05, 1.32078305e-04,
+    -1.94008928e-04, 2.19656038e-04,-2.13334482e-04, 1.82364951e-04,-1.35903014e-04, 8.28648917e-05,
+    -3.12910415e-05,-1.29751861e-05, 4.60911542e-05,-6.67220447e-05, 7.51759508e-05,-7.34450005e-05,
+     6.40834915e-05,-5.02028852e-05, 3.44628934e-05,-1.93016022e-05, 6.20918581e-06, 3.77849210e-06,
+    -1.03535131e-05, 1.38083997e-05,-1.47522951e-05, 1.39025506e-05,-1.19500028e-05, 9.47506487e-06,
+    -6.92345202e-06, 4.59059811e-06,-2.64410482e-06, 1.15050352e-06,-1.03282218e-07,-5.53787686e-07,
+     9.01090971e-07,-1.02183913e-06, 9.92750756e-07,-8.77997991e-07, 7.28173973e-07,-5.71512714e-07,
+     4.30321961e-07,-3.13423016e-07, 2.22168978e-07,-1.54115014e-07, 1.06736024e-07,-7.18465571e-08,
+     4.65661003e-08,-2.79397128e-08, 1.30385232e-08,-2.79397128e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 7 */
+  {
+     0.00000000e+00, 3.28233313e-07, 4.81942610e-04, 2.13418193e-02, 1.16461799e-01,-1.43676698e-01,
+     3.34276892e-02, 2.95346193e-02,-4.37444709e-02, 3.31464708e-02,-1.50110601e-02,-1.13999296e-03,
+     1.19465999e-02,-1.67085398e-02, 1.67216305e-02,-1.33534996e-02, 8.42181873e-03,-3.04954103e-03,
+    -1.59856002e-03, 5.13543794e-03,-7.13803293e-03, 7.81426113e-03,-7.22067896e-03, 5.84806316e-03,
+    -3.91878886e-03, 1.92439801e-03,-2.41472808e-05,-1.45377801e-03, 2.50945706e-03,-3.01097007e-03,
+     3.09761707e-03,-2.77480111e-03, 2.23934511e-03,-1.54494005e-03, 8.62867571e-04,-2.27872399e-04,
+    -2.60311208e-04, 6.08893810e-04,-7.91955506e-04, 8.44694092e-04,-7.90811086e-04, 6.64715772e-04,
+    -5.05758100e-04, 3.42717103e-04,-1.96941895e-04, 7.82036805e-05, 8.50007655e-06,-6.54623873e-05,
+     9.59216486e-05,-1.06653999e-04, 1.02738697e-04,-9.05598572e-05, 7.37876107e-05,-5.65376795e-05,
+     4.02743899e-05,-2.68877193e-05, 1.62140605e-05,-8.70605163e-06, 3.54358394e-06,-5.58290424e-07,
+    -1.10428505e-06, 1.65814504e-06,-1.72880198e-06, 1.40881502e-06,-1.03887101e-06, 6.30841328e-07,
+    -2.93890992e-07, 8.69311876e-08, 6.84467025e-08,-5.32727995e-08, 4.38419612e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 6.49336016e-08, 3.80249112e-05, 9.99860466e-04,-9.01209563e-03, 8.85590911e-04,
+     2.48581916e-03,-2.06460990e-03, 6.77660108e-04, 4.27760184e-04,-9.62589867e-04, 1.01617014e-03,
+    -7.75169581e-04, 4.11709771e-04,-5.00604510e-05,-2.36290507e-04, 4.15107235e-04,-4.84321034e-04,
+     4.60495008e-04,-3.70249152e-04, 2.42694747e-04,-1.05024315e-04,-2.11331062e-05, 1.20704062e-04,
+    -1.85972080e-04, 2.15347041e-04,-2.12574727e-04, 1.84564036e-04,-1.40220160e-04, 8.83729663e-05,
+    -3.71159986e-05,-7.56280497e-06, 4.16059047e-05,-6.34558965e-05, 7.32049230e-05,-7.26811995e-05,
+     6.43163075e-05,-5.11581893e-05, 3.58520192e-05,-2.08631973e-05, 7.73026841e-06, 2.44693365e-06,
+    -9.29518137e-06, 1.30478002e-05,-1.42735080e-05, 1.36625167e-05,-1.18944727e-05, 9.54879579e-06,
+    -7.07216532e-06, 4.77590220e-06,-2.83510599e-06, 1.32792775e-06,-2.54083716e-07,-4.34189133e-07,
+     8.11309292e-07,-9.57161319e-07, 9.50909453e-07,-8.52260200e-07, 7.13054078e-07,-5.66009533e-07,
+     4.29942929e-07,-3.14974045e-07, 2.24083919e-07,-1.56097030e-07, 1.08116922e-07,-7.16605086e-08,
+     4.65661856e-08,-2.79653776e-08, 1.30899309e-08,-2.81967161e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 8 */
+  {
+     0.00000000e+00, 3.93166914e-07, 5.19967522e-04, 2.23416798e-02, 1.07449703e-01,-1.42791107e-01,
+     3.59135084e-02, 2.74700094e-02,-4.30668108e-02, 3.35742310e-02,-1.59736499e-02,-1.23822800e-04,
+     1.11714303e-02,-1.62968300e-02, 1.66715700e-02,-1.35897901e-02, 8.83692596e-03,-3.53386207e-03,
+    -1.13806501e-03, 4.76518879e-03,-6.89533819e-03, 7.70923682e-03,-7.24181207e-03, 5.96876722e-03,
+    -4.10476094e-03, 2.13974505e-03,-2.36722000e-04,-1.26921397e-03, 2.36923690e-03,-2.92259711e-03,
+     3.06050107e-03,-2.78236391e-03, 2.28095101e-03,-1.60839595e-03, 9.36072494e-04,-3.00553598e-04,
+    -1.95994900e-04, 5.57735621e-04,-7.56103487e-04, 8.23830895e-04,-7.83080817e-04, 6.67162705e-04,
+    -5.15053282e-04, 3.55764903e-04,-2.11215403e-04, 9.18661972e-05,-3.39439589e-06,-5.59135915e-05,
+     8.88494833e-05,-1.01878097e-04, 9.99035910e-05,-8.92319295e-05, 7.35335270e-05,-5.69718686e-05,
+     4.10856992e-05,-2.78448806e-05, 1.71649699e-05,-9.55831183e-06, 4.25663802e-06,-1.12429996e-06,
+    -6.74342118e-07, 1.34317099e-06,-1.50471806e-06, 1.25271799e-06,-9.30754084e-07, 5.59180819e-07,
+    -2.47324806e-07, 5.89658100e-08, 8.15366334e-08,-5.60924711e-08, 4.19793196e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 7.58994929e-08, 4.06375038e-05, 1.03903003e-03,-8.87010992e-03, 1.00860000e-03,
+     2.41492316e-03,-2.08132900e-03, 7.33580440e-04, 3.74708325e-04,-9.32300463e-04, 1.01166556e-03,
+    -7.90569931e-04, 4.38120216e-04,-7.89407641e-05,-2.11359933e-04, 3.97947617e-04,-4.76340763e-04,
+     4.61198390e-04,-3.77861783e-04, 2.54787039e-04,-1.19045842e-04,-7.46501610e-06, 1.09136570e-04,
+    -1.77611131e-04, 2.10641883e-04,-2.11412698e-04, 1.86402933e-04,-1.44252786e-04, 9.36931465e-05,
+    -4.28471249e-05,-2.15601176e-06, 3.70580237e-05,-6.00790372e-05, 7.11004832e-05,-7.17795047e-05,
+     6.44212996e-05,-5.20081376e-05, 3.71641945e-05,-2.23751995e-05, 9.22731124e-06, 1.11781992e-06,
+    -8.22363654e-06, 1.22651982e-05,-1.37682946e-05, 1.33964058e-05,-1.18135240e-05, 9.59962199e-06,
+    -7.20691605e-06, 4.95140557e-06,-3.01992259e-06, 1.50049163e-06,-4.04397724e-07,-3.13229975e-07,
+     7.19421223e-07,-8.91999662e-07, 9.05940396e-07,-8.25458301e-07, 6.97722044e-07,-5.57893031e-07,
+     4.27565709e-07,-3.14355020e-07, 2.25463054e-07,-1.57476961e-07, 1.08464462e-07,-7.21429387e-08,
+     4.65661003e-08,-2.77241199e-08, 1.26073942e-08,-2.57841748e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 9 */
+  {
+     0.00000000e+00, 4.69066407e-07, 5.60605025e-04, 2.33807098e-02, 9.85795930e-02,-1.41782507e-01,
+     3.83284315e-02, 2.53886804e-02,-4.23332304e-02, 3.39489393e-02,-1.69059504e-02, 8.87842791e-04,
+     1.03808604e-02,-1.58587098e-02, 1.65926293e-02,-1.38011500e-02, 9.23487358e-03,-4.01020283e-03,
+    -6.76866621e-04, 4.38732700e-03,-6.64055115e-03, 7.59019097e-03,-7.24927709e-03, 6.07790379e-03,
+    -4.28237207e-03, 2.35038693e-03,-4.48134699e-04,-1.08281104e-03, 2.22498411e-03,-2.82890396e-03,
+     3.01765394e-03,-2.78451992e-03, 2.31800904e-03,-1.66847499e-03, 1.00717298e-03,-3.72333103e-04,
+    -1.31573601e-04, 5.05727483e-04,-7.18939293e-04, 8.01455695e-04,-7.73853506e-04, 6.68280525e-04,
+    -5.23276918e-04, 3.68030102e-04,-2.24983698e-04, 1.05262603e-04,-1.52079201e-05,-4.63139695e-05,
+     8.16425672e-05,-9.69266912e-05, 9.68836684e-05,-8.77314378e-05, 7.31291293e-05,-5.72850986e-05,
+     4.18051204e-05,-2.87368803e-05, 1.80709103e-05,-1.03837701e-05, 4.95436007e-06,-1.68219299e-06,
+    -2.46776409e-07, 1.02881597e-06,-1.27925500e-06, 1.09524103e-06,-8.22289621e-07, 4.87037880e-07,
+    -2.00758706e-07, 3.12416901e-08, 9.41440277e-08,-5.86708886e-08, 4.01166709e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 8.84226949e-08, 4.34026006e-05, 1.07938983e-03,-8.72657448e-03, 1.12921000e-03,
+     2.34212726e-03,-2.09532119e-03, 7.88129866e-04, 3.21399420e-04,-9.00689512e-04, 1.00554014e-03,
+    -8.04606825e-04, 4.63659875e-04,-1.07578933e-04,-1.86130404e-04, 3.80127691e-04,-4.67525329e-04,
+     4.61058517e-04,-3.84756830e-04, 2.66373158e-04,-1.32802874e-04, 6.17885962e-06, 9.73981805e-05,
+    -1.68936793e-04, 2.05550110e-04,-2.09852617e-04, 1.87880010e-04,-1.47998100e-04, 9.88140237e-05,
+    -4.84748743e-05, 3.23588029e-06, 3.24549619e-05,-5.65979863e-05, 6.88680448e-05,-7.07414874e-05,
+     6.44016909e-05,-5.27542725e-05, 3.83976731e-05,-2.38366774e-05, 1.07004307e-05,-2.06928235e-07,
+    -7.14155613e-06, 1.14632130e-05,-1.32392015e-05, 1.31044944e-05,-1.17105201e-05, 9.63333878e-06,
+    -7.32646731e-06, 5.11387771e-06,-3.19629908e-06, 1.67056714e-06,-5.51648554e-07,-1.92860171e-07,
+     6.26678229e-07,-8.25939424e-07, 8.61340595e-07,-7.98399924e-07, 6.80875019e-07,-5.50644927e-07,
+     4.23274514e-07,-3.12815757e-07, 2.25863005e-07,-1.57824559e-07, 1.10030896e-07,-7.37092876e-08,
+     4.66175010e-08,-2.69409739e-08, 1.10410738e-08,-1.79526793e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 10 */
+  {
+     0.00000000e+00, 5.57489102e-07, 6.04007626e-04, 2.44600996e-02, 8.98530185e-02,-1.40653297e-01,
+     4.06705588e-02, 2.32933592e-02,-4.15451005e-02, 3.42703387e-02,-1.78066399e-02, 1.89338299e-03,
+     9.57625359e-03,-1.53950499e-02, 1.64850503e-02,-1.39872804e-02, 9.61500127e-03,-4.47772816e-03,
+    -2.15808104e-04, 4.00257017e-03,-6.37417799e-03, 7.45738810e-03,-7.24309823e-03, 6.17530197e-03,
+    -4.45130887e-03, 2.55593704e-03,-6.57987315e-04,-8.94931029e-04, 2.07698601e-03,-2.73008994e-03,
+     2.96917907e-03,-2.78128404e-03, 2.35046400e-03,-1.72507297e-03, 1.07604102e-03,-4.43074590e-04,
+    -6.71719099e-05, 4.52973210e-04,-6.80541620e-04, 7.77619018e-04,-7.63153075e-04, 6.68073597e-04,
+    -5.30418474e-04, 3.79493315e-04,-2.38222899e-04, 1.18367097e-04,-2.69184402e-05,-3.66806307e-05,
+     7.43160999e-05,-9.18128135e-05, 9.36873694e-05,-8.60608707e-05, 7.25774808e-05,-5.74779588e-05,
+     4.24317986e-05,-2.95628197e-05, 1.89322509e-05,-1.11821701e-05, 5.63523508e-06,-2.23283791e-06,
+     1.76498105e-07, 7.16000216e-07,-1.05339200e-06, 9.37416473e-07,-7.12258725e-07, 4.13328593e-07,
+    -1.54141205e-07, 4.30071578e-09, 1.05185102e-07,-6.04661565e-08, 3.82540293e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.02685988e-07, 4.63274773e-05, 1.12095103e-03,-8.58164579e-03, 1.24709308e-03,
+     2.26753950e-03,-2.10656971e-03, 8.41241330e-04, 2.67893076e-04,-8.67819414e-04, 9.97809926e-04,
+    -8.17238353e-04, 4.88329679e-04,-1.35939568e-04,-1.60659663e-04, 3.61680984e-04,-4.57888935e-04,
+     4.60075913e-04,-3.90923116e-04, 2.77431216e-04,-1.46272127e-04, 1.97701156e-05, 8.55112448e-05,
+    -1.59972347e-04, 2.00086040e-04,-2.07896286e-04, 1.88992650e-04,-1.51445973e-04, 1.03727914e-04,
+    -5.39901666e-05, 8.60099681e-06, 2.78069638e-05,-5.30200778e-05, 6.65099360e-05,-6.95713970e-05,
+     6.42573941e-05,-5.33927232e-05, 3.95505922e-05,-2.52441969e-05, 1.21436897e-05,-1.52410939e-06,
+    -6.05161767e-06, 1.06436783e-05,-1.26859086e-05, 1.27887033e-05,-1.15848907e-05, 9.64626088e-06,
+    -7.43015698e-06, 5.26588701e-06,-3.36729863e-06, 1.83474913e-06,-6.96622010e-07,-7.24030542e-08,
+     5.34641003e-07,-7.56730515e-07, 8.15769454e-07,-7.67119673e-07, 6.63680112e-07,-5.40157998e-07,
+     4.17500388e-07,-3.12811721e-07, 2.26946099e-07,-1.59390879e-07, 1.09896007e-07,-7.36258983e-08,
+     4.61351064e-08,-2.70597766e-08, 1.11758993e-08,-1.86265225e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 11 */
+  {
+     0.00000000e+00, 6.60175090e-07, 6.50335103e-04, 2.55810507e-02, 8.12713727e-02,-1.39406204e-01,
+     4.29380983e-02, 2.11867895e-02,-4.07038592e-02, 3.45382318e-02,-1.86744593e-02, 2.89119291e-03,
+     8.75901524e-03,-1.49067203e-02, 1.63491108e-02,-1.41479401e-02, 9.97668225e-03,-4.93561709e-03,
+     2.44267809e-04, 3.61164706e-03,-6.09674677e-03, 7.31111597e-03,-7.22332811e-03, 6.26081321e-03,
+    -4.61128121e-03, 2.75602308e-03,-8.65883601e-04,-7.05938379e-04, 1.92554004e-03,-2.62636202e-03,
+     2.91518890e-03,-2.77268304e-03, 2.37827096e-03,-1.77809305e-03, 1.14255096e-03,-5.12645987e-04,
+    -2.91451806e-06, 3.99580487e-04,-6.40991027e-04, 7.52374821e-04,-7.51009386e-04, 6.66549488e-04,
+    -5.36470092e-04, 3.90136993e-04,-2.50908808e-04, 1.31155801e-04,-3.85033309e-05,-2.70343699e-05,
+     6.68859429e-05,-8.65469265e-05, 9.03200707e-05,-8.42261215e-05, 7.18808587e-05,-5.75503618e-05,
+     4.29664397e-05,-3.03195502e-05, 1.97480203e-05,-1.19492897e-05, 6.29891520e-06,-2.77299591e-06,
+     5.93998493e-07, 4.03188494e-07,-8.26445898e-07, 7.78025594e-07,-6.02362718e-07, 3.39702694e-07,
+    -1.08006098e-07,-2.27590604e-08, 1.16361001e-07,-6.23288088e-08, 3.63913806e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.18889034e-07, 4.94195847e-05, 1.16374902e-03,-8.43535364e-03, 1.36260688e-03,
+     2.19124183e-03,-2.11510994e-03, 8.92870128e-04, 2.14248896e-04,-8.33749771e-04, 9.88492044e-04,
+    -8.28457065e-04, 5.12080267e-04,-1.63950026e-04,-1.34980306e-04, 3.42647545e-04,-4.47451137e-04,
+     4.58255585e-04,-3.96351097e-04, 2.87941657e-04,-1.59429852e-04, 3.32850032e-05, 7.34967180e-05,
+    -1.50730833e-04, 1.94258988e-04,-2.05551449e-04, 1.89743354e-04,-1.54594076e-04, 1.08425971e-04,
+    -5.93818258e-05, 1.39309559e-05, 2.31200829e-05,-4.93549742e-05, 6.40320359e-05,-6.82700193e-05,
+     6.39876962e-05,-5.39245957e-05, 4.06205072e-05,-2.65960116e-05, 1.35576120e-05,-2.83081317e-06,
+    -4.95533459e-06, 9.80499317e-06,-1.21099874e-05, 1.24483922e-05,-1.14363793e-05, 9.63911953e-06,
+    -7.51777407e-06, 5.40777546e-06,-3.52859206e-06, 1.99383067e-06,-8.40125722e-07, 4.59513103e-08,
+     4.39798896e-07,-6.88110958e-07, 7.67118763e-07,-7.35430149e-07, 6.45020918e-07,-5.29774070e-07,
+     4.12446525e-07,-3.11166275e-07, 2.25296674e-07,-1.59307604e-07, 1.09896121e-07,-7.31432976e-08,
+     4.45686865e-08,-2.65772506e-08, 1.11758922e-08,-1.86263804e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 12 */
+  {
+     0.00000000e+00, 7.79064123e-07, 6.99754688e-04, 2.67447997e-02, 7.28360191e-02,-1.38043597e-01,
+     4.51293401e-02, 1.90716796e-02,-3.98109891e-02, 3.47524807e-02,-1.95082091e-02, 3.87968495e-03,
+     7.93055817e-03,-1.43946400e-02, 1.61851607e-02,-1.42829204e-02, 1.03193298e-02,-5.38306823e-03,
+     7.02523394e-04, 3.21529596e-03,-5.80880512e-03, 7.15168612e-03,-7.19004311e-03, 6.33430993e-03,
+    -4.76201205e-03, 2.95028207e-03,-1.07143505e-03,-5.16195025e-04, 1.77094596e-03,-2.51793605e-03,
+     2.85580708e-03,-2.75875209e-03, 2.40139104e-03,-1.82744802e-03, 1.20658299e-03,-5.80916007e-04,
+     6.10731804e-05, 3.45655892e-04,-6.00370520e-04, 7.25778809e-04,-7.37451774e-04, 6.63718674e-04,
+    -5.41425426e-04, 3.99941986e-04,-2.63018796e-04, 1.43604193e-04,-4.99397102e-05,-1.73952503e-05,
+     5.93681689e-05,-8.11391510e-05, 8.67914787e-05,-8.22322909e-05, 7.10407330e-05,-5.75044105e-05,
+     4.34062385e-05,-3.10076612e-05, 2.05151391e-05,-1.26847199e-05, 6.94393611e-06,-3.30276998e-06,
+     1.00644502e-06, 9.20222334e-08,-6.01149225e-07, 6.18717991e-07,-4.92466597e-07, 2.66559397e-07,
+    -6.34374118e-08,-4.93363110e-08, 1.27536893e-07,-6.41914468e-08, 3.45287390e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.37250083e-07, 5.26867225e-05, 1.20780058e-03,-8.28769803e-03, 1.47530437e-03,
+     2.11329013e-03,-2.12091953e-03, 9.42938030e-04, 1.60600990e-04,-7.98521563e-04, 9.77606047e-04,
+    -8.38248059e-04, 5.34860417e-04,-1.91600993e-04,-1.09149143e-04, 3.23050655e-04,-4.36234754e-04,
+     4.55601607e-04,-4.01034020e-04, 2.97889113e-04,-1.72254164e-04, 4.66969796e-05, 6.13820739e-05,
+    -1.41231809e-04, 1.88080827e-04,-2.02824944e-04, 1.90128223e-04,-1.57434959e-04, 1.12900045e-04,
+    -6.46391418e-05, 1.92141160e-05, 1.84099190e-05,-4.56069829e-05, 6.14409801e-05,-6.68421853e-05,
+     6.35925244e-05,-5.43484057e-05, 4.16051480e-05,-2.78874068e-05, 1.49354455e-05,-4.12575901e-06,
+    -3.85637395e-06, 8.95350240e-06,-1.15141156e-05, 1.20850018e-05,-1.12663292e-05, 9.61353362e-06,
+    -7.58870738e-06, 5.53692371e-06,-3.68101610e-06, 2.14893225e-06,-9.79889592e-07, 1.64840458e-07,
+     3.46812158e-07,-6.19558705e-07, 7.18320734e-07,-7.03390469e-07, 6.25585017e-07,-5.17859007e-07,
+     4.07993980e-07,-3.07213128e-07, 2.25000434e-07,-1.58825088e-07, 1.09896092e-07,-7.15770909e-08,
+     4.47034836e-08,-2.50623664e-08, 1.12273000e-08,-1.91406002e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 13 */
+  {
+     0.00000000e+00, 9.16314207e-07, 7.52441410e-04, 2.79526003e-02, 6.45483211e-02,-1.36568293e-01,
+     4.72426303e-02, 1.69507600e-02,-3.88680510e-02, 3.49130817e-02,-2.03067306e-02, 4.85729100e-03,
+     7.09231012e-03,-1.38597796e-02, 1.59935597e-02,-1.43920695e-02, 1.06423805e-02,-5.81930298e-03,
+     1.15812500e-03, 2.81426194e-03,-5.51091600e-03, 6.97943196e-03,-7.14334613e-03, 6.39569201e-03,
+    -4.90324385e-03, 3.13836290e-03,-1.27425999e-03,-3.26066802e-04, 1.61351101e-03,-2.40503601e-03,
+     2.79116794e-03,-2.73953797e-03, 2.41980096e-03,-1.87305501e-03, 1.26802397e-03,-6.47758192e-04,
+     1.24665705e-04, 2.91307486e-04,-5.58765372e-04, 6.97891403e-04,-7.22516328e-04, 6.59592915e-04,
+    -5.45281800e-04, 4.08895488e-04,-2.74532911e-04, 1.55689195e-04,-6.12060394e-05,-7.78171670e-06,
+     5.17794615e-05,-7.56022273e-05, 8.31104626e-05,-8.00833586e-05, 7.00608434e-05,-5.73395700e-05,
+     4.37530507e-05,-3.16272199e-05, 2.12334598e-05,-1.33881103e-05, 7.56952113e-06,-3.82062899e-06,
+     1.41443900e-06,-2.15190894e-07,-3.76148790e-07, 4.59892902e-07,-3.82570505e-07, 1.94982306e-07,
+    -1.87339300e-08,-7.43986774e-08, 1.38764193e-07,-6.61055068e-08, 3.26660903e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.58007765e-07, 5.61365741e-05, 1.25315040e-03,-8.13873112e-03, 1.58528984e-03,
+     2.03381106e-03,-2.12400034e-03, 9.91381705e-04, 1.06967986e-04,-7.62218609e-04, 9.65178944e-04,
+    -8.46599229e-04, 5.56649640e-04,-2.18819827e-04,-8.32006335e-05, 3.02939676e-04,-4.24261205e-04,
+     4.52124048e-04,-4.04963968e-04, 3.07254028e-04,-1.84715725e-04, 5.99808991e-05, 4.91901301e-05,
+    -1.31496228e-04, 1.81565993e-04,-1.99718052e-04, 1.90147199e-04,-1.59963965e-04, 1.17140124e-04,
+    -6.97530340e-05, 2.44390685e-05, 1.36811286e-05,-4.17890260e-05, 5.87380491e-05,-6.52894960e-05,
+     6.30766008e-05,-5.46637893e-05, 4.25046892e-05,-2.91189062e-05, 1.62778306e-05,-5.40411565e-06,
+    -2.75508501e-06, 8.08810000e-06,-1.08988024e-05, 1.17007003e-05,-1.10740584e-05, 9.56879285e-06,
+    -7.64440119e-06, 5.65397931e-06,-3.82595317e-06, 2.29777652e-06,-1.11724512e-06, 2.81630491e-07,
+     2.53668986e-07,-5.48399839e-07, 6.67459972e-07,-6.69339897e-07, 6.02479759e-07,-5.03927822e-07,
+     4.00325007e-07,-3.03780610e-07, 2.23054386e-07,-1.57310097e-07, 1.09947393e-07,-7.17633100e-08,
+     4.47034907e-08,-2.47146019e-08, 1.07447136e-08,-1.43153045e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 14 */
+  {
+     0.00000000e+00, 1.07432197e-06, 8.08577985e-04, 2.92057507e-02, 5.64095899e-02,-1.34983003e-01,
+     4.92764413e-02, 1.48267597e-02,-3.78766693e-02, 3.50200497e-02,-2.10689493e-02, 5.82246995e-03,
+     6.24571089e-03,-1.33031299e-02, 1.57747399e-02,-1.44752702e-02, 1.09453201e-02,-6.24356419e-03,
+     1.61024905e-03, 2.40929797e-03,-5.20366197e-03, 6.79471623e-03,-7.08336523e-03, 6.44488214e-03,
+    -5.03474008e-03, 3.31992889e-03,-1.47397805e-03,-1.35919603e-04, 1.45354704e-03,-2.28789588e-03,
+     2.72141490e-03,-2.71509890e-03, 2.43348209e-03,-1.91484403e-03, 1.32676202e-03,-7.13047688e-04,
+     1.87742306e-04, 2.36643697e-04,-5.16260683e-04, 6.68772496e-04,-7.06238498e-04, 6.54188800e-04,
+    -5.48036885e-04, 4.16983588e-04,-2.85431714e-04, 1.67389895e-04,-7.22800978e-05, 1.78707603e-06,
+     4.41350603e-05,-6.99482480e-05, 7.92845094e-05,-7.77855821e-05, 6.89435983e-05,-5.70579396e-05,
+     4.40067197e-05,-3.21756197e-05, 2.19009198e-05,-1.40574502e-05, 8.17200089e-06,-4.32455681e-06,
+     1.81476400e-06,-5.18971490e-07,-1.53094405e-07, 3.02582805e-07,-2.72623112e-07, 1.23218996e-07,
+     2.59695607e-08,-9.91132794e-08, 1.49508907e-07,-6.75370373e-08, 3.08034487e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.81419978e-07, 5.97779872e-05, 1.29978918e-03,-7.98849016e-03, 1.69260800e-03,
+     1.95287913e-03,-2.12439988e-03, 1.03814900e-03, 5.34802675e-05,-7.24891201e-04, 9.51234251e-04,
+    -8.53501726e-04, 5.77409752e-04,-2.45559961e-04,-5.71999699e-05, 2.82349996e-04,-4.11555637e-04,
+     4.47829952e-04,-4.08136053e-04, 3.16021964e-04,-1.96798239e-04, 7.31144100e-05, 3.69376503e-05,
+    -1.21539924e-04, 1.74725195e-04,-1.96242938e-04, 1.89804778e-04,-1.62179000e-04, 1.21140853e-04,
+    -7.47158192e-05, 2.95988284e-05, 8.94279219e-06,-3.79029661e-05, 5.59350010e-05,-6.36153272e-05,
+     6.24396052e-05,-5.48706012e-05, 4.33147943e-05,-3.02859698e-05, 1.75816822e-05,-6.66687265e-06,
+    -1.65362144e-06, 7.21341348e-06,-1.02654740e-05, 1.12944981e-05,-1.08606328e-05, 9.50444428e-06,
+    -7.68559039e-06, 5.75732702e-06,-3.96218093e-06, 2.44001421e-06,-1.25186489e-06, 3.97070835e-07,
+     1.60551281e-07,-4.76371497e-07, 6.15169483e-07,-6.33369382e-07, 5.78614163e-07,-4.90818366e-07,
+     3.92390916e-07,-3.00381600e-07, 2.20709211e-07,-1.57013901e-07, 1.09516407e-07,-7.12806951e-08,
+     4.47548985e-08,-2.31997177e-08, 9.17849263e-09, 1.34754430e-10,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 15 */
+  {
+     0.00000000e+00, 1.25574195e-06, 8.68355972e-04, 3.05055398e-02, 4.84210998e-02,-1.33290395e-01,
+     5.12293205e-02, 1.27023598e-02,-3.68385203e-02, 3.50735299e-02,-2.17938405e-02, 6.77370420e-03,
+     5.39220916e-03,-1.27257202e-02, 1.55291799e-02,-1.45324701e-02, 1.12276701e-02,-6.65511983e-03,
+     2.05807900e-03, 2.00116192e-03,-4.88764001e-03, 6.59791799e-03,-7.01025082e-03, 6.48181979e-03,
+    -5.15628001e-03, 3.49465408e-03,-1.67022098e-03, 5.38851709e-05, 1.29136804e-03,-2.16675503e-03,
+     2.64669908e-03,-2.68550008e-03, 2.44242488e-03,-1.95274700e-03, 1.38269702e-03,-7.76663015e-04,
+     2.50181911e-04, 1.81773095e-04,-4.72945889e-04, 6.38486526e-04,-6.88656815e-04, 6.47521927e-04,
+    -5.49690507e-04, 4.24197002e-04,-2.95697188e-04, 1.78684393e-04,-8.31407306e-05, 1.12915204e-05,
+     3.64494699e-05,-6.41909210e-05, 7.53223285e-05,-7.53455679e-05, 6.76917334e-05,-5.66608687e-05,
+     4.41672710e-05,-3.26519912e-05, 2.25160893e-05,-1.46908196e-05, 8.75061505e-06,-4.81537518e-06,
+     2.20715492e-06,-8.19353090e-07, 6.76147991e-08, 1.45568904e-07,-1.63106705e-07, 5.19383008e-08,
+     7.07244610e-08,-1.22312997e-07, 1.58687399e-07,-6.74022829e-08, 2.89408000e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.07772018e-07, 6.36192271e-05, 1.34774856e-03,-7.83700868e-03, 1.79699063e-03,
+     1.87058002e-03,-2.12210976e-03, 1.08318031e-03, 1.78813934e-07,-6.86598942e-04, 9.35798977e-04,
+    -8.58948100e-04, 5.97099774e-04,-2.71789730e-04,-3.11695039e-05, 2.61319801e-04,-3.98143195e-04,
+     4.42730030e-04,-4.10547946e-04, 3.24179884e-04,-2.08478887e-04, 8.60719010e-05, 2.46544369e-05,
+    -1.11387111e-04, 1.67573802e-04,-1.92402978e-04, 1.89100232e-04,-1.64075987e-04, 1.24897109e-04,
+    -7.95170199e-05, 3.46819870e-05, 4.20608558e-06,-3.39580001e-05, 5.30329999e-05,-6.18268969e-05,
+     6.16826001e-05,-5.49703982e-05, 4.40371805e-05,-3.13894125e-05, 1.88443228e-05,-7.90972263e-06,
+    -5.54893631e-07, 6.32760930e-06,-9.61520709e-06, 1.08681998e-05,-1.06270018e-05, 9.42209954e-06,
+    -7.71003943e-06, 5.85037924e-06,-4.08932829e-06, 2.57790816e-06,-1.38131145e-06, 5.11747203e-07,
+     6.73790055e-08,-4.03910235e-07, 5.63060894e-07,-5.96271093e-07, 5.56016857e-07,-4.76082732e-07,
+     3.83477982e-07,-2.94858864e-07, 2.17331717e-07,-1.54990687e-07, 1.07519000e-07,-6.97401532e-08,
+     4.42723405e-08,-2.28520065e-08, 9.36459799e-09, 0.00000000e+00,-1.86263982e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 16 */
+  {
+     0.00000000e+00, 1.46351397e-06, 9.31975199e-04, 3.18532884e-02, 4.05840911e-02,-1.31493405e-01,
+     5.30999005e-02, 1.05802501e-02,-3.57553400e-02, 3.50737087e-02,-2.24804394e-02, 7.70950317e-03,
+     4.53326106e-03,-1.21286204e-02, 1.52573902e-02,-1.45636396e-02, 1.14889899e-02,-7.05326302e-03,
+     2.50080903e-03, 1.59061397e-03,-4.56346013e-03, 6.38943911e-03,-6.92417892e-03, 6.50647422e-03,
+    -5.26766712e-03, 3.66222789e-03,-1.86262396e-03, 2.42985407e-04, 1.12729205e-03,-2.04185792e-03,
+     2.56718206e-03,-2.65081809e-03, 2.44663097e-03,-1.98670500e-03, 1.43573002e-03,-8.38489912e-04,
+     3.11864511e-04, 1.26802697e-04,-4.28908708e-04, 6.07097114e-04,-6.69812493e-04, 6.39612204e-04,
+    -5.50245401e-04, 4.30524611e-04,-3.05312395e-04, 1.89552593e-04,-9.37677323e-05, 2.07136200e-05,
+     2.87394305e-05,-5.83405417e-05, 7.12330002e-05,-7.27676597e-05, 6.63104220e-05,-5.61491215e-05,
+     4.42346500e-05,-3.30559014e-05, 2.30791502e-05,-1.52870907e-05, 9.30663191e-06,-5.29145791e-06,
+     2.59063290e-06,-1.11421195e-06, 2.84946509e-07,-9.42177536e-09,-5.55877087e-08,-1.78018507e-08,
+     1.14996801e-07,-1.45165004e-07, 1.68051997e-07,-6.74022829e-08, 2.70781602e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.37366066e-07, 6.76690834e-05, 1.39705092e-03,-7.68433139e-03, 1.89840794e-03,
+     1.78704038e-03,-2.11712718e-03, 1.12643093e-03,-5.28395176e-05,-6.47401437e-04, 9.18906182e-04,
+    -8.62938119e-04, 6.15710393e-04,-2.97450460e-04,-5.17070293e-06, 2.39870511e-04,-3.84049024e-04,
+     4.36834991e-04,-4.12193942e-04, 3.31710093e-04,-2.19735317e-04, 9.88300890e-05, 1.23586506e-05,
+    -1.01050828e-04, 1.60129042e-04,-1.88210979e-04, 1.88037899e-04,-1.65652425e-04, 1.28400978e-04,
+    -8.41501169e-05, 3.96820251e-05,-5.22006303e-07,-2.99639069e-05, 5.00410097e-05,-5.99239720e-05,
+     6.08107948e-05,-5.49616379e-05, 4.46701015e-05,-3.24260327e-05, 2.00627837e-05,-9.12870746e-06,
+     5.37722372e-07, 5.43397618e-06,-8.94931145e-06, 1.04230130e-05,-1.03736675e-05, 9.31887917e-06,
+    -7.71844134e-06, 5.92903234e-06,-4.20746801e-06, 2.70800956e-06,-1.50791311e-06, 6.22811058e-07,
+    -2.55313353e-08,-3.32009222e-07, 5.10539394e-07,-5.59339242e-07, 5.31236765e-07,-4.59650892e-07,
+     3.75249101e-07,-2.89812078e-07, 2.15172690e-07,-1.53369314e-07, 1.05656326e-07,-6.96850506e-08,
+     4.27574989e-08,-2.13370015e-08, 8.88209684e-09,-5.14148724e-11,-1.86265048e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 17 */
+  {
+     0.00000000e+00, 1.70088003e-06, 9.99644282e-04, 3.32503393e-02, 3.28997597e-02,-1.29594997e-01,
+     5.48869409e-02, 8.46312288e-03,-3.46289091e-02, 3.50208692e-02,-2.31278408e-02, 8.62840936e-03,
+     3.67032294e-03,-1.15129100e-02, 1.49599398e-02,-1.45688104e-02, 1.17288604e-02,-7.43731204e-03,
+     2.93764402e-03, 1.17842003e-03,-4.23175003e-03, 6.16970379e-03,-6.82534883e-03, 6.51883287e-03,
+    -5.36871795e-03, 3.82235693e-03,-2.05083494e-03, 4.31023305e-04, 9.61639627e-04,-1.91345694e-03,
+     2.48303195e-03,-2.61113606e-03, 2.44610896e-03,-2.01666891e-03, 1.48577103e-03,-8.98413884e-04,
+     3.72675306e-04, 7.18410593e-05,-3.84238607e-04, 5.74671081e-04,-6.49749709e-04, 6.30483497e-04,
+    -5.49707678e-04, 4.35958587e-04,-3.14261706e-04, 1.99975606e-04,-1.04141400e-04, 3.00324991e-05,
+     2.10209892e-05,-5.24115094e-05, 6.70255322e-05,-7.00596502e-05, 6.48025089e-05,-5.55263105e-05,
+     4.42091186e-05,-3.33879107e-05, 2.35896896e-05,-1.58464300e-05, 9.83786867e-06,-5.75110880e-06,
+     2.96588200e-06,-1.40402403e-06, 5.00119199e-07,-1.62791096e-07, 5.00686212e-08,-8.74869031e-08,
+     1.57754300e-07,-1.66502005e-07, 1.76934094e-07,-6.74536977e-08, 2.52155097e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.70537043e-07, 7.19367526e-05, 1.44774094e-03,-7.53049925e-03, 1.99709833e-03,
+     1.70229748e-03,-2.10951408e-03, 1.16783753e-03,-1.05500221e-04,-6.07369468e-04, 9.00585204e-04,
+    -8.65465961e-04, 6.33190386e-04,-3.22509557e-04, 2.07507983e-05, 2.18069181e-04,-3.69300134e-04,
+     4.30157874e-04,-4.13078349e-04, 3.38603975e-04,-2.30549835e-04, 1.11362897e-04, 8.00937414e-08,
+    -9.05562192e-05, 1.52401160e-04,-1.83673110e-04, 1.86618010e-04,-1.66907208e-04, 1.31643959e-04,
+    -8.86018388e-05, 4.45849728e-05,-5.23100607e-06,-2.59261578e-05, 4.69629886e-05,-5.79126063e-05,
+     5.98230981e-05,-5.48447715e-05, 4.52132081e-05,-3.33936769e-05, 2.12347368e-05,-1.03235943e-05,
+     1.62358629e-06, 4.53670509e-06,-8.26979522e-06, 9.95850132e-06,-1.01000987e-05, 9.19984268e-06,
+    -7.71069881e-06, 5.99633859e-06,-4.31463559e-06, 2.83165718e-06,-1.63105869e-06, 7.32728950e-07,
+    -1.17768650e-07,-2.59529770e-07, 4.55840564e-07,-5.20240064e-07, 5.05081516e-07,-4.43972112e-07,
+     3.64284915e-07,-2.83450959e-07, 2.11312681e-07,-1.52341315e-07, 1.03793681e-07,-6.84707899e-08,
+     4.24611954e-08,-2.10150972e-08, 7.36730499e-09, 4.31114699e-10,-1.86263982e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 18 */
+  {
+     0.00000000e+00, 1.97141708e-06, 1.07158103e-03, 3.46980803e-02, 2.53692605e-02,-1.27597898e-01,
+     5.65892383e-02, 6.35360880e-03,-3.34610716e-02, 3.49153690e-02,-2.37352103e-02, 9.52899456e-03,
+     2.80485698e-03,-1.08797196e-02, 1.46374302e-02,-1.45480596e-02, 1.19469296e-02,-7.80661218e-03,
+     3.36780190e-03, 7.65341683e-04,-3.89314606e-03, 5.93915395e-03,-6.71398593e-03, 6.51891297e-03,
+    -5.45927417e-03, 3.97475809e-03,-2.23450805e-03, 6.17641315e-04, 7.94732419e-04,-1.78181299e-03,
+     2.39443011e-03,-2.56655109e-03, 2.44087796e-03,-2.04259506e-03, 1.53273402e-03,-9.56326490e-04,
+     4.32498404e-04, 1.69962896e-05,-3.39025399e-04, 5.41277404e-04,-6.28514972e-04, 6.20159903e-04,
+    -5.48084092e-04, 4.40495292e-04,-3.22531501e-04, 2.09934107e-04,-1.14241499e-04, 3.92323418e-05,
+     1.33102903e-05,-4.64151708e-05, 6.27108966e-05,-6.72279930e-05, 6.31714502e-05,-5.47935815e-05,
+     4.40913500e-05,-3.36474404e-05, 2.40455302e-05,-1.63666700e-05, 1.03429502e-05,-6.19508091e-06,
+     3.33016692e-06,-1.68747499e-06, 7.11431881e-07,-3.15132411e-07, 1.53862302e-07,-1.55957693e-07,
+     2.00215496e-07,-1.87517102e-07, 1.84301399e-07,-6.70225830e-08, 2.33528699e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 3.07644996e-07, 7.64320139e-05, 1.49979815e-03,-7.37557001e-03, 2.09270418e-03,
+     1.61650032e-03,-2.09926860e-03, 1.20736286e-03,-1.57728791e-04,-5.66558912e-04, 8.80875625e-04,
+    -8.66533024e-04, 6.49519265e-04,-3.46920453e-04, 4.65493649e-05, 1.95950270e-04,-3.53926793e-04,
+     4.22716141e-04,-4.13197471e-04, 3.44850123e-04,-2.40902882e-04, 1.23654027e-04,-1.21630728e-05,
+    -7.99237750e-05, 1.44409947e-04,-1.78799964e-04, 1.84848381e-04,-1.67837541e-04, 1.34623027e-04,
+    -9.28679947e-05, 4.93831467e-05,-9.90997069e-06,-2.18560454e-05, 4.38059215e-05,-5.57975145e-05,
+     5.87215764e-05,-5.46229930e-05, 4.56642883e-05,-3.42894928e-05, 2.23594834e-05,-1.14932191e-05,
+     2.70071905e-06, 3.63390427e-06,-7.57569796e-06, 9.47849185e-06,-9.80810728e-06, 9.06131754e-06,
+    -7.68877635e-06, 6.05047899e-06,-4.41285738e-06, 2.95046630e-06,-1.75028981e-06, 8.41322617e-07,
+    -2.09078280e-07,-1.87897967e-07, 4.00799763e-07,-4.82199539e-07, 4.78559741e-07,-4.25532107e-07,
+     3.54728172e-07,-2.77232971e-07, 2.07638720e-07,-1.49954388e-07, 1.01931008e-07,-6.65408066e-08,
+     4.04637177e-08,-1.92073912e-08, 7.01949432e-09, 1.99739958e-09,-1.86265048e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 19 */
+  {
+     0.00000000e+00, 2.27906207e-06, 1.14801305e-03, 3.61978784e-02, 1.79936904e-02,-1.25505194e-01,
+     5.82057387e-02, 4.25434019e-03,-3.22537087e-02, 3.47576402e-02,-2.43017692e-02, 1.04098702e-02,
+     1.93832396e-03,-1.02302004e-02, 1.42905097e-02,-1.45015102e-02, 1.21428799e-02,-8.16053897e-03,
+     3.79051804e-03, 3.52144212e-04,-3.54829594e-03, 5.69825107e-03,-6.59033190e-03, 6.50674989e-03,
+    -5.53919794e-03, 4.11916804e-03,-2.41330802e-03, 8.02489696e-04, 6.26894878e-04,-1.64718996e-03,
+     2.30156211e-03,-2.51716794e-03, 2.43096799e-03,-2.06445111e-03, 1.57653994e-03,-1.01212400e-03,
+     4.91219980e-04,-3.76267017e-05,-2.93361110e-04, 5.06987912e-04,-6.06155489e-04, 6.08666684e-04,
+    -5.45383373e-04, 4.44129197e-04,-3.30107199e-04, 2.19412599e-04,-1.24049606e-04, 4.82936593e-05,
+     5.62151399e-06,-4.03646918e-05, 5.82980392e-05,-6.42775267e-05, 6.14211604e-05,-5.39522589e-05,
+     4.38822717e-05,-3.38353384e-05, 2.44463299e-05,-1.68488696e-05, 1.08215099e-05,-6.62061302e-06,
+     3.68489509e-06,-1.96470796e-06, 9.19070601e-07,-4.65086799e-07, 2.55793310e-07,-2.22498500e-07,
+     2.40679213e-07,-2.06724494e-07, 1.91320893e-07,-6.50251835e-08, 2.14902194e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 3.49075890e-07, 8.11628997e-05, 1.55327097e-03,-7.21955020e-03, 2.18529254e-03,
+     1.52971223e-03,-2.08642613e-03, 1.24495849e-03,-2.09450722e-04,-5.25070354e-04, 8.59810039e-04,
+    -8.66142916e-04, 6.64682128e-04,-3.70649621e-04, 7.21998513e-05, 1.73530541e-04,-3.37957405e-04,
+     4.14518872e-04,-4.12554335e-04, 3.50437826e-04,-2.50773970e-04, 1.35672744e-04,-2.43480317e-05,
+    -6.91711903e-05, 1.36166811e-04,-1.73601089e-04, 1.82730262e-04,-1.68443279e-04, 1.37335970e-04,
+    -9.69402026e-05, 5.40688634e-05,-1.45530794e-05,-1.77589245e-05, 4.05800529e-05,-5.35820145e-05,
+     5.75128361e-05,-5.42951566e-05, 4.60231095e-05,-3.51146155e-05, 2.34355684e-05,-1.26329833e-05,
+     3.76475509e-06, 2.72830948e-06,-6.87228749e-06, 8.98049620e-06,-9.49809328e-06, 8.90739102e-06,
+    -7.65087225e-06, 6.09154085e-06,-4.50260995e-06, 3.06045695e-06,-1.86288162e-06, 9.45390639e-07,
+    -2.97583028e-07,-1.15931471e-07, 3.48050889e-07,-4.43389581e-07, 4.50500011e-07,-4.08763754e-07,
+     3.42985004e-07,-2.69131078e-07, 2.03431398e-07,-1.46335623e-07, 1.00068377e-07,-6.46780904e-08,
+     3.85497003e-08,-1.86105069e-08, 5.50460300e-09, 1.86265225e-09,-1.86263982e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 20 */
+  {
+     0.00000000e+00, 2.62813796e-06, 1.22917595e-03, 3.77511494e-02, 1.07741402e-02,-1.23319902e-01,
+     5.97354509e-02, 2.16791406e-03,-3.10087502e-02, 3.45481895e-02,-2.48268396e-02, 1.12696802e-02,
+     1.07218104e-03,-9.56551824e-03, 1.39198601e-02,-1.44293103e-02, 1.23164104e-02,-8.49849638e-03,
+     4.20503691e-03,-6.04101297e-05,-3.19785811e-03, 5.44747710e-03,-6.45465916e-03, 6.48240186e-03,
+    -5.60836913e-03, 4.25533485e-03,-2.58690910e-03, 9.85219958e-04, 4.58451599e-04,-1.50985399e-03,
+     2.20462191e-03,-2.46309908e-03, 2.41641491e-03,-2.08221003e-03, 1.61712000e-03,-1.06570602e-03,
+     5.48732816e-04,-9.19218583e-05,-2.47338001e-04, 4.71873296e-04,-5.82719920e-04, 5.96033700e-04,
+    -5.41618618e-04, 4.46857506e-04,-3.36979487e-04, 2.28393095e-04,-1.33547699e-04, 5.72010504e-05,
+    -2.02935803e-06,-3.42731510e-05, 5.37954293e-05,-6.12170697e-05, 5.95582787e-05,-5.30068683e-05,
+     4.35846887e-05,-3.39512699e-05, 2.47943808e-05,-1.72922591e-05, 1.12720099e-05,-7.02937677e-06,
+     4.02788010e-06,-2.23383904e-06, 1.12250200e-06,-6.11422422e-07, 3.55861687e-07,-2.87176590e-07,
+     2.79228914e-07,-2.25335000e-07, 1.96825496e-07,-6.31625312e-08, 1.96275796e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 3.95252982e-07, 8.61430308e-05, 1.60817057e-03,-7.06252549e-03, 2.27480382e-03,
+     1.44204870e-03,-2.07101391e-03, 1.28057040e-03,-2.60587782e-04,-4.82929870e-04, 8.37429427e-04,
+    -8.64303554e-04, 6.78651966e-04,-3.93650495e-04, 9.76203009e-05, 1.50879845e-04,-3.21422704e-04,
+     4.05589119e-04,-4.11153189e-04, 3.55358003e-04,-2.60150991e-04, 1.47405080e-04,-3.64487059e-05,
+    -5.83217479e-05, 1.27693173e-04,-1.68088824e-04, 1.80270057e-04,-1.68723287e-04, 1.39771961e-04,
+    -1.00811012e-04, 5.86339738e-05,-1.91519503e-05,-1.36420131e-05, 3.72850336e-05,-5.12719853e-05,
+     5.61960042e-05,-5.38606400e-05, 4.62919998e-05,-3.58672987e-05, 2.44603143e-05,-1.37406751e-05,
+     4.81773168e-06, 1.82300573e-06,-6.15839963e-06, 8.46829789e-06,-9.17150464e-06, 8.73492900e-06,
+    -7.59706199e-06, 6.12003168e-06,-4.58248905e-06, 3.16469959e-06,-1.97227928e-06, 1.04840001e-06,
+    -3.86389729e-07,-4.36411938e-08, 2.91909600e-07,-4.01951183e-07, 4.22600351e-07,-3.90355126e-07,
+     3.29812792e-07,-2.62314870e-07, 1.98190037e-07,-1.43393493e-07, 9.82058168e-08,-6.27898089e-08,
+     3.71695990e-08,-1.81953936e-08, 5.15680654e-09, 1.86263804e-09,-1.86264870e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 21 */
+  {
+     0.00000000e+00, 3.02339095e-06, 1.31531898e-03, 3.93593200e-02, 3.71161499e-03,-1.21045098e-01,
+     6.11774996e-02, 9.69001703e-05,-2.97281798e-02, 3.42876017e-02,-2.53097694e-02, 1.21071097e-02,
+     2.07877500e-04,-8.88686627e-03, 1.35262096e-02,-1.43316900e-02, 1.24672903e-02,-8.81991908e-03,
+     4.61062603e-03,-4.71563311e-04,-2.84250011e-03, 5.18732611e-03,-6.30725408e-03, 6.44595316e-03,
+    -5.66669088e-03, 4.38302802e-03,-2.75499793e-03, 1.16549002e-03, 2.89728312e-04,-1.37008203e-03,
+     2.10381090e-03,-2.40446511e-03, 2.39726296e-03,-2.09585205e-03, 1.65440503e-03,-1.11697800e-03,
+     6.04928820e-04,-1.45782498e-04,-2.01046001e-04, 4.36005997e-04,-5.58259606e-04, 5.82293025e-04,
+    -5.36800886e-04, 4.48680512e-04,-3.43137886e-04, 2.36861393e-04,-1.42719204e-04, 6.59359794e-05,
+    -9.62642025e-06,-2.81531193e-05, 4.92129402e-05,-5.80523702e-05, 5.75859995e-05,-5.19584682e-05,
+     4.31982990e-05,-3.39949111e-05, 2.50862904e-05,-1.76942103e-05, 1.16946103e-05,-7.41973190e-06,
+     4.35769289e-06,-2.49615391e-06, 1.32069204e-06,-7.54815915e-07, 4.54067504e-07,-3.49966399e-07,
+     3.16398513e-07,-2.43530394e-07, 2.01982303e-07,-6.12998932e-08, 1.77649309e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 4.46628974e-07, 9.13779950e-05, 1.66453049e-03,-6.90451730e-03, 2.36120075e-03,
+     1.35357678e-03,-2.05306825e-03, 1.31417997e-03,-3.11072916e-04,-4.40221280e-04, 8.13780352e-04,
+    -8.61020759e-04, 6.91408291e-04,-4.15879302e-04, 1.22800469e-04, 1.28029846e-04,-3.04356217e-04,
+     3.95944808e-04,-4.08998167e-04, 3.59605066e-04,-2.69013923e-04, 1.58823095e-04,-4.84469347e-05,
+    -4.73950058e-05, 1.19003002e-04,-1.62274111e-04, 1.77472015e-04,-1.68679806e-04, 1.41932047e-04,
+    -1.04474835e-04, 6.30680006e-05,-2.36928463e-05,-9.51695256e-06, 3.39309918e-05,-4.88730147e-05,
+     5.47745731e-05,-5.33247076e-05, 4.64673940e-05,-3.65450978e-05, 2.54302868e-05,-1.48159452e-05,
+     5.85598173e-06, 9.18487785e-07,-5.43761416e-06, 7.94271182e-06,-8.82659515e-06, 8.54631799e-06,
+    -7.52813958e-06, 6.13705015e-06,-4.65154153e-06, 3.26137160e-06,-2.07666017e-06, 1.14681825e-06,
+    -4.73108230e-07, 2.70520104e-08, 2.35970219e-07,-3.60460035e-07, 3.94239578e-07,-3.69639110e-07,
+     3.16772912e-07,-2.53799044e-07, 1.94221002e-07,-1.39575093e-07, 9.63431148e-08,-6.11684072e-08,
+     3.68731889e-08,-1.66804170e-08, 3.64190100e-09, 1.86265225e-09,-1.86264160e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 22 */
+  {
+     0.00000000e+00, 3.47001992e-06, 1.40669697e-03, 4.10238504e-02,-3.19290208e-03,-1.18683897e-01,
+     6.25310764e-02,-1.95616810e-03,-2.84139998e-02, 3.39765288e-02,-2.57499907e-02, 1.29208900e-02,
+    -6.53143274e-04,-8.19545798e-03, 1.31103303e-02,-1.42088896e-02, 1.25953201e-02,-9.12427530e-03,
+     5.00657083e-03,-8.80561478e-04,-2.48289504e-03, 4.91831219e-03,-6.14843098e-03, 6.39750622e-03,
+    -5.71408588e-03, 4.50203102e-03,-2.91727204e-03, 1.34296203e-03, 1.21048499e-04,-1.22814998e-03,
+     1.99933606e-03,-2.34139711e-03, 2.37357011e-03,-2.10536900e-03, 1.68833602e-03,-1.16585102e-03,
+     6.59703393e-04,-1.99107206e-04,-1.54578607e-04, 3.99460900e-04,-5.32829319e-04, 5.67477080e-04,
+    -5.30944904e-04, 4.49599000e-04,-3.48575501e-04, 2.44804105e-04,-1.51545799e-04, 7.44822974e-05,
+    -1.71545598e-05,-2.20160691e-05, 4.45613987e-05,-5.47909985e-05, 5.55093393e-05,-5.08116500e-05,
+     4.27251907e-05,-3.39678591e-05, 2.53222606e-05,-1.80546704e-05, 1.20888499e-05,-7.78937101e-06,
+     4.67446580e-06,-2.74995296e-06, 1.51491304e-06,-8.94391007e-07, 5.50410618e-07,-4.11134806e-07,
+     3.53271702e-07,-2.60210811e-07, 2.05624204e-07,-5.94372409e-08, 1.59022893e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 5.03691126e-07, 9.68819950e-05, 1.72235072e-03,-6.74558664e-03, 2.44449824e-03,
+     1.26444548e-03,-2.03262269e-03, 1.34572946e-03,-3.60827893e-04,-3.97019088e-04, 7.88889825e-04,
+    -8.56303726e-04, 7.02932011e-04,-4.37320210e-04, 1.47679821e-04, 1.05009414e-04,-2.86786817e-04,
+     3.85602936e-04,-4.06095467e-04, 3.63172032e-04,-2.77349260e-04, 1.69911887e-04,-6.03152439e-05,
+    -3.64100561e-05, 1.10113993e-04,-1.56169990e-04, 1.74348010e-04,-1.68314087e-04, 1.43814948e-04,
+    -1.07924105e-04, 6.73651230e-05,-2.81732064e-05,-5.39002940e-06, 3.05259600e-05,-4.63880133e-05,
+     5.32531994e-05,-5.26868826e-05, 4.65501071e-05,-3.71483038e-05, 2.63449037e-05,-1.58574549e-05,
+     6.87543070e-06, 1.81025825e-08,-4.70998930e-06, 7.40290852e-06,-8.46850162e-06, 8.34248203e-06,
+    -7.44572026e-06, 6.14085002e-06,-4.71094972e-06, 3.35057848e-06,-2.17753768e-06, 1.24482904e-06,
+    -5.59910404e-07, 9.73486749e-08, 1.80580173e-07,-3.20109393e-07, 3.64299922e-07,-3.49442416e-07,
+     3.03787147e-07,-2.45468073e-07, 1.87963906e-07,-1.36143001e-07, 9.45318561e-08,-6.00888939e-08,
+     3.48757965e-08,-1.63840923e-08, 3.29418981e-09, 1.81123028e-09,-1.86264959e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 23 */
+  {
+     0.00000000e+00, 3.97371105e-06, 1.50357897e-03, 4.27462012e-02,-9.93848871e-03,-1.16239399e-01,
+     6.37955219e-02,-3.98879079e-03,-2.70682704e-02, 3.36157009e-02,-2.61470098e-02, 1.37097798e-02,
+    -1.50944700e-03,-7.49252597e-03, 1.26730101e-02,-1.40612097e-02, 1.27003295e-02,-9.41106211e-03,
+     5.39217377e-03,-1.28665695e-03,-2.11972301e-03, 4.64096293e-03,-5.97851910e-03, 6.33719098e-03,
+    -5.75049594e-03, 4.61214501e-03,-3.07344203e-03, 1.51731004e-03,-4.72655884e-05,-1.08433503e-03,
+     1.89141196e-03,-2.27403198e-03, 2.34539690e-03,-2.11075903e-03, 1.71886198e-03,-1.21223903e-03,
+     7.12956593e-04,-2.51794088e-04,-1.08028500e-04, 3.62312596e-04,-5.06484415e-04, 5.51619625e-04,
+    -5.24069474e-04, 4.49617102e-04,-3.53285490e-04, 2.52207014e-04,-1.60014300e-04, 8.28247794e-05,
+    -2.46002801e-05,-1.58752191e-05, 3.98504490e-05,-5.14404201e-05, 5.33318016e-05,-4.95668210e-05,
+     4.21652803e-05,-3.38705104e-05, 2.55028408e-05,-1.83747798e-05, 1.24531498e-05,-8.13881343e-06,
+     4.97825295e-06,-2.99542103e-06, 1.70287694e-06,-1.03053401e-06, 6.44942475e-07,-4.71223700e-07,
+     3.88147498e-07,-2.76594903e-07, 2.08918394e-07,-5.76260106e-08, 1.40396397e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 5.66963990e-07, 1.02665043e-04, 1.78167969e-03,-6.58578146e-03, 2.52449512e-03,
+     1.17469579e-03,-2.00971821e-03, 1.37520954e-03,-4.09781933e-04,-3.53390351e-04, 7.62830488e-04,
+    -8.50167009e-04, 7.13206828e-04,-4.57909890e-04, 1.72220170e-04, 8.18800181e-05,-2.68749893e-04,
+     3.74585390e-04,-4.02451027e-04, 3.66055057e-04,-2.85140704e-04, 1.80647243e-04,-7.20368698e-05,
+    -2.53901817e-05, 1.01042911e-04,-1.49786938e-04, 1.70897925e-04,-1.67626713e-04, 1.45412108e-04,
+    -1.11151952e-04, 7.15139322e-05,-3.25809233e-05,-1.26799569e-06, 2.70759920e-05,-4.38239658e-05,
+     5.16339787e-05,-5.19485038e-05, 4.65416088e-05,-3.76747048e-05, 2.72042234e-05,-1.68610131e-05,
+     7.87514728e-06,-8.76898412e-07,-3.97590338e-06, 6.85217674e-06,-8.09460471e-06, 8.12220969e-06,
+    -7.34743844e-06, 6.13208795e-06,-4.75944762e-06, 3.43233842e-06,-2.27189230e-06, 1.33831054e-06,
+    -6.43081876e-07, 1.66659447e-07, 1.26259692e-07,-2.78059815e-07, 3.34540346e-07,-3.29278919e-07,
+     2.90317075e-07,-2.36628921e-07, 1.81344035e-07,-1.32691980e-07, 9.22381105e-08,-5.82102757e-08,
+     3.30132082e-08,-1.43867851e-08, 1.72791204e-09, 2.29375985e-09,-1.86263982e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 24 */
+  {
+     0.00000000e+00, 4.54067504e-06, 1.60624401e-03, 4.45278808e-02,-1.65242702e-02,-1.13714904e-01,
+     6.49702176e-02,-5.99850900e-03,-2.56930608e-02, 3.32059190e-02,-2.65004002e-02, 1.44726103e-02,
+    -2.35961401e-03,-6.77931914e-03, 1.22151002e-02,-1.38889896e-02, 1.27822096e-02,-9.67981201e-03,
+     5.76675916e-03,-1.68910797e-03,-1.75366795e-03, 4.35582222e-03,-5.79787185e-03, 6.26515411e-03,
+    -5.77588612e-03, 4.71318793e-03,-3.22322897e-03, 1.68820797e-03,-2.14892294e-04,-9.38922924e-04,
+     1.78026001e-03,-2.20251805e-03, 2.31281598e-03,-2.11202702e-03, 1.74593797e-03,-1.25606300e-03,
+     7.64590572e-04,-3.03742592e-04,-6.14868914e-05, 3.24637891e-04,-4.79280192e-04, 5.34758612e-04,
+    -5.16194326e-04, 4.48740204e-04,-3.57261393e-04, 2.59059190e-04,-1.68108905e-04, 9.09469891e-05,
+    -3.19477185e-05,-9.74313116e-06, 3.50910013e-05,-4.80080816e-05, 5.10599093e-05,-4.82285104e-05,
+     4.15221984e-05,-3.37038509e-05, 2.56291005e-05,-1.86528396e-05, 1.27876901e-05,-8.46809235e-06,
+     5.26857002e-06,-3.23204995e-06, 1.88422098e-06,-1.16322599e-06, 7.37180585e-07,-5.29433976e-07,
+     4.21160706e-07,-2.90981689e-07, 2.10646306e-07,-5.53322508e-08, 1.21769999e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 6.37014182e-07, 1.08737964e-04, 1.84248760e-03,-6.42514974e-03, 2.60140002e-03,
+     1.08446181e-03,-1.98439602e-03, 1.40256062e-03,-4.57879156e-04,-3.09389085e-04, 7.35609792e-04,
+    -8.42625042e-04, 7.22222961e-04,-4.77639958e-04, 1.96369365e-04, 5.86807728e-05,-2.50280835e-04,
+     3.62914987e-04,-3.98076023e-04, 3.68249952e-04,-2.92378012e-04, 1.91012863e-04,-8.35871324e-05,
+    -1.43568031e-05, 9.18069854e-05,-1.43137993e-04, 1.67133985e-04,-1.66621001e-04, 1.46725040e-04,
+    -1.14156050e-04, 7.55121000e-05,-3.69108748e-05, 2.84099951e-06, 2.35859770e-05,-4.11849469e-05,
+     4.99208109e-05,-5.11115941e-05, 4.64418226e-05,-3.81252030e-05, 2.80039967e-05,-1.78253395e-05,
+     8.85350164e-06,-1.76471076e-06,-3.23960558e-06, 6.29061833e-06,-7.70599581e-06, 7.88659963e-06,
+    -7.23450285e-06, 6.11186124e-06,-4.79880146e-06, 3.50670234e-06,-2.36040796e-06, 1.42704084e-06,
+    -7.24547135e-07, 2.36672349e-07, 7.02202669e-08,-2.36161213e-07, 3.04319656e-07,-3.06940819e-07,
+     2.75280854e-07,-2.26492148e-07, 1.77025072e-07,-1.27624958e-07, 8.83781013e-08,-5.58394504e-08,
+     3.11505062e-08,-1.24726114e-08, 1.91408844e-09, 3.86005183e-09,-1.86264959e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 25 */
+  {
+     0.00000000e+00, 5.17768922e-06, 1.71498198e-03, 4.63703685e-02,-2.29494199e-02,-1.11113504e-01,
+     6.60546795e-02,-7.98290502e-03,-2.42905002e-02, 3.27480398e-02,-2.68097892e-02, 1.52082201e-02,
+    -3.20223905e-03,-6.05709618e-03, 1.17374603e-02,-1.36926202e-02, 1.28408903e-02,-9.93009284e-03,
+     6.12967415e-03,-2.08718400e-03,-1.38541800e-03, 4.06344421e-03,-5.60685899e-03, 6.18156698e-03,
+    -5.79024293e-03, 4.80499491e-03,-3.36636696e-03, 1.85534195e-03,-3.81513295e-04,-7.92197883e-04,
+     1.66610396e-03,-2.12700595e-03, 2.27590511e-03,-2.10918603e-03, 1.76952395e-03,-1.29724795e-03,
+     8.14511382e-04,-3.54854186e-04,-1.50450696e-05, 2.86512688e-04,-4.51276195e-04, 5.16933273e-04,
+    -5.07340825e-04, 4.46975493e-04,-3.60500999e-04, 2.65349809e-04,-1.75814901e-04, 9.88335887e-05,
+    -3.91822214e-05,-3.63126992e-06, 3.02921999e-05,-4.45013793e-05, 4.86995013e-05,-4.68014696e-05,
+     4.07976513e-05,-3.34671786e-05, 2.56993208e-05,-1.88890008e-05, 1.30920098e-05,-8.77503317e-06,
+     5.54385088e-06,-3.45854210e-06, 2.06124605e-06,-1.29085095e-06, 8.25558686e-07,-5.85273426e-07,
+     4.52311212e-07,-3.03454300e-07, 2.12560394e-07,-5.14721989e-08, 1.03143503e-08, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 7.14447651e-07, 1.15111005e-04, 1.90486014e-03,-6.26374036e-03, 2.67500430e-03,
+     9.93832946e-04,-1.95670221e-03, 1.42778084e-03,-5.05030155e-04,-2.65121460e-04, 7.07319006e-04,
+    -8.33697151e-04, 7.29964115e-04,-4.96470369e-04, 2.20100395e-04, 3.54293734e-05,-2.31416896e-04,
+     3.50615010e-04,-3.92979011e-04, 3.69754969e-04,-2.99048144e-04, 2.00987794e-04,-9.49450769e-05,
+    -3.32901254e-06, 8.24281015e-05,-1.36238057e-04, 1.63062010e-04,-1.65299833e-04, 1.47752406e-04,
+    -1.16928946e-04, 7.93470535e-05,-4.11500223e-05, 6.92601316e-06, 2.00660434e-05,-3.84750310e-05,
+     4.81184106e-05,-5.01802133e-05, 4.62516873e-05,-3.84992745e-05, 2.87457951e-05,-1.87502592e-05,
+     9.81125049e-06,-2.64609116e-06,-2.50089215e-06, 5.72029967e-06,-7.30430475e-06, 7.63551361e-06,
+    -7.10817039e-06, 6.07840684e-06,-4.82888936e-06, 3.57312820e-06,-2.44305193e-06, 1.51315908e-06,
+    -8.03920557e-07, 3.03989509e-07, 1.45100785e-08,-1.94249878e-07, 2.72460056e-07,-2.85613169e-07,
+     2.60431989e-07,-2.17029992e-07, 1.69305849e-07,-1.24362032e-07, 8.46526973e-08,-5.27031716e-08,
+     2.92363893e-08,-1.10667884e-08, 1.43150203e-09, 3.72529030e-09,-1.86264337e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 26 */
+  {
+     0.00000000e+00, 5.89213687e-06, 1.83009298e-03, 4.82752286e-02,-2.92131603e-02,-1.08438499e-01,
+     6.70485124e-02,-9.93960723e-03,-2.28627194e-02, 3.22430097e-02,-2.70749107e-02, 1.59155391e-02,
+    -4.03593620e-03,-5.32713206e-03, 1.12409899e-02,-1.34725198e-02, 1.28763197e-02,-1.01615097e-02,
+     6.48028916e-03,-2.48016301e-03,-1.01566303e-03, 3.76439607e-03,-5.40587120e-03, 6.08662190e-03,
+    -5.79357194e-03, 4.88742301e-03,-3.50260502e-03, 2.01840396e-03,-5.46813128e-04,-6.44445478e-04,
+     1.54917501e-03,-2.04765890e-03, 2.23475508e-03,-2.10226001e-03, 1.78958999e-03,-1.33572298e-03,
+     8.62629793e-04,-4.05034400e-04, 3.12066186e-05, 2.48013414e-04,-4.22530400e-04, 4.98183013e-04,
+    -4.97529574e-04, 4.44329402e-04,-3.63001891e-04, 2.71070108e-04,-1.83119206e-04, 1.06469102e-04,
+    -4.62903918e-05, 2.44713692e-06, 2.54633105e-05,-4.09282511e-05, 4.62564494e-05,-4.52883105e-05,
+     3.99937308e-05,-3.31631891e-05, 2.57138308e-05,-1.90832507e-05, 1.33644699e-05,-9.06064633e-06,
+     5.80428286e-06,-3.67557209e-06, 2.23055190e-06,-1.41521298e-06, 9.10211384e-07,-6.37976598e-07,
+     4.81547602e-07,-3.14521088e-07, 2.13991896e-07,-4.77469086e-08, 8.45170689e-09, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 7.99915142e-07, 1.21799065e-04, 1.96876004e-03,-6.10161945e-03, 2.74530053e-03,
+     9.02906060e-04,-1.92668289e-03, 1.45081989e-03,-5.51167876e-04,-2.20609829e-04, 6.77971169e-04,
+    -8.23399983e-04, 7.36427028e-04,-5.14369458e-04, 2.43360177e-04, 1.21900812e-05,-2.12170184e-04,
+     3.37711070e-04,-3.87171982e-04, 3.70568829e-04,-3.05141089e-04, 2.10560393e-04,-1.06087886e-04,
+     7.66897574e-06, 7.29211606e-05,-1.29102031e-04, 1.58692012e-04,-1.63665274e-04, 1.48492283e-04,
+    -1.19465985e-04, 8.30148347e-05,-4.52951062e-05, 1.09830871e-05, 1.65200327e-05,-3.57050449e-05,
+     4.62319003e-05,-4.91538958e-05, 4.59733419e-05,-3.87947075e-05, 2.94274942e-05,-1.96332112e-05,
+     1.07412634e-05,-3.51609197e-06,-1.75999594e-06, 5.14258863e-06,-6.89169974e-06, 7.37259688e-06,
+    -6.96912684e-06, 6.03239505e-06,-4.84896009e-06, 3.63049185e-06,-2.52178870e-06, 1.59491174e-06,
+    -8.80630978e-07, 3.72230716e-07,-3.99213604e-08,-1.52329449e-07, 2.41279849e-07,-2.64002665e-07,
+     2.45048341e-07,-2.06768846e-07, 1.61855041e-07,-1.18787057e-07, 8.08761342e-08,-5.12758902e-08,
+     2.79077881e-08,-1.10118208e-08,-8.33892955e-11, 3.72529030e-09,-1.86264471e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 27 */
+  {
+     0.00000000e+00, 6.69205201e-06, 1.95189205e-03, 5.02439886e-02,-3.53147797e-02,-1.05693199e-01,
+     6.79514185e-02,-1.18662901e-02,-2.14118995e-02, 3.16918418e-02,-2.72955205e-02, 1.65935103e-02,
+    -4.85933619e-03,-4.59070504e-03, 1.07266204e-02,-1.32291596e-02, 1.28885098e-02,-1.03736799e-02,
+     6.81800023e-03,-2.86733499e-03,-6.45094202e-04, 3.45925498e-03,-5.19531080e-03, 5.98053401e-03,
+    -5.78590296e-03, 4.96034417e-03,-3.63170705e-03, 2.17709597e-03,-7.10478402e-04,-4.95953194e-04,
+     1.42970902e-03,-1.96464406e-03, 2.18945998e-03,-2.09127693e-03, 1.80611003e-03,-1.37142802e-03,
+     9.08861693e-04,-4.54188295e-04, 7.71799605e-05, 2.09218706e-04,-3.93102906e-04, 4.78549802e-04,
+    -4.86788311e-04, 4.40813310e-04,-3.64761887e-04, 2.76212697e-04,-1.90010905e-04, 1.13841699e-04,
+    -5.32595186e-05, 8.47953197e-06, 2.06143504e-05,-3.72977593e-05, 4.37346607e-05,-4.36933988e-05,
+     3.91130998e-05,-3.27909584e-05, 2.56739095e-05,-1.92355801e-05, 1.36057497e-05,-9.32464900e-06,
+     6.04933120e-06,-3.88234093e-06, 2.39240694e-06,-1.53400003e-06, 9.91087518e-07,-6.89252488e-07,
+     5.09455390e-07,-3.25532909e-07, 2.13908507e-07,-4.40216184e-08, 6.58906218e-09, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 8.94112873e-07, 1.28812040e-04, 2.03422084e-03,-5.93883917e-03, 2.81219929e-03,
+     8.11792910e-04,-1.89439021e-03, 1.47167966e-03,-5.96262515e-04,-1.75978988e-04, 6.47639856e-04,
+    -8.11756589e-04, 7.41597963e-04,-5.31310216e-04, 2.66109593e-04,-1.09896064e-05,-1.92619860e-04,
+     3.24222725e-04,-3.80668091e-04, 3.70691414e-04,-3.10647069e-04, 2.19705980e-04,-1.17001124e-04,
+     1.86208636e-05, 6.33029267e-05,-1.21740857e-04, 1.54034002e-04,-1.61723699e-04, 1.48943305e-04,
+    -1.21766003e-04, 8.65100883e-05,-4.93358821e-05, 1.50008127e-05, 1.29559776e-05,-3.28769675e-05,
+     4.42615128e-05,-4.80353192e-05, 4.56043417e-05,-3.90135101e-05, 3.00472020e-05,-2.04711105e-05,
+     1.16466254e-05,-4.37250128e-06,-1.02171907e-06, 4.55751433e-06,-6.46609988e-06, 7.09509914e-06,
+    -6.81565143e-06, 5.97485814e-06,-4.85739110e-06, 3.68112887e-06,-2.59431908e-06, 1.67524922e-06,
+    -9.55580617e-07, 4.36666596e-07,-9.31286195e-08,-1.10429028e-07, 2.11180122e-07,-2.41368980e-07,
+     2.28630597e-07,-1.96068868e-07, 1.54404006e-07,-1.14224008e-07, 7.76334446e-08,-4.78052016e-08,
+     2.71289196e-08,-9.79738957e-09,-4.31100489e-10, 3.72528675e-09,-1.86264515e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 28 */
+  {
+     0.00000000e+00, 7.58616488e-06, 2.08070409e-03, 5.22782095e-02,-4.12536189e-02,-1.02880999e-01,
+     6.87632114e-02,-1.37606803e-02,-1.99402198e-02, 3.10955793e-02,-2.74714995e-02, 1.72411501e-02,
+    -5.67109277e-03,-3.84910707e-03, 1.01953102e-02,-1.29630500e-02, 1.28775202e-02,-1.05662998e-02,
+     7.14222295e-03,-3.24800308e-03,-2.74402788e-04, 3.14860791e-03,-4.97560482e-03, 5.86353289e-03,
+    -5.76728210e-03, 5.02364710e-03,-3.75344791e-03, 2.33112997e-03,-8.72202101e-04,-3.47009889e-04,
+     1.30794302e-03,-1.87813397e-03, 2.14012410e-03,-2.07627611e-03, 1.81906600e-03,-1.40430499e-03,
+     9.53123206e-04,-5.02223615e-04, 1.22784302e-04, 1.70205196e-04,-3.63055704e-04, 4.58078692e-04,
+    -4.75141685e-04, 4.36440809e-04,-3.65783606e-04, 2.80770211e-04,-1.96477005e-04, 1.20936798e-04,
+    -6.00751700e-05, 1.44543901e-05, 1.57569593e-05,-3.36166304e-05, 4.11403416e-05,-4.20181495e-05,
+     3.81575192e-05,-3.23542918e-05, 2.55807809e-05,-1.93460091e-05, 1.38169298e-05,-9.56601798e-06,
+     6.27796180e-06,-4.07840980e-06, 2.54681095e-06,-1.64822404e-06, 1.06872096e-06,-7.37057690e-07,
+     5.36584309e-07,-3.35330299e-07, 2.13477406e-07,-4.02963316e-08, 4.72641704e-09, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 9.97785264e-07, 1.36162853e-04, 2.10129097e-03,-5.77544048e-03, 2.87590176e-03,
+     7.20560551e-04,-1.85986981e-03, 1.49033964e-03,-6.40219077e-04,-1.31251290e-04, 6.16369769e-04,
+    -7.98791181e-04, 7.45479017e-04,-5.47257252e-04, 2.88330019e-04,-3.40901315e-05,-1.72770582e-04,
+     3.10181174e-04,-3.73480842e-04, 3.70126450e-04,-3.15557001e-04, 2.28412915e-04,-1.27658714e-04,
+     2.95042992e-05, 5.35966828e-05,-1.14173163e-04, 1.49096129e-04,-1.59478863e-04, 1.49106592e-04,
+    -1.23823062e-04, 8.98259459e-05,-5.32660633e-05, 1.89761631e-05, 9.38400626e-06,-2.99949897e-05,
+     4.22133598e-05,-4.68277722e-05, 4.51477972e-05,-3.91538924e-05, 3.06038128e-05,-2.12645973e-05,
+     1.25232909e-05,-5.21709444e-06,-2.84897396e-07, 3.96577525e-06,-6.03109947e-06, 6.80539961e-06,
+    -6.65025073e-06, 5.90453965e-06,-4.85648889e-06, 3.72480099e-06,-2.65970084e-06, 1.74844899e-06,
+    -1.02847844e-06, 5.00400347e-07,-1.46790626e-07,-6.85213308e-08, 1.79380550e-07,-2.18017703e-07,
+     2.13435214e-07,-1.84067176e-07, 1.47005039e-07,-1.09376970e-07, 7.55260317e-08,-4.58362024e-08,
+     2.35651783e-08,-7.81611220e-09,-1.99740668e-09, 3.72529030e-09,-1.86264604e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 29 */
+  {
+     0.00000000e+00, 8.58395015e-06, 2.21686694e-03, 5.43795004e-02,-4.70290594e-02,-1.00005098e-01,
+     6.94837719e-02,-1.56205501e-02,-1.84498802e-02, 3.04553602e-02,-2.76027508e-02, 1.78575199e-02,
+    -6.46988396e-03,-3.10362806e-03, 9.64805298e-03,-1.26747200e-02, 1.28434300e-02,-1.07390704e-02,
+     7.45240413e-03,-3.62148392e-03, 9.57236771e-05, 2.83305091e-03,-4.74719191e-03, 5.73587418e-03,
+    -5.73777780e-03, 5.07724378e-03,-3.86762107e-03, 2.48022610e-03,-1.03168096e-03,-1.97903297e-04,
+     1.18411996e-03,-1.78830803e-03, 2.08685803e-03,-2.05729995e-03, 1.82845001e-03,-1.43429998e-03,
+     9.95336566e-04,-5.49051387e-04, 1.67932099e-04, 1.31051303e-04,-3.32451891e-04, 4.36814094e-04,
+    -4.62618395e-04, 4.31223714e-04,-3.66068503e-04, 2.84735986e-04,-2.02508105e-04, 1.27742198e-04,
+    -6.67254208e-05, 2.03589298e-05, 1.09004704e-05,-2.98918294e-05, 3.84806408e-05,-4.02697005e-05,
+     3.71290407e-05,-3.18538914e-05, 2.54339902e-05,-1.94145305e-05, 1.39963104e-05,-9.78403568e-06,
+     6.49139702e-06,-4.26247698e-06, 2.69381599e-06,-1.75760101e-06, 1.14424699e-06,-7.82893892e-07,
+     5.60149488e-07,-3.43146411e-07, 2.11480000e-07,-3.65710413e-08, 2.86377100e-09, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.11173176e-06, 1.43863959e-04, 2.16994062e-03,-5.61150163e-03, 2.93613970e-03,
+     6.29335642e-04,-1.82319060e-03, 1.50676072e-03,-6.82979822e-04,-8.65291804e-05, 5.84220514e-04,
+    -7.84529839e-04, 7.48061109e-04,-5.62201254e-04, 3.09949741e-04,-5.70397824e-05,-1.52669847e-04,
+     2.95614824e-04,-3.65626300e-04, 3.68873996e-04,-3.19860876e-04, 2.36664899e-04,-1.38044357e-04,
+     4.02987935e-05, 4.38182615e-05,-1.06411986e-04, 1.43888872e-04,-1.56934024e-04, 1.48984574e-04,
+    -1.25631923e-04, 9.29550733e-05,-5.70791308e-05, 2.28958670e-05, 5.80702908e-06,-2.70680757e-05,
+     4.00904100e-05,-4.55357367e-05, 4.46048944e-05,-3.92163638e-05, 3.10982869e-05,-2.20134971e-05,
+     1.33700960e-05,-6.04640809e-06, 4.47995262e-07, 3.37051461e-06,-5.58610191e-06, 6.50589936e-06,
+    -6.47277193e-06, 5.82369103e-06,-4.84519660e-06, 3.75887976e-06,-2.71962199e-06, 1.81821088e-06,
+    -1.09829125e-06, 5.64959919e-07,-1.98830094e-07,-2.65899871e-08, 1.47719220e-07,-1.94761014e-07,
+     1.96534984e-07,-1.72718046e-07, 1.39073109e-07,-1.03455022e-07, 7.11829671e-08,-4.32416982e-08,
+     2.18373089e-08,-6.43589715e-09,-1.83689508e-09, 3.72529030e-09,-1.91405958e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 30 */
+  {
+     0.00000000e+00, 9.69568191e-06, 2.36073090e-03, 5.65494411e-02,-5.26405610e-02,-9.70689580e-02,
+     7.01131076e-02,-1.74437407e-02,-1.69431195e-02, 2.97723804e-02,-2.76892800e-02, 1.84417404e-02,
+    -7.25441379e-03,-2.35556695e-03, 9.08585172e-03,-1.23647703e-02, 1.27863903e-02,-1.08917402e-02,
+     7.74801895e-03,-3.98711022e-03, 4.64597688e-04, 2.51319003e-03,-4.51052701e-03, 5.59782982e-03,
+    -5.69747901e-03, 5.12106204e-03,-3.97403305e-03, 2.62411498e-03,-1.18861499e-03,-4.89187296e-05,
+     1.05848804e-03,-1.69535296e-03, 2.02977890e-03,-2.03440408e-03, 1.83425704e-03,-1.46136805e-03,
+     1.03542698e-03,-5.94587123e-04, 2.12536994e-04, 9.18349397e-05,-3.01353604e-04, 4.14800597e-04,
+    -4.49248299e-04, 4.25177306e-04,-3.65620508e-04, 2.88106501e-04,-2.08094207e-04, 1.34248097e-04,
+    -7.31981927e-05, 2.61826208e-05, 6.05527384e-06,-2.61329496e-05, 3.57610188e-05,-3.84514897e-05,
+     3.60307495e-05,-3.12889315e-05, 2.52351601e-05,-1.94411205e-05, 1.41440296e-05,-9.97879670e-06,
+     6.68793200e-06,-4.43519502e-06, 2.83288909e-06,-1.86105603e-06, 1.21542996e-06,-8.26135590e-07,
+     5.81986797e-07,-3.49582308e-07, 2.09643105e-07,-3.28457510e-08, 9.49711421e-10, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.23680820e-06, 1.51930144e-04, 2.24021077e-03,-5.44705987e-03, 2.99299508e-03,
+     5.38215041e-04,-1.78439915e-03, 1.52094942e-03,-7.24500045e-04,-4.18592244e-05, 5.51249832e-04,
+    -7.69001897e-04, 7.49347964e-04,-5.76105900e-04, 3.30970623e-04,-7.98404217e-05,-1.32329762e-04,
+     2.80547887e-04,-3.57116573e-04, 3.66941415e-04,-3.23556131e-04, 2.44448893e-04,-1.48138031e-04,
+     5.09829260e-05, 3.39858234e-05,-9.84719954e-05, 1.38425035e-04,-1.54101057e-04, 1.48575491e-04,
+    -1.27193518e-04, 9.58929304e-05,-6.07660040e-05, 2.67589930e-05, 2.23296229e-06,-2.41009984e-05,
+     3.79009871e-05,-4.41600569e-05, 4.39776195e-05,-3.92016809e-05, 3.15277139e-05,-2.27132114e-05,
+     1.41861965e-05,-6.85901614e-06, 1.17631862e-06, 2.77190702e-06,-5.13248960e-06, 6.19349885e-06,
+    -6.28289854e-06, 5.73277794e-06,-4.82441601e-06, 3.78735967e-06,-2.77400977e-06, 1.88429112e-06,
+    -1.16424781e-06, 6.25252142e-07,-2.50820449e-07, 1.51212589e-08, 1.16050614e-07,-1.71233296e-07,
+     1.79772087e-07,-1.60784111e-07, 1.30105946e-07,-9.73759597e-08, 6.58910722e-08,-4.09897325e-08,
+     1.99746069e-08,-6.13960083e-09,-2.07820960e-09, 3.72529030e-09,-1.43153045e-09, 0.00000000e+00
+  }
+ },
+ { /* phase 31 */
+  {
+     0.00000000e+00, 1.09324901e-05, 2.51266104e-03, 5.87896518e-02,-5.80876209e-02,-9.40759629e-02,
+     7.06513226e-02,-1.92281399e-02,-1.54221701e-02, 2.90478803e-02,-2.77311392e-02, 1.89929903e-02,
+    -8.02341569e-03,-1.60621898e-03, 8.50974582e-03,-1.20337997e-02, 1.27065498e-02,-1.10240700e-02,
+     8.02856684e-03,-4.34422679e-03, 8.31539102e-04, 2.18963390e-03,-4.26607812e-03, 5.44969179e-03,
+    -5.64649608e-03, 5.15504787e-03,-4.07250505e-03, 2.76254001e-03,-1.34271604e-03, 9.96567687e-05,
+     9.31294519e-04,-1.59946003e-03, 1.96901290e-03,-2.00764509e-03, 1.83649000e-03,-1.48546905e-03,
+     1.07332796e-03,-6.38747180e-04, 2.56514613e-04, 5.26332587e-05,-2.69825890e-04, 3.92087386e-04,
+    -4.35062102e-04, 4.18318290e-04,-3.64444189e-04, 2.90878408e-04,-2.13226696e-04, 1.40441596e-04,
+    -7.94810912e-05, 3.19153987e-05, 1.23085795e-06,-2.23455900e-05, 3.29870090e-05,-3.65671985e-05,
+     3.48665017e-05,-3.06636794e-05, 2.49843397e-05,-1.94259992e-05, 1.42600802e-05,-1.01500300e-05,
+     6.86770409e-06,-4.59597914e-06, 2.96299504e-06,-1.95843199e-06, 1.28132103e-06,-8.67125323e-07,
+     6.01961403e-07,-3.55721909e-07, 2.07564895e-07,-2.91204607e-08,-4.81818974e-10, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.37389998e-06, 1.60371885e-04, 2.31211632e-03,-5.28219715e-03, 3.04645300e-03,
+     4.47280705e-04,-1.74356997e-03, 1.53288990e-03,-7.64699653e-04, 2.65985727e-06, 5.17500564e-04,
+    -7.52236694e-04, 7.49341503e-04,-5.88960014e-04, 3.51320021e-04,-1.02419406e-04,-1.11839734e-04,
+     2.65012495e-04,-3.47976107e-04, 3.64332867e-04,-3.26634850e-04, 2.51752324e-04,-1.57922972e-04,
+     6.15390018e-05, 2.41221860e-05,-9.03699547e-05, 1.32713933e-04,-1.50979962e-04, 1.47881321e-04,
+    -1.28505635e-04, 9.86360246e-05,-6.43219100e-05, 3.05541325e-05,-1.33097637e-06,-2.10999278e-05,
+     3.56460223e-05,-4.27046907e-05, 4.32659872e-05,-3.91107387e-05, 3.18935927e-05,-2.33643805e-05,
+     1.49690022e-05,-7.65189179e-06, 1.89707498e-06, 2.17158231e-06,-4.67320206e-06, 5.86990791e-06,
+    -6.08056143e-06, 5.62891000e-06,-4.79546907e-06, 3.80442907e-06,-2.82231849e-06, 1.94619861e-06,
+    -1.22719212e-06, 6.83259714e-07,-3.01519322e-07, 5.60194167e-08, 8.44402166e-08,-1.47169885e-07,
+     1.63060122e-07,-1.49460902e-07, 1.22308847e-07,-9.21309038e-08, 6.23009555e-08,-3.73708531e-08,
+     1.81120186e-08,-4.11640144e-09,-2.86129875e-09, 3.72529030e-09, 1.34761480e-10, 0.00000000e+00
+  }
+ },
+ { /* phase 32 */
+  {
+     0.00000000e+00, 1.23063901e-05, 2.67303293e-03, 6.11017682e-02,-6.33698180e-02,-9.10295099e-02,
+     7.10986033e-02,-2.09717099e-02,-1.38892801e-02, 2.82831807e-02,-2.77284794e-02, 1.95104908e-02,
+    -8.77565239e-03,-8.56877479e-04, 7.92078581e-03,-1.16824796e-02, 1.26041304e-02,-1.11359097e-02,
+     8.29357933e-03,-4.69220290e-03, 1.19587197e-03, 1.86299905e-03,-4.01432579e-03, 5.29176882e-03,
+    -5.58495708e-03, 5.17917005e-03,-4.16287500e-03, 2.89525394e-03,-1.49369601e-03, 2.47538090e-04,
+     8.02788883e-04,-1.50082400e-03, 1.90469099e-03,-1.97709096e-03, 1.83515903e-03,-1.50656898e-03,
+     1.10897399e-03,-6.81451871e-04, 2.99780600e-04, 1.35225200e-05,-2.37932298e-04, 3.68723006e-04,
+    -4.20093100e-04, 4.10666398e-04,-3.62547114e-04, 2.93049990e-04,-2.17899898e-04, 1.46311504e-04,
+    -8.55616527e-05, 3.75443087e-05,-3.56461101e-06,-1.85411609e-05, 3.01646905e-05,-3.46209999e-05,
+     3.36393095e-05,-2.99804196e-05, 2.46828204e-05,-1.93699798e-05, 1.43445204e-05,-1.02971999e-05,
+     7.03076421e-06,-4.74544004e-06, 3.08530389e-06,-2.05056290e-06, 1.34362199e-06,-9.04496176e-07,
+     6.20073422e-07,-3.59838310e-07, 2.04703596e-07,-2.53951704e-08,-3.47057494e-10, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.52402026e-06, 1.69206178e-04, 2.38567218e-03,-5.11696190e-03, 3.09647620e-03,
+     3.56629491e-04,-1.70074031e-03, 1.54259987e-03,-8.03550705e-04, 4.69889492e-05, 4.83049080e-04,
+    -7.34264962e-04, 7.48043472e-04,-6.00737985e-04, 3.70989554e-04,-1.24730170e-04,-9.11904499e-05,
+     2.49034725e-04,-3.38219106e-04, 3.61054088e-04,-3.29096103e-04, 2.58557731e-04,-1.67381018e-04,
+     7.19460659e-05, 1.42441131e-05,-8.21221620e-05, 1.26769068e-04,-1.47579005e-04, 1.46907609e-04,
+    -1.29564665e-04, 1.01177022e-04,-6.77399803e-05, 3.42739513e-05,-4.87698708e-06,-1.80699863e-05,
+     3.33320349e-05,-4.11712099e-05, 4.24745085e-05,-3.89433808e-05, 3.21940024e-05,-2.39676156e-05,
+     1.57192117e-05,-8.42599547e-06, 2.61032255e-06, 1.56971510e-06,-4.20560536e-06, 5.53610153e-06,
+    -5.86823444e-06, 5.51455014e-06,-4.75556226e-06, 3.81718110e-06,-2.86349132e-06, 2.00231079e-06,
+    -1.28876127e-06, 7.42240445e-07,-3.51070412e-07, 9.70503606e-08, 5.22395567e-08,-1.23960490e-07,
+     1.45812919e-07,-1.37310963e-07, 1.13342139e-07,-8.51759978e-08, 5.86270517e-08,-3.43773081e-08,
+     1.63007599e-08,-2.44369858e-09,-2.74259548e-09, 3.72529030e-09, 3.47057494e-10, 0.00000000e+00
+  }
+ },
+ { /* phase 33 */
+  {
+     0.00000000e+00, 1.38304104e-05, 2.84223910e-03, 6.34874403e-02,-6.84867799e-02,-8.79330337e-02,
+     7.14552328e-02,-2.26724502e-02,-1.23466803e-02, 2.74796300e-02,-2.76814904e-02, 1.99935399e-02,
+    -9.50991735e-03,-1.08834000e-04, 7.32004782e-03,-1.13114901e-02, 1.24794003e-02,-1.12271002e-02,
+     8.54261406e-03,-5.03042201e-03, 1.55692606e-03, 1.53390295e-03,-3.75576806e-03, 5.12438780e-03,
+    -5.51301101e-03, 5.19341417e-03,-4.24499717e-03, 3.02202301e-03,-1.64127501e-03, 3.94445698e-04,
+     6.73224218e-04,-1.39964698e-03, 1.83695101e-03,-1.94281701e-03, 1.83028204e-03,-1.52463897e-03,
+     1.14230602e-03,-7.22623081e-04, 3.42255109e-04,-2.54208608e-05,-2.05738295e-04, 3.44755390e-04,
+    -4.04373888e-04, 4.02240403e-04,-3.59936792e-04, 2.94619706e-04,-2.22105504e-04, 1.51847606e-04,
+    -9.14298871e-05, 4.30588589e-05,-8.32017304e-06,-1.47239798e-05, 2.73011992e-05,-3.26186891e-05,
+     3.23505483e-05,-2.92381792e-05, 2.43317500e-05,-1.92729294e-05, 1.43967600e-05,-1.04211604e-05,
+     7.17657713e-06,-4.88275100e-06, 3.19864603e-06,-2.13573890e-06, 1.40224904e-06,-9.38873484e-07,
+     6.36374182e-07,-3.62282009e-07, 2.01961001e-07,-2.16698801e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.68815950e-06, 1.78444898e-04, 2.46089697e-03,-4.95141745e-03, 3.14306468e-03,
+     2.66380608e-04,-1.65601075e-03, 1.55002996e-03,-8.40980560e-04, 9.10405070e-05, 4.47930768e-04,
+    -7.15122558e-04, 7.45463534e-04,-6.11424912e-04, 3.89929861e-04,-1.46769919e-04,-7.04498962e-05,
+     2.32650898e-04,-3.27865127e-04, 3.57114943e-04,-3.30935000e-04, 2.64861155e-04,-1.76494941e-04,
+     8.21840949e-05, 4.36697155e-06,-7.37430528e-05, 1.20599987e-04,-1.43907964e-04, 1.45653874e-04,
+    -1.30371016e-04, 1.03513943e-04,-7.10119493e-05, 3.79120465e-05,-8.39901622e-06,-1.50169944e-05,
+     3.09619354e-05,-3.95645038e-05, 4.16029943e-05,-3.87000728e-05, 3.24298016e-05,-2.45176780e-05,
+     1.64318772e-05,-9.17879515e-06, 3.31489719e-06, 9.68488166e-07,-3.73309013e-06, 5.19408786e-06,
+    -5.64510992e-06, 5.38994209e-06,-4.70588657e-06, 3.82007966e-06,-2.89922900e-06, 2.05377000e-06,
+    -1.34638685e-06, 7.96979293e-07,-4.00559657e-07, 1.37599272e-07, 1.94904715e-08,-1.00719262e-07,
+     1.27533895e-07,-1.24963208e-07, 1.05545041e-07,-8.02911018e-08, 5.44199565e-08,-3.10415658e-08,
+     1.39042413e-08,-1.84670057e-09,-3.22509663e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 34 */
+  {
+     0.00000000e+00, 1.55185699e-05, 3.02068400e-03, 6.59483373e-02,-7.34381974e-02,-8.47899690e-02,
+     7.17216134e-02,-2.43284609e-02,-1.07966503e-02, 2.66386494e-02,-2.75904499e-02, 2.04414707e-02,
+    -1.02250399e-02, 6.36629527e-04, 6.70862291e-03,-1.09215602e-02, 1.23326303e-02,-1.12975501e-02,
+     8.77526496e-03,-5.35828713e-03, 1.91404100e-03, 1.20296795e-03,-3.49090691e-03, 4.94789286e-03,
+    -5.43082692e-03, 5.19778114e-03,-4.31874022e-03, 3.14262300e-03,-1.78518298e-03, 5.40099572e-04,
+     5.42853202e-04,-1.29613304e-03, 1.76593906e-03,-1.90490496e-03, 1.82188302e-03,-1.53965596e-03,
+     1.17326796e-03,-7.62187585e-04, 3.83858103e-04,-6.41209335e-05,-1.73308494e-04, 3.20237712e-04,
+    -3.87942011e-04, 3.93061608e-04,-3.56621895e-04, 2.95588194e-04,-2.25838594e-04, 1.57041693e-04,
+    -9.70749970e-05, 4.84488010e-05,-1.30260596e-05,-1.09039001e-05, 2.44019702e-05,-3.05649191e-05,
+     3.10041614e-05,-2.84411999e-05, 2.39311903e-05,-1.91353301e-05, 1.44162505e-05,-1.05218796e-05,
+     7.30411102e-06,-5.00771421e-06, 3.30419107e-06,-2.21603000e-06, 1.45666900e-06,-9.69915050e-07,
+     6.50278423e-07,-3.64128709e-07, 1.98735904e-07,-1.79445898e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 1.86743091e-06, 1.88104110e-04, 2.53780186e-03,-4.78563458e-03, 3.18618864e-03,
+     1.76608562e-04,-1.60940923e-03, 1.55522302e-03,-8.76950100e-04, 1.34749338e-04, 4.12238762e-04,
+    -6.94850460e-04, 7.41607510e-04,-6.21004961e-04, 4.08129767e-04,-1.68470666e-04,-4.96301800e-05,
+     2.15887092e-04,-3.16936988e-04, 3.52524105e-04,-3.32150958e-04, 2.70645833e-04,-1.85247976e-04,
+     9.22358595e-05,-5.48735261e-06,-6.52507879e-05, 1.14219962e-04,-1.39974989e-04, 1.44125253e-04,
+    -1.30922592e-04, 1.05643994e-04,-7.41370022e-05, 4.14639944e-05,-1.18910102e-05,-1.19480537e-05,
+     2.85430579e-05,-3.78887053e-05, 4.06524050e-05,-3.83823644e-05, 3.26014997e-05,-2.50169251e-05,
+     1.71092106e-05,-9.90860281e-06, 4.00689896e-06, 3.69618647e-07,-3.25561268e-06, 4.84260090e-06,
+    -5.41090412e-06, 5.25395808e-06,-4.64638106e-06, 3.81464906e-06,-2.92914956e-06, 2.10279904e-06,
+    -1.40051088e-06, 8.48980562e-07,-4.46880222e-07, 1.76569301e-07,-1.05301297e-08,-7.69605322e-08,
+     1.10423116e-07,-1.12098860e-07, 9.66299467e-08,-7.36110906e-08, 4.91279479e-08,-2.91236120e-08,
+     1.09577627e-08,-1.48290269e-09,-4.79140283e-09, 3.72528941e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 35 */
+  {
+     0.00000000e+00, 1.73860008e-05, 3.20878811e-03, 6.84861392e-02,-7.82238320e-02,-8.16037804e-02,
+     7.18982220e-02,-2.59378701e-02,-9.24142729e-03, 2.57616993e-02,-2.74557006e-02, 2.08537094e-02,
+    -1.09198904e-02, 1.37823704e-03, 6.08761795e-03,-1.05134305e-02, 1.21641597e-02,-1.13471802e-02,
+     8.99115205e-03,-5.67522412e-03, 2.26656510e-03, 8.70816992e-04,-3.22026107e-03, 4.76264488e-03,
+    -5.33859106e-03, 5.19229379e-03,-4.38399101e-03, 3.25684296e-03,-1.92515797e-03, 6.84224826e-04,
+     4.11930610e-04,-1.19048904e-03, 1.69180206e-03,-1.86344096e-03, 1.80999201e-03,-1.55160401e-03,
+     1.20181101e-03,-8.00076290e-04, 4.24510508e-04,-1.02503298e-04,-1.40706994e-04, 2.95220787e-04,
+    -3.70832800e-04, 3.83153005e-04,-3.52614996e-04, 2.95957812e-04,-2.29094207e-04, 1.61884294e-04,
+    -1.02485901e-04, 5.37027590e-05,-1.76724407e-05,-7.08925108e-06, 2.14728207e-05,-2.84621201e-05,
+     2.96036505e-05,-2.75922193e-05, 2.34843101e-05,-1.89587608e-05, 1.44057203e-05,-1.05988402e-05,
+     7.41453414e-06,-5.11981307e-06, 3.40082102e-06,-2.28964109e-06, 1.50579694e-06,-9.99038662e-07,
+     6.61236186e-07,-3.65611612e-07, 1.93944501e-07,-1.42193004e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.06299956e-06, 1.98195921e-04, 2.61638314e-03,-4.61965054e-03, 3.22584063e-03,
+     8.74176621e-05,-1.56104006e-03, 1.55816041e-03,-9.11409035e-04, 1.78050250e-04, 3.75989825e-04,
+    -6.73479401e-04, 7.36485934e-04,-6.29464164e-04, 4.25530598e-04,-1.89799815e-04,-2.87899747e-05,
+     1.98776834e-04,-3.05453781e-04, 3.47289955e-04,-3.32741067e-04, 2.75908969e-04,-1.93627086e-04,
+     1.02083199e-04,-1.52988359e-05,-5.66639937e-05, 1.07644126e-04,-1.35785085e-04, 1.42323785e-04,
+    -1.31219800e-04, 1.07559026e-04,-7.71040795e-05, 4.49189683e-05,-1.53440051e-05,-8.87096394e-06,
+     2.60799425e-05,-3.61459097e-05, 3.96278047e-05,-3.79905978e-05, 3.27066955e-05,-2.54651823e-05,
+     1.77485927e-05,-1.06159132e-05, 4.68920916e-06,-2.25816621e-07,-2.77359504e-06, 4.48590436e-06,
+    -5.16889850e-06, 5.11104008e-06,-4.58001887e-06, 3.80293000e-06,-2.95247992e-06, 2.14590000e-06,
+    -1.45168997e-06, 9.00259693e-07,-4.93289917e-07, 2.15801265e-07,-4.18604031e-08,-5.21295078e-08,
+     9.21436367e-08,-9.98429641e-08, 8.83499069e-08,-6.73319391e-08, 4.55880809e-08,-2.60473598e-08,
+     1.07961000e-08, 5.65819391e-10,-4.60519800e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 36 */
+  {
+     0.00000000e+00, 1.94490003e-05, 3.40698403e-03, 7.11025223e-02,-8.28434825e-02,-7.83779398e-02,
+     7.19856396e-02,-2.74989102e-02,-7.68326689e-03, 2.48502903e-02,-2.72776503e-02, 2.12296993e-02,
+    -1.15933698e-02, 2.11472297e-03, 5.45815378e-03,-1.00878999e-02, 1.19743599e-02,-1.13759702e-02,
+     9.18992888e-03,-5.98067790e-03, 2.61385506e-03, 5.38075925e-04,-2.94435211e-03, 4.56901779e-03,
+    -5.23650786e-03, 5.17699495e-03,-4.44065500e-03, 3.36448709e-03,-2.06094305e-03, 8.26548610e-04,
+     2.80710810e-04,-1.08293002e-03, 1.61469798e-03,-1.81852200e-03, 1.79464801e-03,-1.56047498e-03,
+     1.22789096e-03,-8.36222200e-04, 4.64138313e-04,-1.40493896e-04,-1.08000298e-04, 2.69755605e-04,
+    -3.53084208e-04, 3.72537092e-04,-3.47925787e-04, 2.95731996e-04,-2.31867802e-04, 1.66370199e-04,
+    -1.07654800e-04, 5.88137991e-05,-2.22524595e-05,-3.28632109e-06, 1.85203407e-05,-2.63162201e-05,
+     2.81519606e-05,-2.66919596e-05, 2.29910202e-05,-1.87429596e-05, 1.43638599e-05,-1.06509697e-05,
+     7.50667778e-06,-5.21965603e-06, 3.48917092e-06,-2.35697303e-06, 1.55138503e-06,-1.02508602e-06,
+     6.72032286e-07,-3.65045793e-07, 1.89339303e-07,-1.04940101e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.27611054e-06, 2.08738958e-04, 2.69667804e-03,-4.45356965e-03, 3.26202810e-03,
+    -1.10268593e-06,-1.51094049e-03, 1.55885471e-03,-9.44320112e-04, 2.20879912e-04, 3.39290127e-04,
+    -6.51050359e-04, 7.30113126e-04,-6.36792742e-04, 4.42128628e-04,-2.10720114e-04,-7.94976950e-06,
+     1.81351788e-04,-2.93443911e-04, 3.41427047e-04,-3.32708121e-04, 2.80635199e-04,-2.01613642e-04,
+     1.11704692e-04,-2.50521116e-05,-4.79919836e-05, 1.00884819e-04,-1.31348846e-04, 1.40255899e-04,
+    -1.31264111e-04, 1.09261018e-04,-7.99099216e-05, 4.82739415e-05,-1.87549740e-05,-5.78898471e-06,
+     2.35730549e-05,-3.43410065e-05, 3.85298918e-05,-3.75257077e-05, 3.27479866e-05,-2.58595101e-05,
+     1.83487136e-05,-1.12960988e-05, 5.35708386e-06,-8.18981789e-07,-2.29029683e-06, 4.11929796e-06,
+    -4.91680112e-06, 4.95588756e-06,-4.50248990e-06, 3.78259415e-06,-2.96954022e-06, 2.18384957e-06,
+    -1.49930020e-06, 9.48530214e-07,-5.38469976e-07, 2.54000042e-07,-7.17800503e-08,-2.87200237e-08,
+     7.50333129e-08,-8.67107701e-08, 7.78691174e-08,-6.15968929e-08, 4.13809857e-08,-2.22279368e-08,
+     8.79879281e-09, 1.94600602e-09,-5.08769915e-09, 3.72529518e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 37 */
+  {
+     0.00000000e+00, 2.17251109e-05, 3.61572299e-03, 7.37992004e-02,-8.72970521e-02,-7.51159117e-02,
+     7.19845369e-02,-2.90098507e-02,-6.12441218e-03, 2.39059702e-02,-2.70567704e-02, 2.15689894e-02,
+    -1.22444201e-02, 2.84483610e-03, 4.82136104e-03,-9.64577124e-03, 1.17636397e-02,-1.13839200e-02,
+     9.37128067e-03,-6.27412181e-03, 2.95528211e-03, 2.05367804e-04,-2.66371691e-03, 4.36740415e-03,
+    -5.12480317e-03, 5.15194284e-03,-4.48864698e-03, 3.46537190e-03,-2.19229190e-03, 9.66804510e-04,
+     1.49446700e-04,-9.73668997e-04, 1.53478805e-03,-1.77024805e-03, 1.77589303e-03,-1.56626396e-03,
+     1.25146401e-03,-8.70563206e-04, 5.02668205e-04,-1.78019603e-04,-7.52523119e-05, 2.43896095e-04,
+    -3.34735494e-04, 3.61240993e-04,-3.42568703e-04, 2.94913014e-04,-2.34158098e-04, 1.70489497e-04,
+    -1.12571601e-04, 6.37696867e-05,-2.67549494e-05, 4.96273003e-07, 1.55508005e-05,-2.41323705e-05,
+     2.66526604e-05,-2.57434294e-05, 2.24525502e-05,-1.84889595e-05, 1.42920799e-05,-1.06796897e-05,
+     7.58171109e-06,-5.30636680e-06, 3.56704004e-06,-2.41856992e-06, 1.59276601e-06,-1.04731396e-06,
+     6.80831079e-07,-3.63099787e-07, 1.84251604e-07,-6.76871492e-09, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     0.00000000e+00, 2.50807898e-06, 2.19745096e-04, 2.77870148e-03,-4.28741425e-03, 3.29472870e-03,
+    -8.88481736e-05,-1.45922974e-03, 1.55731337e-03,-9.75610688e-04, 2.63160095e-04, 3.02160159e-04,
+    -6.27599657e-04, 7.22505851e-04,-6.42979983e-04, 4.57887538e-04,-2.31199898e-04, 1.28298998e-05,
+     1.63646415e-04,-2.80924141e-04, 3.34944809e-04,-3.32054304e-04, 2.84821959e-04,-2.09198333e-04,
+     1.21088233e-04,-3.47257592e-05,-3.92589718e-05, 9.39529855e-05,-1.26678031e-04, 1.37925439e-04,
+    -1.31054956e-04, 1.10746303e-04,-8.25540628e-05, 5.15220454e-05,-2.21140217e-05,-2.70607416e-06,
+     2.10340368e-05,-3.24771972e-05, 3.73629155e-05,-3.69877962e-05, 3.27227717e-05,-2.62011890e-05,
+     1.89093989e-05,-1.19509932e-05, 6.00900967e-06,-1.40670454e-06,-1.80369534e-06, 3.74909723e-06,
+    -4.65659832e-06, 4.79326991e-06,-4.41786142e-06, 3.75602485e-06,-2.98061059e-06, 2.21832124e-06,
+    -1.54397094e-06, 9.96189556e-07,-5.81731001e-07, 2.89599484e-07,-1.02359991e-07,-4.87034413e-09,
+     5.67019924e-08,-7.39141797e-08, 6.97230007e-08,-5.50101049e-08, 3.61409320e-08,-1.86930720e-08,
+     6.98764779e-09, 2.24238761e-09,-6.65400535e-09, 3.72528985e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 38 */
+  {
+     0.00000000e+00, 2.42331898e-05, 3.83546809e-03, 7.65779018e-02,-9.15844664e-02,-7.18211830e-02,
+     7.18956888e-02,-3.04690804e-02,-4.56709880e-03, 2.29303595e-02,-2.67936103e-02, 2.18711495e-02,
+    -1.28720198e-02, 3.56734195e-03, 4.17838106e-03,-9.18788370e-03, 1.15324399e-02,-1.13710901e-02,
+     9.53492709e-03,-6.55504595e-03, 3.29022692e-03,-1.26686500e-04,-2.37889495e-03, 4.15820582e-03,
+    -5.00371493e-03, 5.11721708e-03,-4.52790596e-03, 3.55932489e-03,-2.31896993e-03, 1.10472995e-03,
+     1.83917491e-05,-8.62922694e-04, 1.45223399e-03,-1.71872601e-03, 1.75377901e-03,-1.56897004e-03,
+     1.27249805e-03,-9.03040404e-04, 5.40031120e-04,-2.15007400e-04,-4.25295402e-05, 2.17694906e-04,
+    -3.15826095e-04, 3.49290000e-04,-3.36559693e-04, 2.93506309e-04,-2.35961794e-04, 1.74238594e-04,
+    -1.17228199e-04, 6.85629566e-05,-3.11728108e-05, 4.25229791e-06, 1.25701899e-05,-2.19140493e-05,
+     2.51086894e-05,-2.47472399e-05, 2.18708192e-05,-1.81993601e-05, 1.41897199e-05,-1.06845600e-05,
+     7.63841308e-06,-5.38028098e-06, 3.63676304e-06,-2.47358003e-06, 1.62890694e-06,-1.06600703e-06,
+     6.87818726e-07,-3.60857399e-07, 1.77597599e-07,-3.04342507e-09, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     4.87574521e-12, 2.76030005e-06, 2.31232028e-04, 2.86243111e-03,-4.12130356e-03, 3.32397223e-03,
+    -1.75751746e-04,-1.40593015e-03, 1.55354873e-03,-1.00526959e-03, 3.04831192e-04, 2.64709815e-04,
+    -6.03190623e-04, 7.13675981e-04,-6.48017973e-04, 4.72780317e-04,-2.51210295e-04, 3.35304067e-05,
+     1.45692378e-04,-2.67921947e-04, 3.27861169e-04,-3.30782001e-04, 2.88459938e-04,-2.16363929e-04,
+     1.30210072e-04,-4.43062745e-05,-3.04789282e-05, 8.68660863e-05,-1.21779041e-04, 1.35338050e-04,
+    -1.30595043e-04, 1.12011388e-04,-8.50260258e-05, 5.46589727e-05,-2.54160259e-05, 3.64030711e-07,
+     1.84659148e-05,-3.05579742e-05, 3.61267594e-05,-3.63822910e-05, 3.26344925e-05,-2.64882110e-05,
+     1.94293971e-05,-1.25785882e-05, 6.64679101e-06,-1.98671478e-06,-1.31790875e-06, 3.37310485e-06,
+    -4.38930147e-06, 4.62110620e-06,-4.32366869e-06, 3.72030536e-06,-2.98451232e-06, 2.24808900e-06,
+    -1.58488001e-06, 1.03977072e-06,-6.23129381e-07, 3.26559530e-07,-1.32129571e-07, 1.73004082e-08,
+     4.00741555e-08,-6.16851139e-08, 5.91919616e-08,-4.85169949e-08, 3.20670779e-08,-1.62330025e-08,
+     4.64234517e-09, 4.29110969e-09,-6.51930065e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 39 */
+  {
+     4.87574521e-12, 2.69934899e-05, 4.06670012e-03, 7.94403329e-02,-9.57057700e-02,-6.84972107e-02,
+     7.17199370e-02,-3.18750106e-02,-3.01355007e-03, 2.19250899e-02,-2.64887791e-02, 2.21358594e-02,
+    -1.34752104e-02, 4.28101793e-03, 3.53036309e-03,-8.71510338e-03, 1.12812296e-02,-1.13375597e-02,
+     9.68061946e-03,-6.82296790e-03, 3.61808809e-03,-4.57468501e-04,-2.09043501e-03, 3.94184189e-03,
+    -4.87350486e-03, 5.07291080e-03,-4.55838488e-03, 3.64619098e-03,-2.44074897e-03, 1.24006800e-03,
+    -1.12203299e-04,-7.50911306e-04, 1.36720797e-03,-1.66406704e-03, 1.72836299e-03,-1.56860601e-03,
+     1.29096396e-03,-9.33598378e-04, 5.76157880e-04,-2.51389691e-04,-9.89504679e-06, 1.91206695e-04,
+    -2.96396698e-04, 3.36711411e-04,-3.29912902e-04, 2.91519595e-04,-2.37279703e-04, 1.77611699e-04,
+    -1.21617501e-04, 7.31840628e-05,-3.54964795e-05, 7.97260327e-06, 9.58567762e-06,-1.96659603e-05,
+     2.35238094e-05,-2.37074692e-05, 2.12476898e-05,-1.78728005e-05, 1.40575903e-05,-1.06672596e-05,
+     7.67848724e-06,-5.44196610e-06, 3.69595500e-06,-2.52209702e-06, 1.66097402e-06,-1.08224003e-06,
+     6.92461072e-07,-3.56566289e-07, 1.71078298e-07, 6.81865175e-10, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     8.32356406e-12, 3.03423985e-06, 2.43215822e-04, 2.94791907e-03,-3.95525247e-03, 3.34972143e-03,
+    -2.61686742e-04,-1.35117024e-03, 1.54758105e-03,-1.03325956e-03, 3.45848501e-04, 2.26950273e-04,
+    -5.77829778e-04, 7.03645870e-04,-6.51904149e-04, 4.86785546e-04,-2.70689838e-04, 5.40995970e-05,
+     1.27523206e-04,-2.54465267e-04, 3.20186839e-04,-3.28894181e-04, 2.91547040e-04,-2.23099953e-04,
+     1.39061827e-04,-5.37708402e-05,-2.16700137e-05, 7.96350650e-05,-1.16663054e-04, 1.32499030e-04,
+    -1.29883803e-04, 1.13054703e-04,-8.73239478e-05, 5.76740131e-05,-2.86579598e-05, 3.42400745e-06,
+     1.58720650e-05,-2.85884016e-05, 3.48272151e-05,-3.57082172e-05, 3.24828980e-05,-2.67221913e-05,
+     1.99090864e-05,-1.31775159e-05, 7.26661528e-06,-2.55950727e-06,-8.32398655e-07, 2.99190287e-06,
+    -4.11420478e-06, 4.44056059e-06,-4.22252924e-06, 3.67726716e-06,-2.98302348e-06, 2.27106102e-06,
+    -1.62178912e-06, 1.08057975e-06,-6.62630555e-07, 3.61869752e-07,-1.61709977e-07, 4.01296347e-08,
+     2.33349056e-08,-4.82859832e-08, 5.15790362e-08,-4.17560386e-08, 2.67759788e-08,-1.39820031e-08,
+     1.21343646e-09, 5.67129632e-09,-6.51920118e-09, 3.72529074e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 40 */
+  {
+     1.31993097e-11, 3.00277297e-05, 4.30991594e-03, 8.23882520e-02,-9.96610224e-02,-6.51474893e-02,
+     7.14582503e-02,-3.32261808e-02,-1.46596902e-03, 2.08918303e-02,-2.61429306e-02, 2.23628096e-02,
+    -1.40530402e-02, 4.98466380e-03, 2.87845894e-03,-8.22831783e-03, 1.10105397e-02,-1.12834601e-02,
+     9.80814267e-03,-7.07743317e-03, 3.93827492e-03,-7.86362682e-04,-1.79888797e-03, 3.71874194e-03,
+    -4.73444303e-03, 5.01913996e-03,-4.58005490e-03, 3.72582604e-03,-2.55741202e-03, 1.37256703e-03,
+    -2.42087102e-04,-6.37856603e-04, 1.27988402e-03,-1.60639302e-03, 1.69970503e-03,-1.56518200e-03,
+     1.30683603e-03,-9.62186779e-04, 6.10985095e-04,-2.87097908e-04, 2.25878503e-05, 1.64484503e-04,
+    -2.76487612e-04, 3.23533895e-04,-3.22646287e-04, 2.88960087e-04,-2.38112101e-04, 1.80603602e-04,
+    -1.25731705e-04, 7.76246234e-05,-3.97190088e-05, 1.16498704e-05, 6.60265414e-06,-1.73948993e-05,
+     2.19020203e-05,-2.26268894e-05, 2.05850592e-05,-1.75109308e-05, 1.38958803e-05,-1.06271300e-05,
+     7.70182214e-06,-5.49025208e-06, 3.74753404e-06,-2.56385306e-06, 1.68775000e-06,-1.09622204e-06,
+     6.93674508e-07,-3.50894993e-07, 1.64559097e-07, 4.40715597e-09, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.35177997e-11, 3.33147000e-06, 2.55713239e-04, 3.03513557e-03,-3.78938019e-03, 3.37199867e-03,
+    -3.46601009e-04,-1.29497796e-03, 1.53942476e-03,-1.05952099e-03, 3.86120752e-04, 1.88980252e-04,
+    -5.51610254e-04, 6.92437403e-04,-6.54630829e-04, 4.99879941e-04,-2.89630145e-04, 7.45197758e-05,
+     1.09174289e-04,-2.40575988e-04, 3.11940908e-04,-3.26396315e-04, 2.94075930e-04,-2.29395926e-04,
+     1.47620216e-04,-6.31017610e-05,-1.28461979e-05, 7.22759869e-05,-1.11340079e-04, 1.29416934e-04,
+    -1.28926404e-04, 1.13876595e-04,-8.94439872e-05, 6.05679816e-05,-3.18270177e-05, 6.46302942e-06,
+     1.32599380e-05,-2.65705748e-05, 3.34635843e-05,-3.49657785e-05, 3.22679080e-05,-2.69025040e-05,
+     2.03447125e-05,-1.37456809e-05, 7.86987948e-06,-3.12487828e-06,-3.47004971e-07, 2.60770321e-06,
+    -3.83189763e-06, 4.25375765e-06,-4.11233123e-06, 3.62673018e-06,-2.97541010e-06, 2.29013949e-06,
+    -1.65443998e-06, 1.12079942e-06,-7.00520104e-07, 3.96870746e-07,-1.90590072e-07, 6.40502549e-08,
+     6.38192432e-09,-3.49718903e-08, 4.21309778e-08,-3.44539330e-08, 2.32370212e-08,-1.03619868e-08,
+    -5.40183009e-10, 6.01897909e-09,-6.46789999e-09, 3.72528985e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 41 */
+  {
+     2.67171094e-11, 3.33591997e-05, 4.56562918e-03, 8.54233876e-02,-1.03450403e-01,-6.17754906e-02,
+     7.11116493e-02,-3.45211588e-02, 7.34556816e-05, 1.98323093e-02,-2.57568099e-02, 2.25517899e-02,
+    -1.46046504e-02, 5.67710120e-03, 2.22382811e-03,-7.72843789e-03, 1.07209096e-02,-1.12089403e-02,
+     9.91731696e-03,-7.31800916e-03, 4.25021583e-03,-1.11275900e-03,-1.50481204e-03, 3.48934601e-03,
+    -4.58682282e-03, 4.95603820e-03,-4.59290110e-03, 3.79810203e-03,-2.66875210e-03, 1.50198396e-03,
+    -3.71013506e-04,-5.23980008e-04, 1.19044003e-03,-1.54582504e-03, 1.66787801e-03,-1.55871897e-03,
+     1.32009597e-03,-9.88757354e-04, 6.44448679e-04,-3.22063686e-04, 5.48557582e-05, 1.37581999e-04,
+    -2.56142899e-04, 3.09788215e-04,-3.14776407e-04, 2.85835209e-04,-2.38459106e-04, 1.83211305e-04,
+    -1.29563603e-04, 8.18783810e-05,-4.38313400e-05, 1.52766006e-05, 3.62724404e-06,-1.51047598e-05,
+     2.02475803e-05,-2.15060900e-05, 1.98845391e-05,-1.71140600e-05, 1.37052903e-05,-1.05630797e-05,
+     7.70820407e-06,-5.52522397e-06, 3.78966502e-06,-2.59830699e-06, 1.71098702e-06,-1.10658402e-06,
+     6.93134325e-07,-3.44876014e-07, 1.58091197e-07, 8.13244583e-09, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     2.15569906e-11, 3.65366941e-06, 2.68738717e-04, 3.12413275e-03,-3.62369418e-03, 3.39081138e-03,
+    -4.30382788e-04,-1.23745948e-03, 1.52910524e-03,-1.08403899e-03, 4.25599515e-04, 1.50840729e-04,
+    -5.24549745e-04, 6.80070836e-04,-6.56200107e-04, 5.12043014e-04,-3.07989307e-04, 9.47406515e-05,
+     9.06828791e-05,-2.26280652e-04, 3.03138979e-04,-3.23296990e-04, 2.96045095e-04,-2.35239975e-04,
+     1.55872665e-04,-7.22859986e-05,-4.02890146e-06, 6.48039859e-05,-1.05823856e-04, 1.26095023e-04,
+    -1.27723586e-04, 1.14475697e-04,-9.13830008e-05, 6.33310992e-05,-3.49220354e-05, 9.47597437e-06,
+     1.06319785e-05,-2.45106639e-05, 3.20415129e-05,-3.41598061e-05, 3.19900282e-05,-2.70273958e-05,
+     2.07389967e-05,-1.42841018e-05, 8.45140312e-06,-3.67942266e-06, 1.34401489e-07, 2.22100061e-06,
+    -3.54419171e-06, 4.05833998e-06,-3.99451892e-06, 3.56923010e-06,-2.96120243e-06, 2.30338992e-06,
+    -1.68422048e-06, 1.15697003e-06,-7.37318260e-07, 4.29890861e-07,-2.18779860e-07, 8.62701199e-08,
+    -1.16478986e-08,-2.32748789e-08, 3.28179794e-08,-2.80010681e-08, 1.90290166e-08,-7.39498773e-09,
+    -2.16152785e-09, 7.53391305e-09,-6.95030167e-09, 3.72529385e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 42 */
+  {
+     4.82741000e-11, 3.70128691e-05, 4.83436789e-03, 8.85475203e-02,-1.07074097e-01,-5.83846793e-02,
+     7.06812665e-02,-3.57586183e-02, 1.60256098e-03, 1.87482703e-02,-2.53312103e-02, 2.27026306e-02,
+    -1.51292002e-02, 6.35717204e-03, 1.56762800e-03,-7.21639488e-03, 1.04129203e-02,-1.11141996e-02,
+     1.00079998e-02,-7.54428981e-03, 4.55335481e-03,-1.43605599e-03,-1.20876695e-03, 3.25410604e-03,
+    -4.43095015e-03, 4.88375220e-03,-4.59693000e-03, 3.86290601e-03,-2.77457596e-03, 1.62807899e-03,
+    -4.98737092e-04,-4.09504311e-04, 1.09905703e-03,-1.48249394e-03, 1.63295597e-03,-1.54924300e-03,
+     1.33072794e-03,-1.01326802e-03, 6.76490192e-04,-3.56223492e-04, 8.68457864e-05, 1.10554603e-04,
+    -2.35403902e-04, 2.95504113e-04,-3.06325004e-04, 2.82155786e-04,-2.38324705e-04, 1.85432305e-04,
+    -1.33107795e-04, 8.59367210e-05,-4.78258589e-05, 1.88458307e-05, 6.66041615e-07,-1.28013698e-05,
+     1.85633598e-05,-2.03491199e-05, 1.91472209e-05,-1.66841692e-05, 1.34865104e-05,-1.04768096e-05,
+     7.69655617e-06,-5.54849885e-06, 3.82248300e-06,-2.62630806e-06, 1.73001604e-06,-1.11397901e-06,
+     6.90972797e-07,-3.37342101e-07, 1.51140895e-07, 1.18577397e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     3.39668987e-11, 4.00255158e-06, 2.82310881e-04, 3.21488082e-03,-3.45830619e-03, 3.40615958e-03,
+    -5.12950122e-04,-1.17871165e-03, 1.51663995e-03,-1.10680051e-03, 4.64230776e-04, 1.12619251e-04,
+    -4.96699475e-04, 6.66575972e-04,-6.56612625e-04, 5.23255672e-04,-3.25740315e-04, 1.14729628e-04,
+     7.20703974e-05,-2.11613253e-04, 2.93798279e-04,-3.19603016e-04, 2.97451974e-04,-2.40623951e-04,
+     1.63806137e-04,-8.13039951e-05, 4.77116555e-06, 5.72300050e-05,-1.00122066e-04, 1.22544006e-04,
+    -1.26278785e-04, 1.14850118e-04,-9.31370305e-05, 6.59609213e-05,-3.79380072e-05, 1.24579528e-05,
+     7.99505506e-06,-2.24129763e-05, 3.05643189e-05,-3.32897180e-05, 3.16508158e-05,-2.70991441e-05,
+     2.10901053e-05,-1.47911196e-05, 9.01339808e-06,-4.22479934e-06, 6.12606527e-07, 1.83159136e-06,
+    -3.25270230e-06, 3.85657768e-06,-3.86896136e-06, 3.50578011e-06,-2.94235770e-06, 2.31208014e-06,
+    -1.71019019e-06, 1.18989919e-06,-7.72250132e-07, 4.60939191e-07,-2.44880539e-07, 1.08670065e-07,
+    -2.99105523e-08,-9.80116965e-09, 2.35049811e-08,-2.14829470e-08, 1.37889629e-08,-3.84295618e-09,
+    -3.24098437e-09, 7.83029463e-09,-8.51669313e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 43 */
+  {
+     8.22409987e-11, 4.10154207e-05, 5.11667877e-03, 9.17624012e-02,-1.10532403e-01,-5.49785197e-02,
+     7.01683164e-02,-3.69373299e-02, 3.11920093e-03, 1.76414698e-02,-2.48669796e-02, 2.28152499e-02,
+    -1.56258997e-02, 7.02374801e-03, 9.11015377e-04,-6.69313921e-03, 1.00871800e-02,-1.09994700e-02,
+     1.00800702e-02,-7.75590306e-03, 4.84715309e-03,-1.75565900e-03,-9.11314972e-04, 3.01348208e-03,
+    -4.26714402e-03, 4.80244821e-03,-4.59215883e-03, 3.92013602e-03,-2.87469802e-03, 1.75062299e-03,
+    -6.25015877e-04,-2.94654194e-04, 1.00592000e-03,-1.41653302e-03, 1.59501797e-03,-1.53678504e-03,
+     1.33872300e-03,-1.03568099e-03, 7.07054511e-04,-3.89513210e-04, 1.18496602e-04, 8.34554594e-05,
+    -2.14313797e-04, 2.80712993e-04,-2.97311606e-04, 2.77930987e-04,-2.37712098e-04, 1.87263897e-04,
+    -1.36360497e-04, 8.97932987e-05,-5.16948203e-05, 2.23516108e-05,-2.27631608e-06,-1.04892897e-05,
+     1.68531697e-05,-1.91592208e-05, 1.83749708e-05,-1.62232300e-05, 1.32416299e-05,-1.03681396e-05,
+     7.66664562e-06,-5.55830002e-06, 3.84598798e-06,-2.64779101e-06, 1.74380500e-06,-1.11782197e-06,
+     6.87731813e-07,-3.29511806e-07, 1.42624202e-07, 1.55830300e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     5.27930963e-11, 4.37998096e-06, 2.96447426e-04, 3.30740213e-03,-3.29329818e-03, 3.41808051e-03,
+    -5.94213605e-04,-1.11879036e-03, 1.50206592e-03,-1.12772919e-03, 5.01949340e-04, 7.43605196e-05,
+    -4.68099490e-04, 6.51973765e-04,-6.55869080e-04, 5.33502083e-04,-3.42855230e-04, 1.34450383e-04,
+     5.33899292e-05,-1.96594279e-04, 2.83937901e-04,-3.15322075e-04, 2.98297266e-04,-2.45535979e-04,
+     1.71403866e-04,-9.01380554e-05, 1.35330483e-05, 4.95738350e-05,-9.42489132e-05, 1.18769007e-04,
+    -1.24595826e-04, 1.15002593e-04,-9.47053195e-05, 6.84519764e-05,-4.08670167e-05, 1.54030276e-05,
+     5.35405707e-06,-2.02810625e-05, 2.90332828e-05,-3.23592976e-05, 3.12503907e-05,-2.71165809e-05,
+     2.13956955e-05,-1.52651046e-05, 9.55411815e-06,-4.75757406e-06, 1.08810491e-06, 1.44180376e-06,
+    -2.95460632e-06, 3.64662992e-06,-3.73752846e-06, 3.43528882e-06,-2.91568085e-06, 2.31777449e-06,
+    -1.73244007e-06, 1.22062011e-06,-8.04760930e-07, 4.91139872e-07,-2.72009856e-07, 1.30589797e-07,
+    -4.65906851e-08, 1.60298441e-09, 1.41922101e-08,-1.49889274e-08, 9.71601821e-09,-8.50036486e-10,
+    -5.17110266e-09, 9.87910198e-09,-8.38190317e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 44 */
+  {
+     1.35034095e-10, 4.53954017e-05, 5.41312620e-03, 9.50698033e-02,-1.13825701e-01,-5.15604392e-02,
+     6.95741028e-02,-3.80561203e-02, 4.62126685e-03, 1.65137406e-02,-2.43650302e-02, 2.28896104e-02,
+    -1.60939991e-02, 7.67572178e-03, 2.55146297e-04,-6.15963712e-03, 9.74432472e-03,-1.08650196e-02,
+     1.01334602e-02,-7.95249734e-03, 5.13109099e-03,-2.07098108e-03,-6.13017706e-04, 2.76794611e-03,
+    -4.09574015e-03, 4.71231015e-03,-4.57862578e-03, 3.96970985e-03,-2.96894694e-03, 1.86939200e-03,
+    -7.49611703e-04,-1.79651601e-04, 9.11214680e-04,-1.34808104e-03, 1.55415095e-03,-1.52138202e-03,
+     1.34407706e-03,-1.05596206e-03, 7.36087793e-04,-4.21872508e-04, 1.49746993e-04, 5.63388785e-05,
+    -1.92918102e-04, 2.65447889e-04,-2.87757488e-04, 2.73173413e-04,-2.36623993e-04, 1.88705701e-04,
+    -1.39315103e-04, 9.34399286e-05,-5.54323487e-05, 2.57868996e-05,-5.19199693e-06,-8.17151522e-06,
+     1.51207296e-05,-1.79386006e-05, 1.75702098e-05,-1.57320901e-05, 1.29696200e-05,-1.02375498e-05,
+     7.62005493e-06,-5.55669703e-06, 3.86018019e-06,-2.66277993e-06, 1.75352102e-06,-1.11867200e-06,
+     6.82560710e-07,-3.19632704e-07, 1.34242299e-07, 1.93083203e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     8.07055117e-11, 4.78790753e-06, 3.11163720e-04, 3.40169668e-03,-3.12869996e-03, 3.42655927e-03,
+    -6.74106181e-04,-1.05778873e-03, 1.48540596e-03,-1.14686042e-03, 5.38699329e-04, 3.61297280e-05,
+    -4.38831747e-04, 6.36294950e-04,-6.53976400e-04, 5.42764086e-04,-3.59293073e-04, 1.53869390e-04,
+     3.46601009e-05,-1.81256793e-04, 2.73580197e-04,-3.10462900e-04, 2.98579514e-04,-2.49968143e-04,
+     1.78653281e-04,-9.87742096e-05, 2.22385861e-05, 4.18461859e-05,-8.82141758e-05, 1.14777940e-04,
+    -1.22679223e-04, 1.14932052e-04,-9.60837933e-05, 7.08000734e-05,-4.37049894e-05, 1.83059601e-05,
+     2.71596946e-06,-1.81189971e-05, 2.74517224e-05,-3.13690980e-05, 3.07906012e-05,-2.70794189e-05,
+     2.16561020e-05,-1.57050963e-05, 1.00743782e-05,-5.27652446e-06, 1.55789894e-06, 1.05050276e-06,
+    -2.65339622e-06, 3.43238935e-06,-3.59903061e-06, 3.35833101e-06,-2.88442880e-06, 2.31647437e-06,
+    -1.75099922e-06, 1.24796134e-06,-8.34630555e-07, 5.22129994e-07,-2.98639861e-07, 1.50949745e-07,
+    -6.28729140e-08, 1.47770152e-08, 4.87762009e-09,-8.17703949e-09, 4.44993020e-09, 2.45995579e-09,
+    -7.03369096e-09, 1.13106182e-08,-8.38190317e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 45 */
+  {
+     2.15739607e-10, 5.01833092e-05, 5.72428992e-03, 9.84715000e-02,-1.16954401e-01,-4.81338799e-02,
+     6.88999966e-02,-3.91139090e-02, 6.10667281e-03, 1.53668802e-02,-2.38263309e-02, 2.29257401e-02,
+    -1.65328309e-02, 8.31201673e-03,-3.98830103e-04,-5.61687304e-03, 9.38503165e-03,-1.07111502e-02,
+     1.01681203e-02,-8.13375413e-03, 5.40467119e-03,-2.38144398e-03,-3.14438192e-04, 2.51797796e-03,
+    -3.91708687e-03, 4.61353594e-03,-4.55638720e-03, 4.01155604e-03,-3.05716111e-03, 1.98416994e-03,
+    -8.72290926e-04,-6.47195484e-05, 8.15130887e-04,-1.27728097e-03, 1.51044596e-03,-1.50307606e-03,
+     1.34679303e-03,-1.07408105e-03, 7.63539516e-04,-4.53241606e-04, 1.80537594e-04, 2.92594596e-05,
+    -1.71262000e-04, 2.49742792e-04,-2.77683110e-04, 2.67896889e-04,-2.35066094e-04, 1.89756203e-04,
+    -1.41968500e-04, 9.68723180e-05,-5.90313794e-05, 2.91452307e-05,-8.07642573e-06,-5.85504085e-06,
+     1.33697304e-05,-1.66906393e-05, 1.67355793e-05,-1.52099601e-05, 1.26709801e-05,-1.00866000e-05,
+     7.55718202e-06,-5.54192002e-06, 3.86505781e-06,-2.67095697e-06, 1.75797095e-06,-1.11621205e-06,
+     6.75527019e-07,-3.08322086e-07, 1.25860396e-07, 2.30336106e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.21116686e-10, 5.22840128e-06, 3.26481182e-04, 3.49780172e-03,-2.96460092e-03, 3.43161821e-03,
+    -7.52538443e-04,-9.95792449e-04, 1.46670034e-03,-1.16412062e-03, 5.74441627e-04,-2.02096999e-06,
+    -4.08919528e-04, 6.19570725e-04,-6.50940870e-04, 5.51030971e-04,-3.75035219e-04, 1.72940083e-04,
+     1.59200281e-05,-1.65630132e-04, 2.62740999e-04,-3.05039110e-04, 2.98299623e-04,-2.53919046e-04,
+     1.85543904e-04,-1.07194763e-04, 3.08752060e-05, 3.40659171e-05,-8.20299610e-05, 1.10581052e-04,
+    -1.20532932e-04, 1.14639712e-04,-9.72704729e-05, 7.30030006e-05,-4.64449404e-05, 2.11599981e-05,
+     8.19563866e-08,-1.59309711e-05, 2.58244690e-05,-3.03226989e-05, 3.02720000e-05,-2.69895245e-05,
+     2.18744972e-05,-1.61129865e-05, 1.05686195e-05,-5.78179606e-06, 2.02159572e-06, 6.59696525e-07,
+    -2.34799518e-06, 3.21138214e-06,-3.45428998e-06, 3.27318048e-06,-2.84728412e-06, 2.31182275e-06,
+    -1.76557023e-06, 1.27308886e-06,-8.64380127e-07, 5.49360266e-07,-3.23209861e-07, 1.71428837e-07,
+    -7.81210474e-08, 2.78669177e-08,-4.45970727e-09,-1.38311407e-09, 6.70070222e-10, 4.62000571e-09,
+    -8.92214302e-09, 1.11758993e-08,-8.38189607e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 46 */
+  {
+     3.36856293e-10, 5.54117105e-05, 6.05077110e-03, 1.01969302e-01,-1.19919002e-01,-4.47022617e-02,
+     6.81474581e-02,-4.01097015e-02, 7.57337315e-03, 1.42027596e-02,-2.32518893e-02, 2.29237191e-02,
+    -1.69417504e-02, 8.93158745e-03,-1.04977097e-03,-5.06584207e-03, 9.00999643e-03,-1.05382102e-02,
+     1.01840403e-02,-8.29938427e-03, 5.66741219e-03,-2.68648309e-03,-1.61385597e-05, 2.26405892e-03,
+    -3.73154297e-03, 4.50634118e-03,-4.52551199e-03, 4.04562196e-03,-3.13919107e-03, 2.09475099e-03,
+    -9.92823858e-04, 4.99201597e-05, 7.17860414e-04,-1.20427797e-03, 1.46400102e-03,-1.48191606e-03,
+     1.34687498e-03,-1.09001203e-03, 7.89363985e-04,-4.83564305e-04, 2.10809594e-04, 2.26993507e-06,
+    -1.49387502e-04, 2.33629806e-04,-2.67114490e-04, 2.62115092e-04,-2.33044499e-04, 1.90415900e-04,
+    -1.44316495e-04, 1.00083700e-04,-6.24856693e-05, 3.24184111e-05,-1.09237099e-05,-3.54321810e-06,
+     1.16041601e-05,-1.54175505e-05, 1.58711991e-05,-1.46605998e-05, 1.23477703e-05,-9.91517118e-06,
+     7.47906097e-06,-5.51405310e-06, 3.86059810e-06,-2.67234009e-06, 1.75864102e-06,-1.11159204e-06,
+     6.66604876e-07,-2.97146187e-07, 1.17478500e-07, 2.67589009e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.78313891e-10, 5.70359771e-06, 3.42414714e-04, 3.59569490e-03,-2.80109793e-03, 3.43330204e-03,
+    -8.29406083e-04,-9.32879746e-04, 1.44597841e-03,-1.17952004e-03, 6.09088689e-04,-3.99891287e-05,
+    -3.78418714e-04, 6.01833686e-04,-6.46771048e-04, 5.58291096e-04,-3.90053727e-04, 1.91650353e-04,
+    -2.77999789e-06,-1.49739906e-04, 2.51446851e-04,-2.99058855e-04, 2.97459570e-04,-2.57377978e-04,
+     1.92061067e-04,-1.15387142e-04, 3.94261442e-05, 2.62442045e-05,-7.57100061e-05, 1.06187072e-04,
+    -1.18163181e-04, 1.14126640e-04,-9.82651254e-05, 7.50540057e-05,-4.90830280e-05, 2.39600195e-05,
+    -2.53994949e-06,-1.37229217e-05, 2.41557136e-05,-2.92220211e-05, 2.96973012e-05,-2.68473159e-05,
+     2.20469083e-05,-1.64859084e-05, 1.10391993e-05,-6.27269037e-06, 2.47769640e-06, 2.70694727e-07,
+    -2.03990203e-06, 2.98640225e-06,-3.30212788e-06, 3.18373714e-06,-2.80370023e-06, 2.30242904e-06,
+    -1.77583024e-06, 1.29485034e-06,-8.89928742e-07, 5.75359991e-07,-3.46390152e-07, 1.91975232e-07,
+    -9.45879037e-08, 4.04229468e-08,-1.35592018e-08, 3.77008291e-09,-4.34704361e-09, 8.58199201e-09,
+    -1.05433742e-08, 1.11758993e-08,-8.38190317e-09, 3.72529030e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 47 */
+  {
+     5.15170184e-10, 6.11153082e-05, 6.39318582e-03, 1.05564997e-01,-1.22720100e-01,-4.12689596e-02,
+     6.73180521e-02,-4.10425812e-02, 9.01935156e-03, 1.30232396e-02,-2.26428006e-02, 2.28837300e-02,
+    -1.73201691e-02, 9.53342114e-03,-1.69654202e-03,-4.50755097e-03, 8.61994270e-03,-1.03465598e-02,
+     1.01812603e-02,-8.44912417e-03, 5.91885904e-03,-2.98554194e-03, 2.81321001e-04, 2.00668094e-03,
+    -3.53948190e-03, 4.39095404e-03,-4.48608585e-03, 4.07186616e-03,-3.21490108e-03, 2.20093806e-03,
+    -1.11098704e-03, 1.64046796e-04, 6.19595288e-04,-1.12922397e-03, 1.41491799e-03,-1.45795604e-03,
+     1.34433503e-03,-1.10373495e-03, 8.13519699e-04,-5.12786326e-04, 2.40506895e-04,-2.45773808e-05,
+    -1.27340594e-04, 2.17143897e-04,-2.56075291e-04, 2.55842402e-04,-2.30566802e-04, 1.90686595e-04,
+    -1.46356397e-04, 1.03070102e-04,-6.57877972e-05, 3.56021483e-05,-1.37274101e-05,-1.24078895e-06,
+     9.82832989e-06,-1.41227001e-05, 1.49812704e-05,-1.40852399e-05, 1.20013801e-05,-9.72319594e-06,
+     7.38447307e-06,-5.47363015e-06, 3.84703890e-06,-2.66857000e-06, 1.75429398e-06,-1.10301005e-06,
+     6.56061502e-07,-2.85970287e-07, 1.09096597e-07, 3.04841912e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     2.57606436e-10, 6.21582876e-06, 3.58985271e-04, 3.69530171e-03,-2.63830274e-03, 3.43159959e-03,
+    -9.04679298e-04,-8.69158655e-04, 1.42328814e-03,-1.19304936e-03, 6.42631203e-04,-7.77598470e-05,
+    -3.47400084e-04, 5.83118759e-04,-6.41476945e-04, 5.64530957e-04,-4.04322520e-04, 2.09960155e-04,
+    -2.14399770e-05,-1.33621506e-04, 2.39716843e-04,-2.92537967e-04, 2.96061975e-04,-2.60339933e-04,
+     1.98192894e-04,-1.23332255e-04, 4.78727743e-05, 1.84020028e-05,-6.92668837e-05, 1.01604965e-04,
+    -1.15572941e-04, 1.13395799e-04,-9.90658882e-05, 7.69509934e-05,-5.16149448e-05, 2.67010182e-05,
+    -5.14497515e-06,-1.14981085e-05, 2.24477844e-05,-2.80689565e-05, 2.90659955e-05,-2.66521674e-05,
+     2.21758964e-05,-1.68226979e-05, 1.14867871e-05,-6.74999319e-06, 2.92650657e-06,-1.16997398e-07,
+    -1.72950968e-06, 2.75609636e-06,-3.14588397e-06, 3.08750168e-06,-2.75512957e-06, 2.28676390e-06,
+    -1.78352002e-06, 1.31438992e-06,-9.14930752e-07, 6.01059583e-07,-3.69480404e-07, 2.12033228e-07,
+    -1.09329903e-07, 5.19471541e-08,-2.18728928e-08, 1.09400844e-08,-9.27900601e-09, 1.13431042e-08,
+    -1.16228875e-08, 1.11243992e-08,-8.38189607e-09, 3.77669807e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 48 */
+  {
+     7.72776620e-10, 6.73311370e-05, 6.75217109e-03, 1.09260298e-01,-1.25358403e-01,-3.78373601e-02,
+     6.64133728e-02,-4.19117399e-02, 1.04426397e-02, 1.18301902e-02,-2.20001694e-02, 2.28059702e-02,
+    -1.76675692e-02, 1.01165399e-02,-2.33801897e-03,-3.94302001e-03, 8.21562018e-03,-1.01365997e-02,
+     1.01598203e-02,-8.58274568e-03, 6.15857588e-03,-3.27807991e-03, 5.77382976e-04, 1.74634100e-03,
+    -3.34128900e-03, 4.26762179e-03,-4.43821307e-03, 4.09026816e-03,-3.28416796e-03, 2.30254303e-03,
+    -1.22655998e-03, 2.77442596e-04, 5.20529400e-04,-1.05227297e-03, 1.36330305e-03,-1.43125502e-03,
+     1.33919006e-03,-1.11523306e-03, 8.35967483e-04,-5.40855282e-04, 2.69572891e-04,-5.12295483e-05,
+    -1.05164698e-04, 2.00321199e-04,-2.44588504e-04, 2.49092409e-04,-2.27640296e-04, 1.90569597e-04,
+    -1.48085906e-04, 1.05826199e-04,-6.89336812e-05, 3.86896500e-05,-1.64825396e-05, 1.04597495e-06,
+     8.04480987e-06,-1.28083102e-05, 1.40663396e-05,-1.34841803e-05, 1.16318997e-05,-9.51116272e-06,
+     7.27514316e-06,-5.42168300e-06, 3.82516600e-06,-2.65762992e-06, 1.74501497e-06,-1.09166695e-06,
+     6.44438614e-07,-2.74845888e-07, 1.00714701e-07, 3.42608892e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     3.65490416e-10, 6.76744094e-06, 3.76208685e-04, 3.79680097e-03,-2.47609615e-03, 3.42655182e-03,
+    -9.78246331e-04,-8.04681331e-04, 1.39865000e-03,-1.20466016e-03, 6.74979761e-04,-1.15249306e-04,
+    -3.15910205e-04, 5.63450158e-04,-6.35073055e-04, 5.69744967e-04,-4.17820178e-04, 2.27812678e-04,
+    -4.00003046e-05,-1.17305666e-04, 2.27576122e-04,-2.85489019e-04, 2.94112833e-04,-2.62800953e-04,
+     2.03933101e-04,-1.31017994e-04, 5.62011264e-05, 1.05467625e-05,-6.27129339e-05, 9.68410168e-05,
+    -1.12770009e-04, 1.12447713e-04,-9.96708113e-05, 7.86927994e-05,-5.40380133e-05, 2.93779885e-05,
+    -7.72811472e-06,-9.26188659e-06, 2.07025441e-05,-2.68670265e-05, 2.83824047e-05,-2.64048394e-05,
+     2.22582457e-05,-1.71251013e-05, 1.19081087e-05,-7.20941171e-06, 3.36750236e-06,-5.01691829e-07,
+    -1.41879718e-06, 2.52220343e-06,-2.98333907e-06, 2.98742088e-06,-2.70227974e-06, 2.26819293e-06,
+    -1.78771506e-06, 1.33055983e-06,-9.38020094e-07, 6.24760105e-07,-3.91579306e-07, 2.30576006e-07,
+    -1.24472081e-07, 6.47401066e-08,-3.02541139e-08, 1.68759016e-08,-1.25940005e-08, 1.19349579e-08,
+    -1.35530058e-08, 1.16069998e-08,-8.38191738e-09, 3.29417915e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 49 */
+  {
+     1.13826704e-09, 7.40985779e-05, 7.12837977e-03, 1.13057099e-01,-1.27834499e-01,-3.44108082e-02,
+     6.54351264e-02,-4.27164212e-02, 1.18412897e-02, 1.06255300e-02,-2.13251896e-02, 2.26907209e-02,
+    -1.79834794e-02, 1.06799901e-02,-2.97309202e-03,-3.37327505e-03, 7.79780000e-03,-9.90878697e-03,
+     1.01198200e-02,-8.70005134e-03, 6.38615200e-03,-3.56356893e-03, 8.71495809e-04, 1.48354005e-03,
+    -3.13735590e-03, 4.13660379e-03,-4.38201195e-03, 4.10081493e-03,-3.34688090e-03, 2.39938404e-03,
+    -1.33932999e-03, 3.89890309e-04, 4.20858589e-04,-9.73580172e-04, 1.30926503e-03,-1.40187703e-03,
+     1.33146194e-03,-1.12449494e-03, 8.56670027e-04,-5.67722309e-04, 2.97955296e-04,-7.76343877e-05,
+    -8.29064520e-05, 1.83196098e-04,-2.32680395e-04, 2.41882997e-04,-2.24272793e-04, 1.90067905e-04,
+    -1.49504704e-04, 1.08348402e-04,-7.19170203e-05, 4.16770708e-05,-1.91848194e-05, 3.31416800e-06,
+     6.25709481e-06,-1.14777504e-05, 1.31283196e-05,-1.28594202e-05, 1.12403204e-05,-9.28058671e-06,
+     7.15067108e-06,-5.35694289e-06, 3.79491189e-06,-2.64075402e-06, 1.73242097e-06,-1.07973199e-06,
+     6.30885609e-07,-2.63238888e-07, 9.23327832e-08, 3.75550684e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     5.09828957e-10, 7.36099901e-06, 3.94108240e-04, 3.89999896e-03,-2.31480598e-03, 3.41819786e-03,
+    -1.05004758e-03,-7.39578158e-04, 1.37213990e-03,-1.21438876e-03, 7.06119463e-04,-1.52401626e-04,
+    -2.83980742e-04, 5.42890280e-04,-6.27571950e-04, 5.73927071e-04,-4.30522021e-04, 2.45214440e-04,
+    -5.84200025e-05,-1.00816600e-04, 2.15046108e-04,-2.77925981e-04, 2.91617238e-04,-2.64761038e-04,
+     2.09265854e-04,-1.38430856e-04, 6.43958338e-05, 2.69897282e-06,-5.60611952e-05, 9.19080339e-05,
+    -1.09759974e-04, 1.11286674e-04,-1.00081379e-04, 8.02735449e-05,-5.63450158e-05, 3.19880201e-05,
+    -1.02859922e-05,-7.01507088e-06, 1.89259881e-05,-2.56177736e-05, 2.76454957e-05,-2.61063105e-05,
+     2.22967137e-05,-1.73916924e-05, 1.23022910e-05,-7.65000004e-06, 3.79799167e-06,-8.82704626e-07,
+    -1.10590190e-06, 2.28459976e-06,-2.81628309e-06, 2.88109004e-06,-2.64286973e-06, 2.24321298e-06,
+    -1.78652499e-06, 1.34456059e-06,-9.57069460e-07, 6.46539775e-07,-4.12760528e-07, 2.48770448e-07,
+    -1.40207248e-07, 7.52470442e-08,-3.86369265e-08, 2.40290774e-08,-1.77119546e-08, 1.59819820e-08,
+    -1.54155941e-08, 1.31732918e-08,-8.38190317e-09, 1.72788006e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 50 */
+  {
+     1.64809599e-09, 8.14595769e-05, 7.52248801e-03, 1.16957098e-01,-1.30149305e-01,-3.09926104e-02,
+     6.43850788e-02,-4.34559993e-02, 1.32134296e-02, 9.41114128e-03,-2.06190702e-02, 2.25383192e-02,
+    -1.82674602e-02, 1.12228803e-02,-3.60066397e-03,-2.79934797e-03, 7.36727798e-03,-9.66357253e-03,
+     1.00614000e-02,-8.80086794e-03, 6.60119811e-03,-3.84149491e-03, 1.16311305e-03, 1.21877901e-03,
+    -2.92809005e-03, 3.99817294e-03,-4.31761611e-03, 4.10351390e-03,-3.40294209e-03, 2.49129208e-03,
+    -1.44908996e-03, 5.01176983e-04, 3.20777210e-04,-8.93306627e-04, 1.25292002e-03,-1.36988901e-03,
+     1.32117595e-03,-1.13151001e-03, 8.75596015e-04,-5.93340083e-04, 3.25600791e-04,-1.03740698e-04,
+    -6.06097383e-05, 1.65804406e-04,-2.20378104e-04, 2.34232997e-04,-2.20474802e-04, 1.89185201e-04,
+    -1.50610605e-04, 1.10633002e-04,-7.47333033e-05, 4.45581609e-05,-2.18276891e-05, 5.55738097e-06,
+     4.47056982e-06,-1.01331898e-05, 1.21712501e-05,-1.22128804e-05, 1.08275599e-05,-9.03181626e-06,
+     7.01046383e-06,-5.28169585e-06, 3.75627496e-06,-2.61672494e-06, 1.71470901e-06,-1.06375001e-06,
+     6.15470015e-07,-2.50065597e-07, 8.39508800e-08, 3.92829484e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     7.00055014e-10, 7.99915142e-06, 4.12697904e-04, 4.00510430e-03,-2.15429068e-03, 3.40656005e-03,
+    -1.12000108e-03,-6.73912466e-04, 1.34378020e-03,-1.22219231e-03, 7.35990703e-04,-1.89149752e-04,
+    -2.51699239e-04, 5.21449372e-04,-6.18991908e-04, 5.77074941e-04,-4.42408025e-04, 2.62112357e-04,
+    -7.66944140e-05,-8.41896981e-05, 2.02154741e-04,-2.69867247e-04, 2.88578914e-04,-2.66213494e-04,
+     2.14189989e-04,-1.45558966e-04, 7.24410638e-05,-5.12879342e-06,-4.93240077e-05, 8.68160278e-05,
+    -1.06550055e-04, 1.09915214e-04,-1.00295714e-04, 8.16910178e-05,-5.85319940e-05, 3.45229637e-05,
+    -1.28099928e-05,-4.76604328e-06, 1.71188731e-05,-2.43252143e-05, 2.68586155e-05,-2.57588035e-05,
+     2.22914787e-05,-1.76215108e-05, 1.26683008e-05,-8.07439210e-06, 4.21670848e-06,-1.26039959e-06,
+    -7.93894287e-07, 2.04379467e-06,-2.64453411e-06, 2.76809078e-06,-2.57840111e-06, 2.21527807e-06,
+    -1.78198775e-06, 1.35460596e-06,-9.75260264e-07, 6.67000677e-07,-4.32790330e-07, 2.65401468e-07,
+    -1.54583631e-07, 8.53906386e-08,-4.70179202e-08, 2.94828624e-08,-2.04939852e-08, 1.92750349e-08,
+    -1.73039894e-08, 1.29871012e-08,-8.38190317e-09, 1.86265225e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 51 */
+  {
+     2.34815101e-09, 8.94587283e-05, 7.93518592e-03, 1.20962203e-01,-1.32303596e-01,-2.75860503e-02,
+     6.32650778e-02,-4.41299118e-02, 1.45572098e-02, 8.18894897e-03,-1.98830795e-02, 2.23491695e-02,
+    -1.85191594e-02, 1.17443297e-02,-4.21965588e-03,-2.22227303e-03, 6.92486996e-03,-9.40146018e-03,
+     9.98470560e-03,-8.88505764e-03, 6.80335285e-03,-4.11136216e-03, 1.45169196e-03, 9.52565519e-04,
+    -2.71390006e-03, 3.85261397e-03,-4.24517505e-03, 4.09838511e-03,-3.45226610e-03, 2.57810811e-03,
+    -1.55564002e-03, 6.11092197e-04, 2.20481495e-04,-8.11615610e-04, 1.19438802e-03,-1.33536605e-03,
+     1.30836596e-03,-1.13627606e-03, 8.92714888e-04,-6.17665297e-04, 3.52459407e-04,-1.29499502e-04,
+    -3.83182596e-05, 1.48182895e-04,-2.07709803e-04, 2.26158605e-04,-2.16258093e-04, 1.87924801e-04,
+    -1.51404500e-04, 1.12676797e-04,-7.73778374e-05, 4.73262517e-05,-2.44060902e-05, 7.77265905e-06,
+     2.68858207e-06,-8.77858383e-06, 1.11959898e-05,-1.15458797e-05, 1.03947696e-05,-8.76641479e-06,
+     6.85588020e-06,-5.19630521e-06, 3.70925704e-06,-2.58724208e-06, 1.69421503e-06,-1.04447497e-06,
+     5.98166025e-07,-2.37078496e-07, 7.55689769e-08, 4.11456007e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     9.47391943e-10, 8.68468487e-06, 4.32003289e-04, 4.11190093e-03,-1.99480355e-03, 3.39166075e-03,
+    -1.18803605e-03,-6.07769936e-04, 1.31362025e-03,-1.22808293e-03, 7.64548779e-04,-2.25439668e-04,
+    -2.19110399e-04, 4.99180518e-04,-6.09349925e-04, 5.79181011e-04,-4.53460962e-04, 2.78482214e-04,
+    -9.47648659e-05,-6.74566254e-05, 1.88922044e-04,-2.61324923e-04, 2.85010086e-04,-2.67158612e-04,
+     2.18688045e-04,-1.52386026e-04, 8.03242438e-05,-1.29211694e-05,-4.25158069e-05, 8.15768726e-05,
+    -1.03145023e-04, 1.08334818e-04,-1.00315498e-04, 8.29456840e-05,-6.05969690e-05, 3.69810732e-05,
+    -1.53000001e-05,-2.51992606e-06, 1.52874854e-05,-2.29906873e-05, 2.60217057e-05,-2.53608014e-05,
+     2.22402505e-05,-1.78137998e-05, 1.30104017e-05,-8.47970659e-06, 4.62689786e-06,-1.63209916e-06,
+    -4.81901225e-07, 1.80060306e-06,-2.46835407e-06, 2.65108974e-06,-2.51015990e-06, 2.18141577e-06,
+    -1.77453171e-06, 1.36194285e-06,-9.91520210e-07, 6.86629392e-07,-4.51079359e-07, 2.82214387e-07,
+    -1.67730377e-07, 9.78370736e-08,-5.54009603e-08, 3.50710252e-08,-2.45270257e-08, 2.09519158e-08,
+    -1.89767206e-08, 1.34696023e-08,-8.38191028e-09, 1.86263804e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 52 */
+  {
+     3.29554295e-09, 9.81434132e-05, 8.36718921e-03, 1.25074103e-01,-1.34298399e-01,-2.41943896e-02,
+     6.20770417e-02,-4.47376817e-02, 1.58708300e-02, 6.96086604e-03,-1.91185307e-02, 2.21237298e-02,
+    -1.87382698e-02, 1.22435102e-02,-4.82900580e-03,-1.64309202e-03, 6.47140900e-03,-9.12297796e-03,
+     9.88994073e-03,-8.95251427e-03, 6.99227490e-03,-4.37268708e-03, 1.73670205e-03, 6.85406907e-04,
+    -2.49521201e-03, 3.70022794e-03,-4.16485080e-03, 4.08546394e-03,-3.49478191e-03, 2.65968498e-03,
+    -1.65878504e-03, 7.19427015e-04, 1.20165998e-04,-7.28669926e-04, 1.13379105e-03,-1.29838497e-03,
+     1.29306596e-03,-1.13879598e-03, 9.08002374e-04,-6.40655984e-04, 3.78481112e-04,-1.54860303e-04,
+    -1.60780091e-05, 1.30369095e-04,-1.94699402e-04, 2.17678898e-04,-2.11631195e-04, 1.86292702e-04,
+    -1.51886401e-04, 1.14477400e-04,-7.98461915e-05, 4.99773414e-05,-2.69162501e-05, 9.95407481e-06,
+     9.14050304e-07,-7.41664098e-06, 1.02044696e-05,-1.08592503e-05, 9.94369020e-06,-8.48420041e-06,
+     6.68814982e-06,-5.09846814e-06, 3.65385608e-06,-2.55217105e-06, 1.66968800e-06,-1.02352305e-06,
+     5.79189305e-07,-2.23608893e-07, 6.71870666e-08, 4.30082387e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.26509203e-09, 9.42048791e-06, 4.52038832e-04, 4.22050059e-03,-1.83619559e-03, 3.37355025e-03,
+    -1.25411153e-03,-5.41247427e-04, 1.28174014e-03,-1.23205688e-03, 7.91760162e-04,-2.61209905e-04,
+    -1.86270103e-04, 4.76129353e-04,-5.98668121e-04, 5.80245978e-04,-4.63664066e-04, 2.94297934e-04,
+    -1.12610869e-04,-5.06471843e-05, 1.75376888e-04,-2.52320897e-04, 2.80914945e-04,-2.67598516e-04,
+     2.22763047e-04,-1.58903887e-04, 8.80258158e-05,-2.06618570e-05,-3.56491655e-05, 7.61959236e-05,
+    -9.95539594e-05, 1.06552674e-04,-1.00140860e-04, 8.40338180e-05,-6.25350513e-05, 3.93550145e-05,
+    -1.77469337e-05,-2.79047526e-07, 1.34357251e-05,-2.16176268e-05, 2.51372985e-05,-2.49153964e-05,
+     2.21464688e-05,-1.79716953e-05, 1.33208086e-05,-8.86559428e-06, 5.02429612e-06,-1.99770147e-06,
+    -1.70301064e-07, 1.55450107e-06,-2.28850695e-06, 2.52937753e-06,-2.43692011e-06, 2.14626562e-06,
+    -1.76299159e-06, 1.36815197e-06,-1.00570469e-06, 7.03180376e-07,-4.68522558e-07, 2.98549821e-07,
+    -1.81576979e-07, 1.06829248e-07,-6.38081019e-08, 4.06589606e-08,-2.90359594e-08, 2.32980710e-08,
+    -1.95738039e-08, 1.50358943e-08,-8.38189607e-09, 1.86265225e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 53 */
+  {
+     4.56063498e-09, 1.07563901e-04, 8.81922804e-03, 1.29294604e-01,-1.36134595e-01,-2.08208393e-02,
+     6.08229302e-02,-4.52789292e-02, 1.71525702e-02, 5.72880916e-03,-1.83267705e-02, 2.18625199e-02,
+    -1.89245399e-02, 1.27196396e-02,-5.42767392e-03,-1.06284604e-03, 6.00774493e-03,-8.82868003e-03,
+     9.77732986e-03,-9.00316145e-03, 7.16765178e-03,-4.62500798e-03, 2.01761699e-03, 4.17808391e-04,
+    -2.27244897e-03, 3.54132405e-03,-4.07682499e-03, 4.06480208e-03,-3.53043107e-03, 2.73588090e-03,
+    -1.75833900e-03, 8.25979689e-04, 2.00251397e-05,-6.44636108e-04, 1.07125600e-03,-1.25902996e-03,
+     1.27531902e-03,-1.13907503e-03, 9.21438099e-04,-6.62273611e-04, 4.03618411e-04,-1.79775700e-04,
+     6.06845879e-06, 1.12397400e-04,-1.81378593e-04, 2.08813304e-04,-2.06606899e-04, 1.84295001e-04,
+    -1.52056702e-04, 1.16031901e-04,-8.21346985e-05, 5.25067189e-05,-2.93531702e-05, 1.21003404e-05,
+    -8.48941283e-07,-6.04848901e-06, 9.19876493e-06,-1.01560699e-05, 9.47516764e-06,-8.18565059e-06,
+     6.50657284e-06,-4.99163889e-06, 3.59004798e-06,-2.51151209e-06, 1.64065204e-06,-1.00022498e-06,
+     5.59615501e-07,-2.08572999e-07, 5.88051705e-08, 4.48708910e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.66871095e-09, 1.02096965e-05, 4.72826883e-04, 4.33099270e-03,-1.67880952e-03, 3.35226953e-03,
+    -1.31814927e-03,-4.74430621e-04, 1.24814920e-03,-1.23411696e-03, 8.17580149e-04,-2.96419486e-04,
+    -1.53219327e-04, 4.52330336e-04,-5.86966053e-04, 5.80272637e-04,-4.72994987e-04, 3.09528783e-04,
+    -1.30197965e-04,-3.37921083e-05, 1.61546282e-04,-2.42867973e-04, 2.76301987e-04,-2.67530675e-04,
+     2.26399861e-04,-1.65098114e-04, 9.55369323e-05,-2.83382833e-05,-2.87378207e-05, 7.06911087e-05,
+    -9.57850134e-05, 1.04572391e-04,-9.97728785e-05, 8.49547796e-05,-6.43420499e-05, 4.16419934e-05,
+    -2.01490475e-05, 1.95298344e-06, 1.15652219e-05,-2.02087103e-05, 2.42088863e-05,-2.44233961e-05,
+     2.20098918e-05,-1.80922434e-05, 1.36036979e-05,-9.23140033e-06, 5.40919427e-06,-2.35839980e-06,
+     1.39698386e-07, 1.30820263e-06,-2.10488361e-06, 2.40464942e-06,-2.35845073e-06, 2.10398957e-06,
+    -1.74747674e-06, 1.36928202e-06,-1.01727710e-06, 7.19604941e-07,-4.85028067e-07, 3.13365490e-07,
+    -1.94357654e-07, 1.16624051e-07,-7.19999207e-08, 4.62471235e-08,-3.27200951e-08, 2.67772293e-08,
+    -1.99373744e-08, 1.49012038e-08,-8.38189962e-09, 1.86263804e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 54 */
+  {
+     6.22934593e-09, 1.17773598e-04, 9.29205492e-03, 1.33625597e-01,-1.37813404e-01,-1.74685698e-02,
+     5.95047809e-02,-4.57533598e-02, 1.84007194e-02, 4.49469220e-03,-1.75091904e-02, 2.15661004e-02,
+    -1.90777592e-02, 1.31719699e-02,-6.01463998e-03,-4.82573407e-04, 5.53474994e-03,-8.51915125e-03,
+     9.64713190e-03,-9.03695356e-03, 7.32919807e-03,-4.86787595e-03, 2.29391898e-03, 1.50277701e-04,
+    -2.04604911e-03, 3.37622594e-03,-3.98128806e-03, 4.03646380e-03,-3.55916889e-03, 2.80657201e-03,
+    -1.85412401e-03, 9.30552080e-04,-7.97477405e-05,-5.59681328e-04, 1.00691395e-03,-1.21738797e-03,
+     1.25516998e-03,-1.13712205e-03, 9.33003321e-04,-6.82482321e-04, 4.27827297e-04,-2.04199096e-04,
+     2.80783497e-05, 9.43051564e-05,-1.67774895e-04, 1.99581904e-04,-2.01197705e-04, 1.81936601e-04,
+    -1.51917004e-04, 1.17340103e-04,-8.42395821e-05, 5.49113684e-05,-3.17116210e-05, 1.42043300e-05,
+    -2.59641797e-06,-4.67920700e-06, 8.18148783e-06,-9.43646501e-06, 8.99013958e-06,-7.87228510e-06,
+     6.31221519e-06,-4.87501484e-06, 3.51804806e-06,-2.46526497e-06, 1.60793195e-06,-9.73447754e-07,
+     5.39678126e-07,-1.93671795e-07, 5.04232709e-08, 4.67335290e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     2.17638263e-09, 1.10554975e-05, 4.94388863e-04, 4.44319844e-03,-1.52249634e-03, 3.32785025e-03,
+    -1.38007104e-03,-4.07431275e-04, 1.21294148e-03,-1.23426528e-03, 8.41990113e-04,-3.30990180e-04,
+    -1.20051205e-04, 4.27819788e-04,-5.74267935e-04, 5.79264248e-04,-4.81445808e-04, 3.24154273e-04,
+    -1.47493556e-04,-1.69258565e-05, 1.47453975e-04,-2.32990831e-04, 2.71186000e-04,-2.66959105e-04,
+     2.29598139e-04,-1.70956831e-04, 1.02838036e-04,-3.59346159e-05,-2.17950437e-05, 6.50670845e-05,
+    -9.18449368e-05, 1.02396880e-04,-9.92133573e-05, 8.57083360e-05,-6.60196529e-05, 4.38409625e-05,
+    -2.25009862e-05, 4.17209230e-06, 9.68237873e-06,-1.87681871e-05, 2.32376915e-05,-2.38862995e-05,
+     2.18299901e-05,-1.81744545e-05, 1.38587930e-05,-9.57569864e-06, 5.77879837e-06,-2.71160388e-06,
+     4.47500497e-07, 1.06039806e-06,-1.91800063e-06, 2.27339115e-06,-2.27647979e-06, 2.05821016e-06,
+    -1.72936211e-06, 1.36838707e-06,-1.02657668e-06, 7.33512934e-07,-5.00680471e-07, 3.27836005e-07,
+    -2.06156983e-07, 1.27452950e-07,-7.91160346e-08, 5.18350589e-08,-3.62030050e-08, 2.79715664e-08,
+    -2.19863523e-08, 1.49011896e-08,-8.38191028e-09, 1.86265225e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 55 */
+  {
+     8.40572856e-09, 1.28829095e-04, 9.78644378e-03, 1.38068795e-01,-1.39335901e-01,-1.41407195e-02,
+     5.81247099e-02,-4.61607911e-02, 1.96136609e-02, 3.26042692e-03,-1.66672003e-02, 2.12351102e-02,
+    -1.91978104e-02, 1.35997897e-02,-6.58890791e-03, 9.66908701e-05, 5.05330414e-03,-8.19499698e-03,
+     9.49963834e-03,-9.05387942e-03, 7.47665204e-03,-5.10086678e-03, 2.56510498e-03,-1.16681404e-04,
+    -1.81645097e-03, 3.20526911e-03,-3.87845002e-03, 4.00052918e-03,-3.58096394e-03, 2.87163910e-03,
+    -1.94596895e-03, 1.03294896e-03,-1.78961098e-04,-4.73972992e-04, 9.40894301e-04,-1.17354700e-03,
+     1.23266899e-03,-1.13294995e-03, 9.42685700e-04,-7.01250508e-04, 4.51064989e-04,-2.28085395e-04,
+     4.99083399e-05, 7.61307019e-05,-1.53916102e-04, 1.90006205e-04,-1.95418907e-04, 1.79224997e-04,
+    -1.51469503e-04, 1.18400501e-04,-8.61575827e-05, 5.71847595e-05,-3.39881008e-05, 1.62625402e-05,
+    -4.32578008e-06,-3.31081992e-06, 7.15491115e-06,-8.70295207e-06, 8.48945911e-06,-7.54444909e-06,
+     6.10605821e-06,-4.74756189e-06, 3.43893203e-06,-2.41342991e-06, 1.57172894e-06,-9.45476188e-07,
+     5.17691774e-07,-1.78770605e-07, 4.20413606e-08, 4.85961813e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     2.80915113e-09, 1.19612087e-05, 5.16746193e-04, 4.55710292e-03,-1.36749446e-03, 3.30033991e-03,
+    -1.43983960e-03,-3.40308994e-04, 1.17614865e-03,-1.23251090e-03, 8.64921138e-04,-3.64881009e-04,
+    -8.67787749e-05, 4.02670354e-04,-5.60600311e-04, 5.77225117e-04,-4.89003025e-04, 3.38140875e-04,
+    -1.64468773e-04,-7.54371285e-08, 1.33127905e-04,-2.22708099e-04, 2.65572919e-04,-2.65883573e-04,
+     2.32349965e-04,-1.76474219e-04, 1.09923072e-04,-4.34373505e-05,-1.48341060e-05, 5.93368895e-05,
+    -8.77410639e-05, 1.00030098e-04,-9.84638027e-05, 8.62898014e-05,-6.75601186e-05, 4.59409785e-05,
+    -2.47990247e-05, 6.36989716e-06, 7.78940739e-06,-1.72964064e-05, 2.22244125e-05,-2.33042083e-05,
+     2.16055196e-05,-1.82213334e-05, 1.40845077e-05,-9.89870750e-06, 6.13780867e-06,-3.05649883e-06,
+     7.50005711e-07, 8.12200597e-07,-1.72914588e-06, 2.14025204e-06,-2.18997957e-06, 2.00927934e-06,
+    -1.70598514e-06, 1.36353083e-06,-1.03242019e-06, 7.44418685e-07,-5.14574822e-07, 3.40739916e-07,
+    -2.17532033e-07, 1.37164989e-07,-8.60509317e-08, 5.74739261e-08,-3.91719368e-08, 2.87504918e-08,
+    -2.33663968e-08, 1.48497037e-08,-8.38189962e-09, 1.91406002e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 56 */
+  {
+     1.12148797e-08, 1.40790304e-04, 1.03031900e-02, 1.42625898e-01,-1.40703395e-01,-1.08403796e-02,
+     5.66848703e-02,-4.65011001e-02, 2.07898095e-02, 2.02791602e-03,-1.58022791e-02, 2.08702292e-02,
+    -1.92845892e-02, 1.40024601e-02,-7.14950822e-03, 6.73916016e-04, 4.56430111e-03,-7.85685610e-03,
+     9.33516957e-03,-9.05395485e-03, 7.60977995e-03,-5.32357488e-03, 2.83067790e-03,-3.82564991e-04,
+    -1.58410100e-03, 3.02879489e-03,-3.76852695e-03, 3.95709183e-03,-3.59579804e-03, 2.93097598e-03,
+    -2.03371001e-03, 1.13297906e-03,-2.77424901e-04,-3.87683191e-04, 8.73334182e-04,-1.12760602e-03,
+     1.20786997e-03,-1.12658006e-03, 9.50475107e-04,-7.18546915e-04, 4.73289401e-04,-2.51389603e-04,
+     7.15138594e-05, 5.79093685e-05,-1.39831594e-04, 1.80107498e-04,-1.89281098e-04, 1.76168498e-04,
+    -1.50719497e-04, 1.19212702e-04,-8.78867286e-05, 5.93250115e-05,-3.61780803e-05, 1.82718195e-05,
+    -6.03176522e-06,-1.94728909e-06, 6.12249096e-06,-7.95853339e-06, 7.97488428e-06,-7.20370917e-06,
+     5.88852618e-06,-4.61039690e-06, 3.35288109e-06,-2.35595598e-06, 1.53255701e-06,-9.16725696e-07,
+     4.94325377e-07,-1.63920902e-07, 3.36594610e-08, 5.05102413e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     3.59132013e-09, 1.29304972e-05, 5.39910048e-04, 4.67289984e-03,-1.21380389e-03, 3.26978741e-03,
+    -1.49738044e-03,-2.73160636e-04, 1.13783963e-03,-1.22886314e-03, 8.86378810e-04,-3.98019329e-04,
+    -5.34914434e-05, 3.76880169e-04,-5.45986928e-04, 5.74159960e-04,-4.95654065e-04, 3.51470895e-04,
+    -1.81091018e-04, 1.67246908e-05, 1.18596945e-04,-2.12036073e-04, 2.59477179e-04,-2.64309725e-04,
+     2.34654988e-04,-1.81639800e-04, 1.16773881e-04,-5.08329831e-05,-7.86804594e-06, 5.35149593e-05,
+    -8.34839884e-05, 9.74799041e-05,-9.75274015e-05, 8.67042982e-05,-6.89626904e-05, 4.79429727e-05,
+    -2.70379242e-05, 8.54709651e-06, 5.88997500e-06,-1.57991890e-05, 2.11736187e-05,-2.26786069e-05,
+     2.13398016e-05,-1.82315889e-05, 1.42779900e-05,-1.02007907e-05, 6.48009882e-06,-3.39459802e-06,
+     1.04970240e-06, 5.62795321e-07,-1.53764267e-06, 2.00324939e-06,-2.09813879e-06, 1.95719076e-06,
+    -1.68060160e-06, 1.35596497e-06,-1.03682987e-06, 7.55750534e-07,-5.26231361e-07, 3.53881205e-07,
+    -2.29301349e-07, 1.47562787e-07,-9.41870439e-08, 6.26309884e-08,-4.27220357e-08, 3.23141762e-08,
+    -2.37141649e-08, 1.53323043e-08,-8.38190140e-09, 1.43153045e-09, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 57 */
+  {
+     1.48061998e-08, 1.53720801e-04, 1.08431000e-02, 1.47298798e-01,-1.41917199e-01,-7.57059222e-03,
+     5.51874898e-02,-4.67742607e-02, 2.19276492e-02, 7.99052825e-04,-1.49159003e-02, 2.04722099e-02,
+    -1.93380807e-02, 1.43793402e-02,-7.69549515e-03, 1.24807598e-03, 4.06864705e-03,-7.50538521e-03,
+     9.15407855e-03,-9.03723016e-03, 7.72837689e-03,-5.53561095e-03, 3.09015508e-03,-6.46874716e-04,
+    -1.34944601e-03, 2.84715509e-03,-3.65175307e-03, 3.90625885e-03,-3.60366609e-03, 2.98449094e-03,
+    -2.11719400e-03, 1.23045896e-03,-3.74952302e-04,-3.00978892e-04, 8.04371492e-04,-1.07966305e-03,
+     1.18083204e-03,-1.11803296e-03, 9.56365082e-04,-7.34346104e-04, 4.94463020e-04,-2.74068210e-04,
+     9.28536610e-05, 3.96777796e-05,-1.25553604e-04, 1.69906707e-04,-1.82800999e-04, 1.72773900e-04,
+    -1.49669795e-04, 1.19775497e-04,-8.94243713e-05, 6.13282609e-05,-3.82762191e-05, 2.02290103e-05,
+    -7.71236682e-06,-5.91324124e-07, 5.08566109e-06,-7.20278285e-06, 7.44865292e-06,-6.84982797e-06,
+     5.65922483e-06,-4.46283411e-06, 3.25869405e-06,-2.29332500e-06, 1.48983497e-06,-8.84411520e-07,
+     4.70611212e-07,-1.48588597e-07, 2.52775596e-08, 5.19417718e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     4.55076066e-09, 1.39668991e-05, 5.63919544e-04, 4.79039550e-03,-1.06149912e-03, 3.23624443e-03,
+    -1.55266002e-03,-2.06090510e-04, 1.09810010e-03,-1.22333737e-03, 9.06320289e-04,-4.30390239e-04,
+    -2.02190131e-05, 3.50560062e-04,-5.30460849e-04, 5.70081989e-04,-5.01387985e-04, 3.64119187e-04,
+    -1.97332352e-04, 3.34447250e-05, 1.03888568e-04,-2.00998969e-04, 2.52913916e-04,-2.62242975e-04,
+     2.36505992e-04,-1.86440069e-04, 1.23379985e-04,-5.81047498e-05,-9.09902155e-07, 4.76110727e-05,
+    -7.90820923e-05, 9.47510125e-05,-9.64053907e-05, 8.69464857e-05,-7.02257967e-05, 4.98431036e-05,
+    -2.92150071e-05, 1.06949592e-05, 3.98769043e-06,-1.42772915e-05, 2.00882787e-05,-2.20117799e-05,
+     2.10358412e-05,-1.82044696e-05, 1.44446021e-05,-1.04797073e-05, 6.80750236e-06,-3.72150680e-06,
+     1.34800212e-06, 3.15303623e-07,-1.34430593e-06, 1.86241232e-06,-2.00485010e-06, 1.89851926e-06,
+    -1.65297388e-06, 1.34722086e-06,-1.03962611e-06, 7.65580808e-07,-5.39592747e-07, 3.66057975e-07,
+    -2.39169822e-07, 1.55277121e-07,-1.00063971e-07, 6.61700597e-08,-4.56649332e-08, 3.40421025e-08,
+    -2.52290135e-08, 1.68984968e-08,-8.43331982e-09,-1.34761535e-10, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 58 */
+  {
+     1.93569605e-08, 1.67687700e-04, 1.14070196e-02, 1.52089193e-01,-1.42978698e-01,-4.33434779e-03,
+     5.36348298e-02,-4.69803512e-02, 2.30257493e-02,-4.24284604e-04,-1.40095800e-02, 2.00418197e-02,
+    -1.93582997e-02, 1.47299003e-02,-8.22595600e-03, 1.81815797e-03, 3.56725906e-03,-7.14126602e-03,
+     8.95674620e-03,-9.00378544e-03, 7.83226546e-03,-5.73660992e-03, 3.34306899e-03,-9.09117691e-04,
+    -1.11294002e-03, 2.66071502e-03,-3.52837308e-03, 3.84815410e-03,-3.60457599e-03, 3.03210202e-03,
+    -2.19627609e-03, 1.32520997e-03,-4.71357693e-04,-2.14032407e-04, 7.34145695e-04,-1.02981995e-03,
+     1.15161703e-03,-1.10733800e-03, 9.60352772e-04,-7.48623395e-04, 5.14551299e-04,-2.96079990e-04,
+     1.13889502e-04, 2.14733100e-05,-1.11109002e-04, 1.59427000e-04,-1.75993497e-04, 1.69052393e-04,
+    -1.48321793e-04, 1.20090801e-04,-9.07686772e-05, 6.31906732e-05,-4.02810692e-05, 2.21275295e-05,
+    -9.36534070e-06, 7.55896679e-07, 4.04603497e-06,-6.43720205e-06, 6.90906018e-06,-6.48376999e-06,
+     5.42005500e-06,-4.30755699e-06, 3.15863008e-06,-2.22715494e-06, 1.44417004e-06,-8.50369418e-07,
+     4.45382199e-07,-1.31690101e-07, 1.68442398e-08, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     5.71943026e-09, 1.50741980e-05, 5.88780269e-04, 4.90970910e-03,-9.10505652e-04, 3.19976080e-03,
+    -1.60560012e-03,-1.39158219e-04, 1.05695985e-03,-1.21594837e-03, 9.24710184e-04,-4.61909920e-04,
+     1.29397959e-05, 3.23689543e-04,-5.14050946e-04, 5.64995920e-04,-5.06200129e-04, 3.76066193e-04,
+    -2.13162042e-04, 5.00557944e-05, 8.90279189e-05,-1.89619139e-04, 2.45892908e-04,-2.59686320e-04,
+     2.37904314e-04,-1.90874096e-04, 1.29729975e-04,-6.52431045e-05, 6.02495857e-06, 4.16340772e-05,
+    -7.45418947e-05, 9.18480800e-05,-9.51009861e-05, 8.70202057e-05,-7.13467016e-05, 5.16409054e-05,
+    -3.13260825e-05, 1.28139509e-05, 2.08721031e-06,-1.27349049e-05, 1.89655111e-05,-2.13053136e-05,
+     2.06894911e-05,-1.81407777e-05, 1.45801459e-05,-1.07367960e-05, 7.12019391e-06,-4.03969898e-06,
+     1.63918594e-06, 6.76009222e-08,-1.14935392e-06, 1.71882857e-06,-1.90738137e-06, 1.83851080e-06,
+    -1.61981916e-06, 1.33393223e-06,-1.03950993e-06, 7.71297891e-07,-5.49136075e-07, 3.75048785e-07,
+    -2.48682227e-07, 1.63759978e-07,-1.05310164e-07, 7.03778369e-08,-4.95350605e-08, 3.59046908e-08,
+    -2.55768953e-08, 1.67637992e-08,-7.95078847e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 59 */
+  {
+     2.50763907e-08, 1.82761898e-04, 1.19957998e-02, 1.56998903e-01,-1.43889204e-01,-1.13458699e-03,
+     5.20292297e-02,-4.71195094e-02, 2.40827091e-02,-1.64023298e-03,-1.30848698e-02, 1.95799097e-02,
+    -1.93453599e-02, 1.50535898e-02,-8.74000695e-03, 2.38315389e-03, 3.06105893e-03,-6.76519983e-03,
+     8.74358416e-03,-8.95372964e-03, 7.92129338e-03,-5.92622906e-03, 3.58896190e-03,-1.16880401e-03,
+    -8.75035708e-04, 2.46984093e-03,-3.39864311e-03, 3.78291099e-03,-3.59855103e-03, 3.07373609e-03,
+    -2.27081799e-03, 1.41705805e-03,-5.66458679e-04,-1.27012201e-04, 6.62798993e-04,-9.78179043e-04,
+     1.12029095e-03,-1.09452405e-03, 9.62439983e-04,-7.61358300e-04, 5.33516810e-04,-3.17385304e-04,
+     1.34578993e-04, 3.33253206e-06,-9.65288564e-05, 1.48690204e-04,-1.68873303e-04, 1.65012694e-04,
+    -1.46682607e-04, 1.20158402e-04,-9.19180311e-05, 6.49095018e-05,-4.21884506e-05, 2.39660403e-05,
+    -1.09851599e-05, 2.08982897e-06, 3.00652505e-06,-5.66590415e-06, 6.35992410e-06,-6.10872121e-06,
+     5.17137278e-06,-4.14379701e-06, 3.05331992e-06,-2.15677710e-06, 1.39463498e-06,-8.14464727e-07,
+     4.19805303e-07,-1.14926301e-07, 8.89345131e-09, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     7.13369097e-09, 1.62568031e-05, 6.14520162e-04, 5.03069162e-03,-7.61300325e-04, 3.16039007e-03,
+    -1.65618956e-03,-7.24904239e-05, 1.01449154e-03,-1.20671513e-03, 9.41529870e-04,-4.92529944e-04,
+     4.59793955e-05, 2.96359882e-04,-4.96786088e-04, 5.58916014e-04,-5.10083977e-04, 3.87293752e-04,
+    -2.28555873e-04, 6.65225089e-05, 7.40448013e-05,-1.77917071e-04, 2.38431152e-04,-2.56645028e-04,
+     2.38845707e-04,-1.94930006e-04, 1.35811046e-04,-7.22310506e-05, 1.29239634e-05, 3.55998054e-05,
+    -6.98759686e-05, 8.87819333e-05,-9.36175347e-05, 8.69239302e-05,-7.23241828e-05, 5.33256680e-05,
+    -3.33639327e-05, 1.48990657e-05, 1.92318112e-07,-1.11769768e-05, 1.78134651e-05,-2.05606921e-05,
+     2.03042000e-05,-1.80423613e-05, 1.46876264e-05,-1.09699031e-05, 7.41690747e-06,-4.34849062e-06,
+     1.92660082e-06,-1.78202754e-07,-9.53477866e-07, 1.57459726e-06,-1.80726056e-06, 1.77565926e-06,
+    -1.58520015e-06, 1.31960110e-06,-1.03819116e-06, 7.78073172e-07,-5.57434305e-07, 3.84897248e-07,
+    -2.58563887e-07, 1.70044132e-07,-1.12263933e-07, 7.56690497e-08,-5.25369614e-08, 3.77673359e-08,
+    -2.71431020e-08, 1.67638419e-08,-6.38449649e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 60 */
+  {
+     3.22100817e-08, 1.99018701e-04, 1.26103200e-02, 1.62029594e-01,-1.44650504e-01, 2.02580309e-03,
+     5.03730401e-02,-4.71919999e-02, 2.50972006e-02,-2.84694810e-03,-1.21433400e-02, 1.90873798e-02,
+    -1.92993805e-02, 1.53499497e-02,-9.23679303e-03, 2.94206990e-03, 2.55097495e-03,-6.37790607e-03,
+     8.51502828e-03,-8.88720714e-03, 7.99533818e-03,-6.10414613e-03, 3.82739305e-03,-1.42544904e-03,
+    -6.36190001e-04, 2.27491092e-03,-3.26283206e-03, 3.71067994e-03,-3.58562707e-03, 3.10933590e-03,
+    -2.34069396e-03, 1.50583999e-03,-6.60076214e-04,-4.00882709e-05, 5.90474810e-04,-9.24853375e-04,
+     1.08692702e-03,-1.07962498e-03, 9.62632301e-04,-7.72535277e-04, 5.51330275e-04,-3.37945996e-04,
+     1.54883193e-04,-1.47098299e-05,-8.18412300e-05, 1.37720301e-04,-1.61456395e-04, 1.60664204e-04,
+    -1.44756006e-04, 1.19980199e-04,-9.28715090e-05, 6.64840991e-05,-4.39957112e-05, 2.57416996e-05,
+    -1.25703600e-05, 3.40943006e-06, 1.96833389e-06,-4.88783098e-06, 5.80248980e-06,-5.72382396e-06,
+     4.91280889e-06,-3.97375288e-06, 2.94105598e-06,-2.08110805e-06, 1.34209802e-06,-7.76697391e-07,
+     3.92662201e-07,-9.81624595e-08, 2.50895504e-09, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     8.83485995e-09, 1.75184978e-05, 6.41159713e-04, 5.15340269e-03,-6.13391399e-04, 3.11818812e-03,
+    -1.70433894e-03,-6.15045428e-06, 9.70778987e-04,-1.19566103e-03, 9.56780277e-04,-5.22220507e-04,
+     7.88103789e-05, 2.68620439e-04,-4.78700735e-04, 5.51857986e-04,-5.13031846e-04, 3.97781841e-04,
+    -2.43483111e-04, 8.28215852e-05, 5.89685515e-05,-1.65916979e-04, 2.30540987e-04,-2.53130915e-04,
+     2.39332410e-04,-1.98601978e-04, 1.41612953e-04,-7.90590420e-05, 1.97761692e-05, 2.95171048e-05,
+    -6.50929287e-05, 8.55530379e-05,-9.19582671e-05, 8.66611808e-05,-7.31576001e-05, 5.49005927e-05,
+    -3.53279756e-05, 1.69429695e-05,-1.69518171e-06,-9.60432226e-06, 1.66321406e-05,-1.97779154e-05,
+     1.98807102e-05,-1.79078997e-05, 1.47641622e-05,-1.11802947e-05, 7.69540202e-06,-4.64569894e-06,
+     2.20770016e-06,-4.20797733e-07,-7.56881491e-07, 1.42679346e-06,-1.70237763e-06, 1.70782005e-06,
+    -1.54635018e-06, 1.30067201e-06,-1.03251750e-06, 7.81149083e-07,-5.65386017e-07, 3.95345978e-07,
+    -2.66862116e-07, 1.78711844e-07,-1.17175887e-07, 7.92599621e-08,-5.39630491e-08, 3.96813675e-08,
+    -2.69826046e-08, 1.67638063e-08,-6.51925802e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 61 */
+  {
+     4.10449417e-08, 2.16537199e-04, 1.32514797e-02, 1.67182997e-01,-1.45263895e-01, 5.14399121e-03,
+     4.86687012e-02,-4.71981503e-02, 2.60679796e-02,-4.04260913e-03,-1.11865597e-02, 1.85651593e-02,
+    -1.92205701e-02, 1.56185701e-02,-9.71549377e-03, 3.49392788e-03, 2.03794311e-03,-5.98012423e-03,
+     8.27154517e-03,-8.80438555e-03, 8.05430673e-03,-6.27006311e-03, 4.05793404e-03,-1.67857995e-03,
+    -3.96857591e-04, 2.07630894e-03,-3.12121911e-03, 3.63162090e-03,-3.56585090e-03, 3.13885300e-03,
+    -2.40578689e-03, 1.59139303e-03,-7.52034481e-04, 4.65729099e-05, 5.17317210e-04,-8.69952783e-04,
+     1.05159904e-03,-1.06268201e-03, 9.60937119e-04,-7.82139599e-04, 5.67962416e-04,-3.57723911e-04,
+     1.74763903e-04,-3.26177287e-05,-6.70770678e-05, 1.26540006e-04,-1.53760993e-04, 1.56018505e-04,
+    -1.42548306e-04, 1.19559401e-04,-9.36283905e-05, 6.79108925e-05,-4.56980888e-05, 2.74495196e-05,
+    -1.41167102e-05, 4.71010208e-06, 9.35816388e-07,-4.10668190e-06, 5.23710378e-06,-5.32847798e-06,
+     4.64594677e-06,-3.79504104e-06, 2.82388010e-06,-2.00184809e-06, 1.28813497e-06,-7.37016023e-07,
+     3.65679597e-07,-8.13986532e-08,-4.01030320e-09, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.08696376e-08, 1.88638078e-05, 6.68720342e-04, 5.27790189e-03,-4.67509031e-04, 3.07321688e-03,
+    -1.75005198e-03, 5.97797334e-05, 9.25879925e-04,-1.18280668e-03, 9.70399939e-04,-5.50938770e-04,
+     1.11399218e-04, 2.40499154e-04,-4.59835865e-04, 5.43833245e-04,-5.15047112e-04, 4.07512300e-04,
+    -2.57919542e-04, 9.89167020e-05, 4.38243151e-05,-1.53641682e-04, 2.22243834e-04,-2.49149045e-04,
+     2.39363697e-04,-2.01884890e-04, 1.47129176e-04,-8.57138075e-05, 2.65638810e-05, 2.33999453e-05,
+    -6.02002256e-05, 8.21700087e-05,-9.01279273e-05, 8.62294837e-05,-7.38449162e-05, 5.63628855e-05,
+    -3.72159993e-05, 1.89449638e-05,-3.56911914e-06,-8.02049180e-06, 1.54236914e-05,-1.89619022e-05,
+     1.94211898e-05,-1.77391412e-05, 1.48082472e-05,-1.13664064e-05, 7.95669621e-06,-4.93270636e-06,
+     2.48171273e-06,-6.61399099e-07,-5.60619810e-07, 1.27726526e-06,-1.59675255e-06, 1.63845107e-06,
+    -1.50534925e-06, 1.28123611e-06,-1.02711738e-06, 7.82445795e-07,-5.71846613e-07, 4.02577825e-07,
+    -2.74786998e-07, 1.84513965e-07,-1.23638983e-07, 8.29861619e-08,-5.74340220e-08, 4.10616394e-08,
+    -2.72239049e-08, 1.67638063e-08,-6.51925713e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 62 */
+  {
+     5.19145793e-08, 2.35401007e-04, 1.39202001e-02, 1.72460899e-01,-1.45731404e-01, 8.21720809e-03,
+     4.69186492e-02,-4.71383706e-02, 2.69938596e-02,-5.22541581e-03,-1.02161597e-02, 1.80142205e-02,
+    -1.91091709e-02, 1.58590693e-02,-1.01753296e-02, 4.03776113e-03, 1.52289600e-03,-5.57261193e-03,
+     8.01362563e-03,-8.70546885e-03, 8.09813105e-03,-6.42370479e-03, 4.28017788e-03,-1.92772900e-03,
+    -1.57493894e-04, 1.87442405e-03,-2.97408993e-03, 3.54590709e-03,-3.53928702e-03, 3.16225295e-03,
+    -2.46598711e-03, 1.67356303e-03,-8.42162408e-04, 1.32802394e-04, 4.43472294e-04,-8.13589897e-04,
+     1.01438304e-03,-1.04373705e-03, 9.57368000e-04,-7.90160091e-04, 5.83386107e-04,-3.76685814e-04,
+     1.94185093e-04,-5.03568699e-05,-5.22688206e-05, 1.15173600e-04,-1.45804297e-04, 1.51085798e-04,
+    -1.40066593e-04, 1.18898002e-04,-9.41890103e-05, 6.91881578e-05,-4.72948414e-05, 2.90879707e-05,
+    -1.56220594e-05, 5.99133818e-06,-9.13009330e-08,-3.32423610e-06, 4.66525717e-06,-4.92590016e-06,
+     4.37115978e-06,-3.61052707e-06, 2.70024111e-06,-1.91886193e-06, 1.23070095e-06,-6.95954384e-07,
+     3.38455692e-07,-6.46348468e-08,-1.05295603e-08, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.32907481e-08, 2.02975061e-05, 6.97219744e-04, 5.40399551e-03,-3.23101878e-04, 3.02554201e-03,
+    -1.79325044e-03, 1.25199556e-04, 8.79859552e-04,-1.16818398e-03, 9.82409343e-04,-5.78610227e-04,
+     1.43671408e-04, 2.12050974e-04,-4.40210104e-04, 5.34862746e-04,-5.16123022e-04, 4.16469760e-04,
+    -2.71835830e-04, 1.14783645e-04, 2.86437571e-05,-1.41113065e-04, 2.13552266e-04,-2.44708033e-04,
+     2.38942011e-04,-2.04774085e-04, 1.52342953e-04,-9.21811443e-05, 3.32810450e-05, 1.72581058e-05,
+    -5.52099664e-05, 7.86409946e-05,-8.81298911e-05, 8.56328115e-05,-7.43861892e-05, 5.77091123e-05,
+    -3.90196219e-05, 2.09000427e-05,-5.42780617e-06,-6.42728992e-06, 1.41916680e-05,-1.81122741e-05,
+     1.89234997e-05,-1.75358691e-05, 1.48243598e-05,-1.15282019e-05, 8.19969864e-06,-5.20629692e-06,
+     2.74988997e-06,-8.99701263e-07,-3.64831067e-07, 1.12583075e-06,-1.48874824e-06, 1.56675924e-06,
+    -1.46096136e-06, 1.25823362e-06,-1.01806017e-06, 7.82362122e-07,-5.77745141e-07, 4.09597305e-07,
+    -2.81412667e-07, 1.91668050e-07,-1.28971124e-07, 8.67099743e-08,-5.94039875e-08, 4.13577936e-08,
+    -2.80070935e-08, 1.68152283e-08,-6.51925891e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ },
+ { /* phase 63 */
+  {
+     6.52053274e-08, 2.55698513e-04, 1.46174198e-02, 1.77864894e-01,-1.46054506e-01, 1.12427501e-02,
+     4.51253988e-02,-4.70131710e-02, 2.78737191e-02,-6.39359979e-03,-9.23375040e-03, 1.74356103e-02,
+    -1.89654995e-02, 1.60711203e-02,-1.06155397e-02, 4.57262387e-03, 1.00677297e-03,-5.15614217e-03,
+     7.74178980e-03,-8.59068520e-03, 8.12677480e-03,-6.56481786e-03, 4.49373014e-03,-2.17243703e-03,
+     8.14481100e-05, 1.66964997e-03,-2.82174698e-03, 3.45372595e-03,-3.50600597e-03, 3.17951106e-03,
+    -2.52119708e-03, 1.75220403e-03,-9.30292299e-04, 2.18435205e-04, 3.69086105e-04,-7.55880785e-04,
+     9.75363422e-04,-1.02283701e-03, 9.51940194e-04,-7.96587381e-04, 5.97577775e-04,-3.94798088e-04,
+     2.13108593e-04,-6.78927390e-05,-3.74444608e-05, 1.03645398e-04,-1.37604598e-04, 1.45879501e-04,
+    -1.37316703e-04, 1.17998301e-04,-9.45538413e-05, 7.03139885e-05,-4.87835896e-05, 3.06547299e-05,
+    -1.70830208e-05, 7.24957181e-06,-1.10936105e-06,-2.54187398e-06, 4.08751202e-06,-4.51630285e-06,
+     4.08974711e-06,-3.41885902e-06, 2.57126999e-06,-1.83215195e-06, 1.17129696e-06,-6.54596590e-07,
+     3.10448598e-07,-4.78196185e-08,-1.70488192e-08, 5.18070102e-08, 0.00000000e+00, 0.00000000e+00
+  },
+  {
+     1.61574292e-08, 2.18239729e-05, 7.26690516e-04, 5.53180277e-03,-1.80497766e-04, 2.97520962e-03,
+    -1.83391944e-03, 1.90030783e-04, 8.32801685e-04,-1.15181832e-03, 9.92784277e-04,-6.05219975e-04,
+     1.75580382e-04, 1.83340162e-04,-4.19870019e-04, 5.24963252e-04,-5.16262953e-04, 4.24642116e-04,
+    -2.85215676e-04, 1.30392611e-04, 1.34548172e-05,-1.28359068e-04, 2.04481650e-04,-2.39817891e-04,
+     2.38066888e-04,-2.07261997e-04, 1.57250091e-04,-9.84510407e-05, 3.99108976e-05, 1.11069530e-05,
+    -5.01328614e-05, 7.49760075e-05,-8.59687570e-05, 8.48720811e-05,-7.47794111e-05, 5.89370029e-05,
+    -4.07421030e-05, 2.28050631e-05,-7.26612052e-06,-4.83094482e-06, 1.29378168e-05,-1.72314176e-05,
+     1.83923112e-05,-1.72983782e-05, 1.48105501e-05,-1.16662486e-05, 8.42560257e-06,-5.46879892e-06,
+     3.01050022e-06,-1.13379792e-06,-1.68671249e-07, 9.73013812e-07,-1.37676034e-06, 1.49118932e-06,
+    -1.41464989e-06, 1.23355721e-06,-1.00754289e-06, 7.81982976e-07,-5.81079121e-07, 4.15050636e-07,
+    -2.88767069e-07, 1.97172085e-07,-1.33318053e-07, 9.04869921e-08,-6.20489118e-08, 4.34067715e-08,
+    -2.79397057e-08, 1.63326987e-08,-6.57067112e-09, 0.00000000e+00, 0.00000000e+00, 0.00000000e+00
+  }
+ }
 };
-
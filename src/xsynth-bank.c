@@ -0,0 +1,329 @@
+/* Xsynth DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* xsynth-bank converts between .Xsynth text patch files and binary
+ * patch banks (see xsynth_bank.h), lists and checks binary banks, and
+ * checks that patches survive the trip from text to a binary bank and
+ * back unchanged.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "xsynth_types.h"
+#include "xsynth_voice.h"
+#include "xsynth_bank.h"
+#include "gui_data.h"
+
+static void
+usage(const char *program_name)
+{
+    fprintf(stderr, "usage: %s -b <bank file> <patch file>...\n"
+"       %s -t <patch file> <bank file>...\n"
+"       %s -l <bank file>...\n"
+"       %s -c <bank file>...\n"
+"       %s -r <patch file>...\n"
+"options:\n"
+"  -b <bank file>   convert the .Xsynth text patch files to a binary bank\n"
+"  -t <patch file>  convert the binary banks to a .Xsynth text patch file\n"
+"  -l               list the patches in each binary bank\n"
+"  -c               check each binary bank's header, index and patch records\n"
+"  -r               check that the patches in each text patch file come\n"
+"                     back unchanged from a binary bank, and are written\n"
+"                     out as the same text\n",
+            program_name, program_name, program_name, program_name, program_name);
+    exit(1);
+}
+
+/*
+ * read_text
+ *
+ * append the patches in a text patch file to 'patches', returning the
+ * new count, or -1 on error
+ */
+static long
+read_text(FILE *fh, xsynth_patch_t **patches, long count, long *space)
+{
+    for (;;) {
+        if (count == *space) {
+            *space = *space ? *space * 2 : 128;
+            *patches = (xsynth_patch_t *)realloc(*patches, *space * sizeof(xsynth_patch_t));
+            if (!*patches) {
+                fprintf(stderr, "xsynth-bank: out of memory!\n");
+                return -1;
+            }
+        }
+        if (!xsynth_data_read_patch(fh, &(*patches)[count]))
+            return count;
+        count++;
+    }
+}
+
+/*
+ * open_bank
+ */
+static int
+open_bank(xsynth_bank_t *bank, const char *filename)
+{
+    const char *message = "not a binary patch bank";
+
+    if (xsynth_bank_open(bank, filename, &message) != 1) {
+        fprintf(stderr, "xsynth-bank: '%s': %s\n", filename, message);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * write_text
+ *
+ * write patches to a temporary text file, returning it rewound
+ */
+static FILE *
+write_text(xsynth_patch_t *patches, long count)
+{
+    FILE *fh = tmpfile();
+    long i;
+
+    if (!fh) {
+        fprintf(stderr, "xsynth-bank: could not create temporary file\n");
+        return NULL;
+    }
+    for (i = 0; i < count; i++)
+        xsynth_data_write_patch(fh, &patches[i]);
+    rewind(fh);
+    return fh;
+}
+
+/*
+ * round_trip
+ *
+ * read a text patch file into patches A, write them to a binary bank,
+ * and read that into patches B.  B must match A exactly, and text
+ * written from B must match text written from A byte for byte.  (Text
+ * written from A needn't match the original file, since the text format
+ * keeps only six significant digits.)
+ */
+static int
+round_trip(const char *filename)
+{
+    xsynth_patch_t *a = NULL, *b = NULL;
+    long count, space = 0, i;
+    char bank_name[] = "/tmp/xsynth-bank-XXXXXX";
+    xsynth_bank_t bank;
+    FILE *fh, *text_a, *text_b;
+    int fd, ca, cb, errors = 0;
+
+    if ((fh = fopen(filename, "r")) == NULL) {
+        fprintf(stderr, "xsynth-bank: could not open patch file '%s'\n", filename);
+        return 0;
+    }
+    count = read_text(fh, &a, 0, &space);
+    fclose(fh);
+    if (count <= 0) {
+        fprintf(stderr, "xsynth-bank: no patches recognized in '%s'\n", filename);
+        free(a);
+        return 0;
+    }
+
+    /* to a binary bank and back */
+    if ((fd = mkstemp(bank_name)) < 0 || (fh = fdopen(fd, "wb")) == NULL ||
+        !xsynth_bank_write(fh, a, count) || fclose(fh)) {
+        fprintf(stderr, "xsynth-bank: could not write temporary bank '%s'\n", bank_name);
+        free(a);
+        return 0;
+    }
+    i = open_bank(&bank, bank_name);
+    unlink(bank_name);
+    if (!i || !(b = (xsynth_patch_t *)malloc(count * sizeof(xsynth_patch_t)))) {
+        if (i) xsynth_bank_close(&bank);
+        free(a);
+        return 0;
+    }
+    if (bank.patch_count != count || !xsynth_bank_verify(&bank, NULL)) {
+        fprintf(stderr, "xsynth-bank: '%s': bank has %lu patches, expected %ld, or is damaged\n",
+                filename, bank.patch_count, count);
+        errors++;
+    } else {
+        for (i = 0; i < count; i++) {
+            if (!xsynth_bank_read_patch(&bank, i, &b[i]) ||
+                strcmp(xsynth_bank_patch_name(&bank, i), a[i].name) ||
+                !xsynth_data_patch_compare(&a[i], &b[i])) {
+                fprintf(stderr, "xsynth-bank: '%s': patch %ld '%s' changed in the binary bank\n",
+                        filename, i, a[i].name);
+                errors++;
+            }
+        }
+    }
+    xsynth_bank_close(&bank);
+
+    /* and to text */
+    if (!errors) {
+        if (!(text_a = write_text(a, count)) || !(text_b = write_text(b, count))) {
+            if (text_a) fclose(text_a);
+            errors++;
+        } else {
+            do {
+                ca = getc(text_a);
+                cb = getc(text_b);
+            } while (ca == cb && ca != EOF);
+            if (ca != cb) {
+                fprintf(stderr, "xsynth-bank: '%s': text written from the binary bank differs\n",
+                        filename);
+                errors++;
+            }
+            fclose(text_a);
+            fclose(text_b);
+        }
+    }
+    free(a);
+    free(b);
+
+    if (errors)
+        return 0;
+    printf("%s: %ld patches round-trip unchanged\n", filename, count);
+    return 1;
+}
+
+int
+main(int argc, char **argv)
+{
+    xsynth_patch_t *patches = NULL, patch;
+    xsynth_bank_t bank;
+    const char *output = NULL, *message;
+    long count = 0, space = 0;
+    unsigned long i;
+    FILE *fh;
+    int c, mode = 0, failed = 0;
+
+    while ((c = getopt(argc, argv, "b:t:lcr")) != -1) {
+        if (mode)
+            usage(argv[0]);
+        mode = c;
+        switch (c) {
+          case 'b':
+          case 't':
+            output = optarg;
+            break;
+          case 'l':
+          case 'c':
+          case 'r':
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (!mode || optind == argc)
+        usage(argv[0]);
+
+    switch (mode) {
+
+      case 'b':  /* text to binary */
+        for (; optind < argc; optind++) {
+            long n = count;
+
+            if ((fh = fopen(argv[optind], "r")) == NULL) {
+                fprintf(stderr, "xsynth-bank: could not open patch file '%s'\n", argv[optind]);
+                return 1;
+            }
+            count = read_text(fh, &patches, count, &space);
+            fclose(fh);
+            if (count < 0)
+                return 1;
+            if (count == n)
+                fprintf(stderr, "xsynth-bank: warning: no patches recognized in '%s'\n",
+                        argv[optind]);
+        }
+        if ((fh = fopen(output, "wb")) == NULL ||
+            !xsynth_bank_write(fh, patches, count) || fclose(fh)) {
+            fprintf(stderr, "xsynth-bank: could not write bank file '%s'\n", output);
+            return 1;
+        }
+        printf("wrote %ld patches\n", count);
+        break;
+
+      case 't':  /* binary to text */
+        if ((fh = fopen(output, "w")) == NULL) {
+            fprintf(stderr, "xsynth-bank: could not open '%s' for writing\n", output);
+            return 1;
+        }
+        for (; optind < argc; optind++) {
+            if (!open_bank(&bank, argv[optind]))
+                return 1;
+            for (i = 0; i < bank.patch_count; i++) {
+                if (!xsynth_bank_read_patch(&bank, i, &patch)) {
+                    fprintf(stderr, "xsynth-bank: '%s': patch %lu is damaged\n",
+                            argv[optind], i);
+                    return 1;
+                }
+                xsynth_data_write_patch(fh, &patch);
+                count++;
+            }
+            xsynth_bank_close(&bank);
+        }
+        if (fclose(fh)) {
+            fprintf(stderr, "xsynth-bank: error while writing '%s'\n", output);
+            return 1;
+        }
+        printf("wrote %ld patches\n", count);
+        break;
+
+      case 'l':  /* list */
+        for (; optind < argc; optind++) {
+            if (!open_bank(&bank, argv[optind]))
+                return 1;
+            for (i = 0; i < bank.patch_count; i++)
+                printf("%lu %s\n", i, xsynth_bank_patch_name(&bank, i));
+            xsynth_bank_close(&bank);
+        }
+        break;
+
+      case 'c':  /* check */
+        for (; optind < argc; optind++) {
+            if (!open_bank(&bank, argv[optind])) {
+                failed = 1;
+                continue;
+            }
+            if (!xsynth_bank_verify(&bank, &message)) {
+                fprintf(stderr, "xsynth-bank: '%s': %s\n", argv[optind], message);
+                failed = 1;
+            } else
+                printf("%s: %lu patches, all checksums good\n", argv[optind],
+                       bank.patch_count);
+            xsynth_bank_close(&bank);
+        }
+        break;
+
+      case 'r':  /* round trip */
+        for (; optind < argc; optind++)
+            if (!round_trip(argv[optind]))
+                failed = 1;
+        break;
+    }
+
+    free(patches);
+    return failed;
+}
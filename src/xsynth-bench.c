@@ -0,0 +1,600 @@
+/* Xsynth DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* xsynth-bench renders the plugin offline, without a DSSI host, audio
+ * hardware, or GUI, and reports how long it took.  It links the plugin
+ * core directly and plays the part of a (very simple) host: it loads a
+ * patch from a .Xsynth patch file or binary bank, drives a scripted MIDI event stream
+ * through run_synth() at the requested block size, sample rate and
+ * polyphony, and optionally writes the result to a WAV file.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <ladspa.h>
+#include "dssi.h"
+
+#include "xsynth_types.h"
+#include "xsynth.h"
+#include "xsynth_ports.h"
+#include "xsynth_synth.h"
+#include "xsynth_voice.h"
+#include "gui_data.h"
+#include "xsynth_bank.h"
+
+struct bench_event {
+    unsigned long   sample;  /* absolute time, in samples */
+    int             order;   /* position in script, to keep sorting stable */
+    snd_seq_event_t event;
+};
+
+static struct bench_event *events = NULL;
+static int                 event_count = 0;
+static int                 event_space = 0;
+
+static void
+usage(const char *program_name)
+{
+    fprintf(stderr, "usage: %s [options] <patch file or binary bank>\n"
+"       %s -E\n"
+"options:\n"
+"  -p <n>          use the n'th patch in the patch file (default 0)\n"
+"  -r <rate>       sample rate in Hz (default 44100)\n"
+"  -b <size>       block size in samples (default 256)\n"
+"  -v <voices>     polyphony (default 16)\n"
+"  -d <seconds>    length to render (default 10, or the script length)\n"
+"  -e <engine>     render engine, as for the 'render' configure key\n"
+"  -c <key>=<val>  send an arbitrary configure key (may be repeated)\n"
+"  -P              turn on per-stage profiling, and report the results\n"
+"  -n <instances>  run several instances, all playing the same events\n"
+"  -a <gain>       use the run-adding entry points, at the given gain\n"
+"  -m              run multiple instances with one run_multiple_synths()\n"
+"                    call per block, instead of calling run_synth() for each\n"
+"  -s <script>     read MIDI events from a script file, instead of\n"
+"                    playing repeated chords of <voices> notes\n"
+"  -w <file.wav>   write the rendered output (mixed, if more than one\n"
+"                    instance) to a WAV file\n"
+"  -E              instead of benchmarking, check the envelope renderer\n"
+"                    against the per-sample envelope recurrence\n"
+"script lines look like '<seconds> <event> <args>', where <event> is one of:\n"
+"  on <key> <velocity>, off <key>, cc <controller> <value>,\n"
+"  keypressure <key> <value>, pressure <value>, bend <value>, or end\n",
+            program_name, program_name);
+    exit(1);
+}
+
+/*
+ * check_envelopes
+ *
+ * check the envelope renderer against the per-sample recurrence it
+ * replaced, over a grid of attack and decay rates down to the slowest
+ * the ports allow.  Every value must be within EG_TOLERANCE of the
+ * recurrence's, and the flip from attack to decay within EG_FLIP_SAMPLES
+ * of its flip.  Where the exact curve would flip is shown for comparison.
+ */
+#define EG_TOLERANCE     2e-3f
+#define EG_FLIP_SAMPLES  2
+#define EG_LENGTH        600000
+#define EG_RELEASE       576000
+
+static int
+check_envelopes(void)
+{
+    static const float rates[] = { 0.5f, 0.01f, 1e-3f, 1e-4f, 2e-5f, 1e-5f };
+    unsigned int a, d;
+    int failed = 0;
+    long flips[3];
+    float diff;
+
+    printf("attack  decay   max diff  flip: render  recurrence  exact\n");
+    for (a = 0; a < sizeof(rates) / sizeof(rates[0]); a++) {
+        for (d = 0; d < sizeof(rates) / sizeof(rates[0]); d++) {
+            diff = xsynth_voice_check_eg(rates[a], rates[d], 0.3f, EG_LENGTH,
+                                         EG_RELEASE, flips);
+            printf("%-7g %-7g %-9.3g       %-7ld %-11ld %ld", rates[a], rates[d],
+                   diff, flips[0], flips[1], flips[2]);
+            if (!(diff <= EG_TOLERANCE) || (flips[0] < 0) != (flips[1] < 0) ||
+                labs(flips[0] - flips[1]) > EG_FLIP_SAMPLES) {
+                printf("  FAILED");
+                failed = 1;
+            }
+            printf("\n");
+        }
+    }
+    printf(failed ? "envelope check failed\n" : "envelope check passed\n");
+    return failed;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static snd_seq_event_t *
+add_event(double seconds, unsigned long sample_rate, int type)
+{
+    struct bench_event *be;
+
+    if (event_count == event_space) {
+        event_space = event_space ? event_space * 2 : 256;
+        events = (struct bench_event *)realloc(events, event_space * sizeof(struct bench_event));
+        if (!events) {
+            fprintf(stderr, "xsynth-bench: out of memory!\n");
+            exit(1);
+        }
+    }
+    be = &events[event_count];
+    memset(be, 0, sizeof(struct bench_event));
+    be->sample = (unsigned long)(seconds * (double)sample_rate + 0.5);
+    be->order = event_count++;
+    be->event.type = type;
+    return &be->event;
+}
+
+static int
+event_compare(const void *a, const void *b)
+{
+    const struct bench_event *ea = (const struct bench_event *)a,
+                             *eb = (const struct bench_event *)b;
+
+    if (ea->sample != eb->sample)
+        return (ea->sample < eb->sample ? -1 : 1);
+    return ea->order - eb->order;
+}
+
+/*
+ * read_script
+ *
+ * parse a MIDI event script, returning the script length in seconds
+ * (the time of the last event, or of an 'end' line), or -1 on error
+ */
+static double
+read_script(const char *filename, unsigned long sample_rate)
+{
+    FILE *fh;
+    char buf[256], name[16];
+    double t, length = 0.0;
+    int line = 0, a, b, n;
+    snd_seq_event_t *ev;
+
+    if ((fh = fopen(filename, "r")) == NULL) {
+        fprintf(stderr, "xsynth-bench: could not open script '%s'\n", filename);
+        return -1.0;
+    }
+    while (fgets(buf, 256, fh)) {
+        line++;
+        if ((n = sscanf(buf, " %lf %15s %d %d", &t, name, &a, &b)) < 2) {
+            if (sscanf(buf, " %1s", name) < 1 || name[0] == '#')
+                continue;  /* blank line or comment */
+            goto bad_line;
+        }
+        if (t < 0.0)
+            goto bad_line;
+        if (t > length)
+            length = t;
+        if (!strcmp(name, "on") && n == 4) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_NOTEON);
+            ev->data.note.note = a & 127;
+            ev->data.note.velocity = b & 127;
+        } else if (!strcmp(name, "off") && n >= 3) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_NOTEOFF);
+            ev->data.note.note = a & 127;
+            ev->data.note.velocity = 64;
+        } else if (!strcmp(name, "cc") && n == 4) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_CONTROLLER);
+            ev->data.control.param = a & 127;
+            ev->data.control.value = b & 127;
+        } else if (!strcmp(name, "keypressure") && n == 4) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_KEYPRESS);
+            ev->data.note.note = a & 127;
+            ev->data.note.velocity = b & 127;
+        } else if (!strcmp(name, "pressure") && n == 3) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_CHANPRESS);
+            ev->data.control.value = a & 127;
+        } else if (!strcmp(name, "bend") && n == 3) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_PITCHBEND);
+            ev->data.control.value = (a < -8192 ? -8192 : a > 8191 ? 8191 : a);
+        } else if (!strcmp(name, "end") && n == 2) {
+            /* only sets the length */
+        } else
+            goto bad_line;
+    }
+    fclose(fh);
+    return length;
+
+  bad_line:
+    fprintf(stderr, "xsynth-bench: bad event in script '%s', line %d\n", filename, line);
+    fclose(fh);
+    return -1.0;
+}
+
+/*
+ * default_script
+ *
+ * every half second, release the previous chord and play a new chord of
+ * 'voices' notes, so that the synth stays at (or near) full polyphony
+ */
+static void
+default_script(double length, int voices, unsigned long sample_rate)
+{
+    double t;
+    int i, chord = 0, key = 0;
+    snd_seq_event_t *ev;
+
+    for (t = 0.0; t < length - 0.5; t += 0.5, chord++) {
+        for (i = 0; i < voices; i++) {
+            if (chord > 0) {
+                ev = add_event(t, sample_rate, SND_SEQ_EVENT_NOTEOFF);
+                ev->data.note.note = 36 + (key + i * 7) % 60;
+                ev->data.note.velocity = 64;
+            }
+        }
+        key = (key + 5) % 60;
+        for (i = 0; i < voices; i++) {
+            ev = add_event(t, sample_rate, SND_SEQ_EVENT_NOTEON);
+            ev->data.note.note = 36 + (key + i * 7) % 60;
+            ev->data.note.velocity = 64 + (i * 23) % 64;
+        }
+    }
+    for (i = 0; i < voices; i++) {
+        ev = add_event(t, sample_rate, SND_SEQ_EVENT_NOTEOFF);
+        ev->data.note.note = 36 + (key + i * 7) % 60;
+        ev->data.note.velocity = 64;
+    }
+}
+
+static void
+put_le16(FILE *fh, unsigned int v)
+{
+    fputc(v & 0xff, fh);
+    fputc((v >> 8) & 0xff, fh);
+}
+
+static void
+put_le32(FILE *fh, unsigned long v)
+{
+    put_le16(fh, v & 0xffff);
+    put_le16(fh, (v >> 16) & 0xffff);
+}
+
+/*
+ * write_wav
+ *
+ * write mono 32-bit IEEE float samples to a WAV file
+ */
+static int
+write_wav(const char *filename, float *buffer, unsigned long sample_count,
+          unsigned long sample_rate)
+{
+    FILE *fh;
+    unsigned long i;
+    union { float f; unsigned int i; } u;
+
+    if ((fh = fopen(filename, "wb")) == NULL)
+        return 0;
+
+    fwrite("RIFF", 1, 4, fh);
+    put_le32(fh, 4 + 8 + 16 + 8 + 4 + 8 + sample_count * 4);
+    fwrite("WAVEfmt ", 1, 8, fh);
+    put_le32(fh, 16);
+    put_le16(fh, 3);                /* WAVE_FORMAT_IEEE_FLOAT */
+    put_le16(fh, 1);                /* channels */
+    put_le32(fh, sample_rate);
+    put_le32(fh, sample_rate * 4);  /* bytes per second */
+    put_le16(fh, 4);                /* block align */
+    put_le16(fh, 32);               /* bits per sample */
+    fwrite("fact", 1, 4, fh);
+    put_le32(fh, 4);
+    put_le32(fh, sample_count);
+    fwrite("data", 1, 4, fh);
+    put_le32(fh, sample_count * 4);
+    for (i = 0; i < sample_count; i++) {
+        u.f = buffer[i];
+        put_le32(fh, u.i);
+    }
+
+    return (fclose(fh) == 0);
+}
+
+#define MAX_INSTANCES  64
+
+int
+main(int argc, char *argv[])
+{
+    const DSSI_Descriptor *dssi;
+    const LADSPA_Descriptor *ladspa;
+    LADSPA_Handle instance[MAX_INSTANCES];
+    xsynth_synth_t *synth;
+    xsynth_patch_t patch;
+    xsynth_bank_t bank;
+    const char *bank_message;
+    LADSPA_Data ports[XSYNTH_PORTS_COUNT];
+    snd_seq_event_t *block_events, *event_lists[MAX_INSTANCES];
+    unsigned long event_counts[MAX_INSTANCES];
+    float *output[MAX_INSTANCES];
+    FILE *fh;
+    char *message, buf[256];
+    int c, i, j, count;
+    int patch_number = 0, polyphony = 16, instances = 1, multiple = 0;
+    unsigned long sample_rate = 44100, block_size = 256;
+    unsigned long total, pos, n, next_event, voice_samples = 0, retired = 0;
+    int silence = 0;
+    double length = -1.0, t, elapsed = 0.0, worst = 0.0;
+    const char *engine = NULL, *script = NULL, *wav = NULL;
+    const char *configure_keys[32];
+    int configure_count = 0;
+    int profile = 0;
+    int adding = 0;
+    float gain = 1.0f;
+
+    while ((c = getopt(argc, argv, "p:r:b:v:d:e:c:s:w:Pn:ma:E")) != -1) {
+        switch (c) {
+          case 'E': return check_envelopes();
+          case 'p': patch_number = atoi(optarg);               break;
+          case 'r': sample_rate = strtoul(optarg, NULL, 10);   break;
+          case 'b': block_size = strtoul(optarg, NULL, 10);    break;
+          case 'v': polyphony = atoi(optarg);                  break;
+          case 'd': length = atof(optarg);                     break;
+          case 'e': engine = optarg;                           break;
+          case 's': script = optarg;                           break;
+          case 'w': wav = optarg;                              break;
+          case 'P': profile = 1;                               break;
+          case 'n': instances = atoi(optarg);                  break;
+          case 'm': multiple = 1;                              break;
+          case 'a': adding = 1; gain = atof(optarg);           break;
+          case 'c':
+            if (configure_count == 32 || !strchr(optarg, '='))
+                usage(argv[0]);
+            configure_keys[configure_count++] = optarg;
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1 || patch_number < 0 || sample_rate < 8000 ||
+        block_size < 1 || polyphony < 1 || polyphony > XSYNTH_MAX_POLYPHONY ||
+        instances < 1 || instances > MAX_INSTANCES)
+        usage(argv[0]);
+
+    /* load the patch, from a binary bank or a text patch file */
+    switch (xsynth_bank_open(&bank, argv[optind], &bank_message)) {
+
+      case 1:
+        if (patch_number >= bank.patch_count ||
+            !xsynth_bank_read_patch(&bank, patch_number, &patch)) {
+            fprintf(stderr, "xsynth-bench: could not read patch %d from '%s'\n",
+                    patch_number, argv[optind]);
+            return 1;
+        }
+        xsynth_bank_close(&bank);
+        break;
+
+      case -1:
+        fprintf(stderr, "xsynth-bench: '%s': %s\n", argv[optind], bank_message);
+        return 1;
+
+      default:
+        if ((fh = fopen(argv[optind], "r")) == NULL) {
+            fprintf(stderr, "xsynth-bench: could not open patch file '%s'\n", argv[optind]);
+            return 1;
+        }
+        for (i = 0; i <= patch_number; i++) {
+            if (!xsynth_data_read_patch(fh, &patch)) {
+                fprintf(stderr, "xsynth-bench: could not read patch %d from '%s'\n",
+                        i, argv[optind]);
+                return 1;
+            }
+        }
+        fclose(fh);
+        break;
+    }
+
+    /* set up the MIDI event stream */
+    if (script) {
+        t = read_script(script, sample_rate);
+        if (t < 0.0)
+            return 1;
+        if (length < 0.0)
+            length = t;
+    } else {
+        if (length < 0.0)
+            length = 10.0;
+        default_script(length, polyphony, sample_rate);
+    }
+    qsort(events, event_count, sizeof(struct bench_event), event_compare);
+    total = (unsigned long)(length * (double)sample_rate + 0.5);
+    if (total == 0) {
+        fprintf(stderr, "xsynth-bench: nothing to render\n");
+        return 1;
+    }
+
+    block_events = (snd_seq_event_t *)malloc((event_count + 1) * sizeof(snd_seq_event_t));
+    if (!block_events) {
+        fprintf(stderr, "xsynth-bench: out of memory!\n");
+        return 1;
+    }
+
+    /* instantiate the plugin, and do what a host would.  All instances
+     * share the same control ports, and play the same events. */
+    dssi = dssi_descriptor(0);
+    ladspa = dssi->LADSPA_Plugin;
+    for (j = 0; j < instances; j++) {
+        instance[j] = ladspa->instantiate(ladspa, sample_rate);
+        if (!instance[j]) {
+            fprintf(stderr, "xsynth-bench: could not instantiate plugin\n");
+            return 1;
+        }
+        synth = (xsynth_synth_t *)instance[j];
+
+        output[j] = (float *)calloc(wav ? total : block_size, sizeof(float));
+        if (!output[j]) {
+            fprintf(stderr, "xsynth-bench: out of memory!\n");
+            return 1;
+        }
+
+        for (i = 1; i < XSYNTH_PORTS_COUNT; i++)
+            ladspa->connect_port(instance[j], i, &ports[i]);
+        xsynth_voice_set_ports(synth, &patch);
+        ports[XSYNTH_PORT_TUNING] = 440.0f;
+
+        snprintf(buf, 256, "%d", polyphony);
+        message = dssi->configure(instance[j], "polyphony", buf);
+        if (message) {
+            fprintf(stderr, "xsynth-bench: polyphony: %s\n", message);
+            return 1;
+        }
+        if (engine && (message = dssi->configure(instance[j], "render", engine))) {
+            fprintf(stderr, "xsynth-bench: render: %s\n", message);
+            return 1;
+        }
+        for (i = 0; i < configure_count; i++) {
+            char *value = strchr(configure_keys[i], '=');
+            snprintf(buf, 256, "%.*s", (int)(value - configure_keys[i]), configure_keys[i]);
+            message = dssi->configure(instance[j], buf, value + 1);
+            if (message) {
+                if (j == 0)
+                    fprintf(stderr, "xsynth-bench: configure %s: %s\n", buf, message);
+                free(message);  /* may be informational, so keep going */
+            }
+        }
+
+        if (profile && (message = dssi->configure(instance[j], "profile", "on"))) {
+            fprintf(stderr, "xsynth-bench: profile: %s\n", message);
+            return 1;
+        }
+
+        if (adding)
+            ladspa->set_run_adding_gain(instance[j], gain);
+
+        ladspa->activate(instance[j]);
+    }
+
+    /* render */
+    next_event = 0;
+    for (pos = 0; pos < total; pos += n) {
+        double start, block_time;
+
+        n = (total - pos < block_size ? total - pos : block_size);
+
+        count = 0;
+        while (next_event < event_count && events[next_event].sample < pos + n) {
+            block_events[count] = events[next_event].event;
+            block_events[count].time.tick = (events[next_event].sample > pos ?
+                                             events[next_event].sample - pos : 0);
+            count++;
+            next_event++;
+        }
+
+        for (j = 0; j < instances; j++) {
+            ladspa->connect_port(instance[j], XSYNTH_PORT_OUTPUT,
+                                 wav ? output[j] + pos : output[j]);
+            event_lists[j] = block_events;
+            event_counts[j] = count;
+        }
+
+        start = now();
+        if (multiple && adding)
+            dssi->run_multiple_synths_adding(instances, instance, n, event_lists, event_counts);
+        else if (multiple)
+            dssi->run_multiple_synths(instances, instance, n, event_lists, event_counts);
+        else if (adding)
+            for (j = 0; j < instances; j++)
+                dssi->run_synth_adding(instance[j], n, block_events, count);
+        else
+            for (j = 0; j < instances; j++)
+                dssi->run_synth(instance[j], n, block_events, count);
+        block_time = now() - start;
+
+        elapsed += block_time;
+        if (block_time > worst)
+            worst = block_time;
+        for (j = 0; j < instances; j++) {
+            synth = (xsynth_synth_t *)instance[j];
+            for (i = 0; i < synth->voices; i++)
+                if (_PLAYING(synth->voice[i]))
+                    voice_samples += n;
+        }
+    }
+
+    if (profile)
+        message = dssi->configure(instance[0], "profile", "report");
+    for (j = 0; j < instances; j++) {
+        synth = (xsynth_synth_t *)instance[j];
+        if (synth->silence_threshold > 0.0f)
+            silence = 1;
+        retired += synth->retired_voices;
+        ladspa->deactivate(instance[j]);
+        ladspa->cleanup(instance[j]);
+    }
+
+    /* report */
+    printf("xsynth-bench: patch '%s', %lu Hz, block size %lu, polyphony %d, render %s\n",
+           patch.name, sample_rate, block_size, polyphony, engine ? engine : "default");
+    if (instances > 1)
+        printf("  %d instances, using %s%s\n", instances,
+               multiple ? "run_multiple_synths" : "run_synth", adding ? "_adding" : "");
+    printf("  rendered %.2f s of audio in %.4f s\n",
+           (double)total / (double)sample_rate, elapsed);
+    printf("  ns/sample:        %10.1f\n", elapsed * 1e9 / (double)total);
+    printf("  realtime factor:  %10.1f\n",
+           elapsed > 0.0 ? (double)total / (double)sample_rate / elapsed : 0.0);
+    printf("  average voices:   %10.2f\n", (double)voice_samples / (double)total);
+    if (voice_samples)
+        printf("  ns/voice-sample:  %10.1f\n", elapsed * 1e9 / (double)voice_samples);
+    printf("  worst block:      %10.3f ms (%.1f%% of the %.3f ms available)\n",
+           worst * 1e3, worst * 100.0 * (double)sample_rate / (double)block_size,
+           (double)block_size * 1e3 / (double)sample_rate);
+    if (silence)
+        printf("  retired early:    %10lu voices\n", retired);
+
+    if (profile) {
+        printf("  %s (first instance)\n", message);
+        free(message);
+    }
+
+    if (wav) {
+        /* mix the instances down */
+        for (j = 1; j < instances; j++)
+            for (pos = 0; pos < total; pos++)
+                output[0][pos] += output[j][pos];
+        if (!write_wav(wav, output[0], total, sample_rate)) {
+            fprintf(stderr, "xsynth-bench: could not write '%s'\n", wav);
+            return 1;
+        }
+    }
+
+    for (j = 0; j < instances; j++)
+        free(output[j]);
+    free(block_events);
+    free(events);
+    return 0;
+}
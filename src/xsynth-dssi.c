@@ -39,6 +39,10 @@
 #include "xsynth_ports.h"
 #include "xsynth_synth.h"
 #include "xsynth_voice.h"
+#include "xsynth_pool.h"
+
+/* maximum number of instances run_multiple_synths() renders in lockstep */
+#define XSYNTH_RUN_GROUP_SIZE  32
 
 static LADSPA_Descriptor *xsynth_LADSPA_descriptor = NULL;
 static DSSI_Descriptor   *xsynth_DSSI_descriptor = NULL;
@@ -46,39 +50,8 @@ static DSSI_Descriptor   *xsynth_DSSI_descriptor = NULL;
 static void xsynth_cleanup(LADSPA_Handle instance);
 static void xsynth_run_synth(LADSPA_Handle instance, unsigned long sample_count,
                              snd_seq_event_t *events, unsigned long event_count);
-
-/* ---- mutual exclusion ---- */
-
-static inline int
-xsynth_voicelist_mutex_trylock(xsynth_synth_t *synth)
-{
-    int rc;
-
-    /* Attempt the mutex lock */
-    rc = pthread_mutex_trylock(&synth->voicelist_mutex);
-    if (rc) {
-        synth->voicelist_mutex_grab_failed = 1;
-        return rc;
-    }
-    /* Clean up if a previous mutex grab failed */
-    if (synth->voicelist_mutex_grab_failed) {
-        xsynth_synth_all_voices_off(synth);
-        synth->voicelist_mutex_grab_failed = 0;
-    }
-    return 0;
-}
-
-inline int
-xsynth_voicelist_mutex_lock(xsynth_synth_t *synth)
-{
-    return pthread_mutex_lock(&synth->voicelist_mutex);
-}
-
-inline int
-xsynth_voicelist_mutex_unlock(xsynth_synth_t *synth)
-{
-    return pthread_mutex_unlock(&synth->voicelist_mutex);
-}
+static void xsynth_run_synth_adding(LADSPA_Handle instance, unsigned long sample_count,
+                                    snd_seq_event_t *events, unsigned long event_count);
 
 /* ---- LADSPA interface ---- */
 
@@ -91,19 +64,10 @@ static LADSPA_Handle
 xsynth_instantiate(const LADSPA_Descriptor *descriptor, unsigned long sample_rate)
 {
     xsynth_synth_t *synth = (xsynth_synth_t *)calloc(1, sizeof(xsynth_synth_t));
-    int i;
 
     if (!synth) return NULL;
-    for (i = 0; i < XSYNTH_MAX_POLYPHONY; i++) {
-        synth->voice[i] = xsynth_voice_new(synth);
-        if (!synth->voice[i]) {
-            // XDB_MESSAGE(-1, " xsynth_instantiate: out of memory!\n");
-            xsynth_cleanup(synth);
-            return NULL;
-        }
-    }
-    if (!(synth->patches = (xsynth_patch_t *)malloc(128 * sizeof(xsynth_patch_t)))) {
-        XDB_MESSAGE(-1, " xsynth_instantiate: out of memory!\n");
+    if (!xsynth_voice_arena_new(synth)) {
+        // XDB_MESSAGE(-1, " xsynth_instantiate: out of memory!\n");
         xsynth_cleanup(synth);
         return NULL;
     }
@@ -111,17 +75,29 @@ xsynth_instantiate(const LADSPA_Descriptor *descriptor, unsigned long sample_rat
     /* do any per-instance one-time initialization here */
     synth->sample_rate = sample_rate;
     synth->deltat = 1.0f / (float)synth->sample_rate;
+    synth->run_adding_gain = 1.0f;
+    synth->render_gain = 1.0f;
     synth->polyphony = XSYNTH_DEFAULT_POLYPHONY;
     synth->voices = XSYNTH_DEFAULT_POLYPHONY;
     synth->monophonic = 0;
     synth->glide = 0;
     synth->last_noteon_pitch = 0.0f;
-    pthread_mutex_init(&synth->voicelist_mutex, NULL);
-    synth->voicelist_mutex_grab_failed = 0;
+    synth->render_engine = XSYNTH_RENDER_SCALAR;
+    synth->render_kernel = xsynth_voice_render;
+    synth->control_decimation = 1;
+    synth->vcf_topology = XSYNTH_VCF_CHAMBERLIN;
+    synth->mvclpf_oversample = XSYNTH_OVERSAMPLE_CLASSIC;
+    synth->denormal_mode = XSYNTH_DENORMALS_FLUSH;
+    synth->steal_policy = XSYNTH_STEAL_AGE;
+    synth->threads = 1;
+    pthread_mutex_init(&synth->command_mutex, NULL);
     pthread_mutex_init(&synth->patches_mutex, NULL);
-    synth->pending_program_change = -1;
     synth->current_program = -1;
-    xsynth_data_friendly_patches(synth);
+    if (!xsynth_data_friendly_patches(synth)) {
+        XDB_MESSAGE(-1, " xsynth_instantiate: out of memory!\n");
+        xsynth_cleanup(synth);
+        return NULL;
+    }
     xsynth_synth_init_controls(synth);
 
     return (LADSPA_Handle)synth;
@@ -190,6 +166,7 @@ xsynth_activate(LADSPA_Handle instance)
     synth->nugget_remains = 0;
     synth->note_id = 0;
     xsynth_synth_all_voices_off(synth);
+    xsynth_synth_set_active(synth, 1);
 }
 
 /*
@@ -203,11 +180,30 @@ xsynth_ladspa_run_wrapper(LADSPA_Handle instance, unsigned long sample_count)
     xsynth_run_synth(instance, sample_count, NULL, 0);
 }
 
-// optional:
-//  void (*run_adding)(LADSPA_Handle Instance,
-//                     unsigned long SampleCount);
-//  void (*set_run_adding_gain)(LADSPA_Handle Instance,
-//                              LADSPA_Data   Gain);
+/*
+ * xsynth_ladspa_run_adding_wrapper
+ *
+ * implements LADSPA (*run_adding)() by calling xsynth_run_synth_adding()
+ * with no events
+ */
+static void
+xsynth_ladspa_run_adding_wrapper(LADSPA_Handle instance, unsigned long sample_count)
+{
+    xsynth_run_synth_adding(instance, sample_count, NULL, 0);
+}
+
+/*
+ * xsynth_set_run_adding_gain
+ *
+ * implements LADSPA (*set_run_adding_gain)()
+ */
+static void
+xsynth_set_run_adding_gain(LADSPA_Handle instance, LADSPA_Data gain)
+{
+    xsynth_synth_t *synth = (xsynth_synth_t *)instance;
+
+    synth->run_adding_gain = gain;
+}
 
 /*
  * xsynth_deactivate
@@ -219,7 +215,16 @@ xsynth_deactivate(LADSPA_Handle instance)
 {
     xsynth_synth_t *synth = (xsynth_synth_t *)instance;
 
+    xsynth_synth_set_active(synth, 0);
     xsynth_synth_all_voices_off(synth);  /* stop all sounds immediately */
+
+#if defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO)
+    if (synth->profile_enabled) {
+        char buffer[512];
+        xsynth_synth_profile_report(synth, buffer, 512);
+        XDB_MESSAGE(XDB_AUDIO, " xsynth_deactivate: %s\n", buffer);
+    }
+#endif /* defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO) */
 }
 
 /*
@@ -231,10 +236,9 @@ static void
 xsynth_cleanup(LADSPA_Handle instance)
 {
     xsynth_synth_t *synth = (xsynth_synth_t *)instance;
-    int i;
 
-    for (i = 0; i < XSYNTH_MAX_POLYPHONY; i++)
-        if (synth->voice[i]) free(synth->voice[i]);
+    if (synth->pool) xsynth_pool_free(synth->pool);
+    if (synth->voice_arena) free(synth->voice_arena);
     if (synth->patches) free(synth->patches);
     free(synth);
 }
@@ -286,6 +290,46 @@ xsynth_configure(LADSPA_Handle instance, const char *key, const char *value)
 
         return xsynth_synth_handle_bendrange((xsynth_synth_t *)instance, value);
 
+    } else if (!strcmp(key, "render")) {
+
+        return xsynth_synth_handle_render((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "stealing")) {
+
+        return xsynth_synth_handle_stealing((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "silence")) {
+
+        return xsynth_synth_handle_silence((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "minblep")) {
+
+        return xsynth_synth_handle_minblep((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "controlrate")) {
+
+        return xsynth_synth_handle_controlrate((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "filter")) {
+
+        return xsynth_synth_handle_filter((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "oversampling")) {
+
+        return xsynth_synth_handle_oversampling((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "denormals")) {
+
+        return xsynth_synth_handle_denormals((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "profile")) {
+
+        return xsynth_synth_handle_profile((xsynth_synth_t *)instance, value);
+
+    } else if (!strcmp(key, "threads")) {
+
+        return xsynth_synth_handle_threads((xsynth_synth_t *)instance, value);
+
     } else if (!strcmp(key, DSSI_PROJECT_DIRECTORY_KEY)) {
 
         return NULL; /* plugin has no use for project directory key, ignore it */
@@ -334,32 +378,9 @@ xsynth_select_program(LADSPA_Handle handle, unsigned long bank,
     /* ignore invalid program requests */
     if (bank || program >= 128)
         return;
-    
-    /* Attempt the patch mutex, return if lock fails. */
-    if (pthread_mutex_trylock(&synth->patches_mutex)) {
-        synth->pending_program_change = program;
-        return;
-    }
 
+    /* the bank is read without locking, so this always succeeds */
     xsynth_synth_select_program(synth, bank, program);
-
-    pthread_mutex_unlock(&synth->patches_mutex);
-}
-
-/*
- * dssp_handle_pending_program_change
- */
-static inline void
-dssp_handle_pending_program_change(xsynth_synth_t *synth)
-{
-    /* Attempt the patch mutex, return if lock fails. */
-    if (pthread_mutex_trylock(&synth->patches_mutex))
-        return;
-
-    xsynth_synth_select_program(synth, 0, synth->pending_program_change);
-    synth->pending_program_change = -1;
-
-    pthread_mutex_unlock(&synth->patches_mutex);
 }
 
 /*
@@ -424,27 +445,95 @@ xsynth_handle_event(xsynth_synth_t *synth, snd_seq_event_t *event)
 }
 
 /*
- * xsynth_run_synth
+ * xsynth_burst_size
+ */
+static inline unsigned long
+xsynth_burst_size(xsynth_synth_t *synth, unsigned long samples_done,
+                  unsigned long sample_count, snd_seq_event_t *events,
+                  unsigned long event_index, unsigned long event_count)
+{
+    unsigned long burst_size;
+
+    /* calculate the sample count (burst_size) for the next
+     * xsynth_voice_render() call to be the smallest of:
+     * - control calculation quantization size (XSYNTH_NUGGET_SIZE, in
+     *     samples)
+     * - the number of samples remaining in an already-begun nugget
+     *     (synth->nugget_remains)
+     * - the number of samples until the next event is ready
+     * - the number of samples left in this run
+     */
+    burst_size = XSYNTH_NUGGET_SIZE;
+    if (synth->nugget_remains < burst_size) {
+        /* we're still in the middle of a nugget, so reduce the burst size
+         * to end when the nugget ends */
+        burst_size = synth->nugget_remains;
+    }
+    if (event_index < event_count
+        && events[event_index].time.tick - samples_done < burst_size) {
+        /* reduce burst size to end when next event is ready */
+        burst_size = events[event_index].time.tick - samples_done;
+    }
+    if (sample_count - samples_done < burst_size) {
+        /* reduce burst size to end at end of this run */
+        burst_size = sample_count - samples_done;
+    }
+    return burst_size;
+}
+
+/*
+ * xsynth_run_idle
  *
- * implements DSSI (*run_synth)()
+ * the fast path for a run with no voices playing and no events: output
+ * silence and advance the nugget phase as if the run had been rendered
+ */
+static inline void
+xsynth_run_idle(xsynth_synth_t *synth, unsigned long sample_count, int adding)
+{
+    if (!adding)
+        memset(synth->output, 0, sizeof(LADSPA_Data) * sample_count);
+
+    if (synth->nugget_remains >= sample_count) {
+        synth->nugget_remains -= sample_count;
+    } else {
+        sample_count -= synth->nugget_remains;
+        synth->nugget_remains = (XSYNTH_NUGGET_SIZE - sample_count % XSYNTH_NUGGET_SIZE) %
+                                    XSYNTH_NUGGET_SIZE;
+    }
+}
+
+/*
+ * xsynth_run
+ *
+ * the guts of run_synth() and run_synth_adding(): render into the output
+ * port, replacing its contents, or if 'adding' is true, adding to them
+ * at the run-adding gain
  */
 static void
-xsynth_run_synth(LADSPA_Handle instance, unsigned long sample_count,
-                 snd_seq_event_t *events, unsigned long event_count)
+xsynth_run(xsynth_synth_t *synth, unsigned long sample_count,
+           snd_seq_event_t *events, unsigned long event_count, int adding)
 {
-    xsynth_synth_t *synth = (xsynth_synth_t *)instance;
     unsigned long samples_done = 0;
     unsigned long event_index = 0;
     unsigned long burst_size;
+    xsynth_fpu_mode_t host_fpu_mode;
 
-    /* attempt the mutex, return only silence if lock fails. */
-    if (xsynth_voicelist_mutex_trylock(synth)) {
-        memset(synth->output, 0, sizeof(LADSPA_Data) * sample_count);
-        return;
-    }
+    /* catch up with any changes sent by the configure handlers */
+    xsynth_synth_apply_commands(synth);
+
+    host_fpu_mode = xsynth_fpu_get();
+    if (synth->denormal_mode == XSYNTH_DENORMALS_FLUSH)
+        xsynth_fpu_set(xsynth_fpu_flushing(host_fpu_mode));
+
+    synth->render_gain = (adding ? synth->run_adding_gain : 1.0f);
 
-    if (synth->pending_program_change > -1)
-        dssp_handle_pending_program_change(synth);
+    xsynth_voice_select_kernel(synth);
+
+    if (!event_count && !synth->active_voices) {
+        /* nothing is playing, and nothing will start */
+        xsynth_run_idle(synth, sample_count, adding);
+        samples_done = sample_count;
+    }
 
     while (samples_done < sample_count) {
         if (!synth->nugget_remains)
@@ -457,34 +546,12 @@ xsynth_run_synth(LADSPA_Handle instance, unsigned long sample_count,
             event_index++;
         }
 
-        /* calculate the sample count (burst_size) for the next
-         * xsynth_voice_render() call to be the smallest of:
-         * - control calculation quantization size (XSYNTH_NUGGET_SIZE, in
-         *     samples)
-         * - the number of samples remaining in an already-begun nugget
-         *     (synth->nugget_remains)
-         * - the number of samples until the next event is ready
-         * - the number of samples left in this run
-         */
-        burst_size = XSYNTH_NUGGET_SIZE;
-        if (synth->nugget_remains < burst_size) {
-            /* we're still in the middle of a nugget, so reduce the burst size
-             * to end when the nugget ends */
-            burst_size = synth->nugget_remains;
-        }
-        if (event_index < event_count
-            && events[event_index].time.tick - samples_done < burst_size) {
-            /* reduce burst size to end when next event is ready */
-            burst_size = events[event_index].time.tick - samples_done;
-        }
-        if (sample_count - samples_done < burst_size) {
-            /* reduce burst size to end at end of this run */
-            burst_size = sample_count - samples_done;
-        }
+        burst_size = xsynth_burst_size(synth, samples_done, sample_count,
+                                       events, event_index, event_count);
 
         /* render the burst */
         xsynth_synth_render_voices(synth, synth->output + samples_done, burst_size,
-                                (burst_size == synth->nugget_remains));
+                                (burst_size == synth->nugget_remains), adding);
         samples_done += burst_size;
         synth->nugget_remains -= burst_size;
     }
@@ -492,14 +559,176 @@ xsynth_run_synth(LADSPA_Handle instance, unsigned long sample_count,
 *synth->output += 0.10f; /* add a 'buzz' to output so there's something audible even when quiescent */
 #endif /* defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO) */
 
-    xsynth_voicelist_mutex_unlock(synth);
+    xsynth_fpu_set(host_fpu_mode);
 }
 
-// optional:
-//    void (*run_synth_adding)(LADSPA_Handle    Instance,
-//                             unsigned long    SampleCount,
-//                             snd_seq_event_t *Events,
-//                             unsigned long    EventCount);
+/*
+ * xsynth_run_synth
+ *
+ * implements DSSI (*run_synth)()
+ */
+static void
+xsynth_run_synth(LADSPA_Handle instance, unsigned long sample_count,
+                 snd_seq_event_t *events, unsigned long event_count)
+{
+    xsynth_run((xsynth_synth_t *)instance, sample_count, events, event_count, 0);
+}
+
+/*
+ * xsynth_run_synth_adding
+ *
+ * implements DSSI (*run_synth_adding)()
+ */
+static void
+xsynth_run_synth_adding(LADSPA_Handle instance, unsigned long sample_count,
+                        snd_seq_event_t *events, unsigned long event_count)
+{
+    xsynth_run((xsynth_synth_t *)instance, sample_count, events, event_count, 1);
+}
+
+/*
+ * xsynth_run_synth_group
+ *
+ * run up to XSYNTH_RUN_GROUP_SIZE instances in lockstep: all instances
+ * render each burst before any moves on to the next, so the minBLEP and
+ * other tables stay hot in cache across instances.  A burst ends
+ * wherever any of the instances needs it to, which doesn't change
+ * the output, since control updates still happen only at each
+ * instance's own nugget boundaries.
+ */
+static void
+xsynth_run_synth_group(unsigned long instance_count, LADSPA_Handle *instances,
+                       unsigned long sample_count, snd_seq_event_t **event_lists,
+                       unsigned long *event_counts, int adding)
+{
+    xsynth_synth_t  *synths[XSYNTH_RUN_GROUP_SIZE];
+    snd_seq_event_t *events[XSYNTH_RUN_GROUP_SIZE];
+    unsigned long    event_count[XSYNTH_RUN_GROUP_SIZE];
+    unsigned long    event_index[XSYNTH_RUN_GROUP_SIZE];
+    unsigned long    samples_done = 0;
+    unsigned long    burst_size, size;
+    xsynth_synth_t  *synth;
+    xsynth_fpu_mode_t host_fpu_mode = xsynth_fpu_get(),
+                      flush_fpu_mode = xsynth_fpu_flushing(host_fpu_mode);
+    int count = 0, i;
+
+    for (i = 0; i < instance_count; i++) {
+        synth = (xsynth_synth_t *)instances[i];
+
+        /* catch up with any changes sent by the configure handlers */
+        xsynth_synth_apply_commands(synth);
+
+        synth->render_gain = (adding ? synth->run_adding_gain : 1.0f);
+
+        xsynth_voice_select_kernel(synth);
+
+        if (!event_counts[i] && !synth->active_voices) {
+            /* idle instance, leave it out of the lockstep rendering */
+            xsynth_run_idle(synth, sample_count, adding);
+#if defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO)
+*synth->output += 0.10f; /* add a 'buzz' to output so there's something audible even when quiescent */
+#endif /* defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO) */
+            continue;
+        }
+
+        synths[count] = synth;
+        events[count] = event_lists[i];
+        event_count[count] = event_counts[i];
+        event_index[count] = 0;
+        count++;
+    }
+
+    while (samples_done < sample_count) {
+        burst_size = sample_count - samples_done;
+
+        for (i = 0; i < count; i++) {
+            synth = synths[i];
+
+            if (!synth->nugget_remains)
+                synth->nugget_remains = XSYNTH_NUGGET_SIZE;
+
+            /* process any ready events */
+            while (event_index[i] < event_count[i]
+                   && samples_done == events[i][event_index[i]].time.tick) {
+                xsynth_handle_event(synth, &events[i][event_index[i]]);
+                event_index[i]++;
+            }
+
+            size = xsynth_burst_size(synth, samples_done, sample_count,
+                                     events[i], event_index[i], event_count[i]);
+            if (size < burst_size)
+                burst_size = size;
+        }
+
+        /* render the burst for each instance, each in its own choice
+         * of floating point mode */
+        for (i = 0; i < count; i++) {
+            synth = synths[i];
+            xsynth_fpu_set(synth->denormal_mode == XSYNTH_DENORMALS_FLUSH ?
+                               flush_fpu_mode : host_fpu_mode);
+            xsynth_synth_render_voices(synth, synth->output + samples_done, burst_size,
+                                       (burst_size == synth->nugget_remains), adding);
+            synth->nugget_remains -= burst_size;
+        }
+        samples_done += burst_size;
+    }
+    xsynth_fpu_set(host_fpu_mode);
+
+#if defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO)
+    for (i = 0; i < count; i++)
+        *synths[i]->output += 0.10f; /* add a 'buzz' to output so there's something audible even when quiescent */
+#endif /* defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO) */
+}
+
+/*
+ * xsynth_run_multiple
+ */
+static void
+xsynth_run_multiple(unsigned long instance_count, LADSPA_Handle *instances,
+                    unsigned long sample_count, snd_seq_event_t **events,
+                    unsigned long *event_counts, int adding)
+{
+    unsigned long group_size;
+
+    while (instance_count) {
+        group_size = (instance_count > XSYNTH_RUN_GROUP_SIZE ?
+                          XSYNTH_RUN_GROUP_SIZE : instance_count);
+        xsynth_run_synth_group(group_size, instances, sample_count, events,
+                               event_counts, adding);
+        instances += group_size;
+        events += group_size;
+        event_counts += group_size;
+        instance_count -= group_size;
+    }
+}
+
+/*
+ * xsynth_run_multiple_synths
+ *
+ * implements DSSI (*run_multiple_synths)()
+ */
+static void
+xsynth_run_multiple_synths(unsigned long instance_count, LADSPA_Handle *instances,
+                           unsigned long sample_count, snd_seq_event_t **events,
+                           unsigned long *event_counts)
+{
+    xsynth_run_multiple(instance_count, instances, sample_count, events,
+                        event_counts, 0);
+}
+
+/*
+ * xsynth_run_multiple_synths_adding
+ *
+ * implements DSSI (*run_multiple_synths_adding)()
+ */
+static void
+xsynth_run_multiple_synths_adding(unsigned long instance_count, LADSPA_Handle *instances,
+                                  unsigned long sample_count, snd_seq_event_t **events,
+                                  unsigned long *event_counts)
+{
+    xsynth_run_multiple(instance_count, instances, sample_count, events,
+                        event_counts, 1);
+}
 
 /* ---- export ---- */
 
@@ -576,8 +805,8 @@ void _init()
         xsynth_LADSPA_descriptor->connect_port = xsynth_connect_port;
         xsynth_LADSPA_descriptor->activate = xsynth_activate;
         xsynth_LADSPA_descriptor->run = xsynth_ladspa_run_wrapper;
-        xsynth_LADSPA_descriptor->run_adding = NULL;
-        xsynth_LADSPA_descriptor->set_run_adding_gain = NULL;
+        xsynth_LADSPA_descriptor->run_adding = xsynth_ladspa_run_adding_wrapper;
+        xsynth_LADSPA_descriptor->set_run_adding_gain = xsynth_set_run_adding_gain;
         xsynth_LADSPA_descriptor->deactivate = xsynth_deactivate;
         xsynth_LADSPA_descriptor->cleanup = xsynth_cleanup;
     }
@@ -591,9 +820,9 @@ void _init()
         xsynth_DSSI_descriptor->select_program = xsynth_select_program;
         xsynth_DSSI_descriptor->get_midi_controller_for_port = xsynth_get_midi_controller;
         xsynth_DSSI_descriptor->run_synth = xsynth_run_synth;
-        xsynth_DSSI_descriptor->run_synth_adding = NULL;
-        xsynth_DSSI_descriptor->run_multiple_synths = NULL;
-        xsynth_DSSI_descriptor->run_multiple_synths_adding = NULL;
+        xsynth_DSSI_descriptor->run_synth_adding = xsynth_run_synth_adding;
+        xsynth_DSSI_descriptor->run_multiple_synths = xsynth_run_multiple_synths;
+        xsynth_DSSI_descriptor->run_multiple_synths_adding = xsynth_run_multiple_synths_adding;
     }
 }
 
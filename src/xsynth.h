@@ -68,8 +68,126 @@
 
 /* ==== end of debugging ==== */
 
+/* ==== rendering threads ==== */
+
+/* index of the thread rendering voices within its synth's worker pool,
+ * 0 for the host's audio thread; selects that thread's scratch buffers
+ * and profiling counters */
+extern __thread int xsynth_thread_index;
+
+/* ==== profiling ==== */
+
+/* If XSYNTH_PROFILE is defined, the render code keeps per-stage timing
+ * counters in each synth instance.  They cost a few timestamp reads per
+ * voice per nugget, and only when switched on with the 'profile'
+ * configure key, so they are normally compiled in.  Undefine it to
+ * remove them entirely. */
+#define XSYNTH_PROFILE
+
+#ifdef XSYNTH_PROFILE
+
+#include <stdint.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define XSYNTH_PROFILE_UNITS  "cycles"
+#define xsynth_profile_ticks()  ((uint64_t)__rdtsc())
+#else
+#include <time.h>
+#define XSYNTH_PROFILE_UNITS  "ns"
+static inline uint64_t
+xsynth_profile_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+/* XSYNTH_PROFILE_START() opens a timed region in a function that has
+ * 'synth' in scope; each XSYNTH_PROFILE_STAGE() then charges the ticks
+ * since the previous mark to 'stage', along with 'n' samples of work.
+ * Each rendering thread has its own set of counters, selected by
+ * xsynth_thread_index, and is the only writer of them, so a relaxed
+ * store is all that's needed for readers on other threads to see
+ * untorn values. */
+
+#define XSYNTH_PROFILE_START() \
+    int _profiling = synth->profile_enabled; \
+    uint64_t _profile_mark = _profiling ? xsynth_profile_ticks() : 0
+
+#define XSYNTH_PROFILE_STAGE(stage, n) { \
+    if (_profiling) { \
+        uint64_t _profile_now = xsynth_profile_ticks(); \
+        xsynth_profile_t *_p = &synth->profile[xsynth_thread_index]; \
+        __atomic_store_n(&_p->ticks[stage], _p->ticks[stage] + (_profile_now - _profile_mark), __ATOMIC_RELAXED); \
+        __atomic_store_n(&_p->samples[stage], _p->samples[stage] + (n), __ATOMIC_RELAXED); \
+        _profile_mark = _profile_now; \
+    } \
+}
+
+#else  /* !XSYNTH_PROFILE */
+
+#define XSYNTH_PROFILE_UNITS  "ticks"
+#define XSYNTH_PROFILE_START()
+#define XSYNTH_PROFILE_STAGE(stage, n)
+
+#endif  /* XSYNTH_PROFILE */
+
+/* ==== end of profiling ==== */
+
+/* ==== denormals ==== */
+
+/* Subnormal floats, which the filters, envelopes and oscillator buffers
+ * decay into at the ends of notes, are many times slower to compute
+ * with than normal ones on most processors.  Unless told otherwise by
+ * the 'denormals' configure key, the run functions switch the rendering
+ * thread's floating point unit to flush them to zero (FTZ and DAZ on
+ * x86, FZ on AArch64), and put back the host's mode afterwards. */
+#if defined(__x86_64__) || defined(__SSE2__)
+
+#include <xmmintrin.h>
+typedef unsigned int xsynth_fpu_mode_t;
+#define xsynth_fpu_get()          _mm_getcsr()
+#define xsynth_fpu_set(mode)      _mm_setcsr(mode)
+#define xsynth_fpu_flushing(mode) ((mode) | 0x8040)  /* FTZ | DAZ */
+
+#elif defined(__aarch64__)
+
+typedef unsigned long xsynth_fpu_mode_t;
+static inline xsynth_fpu_mode_t
+xsynth_fpu_get(void)
+{
+    xsynth_fpu_mode_t fpcr;
+
+    __asm__ __volatile__("mrs %0, fpcr" : "=r" (fpcr));
+    return fpcr;
+}
+static inline void
+xsynth_fpu_set(xsynth_fpu_mode_t fpcr)
+{
+    __asm__ __volatile__("msr fpcr, %0" : : "r" (fpcr));
+}
+#define xsynth_fpu_flushing(mode) ((mode) | (1UL << 24))  /* FZ */
+
+#else
+
+typedef int xsynth_fpu_mode_t;
+#define xsynth_fpu_get()          0
+#define xsynth_fpu_set(mode)      ((void)(mode))
+#define xsynth_fpu_flushing(mode) (mode)
+
+#endif
+
+/* ==== end of denormals ==== */
+
 #define XSYNTH_MAX_POLYPHONY     64
 #define XSYNTH_DEFAULT_POLYPHONY  4
 
+/* maximum number of threads rendering voices for one instance, including
+ * the host's audio thread */
+#define XSYNTH_MAX_THREADS        8
+
 #endif /* _XSYNTH_H */
 
@@ -0,0 +1,409 @@
+/* Xsynth DSSI software synthesizer plugin and GUI
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Binary patch banks: see xsynth_bank.h for the file layout. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "xsynth_types.h"
+#include "xsynth_voice.h"
+#include "xsynth_bank.h"
+
+static const char xsynth_bank_magic[8] = { 'X', 's', 'y', 'n', 'B', 'a', 'n', 'k' };
+
+/* header field offsets */
+#define H_VERSION       8
+#define H_HEADER_SIZE  12
+#define H_PATCH_COUNT  16
+#define H_INDEX_OFFSET 20
+#define H_ENTRY_SIZE   24
+#define H_RECORD_SIZE  28
+#define H_INDEX_CRC    32
+#define H_HEADER_CRC   36
+
+/* index entry field offsets */
+#define E_NAME          0
+#define E_RECORD_OFFSET 32
+#define E_RECORD_CRC    36
+
+/* the record layout: float parameters, then byte-sized ones */
+static const size_t float_fields[] = {
+    offsetof(xsynth_patch_t, osc1_pitch),
+    offsetof(xsynth_patch_t, osc1_pulsewidth),
+    offsetof(xsynth_patch_t, osc2_pitch),
+    offsetof(xsynth_patch_t, osc2_pulsewidth),
+    offsetof(xsynth_patch_t, osc_balance),
+    offsetof(xsynth_patch_t, lfo_frequency),
+    offsetof(xsynth_patch_t, lfo_amount_o),
+    offsetof(xsynth_patch_t, lfo_amount_f),
+    offsetof(xsynth_patch_t, eg1_attack_time),
+    offsetof(xsynth_patch_t, eg1_decay_time),
+    offsetof(xsynth_patch_t, eg1_sustain_level),
+    offsetof(xsynth_patch_t, eg1_release_time),
+    offsetof(xsynth_patch_t, eg1_vel_sens),
+    offsetof(xsynth_patch_t, eg1_amount_o),
+    offsetof(xsynth_patch_t, eg1_amount_f),
+    offsetof(xsynth_patch_t, eg2_attack_time),
+    offsetof(xsynth_patch_t, eg2_decay_time),
+    offsetof(xsynth_patch_t, eg2_sustain_level),
+    offsetof(xsynth_patch_t, eg2_release_time),
+    offsetof(xsynth_patch_t, eg2_vel_sens),
+    offsetof(xsynth_patch_t, eg2_amount_o),
+    offsetof(xsynth_patch_t, eg2_amount_f),
+    offsetof(xsynth_patch_t, vcf_cutoff),
+    offsetof(xsynth_patch_t, vcf_qres),
+    offsetof(xsynth_patch_t, glide_time),
+    offsetof(xsynth_patch_t, volume)
+};
+#define FLOAT_FIELDS  (sizeof(float_fields) / sizeof(float_fields[0]))
+
+static const size_t byte_fields[] = {
+    offsetof(xsynth_patch_t, osc1_waveform),
+    offsetof(xsynth_patch_t, osc2_waveform),
+    offsetof(xsynth_patch_t, osc_sync),
+    offsetof(xsynth_patch_t, lfo_waveform),
+    offsetof(xsynth_patch_t, vcf_mode)
+};
+#define BYTE_FIELDS  (sizeof(byte_fields) / sizeof(byte_fields[0]))
+
+static inline uint32_t
+get_le32(const unsigned char *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void
+put_le32(unsigned char *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+/*
+ * bank_crc32
+ *
+ * the CRC-32 of zlib and PNG
+ */
+static uint32_t
+bank_crc32(uint32_t crc, const unsigned char *p, size_t length)
+{
+    static const uint32_t table[256] = {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+        0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+        0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+        0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+        0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+        0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+        0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+        0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+        0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+        0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+        0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+        0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+        0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+        0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+        0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+        0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+        0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+        0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+        0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+        0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+        0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+        0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+        0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+        0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+        0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+        0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+        0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+        0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+        0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+        0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+        0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+        0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+        0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+    };
+
+    crc = ~crc;
+    while (length--)
+        crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xff];
+    return ~crc;
+}
+
+/*
+ * header_crc
+ *
+ * CRC of the header, taking its own checksum field as zero
+ */
+static uint32_t
+header_crc(const unsigned char *header, size_t header_size)
+{
+    static const unsigned char zero[4] = { 0, 0, 0, 0 };
+    uint32_t crc;
+
+    crc = bank_crc32(0, header, H_HEADER_CRC);
+    crc = bank_crc32(crc, zero, 4);
+    return bank_crc32(crc, header + H_HEADER_CRC + 4, header_size - H_HEADER_CRC - 4);
+}
+
+/*
+ * xsynth_bank_open
+ *
+ * map a binary bank file, and check its header and index.  Returns 1 on
+ * success, 0 if 'filename' isn't a binary bank at all (it may be a text
+ * patch file), or -1 with 'message' set if it is one but can't be used.
+ */
+int
+xsynth_bank_open(xsynth_bank_t *bank, const char *filename, const char **message)
+{
+    const unsigned char *data, *entry;
+    struct stat st;
+    uint64_t header_size, index_end;
+    unsigned long i;
+    int fd;
+
+    if ((fd = open(filename, O_RDONLY)) < 0) {
+        if (message) *message = "could not open file for reading";
+        return -1;
+    }
+    if (fstat(fd, &st) || st.st_size < XSYNTH_BANK_HEADER_SIZE) {
+        close(fd);
+        return 0;
+    }
+    data = (const unsigned char *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        if (message) *message = "could not map file";
+        return -1;
+    }
+
+    bank->data = data;
+    bank->size = st.st_size;
+
+    if (memcmp(data, xsynth_bank_magic, 8)) {
+        xsynth_bank_close(bank);
+        return 0;
+    }
+
+    header_size = get_le32(data + H_HEADER_SIZE);
+    if (get_le32(data + H_VERSION) != XSYNTH_BANK_VERSION) {
+        if (message) *message = "unsupported binary bank version";
+        goto fail;
+    }
+    if (header_size < XSYNTH_BANK_HEADER_SIZE || header_size > bank->size ||
+        get_le32(data + H_HEADER_CRC) != header_crc(data, header_size)) {
+        if (message) *message = "binary bank header is damaged";
+        goto fail;
+    }
+
+    bank->patch_count = get_le32(data + H_PATCH_COUNT);
+    bank->index = data + get_le32(data + H_INDEX_OFFSET);
+    bank->entry_size = get_le32(data + H_ENTRY_SIZE);
+    bank->record_size = get_le32(data + H_RECORD_SIZE);
+    index_end = (uint64_t)get_le32(data + H_INDEX_OFFSET) +
+                (uint64_t)bank->patch_count * bank->entry_size;
+    if (bank->entry_size < XSYNTH_BANK_ENTRY_SIZE ||
+        bank->record_size < XSYNTH_BANK_RECORD_SIZE ||
+        index_end > bank->size ||
+        get_le32(data + H_INDEX_CRC) !=
+            bank_crc32(0, bank->index, bank->patch_count * bank->entry_size)) {
+        if (message) *message = "binary bank index is damaged";
+        goto fail;
+    }
+
+    /* the index checks out, so the names and record offsets are as they
+     * were written, but make sure a hand-made bank can't lead us astray */
+    for (i = 0, entry = bank->index; i < bank->patch_count; i++, entry += bank->entry_size) {
+        if (!memchr(entry + E_NAME, 0, 31) ||
+            (uint64_t)get_le32(entry + E_RECORD_OFFSET) + bank->record_size > bank->size) {
+            if (message) *message = "binary bank index is inconsistent";
+            goto fail;
+        }
+    }
+
+    return 1;
+
+  fail:
+    xsynth_bank_close(bank);
+    return -1;
+}
+
+/*
+ * xsynth_bank_close
+ */
+void
+xsynth_bank_close(xsynth_bank_t *bank)
+{
+    if (bank->data)
+        munmap((void *)bank->data, bank->size);
+    bank->data = NULL;
+}
+
+/*
+ * xsynth_bank_patch_name
+ *
+ * return the name of a patch, straight from the mapped index
+ */
+const char *
+xsynth_bank_patch_name(xsynth_bank_t *bank, unsigned long patch)
+{
+    return (const char *)bank->index + patch * bank->entry_size + E_NAME;
+}
+
+/*
+ * xsynth_bank_read_patch
+ *
+ * decode a patch from its record.  Returns 0 if the record is damaged.
+ */
+int
+xsynth_bank_read_patch(xsynth_bank_t *bank, unsigned long patch,
+                       xsynth_patch_t *xsynth_patch)
+{
+    const unsigned char *entry = bank->index + patch * bank->entry_size;
+    const unsigned char *record = bank->data + get_le32(entry + E_RECORD_OFFSET);
+    union { uint32_t i; float f; } u;
+    unsigned int i;
+
+    if (bank_crc32(0, record, bank->record_size) != get_le32(entry + E_RECORD_CRC))
+        return 0;
+
+    strcpy(xsynth_patch->name, (const char *)entry + E_NAME);
+    for (i = 0; i < FLOAT_FIELDS; i++, record += 4) {
+        u.i = get_le32(record);
+        *(float *)((char *)xsynth_patch + float_fields[i]) = u.f;
+    }
+    for (i = 0; i < BYTE_FIELDS; i++, record++)
+        *((unsigned char *)xsynth_patch + byte_fields[i]) = *record;
+
+    return 1;
+}
+
+/*
+ * xsynth_bank_verify
+ *
+ * check every record against its checksum.  Returns 0, with 'message'
+ * set, if any is damaged.
+ */
+int
+xsynth_bank_verify(xsynth_bank_t *bank, const char **message)
+{
+    const unsigned char *entry = bank->index;
+    unsigned long i;
+
+    for (i = 0; i < bank->patch_count; i++, entry += bank->entry_size) {
+        if (bank_crc32(0, bank->data + get_le32(entry + E_RECORD_OFFSET), bank->record_size) !=
+                get_le32(entry + E_RECORD_CRC)) {
+            if (message) *message = "binary bank has a damaged patch record";
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * encode_record
+ */
+static void
+encode_record(xsynth_patch_t *xsynth_patch, unsigned char *record)
+{
+    union { uint32_t i; float f; } u;
+    unsigned int i;
+
+    memset(record, 0, XSYNTH_BANK_RECORD_SIZE);
+    for (i = 0; i < FLOAT_FIELDS; i++, record += 4) {
+        u.f = *(float *)((char *)xsynth_patch + float_fields[i]);
+        put_le32(record, u.i);
+    }
+    for (i = 0; i < BYTE_FIELDS; i++, record++)
+        *record = *((unsigned char *)xsynth_patch + byte_fields[i]);
+}
+
+/*
+ * xsynth_bank_write
+ *
+ * write 'count' patches to 'file' as a binary bank, with the records
+ * following the index in patch order.  Returns 0 on error.
+ */
+int
+xsynth_bank_write(FILE *file, xsynth_patch_t *patches, unsigned long count)
+{
+    unsigned char header[XSYNTH_BANK_HEADER_SIZE], record[XSYNTH_BANK_RECORD_SIZE];
+    unsigned char *index, *entry;
+    unsigned long i, records_offset;
+
+    records_offset = XSYNTH_BANK_HEADER_SIZE + count * XSYNTH_BANK_ENTRY_SIZE;
+    if (count > 0xffffffffUL / 256 ||
+        !(index = (unsigned char *)calloc(count ? count : 1, XSYNTH_BANK_ENTRY_SIZE)))
+        return 0;
+
+    for (i = 0, entry = index; i < count; i++, entry += XSYNTH_BANK_ENTRY_SIZE) {
+        strncpy((char *)entry + E_NAME, patches[i].name, 30);
+        encode_record(&patches[i], record);
+        put_le32(entry + E_RECORD_OFFSET, records_offset + i * XSYNTH_BANK_RECORD_SIZE);
+        put_le32(entry + E_RECORD_CRC, bank_crc32(0, record, XSYNTH_BANK_RECORD_SIZE));
+    }
+
+    memset(header, 0, XSYNTH_BANK_HEADER_SIZE);
+    memcpy(header, xsynth_bank_magic, 8);
+    put_le32(header + H_VERSION, XSYNTH_BANK_VERSION);
+    put_le32(header + H_HEADER_SIZE, XSYNTH_BANK_HEADER_SIZE);
+    put_le32(header + H_PATCH_COUNT, count);
+    put_le32(header + H_INDEX_OFFSET, XSYNTH_BANK_HEADER_SIZE);
+    put_le32(header + H_ENTRY_SIZE, XSYNTH_BANK_ENTRY_SIZE);
+    put_le32(header + H_RECORD_SIZE, XSYNTH_BANK_RECORD_SIZE);
+    put_le32(header + H_INDEX_CRC, bank_crc32(0, index, count * XSYNTH_BANK_ENTRY_SIZE));
+    put_le32(header + H_HEADER_CRC, header_crc(header, XSYNTH_BANK_HEADER_SIZE));
+
+    if (fwrite(header, XSYNTH_BANK_HEADER_SIZE, 1, file) != 1 ||
+        (count && fwrite(index, XSYNTH_BANK_ENTRY_SIZE, count, file) != count)) {
+        free(index);
+        return 0;
+    }
+    free(index);
+
+    for (i = 0; i < count; i++) {
+        encode_record(&patches[i], record);
+        if (fwrite(record, XSYNTH_BANK_RECORD_SIZE, 1, file) != 1)
+            return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,89 @@
+/* Xsynth DSSI software synthesizer plugin and GUI
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _XSYNTH_BANK_H
+#define _XSYNTH_BANK_H
+
+/* A binary patch bank holds any number of patches in a fixed layout,
+ * so that a large library can be memory-mapped and browsed in place,
+ * without the text parsing the .Xsynth format needs.  A bank file is:
+ *
+ *   header   XSYNTH_BANK_HEADER_SIZE bytes, at offset 0
+ *   index    one XSYNTH_BANK_ENTRY_SIZE entry per patch, at 'index_offset'
+ *   records  one record per patch, wherever its index entry says
+ *
+ * All integers are unsigned 32 bits, and floats IEEE 754 single
+ * precision, stored little-endian.  Checksums are CRC-32, as used by
+ * zlib and PNG.  The header is:
+ *
+ *    0  magic "XsynBank"
+ *    8  version, XSYNTH_BANK_VERSION
+ *   12  header size
+ *   16  patch count
+ *   20  index offset
+ *   24  index entry size
+ *   28  record size
+ *   32  CRC of the whole index
+ *   36  CRC of the header, computed with this field zero
+ *   40  reserved, zero
+ *
+ * An index entry is the patch name, NUL-padded to 32 bytes, then the
+ * offset of the patch's record, then the CRC of the record.  A record
+ * is the patch's 26 float parameters, in xsynth_patch_t order, then its
+ * five byte-sized ones (the three waveforms, sync and VCF mode, again
+ * in xsynth_patch_t order), then padding to XSYNTH_BANK_RECORD_SIZE.
+ * Sizes are stored in the header so later versions can grow the
+ * entries and records, and readers accept anything at least as large
+ * as they know about. */
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "xsynth_types.h"
+#include "xsynth_voice.h"
+
+#define XSYNTH_BANK_VERSION       1
+#define XSYNTH_BANK_HEADER_SIZE  64
+#define XSYNTH_BANK_ENTRY_SIZE   40
+#define XSYNTH_BANK_RECORD_SIZE 112
+
+/*
+ * xsynth_bank_t
+ */
+typedef struct {
+    const unsigned char *data;         /* the whole file, mapped read-only */
+    size_t               size;
+    unsigned long        patch_count;
+    const unsigned char *index;
+    unsigned long        entry_size;
+    unsigned long        record_size;
+} xsynth_bank_t;
+
+int         xsynth_bank_open(xsynth_bank_t *bank, const char *filename,
+                             const char **message);
+void        xsynth_bank_close(xsynth_bank_t *bank);
+const char *xsynth_bank_patch_name(xsynth_bank_t *bank, unsigned long patch);
+int         xsynth_bank_read_patch(xsynth_bank_t *bank, unsigned long patch,
+                                   xsynth_patch_t *xsynth_patch);
+int         xsynth_bank_verify(xsynth_bank_t *bank, const char **message);
+int         xsynth_bank_write(FILE *file, xsynth_patch_t *patches,
+                              unsigned long count);
+
+#endif /* _XSYNTH_BANK_H */
@@ -537,6 +537,77 @@ xsynth_data_read_patch(FILE *file, xsynth_patch_t *patch)
     return 1;  /* -FIX- error handling yet to be implemented */
 }
 
+int
+xsynth_data_write_patch(FILE *file, xsynth_patch_t *patch)
+{
+    int format, i;
+
+    if (patch->eg1_vel_sens < 1e-6f &&
+        patch->eg2_vel_sens < 1e-6f)
+        format = 0;
+    else
+        format = 1;
+
+    fprintf(file, "# Xsynth-dssi patch\n");
+    fprintf(file, "xsynth-dssi patch format %d begin\n", format);
+
+    fprintf(file, "name ");
+    for (i = 0; i < 30; i++) {
+        if (!patch->name[i]) {
+            break;
+        } else if (patch->name[i] < 33 || patch->name[i] > 126 ||
+                   patch->name[i] == '%') {
+            fprintf(file, "%%%02x", patch->name[i]);
+        } else {
+            fputc(patch->name[i], file);
+        }
+    }
+    fprintf(file, "\n");
+
+    fprintf(file, "osc1 %.6g %d %.6g\n", patch->osc1_pitch,
+            patch->osc1_waveform, patch->osc1_pulsewidth);
+    fprintf(file, "osc2 %.6g %d %.6g\n", patch->osc2_pitch,
+            patch->osc2_waveform, patch->osc2_pulsewidth);
+    fprintf(file, "sync %d\n", patch->osc_sync);
+    fprintf(file, "balance %.6g\n", patch->osc_balance);
+
+    fprintf(file, "lfo %.6g %d %.6g %.6g\n", patch->lfo_frequency,
+            patch->lfo_waveform, patch->lfo_amount_o, patch->lfo_amount_f);
+
+    if (format == 0) {  /* backward compatible */
+
+        fprintf(file, "eg1 %.6g %.6g %.6g %.6g %.6g %.6g\n",
+                patch->eg1_attack_time, patch->eg1_decay_time,
+                patch->eg1_sustain_level, patch->eg1_release_time,
+                patch->eg1_amount_o, patch->eg1_amount_f);
+        fprintf(file, "eg2 %.6g %.6g %.6g %.6g %.6g %.6g\n",
+                patch->eg2_attack_time, patch->eg2_decay_time,
+                patch->eg2_sustain_level, patch->eg2_release_time,
+                patch->eg2_amount_o, patch->eg2_amount_f);
+
+    } else {
+
+        fprintf(file, "eg1 %.6g %.6g %.6g %.6g %.6g %.6g %.6g\n",
+                patch->eg1_attack_time, patch->eg1_decay_time,
+                patch->eg1_sustain_level, patch->eg1_release_time,
+                patch->eg1_vel_sens, patch->eg1_amount_o, patch->eg1_amount_f);
+        fprintf(file, "eg2 %.6g %.6g %.6g %.6g %.6g %.6g %.6g\n",
+                patch->eg2_attack_time, patch->eg2_decay_time,
+                patch->eg2_sustain_level, patch->eg2_release_time,
+                patch->eg2_vel_sens, patch->eg2_amount_o, patch->eg2_amount_f);
+    }
+
+    fprintf(file, "vcf %.6g %.6g %d\n", patch->vcf_cutoff, patch->vcf_qres,
+            patch->vcf_mode);
+
+    fprintf(file, "glide %.6g\n", patch->glide_time);
+    fprintf(file, "volume %.6g\n", patch->volume);
+
+    fprintf(file, "xsynth-dssi patch end\n");
+
+    return 1;  /* -FIX- error handling yet to be implemented */
+}
+
 int
 xsynth_data_decode_patches(const char *encoded, xsynth_patch_t *patches)
 {
@@ -618,3 +689,49 @@ xsynth_data_decode_patches(const char *encoded, xsynth_patch_t *patches)
     return 1;
 }
 
+/*
+ * xsynth_data_patch_compare
+ *
+ * returns true if two patches are the same
+ */
+int
+xsynth_data_patch_compare(xsynth_patch_t *patch1, xsynth_patch_t *patch2)
+{
+    if (strcmp(patch1->name, patch2->name))
+        return 0;
+
+    if (patch1->osc1_pitch        != patch2->osc1_pitch        ||
+        patch1->osc1_waveform     != patch2->osc1_waveform     ||
+        patch1->osc1_pulsewidth   != patch2->osc1_pulsewidth   ||
+        patch1->osc2_pitch        != patch2->osc2_pitch        ||
+        patch1->osc2_waveform     != patch2->osc2_waveform     ||
+        patch1->osc2_pulsewidth   != patch2->osc2_pulsewidth   ||
+        patch1->osc_sync          != patch2->osc_sync          ||
+        patch1->osc_balance       != patch2->osc_balance       ||
+        patch1->lfo_frequency     != patch2->lfo_frequency     ||
+        patch1->lfo_waveform      != patch2->lfo_waveform      ||
+        patch1->lfo_amount_o      != patch2->lfo_amount_o      ||
+        patch1->lfo_amount_f      != patch2->lfo_amount_f      ||
+        patch1->eg1_attack_time   != patch2->eg1_attack_time   ||
+        patch1->eg1_decay_time    != patch2->eg1_decay_time    ||
+        patch1->eg1_sustain_level != patch2->eg1_sustain_level ||
+        patch1->eg1_release_time  != patch2->eg1_release_time  ||
+        patch1->eg1_vel_sens      != patch2->eg1_vel_sens      ||
+        patch1->eg1_amount_o      != patch2->eg1_amount_o      ||
+        patch1->eg1_amount_f      != patch2->eg1_amount_f      ||
+        patch1->eg2_attack_time   != patch2->eg2_attack_time   ||
+        patch1->eg2_decay_time    != patch2->eg2_decay_time    ||
+        patch1->eg2_sustain_level != patch2->eg2_sustain_level ||
+        patch1->eg2_release_time  != patch2->eg2_release_time  ||
+        patch1->eg2_vel_sens      != patch2->eg2_vel_sens      ||
+        patch1->eg2_amount_o      != patch2->eg2_amount_o      ||
+        patch1->eg2_amount_f      != patch2->eg2_amount_f      ||
+        patch1->vcf_cutoff        != patch2->vcf_cutoff        ||
+        patch1->vcf_qres          != patch2->vcf_qres          ||
+        patch1->vcf_mode          != patch2->vcf_mode          ||
+        patch1->glide_time        != patch2->glide_time        ||
+        patch1->volume            != patch2->volume)
+        return 0;
+
+    return 1;
+}
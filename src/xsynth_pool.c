@@ -0,0 +1,362 @@
+/* Xsynth DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* The worker pool lets a synth instance render its voices on more than
+ * one core.  On each burst, the audio thread hands out the playing
+ * voices among itself and the pool's worker threads, releases the
+ * workers by bumping a generation counter, renders its own share
+ * straight into the output, then waits for the workers to finish and
+ * sums their per-worker buffers into the output.  The audio thread
+ * never takes a lock or sleeps: workers spin briefly waiting for the
+ * next burst, then sleep on a futex, and the audio thread only makes
+ * the (non-blocking) wake system call when some worker is asleep.
+ *
+ * Each worker claims its share of a burst before rendering it.  The
+ * audio thread only spins for a short while on a share nobody has
+ * claimed -- its worker may be asleep, or waiting for the very processor
+ * the audio thread is spinning on -- and then claims and renders it
+ * itself.  Once a worker has claimed its share, the audio thread yields
+ * between polls rather than spin indefinitely, in case they have to
+ * share a processor.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  /* for pthread_attr_setaffinity_np() */
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include <ladspa.h>
+
+#include "xsynth_types.h"
+#include "xsynth.h"
+#include "xsynth_synth.h"
+#include "xsynth_voice.h"
+#include "xsynth_pool.h"
+
+/* how many times a worker polls for a new burst before going to sleep */
+#define XSYNTH_POOL_SPIN  20000
+
+/* how many times the audio thread polls for the workers, once its own
+ * share is rendered, before it takes over unclaimed shares or yields */
+#define XSYNTH_POOL_WAIT   2000
+
+/* processors are handed out to the workers of all instances in turn */
+static unsigned int next_processor = 0;
+
+/* see xsynth.h */
+__thread int xsynth_thread_index = 0;
+
+#if defined(__i386__) || defined(__x86_64__)
+#define cpu_relax()  __builtin_ia32_pause()
+#else
+#define cpu_relax()  __asm__ __volatile__("" ::: "memory")
+#endif
+
+#ifdef __linux__
+static inline void
+futex_wait(int *address, int value)
+{
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static inline void
+futex_wake_all(int *address)
+{
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+#else
+static inline void
+futex_wait(int *address, int value)
+{
+    sched_yield();
+}
+
+static inline void
+futex_wake_all(int *address)
+{
+}
+#endif
+
+/*
+ * xsynth_pool_worker
+ */
+static void *
+xsynth_pool_worker(void *arg)
+{
+    xsynth_worker_t *worker = (xsynth_worker_t *)arg;
+    xsynth_pool_t *pool = worker->pool;
+    int seen = 0, generation, job, priority, i;
+    unsigned long sample;
+    struct sched_param param;
+
+    xsynth_thread_index = worker->index;
+
+    for (;;) {
+
+        /* wait for the next burst */
+        for (i = 0; i < XSYNTH_POOL_SPIN; i++) {
+            if ((generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE)) != seen)
+                break;
+            cpu_relax();
+        }
+        while (generation == seen) {
+            __atomic_add_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+            futex_wait(&pool->generation, seen);
+            __atomic_sub_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+            generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE);
+        }
+        seen = generation;
+
+        if (__atomic_load_n(&pool->quit, __ATOMIC_ACQUIRE))
+            break;
+
+        /* claim our share, unless the audio thread has taken it over (the
+         * job parameters may already belong to a later burst if it has) */
+        job = generation;
+        if (__atomic_compare_exchange_n(&worker->job, &job, 0, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+
+            /* follow the audio thread's realtime priority, once we know it */
+            priority = pool->priority;
+            if (priority != worker->priority) {
+                param.sched_priority = priority;
+                pthread_setschedparam(pthread_self(), priority ? SCHED_FIFO : SCHED_OTHER,
+                                      &param);
+                worker->priority = priority;
+            }
+
+            /* render in the same floating point mode as the audio thread */
+            xsynth_fpu_set(pool->fpu_mode);
+
+            for (sample = 0; sample < pool->sample_count; sample++)
+                worker->buffer[sample] = 0.0f;
+            xsynth_synth_render_voice_list(pool->synth, worker->voice, worker->count,
+                                           worker->buffer, pool->sample_count,
+                                           pool->do_control_update);
+            __atomic_store_n(&worker->done, generation, __ATOMIC_RELEASE);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * xsynth_pool_processors
+ *
+ * return the number of processors the calling thread may run on
+ */
+int
+xsynth_pool_processors(void)
+{
+    long cpus;
+#ifdef __linux__
+    cpu_set_t allowed;
+
+    if (!sched_getaffinity(0, sizeof(cpu_set_t), &allowed))
+        return CPU_COUNT(&allowed);
+#endif
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0 ? cpus : 1);
+}
+
+/*
+ * xsynth_pool_new
+ *
+ * start a pool of 'threads' - 1 worker threads, each pinned to one of
+ * the processors the calling thread may run on, where possible
+ */
+xsynth_pool_t *
+xsynth_pool_new(xsynth_synth_t *synth, int threads)
+{
+    xsynth_pool_t *pool;
+    xsynth_worker_t *worker;
+    pthread_attr_t attr;
+    int i, started;
+#ifdef __linux__
+    cpu_set_t allowed, cpuset;
+    int cpus = 0, cpu, n;
+
+    if (!sched_getaffinity(0, sizeof(cpu_set_t), &allowed))
+        cpus = CPU_COUNT(&allowed);
+#endif
+
+    if (posix_memalign((void **)&pool, 64, sizeof(xsynth_pool_t)))
+        return NULL;
+    memset(pool, 0, sizeof(xsynth_pool_t));
+    pool->synth = synth;
+    pool->threads = threads;
+
+    for (i = 1; i < threads; i++) {
+        worker = &pool->worker[i];
+        worker->pool = pool;
+        worker->index = i;
+
+        pthread_attr_init(&attr);
+#ifdef __linux__
+        if (cpus > 0) {
+            /* the next allowed processor in turn; which of them the host's
+             * audio thread runs on is anyone's guess */
+            n = __atomic_fetch_add(&next_processor, 1, __ATOMIC_RELAXED) % cpus;
+            for (cpu = 0; cpu < CPU_SETSIZE; cpu++)
+                if (CPU_ISSET(cpu, &allowed) && n-- == 0)
+                    break;
+            CPU_ZERO(&cpuset);
+            CPU_SET(cpu, &cpuset);
+            pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuset);
+        }
+#endif
+        started = !pthread_create(&worker->thread, &attr, xsynth_pool_worker, worker);
+        pthread_attr_destroy(&attr);
+        /* if pinning was refused, e.g. because our cpuset has changed
+         * since, let the worker run anywhere */
+        if (!started)
+            started = !pthread_create(&worker->thread, NULL, xsynth_pool_worker, worker);
+        if (!started) {
+            xsynth_pool_free(pool);
+            return NULL;
+        }
+        worker->running = 1;
+    }
+
+    return pool;
+}
+
+/*
+ * xsynth_pool_free
+ *
+ * stop the workers and free the pool.  Must not be called while the
+ * audio thread might be using the pool.
+ */
+void
+xsynth_pool_free(xsynth_pool_t *pool)
+{
+    int i;
+
+    __atomic_store_n(&pool->quit, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&pool->generation, 1, __ATOMIC_SEQ_CST);
+    futex_wake_all(&pool->generation);
+
+    for (i = 1; i < pool->threads; i++)
+        if (pool->worker[i].running)
+            pthread_join(pool->worker[i].thread, NULL);
+
+    free(pool);
+}
+
+/*
+ * xsynth_pool_render
+ *
+ * render a list of playing voices, spread across the pool's threads,
+ * adding to 'out'
+ */
+void
+xsynth_pool_render(xsynth_pool_t *pool, xsynth_voice_t **voices, int count,
+                   LADSPA_Data *out, unsigned long sample_count,
+                   int do_control_update)
+{
+    xsynth_synth_t *synth = pool->synth;
+    xsynth_voice_t *mine[XSYNTH_MAX_POLYPHONY];
+    xsynth_worker_t *worker;
+    int chunk, i, j, t, my_count = 0, generation, job, polls = 0;
+    unsigned long sample;
+
+    if (!pool->priority_checked) {
+        struct sched_param param;
+        int policy;
+
+        if (!pthread_getschedparam(pthread_self(), &policy, &param) &&
+            (policy == SCHED_FIFO || policy == SCHED_RR))
+            pool->priority = param.sched_priority;
+        pool->priority_checked = 1;
+    }
+
+    /* deal the voices out in chunks, whole SIMD blocks at a time if
+     * that's how they'll be rendered */
+    chunk = (synth->render_engine == XSYNTH_RENDER_SIMD ? XSYNTH_SIMD_LANES : 1);
+    for (t = 1; t < pool->threads; t++)
+        pool->worker[t].count = 0;
+    for (i = 0, t = 0; i < count; i += chunk, t = (t + 1) % pool->threads) {
+        for (j = i; j < i + chunk && j < count; j++) {
+            if (t == 0)
+                mine[my_count++] = voices[j];
+            else
+                pool->worker[t].voice[pool->worker[t].count++] = voices[j];
+        }
+    }
+
+    /* release the workers */
+    generation = (pool->generation == INT_MAX ? 1 : pool->generation + 1);
+    for (t = 1; t < pool->threads; t++)
+        __atomic_store_n(&pool->worker[t].job, pool->worker[t].count ? generation : 0,
+                         __ATOMIC_RELAXED);
+    pool->sample_count = sample_count;
+    pool->do_control_update = do_control_update;
+    pool->fpu_mode = xsynth_fpu_get();
+    __atomic_store_n(&pool->generation, generation, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST))
+        futex_wake_all(&pool->generation);
+
+    /* render our own share */
+    xsynth_synth_render_voice_list(synth, mine, my_count, out, sample_count,
+                                   do_control_update);
+
+    /* wait for the workers, taking over any share still unclaimed after
+     * a short spin */
+    for (t = 1; t < pool->threads; t++) {
+        worker = &pool->worker[t];
+        if (!worker->count)
+            continue;
+        while (__atomic_load_n(&worker->done, __ATOMIC_ACQUIRE) != generation) {
+            if (polls < XSYNTH_POOL_WAIT) {
+                polls++;
+                cpu_relax();
+                continue;
+            }
+            job = generation;
+            if (__atomic_compare_exchange_n(&worker->job, &job, 0, 0,
+                                            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                xsynth_synth_render_voice_list(synth, worker->voice, worker->count,
+                                               out, sample_count, do_control_update);
+                worker->count = 0;  /* nothing to sum */
+                break;
+            }
+            sched_yield();
+        }
+    }
+
+    /* then sum their buffers */
+    for (t = 1; t < pool->threads; t++) {
+        if (pool->worker[t].count) {
+            for (sample = 0; sample < sample_count; sample++)
+                out[sample] += pool->worker[t].buffer[sample];
+        }
+    }
+}
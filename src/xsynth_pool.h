@@ -0,0 +1,83 @@
+/* Xsynth DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2010 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _XSYNTH_POOL_H
+#define _XSYNTH_POOL_H
+
+#include <pthread.h>
+
+#include <ladspa.h>
+
+#include "xsynth.h"
+#include "xsynth_types.h"
+#include "xsynth_voice.h"
+
+/*
+ * xsynth_worker_t
+ */
+typedef struct {
+    xsynth_pool_t  *pool;
+    int             index;             /* thread index, 1 to pool->threads - 1 */
+    pthread_t       thread;
+    int             running;           /* true if 'thread' was successfully created */
+    int             priority;          /* SCHED_FIFO priority this thread has taken, or 0 */
+
+    /* the current job, set up by the audio thread before each release */
+    int             count;
+    xsynth_voice_t *voice[XSYNTH_MAX_POLYPHONY];
+    int             job;               /* generation of the job while unclaimed, else 0 (atomic) */
+    int             done;              /* generation of the last job this worker finished (atomic) */
+
+    /* per-worker accumulation buffer, summed into the output after each burst */
+    LADSPA_Data     buffer[XSYNTH_NUGGET_SIZE] __attribute__((aligned(64)));
+} xsynth_worker_t;
+
+/*
+ * xsynth_pool_t
+ */
+struct _xsynth_pool_t {
+    xsynth_synth_t *synth;
+    int             threads;           /* total rendering threads, including the audio thread */
+
+    /* job control, all accessed with __atomic builtins */
+    int             generation;        /* bumped to release the workers, never back to 0; also the futex word */
+    int             sleepers;          /* workers waiting on the futex */
+    int             quit;
+
+    /* parameters of the current job */
+    unsigned long   sample_count;
+    int             do_control_update;
+    xsynth_fpu_mode_t fpu_mode;        /* the audio thread's floating point mode */
+
+    int             priority;          /* audio thread's SCHED_FIFO/SCHED_RR priority, or 0 */
+    int             priority_checked;
+
+    xsynth_worker_t worker[XSYNTH_MAX_THREADS];
+};
+
+int            xsynth_pool_processors(void);
+xsynth_pool_t *xsynth_pool_new(xsynth_synth_t *synth, int threads);
+void           xsynth_pool_free(xsynth_pool_t *pool);
+void           xsynth_pool_render(xsynth_pool_t *pool, xsynth_voice_t **voices,
+                                  int count, LADSPA_Data *out,
+                                  unsigned long sample_count,
+                                  int do_control_update);
+
+#endif /* _XSYNTH_POOL_H */
@@ -29,13 +29,17 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
+#include <unistd.h>
 #include <pthread.h>
+#include <sched.h>
 
 #include <ladspa.h>
 
 #include "xsynth.h"
 #include "xsynth_synth.h"
 #include "xsynth_voice.h"
+#include "xsynth_pool.h"
 #include "gui_data.h"
 
 /*
@@ -47,13 +51,12 @@ void
 xsynth_synth_all_voices_off(xsynth_synth_t *synth)
 {
     int i;
-    xsynth_voice_t *voice;
+    uint64_t playing = ~synth->free_voices;
 
-    for (i = 0; i < synth->voices; i++) {
-        voice = synth->voice[i];
-        if (_PLAYING(voice)) {
-            xsynth_voice_off(voice);
-        }
+    while (playing) {
+        i = __builtin_ctzll(playing);
+        playing &= playing - 1;
+        xsynth_voice_off(synth, synth->voice[i]);
     }
     for (i = 0; i < 8; i++) synth->held_keys[i] = -1;
 }
@@ -67,12 +70,17 @@ void
 xsynth_synth_note_off(xsynth_synth_t *synth, unsigned char key, unsigned char rvelocity)
 {
     int i, count = 0;
+    uint64_t candidates;
     xsynth_voice_t *voice;
 
-    for (i = 0; i < synth->voices; i++) {
+    /* in monophonic mode, the only voice gets the note-off whatever its
+     * key; otherwise, look up the voices playing this key */
+    candidates = synth->monophonic ? ~synth->free_voices & 1 : synth->key_voices[key];
+    while (candidates) {
+        i = __builtin_ctzll(candidates);
+        candidates &= candidates - 1;
         voice = synth->voice[i];
-        if (synth->monophonic ? (_PLAYING(voice)) :
-                                (_ON(voice) && (voice->key == key))) {
+        if (synth->monophonic || _ON(voice)) {
             XDB_MESSAGE(XDB_NOTE, " xsynth_synth_note_off: key %d rvel %d voice %d note id %d\n", key, rvelocity, i, voice->note_id);
             xsynth_voice_note_off(synth, voice, key, rvelocity);
             count++;
@@ -91,17 +99,14 @@ xsynth_synth_note_off(xsynth_synth_t *synth, unsigned char key, unsigned char rv
 void
 xsynth_synth_all_notes_off(xsynth_synth_t* synth)
 {
-    int i;
     xsynth_voice_t *voice;
 
     /* reset the sustain controller */
     synth->cc[MIDI_CTL_SUSTAIN] = 0;
-    for (i = 0; i < synth->voices; i++) {
-        voice = synth->voice[i];
-        if (_ON(voice) || _SUSTAINED(voice)) {
-            xsynth_voice_release_note(synth, voice);
-        }
-    }
+    while ((voice = synth->oldest[XSYNTH_VOICE_ON]))
+        xsynth_voice_release_note(synth, voice);
+    while ((voice = synth->oldest[XSYNTH_VOICE_SUSTAINED]))
+        xsynth_voice_release_note(synth, voice);
 }
 
 /*
@@ -114,18 +119,32 @@ static xsynth_voice_t*
 xsynth_synth_free_voice_by_kill(xsynth_synth_t *synth)
 {
     int i;
-    int best_prio = 10001;
+    int best_prio = INT_MAX;
     int this_voice_prio;
+    uint64_t candidates;
     xsynth_voice_t *voice;
     int best_voice_index = -1;
 
-    for (i = 0; i < synth->voices; i++) {
+    if (synth->steal_policy == XSYNTH_STEAL_LOUDNESS) {
+        /* every playing voice is a candidate */
+        candidates = ~synth->free_voices;
+    } else {
+        /* Within each status, priority only drops with age, so the oldest
+         * voice of each status is the only candidate we need to look at. */
+        candidates = 0;
+        if (synth->oldest[XSYNTH_VOICE_ON])
+            candidates |= 1ULL << synth->oldest[XSYNTH_VOICE_ON]->index;
+        if (synth->oldest[XSYNTH_VOICE_SUSTAINED])
+            candidates |= 1ULL << synth->oldest[XSYNTH_VOICE_SUSTAINED]->index;
+        if (synth->oldest[XSYNTH_VOICE_RELEASED])
+            candidates |= 1ULL << synth->oldest[XSYNTH_VOICE_RELEASED]->index;
+    }
+
+    while (candidates) {
+        i = __builtin_ctzll(candidates);
+        candidates &= candidates - 1;
         voice = synth->voice[i];
     
-        /* safeguard against an available voice. */
-        if (_AVAILABLE(voice))
-            return voice;
-    
         /* Determine, how 'important' a voice is.
          * Start with an arbitrary number */
         this_voice_prio = 10000;
@@ -152,12 +171,14 @@ xsynth_synth_free_voice_by_kill(xsynth_synth_t *synth)
          * important than a younger voice. */
         this_voice_prio -= (synth->note_id - voice->note_id);
     
-        /* -FIX- not yet implemented:
-         * /= take a rough estimate of loudness into account. Louder voices are more important. =/
-         * if (voice->volenv_section != FLUID_VOICE_ENVATTACK){
-         *     this_voice_prio += voice->volenv_val*1000.;
-         * };
-         */
+        /* Take a rough estimate of loudness into account. Louder voices are
+         * more important.  eg1 already includes the velocity attenuation; a
+         * voice still in its attack is on its way up, so count it as full
+         * level.  The weight lets a nearly silent held or sustained voice
+         * go before a loud one which was only just released. */
+        if (synth->steal_policy == XSYNTH_STEAL_LOUDNESS) {
+            this_voice_prio += lrintf((voice->eg1_phase == 0 ? 1.0f : voice->eg1) * 2000.0f);
+        }
 
         /* check if this voice has less priority than the previous candidate. */
         if (this_voice_prio < best_prio)
@@ -170,7 +191,7 @@ xsynth_synth_free_voice_by_kill(xsynth_synth_t *synth)
 
     voice = synth->voice[best_voice_index];
     XDB_MESSAGE(XDB_NOTE, " xsynth_synth_free_voice_by_kill: no available voices, killing voice %d note id %d\n", best_voice_index, voice->note_id);
-    xsynth_voice_off(voice);
+    xsynth_voice_off(synth, voice);
     return voice;
 }
 
@@ -181,25 +202,28 @@ static xsynth_voice_t *
 xsynth_synth_alloc_voice(xsynth_synth_t* synth, unsigned char key)
 {
     int i;
+    uint64_t mask;
     xsynth_voice_t* voice;
 
     /* If there is another voice on the same key, advance it
      * to the release phase to keep our CPU usage low. */
-    for (i = 0; i < synth->voices; i++) {
+    mask = synth->key_voices[key];
+    while (mask) {
+        i = __builtin_ctzll(mask);
+        mask &= mask - 1;
         voice = synth->voice[i];
-        if (voice->key == key && (_ON(voice) || _SUSTAINED(voice))) {
+        if (_ON(voice) || _SUSTAINED(voice)) {
             xsynth_voice_release_note(synth, voice);
         }
     }
 
-    /* check if there's an available voice */
+    /* check if there's an available voice, taking the lowest numbered */
     voice = NULL;
-    for (i = 0; i < synth->voices; i++) {
-        if (_AVAILABLE(synth->voice[i])) {
-            voice = synth->voice[i];
-            break;
-        }
-    }
+    mask = synth->free_voices;
+    if (synth->voices < XSYNTH_MAX_POLYPHONY)
+        mask &= (1ULL << synth->voices) - 1;
+    if (mask)
+        voice = synth->voice[__builtin_ctzll(mask)];
 
     /* No success yet? Then stop a running voice. */
     if (voice == NULL) {
@@ -238,7 +262,13 @@ xsynth_synth_note_on(xsynth_synth_t *synth, unsigned char key, unsigned char vel
 
     }
 
-    voice->note_id  = synth->note_id++;
+    /* a retriggered mono voice moves to the young end of its list */
+    if (_PLAYING(voice)) {
+        xsynth_voice_unlink(synth, voice);
+        voice->note_id = synth->note_id++;
+        xsynth_voice_link(synth, voice);
+    } else
+        voice->note_id = synth->note_id++;
 
     xsynth_voice_note_on(synth, voice, key, velocity);
 }
@@ -250,17 +280,17 @@ void
 xsynth_synth_key_pressure(xsynth_synth_t *synth, unsigned char key, unsigned char pressure)
 {
     int i;
-    xsynth_voice_t* voice;
+    uint64_t mask;
 
     /* save it for future voices */
     synth->key_pressure[key] = pressure;
     
     /* check if any playing voices need updating */
-    for (i = 0; i < synth->voices; i++) {
-        voice = synth->voice[i];
-        if (_PLAYING(voice) && voice->key == key) {
-            xsynth_voice_update_pressure_mod(synth, voice);
-        }
+    mask = synth->key_voices[key];
+    while (mask) {
+        i = __builtin_ctzll(mask);
+        mask &= mask - 1;
+        xsynth_voice_update_pressure_mod(synth, synth->voice[i]);
     }
 }
 
@@ -273,15 +303,10 @@ xsynth_synth_key_pressure(xsynth_synth_t *synth, unsigned char key, unsigned cha
 void
 xsynth_synth_damp_voices(xsynth_synth_t* synth)
 {
-    int i;
     xsynth_voice_t* voice;
 
-    for (i = 0; i < synth->voices; i++) {
-        voice = synth->voice[i];
-        if (_SUSTAINED(voice)) {
-            xsynth_voice_release_note(synth, voice);
-        }
-    }
+    while ((voice = synth->oldest[XSYNTH_VOICE_SUSTAINED]))
+        xsynth_voice_release_note(synth, voice);
 }
 
 /*
@@ -435,37 +460,106 @@ xsynth_synth_init_controls(xsynth_synth_t *synth)
     }
 }
 
+/* The patch bank is published as a block of 128 patches which is never
+ * changed once the audio thread can see it, so the audio thread reads it
+ * without locking.  A change is made to a copy of the bank, which is
+ * then swapped in atomically; the thread making the change waits out any
+ * read the audio thread might have begun on the old bank, then frees it.
+ * 'patches_mutex' is only taken by the non-realtime threads, to keep
+ * their changes and reads of the bank in order. */
+
+/*
+ * xsynth_synth_patches_copy
+ *
+ * allocate a copy of the current bank, to be changed and published.
+ * Must be called with patches_mutex held.
+ */
+static xsynth_patch_t *
+xsynth_synth_patches_copy(xsynth_synth_t *synth)
+{
+    xsynth_patch_t *bank = (xsynth_patch_t *)malloc(128 * sizeof(xsynth_patch_t));
+
+    if (bank && synth->patches)
+        memcpy(bank, synth->patches, 128 * sizeof(xsynth_patch_t));
+    return bank;
+}
+
+/*
+ * xsynth_synth_patches_publish
+ *
+ * make 'bank' the current bank, and free the old one once the audio
+ * thread is done with it.  Must be called with patches_mutex held, and
+ * never from the audio thread.
+ */
+static void
+xsynth_synth_patches_publish(xsynth_synth_t *synth, xsynth_patch_t *bank)
+{
+    xsynth_patch_t *old = __atomic_exchange_n(&synth->patches, bank, __ATOMIC_SEQ_CST);
+    unsigned int reading;
+
+    if (!old)
+        return;
+
+    /* any read which began after the exchange sees the new bank, so only
+     * one already in progress now can be using the old one */
+    reading = __atomic_load_n(&synth->patches_reading, __ATOMIC_SEQ_CST);
+    if (reading & 1)
+        while (__atomic_load_n(&synth->patches_reading, __ATOMIC_SEQ_CST) == reading)
+            sched_yield();
+
+    free(old);
+}
+
 /*
  * xsynth_synth_select_program
+ *
+ * called from the audio thread
  */
 void
 xsynth_synth_select_program(xsynth_synth_t *synth, unsigned long bank,
                             unsigned long program)
 {
+    xsynth_patch_t *patches;
+
     if (bank || program >= 128) return;
     synth->current_program = program;
-    xsynth_voice_set_ports(synth, &synth->patches[program]);
+
+    __atomic_add_fetch(&synth->patches_reading, 1, __ATOMIC_SEQ_CST);
+    patches = __atomic_load_n(&synth->patches, __ATOMIC_SEQ_CST);
+    xsynth_voice_set_ports(synth, &patches[program]);
+    __atomic_add_fetch(&synth->patches_reading, 1, __ATOMIC_RELEASE);
 }
 
 /*
  * xsynth_data_friendly_patches
  *
- * give the new user a default set of good patches to get started with
+ * give the new user a default set of good patches to get started with.
+ * Returns 0 if out of memory.
  */
-void
+int
 xsynth_data_friendly_patches(xsynth_synth_t *synth)
 {
+    xsynth_patch_t *bank;
     int i;
 
     pthread_mutex_lock(&synth->patches_mutex);
 
-    memcpy(synth->patches, xsynth_friendly_patches, xsynth_friendly_patch_count * sizeof(xsynth_patch_t));
+    if (!(bank = xsynth_synth_patches_copy(synth))) {
+        pthread_mutex_unlock(&synth->patches_mutex);
+        return 0;
+    }
+
+    memcpy(bank, xsynth_friendly_patches, xsynth_friendly_patch_count * sizeof(xsynth_patch_t));
 
     for (i = xsynth_friendly_patch_count; i < 128; i++) {
-        memcpy(&synth->patches[i], &xsynth_init_voice, sizeof(xsynth_patch_t));
+        memcpy(&bank[i], &xsynth_init_voice, sizeof(xsynth_patch_t));
     }
 
+    xsynth_synth_patches_publish(synth, bank);
+
     pthread_mutex_unlock(&synth->patches_mutex);
+
+    return 1;
 }
 
 /*
@@ -481,7 +575,13 @@ xsynth_synth_set_program_descriptor(xsynth_synth_t *synth,
     }
     pd->Bank = bank;
     pd->Program = program;
-    pd->Name = synth->patches[program].name;
+
+    /* copy the name, since the bank it's in may be freed by a later change */
+    pthread_mutex_lock(&synth->patches_mutex);
+    memcpy(synth->program_name, synth->patches[program].name, 31);
+    pthread_mutex_unlock(&synth->patches_mutex);
+    synth->program_name[31] = 0;
+    pd->Name = synth->program_name;
     return 1;
 
 }
@@ -494,6 +594,7 @@ xsynth_synth_handle_patches(xsynth_synth_t *synth, const char *key,
                             const char *value)
 {
     int section, ret;
+    xsynth_patch_t *bank;
 
     XDB_MESSAGE(XDB_DATA, " xsynth_synth_handle_patches: received new '%s'\n", key);
 
@@ -501,9 +602,20 @@ xsynth_synth_handle_patches(xsynth_synth_t *synth, const char *key,
     if (section < 0 || section > 3)
         return xsynth_dssi_configure_message("patch configuration failed: invalid section '%c'", key[7]);
 
+    /* decode into a copy of the bank, so the audio thread never sees a
+     * section half-decoded, then swap it in */
     pthread_mutex_lock(&synth->patches_mutex);
 
-    ret = xsynth_data_decode_patches(value, &synth->patches[section * 32]);
+    if (!(bank = xsynth_synth_patches_copy(synth))) {
+        pthread_mutex_unlock(&synth->patches_mutex);
+        return xsynth_dssi_configure_message("patch configuration failed: out of memory");
+    }
+
+    ret = xsynth_data_decode_patches(value, &bank[section * 32]);
+    if (ret)
+        xsynth_synth_patches_publish(synth, bank);
+    else
+        free(bank);
 
     pthread_mutex_unlock(&synth->patches_mutex);
 
@@ -513,6 +625,209 @@ xsynth_synth_handle_patches(xsynth_synth_t *synth, const char *key,
     return NULL; /* success */
 }
 
+/* Configure handlers don't change the voice list, or anything else the
+ * audio thread is using, themselves.  Instead each sends a command down a
+ * single-producer, single-consumer ring, which the audio thread drains
+ * at the top of every run, so the audio thread never has to take a lock.
+ * 'command_mutex' is only taken by the non-realtime threads, to keep them
+ * to one sender at a time.  While the instance is inactive there is no
+ * audio thread to drain the ring, so commands are applied at once by
+ * their sender, and whatever is still in the ring at deactivate() is
+ * applied there.  Anything an applied command leaves behind to be freed
+ * (such as a replaced worker pool) is freed by the next sender. */
+
+/* how long, in milliseconds, a sender waits for room in a full ring */
+#define XSYNTH_COMMAND_TIMEOUT  200
+
+/*
+ * xsynth_synth_apply_command
+ */
+static void
+xsynth_synth_apply_command(xsynth_synth_t *synth, xsynth_command_t *command)
+{
+    xsynth_pool_t *old_pool;
+    xsynth_voice_t *voice;
+    int i;
+
+    switch (command->type) {
+
+      case XSYNTH_COMMAND_MONOPHONIC:
+        if (command->value == XSYNTH_MONO_MODE_OFF) {  /* polyphonic mode */
+            synth->monophonic = 0;
+            synth->voices = synth->polyphony;
+        } else {  /* one of the monophonic modes */
+            if (!synth->monophonic) xsynth_synth_all_voices_off(synth);
+            synth->monophonic = command->value;
+            synth->voices = 1;
+        }
+        break;
+
+      case XSYNTH_COMMAND_POLYPHONY:
+        synth->polyphony = command->value;
+        if (!synth->monophonic) {
+            synth->voices = command->value;
+            /* turn off any voices above the new limit */
+            for (i = command->value; i < XSYNTH_MAX_POLYPHONY; i++) {
+                if (_PLAYING(synth->voice[i]))
+                    xsynth_voice_off(synth, synth->voice[i]);
+            }
+        }
+        break;
+
+      case XSYNTH_COMMAND_FILTER:
+        if (synth->vcf_topology != command->value) {
+            synth->vcf_topology = command->value;
+            /* the two structures keep different state, so start the
+             * 12 and 24dB/oct filters of sounding voices afresh, and let
+             * the voices play on.  The MVCLPF-3 (mode 2) is unaffected. */
+            for (i = 0; i < XSYNTH_MAX_POLYPHONY; i++) {
+                voice = synth->voice[i];
+                if (_PLAYING(voice) && lrintf(*(synth->vcf_mode)) != 2) {
+                    voice->delay1 = 0.0f;
+                    voice->delay2 = 0.0f;
+                    voice->delay3 = 0.0f;
+                    voice->delay4 = 0.0f;
+                }
+            }
+        }
+        break;
+
+      case XSYNTH_COMMAND_POOL:
+        old_pool = synth->pool;
+        synth->pool = (xsynth_pool_t *)command->pointer;
+        command->pointer = old_pool;  /* for the sender to free */
+        break;
+
+      default:
+        break;
+    }
+}
+
+/*
+ * xsynth_synth_free_command
+ *
+ * free whatever an applied command left behind
+ */
+static void
+xsynth_synth_free_command(xsynth_command_t *command)
+{
+    if (command->type == XSYNTH_COMMAND_POOL && command->pointer)
+        xsynth_pool_free((xsynth_pool_t *)command->pointer);
+}
+
+/*
+ * xsynth_synth_reap_commands
+ *
+ * clean up after the commands the audio thread has applied since the
+ * last time.  Must be called with command_mutex held.
+ */
+static void
+xsynth_synth_reap_commands(xsynth_synth_t *synth)
+{
+    unsigned int tail = __atomic_load_n(&synth->command_tail, __ATOMIC_ACQUIRE);
+
+    for (; synth->command_reaped != tail; synth->command_reaped++)
+        xsynth_synth_free_command(&synth->command[synth->command_reaped &
+                                                  (XSYNTH_COMMAND_RING_SIZE - 1)]);
+}
+
+/*
+ * xsynth_synth_apply_commands
+ *
+ * apply every command waiting in the ring.  Called from the audio
+ * thread, or with command_mutex held while the instance is inactive.
+ */
+void
+xsynth_synth_apply_commands(xsynth_synth_t *synth)
+{
+    unsigned int head = __atomic_load_n(&synth->command_head, __ATOMIC_ACQUIRE);
+    unsigned int tail = synth->command_tail;
+
+    while (tail != head) {
+        xsynth_synth_apply_command(synth,
+                                   &synth->command[tail & (XSYNTH_COMMAND_RING_SIZE - 1)]);
+        tail++;
+        __atomic_store_n(&synth->command_tail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+/*
+ * xsynth_synth_send_command
+ *
+ * have 'command' applied by the audio thread before it next renders.
+ * Returns 0 if the ring stayed full, which should only happen if the
+ * host has stopped running the instance without deactivating it.  Never
+ * call this from the audio thread.
+ */
+int
+xsynth_synth_send_command(xsynth_synth_t *synth, xsynth_command_t *command)
+{
+    unsigned int head;
+    int waited = 0;
+
+    pthread_mutex_lock(&synth->command_mutex);
+
+    if (!__atomic_load_n(&synth->active, __ATOMIC_SEQ_CST)) {
+        /* nothing is rendering, so apply it here, after anything that
+         * was left in the ring */
+        xsynth_synth_apply_commands(synth);
+        xsynth_synth_reap_commands(synth);
+        xsynth_synth_apply_command(synth, command);
+        xsynth_synth_free_command(command);
+        pthread_mutex_unlock(&synth->command_mutex);
+        return 1;
+    }
+
+    xsynth_synth_reap_commands(synth);
+
+    /* wait a while for room in the ring */
+    head = synth->command_head;
+    while (head - __atomic_load_n(&synth->command_tail, __ATOMIC_ACQUIRE) ==
+               XSYNTH_COMMAND_RING_SIZE) {
+        if (!__atomic_load_n(&synth->active, __ATOMIC_SEQ_CST)) {
+            /* deactivate() is waiting on us, and the audio thread has
+             * stopped, so make the room ourselves */
+            xsynth_synth_apply_commands(synth);
+            break;
+        }
+        if (waited++ == XSYNTH_COMMAND_TIMEOUT) {
+            pthread_mutex_unlock(&synth->command_mutex);
+            return 0;
+        }
+        usleep(1000);
+    }
+
+    synth->command[head & (XSYNTH_COMMAND_RING_SIZE - 1)] = *command;
+    __atomic_store_n(&synth->command_head, head + 1, __ATOMIC_RELEASE);
+
+    pthread_mutex_unlock(&synth->command_mutex);
+    return 1;
+}
+
+/*
+ * xsynth_synth_set_active
+ *
+ * called from activate() and deactivate(), which the host never calls
+ * while the instance is running
+ */
+void
+xsynth_synth_set_active(xsynth_synth_t *synth, int active)
+{
+    if (active) {
+        pthread_mutex_lock(&synth->command_mutex);
+        __atomic_store_n(&synth->active, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&synth->command_mutex);
+    } else {
+        /* clear the flag first, so a sender waiting for room knows it
+         * can stop waiting on the audio thread */
+        __atomic_store_n(&synth->active, 0, __ATOMIC_SEQ_CST);
+        pthread_mutex_lock(&synth->command_mutex);
+        xsynth_synth_apply_commands(synth);
+        xsynth_synth_reap_commands(synth);
+        pthread_mutex_unlock(&synth->command_mutex);
+    }
+}
+
 /*
  * xsynth_synth_handle_monophonic
  */
@@ -520,6 +835,7 @@ char *
 xsynth_synth_handle_monophonic(xsynth_synth_t *synth, const char *value)
 {
     int mode = -1;
+    xsynth_command_t command;
 
     if (!strcmp(value, "on")) mode = XSYNTH_MONO_MODE_ON;
     else if (!strcmp(value, "once")) mode = XSYNTH_MONO_MODE_ONCE;
@@ -530,20 +846,10 @@ xsynth_synth_handle_monophonic(xsynth_synth_t *synth, const char *value)
         return xsynth_dssi_configure_message("error: monophonic value not recognized");
     }
 
-    if (mode == XSYNTH_MONO_MODE_OFF) {  /* polyphonic mode */
-
-        synth->monophonic = 0;
-        synth->voices = synth->polyphony;
-
-    } else {  /* one of the monophonic modes */
-
-        xsynth_voicelist_mutex_lock(synth);
-
-        if (!synth->monophonic) xsynth_synth_all_voices_off(synth);
-        synth->monophonic = mode;
-        synth->voices = 1;
-
-        xsynth_voicelist_mutex_unlock(synth);
+    command.type = XSYNTH_COMMAND_MONOPHONIC;
+    command.value = mode;
+    if (!xsynth_synth_send_command(synth, &command)) {
+        return xsynth_dssi_configure_message("error: audio thread is not running");
     }
 
     return NULL;
@@ -556,30 +862,16 @@ char *
 xsynth_synth_handle_polyphony(xsynth_synth_t *synth, const char *value)
 {
     int polyphony = atoi(value);
-    int i;
-    xsynth_voice_t *voice;
+    xsynth_command_t command;
 
     if (polyphony < 1 || polyphony > XSYNTH_MAX_POLYPHONY) {
         return xsynth_dssi_configure_message("error: polyphony value out of range");
     }
-    /* set the new limit */
-    synth->polyphony = polyphony;
-
-    if (!synth->monophonic) {
-        synth->voices = polyphony;
-
-        /* turn off any voices above the new limit */
-
-        xsynth_voicelist_mutex_lock(synth);
 
-        for (i = polyphony; i < XSYNTH_MAX_POLYPHONY; i++) {
-            voice = synth->voice[i];
-            if (_PLAYING(voice)) {
-                xsynth_voice_off(voice);
-            }
-        }
-
-        xsynth_voicelist_mutex_unlock(synth);
+    command.type = XSYNTH_COMMAND_POLYPHONY;
+    command.value = polyphony;
+    if (!xsynth_synth_send_command(synth, &command)) {
+        return xsynth_dssi_configure_message("error: audio thread is not running");
     }
 
     return NULL;
@@ -625,31 +917,402 @@ xsynth_synth_handle_bendrange(xsynth_synth_t *synth, const char *value)
     return NULL;
 }
 
+/*
+ * xsynth_synth_handle_render
+ */
+char *
+xsynth_synth_handle_render(xsynth_synth_t *synth, const char *value)
+{
+    int engine = -1;
+
+    if (!strcmp(value, "scalar"))    engine = XSYNTH_RENDER_SCALAR;
+    else if (!strcmp(value, "simd")) engine = XSYNTH_RENDER_SIMD;
+    else if (!strcmp(value, "fused")) engine = XSYNTH_RENDER_FUSED;
+
+    if (engine == -1) {
+        return xsynth_dssi_configure_message("error: render value not recognized");
+    }
+
+    synth->render_engine = engine;
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_stealing
+ */
+char *
+xsynth_synth_handle_stealing(xsynth_synth_t *synth, const char *value)
+{
+    int policy = -1;
+
+    if (!strcmp(value, "age"))           policy = XSYNTH_STEAL_AGE;
+    else if (!strcmp(value, "loudness")) policy = XSYNTH_STEAL_LOUDNESS;
+
+    if (policy == -1) {
+        return xsynth_dssi_configure_message("error: stealing value not recognized");
+    }
+
+    synth->steal_policy = policy;
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_silence
+ */
+char *
+xsynth_synth_handle_silence(xsynth_synth_t *synth, const char *value)
+{
+    char buffer[64];
+    char *end;
+    double db;
+
+    if (!strcmp(value, "off")) {
+
+        synth->silence_threshold = 0.0f;
+
+    } else if (!strcmp(value, "report")) {
+
+        snprintf(buffer, 64, "%lu voices retired early", synth->retired_voices);
+        return strdup(buffer);
+
+    } else {
+
+        db = strtod(value, &end);
+        if (end == value || *end != '\0' || db < -150.0 || db > -20.0) {
+            return xsynth_dssi_configure_message("error: silence value out of range");
+        }
+        /* compared against the mean square of each nugget's output */
+        synth->silence_threshold = (float)pow(10.0, db / 10.0);
+
+    }
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_minblep
+ */
+char *
+xsynth_synth_handle_minblep(xsynth_synth_t *synth, const char *value)
+{
+    int tier = -1, i;
+
+    if (!strcmp(value, "draft"))       tier = XSYNTH_MINBLEP_DRAFT;
+    else if (!strcmp(value, "medium")) tier = XSYNTH_MINBLEP_MEDIUM;
+    else if (!strcmp(value, "full"))   tier = XSYNTH_MINBLEP_FULL;
+
+    if (tier == -1) {
+        return xsynth_dssi_configure_message("error: minblep value not recognized");
+    }
+
+    /* a voice may switch tiers mid-note; pulses already placed are kept */
+    for (i = 0; i < XSYNTH_MAX_POLYPHONY; i++)
+        __atomic_store_n(&synth->voice[i]->minblep, &xsynth_minblep[tier], __ATOMIC_RELAXED);
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_controlrate
+ */
+char *
+xsynth_synth_handle_controlrate(xsynth_synth_t *synth, const char *value)
+{
+    int decimation = atoi(value);
+
+    if (decimation != 1 && decimation != 4 && decimation != 8 && decimation != 16) {
+        return xsynth_dssi_configure_message("error: controlrate value not recognized");
+    }
+
+    synth->control_decimation = decimation;
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_filter
+ */
+char *
+xsynth_synth_handle_filter(xsynth_synth_t *synth, const char *value)
+{
+    xsynth_command_t command;
+
+    if (!strcmp(value, "chamberlin")) {
+        command.value = XSYNTH_VCF_CHAMBERLIN;
+    } else if (!strcmp(value, "tpt")) {
+        command.value = XSYNTH_VCF_TPT;
+    } else {
+        return xsynth_dssi_configure_message("error: filter value not recognized");
+    }
+
+    command.type = XSYNTH_COMMAND_FILTER;
+    if (!xsynth_synth_send_command(synth, &command)) {
+        return xsynth_dssi_configure_message("error: audio thread is not running");
+    }
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_oversampling
+ */
+char *
+xsynth_synth_handle_oversampling(xsynth_synth_t *synth, const char *value)
+{
+    int oversample;
+
+    if (!strcmp(value, "classic")) {
+        oversample = XSYNTH_OVERSAMPLE_CLASSIC;
+    } else if (!strcmp(value, "auto")) {
+        oversample = XSYNTH_OVERSAMPLE_AUTO;
+    } else if (!strcmp(value, "1") || !strcmp(value, "2") || !strcmp(value, "4")) {
+        oversample = atoi(value);
+    } else {
+        return xsynth_dssi_configure_message("error: oversampling value not recognized");
+    }
+
+    /* the render code reads this once per burst, and copes with any
+     * change between bursts */
+    synth->mvclpf_oversample = oversample;
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_handle_denormals
+ */
+char *
+xsynth_synth_handle_denormals(xsynth_synth_t *synth, const char *value)
+{
+    if (!strcmp(value, "flush")) {
+        synth->denormal_mode = XSYNTH_DENORMALS_FLUSH;
+    } else if (!strcmp(value, "keep")) {
+        synth->denormal_mode = XSYNTH_DENORMALS_KEEP;
+    } else if (!strcmp(value, "count")) {
+        synth->denormal_mode = XSYNTH_DENORMALS_COUNT;
+    } else {
+        return xsynth_dssi_configure_message("error: denormals value not recognized");
+    }
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_profile_totals
+ *
+ * sum the profiling counters of all rendering threads.  This only reads
+ * the counters, so it is safe to call from any thread while the audio
+ * thread is running.
+ */
+static void
+xsynth_synth_profile_totals(xsynth_synth_t *synth, xsynth_profile_t *totals)
+{
+    int i, t;
+
+    memset(totals, 0, sizeof(xsynth_profile_t));
+    for (t = 0; t < XSYNTH_MAX_THREADS; t++) {
+        for (i = 0; i < XSYNTH_STAGE_COUNT; i++) {
+            totals->ticks[i] += __atomic_load_n(&synth->profile[t].ticks[i], __ATOMIC_RELAXED);
+            totals->samples[i] += __atomic_load_n(&synth->profile[t].samples[i], __ATOMIC_RELAXED);
+            totals->subnormals[i] += __atomic_load_n(&synth->profile[t].subnormals[i], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/*
+ * xsynth_synth_profile_report
+ *
+ * format the profiling counters, as accumulated since the last reset,
+ * into 'buffer'
+ */
+void
+xsynth_synth_profile_report(xsynth_synth_t *synth, char *buffer, int size)
+{
+    static const char *stage_names[XSYNTH_STAGE_COUNT] = {
+        "lfo/eg", "osc", "vcf 2-pole", "vcf 4-pole", "vcf mvclpf", "shift", "render",
+        "fused"
+    };
+    xsynth_profile_t totals;
+    uint64_t ticks, samples, subnormals;
+    int i, len;
+
+    xsynth_synth_profile_totals(synth, &totals);
+
+    len = snprintf(buffer, size, "profile (%s per voice-sample, render per output sample):",
+                   XSYNTH_PROFILE_UNITS);
+    for (i = 0; i < XSYNTH_STAGE_COUNT && len < size; i++) {
+        ticks = totals.ticks[i] - synth->profile_base.ticks[i];
+        samples = totals.samples[i] - synth->profile_base.samples[i];
+        if (samples)
+            len += snprintf(buffer + len, size - len, " %s %.1f%s", stage_names[i],
+                            (double)ticks / (double)samples,
+                            (i < XSYNTH_STAGE_COUNT - 1 ? "," : ""));
+        else
+            len += snprintf(buffer + len, size - len, " %s -%s", stage_names[i],
+                            (i < XSYNTH_STAGE_COUNT - 1 ? "," : ""));
+    }
+
+    if (synth->denormal_mode != XSYNTH_DENORMALS_COUNT)
+        return;
+
+    /* the stages which produced subnormals, and how many */
+    if (len < size)
+        len += snprintf(buffer + len, size - len, "; subnormals:");
+    for (i = 0; i < XSYNTH_STAGE_COUNT && len < size; i++) {
+        subnormals = totals.subnormals[i] - synth->profile_base.subnormals[i];
+        if (subnormals)
+            len += snprintf(buffer + len, size - len, " %s %llu", stage_names[i],
+                            (unsigned long long)subnormals);
+    }
+}
+
+/*
+ * xsynth_synth_handle_profile
+ */
+char *
+xsynth_synth_handle_profile(xsynth_synth_t *synth, const char *value)
+{
+#ifdef XSYNTH_PROFILE
+    char buffer[512];
+
+    if (!strcmp(value, "on")) {
+
+        synth->profile_enabled = 1;
+
+    } else if (!strcmp(value, "off")) {
+
+        synth->profile_enabled = 0;
+
+    } else if (!strcmp(value, "reset")) {
+
+        /* the rendering threads own the counters, so instead of zeroing
+         * them, remember where they are now and report relative to that */
+        xsynth_synth_profile_totals(synth, &synth->profile_base);
+
+    } else if (!strcmp(value, "report")) {
+
+        xsynth_synth_profile_report(synth, buffer, 512);
+        return strdup(buffer);
+
+    } else
+        return xsynth_dssi_configure_message("error: profile value not recognized");
+
+    return NULL;
+#else
+    return xsynth_dssi_configure_message("error: profiling was not compiled in");
+#endif
+}
+
+/*
+ * xsynth_synth_handle_threads
+ */
+char *
+xsynth_synth_handle_threads(xsynth_synth_t *synth, const char *value)
+{
+    int threads = atoi(value), cpus;
+    xsynth_pool_t *pool = NULL;
+    xsynth_command_t command;
+
+    if (threads < 1 || threads > XSYNTH_MAX_THREADS) {
+        return xsynth_dssi_configure_message("error: threads value out of range");
+    }
+    /* never run more threads than there are processors to run them on */
+    cpus = xsynth_pool_processors();
+    if (threads > cpus)
+        threads = cpus;
+    if (threads == synth->threads)
+        return NULL;
+
+    if (threads > 1 && !(pool = xsynth_pool_new(synth, threads))) {
+        return xsynth_dssi_configure_message("error: could not start worker threads");
+    }
+
+    /* have the audio thread swap pools between runs; the old one is freed
+     * once it has */
+    command.type = XSYNTH_COMMAND_POOL;
+    command.pointer = pool;
+    if (!xsynth_synth_send_command(synth, &command)) {
+        if (pool)
+            xsynth_pool_free(pool);
+        return xsynth_dssi_configure_message("error: audio thread is not running");
+    }
+    synth->threads = threads;
+
+    return NULL;
+}
+
+/*
+ * xsynth_synth_render_voice_list
+ *
+ * render a list of playing voices with the selected render engine,
+ * adding to 'out'
+ */
+void
+xsynth_synth_render_voice_list(xsynth_synth_t *synth, xsynth_voice_t **voices,
+                               int count, LADSPA_Data *out,
+                               unsigned long sample_count, int do_control_update)
+{
+    int i;
+
+    if (synth->render_engine == XSYNTH_RENDER_SIMD) {
+        xsynth_voice_render_simd(synth, voices, count, out, sample_count,
+                                 do_control_update);
+    } else {
+        for (i = 0; i < count; i++)
+            synth->render_kernel(synth, voices[i], out, sample_count, do_control_update);
+    }
+}
+
 /*
  * xsynth_synth_render_voices
  */
 void
 xsynth_synth_render_voices(xsynth_synth_t *synth, LADSPA_Data *out, unsigned long sample_count,
-                        int do_control_update)
+                        int do_control_update, int adding)
 {
     unsigned long i;
-    xsynth_voice_t* voice;
-
-    /* clear the buffer */
-    for (i = 0; i < sample_count; i++)
-        out[i] = 0.0f;
+    xsynth_voice_t *playing[XSYNTH_MAX_POLYPHONY];
+    uint64_t mask = ~synth->free_voices;
+    int count = 0;
+    XSYNTH_PROFILE_START();
+
+    /* clear the buffer, unless we're adding to it */
+    if (!adding) {
+        for (i = 0; i < sample_count; i++)
+            out[i] = 0.0f;
+    }
 
 #if defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO)
 out[0] += 0.10f; /* add a 'buzz' to output so there's something audible even when quiescent */
 #endif /* defined(XSYNTH_DEBUG) && (XSYNTH_DEBUG & XDB_AUDIO) */
 
-    /* render each active voice */
-    for (i = 0; i < synth->voices; i++) {
-        voice = synth->voice[i];
-    
-        if (_PLAYING(voice)) {
-            xsynth_voice_render(synth, voice, out, sample_count, do_control_update);
+    /* list the playing voices, in voice order */
+    while (mask) {
+        playing[count++] = synth->voice[__builtin_ctzll(mask)];
+        mask &= mask - 1;
+    }
+
+    /* render them, spreading them over the worker pool if there is one
+     * and it's worth waking it */
+    if (synth->pool && count > 1)
+        xsynth_pool_render(synth->pool, playing, count, out, sample_count,
+                           do_control_update);
+    else
+        xsynth_synth_render_voice_list(synth, playing, count, out, sample_count,
+                                       do_control_update);
+
+    /* voices which decayed to nothing during rendering are only marked
+     * as finished there, since the render may be spread across threads;
+     * turn them off now */
+    for (i = 0; i < count; i++) {
+        if (playing[i]->finished) {
+            if (playing[i]->finished == 2)
+                synth->retired_voices++;
+            xsynth_voice_off(synth, playing[i]);
         }
     }
-}
 
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_RENDER, sample_count);
+}
@@ -26,6 +26,7 @@
 #ifndef _XSYNTH_SYNTH_H
 #define _XSYNTH_SYNTH_H
 
+#include <stdint.h>
 #include <pthread.h>
 
 #include <ladspa.h>
@@ -45,6 +46,68 @@
 #define XSYNTH_GLIDE_MODE_LEFTOVER 3
 #define XSYNTH_GLIDE_MODE_OFF      4
 
+#define XSYNTH_RENDER_SCALAR  0  /* one voice at a time */
+#define XSYNTH_RENDER_SIMD    1  /* XSYNTH_SIMD_LANES voices at a time */
+#define XSYNTH_RENDER_FUSED   2  /* one voice at a time, in a single pass per sample */
+
+#define XSYNTH_VCF_CHAMBERLIN  0  /* state-variable 2- and 4-pole filters, as in Xsynth */
+#define XSYNTH_VCF_TPT         1  /* zero-delay-feedback (TPT) 2- and 4-pole filters */
+
+#define XSYNTH_DENORMALS_FLUSH  0  /* flush subnormals to zero while rendering */
+#define XSYNTH_DENORMALS_KEEP   1  /* leave the host's floating point mode alone */
+#define XSYNTH_DENORMALS_COUNT  2  /* leave it alone, and count the subnormals each stage produces */
+
+#define XSYNTH_OVERSAMPLE_CLASSIC  0    /* MVCLPF-3's own two steps per sample */
+#define XSYNTH_OVERSAMPLE_AUTO   (-1)   /* 1, 2 or 4 times, chosen per voice and burst */
+
+/* number of consecutive nuggets a released voice's output must be below
+ * the 'silence' threshold before it is retired early */
+#define XSYNTH_SILENCE_NUGGETS  16
+
+#define XSYNTH_STEAL_AGE       0  /* steal by status and note age */
+#define XSYNTH_STEAL_LOUDNESS  1  /* steal by status, note age and envelope level */
+
+/* commands from the configure handlers to the audio thread, see
+ * xsynth_synth_send_command() */
+#define XSYNTH_COMMAND_MONOPHONIC  0  /* 'value' is the XSYNTH_MONO_MODE_* */
+#define XSYNTH_COMMAND_POLYPHONY   1  /* 'value' is the new polyphony */
+#define XSYNTH_COMMAND_FILTER      2  /* 'value' is the XSYNTH_VCF_* topology */
+#define XSYNTH_COMMAND_POOL        3  /* 'pointer' is the new worker pool, or NULL */
+
+#define XSYNTH_COMMAND_RING_SIZE  32  /* must be a power of two */
+
+/*
+ * xsynth_command_t
+ */
+typedef struct {
+    int             type;              /* XSYNTH_COMMAND_* */
+    int             value;
+    void           *pointer;
+} xsynth_command_t;
+
+/* profiling stages, see XSYNTH_PROFILE in xsynth.h */
+#define XSYNTH_STAGE_MODULATORS   0  /* LFO, EG1 and EG2 */
+#define XSYNTH_STAGE_OSCILLATORS  1  /* VCO1 and VCO2 */
+#define XSYNTH_STAGE_VCF          2  /* VCF and VCA, plus vcf_mode (0 to 2) */
+#define XSYNTH_STAGE_SHIFT        5  /* control update and osc_audio wrap */
+#define XSYNTH_STAGE_RENDER       6  /* all of xsynth_synth_render_voices() */
+#define XSYNTH_STAGE_FUSED        7  /* the fused engine's single pass */
+#define XSYNTH_STAGE_COUNT        8
+
+/*
+ * xsynth_profile_t
+ */
+typedef struct {
+    uint64_t        ticks[XSYNTH_STAGE_COUNT];    /* XSYNTH_PROFILE_UNITS spent in each stage */
+    uint64_t        samples[XSYNTH_STAGE_COUNT];  /* voice-samples (or for _RENDER, output samples) rendered */
+    uint64_t        subnormals[XSYNTH_STAGE_COUNT]; /* subnormal results, in XSYNTH_DENORMALS_COUNT mode */
+} __attribute__((aligned(64))) xsynth_profile_t;  /* keep each thread's on its own cache lines */
+
+/* a scalar voice render function, see xsynth_voice_select_kernel() */
+typedef void (*xsynth_render_kernel_t)(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                                       LADSPA_Data *out, unsigned long sample_count,
+                                       int do_control_update);
+
 /*
  * xsynth_synth_t
  */
@@ -53,25 +116,54 @@ struct _xsynth_synth_t {
     LADSPA_Data    *output;
     unsigned long   sample_rate;
     float           deltat;            /* 1 / sample_rate */
+    LADSPA_Data     run_adding_gain;   /* as set by set_run_adding_gain() */
+    float           render_gain;       /* output gain for the current run: run_adding_gain if adding, else 1 */
     unsigned long   nugget_remains;
 
     /* voice tracking and data */
     unsigned int    note_id;           /* incremented for every new note, used for voice-stealing prioritization */
     int             polyphony;         /* requested polyphony, must be <= XSYNTH_MAX_POLYPHONY */
     int             voices;            /* current polyphony, either requested polyphony above or 1 while in monophonic mode */
+    int             active_voices;     /* number of voices not XSYNTH_VOICE_OFF, kept by xsynth_voice_start_voice() and xsynth_voice_off() */
+    uint64_t        free_voices;       /* bit i set if voice[i] is XSYNTH_VOICE_OFF */
+    uint64_t        key_voices[128];   /* per key, bit i set if voice[i] is playing that key */
+    xsynth_voice_t *oldest[4];         /* per playing XSYNTH_VOICE_* status, age-ordered list of voices */
+    xsynth_voice_t *youngest[4];
     int             monophonic;        /* true if operating in monophonic mode */
     int             glide;             /* current glide mode */
     float           last_noteon_pitch; /* glide start pitch for non-legato modes */
     signed char     held_keys[8];      /* for monophonic key tracking, an array of note-ons, most recently received first */
-    
-    pthread_mutex_t voicelist_mutex;
-    int             voicelist_mutex_grab_failed;
+    int             render_engine;     /* XSYNTH_RENDER_* voice render engine */
+    xsynth_render_kernel_t render_kernel; /* scalar render function specialized for the current ports */
+    int             control_decimation; /* samples per LFO and EG evaluation in the scalar engine, past the attacks */
+    int             vcf_topology;      /* XSYNTH_VCF_* structure of the 2- and 4-pole filter modes */
+    int             mvclpf_oversample; /* XSYNTH_OVERSAMPLE_*, or a fixed MVCLPF oversampling factor of 1, 2 or 4 */
+    int             denormal_mode;     /* XSYNTH_DENORMALS_* handling of subnormal floats */
+    int             steal_policy;      /* XSYNTH_STEAL_* voice stealing policy */
+    float           silence_threshold; /* mean square output level below which released voices are retired, or 0 */
+    unsigned long   retired_voices;    /* count of voices retired early for silence */
+    xsynth_pool_t  *pool;              /* worker threads, or NULL to render on the audio thread alone */
+    int             threads;           /* rendering threads last asked for, counting the audio thread */
+    int             profile_enabled;   /* true if the render code should update 'profile' */
+    xsynth_profile_t profile[XSYNTH_MAX_THREADS]; /* per rendering thread, each written only by its thread */
+    xsynth_profile_t profile_base;     /* summed counter values at last 'profile' reset, not touched by the audio thread */
+
+    /* ring of commands to the audio thread, with one sender at a time */
+    pthread_mutex_t command_mutex;     /* serializes the non-realtime senders */
+    unsigned int    command_head;      /* count of commands sent, written only by the sender */
+    unsigned int    command_tail;      /* count of commands applied, written only by the applying thread */
+    unsigned int    command_reaped;    /* count of applied commands cleaned up after, by the sender */
+    int             active;            /* true between activate() and deactivate(), accessed with __atomic builtins */
+    xsynth_command_t command[XSYNTH_COMMAND_RING_SIZE];
 
     xsynth_voice_t *voice[XSYNTH_MAX_POLYPHONY];
+    xsynth_voice_t *voice_arena;       /* the voices, then 'scratch', in one allocation */
+    xsynth_scratch_t *scratch;         /* per rendering thread, selected by xsynth_thread_index */
 
-    pthread_mutex_t patches_mutex;
-    xsynth_patch_t *patches;
-    int             pending_program_change;
+    pthread_mutex_t patches_mutex;     /* serializes the non-realtime threads' changes and reads of the bank */
+    xsynth_patch_t *patches;           /* the current bank of 128 patches, never changed once published */
+    unsigned int    patches_reading;   /* odd while the audio thread is reading from 'patches' */
+    char            program_name[32];  /* name of the last program asked for by get_program() */
     int             current_program;
 
     /* current non-LADSPA-port-mapped controller values */
@@ -138,7 +230,7 @@ void  xsynth_synth_pitch_bend(xsynth_synth_t *synth, signed int value);
 void  xsynth_synth_init_controls(xsynth_synth_t *synth);
 void  xsynth_synth_select_program(xsynth_synth_t *synth, unsigned long bank,
                                   unsigned long program);
-void  xsynth_data_friendly_patches(xsynth_synth_t *synth);
+int   xsynth_data_friendly_patches(xsynth_synth_t *synth);
 int   xsynth_synth_set_program_descriptor(xsynth_synth_t *synth,
                                           DSSI_Program_Descriptor *pd,
                                           unsigned long bank,
@@ -149,13 +241,29 @@ char *xsynth_synth_handle_polyphony(xsynth_synth_t *synth, const char *value);
 char *xsynth_synth_handle_monophonic(xsynth_synth_t *synth, const char *value);
 char *xsynth_synth_handle_glide(xsynth_synth_t *synth, const char *value);
 char *xsynth_synth_handle_bendrange(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_render(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_stealing(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_silence(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_minblep(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_controlrate(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_filter(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_oversampling(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_denormals(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_profile(xsynth_synth_t *synth, const char *value);
+char *xsynth_synth_handle_threads(xsynth_synth_t *synth, const char *value);
+void  xsynth_synth_profile_report(xsynth_synth_t *synth, char *buffer, int size);
+int   xsynth_synth_send_command(xsynth_synth_t *synth, xsynth_command_t *command);
+void  xsynth_synth_apply_commands(xsynth_synth_t *synth);
+void  xsynth_synth_set_active(xsynth_synth_t *synth, int active);
+void  xsynth_synth_render_voice_list(xsynth_synth_t *synth,
+                                     xsynth_voice_t **voices, int count,
+                                     LADSPA_Data *out, unsigned long sample_count,
+                                     int do_control_update);
 void  xsynth_synth_render_voices(xsynth_synth_t *synth, LADSPA_Data *out,
                                  unsigned long sample_count,
-                                 int do_control_update);
+                                 int do_control_update, int adding);
 
 /* in xsynth-dssi.c: */
-int   xsynth_voicelist_mutex_lock(xsynth_synth_t *synth);
-int   xsynth_voicelist_mutex_unlock(xsynth_synth_t *synth);
 char *xsynth_dssi_configure_message(const char *fmt, ...);
 
 /* these come right out of alsa/asoundef.h */
@@ -28,5 +28,8 @@
 typedef struct _xsynth_synth_t xsynth_synth_t;
 typedef struct _xsynth_voice_t xsynth_voice_t;
 typedef struct _xsynth_patch_t xsynth_patch_t;
+typedef struct _xsynth_pool_t  xsynth_pool_t;
+typedef struct _xsynth_scratch_t xsynth_scratch_t;
+typedef struct _xsynth_minblep_t xsynth_minblep_t;
 
 #endif /* _XSYNTH_TYPES_H */
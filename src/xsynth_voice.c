@@ -35,18 +35,37 @@
 #include "xsynth_voice.h"
 
 /*
- * xsynth_voice_new
+ * xsynth_voice_arena_new
+ *
+ * allocate all of a synth's voices, followed by a set of scratch buffers
+ * for each rendering thread, in one cache-aligned block.  Returns zero
+ * if out of memory.
  */
-xsynth_voice_t *
-xsynth_voice_new(xsynth_synth_t *synth)
+int
+xsynth_voice_arena_new(xsynth_synth_t *synth)
 {
+    size_t size = XSYNTH_MAX_POLYPHONY * sizeof(xsynth_voice_t) +
+                  XSYNTH_MAX_THREADS * sizeof(xsynth_scratch_t);
     xsynth_voice_t *voice;
+    int i;
 
-    voice = (xsynth_voice_t *)calloc(sizeof(xsynth_voice_t), 1);
-    if (voice) {
+    if (posix_memalign((void **)&synth->voice_arena, 64, size)) {
+        synth->voice_arena = NULL;
+        return 0;
+    }
+    memset(synth->voice_arena, 0, size);
+    synth->scratch = (xsynth_scratch_t *)(synth->voice_arena + XSYNTH_MAX_POLYPHONY);
+
+    for (i = 0; i < XSYNTH_MAX_POLYPHONY; i++) {
+        voice = &synth->voice_arena[i];
         voice->status = XSYNTH_VOICE_OFF;
+        voice->index = i;
+        voice->minblep = &xsynth_minblep[XSYNTH_MINBLEP_FULL];
+        synth->voice[i] = voice;
     }
-    return voice;
+    synth->free_voices = ~0ULL;  /* one bit per voice, XSYNTH_MAX_POLYPHONY of them */
+
+    return 1;
 }
 
 /*
@@ -58,7 +77,7 @@ xsynth_voice_note_on(xsynth_synth_t *synth, xsynth_voice_t *voice,
 {
     int i;
 
-    voice->key      = key;
+    xsynth_voice_set_key(synth, voice, key);
     voice->velocity = velocity;
 
     if (!synth->monophonic || !(_ON(voice) || _SUSTAINED(voice))) {
@@ -103,7 +122,7 @@ xsynth_voice_note_on(xsynth_synth_t *synth, xsynth_voice_t *voice,
             break;
         }
         if (!_PLAYING(voice)) {
-            voice->lfo_pos = 0.0f;
+            voice->lfo_phase = 0;
             voice->eg1 = 0.0f;
             voice->eg2 = 0.0f;
             voice->delay1 = 0.0f;
@@ -111,7 +130,11 @@ xsynth_voice_note_on(xsynth_synth_t *synth, xsynth_voice_t *voice,
             voice->delay3 = 0.0f;
             voice->delay4 = 0.0f;
             voice->c5     = 0.0f;
-            voice->osc_index = 0;
+            voice->mvclpf_factor = 0;  /* the decimators get cleared on first use */
+            /* start osc_index at the synth's offset within the nugget,
+             * so a burst never reads across the end of osc_audio */
+            voice->osc_index = (XSYNTH_NUGGET_SIZE - synth->nugget_remains) &
+                                   (XSYNTH_NUGGET_SIZE - 1);
             voice->osc1.last_waveform = -1;
             voice->osc1.pos = 0.0f;
             voice->osc2.last_waveform = -1;
@@ -119,6 +142,7 @@ xsynth_voice_note_on(xsynth_synth_t *synth, xsynth_voice_t *voice,
         }
         voice->eg1_phase = 0;
         voice->eg2_phase = 0;
+        voice->silent_nuggets = 0;
         xsynth_voice_update_pressure_mod(synth, voice);
 
     } else {
@@ -161,11 +185,11 @@ xsynth_voice_note_on(xsynth_synth_t *synth, xsynth_voice_t *voice,
 
     if (!_PLAYING(voice)) {
 
-        xsynth_voice_start_voice(voice);
+        xsynth_voice_start_voice(synth, voice);
 
     } else if (!_ON(voice)) {  /* must be XSYNTH_VOICE_SUSTAINED or XSYNTH_VOICE_RELEASED */
 
-        voice->status = XSYNTH_VOICE_ON;
+        xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_ON);
 
     }
 }
@@ -230,7 +254,7 @@ xsynth_voice_note_off(xsynth_synth_t *synth, xsynth_voice_t *voice,
             if (synth->held_keys[0] != previous_top_key) {
 
                 /* most-recently-played key has changed */
-                voice->key = synth->held_keys[0];
+                xsynth_voice_set_key(synth, voice, synth->held_keys[0]);
                 XDB_MESSAGE(XDB_NOTE, " note-off in monophonic section: changing pitch to %d\n", voice->key);
                 voice->target_pitch = xsynth_pitch[voice->key];
                 if (synth->glide == XSYNTH_GLIDE_MODE_INITIAL ||
@@ -252,14 +276,14 @@ xsynth_voice_note_off(xsynth_synth_t *synth, xsynth_voice_t *voice,
                 /* no more keys in list, but we're sustained */
                 XDB_MESSAGE(XDB_NOTE, " note-off in monophonic section: sustained with no held keys\n");
                 if (!_RELEASED(voice))
-                    voice->status = XSYNTH_VOICE_SUSTAINED;
+                    xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_SUSTAINED);
 
             } else {  /* not sustained */
 
                 /* no more keys in list, so turn off note */
                 XDB_MESSAGE(XDB_NOTE, " note-off in monophonic section: turning off voice %p\n", voice);
                 xsynth_voice_set_release_phase(voice);
-                voice->status = XSYNTH_VOICE_RELEASED;
+                xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_RELEASED);
 
             }
         }
@@ -269,12 +293,12 @@ xsynth_voice_note_off(xsynth_synth_t *synth, xsynth_voice_t *voice,
         if (XSYNTH_SYNTH_SUSTAINED(synth)) {
 
             if (!_RELEASED(voice))
-                voice->status = XSYNTH_VOICE_SUSTAINED;
+                xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_SUSTAINED);
 
         } else {  /* not sustained */
 
             xsynth_voice_set_release_phase(voice);
-            voice->status = XSYNTH_VOICE_RELEASED;
+            xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_RELEASED);
 
         }
     }
@@ -292,7 +316,7 @@ xsynth_voice_release_note(xsynth_synth_t *synth, xsynth_voice_t *voice)
         voice->rvelocity = 64;
     }
     xsynth_voice_set_release_phase(voice);
-    voice->status = XSYNTH_VOICE_RELEASED;
+    xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_RELEASED);
 }
 
 /*
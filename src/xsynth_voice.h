@@ -32,10 +32,18 @@
 #include "dssi.h"
 
 #include "xsynth_types.h"
+#include "xsynth_synth.h"
 
 /* maximum size of a rendering burst */
 #define XSYNTH_NUGGET_SIZE      64
 
+/* number of voices rendered together by the SIMD render engine */
+#if defined(__AVX__)
+#define XSYNTH_SIMD_LANES        8
+#else
+#define XSYNTH_SIMD_LANES        4
+#endif
+
 /* minBLEP constants */
 /* minBLEP table oversampling factor (must be a power of two): */
 #define MINBLEP_PHASES          64
@@ -47,9 +55,15 @@
 #define SLOPE_DD_PULSE_LENGTH   71
 /* the longer of the two above: */
 #define LONGEST_DD_PULSE_LENGTH STEP_DD_PULSE_LENGTH
-/* MINBLEP_BUFFER_LENGTH must be at least XSYNTH_NUGGET_SIZE plus
- * LONGEST_DD_PULSE_LENGTH, and not less than twice LONGEST_DD_PULSE_LENGTH: */
-#define MINBLEP_BUFFER_LENGTH  512
+/* length of each phase of the minBLEP tables, LONGEST_DD_PULSE_LENGTH
+ * padded to a multiple of 8 so the taps go in whole vectors: */
+#define MINBLEP_PULSE_STRIDE    72
+/* osc_audio is a circular buffer.  MINBLEP_BUFFER_LENGTH must be a power
+ * of two, a multiple of XSYNTH_NUGGET_SIZE, and at least XSYNTH_NUGGET_SIZE
+ * plus LONGEST_DD_PULSE_LENGTH: */
+#define MINBLEP_BUFFER_LENGTH  256
+/* MINBLEP_BUFFER_LENGTH minus one: */
+#define MINBLEP_BUFFER_MASK    255
 /* delay between start of DD pulse and the discontinuity, in samples: */
 #define DD_SAMPLE_DELAY          4
 
@@ -109,6 +123,10 @@ struct blosc
 
 /*
  * xsynth_voice_t
+ *
+ * The voices of a synth are allocated together, each aligned to a cache
+ * line, with the scalar state the render code uses first and the
+ * oscillator audio buffer last.
  */
 struct _xsynth_voice_t
 {
@@ -118,14 +136,27 @@ struct _xsynth_voice_t
     unsigned char key;
     unsigned char velocity;
     unsigned char rvelocity;   /* the note-off velocity */
+    unsigned char finished;    /* set by the render code: 1 once the voice has decayed to nothing,
+                                * 2 if it was retired early for being silent */
+
+    /* voice manager bookkeeping */
+    int             index;     /* position in synth->voice[] */
+    xsynth_voice_t *older,     /* neighbors in the age-ordered list for this voice's status */
+                   *younger;
+
+    /* output energy tracking, for retiring silent voices */
+    float         energy;      /* sum of squares of this voice's output so far this nugget */
+    int           silent_nuggets; /* number of consecutive nuggets below the silence threshold */
+
+    const xsynth_minblep_t *minblep; /* minBLEP tables of the current quality tier */
 
     /* translated controller values */
     float         pressure;    /* filter resonance multiplier, off = 1.0, full on = 0.0 */
 
     /* persistent voice state */
     float         prev_pitch,
-                  target_pitch,
-                  lfo_pos;
+                  target_pitch;
+    unsigned int  lfo_phase;   /* LFO position, as a 32-bit fixed-point fraction of a cycle */
     struct blosc  osc1,
                   osc2;
     float         eg1,
@@ -135,15 +166,32 @@ struct _xsynth_voice_t
                   delay3,
                   delay4,
                   c5;
+    float         decim2[7],   /* halfband decimator histories of the oversampled MVCLPF, */
+                  decim4[4];   /* at twice and four times the sample rate */
     unsigned char eg1_phase,
-                  eg2_phase;
-    int           osc_index;       /* shared index into osc_audio */
-    float         osc_audio[MINBLEP_BUFFER_LENGTH];
+                  eg2_phase,
+                  mvclpf_factor;   /* MVCLPF oversampling factor of the last burst, 0 if classic */
+    int           osc_index;       /* shared index into osc_audio, always at the same
+                                    * offset within a nugget as the synth */
+    float         osc_audio[MINBLEP_BUFFER_LENGTH] __attribute__((aligned(64)));
+} __attribute__((aligned(64)));
+
+/*
+ * xsynth_scratch_t
+ *
+ * per-burst working buffers, which don't need to persist from one voice
+ * to the next, so each rendering thread has just one set
+ */
+struct _xsynth_scratch_t
+{
     float         osc_sync[XSYNTH_NUGGET_SIZE]; /* buffer for sync subsample offsets */
     float         osc2_w_buf[XSYNTH_NUGGET_SIZE];
     float         freqcut_buf[XSYNTH_NUGGET_SIZE];
     float         vca_buf[XSYNTH_NUGGET_SIZE];
-};
+    float         lfo_buf[XSYNTH_NUGGET_SIZE];
+    float         eg1_buf[XSYNTH_NUGGET_SIZE];
+    float         eg2_buf[XSYNTH_NUGGET_SIZE];
+} __attribute__((aligned(64)));
 
 #define _PLAYING(voice)    ((voice)->status != XSYNTH_VOICE_OFF)
 #define _ON(voice)         ((voice)->status == XSYNTH_VOICE_ON)
@@ -153,13 +201,36 @@ struct _xsynth_voice_t
 
 extern float xsynth_pitch[128];
 
-typedef struct { float value, delta; } float_value_delta;
-extern float_value_delta xsynth_step_dd_table[];
+/* one phase of a minBLEP table: the pulse's taps at this phase, and the
+ * differences to the next phase's taps */
+typedef struct {
+    float value[MINBLEP_PULSE_STRIDE];
+    float delta[MINBLEP_PULSE_STRIDE];
+} __attribute__((aligned(64))) xsynth_minblep_phase_t;
+
+extern const xsynth_minblep_phase_t xsynth_step_dd_table[MINBLEP_PHASES];
+extern const xsynth_minblep_phase_t xsynth_slope_dd_table[MINBLEP_PHASES];
 
-extern float xsynth_slope_dd_table[];
+/* minBLEP quality tiers, selected per instance with the 'minblep'
+ * configure key */
+#define XSYNTH_MINBLEP_DRAFT   0  /* 16-tap pulses */
+#define XSYNTH_MINBLEP_MEDIUM  1  /* 32-tap pulses */
+#define XSYNTH_MINBLEP_FULL    2  /* the full 72-tap pulses (the default) */
+#define XSYNTH_MINBLEP_TIERS   3
+
+/*
+ * xsynth_minblep_t
+ */
+struct _xsynth_minblep_t {
+    int           length;      /* taps placed per pulse, at most MINBLEP_PULSE_STRIDE */
+    const xsynth_minblep_phase_t *step,
+                                 *slope;
+};
+
+extern const xsynth_minblep_t xsynth_minblep[XSYNTH_MINBLEP_TIERS];
 
 /* xsynth_voice.c */
-xsynth_voice_t *xsynth_voice_new(xsynth_synth_t *synth);
+int             xsynth_voice_arena_new(xsynth_synth_t *synth);
 void            xsynth_voice_note_on(xsynth_synth_t *synth,
                                      xsynth_voice_t *voice,
                                      unsigned char key,
@@ -182,9 +253,102 @@ void xsynth_init_tables(void);
 void xsynth_voice_render(xsynth_synth_t *synth, xsynth_voice_t *voice,
                          LADSPA_Data *out, unsigned long sample_count,
                          int do_control_update);
+void xsynth_voice_select_kernel(xsynth_synth_t *synth);
+void xsynth_voice_render_simd(xsynth_synth_t *synth, xsynth_voice_t **voices,
+                              int count, LADSPA_Data *out,
+                              unsigned long sample_count,
+                              int do_control_update);
+float xsynth_voice_check_eg(float attack_rate, float decay_rate, float sustain,
+                            unsigned long length, unsigned long release,
+                            long *flips);
 
 /* inline functions */
 
+/* The voice manager keeps, alongside each voice's status:
+ * - synth->free_voices, a bitmap of the voices which are off,
+ * - synth->key_voices[], a bitmap per key of the playing voices on that key,
+ * - for each playing status, a list of the voices with that status, in
+ *     order of note_id, oldest first.
+ * All voice status and key changes must go through these functions to
+ * keep them up to date. */
+
+/*
+ * xsynth_voice_unlink
+ *
+ * remove a playing voice from the age-ordered list for its status
+ */
+static inline void
+xsynth_voice_unlink(xsynth_synth_t *synth, xsynth_voice_t *voice)
+{
+    if (voice->older)
+        voice->older->younger = voice->younger;
+    else
+        synth->oldest[voice->status] = voice->younger;
+    if (voice->younger)
+        voice->younger->older = voice->older;
+    else
+        synth->youngest[voice->status] = voice->older;
+}
+
+/*
+ * xsynth_voice_link
+ *
+ * add a playing voice to the age-ordered list for its status.  Voices
+ * mostly change status in about the order they were started, so the
+ * search from the young end is usually short.
+ */
+static inline void
+xsynth_voice_link(xsynth_synth_t *synth, xsynth_voice_t *voice)
+{
+    xsynth_voice_t *older = synth->youngest[voice->status];
+
+    while (older && (int)(older->note_id - voice->note_id) > 0)
+        older = older->older;
+
+    voice->older = older;
+    if (older) {
+        voice->younger = older->younger;
+        older->younger = voice;
+    } else {
+        voice->younger = synth->oldest[voice->status];
+        synth->oldest[voice->status] = voice;
+    }
+    if (voice->younger)
+        voice->younger->older = voice;
+    else
+        synth->youngest[voice->status] = voice;
+}
+
+/*
+ * xsynth_voice_set_status
+ *
+ * change the status of a playing voice to another playing status
+ */
+static inline void
+xsynth_voice_set_status(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                        unsigned char status)
+{
+    if (voice->status != status) {
+        xsynth_voice_unlink(synth, voice);
+        voice->status = status;
+        xsynth_voice_link(synth, voice);
+    }
+}
+
+/*
+ * xsynth_voice_set_key
+ */
+static inline void
+xsynth_voice_set_key(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                     unsigned char key)
+{
+    if (voice->status != XSYNTH_VOICE_OFF) {
+        synth->key_voices[voice->key] &= ~(1ULL << voice->index);
+        synth->key_voices[key] |= 1ULL << voice->index;
+    }
+    voice->key = key;
+}
+
 /*
  * xsynth_voice_off
  * 
@@ -192,22 +356,41 @@ void xsynth_voice_render(xsynth_synth_t *synth, xsynth_voice_t *voice,
  * anymore by the render loop.
  */
 static inline void
-xsynth_voice_off(xsynth_voice_t* voice)
+xsynth_voice_off(xsynth_synth_t *synth, xsynth_voice_t* voice)
 {
+    int i;
+
+    if (voice->status != XSYNTH_VOICE_OFF) {
+        xsynth_voice_unlink(synth, voice);
+        synth->free_voices |= 1ULL << voice->index;
+        synth->key_voices[voice->key] &= ~(1ULL << voice->index);
+        synth->active_voices--;
+    }
     voice->status = XSYNTH_VOICE_OFF;
-    /* silence the oscillator buffer for the next use */
-    memset(voice->osc_audio, 0, MINBLEP_BUFFER_LENGTH * sizeof(float));
-    /* -FIX- decrement active voice count? */
+    voice->finished = 0;
+    /* silence the oscillator buffer for the next use.  The render code
+     * clears each span of osc_audio as it reads it, so only the pulse
+     * tails ahead of the read position can be left.  A voice which
+     * finished during rendering didn't save its last advance of
+     * osc_index, so allow for a nugget more. */
+    for (i = 0; i < XSYNTH_NUGGET_SIZE + LONGEST_DD_PULSE_LENGTH; i++)
+        voice->osc_audio[(voice->osc_index + i) & MINBLEP_BUFFER_MASK] = 0.0f;
 }
 
 /*
  * xsynth_voice_start_voice
  */
 static inline void
-xsynth_voice_start_voice(xsynth_voice_t *voice)
+xsynth_voice_start_voice(xsynth_synth_t *synth, xsynth_voice_t *voice)
 {
-    voice->status = XSYNTH_VOICE_ON;
-    /* -FIX- increment active voice count? */
+    if (voice->status == XSYNTH_VOICE_OFF) {
+        synth->free_voices &= ~(1ULL << voice->index);
+        synth->key_voices[voice->key] |= 1ULL << voice->index;
+        synth->active_voices++;
+        voice->status = XSYNTH_VOICE_ON;
+        xsynth_voice_link(synth, voice);
+    } else
+        xsynth_voice_set_status(synth, voice, XSYNTH_VOICE_ON);
 }
 
 #endif /* _XSYNTH_VOICE_H */
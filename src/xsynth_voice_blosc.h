@@ -33,24 +33,34 @@
  *     BLOSC_THIS(sine, ...)
  * gets replaced with:
  *     blosc_single1sine(...)
+ *
+ * BLOSC_MINBLEP is the minBLEP tier to place discontinuities with.  The
+ * shortened pulses of the lower tiers do badly on hard sync (on one of
+ * the friendly patches, the difference 'draft' makes is only 7 dB below
+ * the signal, against 30 dB or more on unsynced sounds), so the master
+ * and slave always use the full tables.
  */
 
 #ifdef BLOSC_SINGLE1
 /* #define BLOSC_THIS(x, ...) blosc_single1##x(__VA_ARGS__) */
 #define BLOSC_THIS(x, args...) blosc_single1##x(args)
 #define BLOSC_W_TABLE 0
+#define BLOSC_MINBLEP voice->minblep
 #endif
 #ifdef BLOSC_MASTER
 #define BLOSC_THIS(x, args...) blosc_master##x(args)
 #define BLOSC_W_TABLE 0
+#define BLOSC_MINBLEP (&xsynth_minblep[XSYNTH_MINBLEP_FULL])
 #endif
 #ifdef BLOSC_SINGLE2
 #define BLOSC_THIS(x, args...) blosc_single2##x(args)
 #define BLOSC_W_TABLE 1
+#define BLOSC_MINBLEP voice->minblep
 #endif
 #ifdef BLOSC_SLAVE
 #define BLOSC_THIS(x, args...) blosc_slave##x(args)
 #define BLOSC_W_TABLE 1
+#define BLOSC_MINBLEP (&xsynth_minblep[XSYNTH_MINBLEP_FULL])
 #endif
 
 /* ==== blosc_*sine functions ==== */
@@ -58,10 +68,10 @@
 static /* inline */ void
 #if BLOSC_W_TABLE
 BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *wp)
+           struct blosc *osc, float *sync, int index, float gain, float *wp)
 #else
 BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     unsigned long sample;
@@ -76,7 +86,7 @@ BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
         pos = 0.0f;
         /* if we valued alias-free startup over low startup time, we could do:
          *   pos -= w;
-         *   blosc_place_slope_dd(voice->osc_audio, index, 0.0f, w, gain * 0.5f * M_2PI_F); */
+         *   blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, 0.0f, w, gain * 0.5f * M_2PI_F); */
         osc->last_waveform = osc->waveform;
     }
 
@@ -88,9 +98,9 @@ BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
         pos += w;
 
 #ifdef BLOSC_SLAVE
-        if (voice->osc_sync[sample] >= 0.0f) { /* sync to master */
+        if (sync[sample] >= 0.0f) { /* sync to master */
 
-            float eof_offset = voice->osc_sync[sample] * w;
+            float eof_offset = sync[sample] * w;
             float pos_at_reset = pos - eof_offset;
             float out, slope;
             pos = eof_offset;
@@ -107,23 +117,23 @@ BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
             i = (i + WAVE_POINTS / 4) & (WAVE_POINTS - 1);
             slope = sine_wave[i + 4] + (sine_wave[i + 5] - sine_wave[i + 4]) * frac;
             /* now place reset DDs */
-            blosc_place_slope_dd(voice->osc_audio, index, pos, w, gain * M_2PI_F * (0.5f - slope));
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, gain * (/* 0.0f */ - out));
+            blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos, w, gain * M_2PI_F * (0.5f - slope));
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain * (/* 0.0f */ - out));
         } else
 #endif /* slave */
         if (pos >= 1.0f) {
             pos -= 1.0f;
 #ifdef BLOSC_MASTER
-            voice->osc_sync[sample] = pos / w;
+            sync[sample] = pos / w;
         } else {
-            voice->osc_sync[sample] = -1.0f;
+            sync[sample] = -1.0f;
 #endif /* master */
         }
 
         frac = pos * WAVE_POINTS;
         i = lrintf(frac - 0.5f);
         frac -= (float)i;
-        voice->osc_audio[index + DD_SAMPLE_DELAY] += gain *
+        voice->osc_audio[(index + DD_SAMPLE_DELAY) & MINBLEP_BUFFER_MASK] += gain *
             (sine_wave[i + 4] + (sine_wave[i + 5] - sine_wave[i + 4]) * frac);
 
         index++;
@@ -137,10 +147,10 @@ BLOSC_THIS(sine, unsigned long sample_count, xsynth_voice_t *voice,
 static /* inline */ void
 #if BLOSC_W_TABLE
 BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *wp)
+           struct blosc *osc, float *sync, int index, float gain, float *wp)
 #else
 BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     unsigned long sample;
@@ -176,7 +186,7 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
         }
         /* if we valued alias-free startup over low startup time, we could do:
          *   pos -= w;
-         *   blosc_place_slope_dd(voice->osc_audio, index, 0.0f, w, gain * 1.0f / *pw); */
+         *   blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, 0.0f, w, gain * 1.0f / *pw); */
         bp_high = 1;
 
         osc->last_waveform = osc->waveform;
@@ -190,9 +200,9 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
         pos += w;
 
 #ifdef BLOSC_SLAVE
-        if (voice->osc_sync[sample] >= 0.0f) { /* sync to master */
+        if (sync[sample] >= 0.0f) { /* sync to master */
 
-            float eof_offset = voice->osc_sync[sample] * w;
+            float eof_offset = sync[sample] * w;
             float pos_at_reset = pos - eof_offset;
             pos = eof_offset;
 
@@ -201,13 +211,13 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
                 out = -0.5f + pos_at_reset / pw;
                 if (pos_at_reset >= pw) {
                     out = 0.5f - (pos_at_reset - pw) / (1.0f - pw);
-                    blosc_place_slope_dd(voice->osc_audio, index, pos_at_reset - pw + eof_offset, w, -slope_delta);
+                    blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos_at_reset - pw + eof_offset, w, -slope_delta);
                     bp_high = 0;
                 }
                 if (pos_at_reset >= 1.0f) {
                     pos_at_reset -= 1.0f;
                     out = -0.5f + pos_at_reset / pw;
-                    blosc_place_slope_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, slope_delta);
+                    blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, slope_delta);
                     bp_high = 1;
                 }
             } else {
@@ -215,25 +225,25 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
                 if (pos_at_reset >= 1.0f) {
                     pos_at_reset -= 1.0f;
                     out = -0.5f + pos_at_reset / pw;
-                    blosc_place_slope_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, slope_delta);
+                    blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, slope_delta);
                     bp_high = 1;
                 }
                 if (bp_high && pos_at_reset >= pw) {
                     out = 0.5f - (pos_at_reset - pw) / (1.0f - pw);
-                    blosc_place_slope_dd(voice->osc_audio, index, pos_at_reset - pw + eof_offset, w, -slope_delta);
+                    blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos_at_reset - pw + eof_offset, w, -slope_delta);
                     bp_high = 0;
                 }
             }
 
             /* now place reset DDs */
             if (!bp_high)
-                blosc_place_slope_dd(voice->osc_audio, index, pos, w, slope_delta);
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, gain * (-0.5f - out));
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos, w, slope_delta);
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain * (-0.5f - out));
             out = -0.5f + pos / pw;
             bp_high = 1;
             if (pos >= pw) {
                 out = 0.5f - (pos - pw) / (1.0f - pw);
-                blosc_place_slope_dd(voice->osc_audio, index, pos - pw, w, -slope_delta);
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -slope_delta);
                 bp_high = 0;
             }
         } else
@@ -242,20 +252,20 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
             out = -0.5f + pos / pw;
             if (pos >= pw) {
                 out = 0.5f - (pos - pw) / (1.0f - pw);
-                blosc_place_slope_dd(voice->osc_audio, index, pos - pw, w, -slope_delta);
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -slope_delta);
                 bp_high = 0;
             }
             if (pos >= 1.0f) {
                 pos -= 1.0f;
 #ifdef BLOSC_MASTER
-                voice->osc_sync[sample] = pos / w;
+                sync[sample] = pos / w;
 #endif /* master */
                 out = -0.5f + pos / pw;
-                blosc_place_slope_dd(voice->osc_audio, index, pos, w, slope_delta);
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos, w, slope_delta);
                 bp_high = 1;
 #ifdef BLOSC_MASTER
             } else {
-                voice->osc_sync[sample] = -1.0f;
+                sync[sample] = -1.0f;
 #endif /* master */
             }
         } else {
@@ -263,23 +273,23 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
             if (pos >= 1.0f) {
                 pos -= 1.0f;
 #ifdef BLOSC_MASTER
-                voice->osc_sync[sample] = pos / w;
+                sync[sample] = pos / w;
 #endif /* master */
                 out = -0.5f + pos / pw;
-                blosc_place_slope_dd(voice->osc_audio, index, pos, w, slope_delta);
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos, w, slope_delta);
                 bp_high = 1;
 #ifdef BLOSC_MASTER
             } else {
-                voice->osc_sync[sample] = -1.0f;
+                sync[sample] = -1.0f;
 #endif /* master */
             }
             if (bp_high && pos >= pw) {
                 out = 0.5f - (pos - pw) / (1.0f - pw);
-                blosc_place_slope_dd(voice->osc_audio, index, pos - pw, w, -slope_delta);
+                blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -slope_delta);
                 bp_high = 0;
             }
         }
-        voice->osc_audio[index + DD_SAMPLE_DELAY] += gain * out;
+        voice->osc_audio[(index + DD_SAMPLE_DELAY) & MINBLEP_BUFFER_MASK] += gain * out;
 
         index++;
     }
@@ -293,10 +303,10 @@ BLOSC_THIS(tri, unsigned long sample_count, xsynth_voice_t *voice,
 static /* inline */ void
 #if BLOSC_W_TABLE
 BLOSC_THIS(sawup, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *wp)
+           struct blosc *osc, float *sync, int index, float gain, float *wp)
 #else
 BLOSC_THIS(sawup, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     unsigned long sample;
@@ -309,7 +319,7 @@ BLOSC_THIS(sawup, unsigned long sample_count, xsynth_voice_t *voice,
 
         /* this would be the cleanest startup:
          *   pos = 0.5f - w;
-         *   blosc_place_slope_dd(voice->osc_audio, index, 0.0f, w, 1.0f);
+         *   blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, 0.0f, w, 1.0f);
          * but we have to match the phase of the original Xsynth code: */
         pos = 0.0f;
 
@@ -324,34 +334,34 @@ BLOSC_THIS(sawup, unsigned long sample_count, xsynth_voice_t *voice,
         pos += w;
 
 #ifdef BLOSC_SLAVE
-        if (voice->osc_sync[sample] >= 0.0f) { /* sync to master */
+        if (sync[sample] >= 0.0f) { /* sync to master */
 
-            float eof_offset = voice->osc_sync[sample] * w;
+            float eof_offset = sync[sample] * w;
             float pos_at_reset = pos - eof_offset;
             pos = eof_offset;
 
             /* place any DD that may have occurred in subsample before reset */
             if (pos_at_reset >= 1.0f) {
                 pos_at_reset -= 1.0f;
-                blosc_place_step_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, -gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, -gain);
             }
 
             /* now place reset DD */
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, -gain * pos_at_reset);
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, -gain * pos_at_reset);
         } else
 #endif /* slave */
         if (pos >= 1.0f) {
             pos -= 1.0f;
 #ifdef BLOSC_MASTER
-            voice->osc_sync[sample] = pos / w;
+            sync[sample] = pos / w;
 #endif /* master */
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, -gain);
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, -gain);
 #ifdef BLOSC_MASTER
         } else {
-            voice->osc_sync[sample] = -1.0f;
+            sync[sample] = -1.0f;
 #endif /* master */
         }
-        voice->osc_audio[index + DD_SAMPLE_DELAY] += gain * (-0.5f + pos);
+        voice->osc_audio[(index + DD_SAMPLE_DELAY) & MINBLEP_BUFFER_MASK] += gain * (-0.5f + pos);
 
         index++;
     }
@@ -364,10 +374,10 @@ BLOSC_THIS(sawup, unsigned long sample_count, xsynth_voice_t *voice,
 static /* inline */ void
 #if BLOSC_W_TABLE
 BLOSC_THIS(sawdown, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *wp)
+           struct blosc *osc, float *sync, int index, float gain, float *wp)
 #else
 BLOSC_THIS(sawdown, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     unsigned long sample;
@@ -380,7 +390,7 @@ BLOSC_THIS(sawdown, unsigned long sample_count, xsynth_voice_t *voice,
 
         /* this would be the cleanest startup:
          *   pos = 0.5f - w;
-         *   blosc_place_slope_dd(voice->osc_audio, index, 0.0f, w, -1.0f);
+         *   blosc_place_slope_dd(voice, BLOSC_MINBLEP, index, 0.0f, w, -1.0f);
          * but we have to match the phase of the original Xsynth code: */
         pos = 0.0f;
 
@@ -395,34 +405,34 @@ BLOSC_THIS(sawdown, unsigned long sample_count, xsynth_voice_t *voice,
         pos += w;
 
 #ifdef BLOSC_SLAVE
-        if (voice->osc_sync[sample] >= 0.0f) { /* sync to master */
+        if (sync[sample] >= 0.0f) { /* sync to master */
 
-            float eof_offset = voice->osc_sync[sample] * w;
+            float eof_offset = sync[sample] * w;
             float pos_at_reset = pos - eof_offset;
             pos = eof_offset;
 
             /* place any DD that may have occurred in subsample before reset */
             if (pos_at_reset >= 1.0f) {
                 pos_at_reset -= 1.0f;
-                blosc_place_step_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, gain);
             }
 
             /* now place reset DD */
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, gain * pos_at_reset);
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain * pos_at_reset);
         } else
 #endif /* slave */
         if (pos >= 1.0f) {
             pos -= 1.0f;
 #ifdef BLOSC_MASTER
-            voice->osc_sync[sample] = pos / w;
+            sync[sample] = pos / w;
 #endif /* master */
-            blosc_place_step_dd(voice->osc_audio, index, pos, w, gain);
+            blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain);
 #ifdef BLOSC_MASTER
         } else {
-            voice->osc_sync[sample] = -1.0f;
+            sync[sample] = -1.0f;
 #endif /* master */
         }
-        voice->osc_audio[index + DD_SAMPLE_DELAY] += gain * (0.5f - pos);
+        voice->osc_audio[(index + DD_SAMPLE_DELAY) & MINBLEP_BUFFER_MASK] += gain * (0.5f - pos);
 
         index++;
     }
@@ -435,10 +445,10 @@ BLOSC_THIS(sawdown, unsigned long sample_count, xsynth_voice_t *voice,
 static /* inline */ void
 #if BLOSC_W_TABLE
 BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *wp)
+           struct blosc *osc, float *sync, int index, float gain, float *wp)
 #else
 BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     unsigned long sample;
@@ -476,7 +486,7 @@ BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
         bp_high = 1;
         /* if we valued alias-free startup over low startup time, we could do:
          *   pos -= w;
-         *   blosc_place_step_dd(voice->osc_audio, index, 0.0f, w, halfgain); */
+         *   blosc_place_step_dd(voice, BLOSC_MINBLEP, index, 0.0f, w, halfgain); */
 
         osc->last_waveform = osc->waveform;
     }
@@ -489,34 +499,34 @@ BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
         pos += w;
 
 #ifdef BLOSC_SLAVE
-        if (voice->osc_sync[sample] >= 0.0f) { /* sync to master */
+        if (sync[sample] >= 0.0f) { /* sync to master */
 
-            float eof_offset = voice->osc_sync[sample] * w;
+            float eof_offset = sync[sample] * w;
             float pos_at_reset = pos - eof_offset;
             pos = eof_offset;
 
             /* place any DDs that may have occurred in subsample before reset */
             if (bp_high) {
                 if (pos_at_reset >= pw) {
-                    blosc_place_step_dd(voice->osc_audio, index, pos_at_reset - pw + eof_offset, w, -gain);
+                    blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset - pw + eof_offset, w, -gain);
                     bp_high = 0;
                     out = -halfgain;
                 }
                 if (pos_at_reset >= 1.0f) {
                     pos_at_reset -= 1.0f;
-                    blosc_place_step_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, gain);
+                    blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, gain);
                     bp_high = 1;
                     out = halfgain;
                 }
             } else {
                 if (pos_at_reset >= 1.0f) {
                     pos_at_reset -= 1.0f;
-                    blosc_place_step_dd(voice->osc_audio, index, pos_at_reset + eof_offset, w, gain);
+                    blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset + eof_offset, w, gain);
                     bp_high = 1;
                     out = halfgain;
                 }
                 if (bp_high && pos_at_reset >= pw) {
-                    blosc_place_step_dd(voice->osc_audio, index, pos_at_reset - pw + eof_offset, w, -gain);
+                    blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos_at_reset - pw + eof_offset, w, -gain);
                     bp_high = 0;
                     out = -halfgain;
                 }
@@ -524,12 +534,12 @@ BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
 
             /* now place reset DD */
             if (!bp_high) {
-                blosc_place_step_dd(voice->osc_audio, index, pos, w, gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain);
                 bp_high = 1;
                 out = halfgain;
             }
             if (pos >= pw) {
-                blosc_place_step_dd(voice->osc_audio, index, pos - pw, w, -gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -gain);
                 bp_high = 0;
                 out = -halfgain;
             }
@@ -537,44 +547,44 @@ BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
 #endif /* slave */
         if (bp_high) {
             if (pos >= pw) {
-                blosc_place_step_dd(voice->osc_audio, index, pos - pw, w, -gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -gain);
                 bp_high = 0;
                 out = -halfgain;
             }
             if (pos >= 1.0f) {
                 pos -= 1.0f;
 #ifdef BLOSC_MASTER
-                voice->osc_sync[sample] = pos / w;
+                sync[sample] = pos / w;
 #endif /* master */
-                blosc_place_step_dd(voice->osc_audio, index, pos, w, gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain);
                 bp_high = 1;
                 out = halfgain;
 #ifdef BLOSC_MASTER
             } else {
-                voice->osc_sync[sample] = -1.0f;
+                sync[sample] = -1.0f;
 #endif /* master */
             }
         } else {
             if (pos >= 1.0f) {
                 pos -= 1.0f;
 #ifdef BLOSC_MASTER
-                voice->osc_sync[sample] = pos / w;
+                sync[sample] = pos / w;
 #endif /* master */
-                blosc_place_step_dd(voice->osc_audio, index, pos, w, gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos, w, gain);
                 bp_high = 1;
                 out = halfgain;
 #ifdef BLOSC_MASTER
             } else {
-                voice->osc_sync[sample] = -1.0f;
+                sync[sample] = -1.0f;
 #endif /* master */
             }
             if (bp_high && pos >= pw) {
-                blosc_place_step_dd(voice->osc_audio, index, pos - pw, w, -gain);
+                blosc_place_step_dd(voice, BLOSC_MINBLEP, index, pos - pw, w, -gain);
                 bp_high = 0;
                 out = -halfgain;
             }
         }
-        voice->osc_audio[index + DD_SAMPLE_DELAY] += out;
+        voice->osc_audio[(index + DD_SAMPLE_DELAY) & MINBLEP_BUFFER_MASK] += out;
 
         index++;
     }
@@ -588,34 +598,35 @@ BLOSC_THIS(rect, unsigned long sample_count, xsynth_voice_t *voice,
 static inline void
 #if BLOSC_W_TABLE
 BLOSC_THIS(, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float *w)
+           struct blosc *osc, float *sync, int index, float gain, float *w)
 #else
 BLOSC_THIS(, unsigned long sample_count, xsynth_voice_t *voice,
-           struct blosc *osc, int index, float gain, float w)
+           struct blosc *osc, float *sync, int index, float gain, float w)
 #endif
 {
     switch (osc->waveform) {
       default:
       case 0:                                                    /* sine wave */
-        BLOSC_THIS(sine, sample_count, voice, osc, index, gain, w);
+        BLOSC_THIS(sine, sample_count, voice, osc, sync, index, gain, w);
         break;
       case 1:                                                /* triangle wave */
       case 6:                                 /* variable-slope triangle wave */
-        BLOSC_THIS(tri, sample_count, voice, osc, index, gain, w);
+        BLOSC_THIS(tri, sample_count, voice, osc, sync, index, gain, w);
         break;
       case 2:                                             /* up sawtooth wave */
-        BLOSC_THIS(sawup, sample_count, voice, osc, index, gain, w);
+        BLOSC_THIS(sawup, sample_count, voice, osc, sync, index, gain, w);
         break;
       case 3:                                           /* down sawtooth wave */
-        BLOSC_THIS(sawdown, sample_count, voice, osc, index, gain, w);
+        BLOSC_THIS(sawdown, sample_count, voice, osc, sync, index, gain, w);
         break;
       case 4:                                                  /* square wave */
       case 5:                                                   /* pulse wave */
-        BLOSC_THIS(rect, sample_count, voice, osc, index, gain, w);
+        BLOSC_THIS(rect, sample_count, voice, osc, sync, index, gain, w);
         break;
     }
 }
 
 #undef BLOSC_THIS
 #undef BLOSC_W_TABLE
+#undef BLOSC_MINBLEP
 
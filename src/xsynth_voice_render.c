@@ -63,7 +63,12 @@ static int   tables_initialized = 0;
 
 float        xsynth_pitch[128];
 
-#define WAVE_POINTS 1024          /* must be a power of two */
+#define WAVE_POINTS_BITS 10       /* WAVE_POINTS must be a power of two */
+#define WAVE_POINTS (1 << WAVE_POINTS_BITS)
+
+/* the bits of a 32-bit LFO phase below its wave table index */
+#define LFO_FRAC_BITS (32 - WAVE_POINTS_BITS)
+#define LFO_FRAC_MASK ((1 << LFO_FRAC_BITS) - 1)
 
 static float sine_wave[4 + WAVE_POINTS + 1],
              triangle_wave[4 + WAVE_POINTS + 1];
@@ -78,6 +83,56 @@ static float velocity_to_attenuation[128];
 
 static float qdB_to_amplitude_table[4 + 256 + 0];
 
+/* shortened minBLEP tables for the lower quality tiers, made from the
+ * full tables by xsynth_init_tables() */
+static xsynth_minblep_phase_t step_dd_draft[MINBLEP_PHASES],
+                              slope_dd_draft[MINBLEP_PHASES],
+                              step_dd_medium[MINBLEP_PHASES],
+                              slope_dd_medium[MINBLEP_PHASES];
+
+const xsynth_minblep_t xsynth_minblep[XSYNTH_MINBLEP_TIERS] = {
+    { 16, step_dd_draft, slope_dd_draft },
+    { 32, step_dd_medium, slope_dd_medium },
+    { MINBLEP_PULSE_STRIDE, xsynth_step_dd_table, xsynth_slope_dd_table }
+};
+
+/*
+ * shorten_minblep
+ *
+ * make a 'length'-tap version of a full minBLEP table, by fading its
+ * residual out to zero with a raised cosine over the second half of the
+ * shortened pulse
+ */
+static void
+shorten_minblep(xsynth_minblep_phase_t *table, const xsynth_minblep_phase_t *full,
+                int length)
+{
+    int p, t, n;
+    float x, fade[MINBLEP_PHASES * MINBLEP_PULSE_STRIDE + 1];
+
+    /* the faded pulse, by oversample position: phase p of tap t is
+     * oversample p + t * MINBLEP_PHASES */
+    for (n = 0; n <= MINBLEP_PHASES * MINBLEP_PULSE_STRIDE; n++) {
+        p = n & MINBLEP_PHASE_MASK;
+        t = n / MINBLEP_PHASES;
+        x = (float)n / (float)(MINBLEP_PHASES * length);
+        if (t >= length)
+            fade[n] = 0.0f;
+        else if (x <= 0.5f)
+            fade[n] = full[p].value[t];
+        else
+            fade[n] = full[p].value[t] * 0.5f * (1.0f + cosf(M_PI_F * (2.0f * x - 1.0f)));
+    }
+
+    for (p = 0; p < MINBLEP_PHASES; p++) {
+        for (t = 0; t < MINBLEP_PULSE_STRIDE; t++) {
+            n = p + t * MINBLEP_PHASES;
+            table[p].value[t] = fade[n];
+            table[p].delta[t] = fade[n + 1] - fade[n];
+        }
+    }
+}
+
 void
 xsynth_init_tables(void)
 {
@@ -155,6 +210,12 @@ xsynth_init_tables(void)
         qdB_to_amplitude_table[i + 4] = powf(10.0f, (float)i / -80.0f);
     }
 
+    /* minBLEP quality tiers */
+    shorten_minblep(step_dd_draft, xsynth_step_dd_table, xsynth_minblep[XSYNTH_MINBLEP_DRAFT].length);
+    shorten_minblep(slope_dd_draft, xsynth_slope_dd_table, xsynth_minblep[XSYNTH_MINBLEP_DRAFT].length);
+    shorten_minblep(step_dd_medium, xsynth_step_dd_table, xsynth_minblep[XSYNTH_MINBLEP_MEDIUM].length);
+    shorten_minblep(slope_dd_medium, xsynth_slope_dd_table, xsynth_minblep[XSYNTH_MINBLEP_MEDIUM].length);
+
     tables_initialized = 1;
 }
 
@@ -183,52 +244,146 @@ qdB_to_amplitude(float qdB)
             qdB_to_amplitude_table[i + 4]);
 }
 
-static inline float
-oscillator(float *pos, float omega, float deltat, unsigned char waveform)
+/*
+ * lfo_increment
+ *
+ * the per-sample LFO phase increment, as a 32-bit fixed-point fraction of
+ * a cycle
+ */
+static inline unsigned int
+lfo_increment(float omega, float deltat)
 {
-    float wpos, f;
-    int i;
-
-    *pos += deltat * omega;
+    return (unsigned int)(deltat * omega * 4294967296.0f);
+}
 
-    if (*pos >= 1.0f) {
-        *pos -= 1.0f;
-    }
+/*
+ * lfo_render
+ *
+ * render 'sample_count' samples of the LFO, advancing its phase by 'inc'
+ * before each.  The phase is a 32-bit fixed-point fraction of a cycle, so
+ * each sample's phase follows from the starting phase without a carried
+ * floating-point sum, its table index is a shift rather than a
+ * float-to-int conversion, and wrapping is free.  The waveform choice is
+ * made once per call, leaving loops the compiler can vectorize.
+ *
+ * The old floating-point phase rounded at every step, so it ran up to
+ * 0.1% off the set rate, and wandered about a thousandth of a cycle from
+ * where it should be.  That matters more than it sounds: the oscillator
+ * phases integrate LFO pitch modulation, and a saw LFO's wrap moving by a
+ * sample is a full-scale step, so patches with deep LFO pitch modulation
+ * now render their oscillators at different phases than they used to,
+ * though with the same spectrum.
+ */
+static void
+lfo_render(unsigned int *phase, unsigned int inc, unsigned char waveform,
+           float *out, unsigned long sample_count)
+{
+    unsigned int p0 = *phase,
+                 p;
+    unsigned long sample;
+    float f;
+    int i;
 
     switch (waveform) {
       default:
       case 0:                                                    /* sine wave */
-        wpos = *pos * WAVE_POINTS;
-        i = lrintf(wpos - 0.5f);
-        f = wpos - (float)i;
-        return (sine_wave[i + 4] + (sine_wave[i + 5] - sine_wave[i + 4]) * f) * 2.0f;
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            i = p >> LFO_FRAC_BITS;
+            f = (float)(int)(p & LFO_FRAC_MASK) * (1.0f / (float)(LFO_FRAC_MASK + 1));
+            out[sample] = (sine_wave[i + 4] + (sine_wave[i + 5] - sine_wave[i + 4]) * f) * 2.0f;
+        }
+        break;
 
       case 1:                                                /* triangle wave */
-        wpos = *pos * WAVE_POINTS;
-        i = lrintf(wpos - 0.5f);
-        f = wpos - (float)i;
-        return (triangle_wave[i + 4] + (triangle_wave[i + 5] - triangle_wave[i + 4]) * f);
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            i = p >> LFO_FRAC_BITS;
+            f = (float)(int)(p & LFO_FRAC_MASK) * (1.0f / (float)(LFO_FRAC_MASK + 1));
+            out[sample] = triangle_wave[i + 4] + (triangle_wave[i + 5] - triangle_wave[i + 4]) * f;
+        }
+        break;
 
       case 2:                                             /* up sawtooth wave */
-        return (*pos * 2.0f - 1.0f);
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            out[sample] = (float)(int)(p >> 1) * (1.0f / 1073741824.0f) - 1.0f;
+        }
+        break;
 
       case 3:                                           /* down sawtooth wave */
-        return (1.0f - *pos * 2.0f);
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            out[sample] = 1.0f - (float)(int)(p >> 1) * (1.0f / 1073741824.0f);
+        }
+        break;
 
       case 4:                                                  /* square wave */
-        return ((*pos < 0.5f) ? 1.0f : -1.0f);
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            out[sample] = (p < 0x80000000u) ? 1.0f : -1.0f;
+        }
+        break;
 
       case 5:                                                   /* pulse wave */
-        return ((*pos < 0.25f) ? 1.0f : -1.0f);
+        for (sample = 0; sample < sample_count; sample++) {
+            p = p0 + (unsigned int)(sample + 1) * inc;
+            out[sample] = (p < 0x40000000u) ? 1.0f : -1.0f;
+        }
+        break;
     }
+
+    *phase = p0 + (unsigned int)sample_count * inc;
 }
 
+/* The minBLEP tables are laid out phase-major, so placing a pulse reads
+ * one phase's taps and deltas contiguously, and adds them into the voice
+ * buffer XSYNTH_DD_LANES at a time.  Compilers targeting FMA will fuse
+ * the multiply-adds. */
+#if defined(__AVX__)
+#define XSYNTH_DD_LANES  8
+#else
+#define XSYNTH_DD_LANES  4
+#endif
+
+/* unaligned vector, for buffer spans starting at any sample */
+typedef float v_dd __attribute__((vector_size(XSYNTH_DD_LANES * sizeof(float)),
+                                  aligned(sizeof(float))));
+
+/*
+ * blosc_add_dd
+ *
+ * add 'count' taps of one minBLEP phase, interpolated a fraction 'r'
+ * toward the next phase and scaled by 'scale', into a contiguous span of
+ * the voice buffer
+ */
 static inline void
-blosc_place_step_dd(float *buffer, int index, float phase, float w, float scale)
+blosc_add_dd(float *buffer, const float *value, const float *delta, int count,
+             float r, float scale)
 {
-    float r;
     int i;
 
+    for (i = 0; i + XSYNTH_DD_LANES <= count; i += XSYNTH_DD_LANES)
+        *(v_dd *)(buffer + i) += scale * (*(const v_dd *)(value + i) +
+                                          r * *(const v_dd *)(delta + i));
+    for (; i < count; i++)
+        buffer[i] += scale * (value[i] + r * delta[i]);
+}
+
+/*
+ * blosc_place_dd
+ *
+ * add the first 'length' taps of a minBLEP pulse from 'table' into the
+ * circular voice buffer, splitting it where it wraps
+ */
+static void
+blosc_place_dd(float *buffer, int index, const xsynth_minblep_phase_t *table,
+               int length, float phase, float w, float scale)
+{
+    const xsynth_minblep_phase_t *p;
+    float r;
+    int i, count;
+
     r = MINBLEP_PHASES * phase / w;
     i = lrintf(r - 0.5f);
     r -= (float)i;
@@ -239,33 +394,33 @@ blosc_place_step_dd(float *buffer, int index, float phase, float w, float scale)
      *    index++;
      *  }
      */
-
-    while (i < MINBLEP_PHASES * STEP_DD_PULSE_LENGTH) {
-        buffer[index] += scale * (xsynth_step_dd_table[i].value + r * xsynth_step_dd_table[i].delta);
-        i += MINBLEP_PHASES;
-        index++;
+    p = &table[i];
+
+    index &= MINBLEP_BUFFER_MASK;
+    count = MINBLEP_BUFFER_LENGTH - index;
+    if (count >= length) {
+        blosc_add_dd(buffer + index, p->value, p->delta, length, r, scale);
+    } else {
+        blosc_add_dd(buffer + index, p->value, p->delta, count, r, scale);
+        blosc_add_dd(buffer, p->value + count, p->delta + count,
+                     length - count, r, scale);
     }
 }
 
 static inline void
-blosc_place_slope_dd(float *buffer, int index, float phase, float w, float slope_delta)
+blosc_place_step_dd(xsynth_voice_t *voice, const xsynth_minblep_t *minblep, int index,
+                    float phase, float w, float scale)
 {
-    float r;
-    int i;
-
-    r = MINBLEP_PHASES * phase / w;
-    i = lrintf(r - 0.5f);
-    r -= (float)i;
-    i &= MINBLEP_PHASE_MASK;  /* port changes can cause i to be out-of-range */
-
-    slope_delta *= w;
+    blosc_place_dd(voice->osc_audio, index, minblep->step, minblep->length,
+                   phase, w, scale);
+}
 
-    while (i < MINBLEP_PHASES * SLOPE_DD_PULSE_LENGTH) {
-        buffer[index] += slope_delta * (xsynth_slope_dd_table[i] + r * (xsynth_slope_dd_table[i + 1] -
-                                                                        xsynth_slope_dd_table[i]));
-        i += MINBLEP_PHASES;
-        index++;
-    }
+static inline void
+blosc_place_slope_dd(xsynth_voice_t *voice, const xsynth_minblep_t *minblep, int index,
+                     float phase, float w, float slope_delta)
+{
+    blosc_place_dd(voice->osc_audio, index, minblep->slope, minblep->length,
+                   phase, w, slope_delta * w);
 }
 
 /* declare the oscillator functions */
@@ -282,39 +437,277 @@ blosc_place_slope_dd(float *buffer, int index, float phase, float w, float slope
 #include "xsynth_voice_blosc.h"
 #undef BLOSC_SLAVE
 
+/* filter state, held in locals through a render loop */
+struct vcf_state {
+    float delay1, delay2, delay3, delay4, c5;
+};
+
+/* filter kinds: the three of the vcf_mode port, then the topology-
+ * preserving transform (TPT) versions of the first two, selected with
+ * the 'filter' configure key */
+#define VCF_2POLE      0
+#define VCF_4POLE      1
+#define VCF_MVCLPF     2
+#define VCF_2POLE_TPT  3
+#define VCF_4POLE_TPT  4
+#define VCF_KINDS      5
+
+#define VCF_TPT_CUTOFF_MAX  (1.5f)  /* a little below pi/2, where tan() diverges */
+
+static inline int
+vcf_kind(int vcf_mode, int topology)
+{
+    if (vcf_mode < 0 || vcf_mode > 2)
+        vcf_mode = VCF_2POLE;
+    if (topology == XSYNTH_VCF_TPT && vcf_mode != VCF_MVCLPF)
+        vcf_mode += VCF_2POLE_TPT;
+    return vcf_mode;
+}
+
+/* vcf_coefficient
+ *
+ * turn a cutoff (pi times frequency over sample rate) from the modulation
+ * pass into the coefficient a filter kind steps with, clamped to where
+ * that filter is stable
+ */
+static inline __attribute__((always_inline)) float
+vcf_coefficient(float cutoff, const int kind)
+{
+    float w;
+
+    switch (kind) {
+      default:
+      case VCF_2POLE:
+      case VCF_4POLE:
+        /* Chamberlin's 2 * sin(cutoff), approximated */
+        w = cutoff * 2.0f;
+        if (w > VCF_FREQ_MAX) w = VCF_FREQ_MAX;
+        return w;
+
+      case VCF_MVCLPF:
+        w = cutoff;
+        if (w < 0.75f) w *= 1.005f - w * (0.624f - w * (0.65f - w * 0.54f));
+        else
+        {
+            w *= 0.6748f;
+            if (w > 0.82f) w = 0.82f;
+        }
+        return w;
+
+      case VCF_2POLE_TPT:
+      case VCF_4POLE_TPT:
+        /* tan(cutoff), by its [3/2] Pade approximant */
+        w = cutoff;
+        if (w > VCF_TPT_CUTOFF_MAX) w = VCF_TPT_CUTOFF_MAX;
+        return w * (15.0f - w * w) / (15.0f - 6.0f * w * w);
+    }
+}
+
+/* vcf_coefficients
+ *
+ * convert a burst of cutoffs to coefficients in place, with the filter
+ * kind chosen once rather than per sample
+ */
+static void
+vcf_coefficients(float *cutoff, unsigned long sample_count, int kind)
+{
+    unsigned long s;
+
+    switch (kind) {
+      default:
+      case VCF_2POLE:
+      case VCF_4POLE:
+        for (s = 0; s < sample_count; s++)
+            cutoff[s] = vcf_coefficient(cutoff[s], VCF_2POLE);
+        break;
+      case VCF_MVCLPF:
+        for (s = 0; s < sample_count; s++)
+            cutoff[s] = vcf_coefficient(cutoff[s], VCF_MVCLPF);
+        break;
+      case VCF_2POLE_TPT:
+      case VCF_4POLE_TPT:
+        for (s = 0; s < sample_count; s++)
+            cutoff[s] = vcf_coefficient(cutoff[s], VCF_2POLE_TPT);
+        break;
+    }
+}
+
+/* vcf_2pole_step
+ *
+ * one sample of the original Xsynth 12db/oct filter, returning its output.
+ * 'freqcut' is from vcf_coefficient().
+ */
+static inline __attribute__((always_inline)) float
+vcf_2pole_step(struct vcf_state *f, float in, float freqcut, float qres)
+{
+    float highpass;
+
+    /* Hal Chamberlin's state variable filter */
+
+    f->delay2 = f->delay2 + freqcut * f->delay1;        /* delay2 = lowpass output */
+    highpass = in - f->delay2 - qres * f->delay1;
+    f->delay1 = freqcut * highpass + f->delay1;         /* delay1 = bandpass output */
+
+    return f->delay2;
+}
+
+/* vcf_4pole_step
+ *
+ * one sample of the original Xsynth 24db/oct filter, returning its output
+ */
+static inline __attribute__((always_inline)) float
+vcf_4pole_step(struct vcf_state *f, float in, float freqcut, float qres)
+{
+    float highpass;
+
+    /* Hal Chamberlin's state variable filter */
+
+    f->delay2 = f->delay2 + freqcut * f->delay1;        /* delay2/4 = lowpass output */
+    highpass = in - f->delay2 - qres * f->delay1;
+    f->delay1 = freqcut * highpass + f->delay1;         /* delay1/3 = bandpass output */
+
+    f->delay4 = f->delay4 + freqcut * f->delay3;
+    highpass = f->delay2 - f->delay4 - qres * f->delay3;
+    f->delay3 = freqcut * highpass + f->delay3;
+
+    return f->delay4;
+}
+
+/* vcf_tpt_stage
+ *
+ * one sample of a topology-preserving transform state variable filter
+ * (after Zavalishin), returning its lowpass output.  'g' is tan(cutoff)
+ * from vcf_coefficient() and 'h' is 1 / (1 + g * (g + damping)), which
+ * doesn't depend on the state, so the block versions compute it for a
+ * whole burst ahead of the recursion.  Unlike the Chamberlin filter it
+ * is stable for any cutoff below Nyquist.
+ */
+static inline __attribute__((always_inline)) float
+vcf_tpt_stage(float *s1, float *s2, float in, float g, float damping, float h)
+{
+    float highpass, bandpass, lowpass, v;
+
+    highpass = (in - (damping + g) * *s1 - *s2) * h;
+    v = g * highpass;
+    bandpass = v + *s1;
+    *s1 = bandpass + v;
+    v = g * bandpass;
+    lowpass = v + *s2;
+    *s2 = lowpass + v;
+
+    return lowpass;
+}
+
+/* vcf_2pole_tpt_step
+ *
+ * one sample of the TPT version of the 12db/oct filter
+ */
+static inline __attribute__((always_inline)) float
+vcf_2pole_tpt_step(struct vcf_state *f, float in, float g, float qres)
+{
+    float h = 1.0f / (1.0f + g * (g + qres));
+
+    return vcf_tpt_stage(&f->delay1, &f->delay2, in, g, qres, h);
+}
+
+/* vcf_4pole_tpt_step
+ *
+ * one sample of the TPT version of the 24db/oct filter
+ */
+static inline __attribute__((always_inline)) float
+vcf_4pole_tpt_step(struct vcf_state *f, float in, float g, float qres)
+{
+    float h = 1.0f / (1.0f + g * (g + qres));
+
+    in = vcf_tpt_stage(&f->delay1, &f->delay2, in, g, qres, h);
+    return vcf_tpt_stage(&f->delay3, &f->delay4, in, g, qres, h);
+}
+
+/* vcf_mvclpf_step
+ *
+ * one sample of Fons Adriaensen's MVCLPF-3, returning its output
+ */
+static inline __attribute__((always_inline)) float
+vcf_mvclpf_step(struct vcf_state *f, float in, float w, float res)
+{
+    float g0, g1, x, d,
+          delay1 = f->delay1,
+          delay2 = f->delay2,
+          delay3 = f->delay3,
+          delay4 = f->delay4,
+          c5     = f->c5;
+
+    g0 = 0.5f;  /* g0 = dB_to_amplitude(input_gain_in_db) / 2 */
+    g1 = 2.0f;  /* g1 = dB_to_amplitude(output_gain_in_db) * 2 */
+
+    /* res should be 0 to 1 already, and w warped by vcf_coefficient() */
+
+    x = in * g0 - (4.3f - 0.2f * w) * res * c5 + 1e-10f;
+    x /= sqrtf(1.0f + x * x);  /* x = tanh(x) */
+    d = w * (x  - delay1) / (1.0f + delay1 * delay1);            
+    x = delay1 + 0.77f * d;
+    delay1 = x + 0.23f * d;        
+    d = w * (x  - delay2) / (1.0f + delay2 * delay2);            
+    x = delay2 + 0.77f * d;
+    delay2 = x + 0.23f * d;        
+    d = w * (x  - delay3) / (1.0f + delay3 * delay3);            
+    x = delay3 + 0.77f * d;
+    delay3 = x + 0.23f * d;        
+    d = w * (x  - delay4);
+    x = delay4 + 0.77f * d;
+    delay4 = x + 0.23f * d;        
+    c5 += 0.85f * (delay4 - c5);
+
+    x = in * g0 - (4.3f - 0.2f * w) * res * c5;
+    x /= sqrtf(1.0f + x * x);  /* x = tanh(x) */
+    d = w * (x  - delay1) / (1.0f + delay1 * delay1);            
+    x = delay1 + 0.77f * d;
+    delay1 = x + 0.23f * d;        
+    d = w * (x  - delay2) / (1.0f + delay2 * delay2);            
+    x = delay2 + 0.77f * d;
+    delay2 = x + 0.23f * d;        
+    d = w * (x  - delay3) / (1.0f + delay3 * delay3);            
+    x = delay3 + 0.77f * d;
+    delay3 = x + 0.23f * d;        
+    d = w * (x  - delay4);
+    x = delay4 + 0.77f * d;
+    delay4 = x + 0.23f * d;        
+    c5 += 0.85f * (delay4 - c5);
+
+    f->delay1 = delay1;
+    f->delay2 = delay2;
+    f->delay3 = delay3;
+    f->delay4 = delay4;
+    f->c5     = c5;
+
+    return g1 * delay4;
+}
+
 /* vcf_2pole
  *
  * The original Xsynth 12db/oct filter
  */
 static inline void
 vcf_2pole(xsynth_voice_t *voice, unsigned long sample_count,
-          float *in, float *out, float *cutoff, float qres, float *amp)
+          float *in, float *out, float *freqcut, float qres, float *amp)
 {
     unsigned long sample;
-    float freqcut, highpass,
-          delay1 = voice->delay1,
-          delay2 = voice->delay2;
+    float v, energy = 0.0f;
+    struct vcf_state f = { voice->delay1, voice->delay2, 0.0f, 0.0f, 0.0f };
 
     qres = 2.0f - qres * 1.995f;
 
     for (sample = 0; sample < sample_count; sample++) {
 
-        /* Hal Chamberlin's state variable filter */
-
-        freqcut = cutoff[sample] * 2.0f;
-
-        if (freqcut > VCF_FREQ_MAX) freqcut = VCF_FREQ_MAX;
-
-        delay2 = delay2 + freqcut * delay1;             /* delay2 = lowpass output */
-        highpass = in[sample] - delay2 - qres * delay1;
-        delay1 = freqcut * highpass + delay1;           /* delay1 = bandpass output */
-
         /* mix filter output into output buffer */
-        out[sample] += delay2 * amp[sample];
+        v = vcf_2pole_step(&f, in[sample], freqcut[sample], qres) * amp[sample];
+        out[sample] += v;
+        energy += v * v;
     }
 
-    voice->delay1 = delay1;
-    voice->delay2 = delay2;
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
     voice->delay3 = 0.0f;
     voice->delay4 = 0.0f;
     voice->c5 = 0.0f;
@@ -326,41 +719,95 @@ vcf_2pole(xsynth_voice_t *voice, unsigned long sample_count,
  */
 static inline void
 vcf_4pole(xsynth_voice_t *voice, unsigned long sample_count,
-          float *in, float *out, float *cutoff, float qres, float *amp)
+          float *in, float *out, float *freqcut, float qres, float *amp)
+{
+    unsigned long sample;
+    float v, energy = 0.0f;
+    struct vcf_state f = { voice->delay1, voice->delay2, voice->delay3, voice->delay4, 0.0f };
+
+    qres = 2.0f - qres * 1.995f;
+
+    for (sample = 0; sample < sample_count; sample++) {
+
+        /* mix filter output into output buffer */
+        v = vcf_4pole_step(&f, in[sample], freqcut[sample], qres) * amp[sample];
+        out[sample] += v;
+        energy += v * v;
+    }
+
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = f.delay3;
+    voice->delay4 = f.delay4;
+    voice->c5 = 0.0f;
+}
+
+/* vcf_2pole_tpt
+ *
+ * the TPT version of the 12db/oct filter
+ */
+static void
+vcf_2pole_tpt(xsynth_voice_t *voice, unsigned long sample_count,
+              float *in, float *out, float *g, float qres, float *amp)
 {
     unsigned long sample;
-    float freqcut, highpass,
-          delay1 = voice->delay1,
-          delay2 = voice->delay2,
-          delay3 = voice->delay3,
-          delay4 = voice->delay4;
+    float v, energy = 0.0f, h[XSYNTH_NUGGET_SIZE];
+    struct vcf_state f = { voice->delay1, voice->delay2, 0.0f, 0.0f, 0.0f };
 
     qres = 2.0f - qres * 1.995f;
 
+    for (sample = 0; sample < sample_count; sample++)
+        h[sample] = 1.0f / (1.0f + g[sample] * (g[sample] + qres));
+
     for (sample = 0; sample < sample_count; sample++) {
 
-        /* Hal Chamberlin's state variable filter */
+        /* mix filter output into output buffer */
+        v = vcf_tpt_stage(&f.delay1, &f.delay2, in[sample], g[sample], qres,
+                          h[sample]) * amp[sample];
+        out[sample] += v;
+        energy += v * v;
+    }
+
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = 0.0f;
+    voice->delay4 = 0.0f;
+    voice->c5 = 0.0f;
+}
 
-        freqcut = cutoff[sample] * 2.0f;
+/* vcf_4pole_tpt
+ *
+ * the TPT version of the 24db/oct filter
+ */
+static void
+vcf_4pole_tpt(xsynth_voice_t *voice, unsigned long sample_count,
+              float *in, float *out, float *g, float qres, float *amp)
+{
+    unsigned long sample;
+    float v, energy = 0.0f, h[XSYNTH_NUGGET_SIZE];
+    struct vcf_state f = { voice->delay1, voice->delay2, voice->delay3, voice->delay4, 0.0f };
 
-        if (freqcut > VCF_FREQ_MAX) freqcut = VCF_FREQ_MAX;
+    qres = 2.0f - qres * 1.995f;
 
-        delay2 = delay2 + freqcut * delay1;             /* delay2/4 = lowpass output */
-        highpass = in[sample] - delay2 - qres * delay1;
-        delay1 = freqcut * highpass + delay1;           /* delay1/3 = bandpass output */
+    for (sample = 0; sample < sample_count; sample++)
+        h[sample] = 1.0f / (1.0f + g[sample] * (g[sample] + qres));
 
-        delay4 = delay4 + freqcut * delay3;
-        highpass = delay2 - delay4 - qres * delay3;
-        delay3 = freqcut * highpass + delay3;
+    for (sample = 0; sample < sample_count; sample++) {
 
         /* mix filter output into output buffer */
-        out[sample] += delay4 * amp[sample];
+        v = vcf_tpt_stage(&f.delay1, &f.delay2, in[sample], g[sample], qres, h[sample]);
+        v = vcf_tpt_stage(&f.delay3, &f.delay4, v, g[sample], qres, h[sample]) * amp[sample];
+        out[sample] += v;
+        energy += v * v;
     }
 
-    voice->delay1 = delay1;
-    voice->delay2 = delay2;
-    voice->delay3 = delay3;
-    voice->delay4 = delay4;
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = f.delay3;
+    voice->delay4 = f.delay4;
     voice->c5 = 0.0f;
 }
 
@@ -370,254 +817,1727 @@ vcf_4pole(xsynth_voice_t *voice, unsigned long sample_count,
  */
 static void
 vcf_mvclpf(xsynth_voice_t *voice, unsigned long sample_count,
-           float *in, float *out, float *cutoff, float res, float *amp)
+           float *in, float *out, float *freqcut, float res, float *amp)
 {
     unsigned long s;
-    float g0, g1, w, x, d,
-          delay1 = voice->delay1,
-          delay2 = voice->delay2,
-          delay3 = voice->delay3,
-          delay4 = voice->delay4,
-          c5     = voice->c5;
+    float x, energy = 0.0f;
+    struct vcf_state f = { voice->delay1, voice->delay2, voice->delay3, voice->delay4, voice->c5 };
 
-    g0 = 0.5f;  /* g0 = dB_to_amplitude(input_gain_in_db) / 2 */
-    g1 = 2.0f;  /* g1 = dB_to_amplitude(output_gain_in_db) * 2 */
+    for (s = 0; s < sample_count; s++) {
 
-    /* res should be 0 to 1 already */
+        x = vcf_mvclpf_step(&f, in[s], freqcut[s], res) * amp[s];
+        out[s] += x;
+        energy += x * x;
+    }
 
-    for (s = 0; s < sample_count; s++) {
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = f.delay3;
+    voice->delay4 = f.delay4;
+    voice->c5     = f.c5;
+}
 
-        w = cutoff[s];
-        if (w < 0.75f) w *= 1.005f - w * (0.624f - w * (0.65f - w * 0.54f));
-        else
-	{
-	    w *= 0.6748f;
-            if (w > 0.82f) w = 0.82f;
-	}
-
-        x = in[s] * g0 - (4.3f - 0.2f * w) * res * c5 + 1e-10f;
-        x /= sqrtf(1.0f + x * x);  /* x = tanh(x) */
-        d = w * (x  - delay1) / (1.0f + delay1 * delay1);            
-        x = delay1 + 0.77f * d;
-        delay1 = x + 0.23f * d;        
-        d = w * (x  - delay2) / (1.0f + delay2 * delay2);            
-        x = delay2 + 0.77f * d;
-        delay2 = x + 0.23f * d;        
-        d = w * (x  - delay3) / (1.0f + delay3 * delay3);            
-        x = delay3 + 0.77f * d;
-        delay3 = x + 0.23f * d;        
-        d = w * (x  - delay4);
-        x = delay4 + 0.77f * d;
-        delay4 = x + 0.23f * d;        
-        c5 += 0.85f * (delay4 - c5);
+/* The oversampled MVCLPF runs the same ladder 1, 2 or 4 times per
+ * sample, with its coefficient warped for that rate, and brings the
+ * result back down through halfband decimators instead of just keeping
+ * the last step.  The taps are Kaiser-windowed sinc: 11 (beta 5) for
+ * the final 2x to 1x stage, and 7 (beta 3) for the 4x to 2x stage, where
+ * the transition band is wide.  Every other tap is zero and the centre
+ * one is 0.5.  At 1x each output goes through the final stage twice, so
+ * the delay through the filter doesn't jump when the factor changes.
+ */
+#define HB11_A   0.299251166f
+#define HB11_B  -0.058699177f
+#define HB11_C   0.009448011f
+#define HB7_A    0.299863746f
+#define HB7_B   -0.049863746f
+
+/* below these, the automatic choice drops to 1x; above both of the
+ * latter, it goes up to 4x (cutoffs in the units of freqcut_buf) */
+#define MVCLPF_1X_CUTOFF_MAX  0.375f  /* where the 1x warp would leave its polynomial */
+#define MVCLPF_1X_RES_MAX     0.5f
+#define MVCLPF_4X_CUTOFF_MIN  0.375f
+#define MVCLPF_4X_RES_MIN     0.75f
+
+/* mvclpf_tanh
+ *
+ * rational approximation to tanh(), exact at zero and reaching +/-1
+ * with zero slope at +/-3
+ */
+static inline __attribute__((always_inline)) float
+mvclpf_tanh(float x)
+{
+    if (x > 3.0f) x = 3.0f;
+    else if (x < -3.0f) x = -3.0f;
+    return x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+}
 
-        x = in[s] * g0 - (4.3f - 0.2f * w) * res * c5;
-        x /= sqrtf(1.0f + x * x);  /* x = tanh(x) */
-        d = w * (x  - delay1) / (1.0f + delay1 * delay1);            
-        x = delay1 + 0.77f * d;
-        delay1 = x + 0.23f * d;        
-        d = w * (x  - delay2) / (1.0f + delay2 * delay2);            
-        x = delay2 + 0.77f * d;
-        delay2 = x + 0.23f * d;        
-        d = w * (x  - delay3) / (1.0f + delay3 * delay3);            
-        x = delay3 + 0.77f * d;
-        delay3 = x + 0.23f * d;        
-        d = w * (x  - delay4);
-        x = delay4 + 0.77f * d;
-        delay4 = x + 0.23f * d;        
-        c5 += 0.85f * (delay4 - c5);
+/* mvclpf_pass
+ *
+ * one step of the MVCLPF-3 ladder, returning delay4
+ */
+static inline __attribute__((always_inline)) float
+mvclpf_pass(struct vcf_state *f, float in, float w, float res)
+{
+    float x, d;
+
+    x = mvclpf_tanh(in * 0.5f - (4.3f - 0.2f * w) * res * f->c5 + 1e-10f);
+    d = w * (x - f->delay1) / (1.0f + f->delay1 * f->delay1);
+    x = f->delay1 + 0.77f * d;
+    f->delay1 = x + 0.23f * d;
+    d = w * (x - f->delay2) / (1.0f + f->delay2 * f->delay2);
+    x = f->delay2 + 0.77f * d;
+    f->delay2 = x + 0.23f * d;
+    d = w * (x - f->delay3) / (1.0f + f->delay3 * f->delay3);
+    x = f->delay3 + 0.77f * d;
+    f->delay3 = x + 0.23f * d;
+    d = w * (x - f->delay4);
+    x = f->delay4 + 0.77f * d;
+    f->delay4 = x + 0.23f * d;
+    f->c5 += 0.85f * (f->delay4 - f->c5);
+
+    return f->delay4;
+}
 
-        out[s] += g1 * delay4 * amp[s];
-    }
+/* halfband_11
+ *
+ * decimate two samples, 'odd' then 'even', to one through the 11-tap
+ * halfband.  h[0] to h[4] hold the previous even samples, newest
+ * first, and h[5] and h[6] the previous odd ones.
+ */
+static inline __attribute__((always_inline)) float
+halfband_11(float *h, float odd, float even)
+{
+    float y = 0.5f * h[6] + HB11_A * (h[1] + h[2]) + HB11_B * (h[0] + h[3]) +
+              HB11_C * (even + h[4]);
 
-    voice->delay1 = delay1;
-    voice->delay2 = delay2;
-    voice->delay3 = delay3;
-    voice->delay4 = delay4;
-    voice->c5     = c5;
+    h[4] = h[3]; h[3] = h[2]; h[2] = h[1]; h[1] = h[0]; h[0] = even;
+    h[6] = h[5]; h[5] = odd;
+    return y;
 }
 
-/*
- * xsynth_voice_render
+/* halfband_7
  *
- * generate the actual sound data for this voice
+ * the same for the 7-tap halfband, with h[0] to h[2] the previous even
+ * samples and h[3] the previous odd one
  */
-void
-xsynth_voice_render(xsynth_synth_t *synth, xsynth_voice_t *voice,
-                    LADSPA_Data *out, unsigned long sample_count,
-                    int do_control_update)
+static inline __attribute__((always_inline)) float
+halfband_7(float *h, float odd, float even)
 {
-    unsigned long sample;
+    float y = 0.5f * h[3] + HB7_A * (h[0] + h[1]) + HB7_B * (even + h[2]);
 
-    /* state variables saved in voice */
+    h[2] = h[1]; h[1] = h[0]; h[0] = even;
+    h[3] = odd;
+    return y;
+}
 
-    float         lfo_pos    = voice->lfo_pos,
-                  eg1        = voice->eg1,
-                  eg2        = voice->eg2;
-    unsigned char eg1_phase  = voice->eg1_phase,
-                  eg2_phase  = voice->eg2_phase;
-    int           osc_index  = voice->osc_index;
+/* vcf_mvclpf_os
+ *
+ * the MVCLPF-3 oversampled 'factor' times, with 'w' already warped for
+ * that rate
+ */
+static inline __attribute__((always_inline)) void
+vcf_mvclpf_os(xsynth_voice_t *voice, unsigned long sample_count,
+              float *in, float *out, float *w, float res, float *amp,
+              const int factor)
+{
+    unsigned long s;
+    float x, y, energy = 0.0f;
+    struct vcf_state f = { voice->delay1, voice->delay2, voice->delay3, voice->delay4, voice->c5 };
+    float d2[7], d4[4];
 
-    /* temporary variables used in calculating voice */
+    memcpy(d2, voice->decim2, sizeof(d2));
+    memcpy(d4, voice->decim4, sizeof(d4));
 
-    float fund_pitch;
-    float deltat = synth->deltat;
-    float freq, freqkey, freqeg1, freqeg2, lfo;
+    for (s = 0; s < sample_count; s++) {
 
-    /* set up synthesis variables from patch */
-    float         omega1, omega2;
-    unsigned char osc_sync = (*(synth->osc_sync) > 0.0001f);
-    float         omega3 = *(synth->lfo_frequency);
-    unsigned char lfo_waveform = lrintf(*(synth->lfo_waveform));
-    float         lfo_amount_o = *(synth->lfo_amount_o);
-    float         lfo_amount_f = *(synth->lfo_amount_f);
-    float         eg1_amp = qdB_to_amplitude(velocity_to_attenuation[voice->velocity] *
-                                             *(synth->eg1_vel_sens));
-    float         eg1_rate_level[3], eg1_one_rate[3];
-    float         eg1_amount_o = *(synth->eg1_amount_o);
-    float         eg2_amp = qdB_to_amplitude(velocity_to_attenuation[voice->velocity] *
-                                             *(synth->eg2_vel_sens));
-    float         eg2_rate_level[3], eg2_one_rate[3];
-    float         eg2_amount_o = *(synth->eg2_amount_o);
-    unsigned char vcf_mode = lrintf(*(synth->vcf_mode));
-    float         qres = *(synth->vcf_qres) / 1.995f * voice->pressure;  /* now 0 to 1 */
-    float         balance1 = 1.0f - *(synth->osc_balance);
-    float         balance2 = *(synth->osc_balance);
-    float         vol_out = volume(*(synth->volume) * synth->cc_volume);
+        switch (factor) {
+          default:
+          case 1:
+            y = mvclpf_pass(&f, in[s], w[s], res);
+            y = halfband_11(d2, y, y);
+            break;
+          case 2:
+            x = mvclpf_pass(&f, in[s], w[s], res);
+            y = mvclpf_pass(&f, in[s], w[s], res);
+            y = halfband_11(d2, x, y);
+            break;
+          case 4:
+            x = mvclpf_pass(&f, in[s], w[s], res);
+            y = mvclpf_pass(&f, in[s], w[s], res);
+            x = halfband_7(d4, x, y);
+            y = mvclpf_pass(&f, in[s], w[s], res);
+            y = halfband_7(d4, y, mvclpf_pass(&f, in[s], w[s], res));
+            y = halfband_11(d2, x, y);
+            break;
+        }
 
-    fund_pitch = *(synth->glide_time) * voice->target_pitch +
-                 (1.0f - *(synth->glide_time)) * voice->prev_pitch;    /* portamento */
-    if (do_control_update) {
-        voice->prev_pitch = fund_pitch; /* save pitch for next time */
+        y *= 2.0f * amp[s];  /* output gain, as in vcf_mvclpf_step() */
+        out[s] += y;
+        energy += y * y;
     }
 
-    fund_pitch *= synth->pitch_bend * *(synth->tuning);
-    
-    omega1 = *(synth->osc1_pitch) * fund_pitch;
-    omega2 = *(synth->osc2_pitch) * fund_pitch;
-
-    eg1_rate_level[0] = *(synth->eg1_attack_time) * eg1_amp;  /* eg1_attack_time * 1.0f * eg1_amp */
-    eg1_one_rate[0] = 1.0f - *(synth->eg1_attack_time);
-    eg1_rate_level[1] = *(synth->eg1_decay_time) * *(synth->eg1_sustain_level) * eg1_amp;
-    eg1_one_rate[1] = 1.0f - *(synth->eg1_decay_time);
-    eg1_rate_level[2] = 0.0f;                                 /* eg1_release_time * 0.0f * eg1_amp */
-    eg1_one_rate[2] = 1.0f - *(synth->eg1_release_time);
-    eg2_rate_level[0] = *(synth->eg2_attack_time) * eg2_amp;
-    eg2_one_rate[0] = 1.0f - *(synth->eg2_attack_time);
-    eg2_rate_level[1] = *(synth->eg2_decay_time) * *(synth->eg2_sustain_level) * eg2_amp;
-    eg2_one_rate[1] = 1.0f - *(synth->eg2_decay_time);
-    eg2_rate_level[2] = 0.0f;
-    eg2_one_rate[2] = 1.0f - *(synth->eg2_release_time);
-
-    eg1_amp *= 0.99f;  /* Xsynth's original eg phase 1 to 2 transition check was:  */
-    eg2_amp *= 0.99f;  /*    if (!eg1_phase && eg1 > 0.99f) eg1_phase = 1;         */
+    memcpy(voice->decim2, d2, sizeof(d2));
+    if (factor == 4)
+        memcpy(voice->decim4, d4, sizeof(d4));
 
-    freq = M_PI_F * deltat * fund_pitch * synth->mod_wheel;  /* now (0 to 1) * pi */
-    freqkey = freq * *(synth->vcf_cutoff);
-    freqeg1 = freq * *(synth->eg1_amount_f);
-    freqeg2 = freq * *(synth->eg2_amount_f);
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = f.delay3;
+    voice->delay4 = f.delay4;
+    voice->c5     = f.c5;
+}
 
-    /* copy some things so oscillator functions can see them */
-    voice->osc1.waveform = lrintf(*(synth->osc1_waveform));
-    voice->osc1.pw       = *(synth->osc1_pulsewidth);
-    voice->osc2.waveform = lrintf(*(synth->osc2_waveform));
-    voice->osc2.pw       = *(synth->osc2_pulsewidth);
+/* vcf_mvclpf_oversampled
+ *
+ * run the oversampled MVCLPF-3 at one of its three rates
+ */
+static void
+vcf_mvclpf_oversampled(xsynth_voice_t *voice, unsigned long sample_count,
+                       float *in, float *out, float *w, float res, float *amp,
+                       int factor)
+{
+    switch (factor) {
+      default:
+      case 1: vcf_mvclpf_os(voice, sample_count, in, out, w, res, amp, 1); break;
+      case 2: vcf_mvclpf_os(voice, sample_count, in, out, w, res, amp, 2); break;
+      case 4: vcf_mvclpf_os(voice, sample_count, in, out, w, res, amp, 4); break;
+    }
+}
 
-    /* --- LFO, EG1, and EG2 section */
+/* mvclpf_prepare
+ *
+ * pick the MVCLPF oversampling factor for a burst, or 0 to use the
+ * classic filter, and scale the cutoffs in 'cutoff' to suit, ahead of
+ * vcf_coefficients()
+ */
+static int
+mvclpf_prepare(xsynth_synth_t *synth, float *cutoff, unsigned long count, float res)
+{
+    int factor = synth->mvclpf_oversample;
+    unsigned long s;
+    float peak, scale;
+
+    if (factor == XSYNTH_OVERSAMPLE_AUTO) {
+        peak = 0.0f;
+        for (s = 0; s < count; s++)
+            if (cutoff[s] > peak) peak = cutoff[s];
+        if (peak < MVCLPF_1X_CUTOFF_MAX && res < MVCLPF_1X_RES_MAX)
+            factor = 1;
+        else if (peak >= MVCLPF_4X_CUTOFF_MIN && res >= MVCLPF_4X_RES_MIN)
+            factor = 4;
+        else
+            factor = 2;
+    }
 
-    for (sample = 0; sample < sample_count; sample++) {
+    /* the classic warp is for two steps per sample */
+    if (factor && factor != 2) {
+        scale = 2.0f / (float)factor;
+        for (s = 0; s < count; s++)
+            cutoff[s] *= scale;
+    }
 
-        lfo = oscillator(&lfo_pos, omega3, deltat, lfo_waveform);
+    return factor;
+}
 
-        eg1 = eg1_rate_level[eg1_phase] + eg1_one_rate[eg1_phase] * eg1;
-        eg2 = eg2_rate_level[eg2_phase] + eg2_one_rate[eg2_phase] * eg2;
+/* mvclpf_prime
+ *
+ * note a voice's MVCLPF oversampling factor for this burst.  When it
+ * changes, the decimator stages which weren't running are primed with
+ * the filter's current output, so they take over without a step.
+ */
+static inline void
+mvclpf_prime(xsynth_voice_t *voice, int factor)
+{
+    int i;
 
-        voice->osc2_w_buf[sample] = deltat * omega2 *
-                                    (1.0f + eg1 * eg1_amount_o) *
-                                    (1.0f + eg2 * eg2_amount_o) *
-                                    (1.0f + lfo * lfo_amount_o);
+    if (factor != voice->mvclpf_factor) {
+        if (factor && !voice->mvclpf_factor)
+            for (i = 0; i < 7; i++) voice->decim2[i] = voice->delay4;
+        if (factor == 4)
+            for (i = 0; i < 4; i++) voice->decim4[i] = voice->delay4;
+        voice->mvclpf_factor = factor;
+    }
+}
 
-        voice->freqcut_buf[sample] = (freqkey + freqeg1 * eg1 + freqeg2 * eg2) *
-                                     (1.0f + lfo * lfo_amount_f);
+/*
+ * per-voice synthesis variables, derived once per burst from the patch
+ * ports and the voice's pitch, velocity, and pressure
+ */
+struct vparams {
+    float w1,                  /* VCO 1 phase increment */
+          w2;                  /* VCO 2 phase increment, before modulation */
+    float eg1_rate_level[3], eg1_one_rate[3], eg1_level[3], eg1_amp;
+    float eg2_rate_level[3], eg2_one_rate[3], eg2_level[3], eg2_amp;
+    float freqkey, freqeg1, freqeg2;
+    float qres;
+};
 
-        voice->vca_buf[sample] = eg1 * vol_out;
+static void
+voice_params(xsynth_synth_t *synth, xsynth_voice_t *voice,
+             int do_control_update, struct vparams *vp)
+{
+    float fund_pitch;
+    float deltat = synth->deltat;
+    float freq;
+    float eg1_amp = qdB_to_amplitude(velocity_to_attenuation[voice->velocity] *
+                                     *(synth->eg1_vel_sens));
+    float eg2_amp = qdB_to_amplitude(velocity_to_attenuation[voice->velocity] *
+                                     *(synth->eg2_vel_sens));
 
-        if (!eg1_phase && eg1 > eg1_amp) eg1_phase = 1;  /* flip from attack to decay */
-        if (!eg2_phase && eg2 > eg2_amp) eg2_phase = 1;  /* flip from attack to decay */
+    fund_pitch = *(synth->glide_time) * voice->target_pitch +
+                 (1.0f - *(synth->glide_time)) * voice->prev_pitch;    /* portamento */
+    if (do_control_update) {
+        voice->prev_pitch = fund_pitch; /* save pitch for next time */
     }
 
+    fund_pitch *= synth->pitch_bend * *(synth->tuning);
+
+    vp->w1 = deltat * *(synth->osc1_pitch) * fund_pitch;
+    vp->w2 = deltat * *(synth->osc2_pitch) * fund_pitch;
+
+    vp->eg1_rate_level[0] = *(synth->eg1_attack_time) * eg1_amp;  /* eg1_attack_time * 1.0f * eg1_amp */
+    vp->eg1_one_rate[0] = 1.0f - *(synth->eg1_attack_time);
+    vp->eg1_rate_level[1] = *(synth->eg1_decay_time) * *(synth->eg1_sustain_level) * eg1_amp;
+    vp->eg1_one_rate[1] = 1.0f - *(synth->eg1_decay_time);
+    vp->eg1_rate_level[2] = 0.0f;                                 /* eg1_release_time * 0.0f * eg1_amp */
+    vp->eg1_one_rate[2] = 1.0f - *(synth->eg1_release_time);
+    vp->eg2_rate_level[0] = *(synth->eg2_attack_time) * eg2_amp;
+    vp->eg2_one_rate[0] = 1.0f - *(synth->eg2_attack_time);
+    vp->eg2_rate_level[1] = *(synth->eg2_decay_time) * *(synth->eg2_sustain_level) * eg2_amp;
+    vp->eg2_one_rate[1] = 1.0f - *(synth->eg2_decay_time);
+    vp->eg2_rate_level[2] = 0.0f;
+    vp->eg2_one_rate[2] = 1.0f - *(synth->eg2_release_time);
+    vp->eg1_level[0] = eg1_amp;  /* the levels each phase settles on */
+    vp->eg1_level[1] = *(synth->eg1_sustain_level) * eg1_amp;
+    vp->eg1_level[2] = 0.0f;
+    vp->eg2_level[0] = eg2_amp;
+    vp->eg2_level[1] = *(synth->eg2_sustain_level) * eg2_amp;
+    vp->eg2_level[2] = 0.0f;
+
+    vp->eg1_amp = eg1_amp * 0.99f;  /* Xsynth's original eg phase 1 to 2 transition check was:  */
+    vp->eg2_amp = eg2_amp * 0.99f;  /*    if (!eg1_phase && eg1 > 0.99f) eg1_phase = 1;         */
+
+    freq = M_PI_F * deltat * fund_pitch * synth->mod_wheel;  /* now (0 to 1) * pi */
+    vp->freqkey = freq * *(synth->vcf_cutoff);
+    vp->freqeg1 = freq * *(synth->eg1_amount_f);
+    vp->freqeg2 = freq * *(synth->eg2_amount_f);
+
+    vp->qres = *(synth->vcf_qres) / 1.995f * voice->pressure;  /* now 0 to 1 */
+
+    /* copy some things so oscillator functions can see them */
+    voice->osc1.waveform = lrintf(*(synth->osc1_waveform));
+    voice->osc1.pw       = *(synth->osc1_pulsewidth);
+    voice->osc2.waveform = lrintf(*(synth->osc2_waveform));
+    voice->osc2.pw       = *(synth->osc2_pulsewidth);
+}
+
+/*
+ * voice_render_oscillators
+ *
+ * run VCO 1 and VCO 2 into the voice's oscillator audio buffer
+ */
+static void
+voice_render_oscillators(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                         xsynth_scratch_t *scratch, unsigned long sample_count,
+                         int osc_index, float w1)
+{
+    unsigned char osc_sync = (*(synth->osc_sync) > 0.0001f);
+    float         balance1 = 1.0f - *(synth->osc_balance);
+    float         balance2 = *(synth->osc_balance);
+
     /* --- VCO 1 section */
 
     if (osc_sync)
-        blosc_master(sample_count, voice, &voice->osc1,
-                     osc_index, balance1, deltat * omega1);
+        blosc_master(sample_count, voice, &voice->osc1, scratch->osc_sync,
+                     osc_index, balance1, w1);
     else
-        blosc_single1(sample_count, voice, &voice->osc1,
-                      osc_index, balance1, deltat * omega1);
+        blosc_single1(sample_count, voice, &voice->osc1, scratch->osc_sync,
+                      osc_index, balance1, w1);
 
     /* --- VCO 2 section */
 
     if (osc_sync)
-        blosc_slave(sample_count, voice, &voice->osc2,
-                     osc_index, balance2, voice->osc2_w_buf);
+        blosc_slave(sample_count, voice, &voice->osc2, scratch->osc_sync,
+                     osc_index, balance2, scratch->osc2_w_buf);
     else
-        blosc_single2(sample_count, voice, &voice->osc2,
-                      osc_index, balance2, voice->osc2_w_buf);
+        blosc_single2(sample_count, voice, &voice->osc2, scratch->osc_sync,
+                      osc_index, balance2, scratch->osc2_w_buf);
+}
+
+/* oscillator waveform kinds, one per blosc_* oscillator function */
+#define OSC_SINE     0
+#define OSC_TRI      1
+#define OSC_SAWUP    2
+#define OSC_SAWDOWN  3
+#define OSC_RECT     4
+#define OSC_KINDS    5
+
+static inline int
+osc_kind(int waveform)
+{
+    switch (waveform) {
+      default:
+      case 0:  return OSC_SINE;
+      case 1:
+      case 6:  return OSC_TRI;
+      case 2:  return OSC_SAWUP;
+      case 3:  return OSC_SAWDOWN;
+      case 4:
+      case 5:  return OSC_RECT;
+    }
+}
+
+/* BLOSC_CALL(type, kind, ...) calls the blosc_<type> function for the
+ * oscillator waveform kind, which is usually a compile-time constant */
+#define BLOSC_CALL(type, kind, args...) { \
+    switch (kind) { \
+      default: \
+      case OSC_SINE:    blosc_##type##sine(args);    break; \
+      case OSC_TRI:     blosc_##type##tri(args);     break; \
+      case OSC_SAWUP:   blosc_##type##sawup(args);   break; \
+      case OSC_SAWDOWN: blosc_##type##sawdown(args); break; \
+      case OSC_RECT:    blosc_##type##rect(args);    break; \
+    } \
+}
+
+/*
+ * voice_render_oscillators_kernel
+ *
+ * as voice_render_oscillators(), but with the waveform kinds and sync
+ * given, so that when they are constants the choice of oscillator
+ * functions is made at compile time
+ */
+static inline __attribute__((always_inline)) void
+voice_render_oscillators_kernel(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                                xsynth_scratch_t *scratch, unsigned long sample_count,
+                                int osc_index, float w1,
+                                const int osc1_kind, const int osc2_kind,
+                                const int osc_sync)
+{
+    float         balance1 = 1.0f - *(synth->osc_balance);
+    float         balance2 = *(synth->osc_balance);
+
+    /* --- VCO 1 section */
+
+    if (osc_sync)
+        BLOSC_CALL(master, osc1_kind, sample_count, voice, &voice->osc1,
+                   scratch->osc_sync, osc_index, balance1, w1)
+    else
+        BLOSC_CALL(single1, osc1_kind, sample_count, voice, &voice->osc1,
+                   scratch->osc_sync, osc_index, balance1, w1)
+
+    /* --- VCO 2 section */
+
+    if (osc_sync)
+        BLOSC_CALL(slave, osc2_kind, sample_count, voice, &voice->osc2,
+                   scratch->osc_sync, osc_index, balance2, scratch->osc2_w_buf)
+    else
+        BLOSC_CALL(single2, osc2_kind, sample_count, voice, &voice->osc2,
+                   scratch->osc_sync, osc_index, balance2, scratch->osc2_w_buf)
+}
+
+/*
+ * voice_control_update
+ *
+ * do those things should be done only once per control-calculation
+ * interval ("nugget"), such as voice check-for-dead, pitch envelope
+ * calculations, volume envelope phase transition checks, etc.  Returns
+ * non-zero if the voice has finished; xsynth_synth_render_voices() turns
+ * it off once the whole burst is rendered.
+ */
+static int
+voice_control_update(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                     unsigned char eg1_phase, float last_vca, int *osc_index)
+{
+    float energy = voice->energy;
+
+    voice->energy = 0.0f;
+
+    /* check if we've decayed to nothing, mark voice as finished if so */
+    if (eg1_phase == 2 && last_vca < 6.26e-6f) {
+        /* sound has completed its release phase (>96dB below volume '5' max) */
+
+        XDB_MESSAGE(XDB_NOTE, " xsynth_voice_render check for dead: killing note id %d\n", voice->note_id);
+        voice->finished = 1;
+        return 1; /* we're dead now */
+    }
+
+    /* if the voice's actual output has been below the silence threshold
+     * for long enough once released, retire it early */
+    if (synth->silence_threshold > 0.0f) {
+        if (energy < synth->silence_threshold * (float)XSYNTH_NUGGET_SIZE)
+            voice->silent_nuggets++;
+        else
+            voice->silent_nuggets = 0;
+        if (eg1_phase == 2 && voice->silent_nuggets >= XSYNTH_SILENCE_NUGGETS) {
+            XDB_MESSAGE(XDB_NOTE, " xsynth_voice_render check for silence: retiring note id %d\n", voice->note_id);
+            voice->finished = 2;
+            return 1;
+        }
+    }
+
+    /* already saved prev_pitch above */
+
+    /* wrap the oscillator audio buffer index.  It is a multiple of
+     * XSYNTH_NUGGET_SIZE here, as is MINBLEP_BUFFER_LENGTH, so the next
+     * nugget can be read from osc_audio without wrapping. */
+    *osc_index &= MINBLEP_BUFFER_MASK;
+    return 0;
+}
+
+/*
+ * eg_steps
+ *
+ * combine 'n' steps of the envelope recurrence eg = rate_level +
+ * one_rate * eg into one, eg = *rate_level_n + *one_rate_n * eg
+ */
+static inline void
+eg_steps(float rate_level, float one_rate, unsigned long n,
+         float *rate_level_n, float *one_rate_n)
+{
+    float rl = 0.0f, or = 1.0f;
+
+    while (n--) {
+        rl = rate_level + one_rate * rl;
+        or *= one_rate;
+    }
+    *rate_level_n = rl;
+    *one_rate_n = or;
+}
+
+/*
+ * eg_segment
+ *
+ * fill 'out' with 'n' samples of an envelope segment in closed form: the
+ * recurrence eg = rate_level + one_rate * eg approaches 'level' as
+ * eg[k] = level + (eg - level) * one_rate^(k+1).  The powers are made
+ * eight at a time from a table of the first eight, so the loop carries
+ * only one multiply per eight samples and vectorizes.
+ */
+static inline void
+eg_segment(float *out, unsigned long n, float eg, float level, float one_rate)
+{
+    float power[8], d = eg - level, step;
+    unsigned long k, j;
+
+    power[0] = one_rate;
+    for (j = 1; j < 8; j++)
+        power[j] = power[j - 1] * one_rate;
+    step = power[7];
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        for (j = 0; j < 8; j++)
+            out[k + j] = level + d * power[j];
+        d *= step;
+    }
+    for (j = 0; k + j < n; j++)
+        out[k + j] = level + d * power[j];
+}
+
+/*
+ * eg_render
+ *
+ * render 'sample_count' samples of an envelope into 'out', updating its
+ * value and phase.  The attack runs the recurrence eg = rate_level +
+ * one_rate * eg itself, since where it first exceeds 'amp' and flips to
+ * decay depends on the recurrence's rounding: at slow rates, that moves
+ * the flip by hundreds of samples from where any closed form would put
+ * it.  Decay and release are closed-form segments settling on their
+ * nominal 'level's, so once the attack is over there is no per-sample
+ * test.
+ */
+static void
+eg_render(float *out, unsigned long sample_count, float *egp, unsigned char *phasep,
+          const float *rate_level, const float *one_rate, const float *level, float amp)
+{
+    float eg = *egp;
+    unsigned long k = 0;
+
+    if (*phasep == 0) {
+        while (k < sample_count) {
+            eg = rate_level[0] + one_rate[0] * eg;
+            out[k++] = eg;
+            if (eg > amp) {
+                *phasep = 1;  /* flip from attack to decay */
+                break;
+            }
+        }
+    }
+    if (k < sample_count)
+        eg_segment(out + k, sample_count - k, eg, level[*phasep], one_rate[*phasep]);
+
+    *egp = out[sample_count - 1];
+}
+
+/*
+ * xsynth_voice_check_eg
+ *
+ * check eg_render() against the per-sample recurrence it replaced, over
+ * 'length' samples rendered a nugget at a time: an attack towards 1 at
+ * 'attack_rate', a decay at 'decay_rate' to 'sustain', and a release at
+ * 'decay_rate' from the first nugget after 'release' samples.  Returns
+ * the largest difference between the two.  'flips' gets the sample on
+ * which each flips from attack to decay: eg_render(), the recurrence,
+ * and the exact curve in double precision, or -1 where it doesn't.
+ */
+float
+xsynth_voice_check_eg(float attack_rate, float decay_rate, float sustain,
+                      unsigned long length, unsigned long release, long *flips)
+{
+    float rate_level[3], one_rate[3], level[3], amp = 0.99f;
+    float out[XSYNTH_NUGGET_SIZE], eg = 0.0f, recurrence = 0.0f;
+    float diff, worst = 0.0f;
+    double exact = 0.0, rate[3];
+    unsigned char phase = 0, recurrence_phase = 0, exact_phase = 0;
+    unsigned long n, s, count;
+    int attack;
+
+    rate_level[0] = attack_rate;
+    one_rate[0]   = 1.0f - attack_rate;
+    level[0]      = 1.0f;
+    rate_level[1] = decay_rate * sustain;
+    one_rate[1]   = 1.0f - decay_rate;
+    level[1]      = sustain;
+    rate_level[2] = 0.0f;
+    one_rate[2]   = 1.0f - decay_rate;
+    level[2]      = 0.0f;
+    rate[0] = attack_rate;
+    rate[1] = rate[2] = decay_rate;
+    flips[0] = flips[1] = flips[2] = -1;
+
+    for (n = 0; n < length; n += count) {
+        count = (length - n < XSYNTH_NUGGET_SIZE ? length - n : XSYNTH_NUGGET_SIZE);
+        if (n >= release)
+            phase = recurrence_phase = exact_phase = 2;
+
+        attack = (phase == 0);
+        eg_render(out, count, &eg, &phase, rate_level, one_rate, level, amp);
+
+        for (s = 0; s < count; s++) {
+            if (attack && flips[0] < 0 && out[s] > amp)
+                flips[0] = n + s;
+            recurrence = rate_level[recurrence_phase] + one_rate[recurrence_phase] * recurrence;
+            diff = fabsf(out[s] - recurrence);
+            if (diff > worst)
+                worst = diff;
+            if (!recurrence_phase && recurrence > amp) {
+                recurrence_phase = 1;
+                flips[1] = n + s;
+            }
+            exact += rate[exact_phase] * (level[exact_phase] - exact);
+            if (!exact_phase && exact > (double)amp) {
+                exact_phase = 1;
+                flips[2] = n + s;
+            }
+        }
+    }
+
+    return worst;
+}
+
+/*
+ * voice_render_modulators_decimated
+ *
+ * the control-rate alternative to the LFO, EG1, and EG2 loop of
+ * voice_render_kernel(): evaluate the LFO and EGs only every
+ * synth->control_decimation samples, and fill osc2_w_buf, freqcut_buf
+ * and vca_buf by linear interpolation between.  Only for voices with
+ * both EGs past their attacks, since the attack-to-decay flip must stay
+ * sample accurate.
+ */
+static void
+voice_render_modulators_decimated(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                                  struct vparams *vp, xsynth_scratch_t *scratch,
+                                  unsigned long sample_count,
+                                  unsigned char eg1_phase, unsigned char eg2_phase,
+                                  float *eg1p, float *eg2p)
+{
+    unsigned long n = synth->control_decimation,
+                  segments = sample_count / n,
+                  remainder = sample_count % n,
+                  sample, m, j, k;
+    unsigned int  inc = lfo_increment(*(synth->lfo_frequency), synth->deltat),
+                  phase;
+    unsigned char lfo_waveform = lrintf(*(synth->lfo_waveform));
+    float         lfo_amount_o = *(synth->lfo_amount_o);
+    float         lfo_amount_f = *(synth->lfo_amount_f);
+    float         eg1_amount_o = *(synth->eg1_amount_o);
+    float         eg2_amount_o = *(synth->eg2_amount_o);
+    float         vol_out = volume(*(synth->volume) * synth->cc_volume) * synth->render_gain;
+    float eg1 = *eg1p, eg2 = *eg2p,
+          eg1_rl = 0.0f, eg1_or = 0.0f, eg2_rl = 0.0f, eg2_or = 0.0f,
+          w2_a, freqcut_a, vca_a, w2_b, freqcut_b, vca_b,
+          w2_d, freqcut_d, vca_d, t;
+    float *lfo = scratch->lfo_buf;  /* the LFO at the start and each segment end */
+
+    /* the LFO at the last sample rendered, then every n samples after */
+    phase = voice->lfo_phase - (unsigned int)n * inc;
+    lfo_render(&phase, (unsigned int)n * inc, lfo_waveform, lfo, segments + 1);
+    if (remainder) {
+        phase = voice->lfo_phase + (unsigned int)(segments * n) * inc;
+        lfo_render(&phase, (unsigned int)remainder * inc, lfo_waveform, lfo + segments + 1, 1);
+    }
+    voice->lfo_phase += (unsigned int)sample_count * inc;
+
+    w2_a = vp->w2 * (1.0f + eg1 * eg1_amount_o) *
+                    (1.0f + eg2 * eg2_amount_o) *
+                    (1.0f + lfo[0] * lfo_amount_o);
+    freqcut_a = (vp->freqkey + vp->freqeg1 * eg1 + vp->freqeg2 * eg2) *
+                (1.0f + lfo[0] * lfo_amount_f);
+    vca_a = eg1 * vol_out;
+
+    for (sample = 0, k = 1; sample < sample_count; sample += m, k++) {
+
+        m = (k <= segments ? n : remainder);
+        if (k == 1 || m != n) {  /* otherwise reuse the last segment's steps */
+            eg_steps(vp->eg1_rate_level[eg1_phase], vp->eg1_one_rate[eg1_phase], m, &eg1_rl, &eg1_or);
+            eg_steps(vp->eg2_rate_level[eg2_phase], vp->eg2_one_rate[eg2_phase], m, &eg2_rl, &eg2_or);
+        }
+        eg1 = eg1_rl + eg1_or * eg1;
+        eg2 = eg2_rl + eg2_or * eg2;
+
+        w2_b = vp->w2 * (1.0f + eg1 * eg1_amount_o) *
+                        (1.0f + eg2 * eg2_amount_o) *
+                        (1.0f + lfo[k] * lfo_amount_o);
+        freqcut_b = (vp->freqkey + vp->freqeg1 * eg1 + vp->freqeg2 * eg2) *
+                    (1.0f + lfo[k] * lfo_amount_f);
+        vca_b = eg1 * vol_out;
+
+        t = 1.0f / (float)m;
+        w2_d = (w2_b - w2_a) * t;
+        freqcut_d = (freqcut_b - freqcut_a) * t;
+        vca_d = (vca_b - vca_a) * t;
+        for (j = 0; j < m; j++) {
+            t = (float)(int)(j + 1);
+            scratch->osc2_w_buf[sample + j]  = w2_a + w2_d * t;
+            scratch->freqcut_buf[sample + j] = freqcut_a + freqcut_d * t;
+            scratch->vca_buf[sample + j]     = vca_a + vca_d * t;
+        }
+        /* the segment ends exactly on the control values */
+        scratch->vca_buf[sample + m - 1] = vca_b;
+
+        w2_a = w2_b;
+        freqcut_a = freqcut_b;
+        vca_a = vca_b;
+    }
+
+    *eg1p = eg1;
+    *eg2p = eg2;
+}
+
+/*
+ * count_subnormals
+ *
+ * in XSYNTH_DENORMALS_COUNT mode, add the number of subnormal values in
+ * 'x' to this thread's count for 'stage'.  This tests the bits rather
+ * than comparing, so that -ffast-math can't fold it away.
+ */
+static void
+count_subnormals(xsynth_synth_t *synth, int stage, const float *x, unsigned long count)
+{
+    const uint32_t *bits = (const uint32_t *)x;
+    uint64_t found = 0;
+    unsigned long i;
+    xsynth_profile_t *p;
+
+    for (i = 0; i < count; i++)
+        found += ((bits[i] & 0x7f800000) == 0 && (bits[i] & 0x007fffff) != 0);
+
+    if (found) {
+        p = &synth->profile[xsynth_thread_index];
+        __atomic_store_n(&p->subnormals[stage], p->subnormals[stage] + found, __ATOMIC_RELAXED);
+    }
+}
+
+/*
+ * voice_render_kernel
+ *
+ * generate the actual sound data for this voice.  This is instantiated
+ * below once with the oscillator waveform kinds, sync, and filter mode
+ * taken from the ports at run time, as xsynth_voice_render(), and once
+ * for each combination of them as constants, as the specialized kernels.
+ */
+static inline __attribute__((always_inline)) void
+voice_render_kernel(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                    LADSPA_Data *out, unsigned long sample_count,
+                    int do_control_update, const int osc1_kind,
+                    const int osc2_kind, const int osc_sync,
+                    const unsigned char vcf_mode)
+{
+    unsigned long sample;
+
+    /* state variables saved in voice */
+
+    float         eg1        = voice->eg1,
+                  eg2        = voice->eg2;
+    unsigned char eg1_phase  = voice->eg1_phase,
+                  eg2_phase  = voice->eg2_phase;
+    int           osc_index  = voice->osc_index;
+
+    /* temporary variables used in calculating voice */
+
+    float deltat = synth->deltat;
+    float lfo;
+    int   vcf, oversample = 0;
+    struct vparams vp;
+    xsynth_scratch_t *scratch = &synth->scratch[xsynth_thread_index];
+
+    /* set up synthesis variables from patch */
+    float         omega3 = *(synth->lfo_frequency);
+    unsigned char lfo_waveform = lrintf(*(synth->lfo_waveform));
+    float         lfo_amount_o = *(synth->lfo_amount_o);
+    float         lfo_amount_f = *(synth->lfo_amount_f);
+    float         eg1_amount_o = *(synth->eg1_amount_o);
+    float         eg2_amount_o = *(synth->eg2_amount_o);
+    float         vol_out = volume(*(synth->volume) * synth->cc_volume) * synth->render_gain;
+    XSYNTH_PROFILE_START();
+
+    voice_params(synth, voice, do_control_update, &vp);
+
+    /* --- LFO, EG1, and EG2 section */
+
+    if (synth->control_decimation > 1 && eg1_phase && eg2_phase) {
+
+        voice_render_modulators_decimated(synth, voice, &vp, scratch, sample_count,
+                                          eg1_phase, eg2_phase, &eg1, &eg2);
+
+    } else {
+
+        lfo_render(&voice->lfo_phase, lfo_increment(omega3, deltat), lfo_waveform,
+                   scratch->lfo_buf, sample_count);
+        eg_render(scratch->eg1_buf, sample_count, &eg1, &eg1_phase,
+                  vp.eg1_rate_level, vp.eg1_one_rate, vp.eg1_level, vp.eg1_amp);
+        eg_render(scratch->eg2_buf, sample_count, &eg2, &eg2_phase,
+                  vp.eg2_rate_level, vp.eg2_one_rate, vp.eg2_level, vp.eg2_amp);
+
+        for (sample = 0; sample < sample_count; sample++) {
+
+            lfo = scratch->lfo_buf[sample];
+            eg1 = scratch->eg1_buf[sample];
+            eg2 = scratch->eg2_buf[sample];
+
+            scratch->osc2_w_buf[sample] = vp.w2 *
+                                        (1.0f + eg1 * eg1_amount_o) *
+                                        (1.0f + eg2 * eg2_amount_o) *
+                                        (1.0f + lfo * lfo_amount_o);
+
+            scratch->freqcut_buf[sample] = (vp.freqkey + vp.freqeg1 * eg1 + vp.freqeg2 * eg2) *
+                                         (1.0f + lfo * lfo_amount_f);
+
+            scratch->vca_buf[sample] = eg1 * vol_out;
+        }
+    }
+
+    /* the cutoffs become coefficient ramps for the filter in use */
+    vcf = vcf_kind(vcf_mode, synth->vcf_topology);
+    if (vcf == VCF_MVCLPF)
+        oversample = mvclpf_prepare(synth, scratch->freqcut_buf, sample_count, vp.qres);
+    mvclpf_prime(voice, oversample);
+    vcf_coefficients(scratch->freqcut_buf, sample_count, vcf);
+
+    if (synth->denormal_mode == XSYNTH_DENORMALS_COUNT) {
+        count_subnormals(synth, XSYNTH_STAGE_MODULATORS, scratch->osc2_w_buf, sample_count);
+        count_subnormals(synth, XSYNTH_STAGE_MODULATORS, scratch->freqcut_buf, sample_count);
+        count_subnormals(synth, XSYNTH_STAGE_MODULATORS, scratch->vca_buf, sample_count);
+    }
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_MODULATORS, sample_count);
+
+    /* --- VCO 1 and VCO 2 section */
+
+    voice_render_oscillators_kernel(synth, voice, scratch, sample_count, osc_index,
+                                    vp.w1, osc1_kind, osc2_kind, osc_sync);
+
+    if (synth->denormal_mode == XSYNTH_DENORMALS_COUNT)
+        count_subnormals(synth, XSYNTH_STAGE_OSCILLATORS, voice->osc_audio + osc_index,
+                         sample_count);
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_OSCILLATORS, sample_count);
 
     /* --- VCF and VCA section */
 
-    switch (vcf_mode) {
+    switch (vcf) {
       default:
-      case 0:
+      case VCF_2POLE:
         vcf_2pole(voice, sample_count, voice->osc_audio + osc_index, out,
-                  voice->freqcut_buf, qres, voice->vca_buf);
+                  scratch->freqcut_buf, vp.qres, scratch->vca_buf);
         break;
-      case 1:
+      case VCF_4POLE:
         vcf_4pole(voice, sample_count, voice->osc_audio + osc_index, out,
-                  voice->freqcut_buf, qres, voice->vca_buf);
+                  scratch->freqcut_buf, vp.qres, scratch->vca_buf);
+        break;
+      case VCF_MVCLPF:
+        if (oversample)
+            vcf_mvclpf_oversampled(voice, sample_count, voice->osc_audio + osc_index, out,
+                                   scratch->freqcut_buf, vp.qres, scratch->vca_buf,
+                                   oversample);
+        else
+            vcf_mvclpf(voice, sample_count, voice->osc_audio + osc_index, out,
+                       scratch->freqcut_buf, vp.qres, scratch->vca_buf);
+        break;
+      case VCF_2POLE_TPT:
+        vcf_2pole_tpt(voice, sample_count, voice->osc_audio + osc_index, out,
+                      scratch->freqcut_buf, vp.qres, scratch->vca_buf);
         break;
-      case 2:
-        vcf_mvclpf(voice, sample_count, voice->osc_audio + osc_index, out,
-                   voice->freqcut_buf, qres, voice->vca_buf);
+      case VCF_4POLE_TPT:
+        vcf_4pole_tpt(voice, sample_count, voice->osc_audio + osc_index, out,
+                      scratch->freqcut_buf, vp.qres, scratch->vca_buf);
         break;
     }
 
+    if (synth->denormal_mode == XSYNTH_DENORMALS_COUNT) {
+        float state[5] = { voice->delay1, voice->delay2, voice->delay3, voice->delay4,
+                           voice->c5 };
+        count_subnormals(synth, XSYNTH_STAGE_VCF + (vcf_mode > 2 ? 0 : vcf_mode), state, 5);
+    }
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_VCF + (vcf_mode > 2 ? 0 : vcf_mode), sample_count);
+
+    /* clear the span just read, ready for the oscillators to add into
+     * when the buffer comes back around */
+    memset(voice->osc_audio + osc_index, 0, sample_count * sizeof(float));
     osc_index += sample_count;
 
-    if (do_control_update) {
-        /* do those things should be done only once per control-calculation
-         * interval ("nugget"), such as voice check-for-dead, pitch envelope
-         * calculations, volume envelope phase transition checks, etc. */
-
-        /* check if we've decayed to nothing, turn off voice if so */
-        if (eg1_phase == 2 &&
-            voice->vca_buf[sample_count - 1] < 6.26e-6f) {
-            /* sound has completed its release phase (>96dB below volume '5' max) */
-
-            XDB_MESSAGE(XDB_NOTE, " xsynth_voice_render check for dead: killing note id %d\n", voice->note_id);
-            xsynth_voice_off(voice);
-            return; /* we're dead now, so return */
-        }
+    if (do_control_update &&
+        voice_control_update(synth, voice, eg1_phase, scratch->vca_buf[sample_count - 1],
+                             &osc_index)) {
+        XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_SHIFT, sample_count);
+        return; /* we're dead now, so return */
+    }
+
+    /* save things for next time around */
+
+    voice->eg1        = eg1;
+    voice->eg1_phase  = eg1_phase;
+    voice->eg2        = eg2;
+    voice->eg2_phase  = eg2_phase;
+    voice->osc_index  = osc_index;
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_SHIFT, sample_count);
+}
+
+/*
+ * xsynth_voice_render
+ *
+ * generate the actual sound data for this voice, with the oscillator
+ * and filter choices made at run time
+ */
+void
+xsynth_voice_render(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                    LADSPA_Data *out, unsigned long sample_count,
+                    int do_control_update)
+{
+    voice_render_kernel(synth, voice, out, sample_count, do_control_update,
+                        osc_kind(lrintf(*(synth->osc1_waveform))),
+                        osc_kind(lrintf(*(synth->osc2_waveform))),
+                        (*(synth->osc_sync) > 0.0001f),
+                        lrintf(*(synth->vcf_mode)));
+}
+
+/* ==== specialized render kernels ==== */
+
+/* One kernel for each combination of VCO 1 waveform, VCO 2 waveform, sync,
+ * and filter mode, each with its oscillator and filter functions chosen at
+ * compile time instead of per call.  xsynth_voice_select_kernel() picks
+ * the kernel for the current ports into synth->render_kernel. */
+
+#define KERNEL(o1, o2, s, f) \
+static void \
+voice_render_kernel_##o1##_##o2##_##s##_##f(xsynth_synth_t *synth, xsynth_voice_t *voice, \
+                                            LADSPA_Data *out, unsigned long sample_count, \
+                                            int do_control_update) \
+{ \
+    voice_render_kernel(synth, voice, out, sample_count, do_control_update, o1, o2, s, f); \
+}
+#define KERNELS_VCF(o1, o2, s)  KERNEL(o1, o2, s, 0) KERNEL(o1, o2, s, 1) KERNEL(o1, o2, s, 2)
+#define KERNELS_SYNC(o1, o2)    KERNELS_VCF(o1, o2, 0) KERNELS_VCF(o1, o2, 1)
+#define KERNELS_OSC2(o1)        KERNELS_SYNC(o1, 0) KERNELS_SYNC(o1, 1) KERNELS_SYNC(o1, 2) \
+                                KERNELS_SYNC(o1, 3) KERNELS_SYNC(o1, 4)
+KERNELS_OSC2(0)
+KERNELS_OSC2(1)
+KERNELS_OSC2(2)
+KERNELS_OSC2(3)
+KERNELS_OSC2(4)
+#undef KERNEL
+#undef KERNELS_VCF
+#undef KERNELS_SYNC
+#undef KERNELS_OSC2
+
+#define KERNEL(o1, o2, s, f)    voice_render_kernel_##o1##_##o2##_##s##_##f
+#define KERNELS_VCF(o1, o2, s)  { KERNEL(o1, o2, s, 0), KERNEL(o1, o2, s, 1), KERNEL(o1, o2, s, 2) }
+#define KERNELS_SYNC(o1, o2)    { KERNELS_VCF(o1, o2, 0), KERNELS_VCF(o1, o2, 1) }
+#define KERNELS_OSC2(o1)        { KERNELS_SYNC(o1, 0), KERNELS_SYNC(o1, 1), KERNELS_SYNC(o1, 2), \
+                                  KERNELS_SYNC(o1, 3), KERNELS_SYNC(o1, 4) }
+static const xsynth_render_kernel_t voice_render_kernels[OSC_KINDS][OSC_KINDS][2][3] = {
+    KERNELS_OSC2(0), KERNELS_OSC2(1), KERNELS_OSC2(2), KERNELS_OSC2(3), KERNELS_OSC2(4)
+};
+#undef KERNEL
+#undef KERNELS_VCF
+#undef KERNELS_SYNC
+#undef KERNELS_OSC2
+
+/* ==== fused render engine ==== */
+
+/* The fused engine renders a voice in a single pass: for each sample it
+ * applies the LFO and EGs, runs both oscillators for just that sample,
+ * then filters and mixes it, without the intermediate per-burst buffers of
+ * the multi-pass kernels.  Only the LFO and EGs are rendered ahead for the
+ * burst, by the same functions the scalar engine uses, so that every
+ * engine's envelopes flip and settle alike.  The oscillators' minBLEP
+ * residuals, which reach up to LONGEST_DD_PULSE_LENGTH samples ahead,
+ * still go into the voice's osc_audio ring, but each sample is read back
+ * and cleared as soon as it is complete.  The arithmetic is the same as
+ * the multi-pass path's, so the output matches it to within float
+ * rounding. */
+
+/*
+ * voice_render_fused_kernel
+ */
+static inline __attribute__((always_inline)) void
+voice_render_fused_kernel(xsynth_synth_t *synth, xsynth_voice_t *voice,
+                          LADSPA_Data *out, unsigned long sample_count,
+                          int do_control_update, const int osc_sync,
+                          const int vcf)
+{
+    unsigned long sample;
+
+    /* state variables saved in voice */
+
+    float         eg1        = voice->eg1,
+                  eg2        = voice->eg2;
+    unsigned char eg1_phase  = voice->eg1_phase,
+                  eg2_phase  = voice->eg2_phase;
+    int           osc_index  = voice->osc_index;
+    struct vcf_state f = { voice->delay1, voice->delay2, voice->delay3, voice->delay4, voice->c5 };
+
+    /* temporary variables used in calculating voice */
+
+    float deltat = synth->deltat;
+    float lfo, w2, freqcut, vca = 0.0f, sync, in, v, energy = 0.0f, qres;
+    int   index;
+    struct vparams vp;
+    xsynth_scratch_t *scratch = &synth->scratch[xsynth_thread_index];
+
+    /* set up synthesis variables from patch */
+    float         omega3 = *(synth->lfo_frequency);
+    unsigned char lfo_waveform = lrintf(*(synth->lfo_waveform));
+    float         lfo_amount_o = *(synth->lfo_amount_o);
+    float         lfo_amount_f = *(synth->lfo_amount_f);
+    float         eg1_amount_o = *(synth->eg1_amount_o);
+    float         eg2_amount_o = *(synth->eg2_amount_o);
+    float         vol_out = volume(*(synth->volume) * synth->cc_volume) * synth->render_gain;
+    int           osc1_kind = osc_kind(lrintf(*(synth->osc1_waveform)));
+    int           osc2_kind = osc_kind(lrintf(*(synth->osc2_waveform)));
+    float         balance1 = 1.0f - *(synth->osc_balance);
+    float         balance2 = *(synth->osc_balance);
+    XSYNTH_PROFILE_START();
 
-        /* already saved prev_pitch above */
+    voice_params(synth, voice, do_control_update, &vp);
 
-        /* check oscillator audio buffer index, shift buffer if necessary */
-        if (osc_index > MINBLEP_BUFFER_LENGTH - (XSYNTH_NUGGET_SIZE + LONGEST_DD_PULSE_LENGTH)) {
-            memcpy(voice->osc_audio, voice->osc_audio + osc_index,
-                   LONGEST_DD_PULSE_LENGTH * sizeof (float));
-            memset(voice->osc_audio + LONGEST_DD_PULSE_LENGTH, 0,
-                   (MINBLEP_BUFFER_LENGTH - LONGEST_DD_PULSE_LENGTH) * sizeof (float));
-            osc_index = 0;
+    qres = (vcf == VCF_MVCLPF ? vp.qres : 2.0f - vp.qres * 1.995f);
+
+    lfo_render(&voice->lfo_phase, lfo_increment(omega3, deltat), lfo_waveform,
+               scratch->lfo_buf, sample_count);
+    eg_render(scratch->eg1_buf, sample_count, &eg1, &eg1_phase,
+              vp.eg1_rate_level, vp.eg1_one_rate, vp.eg1_level, vp.eg1_amp);
+    eg_render(scratch->eg2_buf, sample_count, &eg2, &eg2_phase,
+              vp.eg2_rate_level, vp.eg2_one_rate, vp.eg2_level, vp.eg2_amp);
+
+    for (sample = 0; sample < sample_count; sample++) {
+
+        /* --- LFO, EG1, and EG2 */
+
+        lfo = scratch->lfo_buf[sample];
+        eg1 = scratch->eg1_buf[sample];
+        eg2 = scratch->eg2_buf[sample];
+
+        w2 = vp.w2 * (1.0f + eg1 * eg1_amount_o) *
+                     (1.0f + eg2 * eg2_amount_o) *
+                     (1.0f + lfo * lfo_amount_o);
+
+        freqcut = vcf_coefficient((vp.freqkey + vp.freqeg1 * eg1 + vp.freqeg2 * eg2) *
+                                  (1.0f + lfo * lfo_amount_f), vcf);
+
+        vca = eg1 * vol_out;
+
+        /* --- VCO 1 and VCO 2, for this one sample */
+
+        index = osc_index + sample;
+        if (osc_sync) {
+            BLOSC_CALL(master, osc1_kind, 1, voice, &voice->osc1, &sync, index, balance1, vp.w1)
+            BLOSC_CALL(slave, osc2_kind, 1, voice, &voice->osc2, &sync, index, balance2, &w2)
+        } else {
+            BLOSC_CALL(single1, osc1_kind, 1, voice, &voice->osc1, &sync, index, balance1, vp.w1)
+            BLOSC_CALL(single2, osc2_kind, 1, voice, &voice->osc2, &sync, index, balance2, &w2)
+        }
+
+        /* this sample of osc_audio is now complete, so take it and clear it */
+        in = voice->osc_audio[index];
+        voice->osc_audio[index] = 0.0f;
+
+        /* --- VCF and VCA */
+
+        switch (vcf) {
+          default:
+          case VCF_2POLE:
+            v = vcf_2pole_step(&f, in, freqcut, qres) * vca;
+            break;
+          case VCF_4POLE:
+            v = vcf_4pole_step(&f, in, freqcut, qres) * vca;
+            break;
+          case VCF_MVCLPF:
+            v = vcf_mvclpf_step(&f, in, freqcut, qres) * vca;
+            break;
+          case VCF_2POLE_TPT:
+            v = vcf_2pole_tpt_step(&f, in, freqcut, qres) * vca;
+            break;
+          case VCF_4POLE_TPT:
+            v = vcf_4pole_tpt_step(&f, in, freqcut, qres) * vca;
+            break;
         }
+        out[sample] += v;
+        energy += v * v;
+    }
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_FUSED, sample_count);
+
+    voice->energy += energy;
+    voice->delay1 = f.delay1;
+    voice->delay2 = f.delay2;
+    voice->delay3 = (vcf == VCF_4POLE || vcf == VCF_MVCLPF || vcf == VCF_4POLE_TPT ? f.delay3 : 0.0f);
+    voice->delay4 = (vcf == VCF_4POLE || vcf == VCF_MVCLPF || vcf == VCF_4POLE_TPT ? f.delay4 : 0.0f);
+    voice->c5     = (vcf == VCF_MVCLPF ? f.c5 : 0.0f);
+    voice->mvclpf_factor = 0;  /* the fused engine always runs the classic MVCLPF */
+
+    osc_index += sample_count;
+
+    if (do_control_update &&
+        voice_control_update(synth, voice, eg1_phase, vca, &osc_index)) {
+        XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_SHIFT, sample_count);
+        return; /* we're dead now, so return */
     }
 
     /* save things for next time around */
 
-    voice->lfo_pos    = lfo_pos;
     voice->eg1        = eg1;
     voice->eg1_phase  = eg1_phase;
     voice->eg2        = eg2;
     voice->eg2_phase  = eg2_phase;
     voice->osc_index  = osc_index;
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_SHIFT, sample_count);
+}
+
+#define KERNEL(s, f) \
+static void \
+voice_render_fused_kernel_##s##_##f(xsynth_synth_t *synth, xsynth_voice_t *voice, \
+                                    LADSPA_Data *out, unsigned long sample_count, \
+                                    int do_control_update) \
+{ \
+    voice_render_fused_kernel(synth, voice, out, sample_count, do_control_update, s, f); \
+}
+KERNEL(0, 0) KERNEL(0, 1) KERNEL(0, 2) KERNEL(0, 3) KERNEL(0, 4)
+KERNEL(1, 0) KERNEL(1, 1) KERNEL(1, 2) KERNEL(1, 3) KERNEL(1, 4)
+#undef KERNEL
+
+#define KERNEL(s, f)  voice_render_fused_kernel_##s##_##f
+static const xsynth_render_kernel_t voice_render_fused_kernels[2][VCF_KINDS] = {
+    { KERNEL(0, 0), KERNEL(0, 1), KERNEL(0, 2), KERNEL(0, 3), KERNEL(0, 4) },
+    { KERNEL(1, 0), KERNEL(1, 1), KERNEL(1, 2), KERNEL(1, 3), KERNEL(1, 4) }
+};
+#undef KERNEL
+
+/*
+ * xsynth_voice_select_kernel
+ *
+ * choose the render kernel to suit the render engine and the current
+ * oscillator waveform, sync, and filter mode ports.  Called at the start
+ * of each run, which is the only time the ports can change.  The fused
+ * kernels are only specialized for sync and filter kind; the choice of
+ * oscillator function is the same for every sample of a run, so it
+ * predicts well.
+ */
+void
+xsynth_voice_select_kernel(xsynth_synth_t *synth)
+{
+    int vcf_mode = lrintf(*(synth->vcf_mode));
+    int osc_sync = (*(synth->osc_sync) > 0.0001f);
+
+    if (vcf_mode < 0 || vcf_mode > 2)
+        vcf_mode = 0;
+
+    if (synth->render_engine == XSYNTH_RENDER_FUSED)
+        synth->render_kernel =
+            voice_render_fused_kernels[osc_sync][vcf_kind(vcf_mode, synth->vcf_topology)];
+    else
+        synth->render_kernel =
+            voice_render_kernels[osc_kind(lrintf(*(synth->osc1_waveform)))]
+                                [osc_kind(lrintf(*(synth->osc2_waveform)))]
+                                [osc_sync][vcf_mode];
+}
+
+/* ==== voice-parallel (SIMD) render engine ==== */
+
+/* The SIMD engine renders XSYNTH_SIMD_LANES voices at once: the voices'
+ * envelope, LFO, and filter state is gathered into a struct-of-arrays
+ * block, one vector lane per voice, and the modulation and VCF/VCA
+ * sections then run on all lanes together.  Only the oscillators, whose
+ * minBLEP placement is inherently per-voice, run one voice at a time.
+ * Each lane does exactly the arithmetic the scalar path does, and the
+ * lanes are mixed to the output in voice order, so the output matches
+ * the scalar path. */
+
+typedef float v_sf __attribute__((vector_size(XSYNTH_SIMD_LANES * sizeof(float))));
+typedef int   v_si __attribute__((vector_size(XSYNTH_SIMD_LANES * sizeof(int))));
+
+static inline v_sf
+v_select(v_si mask, v_sf a, v_sf b)  /* mask ? a : b, per lane */
+{
+    return (v_sf)((mask & (v_si)a) | (~mask & (v_si)b));
+}
+
+static inline v_sf
+v_min(v_sf a, v_sf b)
+{
+    return v_select(a < b, a, b);
+}
+
+static inline v_sf
+v_max(v_sf a, v_sf b)
+{
+    return v_select(a > b, a, b);
+}
+
+static inline v_sf
+v_sqrt(v_sf x)
+{
+#if defined(__AVX__) && XSYNTH_SIMD_LANES == 8
+    return __builtin_ia32_sqrtps256(x);
+#elif defined(__SSE__) && XSYNTH_SIMD_LANES == 4
+    return __builtin_ia32_sqrtps(x);
+#else
+    int i;
+    for (i = 0; i < XSYNTH_SIMD_LANES; i++)
+        x[i] = sqrtf(x[i]);
+    return x;
+#endif
+}
+
+struct vblock {
+    /* filter state, one lane per voice */
+    v_sf delay1, delay2, delay3, delay4, c5;
+    v_sf decim2[7], decim4[4];  /* oversampled MVCLPF only */
+    /* per-sample modulation and audio, one lane per voice */
+    v_sf lfo[XSYNTH_NUGGET_SIZE];
+    v_sf eg1[XSYNTH_NUGGET_SIZE];
+    v_sf eg2[XSYNTH_NUGGET_SIZE];
+    v_sf freqcut[XSYNTH_NUGGET_SIZE];
+    v_sf vca[XSYNTH_NUGGET_SIZE];
+    v_sf in[XSYNTH_NUGGET_SIZE];
+    v_sf out[XSYNTH_NUGGET_SIZE];
+};
+
+static inline void
+vcf_2pole_v(struct vblock *b, unsigned long sample_count, v_sf qres)
+{
+    unsigned long sample;
+    v_sf freqcut, highpass,
+         delay1 = b->delay1,
+         delay2 = b->delay2;
+
+    qres = 2.0f - qres * 1.995f;
+
+    for (sample = 0; sample < sample_count; sample++) {
+        freqcut = b->freqcut[sample];
+
+        delay2 = delay2 + freqcut * delay1;
+        highpass = b->in[sample] - delay2 - qres * delay1;
+        delay1 = freqcut * highpass + delay1;
+
+        b->out[sample] = delay2 * b->vca[sample];
+    }
+
+    b->delay1 = delay1;
+    b->delay2 = delay2;
+    b->delay3 = (v_sf){};
+    b->delay4 = (v_sf){};
+    b->c5 = (v_sf){};
+}
+
+static inline void
+vcf_4pole_v(struct vblock *b, unsigned long sample_count, v_sf qres)
+{
+    unsigned long sample;
+    v_sf freqcut, highpass,
+         delay1 = b->delay1,
+         delay2 = b->delay2,
+         delay3 = b->delay3,
+         delay4 = b->delay4;
+
+    qres = 2.0f - qres * 1.995f;
+
+    for (sample = 0; sample < sample_count; sample++) {
+        freqcut = b->freqcut[sample];
+
+        delay2 = delay2 + freqcut * delay1;
+        highpass = b->in[sample] - delay2 - qres * delay1;
+        delay1 = freqcut * highpass + delay1;
+
+        delay4 = delay4 + freqcut * delay3;
+        highpass = delay2 - delay4 - qres * delay3;
+        delay3 = freqcut * highpass + delay3;
+
+        b->out[sample] = delay4 * b->vca[sample];
+    }
+
+    b->delay1 = delay1;
+    b->delay2 = delay2;
+    b->delay3 = delay3;
+    b->delay4 = delay4;
+    b->c5 = (v_sf){};
+}
+
+static inline v_sf
+vcf_tpt_stage_v(v_sf *s1, v_sf *s2, v_sf in, v_sf g, v_sf damping, v_sf h)
+{
+    v_sf highpass, bandpass, lowpass, v;
+
+    highpass = (in - (damping + g) * *s1 - *s2) * h;
+    v = g * highpass;
+    bandpass = v + *s1;
+    *s1 = bandpass + v;
+    v = g * bandpass;
+    lowpass = v + *s2;
+    *s2 = lowpass + v;
+
+    return lowpass;
+}
+
+static inline void
+vcf_2pole_tpt_v(struct vblock *b, unsigned long sample_count, v_sf qres)
+{
+    unsigned long sample;
+    v_sf g, h,
+         delay1 = b->delay1,
+         delay2 = b->delay2;
+
+    qres = 2.0f - qres * 1.995f;
+
+    for (sample = 0; sample < sample_count; sample++) {
+        g = b->freqcut[sample];
+        h = 1.0f / (1.0f + g * (g + qres));
+        b->out[sample] = vcf_tpt_stage_v(&delay1, &delay2, b->in[sample], g, qres, h) *
+                         b->vca[sample];
+    }
+
+    b->delay1 = delay1;
+    b->delay2 = delay2;
+    b->delay3 = (v_sf){};
+    b->delay4 = (v_sf){};
+    b->c5 = (v_sf){};
+}
+
+static inline void
+vcf_4pole_tpt_v(struct vblock *b, unsigned long sample_count, v_sf qres)
+{
+    unsigned long sample;
+    v_sf g, h, x,
+         delay1 = b->delay1,
+         delay2 = b->delay2,
+         delay3 = b->delay3,
+         delay4 = b->delay4;
+
+    qres = 2.0f - qres * 1.995f;
+
+    for (sample = 0; sample < sample_count; sample++) {
+        g = b->freqcut[sample];
+        h = 1.0f / (1.0f + g * (g + qres));
+        x = vcf_tpt_stage_v(&delay1, &delay2, b->in[sample], g, qres, h);
+        x = vcf_tpt_stage_v(&delay3, &delay4, x, g, qres, h);
+        b->out[sample] = x * b->vca[sample];
+    }
+
+    b->delay1 = delay1;
+    b->delay2 = delay2;
+    b->delay3 = delay3;
+    b->delay4 = delay4;
+    b->c5 = (v_sf){};
+}
+
+static inline v_sf
+mvclpf_stage_v(v_sf w, v_sf x, v_sf *delay)
+{
+    v_sf d = w * (x - *delay) / (1.0f + *delay * *delay);
+    x = *delay + 0.77f * d;
+    *delay = x + 0.23f * d;
+    return x;
+}
+
+static void
+vcf_mvclpf_v(struct vblock *b, unsigned long sample_count, v_sf res)
+{
+    unsigned long s;
+    v_sf w, x, d,
+         delay1 = b->delay1,
+         delay2 = b->delay2,
+         delay3 = b->delay3,
+         delay4 = b->delay4,
+         c5     = b->c5;
+    const float g0 = 0.5f, g1 = 2.0f;
+
+    for (s = 0; s < sample_count; s++) {
+
+        w = b->freqcut[s];  /* already warped by vcf_coefficients() */
+
+        x = b->in[s] * g0 - (4.3f - 0.2f * w) * res * c5 + 1e-10f;
+        x /= v_sqrt(1.0f + x * x);  /* x = tanh(x) */
+        x = mvclpf_stage_v(w, x, &delay1);
+        x = mvclpf_stage_v(w, x, &delay2);
+        x = mvclpf_stage_v(w, x, &delay3);
+        d = w * (x  - delay4);
+        x = delay4 + 0.77f * d;
+        delay4 = x + 0.23f * d;
+        c5 += 0.85f * (delay4 - c5);
+
+        x = b->in[s] * g0 - (4.3f - 0.2f * w) * res * c5;
+        x /= v_sqrt(1.0f + x * x);  /* x = tanh(x) */
+        x = mvclpf_stage_v(w, x, &delay1);
+        x = mvclpf_stage_v(w, x, &delay2);
+        x = mvclpf_stage_v(w, x, &delay3);
+        d = w * (x  - delay4);
+        x = delay4 + 0.77f * d;
+        delay4 = x + 0.23f * d;
+        c5 += 0.85f * (delay4 - c5);
+
+        b->out[s] = g1 * delay4 * b->vca[s];
+    }
+
+    b->delay1 = delay1;
+    b->delay2 = delay2;
+    b->delay3 = delay3;
+    b->delay4 = delay4;
+    b->c5     = c5;
+}
+
+/* the vector versions of mvclpf_tanh(), mvclpf_pass(), halfband_11()
+ * and halfband_7() */
+static inline v_sf
+mvclpf_tanh_v(v_sf x)
+{
+    x = v_min(v_max(x, (v_sf){} - 3.0f), (v_sf){} + 3.0f);
+    return x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+}
+
+static inline v_sf
+mvclpf_pass_v(struct vblock *b, v_sf in, v_sf w, v_sf res)
+{
+    v_sf x, d;
+
+    x = mvclpf_tanh_v(in * 0.5f - (4.3f - 0.2f * w) * res * b->c5 + 1e-10f);
+    x = mvclpf_stage_v(w, x, &b->delay1);
+    x = mvclpf_stage_v(w, x, &b->delay2);
+    x = mvclpf_stage_v(w, x, &b->delay3);
+    d = w * (x - b->delay4);
+    x = b->delay4 + 0.77f * d;
+    b->delay4 = x + 0.23f * d;
+    b->c5 += 0.85f * (b->delay4 - b->c5);
+
+    return b->delay4;
+}
+
+static inline v_sf
+halfband_11_v(v_sf *h, v_sf odd, v_sf even)
+{
+    v_sf y = 0.5f * h[6] + HB11_A * (h[1] + h[2]) + HB11_B * (h[0] + h[3]) +
+             HB11_C * (even + h[4]);
+
+    h[4] = h[3]; h[3] = h[2]; h[2] = h[1]; h[1] = h[0]; h[0] = even;
+    h[6] = h[5]; h[5] = odd;
+    return y;
 }
 
+static inline v_sf
+halfband_7_v(v_sf *h, v_sf odd, v_sf even)
+{
+    v_sf y = 0.5f * h[3] + HB7_A * (h[0] + h[1]) + HB7_B * (even + h[2]);
+
+    h[2] = h[1]; h[1] = h[0]; h[0] = even;
+    h[3] = odd;
+    return y;
+}
+
+static inline __attribute__((always_inline)) void
+vcf_mvclpf_os_v(struct vblock *b, unsigned long sample_count, v_sf res, const int factor)
+{
+    unsigned long s;
+    v_sf w, x, y;
+
+    for (s = 0; s < sample_count; s++) {
+        w = b->freqcut[s];
+
+        switch (factor) {
+          default:
+          case 1:
+            y = mvclpf_pass_v(b, b->in[s], w, res);
+            y = halfband_11_v(b->decim2, y, y);
+            break;
+          case 2:
+            x = mvclpf_pass_v(b, b->in[s], w, res);
+            y = mvclpf_pass_v(b, b->in[s], w, res);
+            y = halfband_11_v(b->decim2, x, y);
+            break;
+          case 4:
+            x = mvclpf_pass_v(b, b->in[s], w, res);
+            y = mvclpf_pass_v(b, b->in[s], w, res);
+            x = halfband_7_v(b->decim4, x, y);
+            y = mvclpf_pass_v(b, b->in[s], w, res);
+            y = halfband_7_v(b->decim4, y, mvclpf_pass_v(b, b->in[s], w, res));
+            y = halfband_11_v(b->decim2, x, y);
+            break;
+        }
+
+        b->out[s] = 2.0f * y * b->vca[s];
+    }
+}
+
+/*
+ * xsynth_voice_render_block
+ *
+ * render up to XSYNTH_SIMD_LANES voices, one per vector lane
+ */
+static void
+xsynth_voice_render_block(xsynth_synth_t *synth, xsynth_voice_t **voices,
+                          int lanes, LADSPA_Data *out,
+                          unsigned long sample_count, int do_control_update)
+{
+    unsigned long sample;
+    int lane, vcf, oversample = 0, i;
+    float res;
+    xsynth_voice_t *voice;
+    struct vblock b;
+    struct vparams vp[XSYNTH_SIMD_LANES];
+    int osc_index[XSYNTH_SIMD_LANES];
+    float eg1[XSYNTH_SIMD_LANES], eg2[XSYNTH_SIMD_LANES];
+    unsigned char eg1_phase[XSYNTH_SIMD_LANES], eg2_phase[XSYNTH_SIMD_LANES];
+    xsynth_scratch_t *scratch = &synth->scratch[xsynth_thread_index];
+
+    float deltat = synth->deltat;
+    float         omega3 = *(synth->lfo_frequency);
+    unsigned char lfo_waveform = lrintf(*(synth->lfo_waveform));
+    float         lfo_amount_o = *(synth->lfo_amount_o);
+    float         lfo_amount_f = *(synth->lfo_amount_f);
+    float         eg1_amount_o = *(synth->eg1_amount_o);
+    float         eg2_amount_o = *(synth->eg2_amount_o);
+    unsigned char vcf_mode = lrintf(*(synth->vcf_mode));
+    float         vol_out = volume(*(synth->volume) * synth->cc_volume) * synth->render_gain;
+
+    v_sf w2 = {}, freqkey = {}, freqeg1 = {}, freqeg2 = {}, qres = {}, energy = {},
+         lfo, e1, e2, osc2_w[XSYNTH_NUGGET_SIZE];
+    XSYNTH_PROFILE_START();
+
+    b.delay1 = b.delay2 = b.delay3 = b.delay4 = b.c5 = (v_sf){};
+
+    /* gather voice state into the block */
+    for (lane = 0; lane < lanes; lane++) {
+        voice = voices[lane];
+        voice_params(synth, voice, do_control_update, &vp[lane]);
+        osc_index[lane] = voice->osc_index;
+
+        w2[lane] = vp[lane].w2;
+        freqkey[lane] = vp[lane].freqkey;
+        freqeg1[lane] = vp[lane].freqeg1;
+        freqeg2[lane] = vp[lane].freqeg2;
+        qres[lane] = vp[lane].qres;
+
+        b.delay1[lane] = voice->delay1;
+        b.delay2[lane] = voice->delay2;
+        b.delay3[lane] = voice->delay3;
+        b.delay4[lane] = voice->delay4;
+        b.c5[lane]     = voice->c5;
+
+        /* the LFO table lookup doesn't vectorize across lanes, and the
+         * envelopes are the scalar engine's, so run them per lane */
+        lfo_render(&voice->lfo_phase, lfo_increment(omega3, deltat), lfo_waveform,
+                   scratch->lfo_buf, sample_count);
+        eg1[lane] = voice->eg1;
+        eg1_phase[lane] = voice->eg1_phase;
+        eg_render(scratch->eg1_buf, sample_count, &eg1[lane], &eg1_phase[lane],
+                  vp[lane].eg1_rate_level, vp[lane].eg1_one_rate, vp[lane].eg1_level,
+                  vp[lane].eg1_amp);
+        eg2[lane] = voice->eg2;
+        eg2_phase[lane] = voice->eg2_phase;
+        eg_render(scratch->eg2_buf, sample_count, &eg2[lane], &eg2_phase[lane],
+                  vp[lane].eg2_rate_level, vp[lane].eg2_one_rate, vp[lane].eg2_level,
+                  vp[lane].eg2_amp);
+        for (sample = 0; sample < sample_count; sample++) {
+            b.lfo[sample][lane] = scratch->lfo_buf[sample];
+            b.eg1[sample][lane] = scratch->eg1_buf[sample];
+            b.eg2[sample][lane] = scratch->eg2_buf[sample];
+        }
+    }
+    for (; lane < XSYNTH_SIMD_LANES; lane++) {  /* unused lanes stay silent */
+        for (sample = 0; sample < sample_count; sample++) {
+            b.lfo[sample][lane] = 0.0f;
+            b.eg1[sample][lane] = 0.0f;
+            b.eg2[sample][lane] = 0.0f;
+            b.in[sample][lane] = 0.0f;
+        }
+    }
+
+    /* --- LFO, EG1, and EG2 section, all lanes */
+
+    for (sample = 0; sample < sample_count; sample++) {
+
+        lfo = b.lfo[sample];
+
+        e1 = 1.0f + b.eg1[sample] * eg1_amount_o;
+        e2 = 1.0f + b.eg2[sample] * eg2_amount_o;
+        osc2_w[sample] = w2 * e1 * e2 * (1.0f + lfo * lfo_amount_o);
+
+        b.freqcut[sample] = (freqkey + freqeg1 * b.eg1[sample] + freqeg2 * b.eg2[sample]) *
+                            (1.0f + lfo * lfo_amount_f);
+
+        b.vca[sample] = b.eg1[sample] * vol_out;
+    }
+
+    /* the cutoffs of all lanes become coefficient ramps in one pass */
+    vcf = vcf_kind(vcf_mode, synth->vcf_topology);
+    if (vcf == VCF_MVCLPF) {
+        /* the lanes share one oversampling factor, picked for the most
+         * resonant of them */
+        res = qres[0];
+        for (lane = 1; lane < lanes; lane++)
+            if (qres[lane] > res) res = qres[lane];
+        oversample = mvclpf_prepare(synth, (float *)b.freqcut,
+                                    sample_count * XSYNTH_SIMD_LANES, res);
+    }
+    for (lane = 0; lane < lanes; lane++)
+        mvclpf_prime(voices[lane], oversample);
+    if (oversample) {
+        for (lane = 0; lane < lanes; lane++) {
+            voice = voices[lane];
+            for (i = 0; i < 7; i++) b.decim2[i][lane] = voice->decim2[i];
+            for (i = 0; i < 4; i++) b.decim4[i][lane] = voice->decim4[i];
+        }
+        for (; lane < XSYNTH_SIMD_LANES; lane++) {
+            for (i = 0; i < 7; i++) b.decim2[i][lane] = 0.0f;
+            for (i = 0; i < 4; i++) b.decim4[i][lane] = 0.0f;
+        }
+    }
+    vcf_coefficients((float *)b.freqcut, sample_count * XSYNTH_SIMD_LANES, vcf);
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_MODULATORS, sample_count * lanes);
+
+    /* --- VCO 1 and VCO 2 section, one voice at a time */
+
+    for (lane = 0; lane < lanes; lane++) {
+        voice = voices[lane];
+
+        for (sample = 0; sample < sample_count; sample++)
+            scratch->osc2_w_buf[sample] = osc2_w[sample][lane];
+
+        voice_render_oscillators(synth, voice, scratch, sample_count, osc_index[lane],
+                                 vp[lane].w1);
+
+        for (sample = 0; sample < sample_count; sample++)
+            b.in[sample][lane] = voice->osc_audio[osc_index[lane] + sample];
+        memset(voice->osc_audio + osc_index[lane], 0, sample_count * sizeof(float));
+    }
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_OSCILLATORS, sample_count * lanes);
+
+    /* --- VCF and VCA section, all lanes */
+
+    switch (vcf) {
+      default:
+      case VCF_2POLE:
+        vcf_2pole_v(&b, sample_count, qres);
+        break;
+      case VCF_4POLE:
+        vcf_4pole_v(&b, sample_count, qres);
+        break;
+      case VCF_MVCLPF:
+        switch (oversample) {
+          default: vcf_mvclpf_v(&b, sample_count, qres); break;
+          case 1:  vcf_mvclpf_os_v(&b, sample_count, qres, 1); break;
+          case 2:  vcf_mvclpf_os_v(&b, sample_count, qres, 2); break;
+          case 4:  vcf_mvclpf_os_v(&b, sample_count, qres, 4); break;
+        }
+        break;
+      case VCF_2POLE_TPT:
+        vcf_2pole_tpt_v(&b, sample_count, qres);
+        break;
+      case VCF_4POLE_TPT:
+        vcf_4pole_tpt_v(&b, sample_count, qres);
+        break;
+    }
+
+    /* mix the lanes in voice order, as the scalar path would */
+    for (sample = 0; sample < sample_count; sample++)
+        for (lane = 0; lane < lanes; lane++)
+            out[sample] += b.out[sample][lane];
+
+    /* track each voice's output energy for the silence check */
+    for (sample = 0; sample < sample_count; sample++)
+        energy += b.out[sample] * b.out[sample];
+    for (lane = 0; lane < lanes; lane++)
+        voices[lane]->energy += energy[lane];
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_VCF + (vcf_mode > 2 ? 0 : vcf_mode),
+                         sample_count * lanes);
+
+    /* scatter voice state back out of the block */
+    for (lane = 0; lane < lanes; lane++) {
+        voice = voices[lane];
+
+        osc_index[lane] += sample_count;
+
+        if (do_control_update &&
+            voice_control_update(synth, voice, eg1_phase[lane], b.vca[sample_count - 1][lane],
+                                 &osc_index[lane]))
+            continue; /* this one's dead */
+
+        voice->eg1        = eg1[lane];
+        voice->eg1_phase  = eg1_phase[lane];
+        voice->eg2        = eg2[lane];
+        voice->eg2_phase  = eg2_phase[lane];
+        voice->delay1     = b.delay1[lane];
+        voice->delay2     = b.delay2[lane];
+        voice->delay3     = b.delay3[lane];
+        voice->delay4     = b.delay4[lane];
+        voice->c5         = b.c5[lane];
+        voice->osc_index  = osc_index[lane];
+        if (oversample) {
+            for (i = 0; i < 7; i++) voice->decim2[i] = b.decim2[i][lane];
+            for (i = 0; i < 4; i++) voice->decim4[i] = b.decim4[i][lane];
+        }
+    }
+
+    XSYNTH_PROFILE_STAGE(XSYNTH_STAGE_SHIFT, sample_count * lanes);
+}
+
+/*
+ * xsynth_voice_render_simd
+ *
+ * render a list of playing voices, XSYNTH_SIMD_LANES at a time
+ */
+void
+xsynth_voice_render_simd(xsynth_synth_t *synth, xsynth_voice_t **voices,
+                         int count, LADSPA_Data *out,
+                         unsigned long sample_count, int do_control_update)
+{
+    int lanes;
+
+    while (count > 1) {
+        lanes = (count > XSYNTH_SIMD_LANES ? XSYNTH_SIMD_LANES : count);
+        xsynth_voice_render_block(synth, voices, lanes, out, sample_count,
+                                  do_control_update);
+        voices += lanes;
+        count -= lanes;
+    }
+    if (count)  /* a lone voice doesn't benefit from the block setup */
+        synth->render_kernel(synth, *voices, out, sample_count, do_control_update);
+}